@@ -0,0 +1,212 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compares an iceperf result against a stored baseline and exits nonzero on
+// regressions, so transport performance can be gated per commit:
+//
+//     iceperf-compare <baseline.json> <current.json> [maxRegressionPercent]
+//
+// Both files contain a single JSON line as written by iceperf-laurel or
+// iceperf-throughput via the [jsonFile] argument. For latency results the
+// p50/p99/p99.9 percentiles are compared per payload size (higher is worse),
+// for throughput results the received msgs/s (lower is worse). The max latency
+// is reported but not gated, a single outlier would make the gate flaky.
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+constexpr double DEFAULT_MAX_REGRESSION_PERCENT{10.};
+
+// the benchmarks emit a fixed flat format, so a full JSON parser is not
+// needed; this extracts the number following "key": starting at fromPosition
+bool findNumber(const std::string& json, const std::string& key, const size_t fromPosition, double& value)
+{
+    const std::string quotedKey = "\"" + key + "\":";
+    const size_t keyPosition = json.find(quotedKey, fromPosition);
+    if (keyPosition == std::string::npos)
+    {
+        return false;
+    }
+    value = std::atof(json.c_str() + keyPosition + quotedKey.size());
+    return true;
+}
+
+bool readResultFile(const char* const fileName, std::string& json)
+{
+    std::ifstream file(fileName);
+    if (!file)
+    {
+        std::cerr << "Could not open " << fileName << std::endl;
+        return false;
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    json = content.str();
+    return true;
+}
+
+// prints one metric comparison and returns true if the metric regressed by
+// more than the allowed percentage; for metrics where lower values are better
+// pass lowerIsBetter = true
+bool checkMetric(const std::string& name,
+                 const double baseline,
+                 const double current,
+                 const double maxRegressionPercent,
+                 const bool lowerIsBetter,
+                 const bool gated = true)
+{
+    double changePercent = 0.;
+    if (baseline != 0.)
+    {
+        changePercent = (current - baseline) / baseline * 100.;
+    }
+    const double regressionPercent = lowerIsBetter ? changePercent : -changePercent;
+    const bool regressed = gated && (regressionPercent > maxRegressionPercent);
+
+    std::cout << "| " << std::setw(28) << name << " | " << std::setw(14) << baseline << " | " << std::setw(14)
+              << current << " | " << std::setw(7) << std::showpos << changePercent << std::noshowpos << " % | "
+              << (regressed ? "REGRESSED" : (gated ? "ok" : "not gated")) << " |" << std::endl;
+
+    return regressed;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "usage: " << argv[0] << " <baseline.json> <current.json> [maxRegressionPercent]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    double maxRegressionPercent{DEFAULT_MAX_REGRESSION_PERCENT};
+    if (argc > 3)
+    {
+        maxRegressionPercent = std::atof(argv[3]);
+        if (maxRegressionPercent <= 0.)
+        {
+            std::cerr << "maxRegressionPercent must be greater than 0" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::string baseline;
+    std::string current;
+    if (!readResultFile(argv[1], baseline) || !readResultFile(argv[2], current))
+    {
+        return EXIT_FAILURE;
+    }
+
+    const bool isLatencyBenchmark = baseline.find("\"benchmark\":\"iceperf\"") != std::string::npos;
+    const bool isThroughputBenchmark = baseline.find("\"benchmark\":\"iceperf_throughput\"") != std::string::npos;
+    if (!isLatencyBenchmark && !isThroughputBenchmark)
+    {
+        std::cerr << "Unknown benchmark in " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+    if ((current.find("\"benchmark\":\"iceperf\"") != std::string::npos) != isLatencyBenchmark)
+    {
+        std::cerr << "Baseline and current result stem from different benchmarks" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Comparing " << argv[2] << " against baseline " << argv[1] << ", allowed regression "
+              << maxRegressionPercent << " %" << std::endl;
+    std::cout << std::endl;
+    std::cout << "| " << std::setw(28) << "metric"
+              << " | " << std::setw(14) << "baseline"
+              << " | " << std::setw(14) << "current"
+              << " |  change % | gate |" << std::endl;
+    std::cout << "|------------------------------|---------------:|---------------:|----------:|------|" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    bool anyRegression = false;
+
+    if (isLatencyBenchmark)
+    {
+        // walk the results array of the baseline and look the payload sizes up
+        // in the current result; a payload size missing in the current result
+        // fails the gate since the sweep must not silently shrink
+        const std::string payloadKey = "\"payload_bytes\":";
+        size_t baselinePosition = baseline.find(payloadKey);
+        while (baselinePosition != std::string::npos)
+        {
+            double payloadBytes = 0.;
+            findNumber(baseline, "payload_bytes", baselinePosition, payloadBytes);
+
+            const std::string currentEntry =
+                payloadKey + std::to_string(static_cast<uint64_t>(payloadBytes)) + ",";
+            const size_t currentPosition = current.find(currentEntry);
+            if (currentPosition == std::string::npos)
+            {
+                std::cerr << "Payload size " << static_cast<uint64_t>(payloadBytes)
+                          << " B is missing in the current result" << std::endl;
+                anyRegression = true;
+                baselinePosition = baseline.find(payloadKey, baselinePosition + payloadKey.size());
+                continue;
+            }
+
+            const std::string payloadName = std::to_string(static_cast<uint64_t>(payloadBytes)) + " B ";
+            for (const auto& percentile : {"p50", "p99", "p999"})
+            {
+                double baselineValue = 0.;
+                double currentValue = 0.;
+                if (findNumber(baseline, percentile, baselinePosition, baselineValue)
+                    && findNumber(current, percentile, currentPosition, currentValue))
+                {
+                    anyRegression |= checkMetric(payloadName + percentile + " latency [ns]",
+                                                 baselineValue,
+                                                 currentValue,
+                                                 maxRegressionPercent,
+                                                 true);
+                }
+            }
+
+            double baselineMax = 0.;
+            double currentMax = 0.;
+            if (findNumber(baseline, "max", baselinePosition, baselineMax)
+                && findNumber(current, "max", currentPosition, currentMax))
+            {
+                checkMetric(payloadName + "max latency [ns]", baselineMax, currentMax, maxRegressionPercent, true, false);
+            }
+
+            baselinePosition = baseline.find(payloadKey, baselinePosition + payloadKey.size());
+        }
+    }
+    else
+    {
+        for (const auto& metric : {"sent_msgs_per_s", "received_msgs_per_s", "received_gb_per_s"})
+        {
+            double baselineValue = 0.;
+            double currentValue = 0.;
+            if (findNumber(baseline, metric, 0u, baselineValue) && findNumber(current, metric, 0u, currentValue))
+            {
+                anyRegression |= checkMetric(metric, baselineValue, currentValue, maxRegressionPercent, false);
+            }
+        }
+    }
+
+    std::cout << std::endl;
+    if (anyRegression)
+    {
+        std::cout << "FAILED: performance regressed by more than " << maxRegressionPercent << " %" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "PASSED: no regression beyond " << maxRegressionPercent << " %" << std::endl;
+    return EXIT_SUCCESS;
+}
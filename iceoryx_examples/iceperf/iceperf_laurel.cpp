@@ -15,22 +15,48 @@
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "latency_histogram.hpp"
 #include "topic_data.hpp"
 
 #include <chrono>
+#include <cstdlib>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
 
-constexpr int64_t NUMBER_OF_ROUNDTRIPS{1000000};
+constexpr int64_t DEFAULT_NUMBER_OF_ROUNDTRIPS{1000000};
+constexpr int64_t DEFAULT_NUMBER_OF_WARMUP_ROUNDTRIPS{10000};
 constexpr char APP_NAME[] = "/laurel";
 constexpr char PUBLISHER[] = "Laurel";
 constexpr char SUBSCRIBER[] = "Hardy";
 
-double measureLatency(iox::popo::Publisher& publisher, iox::popo::Subscriber& subscriber)
+std::string payloadSizeToString(const uint32_t payloadSizeInBytes)
 {
+    if (payloadSizeInBytes >= 1024u * 1024u)
+    {
+        return std::to_string(payloadSizeInBytes / (1024u * 1024u)) + " MB";
+    }
+    else if (payloadSizeInBytes >= 1024u)
+    {
+        return std::to_string(payloadSizeInBytes / 1024u) + " kB";
+    }
+    return std::to_string(payloadSizeInBytes) + " B";
+}
+
+LatencyHistogram measureLatency(iox::popo::Publisher& publisher,
+                                iox::popo::Subscriber& subscriber,
+                                const int64_t numberOfRoundtrips,
+                                const int64_t numberOfWarmupRoundtrips)
+{
+    LatencyHistogram histogram;
+
+    // run the performance test; the warmup round-trips heat up the caches and
+    // let both applications settle and are not recorded
     auto start = std::chrono::high_resolution_clock::now();
-    // run the performance test
-    for (auto i = 0; i < NUMBER_OF_ROUNDTRIPS; ++i)
+    for (int64_t i = 0; i < numberOfWarmupRoundtrips + numberOfRoundtrips; ++i)
     {
         const void* receivedChunk;
         while (!subscriber.getChunk(&receivedChunk))
@@ -47,19 +73,45 @@ double measureLatency(iox::popo::Publisher& publisher, iox::popo::Subscriber& su
         publisher.sendChunk(sendSample);
 
         subscriber.releaseChunk(receivedChunk);
-    }
 
-    auto finish = std::chrono::high_resolution_clock::now();
+        auto finish = std::chrono::high_resolution_clock::now();
+        if (i >= numberOfWarmupRoundtrips)
+        {
+            constexpr int64_t TRANSMISSIONS_PER_ROUNDTRIP{2};
+            auto roundtripDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
+            histogram.record(static_cast<uint64_t>(roundtripDuration.count() / TRANSMISSIONS_PER_ROUNDTRIP));
+        }
+        start = finish;
+    }
 
-    constexpr int64_t TRANSMISSIONS_PER_ROUNDTRIP{2};
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
-    auto latencyInNanoSeconds = (duration.count() / (NUMBER_OF_ROUNDTRIPS * TRANSMISSIONS_PER_ROUNDTRIP));
-    auto latencyInMicroSeconds = static_cast<double>(latencyInNanoSeconds) / 1000;
-    return latencyInMicroSeconds;
+    return histogram;
 }
 
-int main()
+int main(int argc, char* argv[])
 {
+    // number of measured and warmup round-trips can be overridden on the
+    // command line: iceperf-laurel [roundtrips] [warmupRoundtrips] [jsonFile]
+    int64_t numberOfRoundtrips{DEFAULT_NUMBER_OF_ROUNDTRIPS};
+    int64_t numberOfWarmupRoundtrips{DEFAULT_NUMBER_OF_WARMUP_ROUNDTRIPS};
+    std::string jsonFileName;
+    if (argc > 1)
+    {
+        numberOfRoundtrips = std::atoll(argv[1]);
+    }
+    if (argc > 2)
+    {
+        numberOfWarmupRoundtrips = std::atoll(argv[2]);
+    }
+    if (argc > 3)
+    {
+        jsonFileName = argv[3];
+    }
+    if (numberOfRoundtrips <= 0 || numberOfWarmupRoundtrips < 0)
+    {
+        std::cerr << "usage: " << argv[0] << " [roundtrips] [warmupRoundtrips] [jsonFile]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
     // Create the runtime for registering with the RouDi daemon
     iox::runtime::PoshRuntime::getInstance(APP_NAME);
 
@@ -85,12 +137,12 @@ int main()
     }
     std::cout << "done" << std::endl;
 
-    std::vector<double> latencyInMicroSeconds;
-    const std::vector<uint32_t> payloadSizesInKB{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
-    for (const auto payloadSizeInKB : payloadSizesInKB)
+    std::vector<LatencyHistogram> histograms;
+    // payload size sweep from 64 B to 4 MB in powers of four
+    const std::vector<uint32_t> payloadSizesInBytes{64, 256, 1024, 4096, 16384, 65536, 262144, 1048576, 4194304};
+    for (const auto payloadSizeInBytes : payloadSizesInBytes)
     {
-        std::cout << "Measurement for " << payloadSizeInKB << " kB payload ... " << std::flush;
-        auto payloadSizeInBytes = payloadSizeInKB * 1024;
+        std::cout << "Measurement for " << payloadSizeToString(payloadSizeInBytes) << " payload ... " << std::flush;
         // Allocate a memory chunk for the sample to be sent and allow dynamic sample size, as we dynamically change the
         // payload
         auto sample = static_cast<PerfTopic*>(myPublisher.allocateChunk(payloadSizeInBytes, true));
@@ -102,8 +154,7 @@ int main()
         // Send the initial sample to start the round-trips
         myPublisher.sendChunk(sample);
 
-        auto latency = measureLatency(myPublisher, mySubscriber);
-        latencyInMicroSeconds.push_back(latency);
+        histograms.push_back(measureLatency(myPublisher, mySubscriber, numberOfRoundtrips, numberOfWarmupRoundtrips));
 
         // Wait for hardy to send the last response
         const void* receivedChunk;
@@ -138,14 +189,48 @@ int main()
 
     std::cout << std::endl;
     std::cout << "#### Measurement Result ####" << std::endl;
-    std::cout << NUMBER_OF_ROUNDTRIPS << " round trips for each payload." << std::endl;
+    std::cout << numberOfRoundtrips << " round trips for each payload, " << numberOfWarmupRoundtrips
+              << " warmup round trips." << std::endl;
     std::cout << std::endl;
-    std::cout << "| Payload Size [kB] | Average Latency [µs] |" << std::endl;
-    std::cout << "|------------------:|---------------------:|" << std::endl;
-    for (size_t i = 0; i < latencyInMicroSeconds.size(); ++i)
+    std::cout << "| Payload Size | p50 [ns] | p99 [ns] | p99.9 [ns] | max [ns] |" << std::endl;
+    std::cout << "|-------------:|---------:|---------:|-----------:|---------:|" << std::endl;
+    for (size_t i = 0; i < histograms.size(); ++i)
+    {
+        std::cout << "| " << std::setw(12) << payloadSizeToString(payloadSizesInBytes.at(i)) << " | " << std::setw(8)
+                  << histograms.at(i).percentile(50.) << " | " << std::setw(8) << histograms.at(i).percentile(99.)
+                  << " | " << std::setw(10) << histograms.at(i).percentile(99.9) << " | " << std::setw(8)
+                  << histograms.at(i).max() << " |" << std::endl;
+    }
+
+    // machine-readable result for charting latency across payload sizes per
+    // release; the same line written to a file serves as stored baseline for
+    // the iceperf-compare regression gate
+    std::stringstream json;
+    json << "{\"benchmark\":\"iceperf\",\"roundtrips\":" << numberOfRoundtrips
+         << ",\"warmup_roundtrips\":" << numberOfWarmupRoundtrips << ",\"results\":[";
+    for (size_t i = 0; i < histograms.size(); ++i)
     {
-        std::cout << "| " << std::setw(17) << payloadSizesInKB.at(i) << " | " << std::setw(20) << std::setprecision(2)
-                  << latencyInMicroSeconds.at(i) << " |" << std::endl;
+        json << (i == 0 ? "" : ",") << "{\"payload_bytes\":" << payloadSizesInBytes.at(i)
+             << ",\"latency_ns\":{\"p50\":" << histograms.at(i).percentile(50.)
+             << ",\"p99\":" << histograms.at(i).percentile(99.)
+             << ",\"p999\":" << histograms.at(i).percentile(99.9) << ",\"max\":" << histograms.at(i).max() << "}}";
+    }
+    json << "]}";
+
+    std::cout << std::endl;
+    std::cout << "#### JSON ####" << std::endl;
+    std::cout << json.str() << std::endl;
+
+    if (!jsonFileName.empty())
+    {
+        std::ofstream jsonFile(jsonFileName);
+        if (!jsonFile)
+        {
+            std::cerr << "Could not open " << jsonFileName << " for writing" << std::endl;
+            return EXIT_FAILURE;
+        }
+        jsonFile << json.str() << std::endl;
+        std::cout << "Result written to " << jsonFileName << std::endl;
     }
 
     std::cout << std::endl;
@@ -0,0 +1,275 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/popo/publisher.hpp"
+#include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "topic_data.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+constexpr uint32_t DEFAULT_NUMBER_OF_PUBLISHERS{2};
+constexpr uint32_t DEFAULT_NUMBER_OF_SUBSCRIBERS{4};
+constexpr uint32_t DEFAULT_PAYLOAD_SIZE_IN_BYTES{1024};
+constexpr uint32_t DEFAULT_DURATION_IN_SECONDS{10};
+constexpr uint32_t SUBSCRIBER_CACHE_SIZE{100};
+constexpr char APP_NAME[] = "/iceperf_throughput";
+
+std::atomic<bool> keepRunning{true};
+
+void publish(iox::popo::Publisher* publisher, const uint32_t payloadSizeInBytes, std::atomic<uint64_t>* sentCount)
+{
+    while (keepRunning.load(std::memory_order_relaxed))
+    {
+        auto sample = static_cast<PerfTopic*>(publisher->allocateChunk(payloadSizeInBytes, true));
+        sample->payloadSize = payloadSizeInBytes;
+        sample->run = true;
+        publisher->sendChunk(sample);
+        sentCount->fetch_add(1u, std::memory_order_relaxed);
+    }
+}
+
+void subscribe(std::vector<iox::popo::Subscriber*> subscribers,
+               std::atomic<uint64_t>* receivedCount,
+               std::atomic<uint64_t>* receivedBytes)
+{
+    while (keepRunning.load(std::memory_order_relaxed))
+    {
+        // fan-in: one subscriber thread drains the topics of all publishers
+        for (auto subscriber : subscribers)
+        {
+            const void* receivedChunk;
+            while (subscriber->getChunk(&receivedChunk))
+            {
+                auto receivedSample = static_cast<const PerfTopic*>(receivedChunk);
+                receivedBytes->fetch_add(receivedSample->payloadSize, std::memory_order_relaxed);
+                subscriber->releaseChunk(receivedChunk);
+                receivedCount->fetch_add(1u, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // topology and load can be overridden on the command line:
+    // iceperf-throughput [publishers] [subscribers] [payloadBytes] [durationSeconds] [jsonFile]
+    uint32_t numberOfPublishers{DEFAULT_NUMBER_OF_PUBLISHERS};
+    uint32_t numberOfSubscribers{DEFAULT_NUMBER_OF_SUBSCRIBERS};
+    uint32_t payloadSizeInBytes{DEFAULT_PAYLOAD_SIZE_IN_BYTES};
+    uint32_t durationInSeconds{DEFAULT_DURATION_IN_SECONDS};
+    std::string jsonFileName;
+    if (argc > 1)
+    {
+        numberOfPublishers = static_cast<uint32_t>(std::atoi(argv[1]));
+    }
+    if (argc > 2)
+    {
+        numberOfSubscribers = static_cast<uint32_t>(std::atoi(argv[2]));
+    }
+    if (argc > 3)
+    {
+        payloadSizeInBytes = static_cast<uint32_t>(std::atoi(argv[3]));
+    }
+    if (argc > 4)
+    {
+        durationInSeconds = static_cast<uint32_t>(std::atoi(argv[4]));
+    }
+    if (argc > 5)
+    {
+        jsonFileName = argv[5];
+    }
+    if (numberOfPublishers == 0u || numberOfSubscribers == 0u || payloadSizeInBytes < sizeof(PerfTopic)
+        || durationInSeconds == 0u)
+    {
+        std::cerr << "usage: " << argv[0] << " [publishers] [subscribers] [payloadBytes] [durationSeconds] [jsonFile]"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+    // every subscriber is connected to every publisher, the fan-out per sender port is bounded
+    if (numberOfSubscribers > iox::MAX_RECEIVERS_PER_SENDERPORT)
+    {
+        numberOfSubscribers = iox::MAX_RECEIVERS_PER_SENDERPORT;
+        std::cout << "Clamping subscribers to MAX_RECEIVERS_PER_SENDERPORT = " << numberOfSubscribers << std::endl;
+    }
+
+    // Create the runtime for registering with the RouDi daemon
+    iox::runtime::PoshRuntime::getInstance(APP_NAME);
+
+    // every publisher offers its own topic since a CaPro ID supports only one sender port;
+    // the fan-out to all subscribers happens in the receiver loop of each sender port
+    std::vector<std::unique_ptr<iox::popo::Publisher>> publishers;
+    for (uint32_t i = 0u; i < numberOfPublishers; ++i)
+    {
+        iox::capro::ServiceDescription service("Throughput", "Fanout", ("Data" + std::to_string(i)).c_str());
+        publishers.emplace_back(new iox::popo::Publisher(service));
+        publishers.back()->offer();
+    }
+
+    std::vector<std::vector<std::unique_ptr<iox::popo::Subscriber>>> subscribers;
+    for (uint32_t j = 0u; j < numberOfSubscribers; ++j)
+    {
+        subscribers.emplace_back();
+        for (uint32_t i = 0u; i < numberOfPublishers; ++i)
+        {
+            iox::capro::ServiceDescription service("Throughput", "Fanout", ("Data" + std::to_string(i)).c_str());
+            subscribers.back().emplace_back(new iox::popo::Subscriber(service));
+            subscribers.back().back()->subscribe(SUBSCRIBER_CACHE_SIZE);
+        }
+    }
+
+    std::cout << "Waiting for " << numberOfSubscribers << " x " << numberOfPublishers << " subscriptions ... "
+              << std::flush;
+    for (auto& subscriberGroup : subscribers)
+    {
+        for (auto& subscriber : subscriberGroup)
+        {
+            while (subscriber->getSubscriptionState() != iox::popo::SubscriptionState::SUBSCRIBED)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+    std::cout << "done" << std::endl;
+
+    std::vector<std::atomic<uint64_t>> sentCounts(numberOfPublishers);
+    std::vector<std::atomic<uint64_t>> receivedCounts(numberOfSubscribers);
+    std::vector<std::atomic<uint64_t>> receivedBytes(numberOfSubscribers);
+    for (auto& count : sentCounts)
+    {
+        count.store(0u);
+    }
+    for (auto& count : receivedCounts)
+    {
+        count.store(0u);
+    }
+    for (auto& bytes : receivedBytes)
+    {
+        bytes.store(0u);
+    }
+
+    std::cout << "Measuring for " << durationInSeconds << " s with " << numberOfPublishers << " publishers, "
+              << numberOfSubscribers << " subscribers and " << payloadSizeInBytes << " B payload ... " << std::flush;
+
+    std::vector<std::thread> threads;
+    for (uint32_t j = 0u; j < numberOfSubscribers; ++j)
+    {
+        std::vector<iox::popo::Subscriber*> subscriberGroup;
+        for (auto& subscriber : subscribers[j])
+        {
+            subscriberGroup.push_back(subscriber.get());
+        }
+        threads.emplace_back(subscribe, subscriberGroup, &receivedCounts[j], &receivedBytes[j]);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0u; i < numberOfPublishers; ++i)
+    {
+        threads.emplace_back(publish, publishers[i].get(), payloadSizeInBytes, &sentCounts[i]);
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(durationInSeconds));
+    keepRunning.store(false);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    auto finish = std::chrono::steady_clock::now();
+    auto elapsedSeconds = std::chrono::duration<double>(finish - start).count();
+
+    std::cout << "done" << std::endl;
+
+    for (auto& subscriberGroup : subscribers)
+    {
+        for (auto& subscriber : subscriberGroup)
+        {
+            subscriber->unsubscribe();
+        }
+    }
+    for (auto& publisher : publishers)
+    {
+        publisher->stopOffer();
+    }
+
+    uint64_t totalSent{0u};
+    uint64_t totalReceived{0u};
+    uint64_t totalReceivedBytes{0u};
+    for (const auto& count : sentCounts)
+    {
+        totalSent += count.load();
+    }
+    for (const auto& count : receivedCounts)
+    {
+        totalReceived += count.load();
+    }
+    for (const auto& bytes : receivedBytes)
+    {
+        totalReceivedBytes += bytes.load();
+    }
+
+    auto sentPerSecond = static_cast<double>(totalSent) / elapsedSeconds;
+    auto receivedPerSecond = static_cast<double>(totalReceived) / elapsedSeconds;
+    auto receivedGBPerSecond = static_cast<double>(totalReceivedBytes) / elapsedSeconds / 1e9;
+
+    std::cout << std::endl;
+    std::cout << "#### Throughput Result ####" << std::endl;
+    std::cout << numberOfPublishers << " publishers -> " << numberOfSubscribers
+              << " subscribers (fan-out per sender port: " << numberOfSubscribers << " of "
+              << iox::MAX_RECEIVERS_PER_SENDERPORT << "), " << payloadSizeInBytes << " B payload" << std::endl;
+    std::cout << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "sent     : " << sentPerSecond << " msgs/s" << std::endl;
+    std::cout << "received : " << receivedPerSecond << " msgs/s (" << receivedGBPerSecond << " GB/s)" << std::endl;
+
+    // machine-readable result for charting throughput across topologies per
+    // release; the same line written to a file serves as stored baseline for
+    // the iceperf-compare regression gate
+    std::stringstream json;
+    json << std::fixed << std::setprecision(2);
+    json << "{\"benchmark\":\"iceperf_throughput\",\"publishers\":" << numberOfPublishers
+         << ",\"subscribers\":" << numberOfSubscribers << ",\"payload_bytes\":" << payloadSizeInBytes
+         << ",\"duration_s\":" << elapsedSeconds << ",\"sent_msgs_per_s\":" << sentPerSecond
+         << ",\"received_msgs_per_s\":" << receivedPerSecond << ",\"received_gb_per_s\":" << receivedGBPerSecond << "}";
+
+    std::cout << std::endl;
+    std::cout << "#### JSON ####" << std::endl;
+    std::cout << json.str() << std::endl;
+
+    if (!jsonFileName.empty())
+    {
+        std::ofstream jsonFile(jsonFileName);
+        if (!jsonFile)
+        {
+            std::cerr << "Could not open " << jsonFileName << " for writing" << std::endl;
+            return EXIT_FAILURE;
+        }
+        jsonFile << json.str() << std::endl;
+        std::cout << "Result written to " << jsonFileName << std::endl;
+    }
+
+    std::cout << std::endl;
+    std::cout << "Finished!" << std::endl;
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,111 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+/// @brief HDR style latency histogram with logarithmic buckets.
+///
+/// Each power of two magnitude is split into 32 linear sub buckets which gives
+/// a relative value resolution of ~3% over the full uint64_t range - good
+/// enough to distinguish p50 from p99.9 while the whole histogram is a fixed
+/// size array. Recording a value is a couple of bit operations and one counter
+/// increment, so it can be done per round-trip without disturbing the
+/// measurement.
+class LatencyHistogram
+{
+  public:
+    void record(const uint64_t latencyInNanoSeconds)
+    {
+        m_counts[bucketIndex(latencyInNanoSeconds)]++;
+        m_totalCount++;
+        if (latencyInNanoSeconds > m_max)
+        {
+            m_max = latencyInNanoSeconds;
+        }
+    }
+
+    /// @brief value below which the given percentage of the recorded values
+    ///         lie, e.g. percentile(99.9) for p99.9
+    uint64_t percentile(const double percentage) const
+    {
+        if (m_totalCount == 0u)
+        {
+            return 0u;
+        }
+
+        uint64_t targetCount = static_cast<uint64_t>((percentage / 100.) * static_cast<double>(m_totalCount) + 0.5);
+        if (targetCount > m_totalCount)
+        {
+            targetCount = m_totalCount;
+        }
+
+        uint64_t cumulativeCount{0u};
+        for (uint32_t index = 0u; index < NumberOfBuckets; ++index)
+        {
+            cumulativeCount += m_counts[index];
+            if (cumulativeCount >= targetCount)
+            {
+                auto upperEdge = bucketUpperEdge(index);
+                return (upperEdge < m_max) ? upperEdge : m_max;
+            }
+        }
+        return m_max;
+    }
+
+    uint64_t max() const
+    {
+        return m_max;
+    }
+
+    uint64_t count() const
+    {
+        return m_totalCount;
+    }
+
+  private:
+    static constexpr uint32_t SubBucketBits{5u};
+    static constexpr uint32_t SubBucketCount{1u << SubBucketBits};
+    static constexpr uint32_t NumberOfMagnitudes{64u - SubBucketBits};
+    static constexpr uint32_t NumberOfBuckets{(NumberOfMagnitudes + 1u) * SubBucketCount};
+
+    static uint32_t bucketIndex(const uint64_t value)
+    {
+        if (value < SubBucketCount)
+        {
+            // small values are stored exactly in the first linear bucket range
+            return static_cast<uint32_t>(value);
+        }
+        uint32_t magnitude = 63u - static_cast<uint32_t>(__builtin_clzll(value));
+        uint32_t subBucket = static_cast<uint32_t>(value >> (magnitude - SubBucketBits)) & (SubBucketCount - 1u);
+        return (magnitude - SubBucketBits + 1u) * SubBucketCount + subBucket;
+    }
+
+    static uint64_t bucketUpperEdge(const uint32_t index)
+    {
+        uint32_t magnitudeIndex = index / SubBucketCount;
+        uint64_t subBucket = index % SubBucketCount;
+        if (magnitudeIndex == 0u)
+        {
+            return subBucket;
+        }
+        uint32_t shift = magnitudeIndex - 1u;
+        return ((SubBucketCount + subBucket + 1u) << shift) - 1u;
+    }
+
+    uint64_t m_counts[NumberOfBuckets]{};
+    uint64_t m_totalCount{0u};
+    uint64_t m_max{0u};
+};
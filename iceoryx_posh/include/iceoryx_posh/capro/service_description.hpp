@@ -105,6 +105,20 @@ class ServiceDescription
     /// @todo operator Serialization() replaces getServiceString()
     operator cxx::Serialization() const;
 
+    /// @brief Encodes all members into a fixed layout POD image which is hex
+    /// encoded into a single string. In contrast to the cxx::Serialization
+    /// format this needs one allocation, no per member parsing and contains no
+    /// separator characters, so it passes through the message queue untouched
+    /// @return hex encoded fixed layout image of this service description
+    std::string toWireFormat() const noexcept;
+
+    /// @brief Counterpart of toWireFormat()
+    /// @param[in] f_wire hex encoded fixed layout image
+    /// @param[out] f_serviceDescription filled with the decoded members on success
+    /// @return true on success, false if the image has a wrong length or
+    /// contains non hex characters
+    static bool fromWireFormat(const std::string& f_wire, ServiceDescription& f_serviceDescription) noexcept;
+
     /// @brief Generate a servicestring filled with the member variables for
     /// service communication
     /// @return stringstream filled with member vars ()
@@ -136,7 +150,16 @@ class ServiceDescription
     ClassHash getClassHash() const noexcept;
     ///@}
 
+    /// @brief Returns the 64-Bit hash over the three string IDs which is
+    /// computed once at construction. Descriptions with different hashes are
+    /// guaranteed to be unequal, so matching loops can reject most candidates
+    /// without walking the strings
+    uint64_t getHash() const noexcept;
+
   private:
+    /// @brief recompute m_hash from the string IDs; must be called whenever one
+    /// of the string members is changed
+    void updateHash() noexcept;
     /// @brief 16-Bit service ID
     uint16_t m_serviceID;
     /// @brief 16-Bit event ID
@@ -156,6 +179,10 @@ class ServiceDescription
 
     /// @brief How far this service should be propagated
     Scope m_scope{Scope::WORLDWIDE};
+
+    /// @brief 64-Bit hash over the three string IDs, cached at construction so
+    /// the comparison operators do not have to walk the strings on a mismatch
+    uint64_t m_hash{0u};
 };
 
 /// @brief Compare two service descriptions via their values in member
@@ -0,0 +1,110 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace iox
+{
+namespace gateway
+{
+/// a frame fits into one ethernet MTU with some headroom for IP and UDP headers
+constexpr uint32_t FRAME_CAPACITY = 1400u;
+
+/// header at the start of every network frame
+struct FrameHeader
+{
+    static constexpr uint32_t MAGIC = 0x49435846u; // "ICXF"
+
+    uint32_t m_magic{MAGIC};
+    uint16_t m_sampleCount{0u};
+    uint16_t m_frameBytes{sizeof(FrameHeader)};
+};
+
+/// header in front of every sample inside a frame, followed by the payload
+struct FrameSampleHeader
+{
+    /// hash of the service description the sample belongs to, used for channel
+    /// demultiplexing on the receiving node
+    uint64_t m_serviceHash{0u};
+    uint32_t m_payloadSize{0u};
+    uint32_t m_sequenceNumber{0u};
+};
+
+/// @brief Coalesces small samples into one MTU sized frame so the network
+///         side pays one syscall per frame instead of one per sample. Works on
+///         a caller provided buffer, no allocation
+/// @concurrent not thread safe
+class FrameBuilder
+{
+  public:
+    /// @brief Starts a new frame in the given buffer
+    /// @param[in] f_buffer buffer the frame is built in
+    /// @param[in] f_capacity size of the buffer in bytes, at least sizeof(FrameHeader)
+    FrameBuilder(uint8_t* const f_buffer, const uint32_t f_capacity) noexcept;
+
+    /// @brief Appends one sample to the frame
+    /// @param[in] f_serviceHash hash of the service description of the sample
+    /// @param[in] f_sequenceNumber sequence number of the sample
+    /// @param[in] f_payload payload bytes
+    /// @param[in] f_payloadSize number of payload bytes
+    /// @return true when the sample fits into the remaining frame space
+    bool addSample(const uint64_t f_serviceHash,
+                   const uint32_t f_sequenceNumber,
+                   const void* const f_payload,
+                   const uint32_t f_payloadSize) noexcept;
+
+    /// @brief Number of samples currently in the frame
+    uint32_t sampleCount() const noexcept;
+
+    /// @brief Size of the finished frame in bytes
+    uint32_t frameBytes() const noexcept;
+
+  private:
+    uint8_t* m_buffer;
+    uint32_t m_capacity;
+    FrameHeader* m_header;
+};
+
+/// @brief Iterates the samples of a received frame
+/// @concurrent not thread safe
+class FrameParser
+{
+  public:
+    /// @brief Parses the frame in the given buffer
+    /// @param[in] f_buffer received frame
+    /// @param[in] f_size number of received bytes
+    FrameParser(const uint8_t* const f_buffer, const uint32_t f_size) noexcept;
+
+    /// @brief Returns false when the buffer is no frame or is truncated
+    bool isValid() const noexcept;
+
+    /// @brief Fetches the next sample of the frame
+    /// @param[out] f_sampleHeader header of the sample
+    /// @param[out] f_payload pointer to the payload bytes inside the frame
+    /// @return true when a sample was fetched, false when the frame is exhausted
+    bool nextSample(FrameSampleHeader& f_sampleHeader, const uint8_t*& f_payload) noexcept;
+
+  private:
+    const uint8_t* m_buffer;
+    uint32_t m_size;
+    uint32_t m_readOffset{sizeof(FrameHeader)};
+    uint32_t m_remainingSamples{0u};
+    bool m_isValid{false};
+};
+
+} // namespace gateway
+} // namespace iox
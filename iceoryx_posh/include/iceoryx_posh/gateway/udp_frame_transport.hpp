@@ -0,0 +1,83 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace iox
+{
+namespace gateway
+{
+/// @brief Non-blocking UDP endpoint that moves batches of frames with one
+///         syscall per batch. On Linux sendmmsg and recvmmsg are used, on
+///         platforms without them the batch degrades to one syscall per frame
+/// @concurrent not thread safe
+class UdpFrameTransport
+{
+  public:
+    /// maximum number of frames moved with one send or receive call
+    static constexpr uint32_t MAX_BATCH_SIZE = 32u;
+
+    /// @brief Opens the socket, binds it to the local port and stores the
+    ///         remote endpoint all sent frames go to
+    /// @param[in] f_localPort UDP port to bind to, 0 lets the kernel pick one
+    /// @param[in] f_remoteAddress IPv4 address of the peer node
+    /// @param[in] f_remotePort UDP port of the peer node
+    UdpFrameTransport(const uint16_t f_localPort,
+                      const std::string& f_remoteAddress,
+                      const uint16_t f_remotePort) noexcept;
+    ~UdpFrameTransport() noexcept;
+
+    UdpFrameTransport(const UdpFrameTransport&) = delete;
+    UdpFrameTransport(UdpFrameTransport&&) = delete;
+    UdpFrameTransport& operator=(const UdpFrameTransport&) = delete;
+    UdpFrameTransport& operator=(UdpFrameTransport&&) = delete;
+
+    /// @brief Returns false when the socket could not be opened or bound
+    bool isInitialized() const noexcept;
+
+    /// @brief The local port the socket is bound to, useful when 0 was requested
+    uint16_t localPort() const noexcept;
+
+    /// @brief Sends a batch of frames to the remote endpoint
+    /// @param[in] f_frames array of frame buffers
+    /// @param[in] f_frameSizes size of each frame in bytes
+    /// @param[in] f_frameCount number of frames, at most MAX_BATCH_SIZE
+    /// @return number of sent frames
+    uint32_t sendFrames(const uint8_t* const* f_frames,
+                        const uint32_t* f_frameSizes,
+                        const uint32_t f_frameCount) noexcept;
+
+    /// @brief Receives up to a batch of frames without blocking
+    /// @param[in] f_frames array of receive buffers
+    /// @param[in] f_frameCapacities capacity of each receive buffer in bytes
+    /// @param[out] f_frameSizes number of received bytes per frame
+    /// @param[in] f_frameCount number of receive buffers, at most MAX_BATCH_SIZE
+    /// @return number of received frames, 0 when nothing is pending
+    uint32_t receiveFrames(uint8_t* const* f_frames,
+                           const uint32_t* f_frameCapacities,
+                           uint32_t* f_frameSizes,
+                           const uint32_t f_frameCount) noexcept;
+
+  private:
+    int m_socket{-1};
+    uint16_t m_localPort{0u};
+    uint32_t m_remoteAddress{0u};
+    uint16_t m_remotePort{0u};
+};
+
+} // namespace gateway
+} // namespace iox
@@ -0,0 +1,99 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/gateway/sample_frame.hpp"
+#include "iceoryx_posh/gateway/udp_frame_transport.hpp"
+#include "iceoryx_posh/popo/gateway_generic.hpp"
+
+#include <functional>
+
+namespace iox
+{
+namespace gateway
+{
+/// @brief Network gateway that bridges topics between nodes over UDP. On the
+///         sending node small samples are coalesced into MTU sized frames and
+///         a batch of frames leaves with one syscall; on the receiving node a
+///         batch of frames is fetched with one syscall and every sample is
+///         reassembled into a chunk from the local mempools and delivered
+///         through the sender port of its topic. Samples are demultiplexed by
+///         the hash of their service description
+/// @concurrent not thread safe, one gateway belongs to one forwarding thread
+class UdpGateway : public popo::GatewayGeneric
+{
+  public:
+    /// resolves the hash of a service description to the local sender port of
+    /// that topic; returns nullptr for unknown hashes
+    using PortLookup = std::function<popo::SenderPort*(const uint64_t)>;
+
+    /// @brief Constructor for creating the gateway and its UDP endpoint
+    /// @param[in] f_interface Type of interface
+    /// @param[in] f_localPort UDP port to bind to, 0 lets the kernel pick one
+    /// @param[in] f_remoteAddress IPv4 address of the peer node
+    /// @param[in] f_remotePort UDP port of the peer node
+    UdpGateway(const Interfaces f_interface,
+               const uint16_t f_localPort,
+               const std::string& f_remoteAddress,
+               const uint16_t f_remotePort) noexcept;
+
+    /// @brief Returns false when the UDP socket could not be opened or bound
+    bool isInitialized() const noexcept;
+
+    /// @brief The local UDP port the gateway is bound to
+    uint16_t localPort() const noexcept;
+
+    /// @brief Drains the pending chunks of a receiver port, coalesces them
+    ///         into frames and sends the frames to the peer node in one batch.
+    ///         Samples larger than one frame are dropped and counted
+    /// @param[in] f_source receiver port of the topic to forward
+    /// @param[in] f_serviceHash hash of the service description of the topic
+    /// @param[in] f_maxSamples maximum number of samples to forward in this pass
+    /// @return number of forwarded samples
+    uint32_t forwardOutbound(popo::ReceiverPort& f_source,
+                             const uint64_t f_serviceHash,
+                             const uint32_t f_maxSamples) noexcept;
+
+    /// @brief Fetches a batch of frames from the socket and delivers every
+    ///         contained sample through the sender port of its topic
+    /// @param[in] f_portLookup resolves service hashes to local sender ports
+    /// @return number of delivered samples
+    uint32_t forwardInbound(const PortLookup& f_portLookup) noexcept;
+
+    /// @brief Samples dropped because they exceed one frame or their topic is
+    ///         unknown on the receiving node
+    uint64_t droppedSampleCount() const noexcept;
+
+    /// @brief Delivers every sample of one received frame, used by
+    ///         forwardInbound and standalone testable
+    /// @param[in] f_frame received frame
+    /// @param[in] f_frameSize number of received bytes
+    /// @param[in] f_portLookup resolves service hashes to local sender ports
+    /// @return number of delivered samples
+    static uint32_t unpackFrame(const uint8_t* const f_frame,
+                                const uint32_t f_frameSize,
+                                const PortLookup& f_portLookup) noexcept;
+
+  protected:
+    /// needed for unit testing, skips the interface port registration at RouDi
+    UdpGateway(const uint16_t f_localPort, const std::string& f_remoteAddress, const uint16_t f_remotePort) noexcept;
+
+  private:
+    UdpFrameTransport m_transport;
+    uint64_t m_droppedSampleCount{0u};
+};
+
+} // namespace gateway
+} // namespace iox
@@ -15,6 +15,7 @@
 
 
 #include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_utils/cxx/inplace_function.hpp"
 #include "iceoryx_utils/cxx/string.hpp"
 #include "iceoryx_utils/cxx/vector.hpp"
 #include "iceoryx_utils/internal/units/duration.hpp"
@@ -43,14 +44,33 @@ using namespace units::duration_literals;
 // Timeout
 constexpr units::Duration PROCESS_WAITING_FOR_ROUDI_TIMEOUT = 30_s;
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
-constexpr units::Duration PROCESS_KEEP_ALIVE_INTERVAL = 3 * DISCOVERY_INTERVAL;         // > DISCOVERY_INTERVAL
-constexpr units::Duration PROCESS_KEEP_ALIVE_TIMEOUT = 5 * PROCESS_KEEP_ALIVE_INTERVAL; // > PROCESS_KEEP_ALIVE_INTERVAL
+constexpr units::Duration PROCESS_KEEP_ALIVE_INTERVAL = 3 * DISCOVERY_INTERVAL; // > DISCOVERY_INTERVAL
+// number of missed keep alive intervals after which a process counts as dead
+constexpr uint32_t PROCESS_KEEP_ALIVE_TIMEOUT_FACTOR = 5u;
+constexpr units::Duration PROCESS_KEEP_ALIVE_TIMEOUT =
+    PROCESS_KEEP_ALIVE_TIMEOUT_FACTOR * PROCESS_KEEP_ALIVE_INTERVAL; // > PROCESS_KEEP_ALIVE_INTERVAL
+// the keep alive interval is negotiable per process at registration; RouDi
+// clamps the requested interval into these bounds
+constexpr units::Duration PROCESS_KEEP_ALIVE_INTERVAL_MIN = DISCOVERY_INTERVAL;
+constexpr units::Duration PROCESS_KEEP_ALIVE_INTERVAL_MAX = 100 * PROCESS_KEEP_ALIVE_INTERVAL;
+// the sender and receiver ports of a crashed monitored process are retained for
+// this duration so that a restarting process with the same name can reclaim them
+constexpr units::Duration PROCESS_WARM_RESTART_RETENTION = 2_s;
+// a process registered with ProcessPriority::LOW is only checked for liveness
+// with this multiple of its keep alive interval; its timeout scales with it
+constexpr uint32_t PROCESS_LOW_PRIORITY_MONITORING_RELAXATION = 4u;
 
 // Communication Resources
 constexpr uint32_t MAX_PORT_NUMBER = 2048;
 constexpr uint32_t MAX_INTERFACE_NUMBER = 16;
 constexpr uint32_t MAX_RECEIVERS_PER_SENDERPORT = 256;
+constexpr uint32_t MAX_RECEIVERS_PER_WAITSET = 64;
+/// default allocation window of a sender port, i.e. how many chunks it may hold
+/// unsent at the same time; configurable per port at getMiddlewareSender time
+/// up to MAX_SAMPLE_ALLOCATE_PER_SENDER_CAPACITY, which sizes the allocated
+/// chunk container in shared memory
 constexpr uint32_t MAX_SAMPLE_ALLOCATE_PER_SENDER = 16;
+constexpr uint32_t MAX_SAMPLE_ALLOCATE_PER_SENDER_CAPACITY = 64;
 constexpr uint32_t MAX_RECEIVER_QUEUE_SIZE = 256;
 constexpr uint32_t MAX_INTERFACE_CAPRO_FIFO_SIZE = MAX_PORT_NUMBER;
 constexpr uint32_t MAX_APPLICATION_CAPRO_FIFO_SIZE = 128;
@@ -58,12 +78,21 @@ constexpr uint32_t MAX_APPLICATION_CAPRO_FIFO_SIZE = 128;
 // Memory
 constexpr uint32_t MAX_NUMBER_OF_MEMPOOLS = 32;
 constexpr uint32_t MAX_SHM_SEGMENTS = 100;
+/// number of power of two buckets in the per sender port histogram of
+/// requested payload sizes, bucket i counts requests of at most 2^i bytes
+constexpr uint32_t CHUNK_SIZE_HISTOGRAM_BUCKETS = 16;
+/// size of the per-port memory accounting table of a memory manager; ports
+/// beyond this number still get their chunks but are not attributed
+constexpr uint32_t MAX_ACCOUNTED_PORTS_PER_SEGMENT = 256;
 
 // Message Queue
 constexpr long ROUDI_MAX_MESSAGES = 5;
 constexpr long ROUDI_MESSAGE_SIZE = 512;
 constexpr long APP_MAX_MESSAGES = 5;
 constexpr long APP_MESSAGE_SIZE = 512;
+/// Number of entries per direction of the shared memory command channel which
+/// replaces the message queue for runtime requests after registration
+constexpr uint32_t COMMAND_CHANNEL_CAPACITY = 16;
 
 // Processes
 constexpr uint32_t MAX_PROCESS_NUMBER = 300;
@@ -72,7 +101,7 @@ constexpr uint32_t MAX_PROCESS_NUMBER = 300;
 /// instances)
 constexpr uint32_t MAX_NUMBER_OF_INSTANCES = 50;
 /// Maximum number of callbacks that can be registered with PoshRuntime::startFindService
-constexpr uint32_t MAX_START_FIND_SERVICE_CALLBACKS = 50;
+constexpr uint32_t MAX_START_FIND_SERVICE_CALLBACKS = 512;
 
 // Runnables
 constexpr uint32_t MAX_RUNNABLE_NUMBER = 1000;
@@ -116,7 +145,8 @@ using InstanceContainer = iox::cxx::vector<IdString, MAX_NUMBER_OF_INSTANCES>;
 // Return type of StartFindService() method
 using FindServiceHandle = uint32_t;
 // Signature for service discovery callback function
-using FindServiceHandler = std::function<void(InstanceContainer&, FindServiceHandle)>;
+// the handler is stored inplace, no heap allocation on assignment
+using FindServiceHandler = cxx::inplace_function<void(InstanceContainer&, FindServiceHandle)>;
 } // namespace runtime
 
 } // namespace iox
@@ -0,0 +1,101 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/cxx/helplets.hpp"
+#include "iceoryx_utils/cxx/optional.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/mutex.hpp"
+#include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
+
+#include <cstdint>
+#include <mutex>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Binary buddy allocator over an array of fixed size minimal blocks. Requests
+/// are rounded up to the next power of two of minimal blocks, larger free blocks are
+/// split on demand and freed blocks are merged with their buddy again. In contrast to
+/// the fixed size mempools the internal fragmentation is bounded by a factor of two
+/// for arbitrary request sizes, which makes it suitable for topics with dynamic
+/// payload sizes. The block metadata and the free-lists are kept separated from the
+/// payload memory, pop and push are serialized with a mutex like in the LockedLoFFLi.
+class BuddyAllocator
+{
+  public:
+    /// supports up to 2^21 minimal blocks, i.e. 64 GByte with a 32 kByte minimal block
+    static constexpr uint32_t MAX_ORDER_COUNT{22u};
+    /// marks a minimal block which is not the first block of an allocation
+    static constexpr uint8_t INTERIOR_BLOCK{0xFFu};
+
+    BuddyAllocator() = default;
+
+    /// Initializes the buddy allocator
+    /// @param [in] f_memory pointer to a memory with the size calculated by requiredMemorySize()
+    /// @param [in] f_numberOfMinBlocks number of minimal blocks to manage; does not have to
+    ///             be a power of two, the initial free-lists are then seeded with the
+    ///             largest aligned blocks that fit
+    void init(cxx::not_null<void*> f_memory, const uint32_t f_numberOfMinBlocks);
+
+    /// Allocates a block of at least f_numberOfMinBlocks minimal blocks
+    /// @param [out] f_index index of the first minimal block of the allocation
+    /// @param [in] f_numberOfMinBlocks requested size in minimal blocks
+    /// @return the allocated size in minimal blocks (the next power of two), 0 if no
+    ///         fitting free block is available
+    uint32_t pop(const uint32_t f_numberOfMinBlocks, uint32_t& f_index);
+
+    /// Frees a previously popped block and merges it with free buddies
+    /// @param [in] f_index index returned by pop()
+    /// @return the freed size in minimal blocks, 0 if the index does not belong to an
+    ///         allocated block (e.g. double free or interior index)
+    uint32_t push(const uint32_t f_index);
+
+    /// Calculates the required metadata memory size
+    /// @param [in] f_numberOfMinBlocks number of minimal blocks to manage
+    /// @return the required memory size for the block metadata
+    static constexpr uint64_t requiredMemorySize(const uint32_t f_numberOfMinBlocks)
+    {
+        return static_cast<uint64_t>(f_numberOfMinBlocks) * sizeof(Block);
+    }
+
+  private:
+    /// metadata per minimal block; only valid for the first minimal block of a free or
+    /// allocated buddy block, interior blocks are marked with INTERIOR_BLOCK
+    struct Block
+    {
+        uint32_t m_next{0};
+        uint32_t m_prev{0};
+        uint8_t m_order{INTERIOR_BLOCK};
+        bool m_free{false};
+    };
+
+    void insert(const uint32_t f_index, const uint8_t f_order);
+    void remove(const uint32_t f_index, const uint8_t f_order);
+
+  private:
+    uint32_t m_numberOfMinBlocks{0};
+    uint32_t m_invalidIndex{0};
+    uint8_t m_orderCount{0};
+    uint32_t m_freeListHeads[MAX_ORDER_COUNT];
+
+    relative_ptr<Block> m_blocks;
+
+    using mutex_t = posix::mutex;
+    mutable cxx::optional<mutex_t> m_accessMutex = posix::mutex::CreateMutex(false);
+};
+
+} // namespace mepoo
+} // namespace iox
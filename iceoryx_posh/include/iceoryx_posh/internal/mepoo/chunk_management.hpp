@@ -28,6 +28,38 @@ namespace mepoo
 class MemPool;
 struct ChunkHeader;
 
+/// @brief per consumer chunk quota over a shared segment: the reservation path
+/// charges it with relaxed atomics and denies the reservation when the limit is
+/// reached, so one misbehaving consumer cannot drain the pools of a segment
+/// shared with others. Lives next to the consumer bookkeeping in the shared
+/// memory (e.g. in the port data); a limit of 0 disables the quota
+struct ChunkQuota
+{
+    /// maximum number of chunks the consumer may pin at a time, 0 disables
+    uint32_t m_limit{0u};
+    /// charged on acquisition, handed back when the chunk returns to the pool;
+    /// relaxed, a concurrent reservation burst may overshoot the limit by the
+    /// number of concurrent reservers
+    std::atomic<uint32_t> m_usedChunks{0u};
+    /// reservations denied at the quota, for the introspection
+    std::atomic<uint64_t> m_deniedRequests{0u};
+};
+
+/// @brief outstanding chunk accounting of one port over a memory manager: every
+/// acquisition through the port is counted here and the release hands the count
+/// back, so the memory of a segment can be attributed live to the topics which
+/// hold it. Entries live in the accounting table of the memory manager and are
+/// claimed once per port
+struct PortChunkAccounting
+{
+    /// unique id of the port the entry was claimed for, 0 marks a free entry
+    std::atomic<uint64_t> m_portID{0u};
+    /// chunks currently held which were acquired through the port; relaxed
+    std::atomic<uint32_t> m_outstandingChunks{0u};
+    /// total number of acquisitions through the port since it was created
+    std::atomic<uint64_t> m_totalAllocations{0u};
+};
+
 struct alignas(32) ChunkManagement
 {
     using base_t = ChunkHeader;
@@ -48,6 +80,13 @@ struct alignas(32) ChunkManagement
     /// @todo optimization: check if this can be replaced by an offset relative to the this pointer
     iox::relative_ptr<MemPool> m_mempool;
     iox::relative_ptr<MemPool> m_chunkManagementPool;
+    /// quota the chunk was charged against, handed back on release; nullptr
+    /// when the chunk was acquired without a quota
+    iox::relative_ptr<ChunkQuota> m_quota;
+    /// accounting entry of the port the chunk was acquired through, so the
+    /// release decrements the outstanding count of the right port; nullptr
+    /// when the chunk was acquired without accounting
+    iox::relative_ptr<PortChunkAccounting> m_accounting;
 };
 } // namespace mepoo
 } // namespace iox
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "iceoryx_posh/internal/mepoo/buddy_allocator.hpp"
 #include "iceoryx_utils/cxx/helplets.hpp"
 #include "iceoryx_utils/internal/concurrent/loffli.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
@@ -29,17 +30,38 @@ namespace mepoo
 {
 struct MemPoolInfo
 {
-    MemPoolInfo(uint32_t f_usedChunks, uint32_t f_minFreeChunks, uint32_t f_numChunks, uint32_t f_chunkSize)
+    MemPoolInfo(uint32_t f_usedChunks,
+                uint32_t f_minFreeChunks,
+                uint32_t f_numChunks,
+                uint32_t f_chunkSize,
+                uint64_t f_failedAllocations = 0u,
+                uint64_t f_freeListPopRetries = 0u,
+                uint32_t f_highWatermark = 0u,
+                uint64_t f_freeListPushRetries = 0u)
         : m_usedChunks(f_usedChunks)
         , m_minFreeChunks(f_minFreeChunks)
         , m_numChunks(f_numChunks)
         , m_chunkSize(f_chunkSize)
+        , m_failedAllocations(f_failedAllocations)
+        , m_freeListPopRetries(f_freeListPopRetries)
+        , m_highWatermark(f_highWatermark)
+        , m_freeListPushRetries(f_freeListPushRetries)
     {
     }
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
+    /// number of getChunk calls which could not be served since the pool was exhausted
+    uint64_t m_failedAllocations{0};
+    /// CAS retries in the lock-free free-list, an indicator for allocation contention
+    uint64_t m_freeListPopRetries{0};
+    /// number of used chunks at which an exhaustion early warning is emitted via the
+    /// mempool introspection, 0 if no high watermark was configured for the pool
+    uint32_t m_highWatermark{0};
+    /// CAS retries when freeing chunks back into the free-list, the counterpart of
+    /// m_freeListPopRetries for the release side
+    uint64_t m_freeListPushRetries{0};
 };
 
 class MemPool
@@ -48,17 +70,49 @@ class MemPool
     using freeList_t = concurrent::LoFFLi;
     static constexpr uint64_t MEMORY_ALIGNMENT = posix::Allocator::MEMORY_ALIGNMENT;
 
+    /// @param [in] f_maxNumberOfChunks when larger than f_numberOfChunks, payload and
+    /// free-list memory for f_maxNumberOfChunks is reserved up front and the pool can
+    /// be grown at runtime via addChunks() without remapping any memory
     MemPool(const cxx::greater_or_equal<uint32_t, MEMORY_ALIGNMENT> f_chunkSize,
             const cxx::greater_or_equal<uint32_t, 1> f_numberOfChunks,
             posix::Allocator* f_managementAllocator,
+            posix::Allocator* f_payloadAllocator,
+            const uint32_t f_maxNumberOfChunks = 0u);
+
+    /// tag type to construct a buddy mempool for topics with dynamic payload sizes
+    struct BuddyPool_t
+    {
+    };
+    static constexpr BuddyPool_t BuddyPool{};
+
+    /// Constructs a buddy mempool; instead of handing out fixed size chunks from a
+    /// free-list, chunks of variable size are carved out of f_numberOfMinBlocks
+    /// minimal blocks via a buddy allocator, which bounds the internal fragmentation
+    /// for arbitrary request sizes by a factor of two
+    /// @param [in] f_minBlockSize size of a minimal block, must be a multiple of 32
+    /// @param [in] f_numberOfMinBlocks number of minimal blocks of the pool
+    MemPool(const BuddyPool_t,
+            const cxx::greater_or_equal<uint32_t, MEMORY_ALIGNMENT> f_minBlockSize,
+            const cxx::greater_or_equal<uint32_t, 1> f_numberOfMinBlocks,
+            posix::Allocator* f_managementAllocator,
             posix::Allocator* f_payloadAllocator);
 
     MemPool(const MemPool&) = delete;
     MemPool(MemPool&&) = delete;
     MemPool& operator=(const MemPool&) = delete;
     MemPool& operator=(MemPool&&) = delete;
+    ~MemPool();
 
     void* getChunk();
+
+    /// Acquires a chunk of at least f_size bytes from a buddy mempool; the effective
+    /// chunk size is f_size rounded up to the next power of two of minimal blocks
+    /// @param [in] f_size requested chunk size in bytes
+    /// @return pointer to the chunk, nullptr if no fitting free block is available
+    void* getChunk(const uint32_t f_size);
+
+    bool isBuddyPool() const;
+
     uint32_t getChunkSize() const;
     uint32_t getChunkCount() const;
     uint32_t getUsedChunks() const;
@@ -67,7 +121,68 @@ class MemPool
 
     void freeChunk(const void* chunk);
 
+    /// Grows the pool by feeding chunks from the pre-reserved extension capacity into
+    /// the free-list, without restarting RouDi or remapping segments
+    /// @param [in] f_numberOfChunks number of additional chunks to activate
+    /// @return true on success, false if the reserved capacity would be exceeded
+    bool addChunks(const uint32_t f_numberOfChunks);
+
+    uint32_t getMaxChunkCount() const;
+
+    /// Configures the high watermark for the exhaustion early warning; when the
+    /// number of used chunks reaches the given percentage of the chunk count, the
+    /// mempool introspection emits an event on its event topic
+    /// @param [in] f_percent percentage of the chunk count, 0 disables the warning
+    void setHighWatermarkPercent(const uint32_t f_percent);
+
+    /// @return number of used chunks at which the exhaustion early warning triggers,
+    ///         0 if no high watermark was configured; tracks the current chunk count,
+    ///         i.e. growing the pool via addChunks() also raises the watermark
+    uint32_t getHighWatermark() const;
+
+    /// Applies the memory hints configured for this pool (MePooConfig::HINT_ constants)
+    /// to the address range of the pool, so pools with different access patterns can
+    /// be tuned individually instead of mapping the whole segment uniformly. Hints not
+    /// supported by the platform are reported as a warning and skipped.
+    /// @param [in] f_hints bitmask of MePooConfig::HINT_ constants, 0 is a no-op
+    void applyMemoryHints(const uint32_t f_hints);
+
+    /// Enables a small thread-local magazine in front of the free-list. getChunk() and
+    /// freeChunk() then mostly operate on the magazine and only fall back to the
+    /// lock-free free-list in batches, which avoids the CAS loop on the hot path when
+    /// many threads allocate from the same pool.
+    /// @param [in] f_enable true enables the cache for all threads using this pool
+    /// @note chunks parked in a magazine are accounted as used chunks, i.e. getUsedChunks()
+    ///       can over-report by up to THREAD_CACHE_CAPACITY per allocating thread
+    void enableThreadLocalCache(const bool f_enable);
+
   private:
+    struct ThreadCache
+    {
+        static constexpr uint32_t CAPACITY{8u};
+        static constexpr uint32_t REFILL_BATCH{4u};
+        uint32_t m_indices[CAPACITY];
+        uint32_t m_size{0u};
+    };
+
+    struct ThreadCacheRegistry
+    {
+        struct Entry
+        {
+            MemPool* m_pool{nullptr};
+            ThreadCache m_cache;
+        };
+        /// one entry per mempool a thread allocates from; covers MAX_NUMBER_OF_MEMPOOLS
+        static constexpr uint32_t CAPACITY{32u};
+        Entry m_entries[CAPACITY];
+        ~ThreadCacheRegistry();
+    };
+
+    static ThreadCacheRegistry& threadCacheRegistry();
+    ThreadCache* getThreadCache();
+    bool refillThreadCache(ThreadCache& f_cache);
+    void flushThreadCache(ThreadCache& f_cache, const uint32_t f_targetSize);
+
     void adjustMinFree();
     bool isMultipleOf32(const uint32_t value) const;
 
@@ -77,13 +192,21 @@ class MemPool
     /// needs to be 32 bit since loffli supports only 32 bit numbers
     /// (cas is only 64 bit and we need the other 32 bit for the aba counter)
     uint32_t m_numberOfChunks{0};
+    uint32_t m_maxNumberOfChunks{0};
+    uint32_t m_highWatermarkPercent{0};
 
     /// @todo: put this into one struct and in a separate class in concurrent.
     std::atomic<uint32_t> m_usedChunks{0};
     std::atomic<uint32_t> m_minFree{0};
+    std::atomic<uint64_t> m_failedAllocations{0};
     /// @todo: end
 
+    std::atomic<bool> m_threadCacheEnabled{false};
+
+    bool m_isBuddyPool{false};
+
     freeList_t m_freeIndices;
+    BuddyAllocator m_buddyAllocator;
 };
 
 } // namespace mepoo
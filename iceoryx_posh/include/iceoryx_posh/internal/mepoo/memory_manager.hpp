@@ -20,7 +20,9 @@
 #include "iceoryx_utils/cxx/helplets.hpp"
 #include "iceoryx_utils/cxx/vector.hpp"
 
+#include <atomic>
 #include <cstdint>
+#include <iosfwd>
 #include <limits>
 
 namespace iox
@@ -34,6 +36,22 @@ class MemoryManager
     using MaxSize_t = cxx::range<uint32_t, 1, std::numeric_limits<uint32_t>::max() - sizeof(ChunkHeader)>;
 
   public:
+    /// @brief cheap allocation trace for offline mempool tuning (opt-in); getChunk
+    /// records every requested payload size into a log2 histogram plus a small
+    /// reservoir of exact sizes. Together with the per-pool usage counters of the
+    /// mempool introspection the dump is the input for tools/mempool_advisor.py
+    /// which derives an optimized MePooConfig from a recorded drive
+    struct AllocationTrace
+    {
+        static constexpr uint32_t SIZE_CLASSES{33u};
+        static constexpr uint32_t RESERVOIR_SIZE{256u};
+
+        /// number of requests per log2 of the requested payload size
+        std::atomic<uint64_t> m_requestsPerSizeClass[SIZE_CLASSES] = {};
+        /// uniform reservoir sample of exact requested payload sizes
+        std::atomic<uint32_t> m_reservoir[RESERVOIR_SIZE] = {};
+        std::atomic<uint64_t> m_totalRequests{0u};
+    };
     MemoryManager() = default;
     MemoryManager(const MemoryManager&) = delete;
     MemoryManager(MemoryManager&&) = delete;
@@ -45,7 +63,69 @@ class MemoryManager
                                 posix::Allocator* f_managementAllocator,
                                 posix::Allocator* f_payloadAllocator);
 
-    SharedChunk getChunk(const MaxSize_t f_size);
+    /// @brief snapshot of one entry of the per-port accounting table
+    struct PortAccountingInfo
+    {
+        uint64_t m_portID{0u};
+        uint32_t m_outstandingChunks{0u};
+        uint64_t m_totalAllocations{0u};
+    };
+
+    /// number of entries in the per-port accounting table
+    static constexpr uint32_t PORT_ACCOUNTING_CAPACITY{MAX_ACCOUNTED_PORTS_PER_SEGMENT};
+
+    /// @param [in] f_quota optional per consumer quota the chunk is charged
+    /// against; the reservation is denied when the quota is exhausted and the
+    /// charge is handed back when the chunk returns to the pool
+    /// @param [in] f_accounting optional accounting entry of the requesting
+    /// port; the acquisition is counted there and the count is handed back
+    /// when the chunk returns to the pool
+    SharedChunk getChunk(const MaxSize_t f_size,
+                         ChunkQuota* const f_quota = nullptr,
+                         PortChunkAccounting* const f_accounting = nullptr);
+
+    /// Acquires a chunk for a dynamic payload size from the buddy mempool; in contrast
+    /// to getChunk() the internal fragmentation is bounded by a factor of two for
+    /// arbitrary payload sizes; falls back to getChunk() if no buddy mempool was
+    /// configured
+    SharedChunk getDynamicChunk(const MaxSize_t f_size,
+                                ChunkQuota* const f_quota = nullptr,
+                                PortChunkAccounting* const f_accounting = nullptr);
+
+    /// @return true if a buddy mempool for dynamic payload sizes was configured
+    bool hasDynamicMemPool() const;
+
+    /// Resolves the index of the mempool serving chunks of the given payload size;
+    /// meant to be called once for fixed size topics so the per sample pool search
+    /// can be skipped afterwards via getChunkFromPool()
+    /// @param [in] f_payloadSize payload size in bytes
+    /// @return index into the mempool vector, getNumberOfMemPools() if no pool fits
+    uint32_t getMemPoolIndexForPayloadSize(const uint32_t f_payloadSize) const;
+
+    /// Companion of getMemPoolIndexForPayloadSize() for fixed size topics: serves a
+    /// chunk directly from the given mempool, without the per sample size handling
+    /// and pool search of getChunk()
+    /// @param [in] f_poolIndex index resolved via getMemPoolIndexForPayloadSize()
+    /// @param [in] f_payloadSize payload size the index was resolved for
+    /// @param [in] f_quota optional per consumer quota, see getChunk()
+    /// @param [in] f_accounting optional accounting entry, see getChunk()
+    SharedChunk getChunkFromPool(const uint32_t f_poolIndex,
+                                 const MaxSize_t f_payloadSize,
+                                 ChunkQuota* const f_quota = nullptr,
+                                 PortChunkAccounting* const f_accounting = nullptr);
+
+    /// Claims the accounting entry of a port in the per-port accounting table;
+    /// meant to be called once per port, every acquisition then hands the
+    /// entry to getChunk() and friends
+    /// @param [in] f_portID unique id of the port, 0 is rejected
+    /// @return the entry of the port, nullptr when the table is full; the
+    ///         chunks of the port are then simply not attributed
+    PortChunkAccounting* fetchPortAccounting(const uint64_t f_portID);
+
+    /// @param [in] f_index index into the accounting table, up to
+    ///             PORT_ACCOUNTING_CAPACITY
+    /// @return snapshot of the entry, a port id of 0 marks an unclaimed entry
+    PortAccountingInfo getPortAccountingInfo(const uint32_t f_index) const;
 
     uint32_t getMempoolChunkSizeForPayloadSize(const uint32_t f_size) const;
 
@@ -53,6 +133,26 @@ class MemoryManager
 
     MemPoolInfo getMemPoolInfo(uint32_t f_index) const;
 
+    /// Grows a mempool at runtime into the extension capacity reserved via the
+    /// m_maxChunkCount of its config entry
+    /// @param [in] f_index index of the mempool to grow
+    /// @param [in] f_numberOfChunks number of additional chunks to activate
+    /// @return true on success, false if the index is invalid or the reserved
+    ///         capacity would be exceeded
+    bool extendMemPool(const uint32_t f_index, const uint32_t f_numberOfChunks);
+
+    /// Enables the allocation trace; when disabled (default) getChunk pays only a
+    /// relaxed load and a branch for it
+    void enableAllocationTracing();
+
+    /// @return the recorded allocation trace, all zero when tracing was never enabled
+    const AllocationTrace& getAllocationTrace() const;
+
+    /// Writes the recorded trace and the per-pool usage counters in the text
+    /// format consumed by tools/mempool_advisor.py
+    /// @param [in] f_stream stream to write the dump to
+    void dumpAllocationTrace(std::ostream& f_stream) const;
+
     static uint32_t sizeWithChunkHeaderStruct(const MaxSize_t f_size);
 
     static uint64_t requiredChunkMemorySize(const MePooConfig& f_mePooConfig);
@@ -61,18 +161,49 @@ class MemoryManager
 
   private:
     void printMemPoolVector() const;
+    void buildSizeClassIndex();
+    void recordAllocation(const uint32_t f_payloadSize);
+    /// charges the quota for one chunk with relaxed counters
+    /// @return false when the quota is exhausted, the denial is counted
+    static bool tryChargeQuota(ChunkQuota* const f_quota);
+    /// hands a charge back when the acquisition failed after charging
+    static void unchargeQuota(ChunkQuota* const f_quota);
+    /// @return index of the first mempool whose chunk size fits f_adjustedSize,
+    ///         m_memPoolVector.size() if no mempool fits
+    uint32_t getMemPoolIndexForSize(const uint32_t f_adjustedSize) const;
     void addMemPool(posix::Allocator* f_managementAllocator,
                     posix::Allocator* f_payloadAllocator,
                     const cxx::greater_or_equal<uint32_t, MemPool::MEMORY_ALIGNMENT> f_payloadSize,
-                    const cxx::greater_or_equal<uint32_t, 1> f_numberOfChunks);
-    void generateChunkManagementPool(posix::Allocator* f_managementAllocator);
+                    const cxx::greater_or_equal<uint32_t, 1> f_numberOfChunks,
+                    const uint32_t f_maxNumberOfChunks = 0u);
+    void addDynamicMemPool(posix::Allocator* f_managementAllocator,
+                           posix::Allocator* f_payloadAllocator,
+                           const cxx::greater_or_equal<uint32_t, MemPool::MEMORY_ALIGNMENT> f_minBlockSize,
+                           const cxx::greater_or_equal<uint32_t, 1> f_numberOfMinBlocks);
+    /// @param [in] f_entryAllocator allocator the ChunkManagement entries are taken
+    ///             from; the payload allocator for a segment local management layout
+    ///             (MePooConfig::m_segmentLocalManagement), otherwise the management
+    ///             allocator. The free list always stays in the management segment
+    void generateChunkManagementPool(posix::Allocator* f_managementAllocator, posix::Allocator* f_entryAllocator);
 
   private:
     bool m_denyAddMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
 
+    /// first fitting mempool index per log2 of the requested chunk size, built once in
+    /// configureMemoryManager() so getChunk() resolves its size class in constant time
+    static constexpr uint32_t SIZE_CLASS_COUNT{33u};
+    uint8_t m_sizeClassIndex[SIZE_CLASS_COUNT] = {0u};
+
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
+    cxx::vector<MemPool, 1> m_dynamicMemPool;
     cxx::vector<MemPool, 1> m_chunkManagementPool;
+
+    std::atomic_bool m_allocationTracing{false};
+    AllocationTrace m_allocationTrace;
+
+    /// per-port accounting table, entries are claimed via fetchPortAccounting()
+    PortChunkAccounting m_portAccounting[PORT_ACCOUNTING_CAPACITY];
 };
 
 } // namespace mepoo
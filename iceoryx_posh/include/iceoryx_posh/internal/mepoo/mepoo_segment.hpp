@@ -41,6 +41,14 @@ class MePooSegment
     MemoryManagerType& getMemoryManager();
 
     uint64_t getSegmentId() const;
+    bool getPrefaultPages() const;
+
+    /// @brief reopens the payload segment in the current process and registers
+    ///        it to its previous segment id; the shared memory object created
+    ///        by the dead RouDi instance is replaced since its file handle and
+    ///        mapping are stale
+    /// @return true if the segment could be reopened, false otherwise
+    bool reopenForAdoption();
 
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& f_mempoolConfig,
@@ -53,6 +61,7 @@ class MePooSegment
     posix::PosixGroup m_readerGroup;
     posix::PosixGroup m_writerGroup;
     uint64_t m_segmentId;
+    bool m_prefaultPages{false};
 
   private:
     void setSegmentId(const uint64_t segmentId);
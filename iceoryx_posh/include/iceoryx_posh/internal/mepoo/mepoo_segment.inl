@@ -14,6 +14,7 @@
 
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/roudi/startup_profiler.hpp"
 #include "iceoryx_utils/error_handling/error_handling.hpp"
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
 
@@ -30,6 +31,7 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(con
     : m_sharedMemoryObject(createSharedMemoryObject(f_mempoolConfig, f_writerGroup, f_baseAddressOffset))
     , m_readerGroup(f_readerGroup)
     , m_writerGroup(f_writerGroup)
+    , m_prefaultPages(f_mempoolConfig.m_prefaultPages)
 {
     using namespace posix;
     AccessController f_accessController;
@@ -48,9 +50,11 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(con
     {
         errorHandler(Error::kMEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
     }
+    roudi::StartupProfiler::instance().phaseDone("payload segment acl setup");
 
     m_memoryManager.configureMemoryManager(f_mempoolConfig, f_managementAllocator, m_sharedMemoryObject.getAllocator());
     m_sharedMemoryObject.finalizeAllocation();
+    roudi::StartupProfiler::instance().phaseDone("payload segment mempool init");
 }
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
@@ -75,15 +79,73 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
         errorHandler(Error::kMEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT);
     }
 
+    if (f_mempoolConfig.m_numaNode >= 0
+        && !retVal->bindToNumaNode(static_cast<uint32_t>(f_mempoolConfig.m_numaNode)))
+    {
+        LogWarn() << "NUMA node " << f_mempoolConfig.m_numaNode << " requested for payload segment " << shmName.c_str()
+                  << " but binding is not supported on this platform, falling back to first touch placement";
+    }
+
+    if (f_mempoolConfig.m_hugePages && !retVal->adviseHugePages())
+    {
+        LogWarn() << "Huge pages requested for payload segment " << shmName.c_str()
+                  << " but not supported on this platform, falling back to regular pages";
+    }
+
+    if (f_mempoolConfig.m_prefaultPages)
+    {
+        retVal->prefault();
+    }
+
     setSegmentId(iox::RelativePointer::registerPtr(retVal->getBaseAddress(), retVal->getSizeInBytes()));
 
     LogInfo() << "Roudi registered payload segment "
               << iox::log::HexFormat(reinterpret_cast<uint64_t>(retVal->getBaseAddress())) << " with size "
               << retVal->getSizeInBytes() << " to id " << m_segmentId;
+    roudi::StartupProfiler::instance().phaseDone("payload segment creation");
 
     return std::move(retVal.value());
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool MePooSegment<SharedMemoryObjectType, MemoryManagerType>::reopenForAdoption()
+{
+    // we let the OS decide where to map the segment; the chunks are accessed
+    // via relative pointers
+    constexpr void* BASE_ADDRESS_HINT{nullptr};
+
+    auto shmName = "/" + m_writerGroup.getName();
+    auto retVal = SharedMemoryObjectType::create(shmName.c_str(),
+                                                 m_sharedMemoryObject.getSizeInBytes(),
+                                                 posix::AccessMode::readWrite,
+                                                 posix::OwnerShip::openExisting,
+                                                 BASE_ADDRESS_HINT,
+                                                 S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+    if (!retVal.has_value() || nullptr == retVal->getBaseAddress())
+    {
+        LogWarn() << "Unable to reopen payload segment " << shmName.c_str() << " for adoption";
+        return false;
+    }
+
+    if (!iox::RelativePointer::registerPtr(static_cast<iox::RelativePointer::id_t>(m_segmentId),
+                                           retVal->getBaseAddress(),
+                                           retVal->getSizeInBytes()))
+    {
+        LogWarn() << "Unable to register the adopted payload segment " << shmName.c_str() << " to its previous id "
+                  << m_segmentId;
+        return false;
+    }
+
+    // the shared memory object of the dead RouDi instance holds a stale file
+    // handle and mapping, replace it with the one of this process
+    m_sharedMemoryObject = std::move(retVal.value());
+
+    LogInfo() << "Roudi adopted payload segment "
+              << iox::log::HexFormat(reinterpret_cast<uint64_t>(m_sharedMemoryObject.getBaseAddress()))
+              << " with size " << m_sharedMemoryObject.getSizeInBytes() << " at id " << m_segmentId;
+    return true;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline posix::PosixGroup MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getWriterGroup() const
 {
@@ -115,6 +177,12 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentId;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getPrefaultPages() const
+{
+    return m_prefaultPages;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline void MePooSegment<SharedMemoryObjectType, MemoryManagerType>::setSegmentId(const uint64_t segmentId)
 {
@@ -56,13 +56,15 @@ class SegmentManager
                        void* f_startAddress,
                        uint64_t f_size,
                        bool f_isWritable,
-                       uint64_t f_segmentId)
+                       uint64_t f_segmentId,
+                       bool f_prefault = false)
             : m_sharedMemoryName(f_sharedMemoryName)
             , m_startAddress(f_startAddress)
             , m_size(f_size)
             , m_isWritable(f_isWritable)
 
             , m_segmentId(f_segmentId)
+            , m_prefault(f_prefault)
 
         {
         }
@@ -72,6 +74,7 @@ class SegmentManager
         uint64_t m_size{0};
         bool m_isWritable{false};
         uint64_t m_segmentId{0};
+        bool m_prefault{false};
     };
 
     struct SegmentUserInformation
@@ -82,6 +85,12 @@ class SegmentManager
 
     using SegmentMappingContainer = cxx::vector<SegmentMapping, MAX_SHM_SEGMENTS>;
 
+    /// @brief remaps all payload segments into the current process and registers
+    ///        them to their previous segment ids; used when a restarted RouDi
+    ///        adopts the shared memory of a crashed instance
+    /// @return true if all segments could be remapped, false otherwise
+    bool remapSegmentsForAdoption();
+
     SegmentMappingContainer getSegmentMappings(posix::PosixUser f_user);
     SegmentUserInformation getSegmentInformationForUser(posix::PosixUser f_user);
 
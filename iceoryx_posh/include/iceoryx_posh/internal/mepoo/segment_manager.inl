@@ -70,6 +70,19 @@ inline bool SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
     }
 }
 
+template <typename SegmentType>
+inline bool SegmentManager<SegmentType>::remapSegmentsForAdoption()
+{
+    for (auto& segment : m_segmentContainer)
+    {
+        if (!segment.reopenForAdoption())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 template <typename SegmentType>
 inline typename SegmentManager<SegmentType>::SegmentMappingContainer
 SegmentManager<SegmentType>::getSegmentMappings(posix::PosixUser f_user)
@@ -95,7 +108,8 @@ SegmentManager<SegmentType>::getSegmentMappings(posix::PosixUser f_user)
                                                     segment.getSharedMemoryObject().getBaseAddress(),
                                                     segment.getSharedMemoryObject().getSizeInBytes(),
                                                     true,
-                                                    segment.getSegmentId());
+                                                    segment.getSegmentId(),
+                                                    segment.getPrefaultPages());
                     l_foundInWriterGroup = true;
                 }
                 else
@@ -123,7 +137,8 @@ SegmentManager<SegmentType>::getSegmentMappings(posix::PosixUser f_user)
                                                 segment.getSharedMemoryObject().getBaseAddress(),
                                                 segment.getSharedMemoryObject().getSizeInBytes(),
                                                 false,
-                                                segment.getSegmentId());
+                                                segment.getSegmentId(),
+                                                segment.getPrefaultPages());
             }
         }
     }
@@ -59,6 +59,17 @@ class SharedChunk
 
     bool hasNoOtherOwners() const;
 
+    /// Adds f_count references with a single atomic add instead of one
+    /// read-modify-write per new owner; every added reference must be transferred
+    /// into a SharedChunk via claimAddedReference() afterwards
+    /// @param [in] f_count number of references to add
+    void addReferences(const uint32_t f_count) const;
+
+    /// Transfers one reference previously added via addReferences() into a new
+    /// SharedChunk without touching the reference counter again
+    /// @return SharedChunk owning one of the added references
+    SharedChunk claimAddedReference() const;
+
     template <typename>
     friend class SharedPointer;
 
@@ -68,7 +79,16 @@ class SharedChunk
     void freeChunk();
 
   private:
+#ifdef IOX_FIXED_SEGMENT_MAPPING
+    /// with fixed address segment mapping every process sees the segments at the
+    /// same virtual addresses, so the chunk reference is a raw pointer and the
+    /// relative_ptr translation is compiled out of every chunk access; the
+    /// id/offset representation is only materialized at the transport boundaries
+    /// (releaseWithRelativePtr and the constructor taking a relative_ptr)
+    ChunkManagement* m_chunkManagement{nullptr};
+#else
     iox::relative_ptr<ChunkManagement> m_chunkManagement;
+#endif
 };
 } // namespace mepoo
 } // namespace iox
@@ -27,6 +27,36 @@ enum class SharedPointerError
     SharedChunkIsEmpty
 };
 
+template <typename T>
+class SharedPointer;
+
+/// @brief borrowed, non owning view on an object managed by a SharedPointer.
+///         Pass views down call chains instead of SharedPointer copies: a view
+///         never touches the atomic reference counter of the underlying chunk.
+///         The caller has to guarantee that the owning SharedPointer outlives
+///         every view borrowed from it
+template <typename T>
+class SharedPointerView
+{
+  public:
+    SharedPointerView() = default;
+
+    T* get() const noexcept;
+    T* operator->() const noexcept;
+    T& operator*() const noexcept;
+
+    /// @return true if the view refers to an object, false otherwise
+    explicit operator bool() const noexcept;
+
+    template <typename>
+    friend class SharedPointer;
+
+  private:
+    explicit SharedPointerView(T* const f_object) noexcept;
+
+    T* m_object{nullptr};
+};
+
 /// @brief DesignPattern::Creation offers us a create method which forwards the arguments to
 /// the constructor. Use this class like in the code example below
 /// @code
@@ -44,6 +74,8 @@ class SharedPointer : public DesignPattern::Creation<SharedPointer<T>, SharedPoi
   public:
     SharedPointer() = default;
     SharedPointer(const SharedPointer&) = default;
+    /// moving transfers ownership of the chunk without any reference counter
+    /// traffic, prefer it over copies when handing the pointer on
     SharedPointer(SharedPointer&&) = default;
     ~SharedPointer();
 
@@ -59,6 +91,11 @@ class SharedPointer : public DesignPattern::Creation<SharedPointer<T>, SharedPoi
     T& operator*();
     const T& operator*() const;
 
+    /// @brief borrows a non owning view on the managed object for passing it
+    ///         down a call chain without bumping the reference counter
+    /// @return view on the managed object, an empty view for an empty pointer
+    SharedPointerView<T> view() const noexcept;
+
     friend class DesignPattern::Creation<SharedPointer<T>, SharedPointerError>;
 
   private:
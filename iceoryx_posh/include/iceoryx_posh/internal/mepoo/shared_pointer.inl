@@ -107,6 +107,46 @@ inline const T& SharedPointer<T>::operator*() const
     return const_cast<SharedPointer*>(this)->operator*();
 }
 
+template <typename T>
+inline SharedPointerView<T> SharedPointer<T>::view() const noexcept
+{
+    if (m_chunk.m_chunkManagement == nullptr)
+    {
+        return SharedPointerView<T>();
+    }
+    return SharedPointerView<T>(const_cast<SharedPointer*>(this)->get());
+}
+
+template <typename T>
+inline SharedPointerView<T>::SharedPointerView(T* const f_object) noexcept
+    : m_object(f_object)
+{
+}
+
+template <typename T>
+inline T* SharedPointerView<T>::get() const noexcept
+{
+    return m_object;
+}
+
+template <typename T>
+inline T* SharedPointerView<T>::operator->() const noexcept
+{
+    return m_object;
+}
+
+template <typename T>
+inline T& SharedPointerView<T>::operator*() const noexcept
+{
+    return *m_object;
+}
+
+template <typename T>
+inline SharedPointerView<T>::operator bool() const noexcept
+{
+    return m_object != nullptr;
+}
+
 
 } // namespace mepoo
 } // namespace iox
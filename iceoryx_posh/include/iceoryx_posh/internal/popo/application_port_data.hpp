@@ -26,7 +26,10 @@ struct ApplicationPortData : public BasePortData
 {
     ApplicationPortData() = default;
     ApplicationPortData(const std::string& f_applicationName, Interfaces f_interface);
-    concurrent::FiFo<capro::CaproMessage, MAX_APPLICATION_CAPRO_FIFO_SIZE> m_caproMessageFiFo;
+    /// cache line padded like the interface port fifo, the application and
+    /// RouDi sit on different sides of it
+    concurrent::FiFo<capro::CaproMessage, MAX_APPLICATION_CAPRO_FIFO_SIZE, concurrent::FiFoPadding::CACHE_LINE>
+        m_caproMessageFiFo;
 };
 } // namespace popo
 } // namespace iox
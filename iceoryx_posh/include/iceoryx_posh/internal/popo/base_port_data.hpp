@@ -18,6 +18,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
+#include "iceoryx_utils/posix_wrapper/futex_signal.hpp"
 
 #include <atomic>
 
@@ -74,10 +75,33 @@ struct BasePortData
     cxx::CString100 m_processName;
     Interfaces m_interface{Interfaces::INTERNAL};
 
+    /// id generation is wait-free and never serializes across processes: every
+    /// process draws from its own id range whose index is handed out by RouDi at
+    /// registration and encoded in the upper bits, the lower bits come from a
+    /// relaxed fetch_add on a process local counter. Range index 0 is used by
+    /// RouDi itself and by processes which never registered (e.g. tests)
+    static constexpr uint64_t UNIQUE_ID_RANGE_SHIFT{48u};
+
+    /// @brief sets the id range of this process, called once at registration
+    ///        before the first port is created
+    /// @param[in] f_rangeIndex index of the id range handed out by RouDi
+    static void setUniqueIdRange(const uint64_t f_rangeIndex) noexcept;
+
+    /// @brief generates the next port id of this process
+    /// @return id unique across all processes registered with the same RouDi
+    static uint64_t generateUniqueId() noexcept;
+
     static std::atomic<uint64_t> s_uniqueIdCounter;
+    static std::atomic<uint64_t> s_uniqueIdRangeBase;
     std::atomic<uint64_t> m_uniqueId{0};
 
     iox::relative_ptr<runtime::RunnableData> m_runnable;
+
+    /// signal of the RouDi discovery loop, posted when this port changes its CaPro
+    /// relevant state (subscribe, offer, ...) so the change is processed right away
+    /// instead of on the next polling cycle; set by RouDi on port creation and a
+    /// nullptr for ports which are not managed by RouDi (e.g. in tests)
+    iox::relative_ptr<posix::FutexSignal> m_discoverySignal;
 };
 
 } // namespace popo
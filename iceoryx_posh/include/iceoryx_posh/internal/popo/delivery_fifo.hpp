@@ -21,6 +21,8 @@
 #include "iceoryx_utils/internal/concurrent/sofi.hpp"
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace popo
@@ -30,6 +32,10 @@ class DeliveryFiFo
   public:
     struct ChunkManagementTransport
     {
+        /// samples of at most this size can be embedded by value in the slot
+        /// instead of referencing a mempool chunk
+        static constexpr uint32_t INLINE_PAYLOAD_CAPACITY{32u};
+
         ChunkManagementTransport() = default;
         ChunkManagementTransport(iox::relative_ptr<mepoo::ChunkManagement> f_chunk)
             : m_segmentId(f_chunk.getId())
@@ -37,20 +43,134 @@ class DeliveryFiFo
         {
         }
 
+        /// validates the segment id and the chunk offset a single time and
+        /// resolves them to the raw chunk management entry; nullptr when the
+        /// transport carries no valid chunk. All accesses through the returned
+        /// pointer are unchecked for the rest of the sample's life
+        mepoo::ChunkManagement* validatedChunkManagement() const
+        {
+            return iox::validated_ptr<mepoo::ChunkManagement>(m_chunkOffset, m_segmentId).get();
+        }
+
         RelativePointer::id_t m_segmentId{iox::RelativePointer::NULL_POINTER_ID};
         RelativePointer::offset_t m_chunkOffset{iox::RelativePointer::NULL_POINTER_OFFSET};
+        /// 0 marks a chunk reference; otherwise the slot carries an inline sample
+        /// of this many bytes in m_inlinePayload and no chunk at all. The inline
+        /// buffer grows the slot, but it still fits a cache line and the copy per
+        /// sample stays a single line transfer
+        uint32_t m_inlinePayloadSize{0u};
+        uint8_t m_inlinePayload[INLINE_PAYLOAD_CAPACITY];
+    };
+
+    /// behavior of push when the FiFo is full
+    enum class OverflowPolicy : uint32_t
+    {
+        OVERWRITE_OLDEST,  ///< the oldest queued chunk is dropped (default, SoFi semantics)
+        DISCARD_NEWEST,    ///< the incoming chunk is dropped, the queued ones stay untouched
+        BLOCK_WITH_TIMEOUT ///< push waits for free space up to the configured timeout,
+                           ///< then the incoming chunk is dropped
     };
 
     bool pop(mepoo::SharedChunk& chunk);
     bool push(mepoo::SharedChunk&& chunkIn, mepoo::SharedChunk& chunkOut);
 
+    /// Pushes a small sample by value directly into the FiFo slot, with no mempool
+    /// chunk involved; the overflow policies apply like in push. A topic delivered
+    /// inline has to be fetched with popInline, mixing inline samples and chunks on
+    /// one FiFo is not supported
+    /// @param [in] f_payload sample to embed
+    /// @param [in] f_size size of the sample, at most
+    ///             ChunkManagementTransport::INLINE_PAYLOAD_CAPACITY
+    /// @param [out] f_chunkOut an overwritten chunk entry, handed back for release
+    /// @return true if the sample was pushed
+    bool pushInline(const void* const f_payload, const uint32_t f_size, mepoo::SharedChunk& f_chunkOut);
+
+    /// Pops an inline sample pushed with pushInline
+    /// @param [out] f_payload buffer with space for INLINE_PAYLOAD_CAPACITY bytes
+    /// @param [out] f_size size of the fetched sample
+    /// @return true if a sample was fetched
+    bool popInline(void* const f_payload, uint32_t& f_size);
+
+    /// Pops up to f_count chunks in one pass; the read index of the underlying
+    /// FiFo is committed once for the whole run
+    /// @param [out] f_chunks array with space for f_count chunks
+    /// @param [in] f_count maximum number of chunks to pop
+    /// @return number of valid entries written to f_chunks
+    uint32_t popBatch(mepoo::SharedChunk* f_chunks, const uint32_t f_count);
+
+    /// Pushes f_count chunks in one pass; the write index of the underlying
+    /// FiFo is published once for the whole run. Overwritten or dropped
+    /// chunks are released and counted like in push
+    /// @param [in] f_chunks chunks to deliver, consumed by the call
+    /// @param [in] f_count number of chunks in f_chunks
+    void pushBatch(mepoo::SharedChunk* f_chunks, const uint32_t f_count);
+
+    /// Sets the overflow policy, to be configured from the receiver side
+    /// @param [in] f_policy behavior of push when the FiFo is full
+    /// @param [in] f_timeoutMs wait budget for BLOCK_WITH_TIMEOUT, ignored otherwise
+    void setOverflowPolicy(const OverflowPolicy f_policy, const uint32_t f_timeoutMs = 0u);
+    OverflowPolicy getOverflowPolicy() const;
+
+    /// number of chunks dropped on overflow since creation, regardless of which
+    /// side of the FiFo the drop happened on
+    uint64_t getDropCount() const;
+
+    /// sequence number of the most recently dropped chunk; only meaningful
+    /// when getDropCount() is greater than 0
+    uint64_t getLastDroppedSequenceNumber() const;
+
+    /// number of read index conflicts in the underlying FiFo since creation, i.e.
+    /// how often the pushing sender overflowed while the receiver was reading;
+    /// always 0 in latest value mode
+    uint64_t getIndexConflicts() const;
+
     bool empty() const;
+    /// a size of 1 activates the latest value mode where a single slot is swapped
+    /// instead of running the full FiFo machinery
     bool resize(const uint32_t f_size);
     uint64_t getCapacity() const;
     uint64_t getSize() const;
 
   private:
+    bool pushLatestValue(ChunkManagementTransport&& f_transportIn, ChunkManagementTransport& f_transportOut);
+    bool popLatestValue(ChunkManagementTransport& f_transport);
+    bool full() const;
+
+    /// accounts an overwritten transport entry: a chunk reference is handed back
+    /// for release via f_chunkOut, an inline sample is only counted as dropped
+    void reclaimDropped(const ChunkManagementTransport& f_transport, mepoo::SharedChunk& f_chunkOut);
+
+    /// applies the non default overflow policies when the FiFo is full, waiting
+    /// for free space with BLOCK_WITH_TIMEOUT
+    /// @return true when the incoming sample has to be discarded
+    bool discardAfterOverflowPolicy(const OverflowPolicy f_policy);
+
+    /// counts a dropped chunk and remembers its sequence number, wait-free on
+    /// the pushing side
+    void recordDrop(const mepoo::SharedChunk& f_droppedChunk);
+
     concurrent::SoFi<ChunkManagementTransport, MAX_RECEIVER_QUEUE_SIZE> m_fifo;
+
+    // single slot used instead of the FiFo for latest value topics (delivery size 1);
+    // push and pop exchange the slot guarded by the state word below, which touches
+    // one cache line per sample instead of the FiFo indices and ring storage
+    enum class LatestValueState : uint32_t
+    {
+        EMPTY,
+        WRITING,
+        FULL,
+        READING
+    };
+    std::atomic_bool m_latestValueMode{false};
+    std::atomic<LatestValueState> m_latestValueState{LatestValueState::EMPTY};
+    ChunkManagementTransport m_latestValueSlot;
+
+    // written by the receiver side, read by the pushing sender
+    std::atomic<OverflowPolicy> m_overflowPolicy{OverflowPolicy::OVERWRITE_OLDEST};
+    std::atomic<uint32_t> m_overflowTimeoutMs{0u};
+    // written by the pushing sender, read by the receiver side
+    std::atomic<uint64_t> m_dropCounter{0u};
+    std::atomic<uint64_t> m_lastDroppedSequenceNumber{0u};
 };
 
 } // namespace popo
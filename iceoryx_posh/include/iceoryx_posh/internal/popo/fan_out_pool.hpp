@@ -0,0 +1,99 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Process local worker pool for wide delivery fan-outs. With hundreds
+///         of receivers on one topic the serial loop in the receiver handler
+///         (FiFo push plus wakeup per receiver) charges the whole fan-out to
+///         the publishing thread; above PARALLEL_FANOUT_THRESHOLD receivers
+///         the loop is split into ranges which the workers and the publishing
+///         thread process in parallel. The pool is created lazily on the first
+///         wide fan-out, processes which never cross the threshold spawn no
+///         threads
+/// @concurrent runPartitioned may be called from several threads, concurrent
+///             wide fan-outs are serialized against each other
+class FanOutPool
+{
+  public:
+    /// receiver count from which on a fan-out is split across the workers; below,
+    /// the range splitting and the wakeups would cost more than they save
+    static constexpr uint32_t PARALLEL_FANOUT_THRESHOLD{64u};
+
+    /// @brief The pool of the process, workers are started on the first call
+    static FanOutPool& get() noexcept;
+
+    /// @brief Sets the number of worker threads of the pool of the process; has
+    ///         to be called before the first wide fan-out, later calls are ignored
+    /// @param[in] f_numberOfThreads number of workers, the publishing thread
+    ///             works on its own range in addition
+    static void setWorkerCount(const uint32_t f_numberOfThreads) noexcept;
+
+    ~FanOutPool() noexcept;
+
+    FanOutPool(const FanOutPool&) = delete;
+    FanOutPool(FanOutPool&&) = delete;
+    FanOutPool& operator=(const FanOutPool&) = delete;
+    FanOutPool& operator=(FanOutPool&&) = delete;
+
+    /// @brief Runs f_execute(f_context, begin, end) for disjoint ranges covering
+    ///         [0, f_count) on the workers and the calling thread and returns when
+    ///         all ranges are processed; f_context has to stay valid until then
+    /// @param[in] f_execute range function, called concurrently with disjoint ranges
+    /// @param[in] f_context passed through to every range invocation
+    /// @param[in] f_count size of the index range to partition
+    void runPartitioned(void (*f_execute)(void* f_context, const uint32_t f_begin, const uint32_t f_end),
+                        void* const f_context,
+                        const uint32_t f_count) noexcept;
+
+  private:
+    explicit FanOutPool(const uint32_t f_numberOfThreads) noexcept;
+
+    struct Worker
+    {
+        std::mutex m_mutex;
+        std::condition_variable m_condVar;
+        void (*m_execute)(void*, const uint32_t, const uint32_t){nullptr};
+        void* m_context{nullptr};
+        uint32_t m_begin{0u};
+        uint32_t m_end{0u};
+        std::atomic<uint32_t>* m_remaining{nullptr};
+        bool m_hasTask{false};
+        std::thread m_thread;
+    };
+
+    void workerLoop(Worker& f_worker) noexcept;
+
+    /// concurrent wide fan-outs from different publisher threads take turns on
+    /// the workers; they are rare enough that sharing the pool beats per-port
+    /// worker threads
+    std::mutex m_submitMutex;
+    std::atomic_bool m_runFlag{true};
+    std::vector<std::unique_ptr<Worker>> m_workers;
+};
+
+} // namespace popo
+} // namespace iox
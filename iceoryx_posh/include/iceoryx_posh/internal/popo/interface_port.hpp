@@ -33,8 +33,30 @@ class InterfacePort : public BasePort
 
     bool dispatchCaProMessage(const capro::CaproMessage& f_message);
 
+    /// @brief pushes f_count messages into the CaPro fifo in one pass; the
+    ///         write index of the fifo is committed once for the whole run, so
+    ///         an aggregated discovery cycle reaches the gateway as one burst
+    /// @param[in] f_messages array holding f_count messages
+    /// @param[in] f_count number of messages to dispatch
+    /// @return number of messages accepted; messages beyond the effective
+    ///         fifo capacity are dismissed and counted, like in
+    ///         dispatchCaProMessage
+    uint32_t dispatchCaProMessages(const capro::CaproMessage* f_messages, const uint32_t f_count);
+
     bool getCaProMessage(capro::CaproMessage& f_message);
 
+    /// @brief drains up to f_count messages from the CaPro fifo in one pass;
+    ///         the read index of the fifo is committed once for the whole run
+    /// @param[out] f_messages array with space for f_count messages
+    /// @param[in] f_count maximum number of messages to fetch
+    /// @return number of valid entries written to f_messages
+    uint32_t getCaProMessages(capro::CaproMessage* f_messages, const uint32_t f_count);
+
+    /// @brief number of CaPro messages dismissed because the fifo was at its
+    ///         effective capacity; a gateway seeing this advance has lost
+    ///         discovery updates and should be created with a deeper fifo
+    uint64_t getDismissedCaProMessageCount() const;
+
   private:
     const InterfacePortData* getMembers() const;
     InterfacePortData* getMembers();
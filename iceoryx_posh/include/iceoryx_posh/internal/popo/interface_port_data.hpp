@@ -19,6 +19,8 @@
 
 #include "iceoryx_utils/internal/concurrent/fifo.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace popo
@@ -28,8 +30,18 @@ struct InterfacePortData : public BasePortData
     InterfacePortData() = default;
     InterfacePortData(const std::string& applicationName,
                       const Interfaces interface,
-                      runtime::RunnableData* const runnable) noexcept;
-    concurrent::FiFo<capro::CaproMessage, MAX_INTERFACE_CAPRO_FIFO_SIZE> m_caproMessageFiFo;
+                      runtime::RunnableData* const runnable,
+                      const uint32_t caproMessageFiFoCapacity = MAX_INTERFACE_CAPRO_FIFO_SIZE) noexcept;
+    /// cache line padded so that RouDi pushing CaPro messages and the gateway
+    /// popping them do not false-share the fifo indices
+    concurrent::FiFo<capro::CaproMessage, MAX_INTERFACE_CAPRO_FIFO_SIZE, concurrent::FiFoPadding::CACHE_LINE>
+        m_caproMessageFiFo;
+    /// effective depth of the CaPro fifo for this interface; the backing storage
+    /// keeps the compile time maximum since the port data has a fixed layout in
+    /// shared memory, but a small gateway can bound the burst it has to absorb
+    uint32_t m_caproMessageFiFoCapacity{MAX_INTERFACE_CAPRO_FIFO_SIZE};
+    /// CaPro messages dismissed because the fifo was at its effective capacity
+    std::atomic<uint64_t> m_dismissedCaproMessageCount{0u};
     bool m_doInitialOfferForward{true};
 };
 } // namespace popo
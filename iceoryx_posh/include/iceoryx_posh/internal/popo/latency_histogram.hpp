@@ -0,0 +1,61 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Fixed size latency histogram which lives in the shared memory of a port.
+///        The buckets are powers of two of nanoseconds, i.e. bucket i counts the
+///        latencies with floor(log2(latencyNs)) == i, which gives a relative
+///        resolution of a factor of two over the whole range from nanoseconds to
+///        seconds with a few hundred bytes of memory.
+/// @concurrent record() is called by the application on the sample fetch path and
+///             uses only relaxed atomic increments; the percentiles are read by the
+///             RouDi introspection without synchronization, so a percentile taken
+///             while samples are recorded is an approximation
+struct LatencyHistogram
+{
+    static constexpr uint32_t NUMBER_OF_BUCKETS{64u};
+
+    LatencyHistogram() noexcept;
+
+    /// @brief records a single latency value
+    /// @param [in] f_latencyNs latency in nanoseconds
+    void record(const uint64_t f_latencyNs) noexcept;
+
+    /// @brief calculates a percentile from the bucket counts
+    /// @param [in] f_percentile requested percentile in the range (0, 100]
+    /// @return upper bucket edge of the bucket the percentile falls into, clamped
+    ///         to the maximum recorded latency; 0 if nothing was recorded yet
+    uint64_t percentile(const double f_percentile) const noexcept;
+
+    /// @return number of recorded latencies
+    uint64_t totalCount() const noexcept;
+
+    /// @return maximum recorded latency in nanoseconds, tracked exactly
+    uint64_t maxNs() const noexcept;
+
+    std::atomic<uint64_t> m_counts[NUMBER_OF_BUCKETS];
+    std::atomic<uint64_t> m_totalCount;
+    std::atomic<uint64_t> m_maxNs;
+};
+
+} // namespace popo
+} // namespace iox
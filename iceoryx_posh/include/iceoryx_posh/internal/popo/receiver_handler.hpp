@@ -15,12 +15,14 @@
 #pragma once
 
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/fan_out_pool.hpp"
 #include "iceoryx_posh/internal/popo/receiver_port.hpp"
 #include "iceoryx_utils/cxx/vector.hpp"
 #include "iceoryx_utils/error_handling/error_handling.hpp"
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
 
 #include <mutex>
+#include <thread>
 
 namespace iox
 {
@@ -61,9 +63,12 @@ class ReceiverHandler : public LockingPolicy
       public:
         bool hasLastChunk();
         void deliverChunk(const mepoo::SharedChunk f_chunk);
+        void deliverChunks(const mepoo::SharedChunk* f_chunks, const uint32_t f_count);
+        void deliverChunkToSnapshot(const ReceiverVector_t& f_receivers, const mepoo::SharedChunk f_chunk);
+        void deliverInline(const void* const f_payload, const uint32_t f_size);
         void updateLastChunk(const mepoo::SharedChunk f_chunk);
         bool hasReceivers();
-        void enableDoDeliverOnSubscription();
+        void enableDoDeliverOnSubscription(const uint32_t f_historyCapacity = 1u);
         ReceiverVector_t& getReceiverList() noexcept;
 
       private:
@@ -102,6 +107,27 @@ class ReceiverHandler : public LockingPolicy
     }
 
     void deliverChunk(const mepoo::SharedChunk f_chunk);
+    /// Delivers a batch of chunks with a single receiver list traversal and one
+    /// wakeup per receiver for the whole batch
+    /// @param [in] f_chunks array of f_count chunks
+    /// @param [in] f_count number of chunks
+    void deliverChunks(const mepoo::SharedChunk* f_chunks, const uint32_t f_count);
+    /// Delivers a chunk to a receiver list the caller pinned beforehand (real time
+    /// publish mode of the sender port): no snapshot acquisition to retry, no reader
+    /// bookkeeping and no handoff to the fan-out workers, so the cost is bounded by
+    /// the size of the pinned list
+    /// @param [in] f_receivers pinned receiver list, obtained via copyReceiverList()
+    /// @param [in] f_chunk chunk to deliver
+    void deliverChunkToSnapshot(const ReceiverVector_t& f_receivers, const mepoo::SharedChunk f_chunk);
+    /// Copy of the currently published receiver list, taken under the snapshot
+    /// guard so a concurrent update cannot be read half way
+    /// @return receiver list copy for pinned delivery
+    ReceiverVector_t copyReceiverList();
+    /// Delivers a small sample by value to every receiver of the snapshot; there is
+    /// no chunk and no chunk info, so chunk filters and the history do not apply
+    /// @param [in] f_payload sample to embed
+    /// @param [in] f_size size of the sample
+    void deliverInline(const void* const f_payload, const uint32_t f_size);
     void updateLastChunk(const mepoo::SharedChunk f_chunk);
     /// checks for a sample for delivering on subscription
     /// @return true if there is a valid sample for delivering on subscription
@@ -110,7 +136,10 @@ class ReceiverHandler : public LockingPolicy
     bool addNewReceiver(ReceiverPortType::MemberType_t* const f_receiver);
     void removeReceiver(ReceiverPortType::MemberType_t* const f_receiver);
     void removeAll();
-    void enableDoDeliverOnSubscription();
+    /// enables replaying the latest chunks to every new receiver
+    /// @param [in] f_historyCapacity number of chunks to replay, clamped to
+    ///             [1, MAX_HISTORY_CAPACITY]
+    void enableDoDeliverOnSubscription(const uint32_t f_historyCapacity = 1u);
     /// checks if delivering on subscription in enabled
     /// @return true if delivering on subscription is enabled
     bool doesDeliverOnSubscribe() const;
@@ -118,10 +147,56 @@ class ReceiverHandler : public LockingPolicy
     /// Returns the list of receivers
     ReceiverVector_t& getReceiverList() noexcept;
 
+    /// upper bound for the history a sender can replay to a late joining receiver
+    static constexpr uint32_t MAX_HISTORY_CAPACITY{16u};
+
+  private:
+    /// Grabs the currently published receiver list for iterating it without taking the
+    /// mutex; must be paired with releaseReceiverSnapshot(). The loop only retries when
+    /// a concurrent update flips the active list, so delivery does not block on RouDi
+    /// @param [out] f_slot slot index to pass to releaseReceiverSnapshot()
+    /// @return the active receiver list
+    const ReceiverVector_t& acquireReceiverSnapshot(uint32_t& f_slot);
+    void releaseReceiverSnapshot(const uint32_t f_slot);
+
+    /// Fans a single chunk out to the receivers of a snapshot; receivers whose chunk
+    /// filter rejects the chunk are skipped before any reference is added for them,
+    /// so a non-matching receiver only costs the tag comparison
+    /// @param [in] f_receivers receiver snapshot to deliver to
+    /// @param [in] f_chunk chunk to deliver
+    /// @param [in] f_sequentialOnly true keeps a wide fan-out on the calling thread
+    /// instead of handing ranges to the fan-out workers (real time publish mode)
+    void deliverToReceivers(const ReceiverVector_t& f_receivers,
+                            const mepoo::SharedChunk& f_chunk,
+                            const bool f_sequentialOnly = false);
+
+    /// Copies the active receiver list into the inactive slot for mutation; must be
+    /// called with the lock held, publishReceiverVectorUpdate() makes it visible
+    /// @return the inactive receiver list to mutate
+    ReceiverVector_t& beginReceiverVectorUpdate();
+
+    /// Flips the active slot and waits until no delivery uses the retired list anymore,
+    /// so the caller may safely destroy removed receiver ports afterwards
+    void publishReceiverVectorUpdate();
+
+    /// Appends a chunk to the history ring, evicting the oldest entry when the
+    /// configured capacity is reached; the lock must be held by the caller
+    void pushToHistory(const mepoo::SharedChunk& f_chunk);
+
   private:
     std::atomic_bool m_doDeliverOnSubscription{false};
-    ReceiverVector_t m_receiverVector;
-    mepoo::SharedChunk m_lastChunk{nullptr};
+    /// the receiver list is double buffered; deliverChunk reads the active slot while
+    /// RouDi prepares mutations in the inactive one and atomically flips the index
+    ReceiverVector_t m_receiverVectors[2];
+    std::atomic<uint32_t> m_activeReceiverVector{0u};
+    std::atomic<uint32_t> m_snapshotReaders[2] = {{0u}, {0u}};
+    /// ring of the latest delivered chunks, pinned via their reference counts and
+    /// replayed oldest first into the delivery FiFo of a new receiver; guarded by
+    /// the lock, like the receiver vector mutations
+    mepoo::SharedChunk m_history[MAX_HISTORY_CAPACITY];
+    uint32_t m_historyCapacity{1u};
+    uint32_t m_historySize{0u};
+    uint32_t m_historyNext{0u};
 };
 
 } // namespace popo
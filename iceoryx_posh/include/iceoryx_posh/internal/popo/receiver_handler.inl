@@ -16,6 +16,9 @@ namespace iox
 {
 namespace popo
 {
+template <uint32_t MaxReceivers, typename LockingPolicy>
+constexpr uint32_t ReceiverHandler<MaxReceivers, LockingPolicy>::MAX_HISTORY_CAPACITY;
+
 template <uint32_t MaxReceivers, typename LockingPolicy>
 inline ReceiverHandler<MaxReceivers, LockingPolicy>::AppContext::AppContext(ReceiverHandler_t& f_receiverHandler)
     : m_receiverHandler(f_receiverHandler)
@@ -34,6 +37,27 @@ inline void ReceiverHandler<MaxReceivers, LockingPolicy>::AppContext::deliverChu
     m_receiverHandler.deliverChunk(f_chunk);
 }
 
+template <uint32_t MaxReceivers, typename LockingPolicy>
+inline void ReceiverHandler<MaxReceivers, LockingPolicy>::AppContext::deliverChunks(const mepoo::SharedChunk* f_chunks,
+                                                                                    const uint32_t f_count)
+{
+    m_receiverHandler.deliverChunks(f_chunks, f_count);
+}
+
+template <uint32_t MaxReceivers, typename LockingPolicy>
+inline void ReceiverHandler<MaxReceivers, LockingPolicy>::AppContext::deliverChunkToSnapshot(
+    const ReceiverVector_t& f_receivers, const mepoo::SharedChunk f_chunk)
+{
+    m_receiverHandler.deliverChunkToSnapshot(f_receivers, f_chunk);
+}
+
+template <uint32_t MaxReceivers, typename LockingPolicy>
+inline void ReceiverHandler<MaxReceivers, LockingPolicy>::AppContext::deliverInline(const void* const f_payload,
+                                                                                    const uint32_t f_size)
+{
+    m_receiverHandler.deliverInline(f_payload, f_size);
+}
+
 template <uint32_t MaxReceivers, typename LockingPolicy>
 inline void ReceiverHandler<MaxReceivers, LockingPolicy>::AppContext::updateLastChunk(const mepoo::SharedChunk f_chunk)
 {
@@ -48,9 +72,10 @@ inline bool ReceiverHandler<MaxReceivers, LockingPolicy>::AppContext::hasReceive
 }
 
 template <uint32_t MaxReceivers, typename LockingPolicy>
-inline void ReceiverHandler<MaxReceivers, LockingPolicy>::AppContext::enableDoDeliverOnSubscription()
+inline void
+ReceiverHandler<MaxReceivers, LockingPolicy>::AppContext::enableDoDeliverOnSubscription(const uint32_t f_historyCapacity)
 {
-    m_receiverHandler.enableDoDeliverOnSubscription();
+    m_receiverHandler.enableDoDeliverOnSubscription(f_historyCapacity);
 }
 
 template <uint32_t MaxReceivers, typename LockingPolicy>
@@ -87,33 +112,291 @@ inline void ReceiverHandler<MaxReceivers, LockingPolicy>::RouDiContext::removeAl
 }
 
 template <uint32_t MaxReceivers, typename LockingPolicy>
-inline void ReceiverHandler<MaxReceivers, LockingPolicy>::deliverChunk(const mepoo::SharedChunk f_chunk)
+inline const typename ReceiverHandler<MaxReceivers, LockingPolicy>::ReceiverVector_t&
+ReceiverHandler<MaxReceivers, LockingPolicy>::acquireReceiverSnapshot(uint32_t& f_slot)
 {
-    lockGuard_t lock(*this);
-    /// @todo use this once the cxx vector has reverse interators
-    // std::for_each(m_receiverVector.rbegin(), m_receiverVector.rend(), [&](ReceiverPortData* receiverData) {
-    //     ReceiverPort(receiverData).deliver(f_chunk);
-    // });
+    while (true)
+    {
+        f_slot = m_activeReceiverVector.load(std::memory_order_acquire);
+        m_snapshotReaders[f_slot].fetch_add(1u, std::memory_order_acq_rel);
+        if (m_activeReceiverVector.load(std::memory_order_acquire) == f_slot)
+        {
+            return m_receiverVectors[f_slot];
+        }
+        // the active slot flipped in between, the registration went to a retired slot
+        m_snapshotReaders[f_slot].fetch_sub(1u, std::memory_order_release);
+    }
+}
+
+template <uint32_t MaxReceivers, typename LockingPolicy>
+inline void ReceiverHandler<MaxReceivers, LockingPolicy>::releaseReceiverSnapshot(const uint32_t f_slot)
+{
+    m_snapshotReaders[f_slot].fetch_sub(1u, std::memory_order_release);
+}
+
+template <uint32_t MaxReceivers, typename LockingPolicy>
+inline typename ReceiverHandler<MaxReceivers, LockingPolicy>::ReceiverVector_t&
+ReceiverHandler<MaxReceivers, LockingPolicy>::beginReceiverVectorUpdate()
+{
+    auto inactiveSlot = 1u - m_activeReceiverVector.load(std::memory_order_relaxed);
+    m_receiverVectors[inactiveSlot] = m_receiverVectors[1u - inactiveSlot];
+    return m_receiverVectors[inactiveSlot];
+}
+
+template <uint32_t MaxReceivers, typename LockingPolicy>
+inline void ReceiverHandler<MaxReceivers, LockingPolicy>::publishReceiverVectorUpdate()
+{
+    auto retiredSlot = m_activeReceiverVector.load(std::memory_order_relaxed);
+    m_activeReceiverVector.store(1u - retiredSlot, std::memory_order_release);
 
-    for (int64_t i = m_receiverVector.size() - 1; i >= 0; --i)
+    // grace period; afterwards the retired list is neither read by any delivery nor
+    // written to before the next update, which again runs under the lock
+    while (m_snapshotReaders[retiredSlot].load(std::memory_order_acquire) != 0u)
     {
-        ReceiverPortType(m_receiverVector[i]).deliver(f_chunk);
+        std::this_thread::yield();
     }
+}
+
+template <uint32_t MaxReceivers, typename LockingPolicy>
+inline void ReceiverHandler<MaxReceivers, LockingPolicy>::deliverChunk(const mepoo::SharedChunk f_chunk)
+{
+    // delivery iterates a snapshot of the receiver list instead of locking it, so a
+    // publisher cannot be blocked by RouDi doing subscribe/unsubscribe housekeeping
+    uint32_t l_slot{0u};
+    const ReceiverVector_t& l_receivers = acquireReceiverSnapshot(l_slot);
+
+    deliverToReceivers(l_receivers, f_chunk);
+
+    releaseReceiverSnapshot(l_slot);
 
     if (m_doDeliverOnSubscription.load(std::memory_order_relaxed))
     {
-        m_lastChunk = f_chunk;
+        // fields keep the lock for the history handshake with addNewReceiver
+        lockGuard_t lock(*this);
+        pushToHistory(f_chunk);
     }
 }
 
 template <uint32_t MaxReceivers, typename LockingPolicy>
-inline void ReceiverHandler<MaxReceivers, LockingPolicy>::updateLastChunk(const mepoo::SharedChunk f_chunk)
+inline void ReceiverHandler<MaxReceivers, LockingPolicy>::deliverChunkToSnapshot(const ReceiverVector_t& f_receivers,
+                                                                                 const mepoo::SharedChunk f_chunk)
 {
-    lockGuard_t lock(*this);
+    // real time publish mode: the caller pinned the list beforehand, so there is
+    // neither a snapshot acquisition to retry nor reader bookkeeping to maintain,
+    // and the fan-out stays on the publishing thread for a bound that does not
+    // depend on the fan-out workers
+    deliverToReceivers(f_receivers, f_chunk, true);
+}
+
+template <uint32_t MaxReceivers, typename LockingPolicy>
+inline typename ReceiverHandler<MaxReceivers, LockingPolicy>::ReceiverVector_t
+ReceiverHandler<MaxReceivers, LockingPolicy>::copyReceiverList()
+{
+    uint32_t l_slot{0u};
+    const ReceiverVector_t& l_receivers = acquireReceiverSnapshot(l_slot);
+    ReceiverVector_t l_copy(l_receivers);
+    releaseReceiverSnapshot(l_slot);
+    return l_copy;
+}
+
+template <uint32_t MaxReceivers, typename LockingPolicy>
+inline void ReceiverHandler<MaxReceivers, LockingPolicy>::deliverInline(const void* const f_payload,
+                                                                        const uint32_t f_size)
+{
+    uint32_t l_slot{0u};
+    const ReceiverVector_t& l_receivers = acquireReceiverSnapshot(l_slot);
+
+    // no references to add and no chunk info to filter on, the sample is copied
+    // into the delivery FiFo slot of every receiver
+    for (uint64_t i = 0u; i < l_receivers.size(); ++i)
+    {
+        ReceiverPortType(l_receivers[i]).deliverInline(f_payload, f_size);
+    }
+
+    releaseReceiverSnapshot(l_slot);
+}
+
+template <uint32_t MaxReceivers, typename LockingPolicy>
+inline void ReceiverHandler<MaxReceivers, LockingPolicy>::deliverToReceivers(const ReceiverVector_t& f_receivers,
+                                                                             const mepoo::SharedChunk& f_chunk,
+                                                                             const bool f_sequentialOnly)
+{
+    auto numberOfReceivers = f_receivers.size();
+    if (numberOfReceivers == 0u)
+    {
+        return;
+    }
+
+    // receivers whose filter rejects the chunk do not take part in the fan-out at
+    // all; counting the matching ones first keeps the single atomic add for the
+    // references, the extra pass is only a tag comparison per receiver
+    const mepoo::ChunkInfo& l_chunkInfo = f_chunk.getChunkHeader()->m_info;
+    uint32_t l_matchingReceivers{0u};
+    for (uint64_t i = 0u; i < numberOfReceivers; ++i)
+    {
+        if (ReceiverPortType(f_receivers[i]).wantsChunk(l_chunkInfo))
+        {
+            l_matchingReceivers++;
+        }
+    }
+
+    if (l_matchingReceivers > 0u)
+    {
+        // add all references for the fan-out with a single atomic add instead of one
+        // read-modify-write per receiver; every receiver claims one of them, also in
+        // the non-subscribed case where the claimed reference is dropped again
+        f_chunk.addReferences(l_matchingReceivers);
+        if (!f_sequentialOnly && numberOfReceivers >= FanOutPool::PARALLEL_FANOUT_THRESHOLD)
+        {
+            // very wide fan-out: split the receiver range across the workers of the
+            // process so the per-receiver push and wakeup cost is not charged to the
+            // publishing thread alone; claiming a pre-added reference does not touch
+            // the reference counter and every receiver is handled by exactly one
+            // thread, so the ranges need no synchronization among each other
+            struct RangeContext
+            {
+                const ReceiverVector_t* m_receivers;
+                const mepoo::SharedChunk* m_chunk;
+                const mepoo::ChunkInfo* m_chunkInfo;
+            } l_context{&f_receivers, &f_chunk, &l_chunkInfo};
+
+            FanOutPool::get().runPartitioned(
+                [](void* f_context, const uint32_t f_begin, const uint32_t f_end) {
+                    auto& l_range = *static_cast<RangeContext*>(f_context);
+                    for (uint32_t i = f_begin; i < f_end; ++i)
+                    {
+                        ReceiverPortType l_port((*l_range.m_receivers)[i]);
+                        if (l_port.wantsChunk(*l_range.m_chunkInfo))
+                        {
+                            l_port.deliver(l_range.m_chunk->claimAddedReference());
+                        }
+                    }
+                },
+                &l_context,
+                static_cast<uint32_t>(numberOfReceivers));
+        }
+        else
+        {
+            for (int64_t i = numberOfReceivers - 1; i >= 0; --i)
+            {
+                ReceiverPortType l_port(f_receivers[i]);
+                if (l_port.wantsChunk(l_chunkInfo))
+                {
+                    l_port.deliver(f_chunk.claimAddedReference());
+                }
+            }
+        }
+    }
+}
+
+template <uint32_t MaxReceivers, typename LockingPolicy>
+inline void ReceiverHandler<MaxReceivers, LockingPolicy>::deliverChunks(const mepoo::SharedChunk* f_chunks,
+                                                                        const uint32_t f_count)
+{
+    uint32_t l_slot{0u};
+    const ReceiverVector_t& l_receivers = acquireReceiverSnapshot(l_slot);
+
+    auto numberOfReceivers = l_receivers.size();
+    bool l_anyFilterActive{false};
+    for (uint64_t i = 0u; i < numberOfReceivers; ++i)
+    {
+        if (ReceiverPortType(l_receivers[i]).hasChunkFilter())
+        {
+            l_anyFilterActive = true;
+            break;
+        }
+    }
 
+    if (l_anyFilterActive && f_count > 0u)
+    {
+        // with mixed filters the per-batch reference accounting below does not hold
+        // anymore, so the chunks are fanned out one by one with filter evaluation
+        for (uint32_t i = 0u; i < f_count; ++i)
+        {
+            deliverToReceivers(l_receivers, f_chunks[i]);
+        }
+    }
+    else if (numberOfReceivers > 0 && f_count > 0u)
+    {
+        for (uint32_t i = 0u; i < f_count; ++i)
+        {
+            f_chunks[i].addReferences(static_cast<uint32_t>(numberOfReceivers));
+        }
+
+        struct BatchRangeContext
+        {
+            const ReceiverVector_t* m_receivers;
+            const mepoo::SharedChunk* m_chunks;
+            uint32_t m_count;
+        } l_context{&l_receivers, f_chunks, f_count};
+
+        // the claimed references are handed over in slices to bound the stack usage
+        auto l_deliverRange = [](void* f_context, const uint32_t f_begin, const uint32_t f_end) {
+            auto& l_range = *static_cast<BatchRangeContext*>(f_context);
+            constexpr uint32_t SliceCapacity{32u};
+            for (uint32_t i = f_begin; i < f_end; ++i)
+            {
+                ReceiverPortType l_port((*l_range.m_receivers)[i]);
+                for (uint32_t offset = 0u; offset < l_range.m_count; offset += SliceCapacity)
+                {
+                    mepoo::SharedChunk l_claimed[SliceCapacity];
+                    uint32_t l_sliceSize = std::min(SliceCapacity, l_range.m_count - offset);
+                    for (uint32_t k = 0u; k < l_sliceSize; ++k)
+                    {
+                        l_claimed[k] = l_range.m_chunks[offset + k].claimAddedReference();
+                    }
+                    // an unsubscribed receiver drops the claimed references on destruction
+                    l_port.deliverBatch(l_claimed, l_sliceSize);
+                }
+            }
+        };
+
+        if (numberOfReceivers >= FanOutPool::PARALLEL_FANOUT_THRESHOLD)
+        {
+            // wide fan-out, split the receiver range across the workers of the
+            // process, see deliverToReceivers
+            FanOutPool::get().runPartitioned(l_deliverRange, &l_context, static_cast<uint32_t>(numberOfReceivers));
+        }
+        else
+        {
+            l_deliverRange(&l_context, 0u, static_cast<uint32_t>(numberOfReceivers));
+        }
+    }
+
+    releaseReceiverSnapshot(l_slot);
+
+    if (f_count > 0u && m_doDeliverOnSubscription.load(std::memory_order_relaxed))
+    {
+        lockGuard_t lock(*this);
+        for (uint32_t i = 0u; i < f_count; ++i)
+        {
+            pushToHistory(f_chunks[i]);
+        }
+    }
+}
+
+template <uint32_t MaxReceivers, typename LockingPolicy>
+inline void ReceiverHandler<MaxReceivers, LockingPolicy>::updateLastChunk(const mepoo::SharedChunk f_chunk)
+{
+    // topics which never enable deliverOnSubscription keep no history and pay
+    // only the relaxed load here, the lock is for the history handshake only
     if (m_doDeliverOnSubscription.load(std::memory_order_relaxed))
     {
-        m_lastChunk = f_chunk;
+        lockGuard_t lock(*this);
+        pushToHistory(f_chunk);
+    }
+}
+
+template <uint32_t MaxReceivers, typename LockingPolicy>
+inline void ReceiverHandler<MaxReceivers, LockingPolicy>::pushToHistory(const mepoo::SharedChunk& f_chunk)
+{
+    // overwriting the oldest entry drops its reference, so no more than
+    // m_historyCapacity chunks are ever pinned by the history
+    m_history[m_historyNext] = f_chunk;
+    m_historyNext = (m_historyNext + 1u) % m_historyCapacity;
+    if (m_historySize < m_historyCapacity)
+    {
+        m_historySize++;
     }
 }
 
@@ -121,14 +404,16 @@ template <uint32_t MaxReceivers, typename LockingPolicy>
 inline bool ReceiverHandler<MaxReceivers, LockingPolicy>::hasLastChunk()
 {
     lockGuard_t lock(*this);
-    return m_lastChunk != nullptr;
+    return m_historySize > 0u;
 }
 
 template <uint32_t MaxReceivers, typename LockingPolicy>
 inline bool ReceiverHandler<MaxReceivers, LockingPolicy>::hasReceivers()
 {
-    lockGuard_t lock(*this);
-    return !m_receiverVector.empty();
+    uint32_t l_slot{0u};
+    bool l_hasReceivers = !acquireReceiverSnapshot(l_slot).empty();
+    releaseReceiverSnapshot(l_slot);
+    return l_hasReceivers;
 }
 
 template <uint32_t MaxReceivers, typename LockingPolicy>
@@ -136,23 +421,32 @@ inline bool
 ReceiverHandler<MaxReceivers, LockingPolicy>::addNewReceiver(ReceiverPortType::MemberType_t* const f_receiver)
 {
     lockGuard_t lock(*this);
+    ReceiverVector_t& l_receiverVector = beginReceiverVectorUpdate();
     auto l_alreadyKnownReceiver =
-        std::find_if(m_receiverVector.begin(), m_receiverVector.end(), [&](ReceiverPortType::MemberType_t* receiver) {
+        std::find_if(l_receiverVector.begin(), l_receiverVector.end(), [&](ReceiverPortType::MemberType_t* receiver) {
             return receiver == f_receiver;
         });
 
     // check if the receiver port is not yet subscribed
-    if (l_alreadyKnownReceiver == m_receiverVector.end())
+    if (l_alreadyKnownReceiver == l_receiverVector.end())
     {
-        if (m_receiverVector.size() < m_receiverVector.capacity())
+        if (l_receiverVector.size() < l_receiverVector.capacity())
         {
-            m_receiverVector.push_back(f_receiver);
+            l_receiverVector.push_back(f_receiver);
+            publishReceiverVectorUpdate();
 
             if (m_doDeliverOnSubscription.load(std::memory_order_relaxed))
             {
-                if (m_lastChunk != nullptr)
+                if (m_historySize > 0u)
                 {
-                    ReceiverPortType(f_receiver).deliver(m_lastChunk);
+                    // replay oldest first so the new receiver pops the history
+                    // in send order
+                    ReceiverPortType l_port(f_receiver);
+                    for (uint32_t i = 0u; i < m_historySize; ++i)
+                    {
+                        auto l_index = (m_historyNext + m_historyCapacity - m_historySize + i) % m_historyCapacity;
+                        l_port.deliver(m_history[l_index]);
+                    }
                 }
                 else
                 {
@@ -176,10 +470,13 @@ inline void
 ReceiverHandler<MaxReceivers, LockingPolicy>::removeReceiver(ReceiverPortType::MemberType_t* const f_receiver)
 {
     lockGuard_t lock(*this);
-    auto l_iter = std::find(m_receiverVector.begin(), m_receiverVector.end(), f_receiver);
-    if (l_iter != m_receiverVector.end())
+    ReceiverVector_t& l_receiverVector = beginReceiverVectorUpdate();
+    auto l_iter = std::find(l_receiverVector.begin(), l_receiverVector.end(), f_receiver);
+    if (l_iter != l_receiverVector.end())
     {
-        m_receiverVector.erase(l_iter);
+        l_receiverVector.erase(l_iter);
+        // when this returns no delivery references the removed receiver anymore
+        publishReceiverVectorUpdate();
     }
 }
 
@@ -187,12 +484,30 @@ template <uint32_t MaxReceivers, typename LockingPolicy>
 inline void ReceiverHandler<MaxReceivers, LockingPolicy>::removeAll()
 {
     lockGuard_t lock(*this);
-    m_receiverVector.clear();
+    beginReceiverVectorUpdate().clear();
+    publishReceiverVectorUpdate();
 }
 
 template <uint32_t MaxReceivers, typename LockingPolicy>
-inline void ReceiverHandler<MaxReceivers, LockingPolicy>::enableDoDeliverOnSubscription()
+inline void
+ReceiverHandler<MaxReceivers, LockingPolicy>::enableDoDeliverOnSubscription(const uint32_t f_historyCapacity)
 {
+    lockGuard_t lock(*this);
+
+    auto l_historyCapacity = std::max(1u, std::min(f_historyCapacity, MAX_HISTORY_CAPACITY));
+    if (l_historyCapacity != m_historyCapacity)
+    {
+        // changing the capacity invalidates the ring indices, restart with an
+        // empty history and release the pinned chunks
+        for (uint32_t i = 0u; i < MAX_HISTORY_CAPACITY; ++i)
+        {
+            m_history[i] = nullptr;
+        }
+        m_historyCapacity = l_historyCapacity;
+        m_historySize = 0u;
+        m_historyNext = 0u;
+    }
+
     m_doDeliverOnSubscription.store(true, std::memory_order_relaxed);
 }
 
@@ -206,7 +521,7 @@ template <uint32_t MaxReceivers, typename LockingPolicy>
 inline typename ReceiverHandler<MaxReceivers, LockingPolicy>::ReceiverVector_t&
 ReceiverHandler<MaxReceivers, LockingPolicy>::getReceiverList() noexcept
 {
-    return m_receiverVector;
+    return m_receiverVectors[m_activeReceiverVector.load(std::memory_order_acquire)];
 }
 
 template <uint32_t MaxReceivers, typename LockingPolicy>
@@ -216,7 +531,8 @@ inline uint32_t ReceiverHandler<MaxReceivers, LockingPolicy>::getMaxDeliveryFiFo
 
     uint64_t maxDeliveryFiFoCapacity = 0;
 
-    for (auto receiver : m_receiverVector)
+    // the lock excludes concurrent updates, the active list is never mutated in place
+    for (auto receiver : getReceiverList())
     {
         ReceiverPort port(receiver);
         auto deliveryFiFoCapacity = port.getDeliveryFiFoCapacity();
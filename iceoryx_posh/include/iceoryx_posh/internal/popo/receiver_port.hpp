@@ -52,7 +52,10 @@ class ReceiverPort : public BasePort
 
     cxx::optional<capro::CaproMessage> getCaProMessage();
 
-    cxx::optional<capro::CaproMessage> dispatchCaProMessage(capro::CaproMessage f_caProMessage);
+    /// the message is taken by reference since RouDi dispatches the same message
+    /// to many candidate ports and a by-value pass would copy the contained
+    /// service description for each of them
+    cxx::optional<capro::CaproMessage> dispatchCaProMessage(const capro::CaproMessage& f_caProMessage);
 
     virtual void cleanup() noexcept;
 
@@ -65,35 +68,216 @@ class ReceiverPort : public BasePort
     void subscribe(const uint32_t f_deliverySize = MAX_RECEIVER_QUEUE_SIZE);
     void unsubscribe();
     bool isSubscribed() const;
+
+    /// Requests a deadline QoS together with the subscription; the deadline
+    /// monitor of RouDi arms the tracking when the subscription is processed
+    /// and counts a miss whenever no chunk was delivered within the deadline.
+    /// The delivery hot path pays a single relaxed store for the tracking
+    /// @param [in] f_deadlineNs maximum time between two deliveries in
+    ///             nanoseconds, 0 disables the deadline QoS
+    /// @param [in] f_deliverySize Size of the receiver queue
+    void subscribeWithDeadline(const uint64_t f_deadlineNs, const uint32_t f_deliverySize = MAX_RECEIVER_QUEUE_SIZE);
+
+    /// Requests credit based flow control together with the subscription: while
+    /// f_chunkBudget chunks are in flight at this port (waiting in the delivery
+    /// FiFo or held by the application) the sender skips further deliveries to
+    /// this port instead of pinning more chunks of the shared mempool, so a
+    /// stalled receiver degrades only itself. Skipped deliveries are counted
+    /// @param [in] f_chunkBudget maximum chunks in flight, 0 disables the flow control
+    /// @param [in] f_deliverySize Size of the receiver queue
+    void subscribeWithChunkBudget(const uint32_t f_chunkBudget,
+                                  const uint32_t f_deliverySize = MAX_RECEIVER_QUEUE_SIZE);
+
+    /// @return chunk budget requested with subscribeWithChunkBudget, 0 when none is set
+    uint32_t getChunkBudget() const;
+
+    /// @return number of deliveries the sender skipped because this port had its
+    ///         whole chunk budget in flight
+    uint64_t getCreditSkipCount() const;
+
+    /// Evaluates the credit of this port, called by the sender on delivery
+    /// @return true if the port may take another chunk
+    bool hasDeliveryCredit() const;
+
+    /// @return deadline requested with subscribeWithDeadline, 0 when none is set
+    uint64_t getDeadlineNs() const;
+
+    /// @return number of deadline misses counted by the deadline monitor since
+    ///         the subscription
+    uint64_t getDeadlineMissCount() const;
+
+    /// Registers a chunk filter for this port; only chunks whose
+    /// ChunkInfo::m_filterTag satisfies (tag & f_mask) == f_value are delivered,
+    /// non-matching chunks are skipped at the sender without any FiFo push,
+    /// reference counting or wakeup for this port. Meant to be set around
+    /// subscribe, before the first matching chunks are expected
+    /// @param [in] f_mask mask applied to the filter tag of a delivered chunk
+    /// @param [in] f_value expected value of the masked filter tag
+    void setChunkFilter(const uint16_t f_mask, const uint16_t f_value);
+
+    /// Removes the chunk filter, all chunks are delivered again
+    void clearChunkFilter();
+
+    /// Enables verification of the CRC32C the sender stamps into the chunk
+    /// header when its integrity mode is enabled; corrupted chunks are dropped
+    /// by getChunk with an error log instead of being handed to the
+    /// application. Chunks without a stamped checksum pass unverified, so the
+    /// check can be enabled independently of the sender configuration
+    /// @param [in] f_enabled true to verify the payload checksum on fetch
+    void setIntegrityCheckEnabled(const bool f_enabled);
+
+    /// Declares that all chunks of this port are fetched and released from a
+    /// single application thread and that RouDi only synchronizes with the
+    /// port via the CaPro message exchange; the per operation synchronizer
+    /// release of the delivered chunk bookkeeping is then skipped on every
+    /// fetch and release. Irreversible
+    void declareSingleWriter();
+
+    /// @return true if a chunk filter is registered on this port
+    bool hasChunkFilter() const;
+
+    /// Evaluates the chunk filter of this port, called by the sender on delivery
+    /// @param [in] f_chunkInfo chunk info holding the filter tag to check
+    /// @return true if the chunk has to be delivered to this port
+    bool wantsChunk(const mepoo::ChunkInfo& f_chunkInfo) const;
     SubscribeState getSubscribeState() const;
 
+    /// opaque handle of the slot a fetched chunk occupies in the delivered chunk
+    /// list; releasing with the handle unlinks the slot directly instead of
+    /// searching the list
+    using ChunkSlotHandle = MemberType_t::ChunkSlotHandle;
+
     // (only) from delivery FiFo to Cache
     virtual bool getChunk(const mepoo::ChunkHeader*& f_chunkHeader) noexcept;
+
+    /// Like getChunk, but additionally hands out the slot handle of the chunk in
+    /// the delivered chunk list; passing it to releaseChunk makes the release O(1)
+    /// for receivers which keep many chunks in flight
+    /// @param [out] f_chunkHeader chunk header of the fetched chunk
+    /// @param [out] f_slotHandle slot handle to pass to releaseChunk
+    /// @return true if a chunk was fetched
+    virtual bool getChunk(const mepoo::ChunkHeader*& f_chunkHeader, ChunkSlotHandle& f_slotHandle) noexcept;
+
+    /// Drains the delivery FiFo in one pass; the popped chunks are registered in the
+    /// delivered chunk list batch-wise instead of one insert per chunk, every returned
+    /// chunk has to be released via releaseChunk as usual
+    /// @param [out] f_chunkHeaders array with space for f_maxCount chunk headers
+    /// @param [in] f_maxCount maximum number of chunks to fetch
+    /// @return number of valid entries written to f_chunkHeaders
+    virtual uint32_t getChunks(const mepoo::ChunkHeader** f_chunkHeaders, const uint32_t f_maxCount) noexcept;
     bool releaseChunk(const mepoo::ChunkHeader* f_chunkHeader);
 
+    /// Releases a chunk via the slot handle obtained from getChunk; the slot is
+    /// unlinked directly, falling back to the linear search when the handle does
+    /// not match the chunk anymore
+    /// @param [in] f_chunkHeader chunk header of the chunk to release
+    /// @param [in] f_slotHandle slot handle returned by getChunk
+    /// @return true if the chunk was released
+    bool releaseChunk(const mepoo::ChunkHeader* f_chunkHeader, const ChunkSlotHandle f_slotHandle);
+
     bool getSharedChunk(mepoo::SharedChunk& f_chunk);
     virtual bool newData() noexcept;
     void clearDeliveryFiFo();
 
+    /// Pre-touches the bookkeeping of this port: the delivery FiFo slots and
+    /// the delivered chunk list all live inline in the port data, so walking
+    /// it once takes the page faults and cache misses before the first real
+    /// chunk arrives instead of on its fetch path. Meant to be called once
+    /// around subscribe
+    void warmup();
+
     /* expects an initialized POSIX semaphore, stored in shared memory! */
     virtual void SetCallbackReferences(posix::Semaphore* f_callbackSemaphore,
                                        std::atomic<ChunksCounterType>* f_sendChunksCounter = 0) noexcept;
     virtual void UnsetCallbackReferences() noexcept;
 
+    /// Activates the futex based wakeup backend instead of the semaphore; the sender
+    /// then signals new chunks via the futex word in the port data, which costs no
+    /// syscall as long as the receiver is not parked in FutexSignal::wait
+    virtual void SetFutexCallbackReference() noexcept;
+
+    // the futex word stored in shared memory, to wait on with the futex backend
+    posix::FutexSignal* GetShmFutexSignal();
+
     bool AreCallbackReferencesSet();
 
+    /// Clears the coalesced notification flag after a semaphore post was consumed;
+    /// the next delivered chunk triggers a post again. Has to be called by the
+    /// receiver side wait primitives, which then drain the delivery FiFo until it
+    /// is empty since a single post may cover a whole burst
+    void clearPendingNotification() noexcept;
+
     // offer a 'local' semaphore, stored in shared memory, that can be used with
     // 'SetReceiveSemaphore(sem_t*)'
     posix::Semaphore* GetShmSemaphore();
 
     virtual bool deliver(mepoo::SharedChunk f_chunk_p) noexcept;
 
+    /// Delivers a batch of chunks; the subscription check and the wakeup of a
+    /// registered chunk send callback are paid once for the whole batch, so the
+    /// callback has to drain the delivery FiFo when it is triggered
+    /// @param [in] f_chunks array of f_count chunks which are consumed on delivery
+    /// @param [in] f_count number of chunks
+    /// @return true if the chunks were delivered, false if not subscribed
+    virtual bool deliverBatch(mepoo::SharedChunk* f_chunks, const uint32_t f_count) noexcept;
+
+    /// Delivers a small sample by value, embedded directly in the delivery FiFo
+    /// slot with no mempool chunk involved; called by the sender. A topic
+    /// delivered inline has to be fetched with getInlineSample, chunk filters and
+    /// the field history do not apply since there is no chunk info
+    /// @param [in] f_payload sample to embed, consumed by copy
+    /// @param [in] f_size size of the sample, at most
+    ///             DeliveryFiFo::ChunkManagementTransport::INLINE_PAYLOAD_CAPACITY
+    /// @return true if the sample was delivered, false if not subscribed
+    virtual bool deliverInline(const void* const f_payload, const uint32_t f_size) noexcept;
+
+    /// Fetches a sample delivered with deliverInline
+    /// @param [out] f_payload buffer with space for INLINE_PAYLOAD_CAPACITY bytes
+    /// @param [out] f_size size of the fetched sample
+    /// @return true if a sample was fetched
+    bool getInlineSample(void* const f_payload, uint32_t& f_size) noexcept;
+
     bool isInternal() const;
 
     uint64_t getDeliveryFiFoCapacity() const;
     uint64_t getDeliveryFiFoSize() const;
 
+    /// Configures how the sender behaves when the delivery FiFo of this port is
+    /// full: overwrite the oldest chunk (default), discard the incoming one or
+    /// block up to a timeout before discarding
+    /// @param [in] f_policy overflow policy to apply
+    /// @param [in] f_timeoutMs wait budget for BLOCK_WITH_TIMEOUT, ignored otherwise
+    void setOverflowPolicy(const DeliveryFiFo::OverflowPolicy f_policy, const uint32_t f_timeoutMs = 0u);
+
+    /// @return number of chunks this port lost to FiFo overflow since creation
+    uint64_t getDropCount() const;
+
+    /// @return sequence number of the most recently lost chunk; only meaningful
+    ///         when getDropCount() is greater than 0
+    uint64_t getLastDroppedSequenceNumber() const;
+
+    /// @return number of read index conflicts of the delivery FiFo since creation,
+    ///         i.e. how often the sender overflowed while this port was reading
+    uint64_t getDeliveryFiFoIndexConflicts() const;
+
+    /// Enables end-to-end latency tracking for this port; every fetched chunk then
+    /// records now minus the tx timestamp of its ChunkInfo into a histogram in the
+    /// port data, which is published via the port introspection. Requires throughput
+    /// tracking on the sender side since only then the tx timestamp is written into
+    /// the chunk; chunks without a tx timestamp are not recorded
+    /// @param [in] f_enable true enables the latency tracking
+    void setLatencyTrackingEnabled(const bool f_enable);
+
+    /// @return the latency histogram of this port; empty as long as latency
+    ///         tracking was never enabled
+    const LatencyHistogram& getLatencyHistogram() const;
+
   private:
+    /// wakes a registered chunk send callback, coalescing the semaphore posts
+    void notifyChunkSendCallback() noexcept;
+    void recordLatency(const mepoo::ChunkHeader* f_chunkHeader) noexcept;
+    bool verifyIntegrity(const mepoo::ChunkHeader* const f_chunkHeader) const noexcept;
+
     const MemberType_t* getMembers() const;
     MemberType_t* getMembers();
 };
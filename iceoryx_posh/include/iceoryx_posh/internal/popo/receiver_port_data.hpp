@@ -18,10 +18,12 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/popo/delivery_fifo.hpp"
+#include "iceoryx_posh/internal/popo/latency_histogram.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/mutex.hpp"
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
+#include "iceoryx_utils/posix_wrapper/futex_signal.hpp"
 #include "iceoryx_utils/posix_wrapper/semaphore.hpp"
 
 namespace iox
@@ -46,12 +48,67 @@ struct ReceiverPortData : public BasePortData
     DeliveryFiFo m_deliveryFiFo;
     static constexpr uint32_t DELIVERED_LIST_SIZE = 2 * MAX_RECEIVER_QUEUE_SIZE;
     UsedChunkList<DELIVERED_LIST_SIZE> m_deliveredChunkList;
+    using ChunkSlotHandle = UsedChunkList<DELIVERED_LIST_SIZE>::SlotHandle;
+
+    // sender side chunk filter; when active, a chunk is only delivered to this port
+    // if (ChunkInfo::m_filterTag & m_filterMask) == m_filterValue holds, otherwise
+    // the sender skips the port before any reference counting or FiFo push is done.
+    // Written by application, read by the sending application
+    std::atomic_bool m_filterActive{false};
+    std::atomic<uint16_t> m_filterMask{0u};
+    std::atomic<uint16_t> m_filterValue{0u};
+
+    // credit based flow control (opt-in); the receiver advertises a chunk budget
+    // with subscribe and the sender skips deliveries while budget chunks are in
+    // flight at this port (waiting in the delivery FiFo or held by the
+    // application), so a stalled receiver starves only itself instead of pinning
+    // the whole shared mempool.
+    // Written by application, read by the sending application
+    std::atomic<uint32_t> m_chunkBudget{0u};
+    // chunks currently held by the application in the delivered chunk list
+    // Written by application, read by the sending application
+    std::atomic<uint32_t> m_heldChunkCount{0u};
+    // deliveries skipped because this port was out of credit
+    // Written by the sending application, read by application
+    std::atomic<uint64_t> m_creditSkipCount{0u};
+
+    // deadline QoS (opt-in); the deadline is requested by the application with
+    // subscribe and the tracking is armed by the deadline monitor of RouDi. The
+    // delivery hot path only pays one relaxed store of the ChunkInfo timestamp
+    // Written by application, read by RouDi
+    std::atomic<uint64_t> m_deadlineNs{0u};
+    // Written by the sending application on delivery, read by RouDi
+    std::atomic<uint64_t> m_lastDeliveryTimestampNs{0u};
+    // Written by RouDi, read by application
+    std::atomic<uint64_t> m_deadlineMissCount{0u};
+
+    // integrity check (opt-in); when active getChunk verifies the CRC32C the
+    // sender stamped into the chunk header and drops corrupted chunks.
+    // Written by application, read by application
+    std::atomic_bool m_verifyIntegrity{false};
+
+    // receiver side end-to-end latency tracking (opt-in); the histogram is written
+    // on the sample fetch path of the application and read by the RouDi
+    // introspection. Written by application, read by application and RouDi
+    std::atomic_bool m_latencyTrackingActive{false};
+    LatencyHistogram m_latencyHistogram;
 
     // event callback related
     mutable std::atomic_bool m_chunkSendCallbackActive{false};
     mutable cxx::optional<mutex_t> m_chunkSendCallbackMutex = mutex_t::CreateMutex(false);
     iox::relative_ptr<posix::Semaphore> m_chunkSendSemaphore{nullptr};
 
+    // coalesces the semaphore wakeups for bursty delivery: set by the sender
+    // together with the post, cleared by the receiver when the post was consumed;
+    // deliveries while it is set skip the post and the receiver side drains the
+    // delivery FiFo until it is empty, so a burst costs a single syscall
+    mutable std::atomic_bool m_notificationPending{false};
+
+    // alternative wakeup backend with an uncontended userspace fast path,
+    // activated via SetFutexCallbackReference instead of SetCallbackReferences
+    mutable std::atomic_bool m_chunkSendFutexActive{false};
+    posix::FutexSignal m_shmFutexSignal;
+
     // offer semaphore that is stored in shared memory
     sem_t m_shmSemaphoreHandle;
     posix::Semaphore::result_t m_shmSemaphore = posix::Semaphore::create();
@@ -37,18 +37,155 @@ class SenderPort : public BasePort
 
     cxx::optional<capro::CaproMessage> getCaProMessage();
 
-    cxx::optional<capro::CaproMessage> dispatchCaProMessage(capro::CaproMessage caProMessage);
+    /// the message is taken by reference since RouDi dispatches the same message
+    /// to many candidate ports and a by-value pass would copy the contained
+    /// service description for each of them
+    cxx::optional<capro::CaproMessage> dispatchCaProMessage(const capro::CaproMessage& caProMessage);
 
     void cleanup();
     mepoo::ChunkHeader* reserveChunk(const uint32_t payloadSize, bool useDynamicPayloadSizes = false);
+    /// Compile time fixed size variant of reserveChunk() for topics whose payload
+    /// size is known at build time. The size is a constant through the whole
+    /// reservation so the runtime size handling and the dynamic size branch fold
+    /// away, and the serving mempool is resolved once per port instead of being
+    /// searched per sample
+    /// @return chunk header of the reserved chunk, nullptr on failure
+    template <uint32_t PayloadSize>
+    mepoo::ChunkHeader* reserveChunk()
+    {
+        static_assert(PayloadSize > 0u, "a fixed size topic must have a non zero payload size");
+        return reserveChunkFixedSize(PayloadSize);
+    }
+    /// Runtime entry of the fixed size reservation path, used by the typed front
+    /// ends where the payload size is the sizeof of the topic type
+    /// @param [in] payloadSize payload size of the topic, must not change between calls
+    /// @return chunk header of the reserved chunk, nullptr on failure
+    mepoo::ChunkHeader* reserveChunkFixedSize(const uint32_t payloadSize);
+    /// Loans the last delivered chunk back for writing when no receiver holds a
+    /// reference to it anymore; payload size and content stay untouched, so a large
+    /// sample can be updated in place without a new allocation and a full copy
+    /// @return chunk header of the previous chunk, nullptr when it is still in use
+    /// or there is no previous chunk
+    mepoo::ChunkHeader* loanPreviousChunk();
     virtual void deliverChunk(mepoo::ChunkHeader* const chunkHeader);
+    /// Delivers a batch of previously reserved chunks in one call; the receiver list
+    /// traversal and the per-receiver wakeup are amortized over the whole batch
+    /// @param [in] chunkHeaders array of count chunks to deliver in order
+    /// @param [in] count number of chunks
+    virtual void deliverChunks(mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t count);
+    /// Delivers a small sample by value, embedded directly in the delivery FiFo
+    /// slots of the subscribed receivers; no mempool chunk is reserved, referenced
+    /// or released, which roughly halves the per sample cost for tiny topics. The
+    /// sample has to be fetched with ReceiverPort::getInlineSample; chunk filters,
+    /// the field history and the throughput introspection do not apply since there
+    /// is no chunk
+    /// @param [in] payload sample to embed, consumed by copy
+    /// @param [in] size size of the sample, at most
+    ///             DeliveryFiFo::ChunkManagementTransport::INLINE_PAYLOAD_CAPACITY
+    /// @return true when delivered, false when the port is not offered or the
+    /// sample does not fit inline
+    bool deliverInline(const void* const payload, const uint32_t size);
+    /// Links two reserved chunks into a composite sample spanning several pool
+    /// chunks (scatter-gather); only the head is delivered, receivers follow the
+    /// chain via ChunkHeader::nextChunk(). The reference on the appended chunk is
+    /// owned by the chain and released together with the head chunk
+    /// @param [in] chunkHeader chunk the next one is appended to
+    /// @param [in] nextChunkHeader chunk to append, must be reserved and not sent
+    /// @return true on success, false when a chunk does not belong to this port,
+    /// chunkHeader already has a successor or the compact chunk header without
+    /// chaining support is configured
+    bool chainChunks(mepoo::ChunkHeader* const chunkHeader, mepoo::ChunkHeader* const nextChunkHeader);
     void freeChunk(mepoo::ChunkHeader* const chunkHeader);
+    /// Pre-warms the reservation path of this port: the port bookkeeping is
+    /// touched and the full allocation window is reserved from the mempool and
+    /// handed back immediately. The free-list path, the ChunkManagement
+    /// entries, the allocated chunk slots and the chunk memory itself are then
+    /// cache- and TLB-warm when the first real sample is reserved, so it
+    /// performs like a steady state one. Meant to be called once before the
+    /// time critical phase, e.g. together with activate()
+    /// @param [in] payloadSize payload size the real samples will have
+    void warmup(const uint32_t payloadSize);
     void activate();
     void deactivate();
     bool hasSubscribers();
     void forwardChunk(mepoo::SharedChunk chunk);
     MemberType_t::Throughput getThroughput() const;
-    void enableDoDeliverOnSubscription();
+    /// snapshot of the histogram of requested payload sizes and the byte sums
+    /// of requested payloads and granted chunks, recorded with every chunk
+    /// reservation; a granted to requested ratio far above one means the
+    /// topic allocates from an oversized mempool
+    MemberType_t::ChunkSizeStatistics getChunkSizeStatistics() const;
+    /// Bounds the number of chunks this port may pin from its segment at a
+    /// time, so one misbehaving publisher cannot drain the mempools of a
+    /// segment shared with other applications. When the quota is reached a
+    /// reservation fails like on an exhausted mempool until chunks return to
+    /// the pool; counted with relaxed atomics, a concurrent reservation burst
+    /// may overshoot the limit slightly. 0 (default) disables the quota
+    /// @param [in] limit maximum number of concurrently pinned chunks
+    void setChunkQuotaLimit(const uint32_t limit);
+    /// snapshot of the quota limit, usage and the denied reservations,
+    /// published with the throughput introspection
+    MemberType_t::ChunkQuotaStatistics getChunkQuotaStatistics() const;
+    /// Enables or disables the per delivery timestamping and throughput bookkeeping;
+    /// disabling removes the clock read and the exchange store from every delivery,
+    /// meant for topics where nobody consumes the throughput introspection which
+    /// then keeps reporting the values from before disabling
+    void setThroughputTrackingEnabled(const bool enabled);
+    /// Selects the clock the tx timestamp of delivered chunks is taken from, so
+    /// deployments choose between stamp precision and cost: TSC for the cheapest
+    /// local stamp, MONOTONIC_RAW for slew free latency accounting, PTP for
+    /// stamps comparable across ECUs. The source is stamped into the chunk info
+    /// together with the timestamp; the throughput bookkeeping of the
+    /// introspection stays on the local monotonic clock regardless
+    /// @param [in] source timestamp source for the tx timestamps of this port
+    void setTimestampSource(const mepoo::TimestampSource source);
+    mepoo::TimestampSource getTimestampSource() const;
+    /// Allows reserving and delivering chunks from several application threads on
+    /// this port without external locking. Allocation and release are lock-free,
+    /// the delivery fan-out itself is briefly serialized internally since the
+    /// delivery FiFos are single producer. Enabling also disables the single
+    /// producer only chunk reuse optimizations (last chunk, recycle stash)
+    /// @param [in] enabled true for multi threaded publishing, false (default)
+    /// for the single threaded fast path
+    void setConcurrentDeliveryEnabled(const bool enabled);
+    /// The opposite declaration of setConcurrentDeliveryEnabled: the application
+    /// promises that all calls on this port come from a single thread, RouDi
+    /// only synchronizes with the port via the CaPro message exchange. The slot
+    /// claiming CAS of the allocated chunk bookkeeping is then downgraded to
+    /// relaxed loads and stores on every reserve and deliver. Irreversible;
+    /// ignored when concurrent delivery was enabled before
+    void declareSingleWriter();
+    /// Enables the real time publish mode: deliverChunk fans out to a receiver
+    /// snapshot pinned at the last syncReceiverSnapshot() instead of acquiring
+    /// the current receiver list, and a wide fan-out stays on the publishing
+    /// thread instead of being handed to the fan-out workers. A publish is then
+    /// one filter pass over the pinned receivers, a single reference add and one
+    /// delivery FiFo push plus at most one wakeup post per receiver - no locks
+    /// and no retry loops, so the worst case is bounded by the pinned receiver
+    /// count. In exchange subscription changes only take effect at the next
+    /// syncReceiverSnapshot(), which has to be called outside the time critical
+    /// path, and the receivers must not use the blocking overflow policy.
+    /// Ignored when concurrent delivery is enabled; batch delivery and fields
+    /// keep the regular path
+    /// @param [in] enabled true for the pinned snapshot delivery, false
+    /// (default) for delivery to the current receiver list
+    void setRealTimePublishModeEnabled(const bool enabled);
+    /// Explicit sync point of the real time publish mode: re-pins the receiver
+    /// snapshot to the current receiver list. Has to be called after every
+    /// subscription change, a receiver that was removed and cleaned up since
+    /// the last sync point must not stay pinned
+    void syncReceiverSnapshot();
+    /// Enables the per-topic integrity mode: every delivered chunk gets a
+    /// CRC32C of its payload stamped into the chunk header (hardware
+    /// accelerated where the CPU supports it) which receivers can verify
+    /// with setIntegrityCheckEnabled. Not available with the compact chunk
+    /// header, there the call is ignored
+    /// @param [in] enabled true to stamp a checksum on every delivery
+    void setIntegrityModeEnabled(const bool enabled);
+    /// enables replaying the latest chunks to every new subscriber
+    /// @param [in] f_historyCapacity number of chunks to replay, clamped to
+    /// [1, MAX_HISTORY_CAPACITY] of the receiver handler
+    void enableDoDeliverOnSubscription(const uint32_t f_historyCapacity = 1u);
     bool doesDeliverOnSubscribe() const;
     bool isPortActive() const;
     bool isUnique() const;
@@ -62,16 +199,41 @@ class SenderPort : public BasePort
     void disconnectAllReceiver();
     void setThroughput(const uint32_t payloadSize);
     void setThroughputDeliveryData(mepoo::ChunkInfo& chunk, bool updateTimeInChunk = true);
+    void recordChunkStatistics(const uint32_t payloadSize);
+    void stampIntegrityChecksum(mepoo::ChunkHeader* const chunkHeader);
 
     void disconnectReceiverPort(ReceiverPortType::MemberType_t* const receiver);
 
     bool pushToAllocatedChunkContainer(mepoo::SharedChunk chunk);
     bool popFromAllocatedChunkContainer(mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk);
+
+    void pushToRecycleStash(mepoo::SharedChunk chunk);
+    bool popFromRecycleStash(const uint32_t payloadSize, mepoo::SharedChunk& chunk);
+    void releaseChunkChain(mepoo::ChunkHeader* const chunkHeader);
     bool deleteFromAllocatedChunkContainer(mepoo::ChunkHeader* chunkHeader);
     void clearAllocatedChunkContainer();
 
+    mepoo::ChunkHeader* reserveChunkInternal(const uint32_t payloadSize,
+                                             const bool useDynamicPayloadSizes,
+                                             const uint32_t resolvedPoolIndex);
+
     const MemberType_t* getMembers() const;
     MemberType_t* getMembers();
+
+    /// sentinel of m_fixedSizePoolIndex before the first fixed size reservation
+    static constexpr uint32_t NO_RESOLVED_POOL{UINT32_MAX};
+    /// mempool serving the fixed size topic of this port, resolved on the first
+    /// reservation through the fixed size path and reused for every further sample
+    uint32_t m_fixedSizePoolIndex{NO_RESOLVED_POOL};
+    /// local to this port instance like m_fixedSizePoolIndex, see
+    /// setRealTimePublishModeEnabled
+    bool m_realTimePublishMode{false};
+    /// receiver list pinned at the last syncReceiverSnapshot()
+    MemberType_t::ReceiverHandler_t::ReceiverVector_t m_pinnedReceivers;
+    /// accounting entry of this port in the memory manager, resolved once on
+    /// the first reservation; stays nullptr when the accounting table is full
+    mepoo::PortChunkAccounting* m_chunkAccounting{nullptr};
+    bool m_chunkAccountingResolved{false};
 };
 
 } // namespace popo
@@ -24,7 +24,6 @@
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_utils/cxx/helplets.hpp"
 #include "iceoryx_utils/cxx/optional.hpp"
-#include "iceoryx_utils/internal/concurrent/taco.hpp"
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
 
 #include <atomic>
@@ -45,6 +44,24 @@ struct SenderPortData : public BasePortData
         mepoo::TimePointNs currentDeliveryTimestamp{mepoo::DurationNs(0)};
     };
 
+    /// snapshot of the requested vs. granted chunk size statistics as handed
+    /// out to the port introspection
+    struct ChunkSizeStatistics
+    {
+        uint64_t m_requestedPayloadHistogram[CHUNK_SIZE_HISTOGRAM_BUCKETS]{};
+        uint64_t m_requestedPayloadBytes{0u};
+        uint64_t m_grantedChunkBytes{0u};
+    };
+
+    /// snapshot of the chunk quota bookkeeping as handed out to the port
+    /// introspection
+    struct ChunkQuotaStatistics
+    {
+        uint32_t m_limit{0u};
+        uint32_t m_usedChunks{0u};
+        uint64_t m_deniedRequests{0u};
+    };
+
     SenderPortData(mepoo::MemoryManager* const memoryMgr = nullptr, mepoo::SharedChunk lastChunk = nullptr) noexcept;
     SenderPortData(const capro::ServiceDescription& serviceDescription,
                    mepoo::MemoryManager* const memMgr,
@@ -61,24 +78,77 @@ struct SenderPortData : public BasePortData
     bool m_isUnique{false};
 
 
-    UsedChunkList<MAX_SAMPLE_ALLOCATE_PER_SENDER> m_allocatedChunksList;
+    // claimable from any application thread, so a worker pool can reserve and
+    // free chunks on one port without external serialization; sized to the
+    // maximum allocation window, the per port window is set with setCapacity
+    // and defaults to MAX_SAMPLE_ALLOCATE_PER_SENDER
+    ConcurrentUsedChunkList<MAX_SAMPLE_ALLOCATE_PER_SENDER_CAPACITY> m_allocatedChunksList;
 
     mepoo::SequenceNumberType m_sequenceNumber{0};
     // throughput related members
     std::atomic<uint32_t> m_activePayloadSize{0};
     Throughput m_throughput{};
     mutable Throughput m_throughputReadCache{};
-    enum class ThreadContext : uint32_t
-    {
-        Application,
-        RouDi,
-        END_OF_LIST
-    };
-    mutable concurrent::TACO<Throughput, ThreadContext> m_throughputExchange{
-        concurrent::TACOMode::DenyDataFromSameContext};
+    // when disabled the per delivery timestamping and the throughput publishing are
+    // skipped, for topics where nobody consumes the throughput introspection
+    std::atomic_bool m_throughputTracking{true};
+
+    // clock the tx timestamp in the chunk info is taken from; the throughput
+    // bookkeeping of the introspection always stays on the local monotonic clock.
+    // Written by application, read by application
+    std::atomic<mepoo::TimestampSource> m_timestampSource{mepoo::TimestampSource::MONOTONIC};
 
     iox::relative_ptr<mepoo::MemoryManager> m_memoryMgr;
     mepoo::SharedChunk m_lastChunk{nullptr};
+
+    /// per port quota over the chunks of the serving segment, enforced by the
+    /// memory manager on every reservation; disabled until a limit is set with
+    /// SenderPort::setChunkQuotaLimit
+    mepoo::ChunkQuota m_chunkQuota;
+
+    /// small stash of recently delivered chunks which is checked in reserveChunk()
+    /// before falling back to MemoryManager::getChunk(), so allocate/send cycles
+    /// reuse cache- and TLB-hot memory even when the last chunk is still held by
+    /// some receivers
+    static constexpr uint32_t RECYCLE_STASH_SIZE{4u};
+    mepoo::SharedChunk m_recycleStash[RECYCLE_STASH_SIZE];
+    uint32_t m_recycleStashInsertPosition{0u};
+
+    // multi threaded publish support: when enabled the single producer only
+    // optimizations (last chunk reuse, recycle stash) are skipped and the
+    // delivery fan-out is serialized via the flag below, since the delivery
+    // FiFos are single producer; chunk allocation and release stay lock-free
+    std::atomic_bool m_concurrentDelivery{false};
+    std::atomic_flag m_deliveryLock = ATOMIC_FLAG_INIT;
+
+    // integrity mode: when enabled every delivered chunk gets a CRC32C of its
+    // payload stamped into the chunk header so receivers can verify it
+    // end-to-end; needs the standard 64 byte chunk header
+    std::atomic_bool m_integrityMode{false};
+
+    /// everything the port introspection reads while the port is running; kept
+    /// in an own cache-line-aligned block at the end of the port data, so the
+    /// reads of the monitoring consumer in RouDi never pull cache lines of the
+    /// reserve/deliver working set above into the shared state
+    struct alignas(64) MonitoringData
+    {
+        // seqlock protecting m_throughputPublished: the send path bumps the sequence
+        // to an odd value, copies and bumps it to even again, the introspection reader
+        // retries while the sequence is odd or changed; the writer therefore never
+        // waits for the monitoring consumer
+        std::atomic<uint32_t> m_throughputSequence{0u};
+        Throughput m_throughputPublished{};
+
+        // requested vs. granted chunk size statistics of the reservation path,
+        // written with relaxed increments and read by the port introspection; the
+        // ratio of granted to requested bytes exposes topics which allocate small
+        // payloads from an oversized mempool while the port is running
+        std::atomic<uint64_t> m_requestedPayloadHistogram[CHUNK_SIZE_HISTOGRAM_BUCKETS]{};
+        std::atomic<uint64_t> m_requestedPayloadBytes{0u};
+        std::atomic<uint64_t> m_grantedChunkBytes{0u};
+    };
+
+    MonitoringData m_monitoring;
 };
 
 } // namespace popo
@@ -36,8 +36,30 @@ class UsedChunkList
         init();
     }
 
+    /// handle to the slot a chunk was stored in by insert; passing it to removeAt
+    /// makes the release a direct unlink without searching the list
+    using SlotHandle = uint32_t;
+    static constexpr SlotHandle InvalidSlotHandle{Size};
+
+    /// declares that this list is only ever modified from a single application
+    /// thread and that RouDi synchronizes with the application via the CaPro
+    /// message exchange only; the per operation synchronizer release is then
+    /// skipped. Irreversible, the crash cleanup still releases all held chunks
+    void declareSingleWriter()
+    {
+        m_singleWriter = true;
+    }
+
     // only from runtime context
     bool insert(mepoo::SharedChunk f_chunk)
+    {
+        SlotHandle l_slotHandle{InvalidSlotHandle};
+        return insert(f_chunk, l_slotHandle);
+    }
+
+    // only from runtime context
+    // @param [out] f_slotHandle slot the chunk was stored in, for removeAt
+    bool insert(mepoo::SharedChunk f_chunk, SlotHandle& f_slotHandle)
     {
         if (freeSpaceInList())
         {
@@ -46,16 +68,25 @@ class UsedChunkList
 
             // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
             m_list[m_freeListHead] = m_usedListHead;
+            if (m_usedListHead != InvalidIndex)
+            {
+                m_prev[m_usedListHead] = m_freeListHead;
+            }
+            m_prev[m_freeListHead] = InvalidIndex;
             m_usedListHead = m_freeListHead;
 
             // store chunk mgmt ptr
             m_data[m_usedListHead] = f_chunk.release();
+            f_slotHandle = m_usedListHead;
 
             // set freeListHead to the next free entry
             m_freeListHead = nextFree;
 
             //@todo can we do this cheaper with a global fence in cleanup?
-            m_synchronizer.clear(std::memory_order_release);
+            if (!m_singleWriter)
+            {
+                m_synchronizer.clear(std::memory_order_release);
+            }
             return true;
         }
         else
@@ -65,10 +96,41 @@ class UsedChunkList
     }
 
     // only from runtime context
-    bool remove(const mepoo::ChunkHeader* f_chunkHeader, mepoo::SharedChunk& f_chunk)
+    // inserts a whole batch of chunks with a single synchronization point at the end
+    // @param [out] f_slotHandles optional array with space for f_count handles, for removeAt
+    // @return number of inserted chunks, less than f_count if the list ran out of space
+    uint32_t insertBatch(mepoo::SharedChunk* f_chunks, const uint32_t f_count, SlotHandle* f_slotHandles = nullptr)
     {
-        uint32_t previous = InvalidIndex;
+        uint32_t l_inserted{0u};
+        while (l_inserted < f_count && freeSpaceInList())
+        {
+            auto nextFree = m_list[m_freeListHead];
+            m_list[m_freeListHead] = m_usedListHead;
+            if (m_usedListHead != InvalidIndex)
+            {
+                m_prev[m_usedListHead] = m_freeListHead;
+            }
+            m_prev[m_freeListHead] = InvalidIndex;
+            m_usedListHead = m_freeListHead;
+            m_data[m_usedListHead] = f_chunks[l_inserted].release();
+            if (f_slotHandles != nullptr)
+            {
+                f_slotHandles[l_inserted] = m_usedListHead;
+            }
+            m_freeListHead = nextFree;
+            ++l_inserted;
+        }
+
+        if (l_inserted > 0u && !m_singleWriter)
+        {
+            m_synchronizer.clear(std::memory_order_release);
+        }
+        return l_inserted;
+    }
 
+    // only from runtime context
+    bool remove(const mepoo::ChunkHeader* f_chunkHeader, mepoo::SharedChunk& f_chunk)
+    {
         // go through usedList with stored chunks
         for (uint32_t current = m_usedListHead; current != InvalidIndex; current = m_list[current])
         {
@@ -79,29 +141,43 @@ class UsedChunkList
                 f_chunk = mepoo::SharedChunk(m_data[current]);
                 m_data[current] = nullptr;
 
-                // remove index from used list
-                if (current == m_usedListHead)
-                {
-                    m_usedListHead = m_list[current];
-                }
-                else
-                {
-                    m_list[previous] = m_list[current];
-                }
-
-                // insert index to free list
-                m_list[current] = m_freeListHead;
-                m_freeListHead = current;
+                unlink(current);
 
                 //@todo can we do this cheaper with a global fence in cleanup?
-                m_synchronizer.clear(std::memory_order_release);
+                if (!m_singleWriter)
+                {
+                    m_synchronizer.clear(std::memory_order_release);
+                }
                 return true;
             }
-            previous = current;
         }
         return false;
     }
 
+    // only from runtime context
+    // removes the chunk from the slot returned by insert without searching the list;
+    // the chunk header is checked against the slot content, so a stale or foreign
+    // handle fails instead of freeing the wrong chunk
+    bool removeAt(const SlotHandle f_slotHandle, const mepoo::ChunkHeader* f_chunkHeader, mepoo::SharedChunk& f_chunk)
+    {
+        if (f_slotHandle >= Size || m_data[f_slotHandle] == nullptr
+            || m_data[f_slotHandle]->m_chunkHeader != f_chunkHeader)
+        {
+            return false;
+        }
+
+        f_chunk = mepoo::SharedChunk(m_data[f_slotHandle]);
+        m_data[f_slotHandle] = nullptr;
+
+        unlink(f_slotHandle);
+
+        if (!m_singleWriter)
+        {
+            m_synchronizer.clear(std::memory_order_release);
+        }
+        return true;
+    }
+
     // only once from runtime context
     void setup()
     {
@@ -135,6 +211,11 @@ class UsedChunkList
         }
         m_list[Size - 1] = InvalidIndex; // just to save us from the future self
 
+        for (uint32_t i = 0; i < Size; ++i)
+        {
+            m_prev[i] = InvalidIndex;
+        }
+
         m_usedListHead = InvalidIndex;
         m_freeListHead = 0u;
 
@@ -152,16 +233,195 @@ class UsedChunkList
         return (m_freeListHead != InvalidIndex);
     }
 
+    // unlinks an index from the doubly linked used list in O(1) and returns it to
+    // the free list; the free list stays singly linked, m_prev is only maintained
+    // for used entries
+    void unlink(const uint32_t f_current)
+    {
+        const auto l_next = m_list[f_current];
+        const auto l_prev = m_prev[f_current];
+
+        if (l_prev != InvalidIndex)
+        {
+            m_list[l_prev] = l_next;
+        }
+        else
+        {
+            m_usedListHead = l_next;
+        }
+        if (l_next != InvalidIndex)
+        {
+            m_prev[l_next] = l_prev;
+        }
+
+        m_list[f_current] = m_freeListHead;
+        m_freeListHead = f_current;
+    }
+
 
   private:
     static constexpr uint32_t InvalidIndex{Size};
 
   private:
     std::atomic_flag m_synchronizer = ATOMIC_FLAG_INIT;
+    bool m_singleWriter{false};
     uint32_t m_usedListHead{InvalidIndex};
     uint32_t m_freeListHead{0u};
     std::array<uint32_t, Size> m_list;
+    std::array<uint32_t, Size> m_prev;
+    std::array<relative_ptr<mepoo::ChunkManagement>, Size> m_data;
+};
+
+/// Variant of the UsedChunkList which may be used by several application threads
+/// concurrently. Every slot is guarded by its own state word and claimed with a
+/// CAS, so inserting and removing threads never block each other; there is no
+/// free list to maintain, a free slot is found by scanning, which is cheap for
+/// the small allocate-per-sender capacities this is used with
+template <uint32_t Size>
+class ConcurrentUsedChunkList
+{
+  public:
+    ConcurrentUsedChunkList()
+    {
+        init();
+    }
+
+    /// restricts how many chunks may be held in the list at the same time; the
+    /// slots beyond the window are never claimed, so a per port allocation
+    /// window can be configured without changing the shared memory layout
+    /// @param [in] f_capacity allocation window, clamped to the compiled in Size
+    void setCapacity(const uint32_t f_capacity)
+    {
+        m_capacity.store((f_capacity < Size) ? f_capacity : Size, std::memory_order_relaxed);
+    }
+
+    uint32_t capacity() const
+    {
+        return m_capacity.load(std::memory_order_relaxed);
+    }
+
+    /// declares that only a single application thread ever inserts or removes;
+    /// the slot claiming CAS of every chunk reservation and release is then
+    /// downgraded to relaxed loads and stores, RouDi synchronizes with the
+    /// application via the CaPro message exchange only. Irreversible and not
+    /// combinable with multi threaded publishing on the same port
+    void declareSingleWriter()
+    {
+        m_singleWriter.store(true, std::memory_order_relaxed);
+    }
+
+    // from any application thread
+    bool insert(mepoo::SharedChunk f_chunk)
+    {
+        const uint32_t l_capacity = m_capacity.load(std::memory_order_relaxed);
+        if (m_singleWriter.load(std::memory_order_relaxed))
+        {
+            for (uint32_t i = 0u; i < l_capacity; ++i)
+            {
+                if (m_state[i].load(std::memory_order_relaxed) == SlotState::FREE)
+                {
+                    m_data[i] = f_chunk.release();
+                    m_state[i].store(SlotState::USED, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+        for (uint32_t i = 0u; i < l_capacity; ++i)
+        {
+            auto expected = SlotState::FREE;
+            if (m_state[i].compare_exchange_strong(
+                    expected, SlotState::CLAIMED, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                m_data[i] = f_chunk.release();
+                m_state[i].store(SlotState::USED, std::memory_order_release);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // from any application thread
+    bool remove(const mepoo::ChunkHeader* f_chunkHeader, mepoo::SharedChunk& f_chunk)
+    {
+        if (m_singleWriter.load(std::memory_order_relaxed))
+        {
+            for (uint32_t i = 0u; i < Size; ++i)
+            {
+                if (m_state[i].load(std::memory_order_relaxed) == SlotState::USED && m_data[i] != nullptr
+                    && m_data[i]->m_chunkHeader == f_chunkHeader)
+                {
+                    f_chunk = mepoo::SharedChunk(m_data[i]);
+                    m_data[i] = nullptr;
+                    m_state[i].store(SlotState::FREE, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+        for (uint32_t i = 0u; i < Size; ++i)
+        {
+            if (m_state[i].load(std::memory_order_acquire) == SlotState::USED && m_data[i] != nullptr
+                && m_data[i]->m_chunkHeader == f_chunkHeader)
+            {
+                auto expected = SlotState::USED;
+                if (m_state[i].compare_exchange_strong(
+                        expected, SlotState::CLAIMED, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    // recheck under the claim, a concurrent remove and insert could
+                    // have replaced the slot content in between
+                    if (m_data[i] != nullptr && m_data[i]->m_chunkHeader == f_chunkHeader)
+                    {
+                        f_chunk = mepoo::SharedChunk(m_data[i]);
+                        m_data[i] = nullptr;
+                        m_state[i].store(SlotState::FREE, std::memory_order_release);
+                        return true;
+                    }
+                    m_state[i].store(SlotState::USED, std::memory_order_release);
+                }
+            }
+        }
+        return false;
+    }
+
+    // from RouDi context once the applications walked the plank
+    void cleanup()
+    {
+        for (uint32_t i = 0u; i < Size; ++i)
+        {
+            // a CLAIMED slot of a dead application may also hold a chunk already
+            if (m_data[i] != nullptr)
+            {
+                mepoo::SharedChunk{m_data[i]};
+            }
+        }
+
+        init(); // just to save us from the future self
+    }
+
+  private:
+    void init()
+    {
+        for (uint32_t i = 0u; i < Size; ++i)
+        {
+            m_data[i] = nullptr;
+            m_state[i].store(SlotState::FREE, std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+  private:
+    enum class SlotState : uint32_t
+    {
+        FREE,
+        CLAIMED,
+        USED
+    };
+
+    std::array<std::atomic<SlotState>, Size> m_state;
     std::array<relative_ptr<mepoo::ChunkManagement>, Size> m_data;
+    std::atomic<uint32_t> m_capacity{Size};
+    std::atomic_bool m_singleWriter{false};
 };
 
 } // namespace popo
@@ -0,0 +1,88 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/internal/popo/receiver_port_data.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/timing_wheel.hpp"
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Deadline QoS tracking for receiver ports. A port requests a deadline
+///         with subscribeWithDeadline; when RouDi processes the subscription it
+///         arms a periodic check on the process wide timing wheel. The check
+///         compares the delivery timestamp the sender already writes into the
+///         chunk info against the deadline, so the delivery hot path pays a
+///         single relaxed store. A miss increments the miss counter in the
+///         shared port data, readable by the application via
+///         getDeadlineMissCount, and fires the optional violation handler
+/// @concurrent startMonitoring and stopMonitoring may be called from any
+///             thread, the violation handler runs in the timing wheel context
+class DeadlineMonitor
+{
+  public:
+    /// called on every detected miss with the service description of the
+    /// violated subscription and its total miss count
+    using ViolationHandler_t = std::function<void(const capro::ServiceDescription&, const uint64_t)>;
+
+    DeadlineMonitor() noexcept = default;
+
+    /// @brief Constructor with a violation handler
+    /// @param[in] f_violationHandler fired on every detected deadline miss
+    explicit DeadlineMonitor(const ViolationHandler_t& f_violationHandler) noexcept;
+
+    /// @brief Stops the checks of all still monitored ports
+    ~DeadlineMonitor() noexcept;
+
+    DeadlineMonitor(const DeadlineMonitor&) = delete;
+    DeadlineMonitor(DeadlineMonitor&&) = delete;
+    DeadlineMonitor& operator=(const DeadlineMonitor&) = delete;
+    DeadlineMonitor& operator=(DeadlineMonitor&&) = delete;
+
+    /// @brief Arms the deadline check of a port; the check runs with the
+    ///         deadline as period, clamped to the tick of the timing wheel
+    /// @param[in] f_portData port whose subscription requested a deadline
+    /// @return false when the port requested no deadline or the task pool of
+    ///         the timing wheel is exhausted
+    bool startMonitoring(popo::ReceiverPortData* const f_portData) noexcept;
+
+    /// @brief Disarms the deadline check of a port, no-op when not monitored
+    /// @param[in] f_portData the port passed to startMonitoring
+    void stopMonitoring(popo::ReceiverPortData* const f_portData) noexcept;
+
+    /// @brief Number of currently monitored ports
+    uint32_t numberOfMonitoredPorts() const noexcept;
+
+  private:
+    struct Entry
+    {
+        popo::ReceiverPortData* m_portData{nullptr};
+        posix::TimingWheel::TaskHandle m_taskHandle;
+    };
+
+    void checkDeadline(popo::ReceiverPortData* const f_portData) noexcept;
+
+    mutable std::mutex m_entriesMutex;
+    std::vector<Entry> m_entries;
+    ViolationHandler_t m_violationHandler;
+};
+
+} // namespace roudi
+} // namespace iox
@@ -53,6 +53,8 @@ class MemPoolIntrospection
     };
 
     using Topic = MemPoolIntrospectionTopic;
+    using EventTopic = MemPoolIntrospectionEventTopic;
+    using AccountingTopic = MemoryAccountingIntrospectionTopic;
 
   public:
     /**
@@ -103,6 +105,64 @@ class MemPoolIntrospection
      */
     void setSnapshotInterval(unsigned int snapshotInterval_ms);
 
+    /**
+     * @brief This function configures the publish on change behavior. A new
+     *        sample is only published when the used chunk count of at least
+     *        one mempool changed by the given delta since the last
+     *        publication, cutting the steady state background load when the
+     *        usage is static. A delta of 0 publishes with every snapshot
+     *        interval.
+     *
+     * @param f_usedChunksDelta is the minimum change in used chunks which
+     *        triggers a publication
+     */
+    void setPublicationDelta(uint32_t f_usedChunksDelta);
+
+    /**
+     * @brief This function configures the heartbeat of the publish on change
+     *        behavior. Even without a change beyond the configured delta a
+     *        sample is published every given number of snapshot intervals, so
+     *        late subscribers and monitoring consumers see a bounded staleness.
+     *
+     * @param f_snapshotIntervals is the number of snapshot intervals after
+     *        which a publication is forced, 0 disables the heartbeat
+     */
+    void setHeartbeatInterval(uint32_t f_snapshotIntervals);
+
+    /**
+     * @brief This function registers the sender port for the mempool exhaustion early
+     *        warning events. With every snapshot the chunk usage of each mempool is
+     *        compared against the high watermark configured in its MePooConfig entry
+     *        and an event sample is published when the usage of at least one mempool
+     *        crossed its watermark. Without a registered event sender port no
+     *        watermark checks are performed.
+     *
+     * @param f_eventSenderPort is the sender port for transmission of the events
+     */
+    void registerEventSenderPort(SenderPort&& f_eventSenderPort);
+
+    /**
+     * @brief This function registers the sender port for the per-port memory
+     *        accounting. With every snapshot the accounting table of each
+     *        memory manager is published, attributing the outstanding chunks
+     *        of every segment to the ports holding them. Without a registered
+     *        sender port no accounting samples are published.
+     *
+     * @param f_accountingSenderPort is the sender port for transmission of the
+     *        accounting data
+     */
+    void registerAccountingSenderPort(SenderPort&& f_accountingSenderPort);
+
+    /**
+     * @brief This function registers the shared memory snapshot buffer. With
+     *        every snapshot interval the mempool state of all segments is
+     *        additionally written into the buffer, where any number of
+     *        monitoring consumers can sample it without per consumer work.
+     *
+     * @param f_snapshotBuffer is the snapshot buffer in the management segment
+     */
+    void registerSnapshotBuffer(concurrent::SnapshotBuffer<MemPoolIntrospectionTopicContainer>* f_snapshotBuffer);
+
   private:
     MemoryManager* m_rouDiInternalMemoryManager{nullptr}; // mempool handler needs to outlive this class (!)
     SegmentManager* m_segmentManager{nullptr};
@@ -110,6 +170,20 @@ class MemPoolIntrospection
     std::chrono::milliseconds m_snapShotInterval{1000};
 
     SenderPort m_senderPort{nullptr};
+    SenderPort m_eventSenderPort{nullptr};
+    SenderPort m_accountingSenderPort{nullptr};
+    concurrent::SnapshotBuffer<MemPoolIntrospectionTopicContainer>* m_snapshotBuffer{nullptr};
+    uint64_t m_eventSequenceNumber{0};
+    // previous above/below high watermark state per segment id and mempool index,
+    // needed to publish only the crossings and not the level with every snapshot
+    cxx::vector<cxx::vector<bool, MAX_NUMBER_OF_MEMPOOLS>, MAX_SHM_SEGMENTS + 1> m_aboveHighWatermark;
+
+    // publish on change state: the used chunk count of each mempool at the
+    // last publication, per segment id; empty until the first publication
+    cxx::vector<cxx::vector<uint32_t, MAX_NUMBER_OF_MEMPOOLS>, MAX_SHM_SEGMENTS + 1> m_lastPublishedUsedChunks;
+    uint32_t m_publicationDelta{1u};
+    uint32_t m_heartbeatIntervalCount{10u};
+    uint32_t m_ticksSinceLastPublication{0u};
 
     std::atomic<RunLevel> m_runLevel{WAIT};
     std::condition_variable m_waitConditionVar;
@@ -132,6 +206,23 @@ class MemPoolIntrospection
 
     // copy data fro internal struct into interface struct
     void copyMemPoolInfo(const MemoryManager& f_memoryManager, MemPoolInfoContainer& f_dest);
+
+    // copies the claimed entries of the accounting table into the topic
+    void copyPortAccounting(const MemoryManager& f_memoryManager, AccountingTopic& f_dest);
+
+    // publishes one accounting sample per memory segment
+    void sendPortAccounting();
+
+    // true if the used chunk count of at least one mempool changed by at least
+    // the configured delta since the last publication
+    bool usageChangedBeyondDelta();
+
+    // stores the used chunk counts of a published sample for the change detection
+    void rememberPublishedUsage(uint32_t f_id, const MemPoolInfoContainer& f_mempoolInfo);
+
+    // compares the chunk usage of each mempool against its high watermark and appends
+    // an event for every crossing since the previous snapshot
+    void checkHighWatermark(uint32_t f_id, const MemPoolInfoContainer& f_mempoolInfo, EventTopic& f_events);
 };
 
 /**
@@ -37,6 +37,14 @@ template <typename MemoryManager, typename SegmentManager, typename SenderPort>
 MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::~MemPoolIntrospection()
 {
     m_senderPort.deactivate(); // stop offer
+    if (m_eventSenderPort)
+    {
+        m_eventSenderPort.deactivate();
+    }
+    if (m_accountingSenderPort)
+    {
+        m_accountingSenderPort.deactivate();
+    }
     terminate();
     if (m_thread.joinable())
     {
@@ -77,6 +85,114 @@ void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::setSnapsho
     m_snapShotInterval = std::chrono::milliseconds(snapshotInterval_ms);
 }
 
+template <typename MemoryManager, typename SegmentManager, typename SenderPort>
+void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::setPublicationDelta(uint32_t f_usedChunksDelta)
+{
+    m_publicationDelta = f_usedChunksDelta;
+}
+
+template <typename MemoryManager, typename SegmentManager, typename SenderPort>
+void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::setHeartbeatInterval(
+    uint32_t f_snapshotIntervals)
+{
+    m_heartbeatIntervalCount = f_snapshotIntervals;
+}
+
+template <typename MemoryManager, typename SegmentManager, typename SenderPort>
+bool MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::usageChangedBeyondDelta()
+{
+    if (0u == m_publicationDelta)
+    {
+        return true; // publish with every snapshot interval
+    }
+
+    uint32_t id = 0;
+    auto changed = [&](const MemoryManager& f_memoryManager) {
+        if (m_lastPublishedUsedChunks.size() <= id)
+        {
+            return true; // nothing published for this segment yet
+        }
+        const auto& lastPublished = m_lastPublishedUsedChunks[static_cast<int>(id)];
+        const auto numOfMemPools = f_memoryManager.getNumberOfMemPools();
+        if (lastPublished.size() != numOfMemPools)
+        {
+            return true;
+        }
+        for (uint32_t i = 0; i < numOfMemPools; ++i)
+        {
+            const auto usedChunks = f_memoryManager.getMemPoolInfo(i).m_usedChunks;
+            const auto previous = lastPublished[static_cast<int>(i)];
+            const uint32_t delta = (usedChunks > previous) ? (usedChunks - previous) : (previous - usedChunks);
+            if (delta >= m_publicationDelta)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    if (changed(*m_rouDiInternalMemoryManager))
+    {
+        return true;
+    }
+    for (auto& segment : m_segmentManager->m_segmentContainer)
+    {
+        ++id;
+        if (changed(segment.getMemoryManager()))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename MemoryManager, typename SegmentManager, typename SenderPort>
+void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::rememberPublishedUsage(
+    uint32_t f_id, const MemPoolInfoContainer& f_mempoolInfo)
+{
+    while (m_lastPublishedUsedChunks.size() <= f_id)
+    {
+        m_lastPublishedUsedChunks.emplace_back();
+    }
+    auto& lastPublished = m_lastPublishedUsedChunks[static_cast<int>(f_id)];
+    lastPublished.clear();
+    for (auto& info : f_mempoolInfo)
+    {
+        lastPublished.push_back(info.m_usedChunks);
+    }
+}
+
+template <typename MemoryManager, typename SegmentManager, typename SenderPort>
+void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::registerEventSenderPort(
+    SenderPort&& f_eventSenderPort)
+{
+    // we do not want to call this twice
+    if (!m_eventSenderPort)
+    {
+        m_eventSenderPort = std::move(f_eventSenderPort);
+        m_eventSenderPort.activate(); // corresponds to offer
+    }
+}
+
+template <typename MemoryManager, typename SegmentManager, typename SenderPort>
+void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::registerAccountingSenderPort(
+    SenderPort&& f_accountingSenderPort)
+{
+    // we do not want to call this twice
+    if (!m_accountingSenderPort)
+    {
+        m_accountingSenderPort = std::move(f_accountingSenderPort);
+        m_accountingSenderPort.activate(); // corresponds to offer
+    }
+}
+
+template <typename MemoryManager, typename SegmentManager, typename SenderPort>
+void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::registerSnapshotBuffer(
+    concurrent::SnapshotBuffer<MemPoolIntrospectionTopicContainer>* f_snapshotBuffer)
+{
+    m_snapshotBuffer = f_snapshotBuffer;
+}
+
 template <typename MemoryManager, typename SegmentManager, typename SenderPort>
 void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::run()
 {
@@ -126,32 +242,198 @@ void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::prepareInt
 template <typename MemoryManager, typename SegmentManager, typename SenderPort>
 void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::send()
 {
-    if (m_senderPort.hasSubscribers())
+    const bool hasSubscribers = m_senderPort.hasSubscribers();
+    const bool checkWatermarks = static_cast<bool>(m_eventSenderPort);
+    const bool snapshotRegistered = (nullptr != m_snapshotBuffer);
+    const bool publishAccounting =
+        static_cast<bool>(m_accountingSenderPort) && m_accountingSenderPort.hasSubscribers();
+
+    if (publishAccounting)
     {
+        sendPortAccounting();
+    }
+
+    if (!hasSubscribers && !checkWatermarks && !snapshotRegistered)
+    {
+        return;
+    }
+
+    // publish on change: skip the publication when the usage is static, the
+    // heartbeat bounds the staleness for late subscribers. The watermark
+    // checks below still run with every tick so the events stay timely
+    ++m_ticksSinceLastPublication;
+    const bool heartbeatDue =
+        (0u != m_heartbeatIntervalCount) && (m_ticksSinceLastPublication >= m_heartbeatIntervalCount);
+    const bool publish = (hasSubscribers || snapshotRegistered) && (heartbeatDue || usageChangedBeyondDelta());
+    if (!publish && !checkWatermarks)
+    {
+        return;
+    }
+    const bool updateSnapshot = publish && snapshotRegistered;
+
+    EventTopic events;
+
+    auto collectAndPublish = [&](MemPoolIntrospectionTopicContainer* f_snapshot) {
         uint32_t id = 0;
+        // scratch sample for the ticks where nothing is delivered; with
+        // subscribers the topic is built directly inside the loaned chunk, so
+        // the mempool info is copied once into its final place and no second
+        // copy happens on publication
+        Topic scratchTopic;
+
+        auto publishTopic = [&](const posix::PosixGroup& f_readerGroup,
+                                const posix::PosixGroup& f_writerGroup,
+                                const MemoryManager& f_memoryManager) {
+            mepoo::ChunkHeader* chunkHeader{nullptr};
+            Topic* sample = &scratchTopic;
+            if (publish && hasSubscribers)
+            {
+                chunkHeader = m_senderPort.reserveChunk(sizeof(Topic));
+                sample = new (chunkHeader->payload()) Topic;
+            }
+
+            copyMemPoolInfo(f_memoryManager, sample->m_mempoolInfo);
+            prepareIntrospectionSample(sample, f_readerGroup, f_writerGroup, id);
 
-        auto chunkHeader = m_senderPort.reserveChunk(sizeof(Topic));
-        auto sample = static_cast<Topic*>(chunkHeader->payload());
-        new (sample) Topic;
+            if (checkWatermarks)
+            {
+                checkHighWatermark(id, sample->m_mempoolInfo, events);
+            }
 
-        prepareIntrospectionSample(
-            sample, posix::PosixGroup::getGroupOfCurrentProcess(), posix::PosixGroup::getGroupOfCurrentProcess(), id);
-        copyMemPoolInfo(*m_rouDiInternalMemoryManager, sample->m_mempoolInfo);
+            if (nullptr != f_snapshot)
+            {
+                f_snapshot->emplace_back(*sample);
+            }
 
-        m_senderPort.deliverChunk(chunkHeader);
+            if (publish)
+            {
+                rememberPublishedUsage(id, sample->m_mempoolInfo);
+            }
+
+            if (nullptr != chunkHeader)
+            {
+                m_senderPort.deliverChunk(chunkHeader);
+            }
+        };
+
+        publishTopic(posix::PosixGroup::getGroupOfCurrentProcess(),
+                     posix::PosixGroup::getGroupOfCurrentProcess(),
+                     *m_rouDiInternalMemoryManager);
 
         for (auto& segment : m_segmentManager->m_segmentContainer)
         {
             ++id;
-            auto chunkHeader = m_senderPort.reserveChunk(sizeof(Topic));
-            auto sample = static_cast<Topic*>(chunkHeader->payload());
-            new (sample) Topic;
+            publishTopic(segment.getReaderGroup(), segment.getWriterGroup(), segment.getMemoryManager());
+        }
+    };
+
+    if (updateSnapshot)
+    {
+        // the whole collection runs inside one snapshot update so readers
+        // never see a container with only a part of the segments
+        m_snapshotBuffer->update([&](MemPoolIntrospectionTopicContainer& f_container) {
+            new (&f_container) MemPoolIntrospectionTopicContainer;
+            collectAndPublish(&f_container);
+        });
+    }
+    else
+    {
+        collectAndPublish(nullptr);
+    }
+
+    if (publish)
+    {
+        m_ticksSinceLastPublication = 0u;
+    }
+
+    if (!events.m_events.empty() && m_eventSenderPort.hasSubscribers())
+    {
+        events.m_sequenceNumber = m_eventSequenceNumber++;
+
+        auto chunkHeader = m_eventSenderPort.reserveChunk(sizeof(EventTopic));
+        auto sample = static_cast<EventTopic*>(chunkHeader->payload());
+        new (sample) EventTopic(events);
+
+        m_eventSenderPort.deliverChunk(chunkHeader);
+    }
+}
 
-            prepareIntrospectionSample(sample, segment.getReaderGroup(), segment.getWriterGroup(), id);
-            copyMemPoolInfo(segment.getMemoryManager(), sample->m_mempoolInfo);
+template <typename MemoryManager, typename SegmentManager, typename SenderPort>
+void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::checkHighWatermark(
+    uint32_t f_id, const MemPoolInfoContainer& f_mempoolInfo, EventTopic& f_events)
+{
+    while (m_aboveHighWatermark.size() <= f_id)
+    {
+        m_aboveHighWatermark.emplace_back();
+    }
+    auto& aboveHighWatermark = m_aboveHighWatermark[static_cast<int>(f_id)];
+    while (aboveHighWatermark.size() < f_mempoolInfo.size())
+    {
+        aboveHighWatermark.push_back(false);
+    }
+
+    for (uint64_t i = 0u; i < f_mempoolInfo.size(); ++i)
+    {
+        const auto& info = f_mempoolInfo[static_cast<int>(i)];
+        if (info.m_highWatermark == 0u)
+        {
+            continue; // no high watermark configured for this mempool
+        }
+
+        const bool above = info.m_usedChunks >= info.m_highWatermark;
+        if (above != aboveHighWatermark[static_cast<int>(i)])
+        {
+            aboveHighWatermark[static_cast<int>(i)] = above;
+
+            MemPoolEvent event;
+            event.m_id = f_id;
+            event.m_memPoolIndex = static_cast<uint32_t>(i);
+            event.m_usedChunks = info.m_usedChunks;
+            event.m_numChunks = info.m_numChunks;
+            event.m_highWatermark = info.m_highWatermark;
+            event.m_aboveHighWatermark = above;
+            f_events.m_events.push_back(event);
+        }
+    }
+}
+
+template <typename MemoryManager, typename SegmentManager, typename SenderPort>
+void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::sendPortAccounting()
+{
+    uint32_t id = 0;
+
+    auto publishAccountingTopic = [&](const MemoryManager& f_memoryManager) {
+        auto chunkHeader = m_accountingSenderPort.reserveChunk(sizeof(AccountingTopic));
+        auto sample = new (chunkHeader->payload()) AccountingTopic;
+        sample->m_id = id;
+        copyPortAccounting(f_memoryManager, *sample);
+        m_accountingSenderPort.deliverChunk(chunkHeader);
+    };
+
+    publishAccountingTopic(*m_rouDiInternalMemoryManager);
+    for (auto& segment : m_segmentManager->m_segmentContainer)
+    {
+        ++id;
+        publishAccountingTopic(segment.getMemoryManager());
+    }
+}
 
-            m_senderPort.deliverChunk(chunkHeader);
+template <typename MemoryManager, typename SegmentManager, typename SenderPort>
+void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::copyPortAccounting(
+    const MemoryManager& f_memoryManager, AccountingTopic& f_dest)
+{
+    for (uint32_t i = 0u; i < mepoo::MemoryManager::PORT_ACCOUNTING_CAPACITY; ++i)
+    {
+        auto src = f_memoryManager.getPortAccountingInfo(i);
+        if (0u == src.m_portID)
+        {
+            continue; // unclaimed entry
         }
+        PortMemoryAccountingData data;
+        data.m_portID = src.m_portID;
+        data.m_outstandingChunks = src.m_outstandingChunks;
+        data.m_totalAllocations = src.m_totalAllocations;
+        f_dest.m_portAccounting.push_back(data);
     }
 }
 
@@ -171,6 +453,10 @@ void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::copyMemPoo
         dst.m_numChunks = src.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
         dst.m_payloadSize = src.m_chunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader));
+        dst.m_failedAllocations = src.m_failedAllocations;
+        dst.m_freeListPopRetries = src.m_freeListPopRetries;
+        dst.m_highWatermark = src.m_highWatermark;
+        dst.m_freeListPushRetries = src.m_freeListPushRetries;
     }
 }
 
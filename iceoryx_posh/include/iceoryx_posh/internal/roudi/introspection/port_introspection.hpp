@@ -21,6 +21,7 @@
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_utils/cxx/helplets.hpp"
+#include "iceoryx_utils/internal/concurrent/mpmc_queue.hpp"
 
 #include <atomic>
 #include <mutex>
@@ -55,6 +56,30 @@ class PortIntrospection
     using PortIntrospectionTopic = PortIntrospectionFieldTopic;
     using PortThroughputIntrospectionTopic = PortThroughputIntrospectionFieldTopic;
 
+    /// a registration change or connection state message handed over from the
+    /// discovery context to the introspection thread; the discovery thread only
+    /// pushes into a lock-free queue and never contends with the mutex a
+    /// running introspection tick holds
+    struct PortCommand
+    {
+        enum class Type : uint32_t
+        {
+            ADD_SENDER,
+            ADD_RECEIVER,
+            REMOVE_SENDER,
+            REMOVE_RECEIVER,
+            MESSAGE
+        };
+
+        Type m_type{Type::MESSAGE};
+        typename SenderPort::MemberType_t* m_senderPortData{nullptr};
+        typename ReceiverPort::MemberType_t* m_receiverPortData{nullptr};
+        std::string m_name;
+        capro::ServiceDescription m_service;
+        std::string m_runnable;
+        capro::CaproMessage m_message;
+    };
+
     class PortData
     {
       private:
@@ -90,6 +115,9 @@ class PortIntrospection
             // map from indices to object pointers
             std::map<int, ConnectionInfo*> connectionMap;
             int index{-1};
+            // entry changed since the last published sample and has to be part
+            // of the next delta
+            bool dirty{true};
         };
 
         struct ReceiverInfo
@@ -139,6 +167,9 @@ class PortIntrospection
             ReceiverInfo receiverInfo;
             SenderInfo* senderInfo{nullptr};
             ConnectionState state{ConnectionState::DEFAULT};
+            // entry changed since the last published sample and has to be part
+            // of the next delta
+            bool dirty{true};
 
             bool isConnected()
             {
@@ -218,9 +249,11 @@ class PortIntrospection
          * @brief prepare the topic to be send based on the internal connection state of all tracked ports
          *
          * @param[out] topic data structure to be prepared for sending
+         * @param[in] f_completeState true if the topic shall contain all ports, false if it
+         *              shall only contain the entries which changed since the last prepared topic
          *
          */
-        void prepareTopic(PortIntrospectionTopic& topic);
+        void prepareTopic(PortIntrospectionTopic& topic, const bool f_completeState = true);
 
         void prepareTopic(PortThroughputIntrospectionTopic& topic);
 
@@ -269,6 +302,14 @@ class PortIntrospection
         SenderContainer m_senderContainer;
         ConnectionContainer m_connectionContainer;
 
+        // unique port ids of the ports removed since the last published sample,
+        // needed for the delta samples
+        std::vector<uint64_t> m_removedSenderPortIDs;
+        std::vector<uint64_t> m_removedReceiverPortIDs;
+
+        // sequence number of the last prepared topic
+        uint64_t m_sequenceNumber{0};
+
         std::atomic<bool> m_newData;
         std::mutex m_mutex;
     };
@@ -297,7 +338,8 @@ class PortIntrospection
      * @param[in] service capro service description of the port to be added
      * @param[in] name of the runnable the port belongs to
      *
-     * @return returns false if the port could not be added and true otherwise
+     * @return returns true if the addition was handed over to the introspection
+     *              thread; the port itself is added asynchronously
      */
     bool addSender(typename SenderPort::MemberType_t* port,
                    const std::string& name,
@@ -313,7 +355,8 @@ class PortIntrospection
      * @param[in] service capro service description of the port to be added
      * @param[in] name of the runnable the port belongs to
      *
-     * @return returns false if the port could not be added and true otherwise
+     * @return returns true if the addition was handed over to the introspection
+     *              thread; the port itself is added asynchronously
      */
     bool addReceiver(typename ReceiverPort::MemberType_t* const portData,
                      const std::string& name,
@@ -327,8 +370,8 @@ class PortIntrospection
      * @param[in] name name of the port to be added
      * @param[in] service capro service description of the port to be added
      *
-     * @return returns false if the port could not be removed (since it did not exist)
-     *              and true otherwise
+     * @return returns true if the removal was handed over to the introspection
+     *              thread; the port itself is removed asynchronously
      */
     bool removeSender(const std::string& name, const capro::ServiceDescription& service);
 
@@ -338,8 +381,8 @@ class PortIntrospection
      * @param[in] name name of the port to be added
      * @param[in] service capro service description of the port to be added
      *
-     * @return returns false if the port could not be removed (since it did not exist)
-     *              and true otherwise
+     * @return returns true if the removal was handed over to the introspection
+     *              thread; the port itself is removed asynchronously
      */
     bool removeReceiver(const std::string& name, const capro::ServiceDescription& service);
 
@@ -362,6 +405,16 @@ class PortIntrospection
                             SenderPort&& f_senderPortThroughput,
                             SenderPort&& f_senderPortReceiverPortsData);
 
+    /*!
+     * @brief register the shared memory snapshot buffer; with every port data
+     *        publication the complete port state is additionally written into
+     *        the buffer, where any number of monitoring consumers can sample
+     *        it without per consumer work
+     *
+     * @param[in] f_snapshotBuffer snapshot buffer in the management segment
+     */
+    void registerSnapshotBuffer(concurrent::SnapshotBuffer<PortIntrospectionFieldTopic>* f_snapshotBuffer);
+
     /*!
      * @brief set the time interval used to send new introspection data
      *
@@ -386,8 +439,10 @@ class PortIntrospection
     /*!
      * @brief sends the port data; this is used from the unittests
      *
+     * @param[in] f_completeState true if the sample shall contain all ports, false if it
+     *              shall only contain the entries which changed since the last sent sample
      */
-    void sendPortData();
+    void sendPortData(const bool f_completeState = true);
     /*!
      * @brief sends the throughput data; this is used from the unittests
      *
@@ -400,16 +455,41 @@ class PortIntrospection
     void sendReceiverPortsData();
 
   private:
+    /// @brief applies a port command to the internal port data
+    void applyPortCommand(const PortCommand& f_command);
+
+    /// @brief hands a port command over to the introspection thread; when the
+    /// queue is full the oldest pending command is applied in order by the
+    /// calling thread until the push succeeds
+    void enqueuePortCommand(const PortCommand& f_command);
+
+    /// @brief applies all pending port commands, called by the introspection
+    /// thread at the begin of every tick
+    void processPortCommands();
+
     SenderPort m_senderPort{nullptr};
     SenderPort m_senderPortThroughput{nullptr};
     SenderPort m_senderPortReceiverPortsData{nullptr};
+    concurrent::SnapshotBuffer<PortIntrospectionFieldTopic>* m_snapshotBuffer{nullptr};
     PortData m_portData;
 
+    /// port add/remove and connection state messages are decoupled from the
+    /// introspection thread via this lock-free queue, so creating ports never
+    /// blocks on a running introspection tick
+    static constexpr uint32_t PORT_COMMAND_QUEUE_CAPACITY{MAX_PORT_NUMBER};
+    concurrent::MpmcQueue<PortCommand, PORT_COMMAND_QUEUE_CAPACITY> m_portCommands;
+
     std::atomic<bool> m_runThread;
     std::thread m_thread;
 
     unsigned int m_sendIntervalCount{10};
     const std::chrono::milliseconds m_sendIntervalSleep{100};
+
+    /// a complete state sample is published after this many delta publications at the
+    /// latest, so that a late subscriber (which only receives the latest sample) can
+    /// resynchronize in bounded time
+    static constexpr uint32_t COMPLETE_STATE_INTERVAL_COUNT{10u};
+    uint32_t m_deltasSinceCompleteState{0u};
 };
 
 /**
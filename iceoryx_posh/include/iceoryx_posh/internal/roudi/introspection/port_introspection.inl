@@ -34,10 +34,71 @@ PortIntrospection<SenderPort, ReceiverPort>::~PortIntrospection()
     stop();
 }
 
+template <typename SenderPort, typename ReceiverPort>
+constexpr uint32_t PortIntrospection<SenderPort, ReceiverPort>::PORT_COMMAND_QUEUE_CAPACITY;
+
 template <typename SenderPort, typename ReceiverPort>
 void PortIntrospection<SenderPort, ReceiverPort>::reportMessage(const capro::CaproMessage& message)
 {
-    m_portData.updateConnectionState(message);
+    // messages are handed over via the same queue as the port additions to
+    // keep their relative order, a message may refer to a port whose addition
+    // is still pending
+    PortCommand l_command;
+    l_command.m_type = PortCommand::Type::MESSAGE;
+    l_command.m_message = message;
+    enqueuePortCommand(l_command);
+}
+
+template <typename SenderPort, typename ReceiverPort>
+void PortIntrospection<SenderPort, ReceiverPort>::applyPortCommand(const PortCommand& f_command)
+{
+    switch (f_command.m_type)
+    {
+    case PortCommand::Type::ADD_SENDER:
+        m_portData.addSender(f_command.m_senderPortData, f_command.m_name, f_command.m_service, f_command.m_runnable);
+        break;
+    case PortCommand::Type::ADD_RECEIVER:
+        m_portData.addReceiver(
+            f_command.m_receiverPortData, f_command.m_name, f_command.m_service, f_command.m_runnable);
+        break;
+    case PortCommand::Type::REMOVE_SENDER:
+        m_portData.removeSender(f_command.m_name, f_command.m_service);
+        break;
+    case PortCommand::Type::REMOVE_RECEIVER:
+        m_portData.removeReceiver(f_command.m_name, f_command.m_service);
+        break;
+    case PortCommand::Type::MESSAGE:
+        m_portData.updateConnectionState(f_command.m_message);
+        break;
+    }
+}
+
+template <typename SenderPort, typename ReceiverPort>
+void PortIntrospection<SenderPort, ReceiverPort>::enqueuePortCommand(const PortCommand& f_command)
+{
+    while (!m_portCommands.push(f_command))
+    {
+        // the queue overflowed, the calling thread applies the oldest pending
+        // command itself; this keeps the command order intact (pop takes the
+        // front) and degrades to the former direct locking behavior under
+        // overload instead of losing commands
+        auto l_pendingCommand = m_portCommands.pop();
+        if (l_pendingCommand.has_value())
+        {
+            applyPortCommand(*l_pendingCommand);
+        }
+    }
+}
+
+template <typename SenderPort, typename ReceiverPort>
+void PortIntrospection<SenderPort, ReceiverPort>::processPortCommands()
+{
+    auto l_command = m_portCommands.pop();
+    while (l_command.has_value())
+    {
+        applyPortCommand(*l_command);
+        l_command = m_portCommands.pop();
+    }
 }
 
 template <typename SenderPort, typename ReceiverPort>
@@ -62,6 +123,13 @@ bool PortIntrospection<SenderPort, ReceiverPort>::registerSenderPort(SenderPort&
     return true;
 }
 
+template <typename SenderPort, typename ReceiverPort>
+void PortIntrospection<SenderPort, ReceiverPort>::registerSnapshotBuffer(
+    concurrent::SnapshotBuffer<PortIntrospectionFieldTopic>* f_snapshotBuffer)
+{
+    m_snapshotBuffer = f_snapshotBuffer;
+}
+
 template <typename SenderPort, typename ReceiverPort>
 void PortIntrospection<SenderPort, ReceiverPort>::run()
 {
@@ -83,11 +151,19 @@ void PortIntrospection<SenderPort, ReceiverPort>::run()
     m_thread = std::thread([this] {
         while (m_runThread)
         {
+            processPortCommands();
+
             if (0 == (ct % m_sendIntervalCount))
             {
-                if (m_portData.isNew())
+                if (m_portData.isNew() || m_deltasSinceCompleteState > 0u)
                 {
-                    sendPortData();
+                    // only the changed entries are published; a complete state is
+                    // published after a bounded number of deltas and once after a
+                    // burst of changes has settled, so the latest sample a new
+                    // subscriber receives becomes a complete state again
+                    const bool completeState =
+                        !m_portData.isNew() || (m_deltasSinceCompleteState >= COMPLETE_STATE_INTERVAL_COUNT);
+                    sendPortData(completeState);
                 }
                 sendThroughputData();
                 sendReceiverPortsData();
@@ -104,20 +180,37 @@ void PortIntrospection<SenderPort, ReceiverPort>::run()
 }
 
 template <typename SenderPort, typename ReceiverPort>
-void PortIntrospection<SenderPort, ReceiverPort>::sendPortData()
+void PortIntrospection<SenderPort, ReceiverPort>::sendPortData(const bool f_completeState)
 {
+    processPortCommands();
+
     auto chunkHeader = m_senderPort.reserveChunk(sizeof(PortIntrospectionFieldTopic));
     auto sample = static_cast<PortIntrospectionFieldTopic*>(chunkHeader->payload());
     new (sample) PortIntrospectionFieldTopic();
 
-    m_portData.prepareTopic(*sample); // requires internal mutex (blocks
-                                      // further introspection events)
+    m_portData.prepareTopic(*sample, f_completeState); // requires internal mutex (blocks
+                                                       // further introspection events)
     m_senderPort.deliverChunk(chunkHeader);
+
+    if (nullptr != m_snapshotBuffer)
+    {
+        // the snapshot always holds the complete state since its readers do
+        // not track the deltas; in place update, the topic is too large for
+        // an intermediate copy on the stack
+        m_snapshotBuffer->update([&](PortIntrospectionFieldTopic& f_topic) {
+            new (&f_topic) PortIntrospectionFieldTopic;
+            m_portData.prepareTopic(f_topic, true);
+        });
+    }
+
+    m_deltasSinceCompleteState = f_completeState ? 0u : m_deltasSinceCompleteState + 1u;
 }
 
 template <typename SenderPort, typename ReceiverPort>
 void PortIntrospection<SenderPort, ReceiverPort>::sendThroughputData()
 {
+    processPortCommands();
+
     auto chunkHeader = m_senderPortThroughput.reserveChunk(sizeof(PortThroughputIntrospectionFieldTopic));
     auto throughputSample = static_cast<PortThroughputIntrospectionFieldTopic*>(chunkHeader->payload());
     new (throughputSample) PortThroughputIntrospectionFieldTopic();
@@ -130,6 +223,8 @@ void PortIntrospection<SenderPort, ReceiverPort>::sendThroughputData()
 template <typename SenderPort, typename ReceiverPort>
 void PortIntrospection<SenderPort, ReceiverPort>::sendReceiverPortsData()
 {
+    processPortCommands();
+
     auto chunkInfo = m_senderPortReceiverPortsData.reserveChunk(sizeof(ReceiverPortChangingIntrospectionFieldTopic));
     auto receiverPortChangingDataSample =
     static_cast<ReceiverPortChangingIntrospectionFieldTopic*>(chunkInfo->payload());
@@ -188,6 +283,7 @@ bool PortIntrospection<SenderPort, ReceiverPort>::PortData::updateConnectionStat
         {
             // should always be true if its in the map stored at this serviceId
             connection.state = getNextState(connection.state, messageType);
+            connection.dirty = true;
         }
     }
 
@@ -231,6 +327,7 @@ bool PortIntrospection<SenderPort, ReceiverPort>::PortData::addSender(typename S
             if (serviceId == receiverServiceId)
             {
                 connection.senderInfo = sender;
+                connection.dirty = true;
             }
         }
     }
@@ -304,6 +401,13 @@ bool PortIntrospection<SenderPort, ReceiverPort>::PortData::removeSender(const s
     {
         pair.second->senderInfo = nullptr;             // sender is disconnected
         pair.second->state = ConnectionState::DEFAULT; // connection state is now default
+        pair.second->dirty = true;
+    }
+
+    // remember the removed port for the next delta sample
+    if (sender.portData != nullptr)
+    {
+        m_removedSenderPortIDs.emplace_back(SenderPort(sender.portData).getUniqueID());
     }
 
     m_senderMap.erase(iter);
@@ -350,6 +454,12 @@ bool PortIntrospection<SenderPort, ReceiverPort>::PortData::removeReceiver(const
         }
     }
 
+    // remember the removed port for the next delta sample
+    if (connection.receiverInfo.portData != nullptr)
+    {
+        m_removedReceiverPortIDs.emplace_back(ReceiverPort(connection.receiverInfo.portData).getUniqueID());
+    }
+
     map.erase(mapIter);
     m_connectionContainer.remove(connectionIndex);
 
@@ -414,12 +524,16 @@ PortIntrospection<SenderPort, ReceiverPort>::PortData::getNextState(ConnectionSt
 }
 
 template <typename SenderPort, typename ReceiverPort>
-void PortIntrospection<SenderPort, ReceiverPort>::PortData::prepareTopic(PortIntrospectionTopic& topic)
+void PortIntrospection<SenderPort, ReceiverPort>::PortData::prepareTopic(PortIntrospectionTopic& topic,
+                                                                         const bool f_completeState)
 {
     auto& m_senderList = topic.m_senderList;
 
     std::lock_guard<std::mutex> lock(m_mutex); // we need to lock the internal data structs
 
+    topic.m_sequenceNumber = ++m_sequenceNumber;
+    topic.m_completeState = f_completeState;
+
     int index = 0;
     for (auto& pair : m_senderMap)
     {
@@ -427,6 +541,14 @@ void PortIntrospection<SenderPort, ReceiverPort>::PortData::prepareTopic(PortInt
         if (m_senderIndex >= 0)
         {
             auto& senderInfo = m_senderContainer[m_senderIndex];
+            if (f_completeState)
+            {
+                senderInfo.index = index++;
+            }
+            else if (!senderInfo.dirty)
+            {
+                continue; // a delta only contains the entries which changed
+            }
             SenderPortData senderData;
             SenderPort port(senderInfo.portData);
             senderData.m_senderPortID = port.getUniqueID();
@@ -438,7 +560,7 @@ void PortIntrospection<SenderPort, ReceiverPort>::PortData::prepareTopic(PortInt
             senderData.m_caproEventMethodID = senderInfo.service.getEventIDString();
 
             m_senderList.emplace_back(senderData);
-            senderInfo.index = index++;
+            senderInfo.dirty = false;
         }
     }
 
@@ -451,6 +573,10 @@ void PortIntrospection<SenderPort, ReceiverPort>::PortData::prepareTopic(PortInt
             if (connectionIndex >= 0)
             {
                 auto& connection = m_connectionContainer[connectionIndex];
+                if (!f_completeState && !connection.dirty)
+                {
+                    continue; // a delta only contains the entries which changed
+                }
                 ReceiverPortData receiverData;
                 bool connected = connection.isConnected();
                 auto& receiverInfo = connection.receiverInfo;
@@ -461,16 +587,40 @@ void PortIntrospection<SenderPort, ReceiverPort>::PortData::prepareTopic(PortInt
                 receiverData.m_caproInstanceID = receiverInfo.service.getInstanceIDString();
                 receiverData.m_caproServiceID = receiverInfo.service.getServiceIDString();
                 receiverData.m_caproEventMethodID = receiverInfo.service.getEventIDString();
+                if (receiverInfo.portData != nullptr)
+                {
+                    receiverData.m_receiverPortID = ReceiverPort(receiverInfo.portData).getUniqueID();
+                }
                 if (connected)
                 { // senderInfo is not nullptr, otherwise we would not be
                     // connected
-                    receiverData.m_senderIndex = connection.senderInfo->index;
+                    receiverData.m_connectedSenderPortID = SenderPort(connection.senderInfo->portData).getUniqueID();
+                    if (f_completeState)
+                    {
+                        receiverData.m_senderIndex = connection.senderInfo->index;
+                    }
                 } // remark: index is -1 for not connected
                 m_receiverList.emplace_back(receiverData);
+                connection.dirty = false;
             }
         }
     }
 
+    if (!f_completeState)
+    {
+        for (auto portID : m_removedSenderPortIDs)
+        {
+            topic.m_removedSenderPortIDs.emplace_back(portID);
+        }
+        for (auto portID : m_removedReceiverPortIDs)
+        {
+            topic.m_removedReceiverPortIDs.emplace_back(portID);
+        }
+    }
+    // a complete state implicitly covers the removals
+    m_removedSenderPortIDs.clear();
+    m_removedReceiverPortIDs.clear();
+
     // needs to be done while holding the lock
     setNew(false);
 }
@@ -507,6 +657,17 @@ void PortIntrospection<SenderPort, ReceiverPort>::PortData::prepareTopic(PortThr
             }
             auto sendInterval = introData.currentDeliveryTimestamp - introData.lastDeliveryTimestamp;
             throughputData.m_lastSendIntervalInNanoseconds = sendInterval.count();
+            auto chunkSizeStatistics = port.getChunkSizeStatistics();
+            for (uint32_t i = 0u; i < CHUNK_SIZE_HISTOGRAM_BUCKETS; ++i)
+            {
+                throughputData.m_requestedPayloadHistogram[i] = chunkSizeStatistics.m_requestedPayloadHistogram[i];
+            }
+            throughputData.m_requestedPayloadBytes = chunkSizeStatistics.m_requestedPayloadBytes;
+            throughputData.m_grantedChunkBytes = chunkSizeStatistics.m_grantedChunkBytes;
+            auto quotaStatistics = port.getChunkQuotaStatistics();
+            throughputData.m_chunkQuotaLimit = quotaStatistics.m_limit;
+            throughputData.m_chunkQuotaUsedChunks = quotaStatistics.m_usedChunks;
+            throughputData.m_chunkQuotaDeniedRequests = quotaStatistics.m_deniedRequests;
             m_throughputList.emplace_back(throughputData);
             senderInfo.index = index++;
 
@@ -534,11 +695,21 @@ void PortIntrospection<SenderPort, ReceiverPort>::PortData::prepareTopic(
                 if (receiverInfo.portData != nullptr)
                 {
                     ReceiverPort port(receiverInfo.portData);
+                    receiverData.receiverPortID = port.getUniqueID();
                     receiverData.fifoCapacity = port.getDeliveryFiFoCapacity();
                     receiverData.fifoSize = port.getDeliveryFiFoSize();
                     receiverData.subscriptionState = port.getSubscribeState();
                     receiverData.sampleSendCallbackActive = port.AreCallbackReferencesSet();
                     receiverData.propagationScope = port.getCaProServiceDescription().getScope();
+                    receiverData.fifoIndexConflicts = port.getDeliveryFiFoIndexConflicts();
+                    auto& latencyHistogram = port.getLatencyHistogram();
+                    receiverData.latencySampleCount = latencyHistogram.totalCount();
+                    if (receiverData.latencySampleCount > 0u)
+                    {
+                        receiverData.latencyP50Ns = latencyHistogram.percentile(50.);
+                        receiverData.latencyP99Ns = latencyHistogram.percentile(99.);
+                        receiverData.latencyMaxNs = latencyHistogram.maxNs();
+                    }
                 }
                 else
                 {
@@ -572,7 +743,14 @@ bool PortIntrospection<SenderPort, ReceiverPort>::addSender(typename SenderPort:
                                                             const capro::ServiceDescription& service,
                                                             const std::string& runnable)
 {
-    return m_portData.addSender(port, name, service, runnable);
+    PortCommand l_command;
+    l_command.m_type = PortCommand::Type::ADD_SENDER;
+    l_command.m_senderPortData = port;
+    l_command.m_name = name;
+    l_command.m_service = service;
+    l_command.m_runnable = runnable;
+    enqueuePortCommand(l_command);
+    return true;
 }
 
 template <typename SenderPort, typename ReceiverPort>
@@ -581,21 +759,38 @@ bool PortIntrospection<SenderPort, ReceiverPort>::addReceiver(typename ReceiverP
                                                               const capro::ServiceDescription& service,
                                                               const std::string& runnable)
 {
-    return m_portData.addReceiver(portData, name, service, runnable);
+    PortCommand l_command;
+    l_command.m_type = PortCommand::Type::ADD_RECEIVER;
+    l_command.m_receiverPortData = portData;
+    l_command.m_name = name;
+    l_command.m_service = service;
+    l_command.m_runnable = runnable;
+    enqueuePortCommand(l_command);
+    return true;
 }
 
 template <typename SenderPort, typename ReceiverPort>
 bool PortIntrospection<SenderPort, ReceiverPort>::removeSender(const std::string& name,
                                                                const capro::ServiceDescription& service)
 {
-    return m_portData.removeSender(name, service);
+    PortCommand l_command;
+    l_command.m_type = PortCommand::Type::REMOVE_SENDER;
+    l_command.m_name = name;
+    l_command.m_service = service;
+    enqueuePortCommand(l_command);
+    return true;
 }
 
 template <typename SenderPort, typename ReceiverPort>
 bool PortIntrospection<SenderPort, ReceiverPort>::removeReceiver(const std::string& name,
                                                                  const capro::ServiceDescription& service)
 {
-    return m_portData.removeReceiver(name, service);
+    PortCommand l_command;
+    l_command.m_type = PortCommand::Type::REMOVE_RECEIVER;
+    l_command.m_name = name;
+    l_command.m_service = service;
+    enqueuePortCommand(l_command);
+    return true;
 }
 
 
@@ -88,6 +88,16 @@ class ProcessIntrospection
      */
     void registerSenderPort(SenderPort&& f_senderPort);
 
+    /*!
+     * @brief This function registers the shared memory snapshot buffer. With
+     *        every change of the process list the new state is additionally
+     *        written into the buffer, where any number of monitoring
+     *        consumers can sample it without per consumer work
+     *
+     * @param f_snapshotBuffer is the snapshot buffer in the management segment
+     */
+    void registerSnapshotBuffer(concurrent::SnapshotBuffer<ProcessIntrospectionFieldTopic>* f_snapshotBuffer);
+
     /**
      * @brief This function starts a thread which periodically sends
      *        the introspection data to the client. The send interval
@@ -118,6 +128,7 @@ class ProcessIntrospection
     bool m_processListNewData{true}; // true because we want to have a valid field, even with an empty list
 
     SenderPort m_senderPort{nullptr};
+    concurrent::SnapshotBuffer<ProcessIntrospectionFieldTopic>* m_snapshotBuffer{nullptr};
 
     std::atomic<bool> m_runThread;
     std::thread m_thread;
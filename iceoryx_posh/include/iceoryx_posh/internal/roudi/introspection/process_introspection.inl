@@ -197,10 +197,32 @@ void ProcessIntrospection<SenderPort>::send()
         }
         m_processListNewData = false;
 
+        if (nullptr != m_snapshotBuffer)
+        {
+            // in place update of the shared memory snapshot, the topic is too
+            // large for an intermediate copy on the stack
+            m_snapshotBuffer->update([&](ProcessIntrospectionFieldTopic& f_topic) {
+                new (&f_topic) ProcessIntrospectionFieldTopic;
+                for (auto& intrData : m_processList)
+                {
+                    f_topic.m_processList.emplace_back(intrData);
+                }
+            });
+        }
+
         m_senderPort.deliverChunk(chunkHeader);
     }
 }
 
+template <typename SenderPort>
+void ProcessIntrospection<SenderPort>::registerSnapshotBuffer(
+    concurrent::SnapshotBuffer<ProcessIntrospectionFieldTopic>* f_snapshotBuffer)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_snapshotBuffer = f_snapshotBuffer;
+    m_processListNewData = true; // write an initial snapshot with the next send cycle
+}
+
 template <typename SenderPort>
 void ProcessIntrospection<SenderPort>::stop()
 {
@@ -14,9 +14,12 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <cstdio>
+#include <mutex>
 #include <sys/file.h>
 #include <thread>
+#include <vector>
 
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
@@ -65,7 +68,8 @@ class RouDiMultiProcess
     void parseRegisterMessage(const runtime::MqMessage& f_message,
                               int& f_pid,
                               uid_t& f_userId,
-                              int64_t& f_transmissionTimestamp);
+                              int64_t& f_transmissionTimestamp,
+                              uint32_t& f_keepAliveInterval_ms);
 
     /// @brief Handles the registration request from process
     /// @param [in] name of the process which wants to register at roudi; this is equal to the mqueue name
@@ -73,11 +77,14 @@ class RouDiMultiProcess
     /// @param [in] user is the posix user id to which the process belongs
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated mqueue transmission
+    /// @param [in] keepAliveInterval_ms is the keep alive interval the process requested; it is clamped into
+    ///             [PROCESS_KEEP_ALIVE_INTERVAL_MIN, PROCESS_KEEP_ALIVE_INTERVAL_MAX]
     bool registerProcess(const std::string& name,
                          int pid,
                          posix::PosixUser user,
                          int64_t transmissionTimestamp,
-                         const uint64_t sessionId);
+                         const uint64_t sessionId,
+                         uint32_t keepAliveInterval_ms);
 
     /// @brief Creates a unique ID which can be used to check outdated mqueue transmissions
     /// @return a unique, monotonic and consecutive increasing number
@@ -86,6 +93,19 @@ class RouDiMultiProcess
   private:
     void mqThread();
 
+    /// @brief hands a registration request over to the registration pool. The
+    /// worker is selected by a hash of the process name so that a
+    /// re-registration of a process can never overtake its predecessor
+    void enqueueRegistration(const runtime::MqMessage& f_message, const std::string& f_name);
+
+    /// @brief admits the registration requests assigned to one worker of the
+    /// registration pool
+    void registrationWorkerMain(const uint32_t f_workerIndex);
+
+    /// @brief services the shared memory command channels of all registered
+    /// processes; woken by the shared command signal
+    void commandChannelThread();
+
     void processThread();
 
     /// cleanup mqueue, etc.
@@ -112,6 +132,24 @@ class RouDiMultiProcess
   private:
     std::thread m_processManagementThread;
     std::thread m_processMQThread;
+    std::thread m_commandChannelThread;
+
+    /// number of threads which admit registering processes in parallel; the
+    /// admission blocks on the reply mqueue of the starting application, so
+    /// one application which is slow to map its segments must not stall the
+    /// admission of the others behind it
+    static constexpr uint32_t REGISTRATION_WORKER_COUNT{4u};
+
+    /// @brief one worker of the registration pool together with its request
+    /// queue
+    struct RegistrationWorker
+    {
+        std::thread m_thread;
+        std::mutex m_mutex;
+        std::condition_variable m_trigger;
+        std::vector<runtime::MqMessage> m_pending;
+    };
+    RegistrationWorker m_registrationWorkers[REGISTRATION_WORKER_COUNT];
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
@@ -21,17 +21,40 @@
 #include "iceoryx_posh/internal/runtime/message_queue_interface.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/posix_access_rights.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/timing_wheel.hpp"
+#include "iceoryx_utils/posix_wrapper/thread_attributes.hpp"
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <csignal>
 #include <cstdint>
 #include <ctime>
 #include <list>
+#include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace iox
 {
 namespace roudi
 {
+/// @brief priority tier of a process, assigned at registration. The tier orders
+/// the recovery effort of RouDi when processes die: the port reclaimer frees
+/// the chunks of higher tier processes first, so a crashed camera driver stops
+/// blocking its mempools before a crashed logging app is cleaned up. LOW tier
+/// processes are additionally checked for liveness with a relaxed cadence
+/// (PROCESS_LOW_PRIORITY_MONITORING_RELAXATION times their keep alive
+/// interval); HIGH and NORMAL keep the negotiated cadence since the checks
+/// cannot run faster than the application sends its keep alives anyway
+enum class ProcessPriority : uint32_t
+{
+    LOW = 0u,
+    NORMAL = 1u,
+    HIGH = 2u
+};
+
 class RouDiProcess
 {
   public:
@@ -43,12 +66,17 @@ class RouDiProcess
     /// @param [in] isMonitored indicates if the process should be monitored for being alive
     /// @param [in] payloadSegmentId is an identifier for the shm payload segment
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated mqueue transmission
+    /// @param [in] keepAliveInterval_ms is the keep alive interval negotiated at registration
+    /// @param [in] priority is the priority tier of the process; for LOW the
+    /// keep alive interval is relaxed by PROCESS_LOW_PRIORITY_MONITORING_RELAXATION
     RouDiProcess(std::string name,
                  int pid,
                  mepoo::MemoryManager* payloadMemoryManager,
                  bool isMonitored,
                  const uint64_t payloadSegmentId,
-                 const uint64_t sessionId);
+                 const uint64_t sessionId,
+                 const uint32_t keepAliveInterval_ms,
+                 const ProcessPriority priority);
 
     RouDiProcess(const RouDiProcess& other) = delete;
     RouDiProcess& operator=(const RouDiProcess& other) = delete;
@@ -62,6 +90,47 @@ class RouDiProcess
 
     void sendToMQ(const runtime::MqMessage& f_data);
 
+    /// @brief sets the channel on which responses of the current thread are
+    /// routed; the message dispatching threads set it to the channel the
+    /// request arrived on, requests from the mqueue leave it unset so their
+    /// responses travel back over the mqueue
+    /// @param [in] f_replyChannel channel the current request arrived on
+    static void setReplyChannel(runtime::RuntimeCommandChannel* const f_replyChannel);
+
+    /// @brief attaches a shared memory command channel to the process; the
+    /// first one is used for the heartbeat, all of them are released when the
+    /// process is removed
+    /// @param [in] f_commandChannel pointer to the channel in the management segment
+    void addCommandChannel(runtime::RuntimeCommandChannel* const f_commandChannel);
+
+    /// @brief the shared memory command channels of the process
+    /// @return the attached channels, empty if none was assigned
+    const std::vector<runtime::RuntimeCommandChannel*>& getCommandChannels() const;
+
+    /// @brief reads the heartbeat counter of the command channel and refreshes
+    /// the timestamp if the application incremented it since the last check
+    void updateHeartbeat();
+
+    /// @brief hands over the ports which were retained when the previous
+    /// incarnation of this process died; the process reclaims them one by one
+    /// while it recreates its ports
+    /// @param [in] f_senderPorts retained sender ports of the previous incarnation
+    /// @param [in] f_receiverPorts retained receiver ports of the previous incarnation
+    void setReclaimablePorts(const std::vector<SenderPortType::MemberType_t*>& f_senderPorts,
+                             const std::vector<ReceiverPortType::MemberType_t*>& f_receiverPorts);
+
+    /// @brief takes the retained sender port which matches the service out of
+    /// the reclaimable ports
+    /// @param [in] f_service service of the requested sender port
+    /// @return the port of the previous incarnation, nullptr if there is none
+    SenderPortType::MemberType_t* takeReclaimableSenderPort(const capro::ServiceDescription& f_service);
+
+    /// @brief takes a retained receiver port which matches the service out of
+    /// the reclaimable ports
+    /// @param [in] f_service service of the requested receiver port
+    /// @return the port of the previous incarnation, nullptr if there is none
+    ReceiverPortType::MemberType_t* takeReclaimableReceiverPort(const capro::ServiceDescription& f_service);
+
     /// @brief The session ID which is used to check outdated mqueue transmissions for this process
     /// @return the session ID for this process
     uint64_t getSessionId();
@@ -75,14 +144,35 @@ class RouDiProcess
 
     bool isMonitored() const;
 
+    /// @brief the keep alive interval negotiated at registration; the process
+    /// is only checked for liveness with this cadence. For a LOW priority
+    /// process the relaxation of its tier is already applied
+    uint32_t getKeepAliveInterval_ms() const;
+
+    /// @brief the priority tier assigned at registration, see ProcessPriority
+    ProcessPriority getPriority() const;
+
+    /// @brief the keep alive timeout of this process, after this time without
+    /// a keep alive the process counts as dead
+    uint32_t getKeepAliveTimeout_ms() const;
+
   private:
     int m_pid;
     runtime::MqInterfaceUser m_mq;
     mepoo::TimePointNs m_timestamp;
     mepoo::MemoryManager* m_payloadMemoryManager{nullptr};
     bool m_isMonitored{true};
+    uint32_t m_keepAliveInterval_ms;
+    ProcessPriority m_priority{ProcessPriority::NORMAL};
     uint64_t m_payloadSegmentId;
     std::atomic<uint64_t> m_sessionId;
+    std::vector<runtime::RuntimeCommandChannel*> m_commandChannels;
+    uint64_t m_lastHeartbeatCount{0u};
+    std::vector<SenderPortType::MemberType_t*> m_reclaimableSenderPorts;
+    std::vector<ReceiverPortType::MemberType_t*> m_reclaimableReceiverPorts;
+
+    /// channel the request currently dispatched by this thread arrived on
+    static thread_local runtime::RuntimeCommandChannel* s_replyChannel;
 };
 
 class ProcessManagerInterface
@@ -115,10 +205,10 @@ class ProcessManagerInterface
 class ProcessManager : public ProcessManagerInterface
 {
   public:
-    ProcessManager(SharedMemoryManager& f_shmMgr);
-    virtual ~ProcessManager() override
-    {
-    }
+    ProcessManager(SharedMemoryManager& f_shmMgr,
+                   const posix::ThreadAttributes& f_portReclaimerThreadAttributes = posix::ThreadAttributes(
+                       0u, 0, "PortReclaimer"));
+    virtual ~ProcessManager() override;
 
     ProcessManager(const ProcessManager& other) = delete;
     ProcessManager& operator=(const ProcessManager& other) = delete;
@@ -130,12 +220,17 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] isMonitored indicates if the process should be monitored for being alive
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated mqueue transmission
+    /// @param [in] keepAliveInterval_ms is the keep alive interval negotiated at registration
+    /// @param [in] priority is the priority tier ordering the liveness checking
+    /// cadence and the port cleanup when the process dies
     bool registerProcess(const std::string& name,
                          int pid,
                          posix::PosixUser user,
                          bool isMonitored,
                          int64_t transmissionTimestamp,
-                         const uint64_t sessionId);
+                         const uint64_t sessionId,
+                         const uint32_t keepAliveInterval_ms = PROCESS_KEEP_ALIVE_INTERVAL.milliSeconds<uint32_t>(),
+                         const ProcessPriority priority = ProcessPriority::NORMAL);
 
     void killAllProcesses();
 
@@ -149,6 +244,11 @@ class ProcessManager : public ProcessManagerInterface
 
     void addRunnableForProcess(const std::string& f_process, const std::string& f_runnable);
 
+    /// @brief acquires an additional command channel for a process and sends
+    /// its offset back; offset 0 is sent when no channel is left
+    /// @param [in] f_name of the process requesting the channel
+    void createCommandChannelForProcess(const std::string& f_name);
+
     void removeRunnableForProcess(const std::string& f_process, const std::string& f_runnable);
 
     void addReceiverForProcess(const std::string& f_name,
@@ -194,10 +294,18 @@ class ProcessManager : public ProcessManagerInterface
     // END
 
   private:
+    /// @brief searches the process in the shard belonging to its name; the caller
+    /// must hold the mutex of that shard
     RouDiProcess* getProcessFromList(const std::string& f_name);
     void monitorProcesses();
     void discoveryUpdate() override;
 
+    /// @brief makes sure the monitoring interval class for the given keep
+    /// alive interval exists; all processes with the same interval share one
+    /// periodic timing wheel task which marks the class as due
+    /// @param [in] f_keepAliveInterval_ms keep alive interval of the class
+    void ensureMonitoringIntervalClass(const uint32_t f_keepAliveInterval_ms);
+
     /// @param [in] name of the process; this is equal to the mqueue name, which is used for communication
     /// @param [in] pid is the host system process id
     /// @param [in] payloadMemoryManager is a pointer to the payload memory manager for this process
@@ -205,22 +313,109 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] payloadSegmentId is an identifier for the shm payload segment
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated mqueue transmission
+    /// @param [in] keepAliveInterval_ms is the keep alive interval negotiated at registration
+    /// @param [in] priority is the priority tier of the process
     bool addProcess(const std::string& name,
                     int pid,
                     mepoo::MemoryManager* payloadMemoryManager,
                     bool isMonitored,
                     int64_t transmissionTimestamp,
                     const uint64_t payloadSegmentId,
-                    const uint64_t sessionId);
+                    const uint64_t sessionId,
+                    const uint32_t keepAliveInterval_ms,
+                    const ProcessPriority priority);
 
     bool removeProcess(const std::string& f_name);
 
+    /// @brief hands the port cleanup of a dead process over to the background
+    /// reclaimer thread; the monitoring loop continues immediately. The queue
+    /// is kept ordered by priority tier so the chunks of the traffic critical
+    /// processes are freed first, FIFO within one tier
+    /// @param [in] f_name name of the dead process
+    /// @param [in] f_priority priority tier the process registered with
+    void reclaimPortsOfProcessAsync(const std::string& f_name, const ProcessPriority f_priority);
+
+    /// @brief removes a queued reclamation of the process and waits until an
+    /// in-flight one has finished, then deletes any leftover ports synchronously;
+    /// must be called before a process with a pending reclamation is registered
+    /// again so its fresh ports are not swept away
+    /// @param [in] f_name name of the registering process
+    void flushPendingPortReclamation(const std::string& f_name);
+
+    /// main loop of the background reclaimer thread
+    void portReclaimerMain();
+
     SharedMemoryManager& m_shmMgr;
+    /// protects the access to m_shmMgr; when a shard mutex is needed in addition
+    /// it has to be taken after this one
     mutable std::mutex m_mutex;
     /// @todo use a fixed, stack based list once available
     // using ProcessList_t = cxx::list<RouDiProcess, MAX_PROCESS_NUMBER>;
     using ProcessList_t = std::list<RouDiProcess>;
-    ProcessList_t m_processList;
+
+    /// the process table is sharded by a hash of the process name, each shard with
+    /// its own lock; the keep alive handling of a process then only contends with
+    /// its own shard and the monitoring scan never stalls liveness updates of
+    /// processes in the other shards
+    static constexpr uint32_t PROCESS_SHARD_COUNT{8u};
+    struct ProcessShard
+    {
+        mutable std::mutex m_mutex;
+        ProcessList_t m_processList;
+    };
+    ProcessShard& shardFor(const std::string& f_name);
+
+    std::array<ProcessShard, PROCESS_SHARD_COUNT> m_processShards;
+    std::atomic<uint32_t> m_processCount{0u};
+
+    /// every registration hands out the next port id range to the registering
+    /// process (index 0 is reserved for RouDi itself), see BasePortData
+    std::atomic<uint64_t> m_uniqueIdRangeCounter{1u};
+
+    /// the ports of a dead monitored process are not deleted immediately but
+    /// retained for PROCESS_WARM_RESTART_RETENTION; a process which registers
+    /// with the same name within that time reclaims them; guarded by m_mutex
+    struct RetainedProcessPorts
+    {
+        std::string m_name;
+        mepoo::TimePointNs m_timestamp;
+        ProcessPriority m_priority;
+    };
+    std::vector<RetainedProcessPorts> m_retainedPorts;
+
+    /// one entry per distinct keep alive interval; the periodic timing wheel
+    /// task of a class raises m_due with the cadence of its interval, so the
+    /// liveness checks of a process run with the cadence it asked for instead
+    /// of with every monitoring cycle. A class without a timing wheel task
+    /// (task pool exhausted) stays permanently due and degrades to the
+    /// per cycle check. Classes live as long as the ProcessManager, their
+    /// number is bounded by the number of distinct intervals
+    struct MonitoringIntervalClass
+    {
+        uint32_t m_interval_ms{0u};
+        posix::TimingWheel::TaskHandle m_task;
+        bool m_taskRegistered{false};
+        std::atomic<bool> m_due{true};
+    };
+    mutable std::mutex m_monitoringClassesMutex;
+    std::vector<std::unique_ptr<MonitoringIntervalClass>> m_monitoringClasses;
+
+    /// the ports of a dead process whose retention expired are reclaimed on
+    /// this thread, one port per acquisition of m_mutex, so the discovery and
+    /// monitoring loop is not stalled for the duration of the whole cleanup;
+    /// the queue and the in-progress name are guarded by m_portReclaimerMutex
+    struct PendingPortReclamation
+    {
+        std::string m_name;
+        ProcessPriority m_priority;
+    };
+    std::thread m_portReclaimerThread;
+    mutable std::mutex m_portReclaimerMutex;
+    std::condition_variable m_portReclaimerTrigger;
+    /// ordered by descending priority tier, see reclaimPortsOfProcessAsync
+    std::vector<PendingPortReclamation> m_pendingPortReclamations;
+    std::string m_reclamationInProgress;
+    std::atomic_bool m_portReclaimerRunning{true};
 
     ProcessIntrospectionType* m_processIntrospection{nullptr};
 
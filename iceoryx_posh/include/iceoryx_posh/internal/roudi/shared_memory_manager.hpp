@@ -24,19 +24,25 @@
 #include "iceoryx_posh/internal/popo/sender_port.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/port_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/deadline_monitor.hpp"
 #include "iceoryx_posh/internal/runtime/message_queue_message.hpp"
 #include "iceoryx_posh/internal/runtime/runnable_data.hpp"
+#include "iceoryx_posh/internal/runtime/runtime_command_channel.hpp"
 #include "iceoryx_posh/internal/runtime/shared_memory_creator.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_utils/cxx/optional.hpp"
 #include "iceoryx_utils/cxx/vector.hpp"
+#include "iceoryx_utils/internal/concurrent/thread_pool.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_utils/posix_wrapper/futex_signal.hpp"
 
 #include "ac3log/simplelogger.hpp"
 
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace iox
 {
@@ -53,66 +59,196 @@ class FixedPositionContainer
 
     bool hasFreeSpace()
     {
-        if (m_data.capacity() > m_data.size())
-        {
-            return true;
-        }
-
-        for (auto& e : m_data)
-        {
-            if (!e.has_value())
-            {
-                return true;
-            }
-        }
-
-        return false;
+        return m_data.capacity() > m_data.size() || !m_freeIndices.empty();
     }
 
     template <typename... Targs>
     T* insert(Targs&&... args)
     {
-        for (auto& e : m_data)
+        // slots of erased elements are tracked on a free list, therefore no
+        // linear search for a free slot is needed on insert
+        if (!m_freeIndices.empty())
         {
-            if (!e.has_value())
-            {
-                e.emplace(std::forward<Targs>(args)...);
-                return &e.value();
-            }
+            const uint64_t index = m_freeIndices.back();
+            m_freeIndices.pop_back();
+            m_data[index].emplace(std::forward<Targs>(args)...);
+            markOccupied(index);
+            return &m_data[index].value();
         }
 
         m_data.emplace_back();
         m_data.back().emplace(std::forward<Targs>(args)...);
+        markOccupied(m_data.size() - 1u);
         return &m_data.back().value();
     }
 
     void erase(T* const element)
     {
-        for (auto& e : m_data)
+        if (m_data.empty())
         {
-            if (e.has_value() && &e.value() == element)
-            {
-                e.reset();
-                return;
-            }
+            return;
+        }
+
+        // the position of an element within its slot is constant, therefore
+        // the slot index can be calculated instead of searching for it
+        const uint64_t index =
+            static_cast<uint64_t>(reinterpret_cast<const char*>(element) - reinterpret_cast<const char*>(&m_data[0]))
+            / sizeof(cxx::optional<T>);
+        if (index < m_data.size() && m_data[index].has_value() && &m_data[index].value() == element)
+        {
+            m_data[index].reset();
+            m_freeIndices.emplace_back(index);
+            m_occupancy[index / BITS_PER_WORD] &= ~(1ull << (index % BITS_PER_WORD));
         }
     }
 
     cxx::vector<T*, Capacity> content()
     {
+        // the occupancy bitmap is scanned word-wise so the cost of collecting the
+        // live elements tracks their number, not the table capacity; an all-zero
+        // word skips 64 slots without touching any of their cache lines
         cxx::vector<T*, Capacity> returnValue;
-        for (auto& e : m_data)
+        const uint64_t numWords = (m_data.size() + BITS_PER_WORD - 1u) / BITS_PER_WORD;
+        for (uint64_t word = 0u; word < numWords; ++word)
         {
-            if (e.has_value())
+            uint64_t bits = m_occupancy[word];
+            while (bits != 0u)
             {
-                returnValue.emplace_back(&e.value());
+                const uint64_t index =
+                    word * BITS_PER_WORD + static_cast<uint64_t>(__builtin_ctzll(bits));
+                bits &= bits - 1u;
+                returnValue.emplace_back(&m_data[index].value());
             }
         }
         return returnValue;
     }
 
   private:
+    void markOccupied(const uint64_t index)
+    {
+        m_occupancy[index / BITS_PER_WORD] |= 1ull << (index % BITS_PER_WORD);
+    }
+
+    static constexpr uint64_t BITS_PER_WORD{64u};
+
     cxx::vector<cxx::optional<T>, Capacity> m_data;
+    /// indices of erased slots in m_data which can be reused by insert
+    cxx::vector<uint64_t, Capacity> m_freeIndices;
+    /// one bit per slot of m_data, set while the slot holds an element
+    uint64_t m_occupancy[(Capacity + BITS_PER_WORD - 1u) / BITS_PER_WORD]{};
+};
+
+/// @brief hash index over ports keyed on the cached string ID hash of their
+/// service description so CaPro matching only touches ports under the same key
+/// instead of scanning the full port list. Keying on the string hash also
+/// buckets purely string-described services, whose integer IDs are all
+/// InvalidID and would collapse into a single bucket. Lives in RouDi local
+/// memory, the indexed port data stays in the shared memory containers.
+/// Descriptions with a wildcard ID cannot be bucketed and go to a separate
+/// list; candidates returned by a lookup still have to be verified with
+/// ServiceDescription::operator== to guard against hash collisions
+template <typename PortData_t>
+class ServicePortIndex
+{
+  public:
+    void add(PortData_t* const portData)
+    {
+        const auto& service = portData->m_serviceDescription;
+        if (containsWildcard(service))
+        {
+            m_wildcardPorts.push_back(portData);
+        }
+        else
+        {
+            m_ports.emplace(toKey(service), portData);
+        }
+    }
+
+    void remove(PortData_t* const portData)
+    {
+        const auto& service = portData->m_serviceDescription;
+        if (containsWildcard(service))
+        {
+            for (auto it = m_wildcardPorts.begin(); it != m_wildcardPorts.end(); ++it)
+            {
+                if (*it == portData)
+                {
+                    m_wildcardPorts.erase(it);
+                    return;
+                }
+            }
+        }
+        else
+        {
+            auto range = m_ports.equal_range(toKey(service));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second == portData)
+                {
+                    m_ports.erase(it);
+                    return;
+                }
+            }
+        }
+    }
+
+    /// @brief calls the callable for every port which can match the given service
+    /// description; a query containing a wildcard ID degrades to a full scan
+    template <typename Callable>
+    void forEachCandidate(const capro::ServiceDescription& service, const Callable& callable)
+    {
+        forEachKeyedCandidate(service, callable);
+        forEachWildcardPort(callable);
+    }
+
+    /// @brief like forEachCandidate() but visits only the keyed ports; ports
+    /// under different keys are disjoint, so traversals for different services
+    /// may run concurrently as long as the wildcard ports are left out
+    template <typename Callable>
+    void forEachKeyedCandidate(const capro::ServiceDescription& service, const Callable& callable)
+    {
+        if (containsWildcard(service))
+        {
+            for (auto& entry : m_ports)
+            {
+                callable(entry.second);
+            }
+        }
+        else
+        {
+            auto range = m_ports.equal_range(toKey(service));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                callable(it->second);
+            }
+        }
+    }
+
+    /// @brief calls the callable for every port whose service description
+    /// contains a wildcard ID; these can match any service
+    template <typename Callable>
+    void forEachWildcardPort(const Callable& callable)
+    {
+        for (auto portData : m_wildcardPorts)
+        {
+            callable(portData);
+        }
+    }
+
+    static bool containsWildcard(const capro::ServiceDescription& service)
+    {
+        return (capro::AnyService == service.getServiceID()) || (capro::AnyInstance == service.getInstanceID())
+               || (capro::AnyEvent == service.getEventID());
+    }
+
+  private:
+    static uint64_t toKey(const capro::ServiceDescription& service)
+    {
+        return service.getHash();
+    }
+
+    std::unordered_multimap<uint64_t, PortData_t*> m_ports;
+    std::vector<PortData_t*> m_wildcardPorts;
 };
 
 // class residing in Shared memory segment
@@ -142,10 +278,34 @@ class MiddlewareShm
 
     uint64_t m_segmentId{0};
 
+    // persistence support: written by the SharedMemoryCreator when RouDi runs
+    // with persistent shared memory; a restarted RouDi validates these fields
+    // and re-adopts the segment instead of recreating it
+    static constexpr uint64_t PERSISTENCE_MAGIC{0x49435853484D5631u}; // "ICXSHMV1"
+    uint64_t m_persistenceMagic{0u};
+    uint64_t m_requiredShmSize{0u};
+    uint64_t m_generation{0u};
+
     // required to be atomic since a service can be offered or stopOffered while reading
     // this variable in a user application
     std::atomic<uint64_t> m_serviceRegistryChangeCounter{0};
 
+    // wakes the RouDi discovery loop when a port has a pending CaPro state change;
+    // posted by the applications via BasePortData::m_discoverySignal
+    posix::FutexSignal m_discoverySignal;
+
+    // command channels of the registered processes which replace the message
+    // queue for runtime requests after registration
+    FixedPositionContainer<runtime::RuntimeCommandChannel, MAX_PROCESS_NUMBER> m_commandChannels;
+
+    // wakes the RouDi command processing loop when a request was written into
+    // one of the command channels
+    posix::FutexSignal m_commandSignal;
+
+    // seqlock guarded snapshots of the introspection state, updated in place
+    // by RouDi and sampled by any number of monitoring consumers
+    IntrospectionShmSnapshots m_introspectionSnapshots;
+
     static uint64_t getRequiredSharedMemory()
     {
         return sizeof(MiddlewareShm);
@@ -187,11 +347,50 @@ class SharedMemoryManager
     popo::ApplicationPortData* acquireApplicationPortData(Interfaces interface, const std::string& processName);
     runtime::RunnableData* acquireRunnableData(const cxx::CString100& process, const cxx::CString100& runnable);
 
+    /// @brief acquires a command channel for a registering process and connects
+    ///         it to the command signal of the management segment
+    /// @return pointer to the channel, nullptr if no channel is left
+    runtime::RuntimeCommandChannel* acquireCommandChannel();
+    /// @brief returns a command channel of a removed process to the container
+    void releaseCommandChannel(runtime::RuntimeCommandChannel* const channel);
+    /// @brief calls the provided callable for all command channels of the
+    ///         registered processes
+    template <typename Callable>
+    void forEachCommandChannel(const Callable& c)
+    {
+        std::lock_guard<std::mutex> g(m_commandChannelMutex);
+        for (auto channel : m_ShmInterface.getShmInterface()->m_commandChannels.content())
+        {
+            c(channel);
+        }
+    }
+
     bool areAllReceiverPortsSubscribed(std::string appName);
 
     void deletePortsOfProcess(std::string processName);
+
+    /// @brief deletes at most one sender or receiver port of a process; the
+    ///         background reclamation in RouDi uses this to release the chunks
+    ///         of a dead process incrementally, dropping the lock between the
+    ///         ports so discovery is not stalled for the whole cleanup
+    /// @param [in] processName name of the process whose ports shall be deleted
+    /// @return true if a port was deleted, false if the process has none left
+    bool deleteNextPortOfProcess(std::string processName);
+
     void deleteRunnableAndItsPorts(std::string runnableName);
 
+    /// @brief collects the sender and receiver ports which belong to a process;
+    ///         used to hand the retained ports of a dead process over to its
+    ///         next incarnation on a warm restart
+    void collectPortsOfProcess(const std::string& processName,
+                               std::vector<SenderPortType::MemberType_t*>& senderPorts,
+                               std::vector<ReceiverPortType::MemberType_t*>& receiverPorts);
+
+    /// @brief deletes the interface ports, application ports and runnables of a
+    ///         process; these are recreated from scratch on a warm restart while
+    ///         the sender and receiver ports are reclaimed
+    void deleteRuntimeObjectsOfProcess(std::string processName);
+
     void printmempool();
     std::string GetShmAddrString();
     uint64_t getShmSizeInBytes() const;
@@ -223,6 +422,65 @@ class SharedMemoryManager
 
     void sendToAllMatchingInterfacePorts(const capro::CaproMessage& message, const iox::Interfaces& interfaceSource);
 
+    /// number of CaPro messages aggregated per interface port before the fifo
+    /// of the port is touched; a discovery storm then costs one fifo commit
+    /// per batch instead of one per message
+    static constexpr uint32_t INTERFACE_CAPRO_BATCH_SIZE{32u};
+
+    /// CaPro messages collected for one interface port within a discovery
+    /// cycle; pushed into the fifo of the port as one batch
+    struct InterfaceCaproBatch
+    {
+        popo::InterfacePortData* m_portData{nullptr};
+        capro::CaproMessage m_messages[INTERFACE_CAPRO_BATCH_SIZE];
+        uint32_t m_count{0u};
+    };
+
+    /// @brief appends a CaPro message to the batch of an interface port; the
+    ///         batch is pushed when it is full and at the end of the discovery
+    ///         cycle by flushInterfaceCaproBatches()
+    void enqueueToInterfacePort(popo::InterfacePortData* const f_portData, const capro::CaproMessage& f_message);
+
+    /// @brief pushes the collected messages of one interface port with a
+    ///         single fifo commit
+    void flushInterfaceCaproBatch(InterfaceCaproBatch& f_batch);
+
+    /// @brief pushes all outstanding batches; called at the end of every
+    ///         discovery cycle
+    void flushInterfaceCaproBatches();
+
+    /// @brief deletes a single sender port including the service registry and
+    ///         introspection bookkeeping
+    void deleteSenderPort(SenderPortType::MemberType_t* const port, const std::string& processName);
+
+    /// @brief deletes a single receiver port including the deadline monitoring
+    ///         and introspection bookkeeping
+    void deleteReceiverPort(ReceiverPortType::MemberType_t* const port, const std::string& processName);
+
+    /// @brief deletes the given ports in one batch; the serial bookkeeping is
+    ///         done first, then the CaPro disconnect fan-out runs in parallel
+    ///         for groups of ports with disjoint service descriptions so the
+    ///         shutdown of a process with many ports does not stall discovery
+    void deletePortsBatch(const std::vector<SenderPortType::MemberType_t*>& senderPorts,
+                          const std::vector<ReceiverPortType::MemberType_t*>& receiverPorts,
+                          const std::string& processName);
+
+    /// fan-out helpers of deletePortsBatch(); they mirror
+    /// sendToAllMatchingSenderPorts() / sendToAllMatchingReceiverPorts() but are
+    /// safe to run concurrently for service-disjoint groups: the responses are
+    /// collected instead of being reported to the introspection and the wildcard
+    /// ports, which are shared between all groups, can be excluded
+    void sendDisconnectToMatchingSenderPorts(const capro::CaproMessage& message,
+                                             ReceiverPortType& receiverSource,
+                                             const bool includeKeyed,
+                                             const bool includeWildcards,
+                                             std::vector<capro::CaproMessage>& responses);
+
+    void sendDisconnectToMatchingReceiverPorts(const capro::CaproMessage& message,
+                                               SenderPortType& senderSource,
+                                               const bool includeKeyed,
+                                               const bool includeWildcards);
+
     void addEntryToServiceRegistry(const capro::ServiceDescription::IdString& service,
                                    const capro::ServiceDescription::IdString& instance) noexcept;
     void removeEntryFromServiceRegistry(const capro::ServiceDescription::IdString& service,
@@ -234,6 +492,27 @@ class SharedMemoryManager
     ServiceRegistry m_serviceRegistry;
 
     PortIntrospectionType m_portIntrospection;
+
+    /// RouDi local hash indices so a CaproMessage dispatch only visits the
+    /// ports whose service description can match instead of the full port lists
+    ServicePortIndex<SenderPortType::MemberType_t> m_senderPortIndex;
+    ServicePortIndex<ReceiverPortType::MemberType_t> m_receiverPortIndex;
+
+    // deadline QoS tracking of the receiver ports, armed when a subscription
+    // requesting a deadline is processed
+    DeadlineMonitor m_deadlineMonitor;
+
+    /// workers for the disconnect fan-out of terminating processes; created on
+    /// the first port teardown with enough independent service groups to split
+    cxx::optional<concurrent::ThreadPool> m_portTeardownPool;
+
+    /// protects the command channel container which is accessed by the
+    /// registration handling and the command processing loop
+    std::mutex m_commandChannelMutex;
+
+    /// per interface port aggregation of the CaPro messages of one discovery
+    /// cycle; only touched by the discovery loop
+    cxx::vector<InterfaceCaproBatch, MAX_INTERFACE_NUMBER> m_interfaceCaproBatches;
 };
 
 } // namespace roudi
@@ -0,0 +1,185 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/iceoryx_posh_config.hpp"
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_posh/internal/roudi_environment/roudi_environment.hpp"
+#include "iceoryx_posh/mepoo/chunk_info.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/posix_access_rights.hpp"
+
+#include <chrono>
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief deterministic time source for performance fixtures; now() only moves
+///        when the test advances it, so timing dependent logic under test runs
+///        the same way on every machine and CI run
+class ManualClock
+{
+  public:
+    mepoo::TimePointNs now() const
+    {
+        return mepoo::TimePointNs(mepoo::DurationNs(m_nowNs));
+    }
+
+    void advance(const uint64_t f_deltaNs)
+    {
+        m_nowNs += static_cast<int64_t>(f_deltaNs);
+    }
+
+  private:
+    int64_t m_nowNs{0};
+};
+
+/// @brief result of a measurement run; cycles are raw TSC readings on x86 and
+///        nanoseconds on other architectures
+struct PerfMeasurement
+{
+    uint64_t m_iterations{0u};
+    uint64_t m_totalCycles{0u};
+    uint64_t m_totalNs{0u};
+
+    uint64_t cyclesPerIteration() const
+    {
+        return (m_iterations == 0u) ? 0u : m_totalCycles / m_iterations;
+    }
+
+    uint64_t nsPerIteration() const
+    {
+        return (m_iterations == 0u) ? 0u : m_totalNs / m_iterations;
+    }
+};
+
+/// @brief cycle accurate measurement helper for tight in-process loops
+class CycleTimer
+{
+  public:
+    static uint64_t readCycleCounter()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        uint32_t lo;
+        uint32_t hi;
+        // rdtsc is not serializing, for the repeated-iteration measurements
+        // here the pipeline skew is amortized over the loop
+        asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+        return (static_cast<uint64_t>(hi) << 32) | lo;
+#else
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+#endif
+    }
+
+    /// @brief runs f_callable f_iterations times and measures the whole run in
+    ///        cycles and wall clock nanoseconds
+    template <typename Callable>
+    static PerfMeasurement measure(const uint64_t f_iterations, const Callable& f_callable)
+    {
+        PerfMeasurement measurement;
+        measurement.m_iterations = f_iterations;
+
+        const auto startNs = std::chrono::steady_clock::now();
+        const uint64_t startCycles = readCycleCounter();
+        for (uint64_t i = 0u; i < f_iterations; ++i)
+        {
+            f_callable();
+        }
+        measurement.m_totalCycles = readCycleCounter() - startCycles;
+        measurement.m_totalNs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startNs).count());
+        return measurement;
+    }
+};
+
+/// @brief a connected SenderPort/ReceiverPort pair created by the perf fixture
+struct PortPair
+{
+    popo::SenderPort m_sender{nullptr};
+    popo::ReceiverPort m_receiver{nullptr};
+};
+
+/// @brief performance fixture on top of the in-process RouDiEnvironment: one
+///        RouDi, one application runtime and factories for connected port
+///        pairs, so SenderPort to ReceiverPort paths can be measured in a unit
+///        test without spawning processes or attaching external shared memory
+///        per run
+class PerfTestEnvironment
+{
+  public:
+    /// @brief starts an in-process RouDi with a single mempool
+    /// @param [in] f_chunkSize size of the chunks in the mempool
+    /// @param [in] f_chunkCount number of chunks in the mempool
+    /// @param [in] f_appName name of the application runtime
+    PerfTestEnvironment(const uint32_t f_chunkSize = 256u,
+                        const uint32_t f_chunkCount = 1024u,
+                        const std::string& f_appName = "/perftest")
+        : m_roudiEnv(createConfig(f_chunkSize, f_chunkCount))
+        , m_runtime(&runtime::PoshRuntime::getInstance(f_appName))
+    {
+    }
+
+    /// @brief creates a sender/receiver pair on the given service, subscribed
+    ///        and activated; ready for deliverChunk/getChunk measurements
+    /// @param [in] f_service service of the pair
+    /// @param [in] f_deliverySize receiver queue size for the subscription
+    PortPair createPortPair(const capro::ServiceDescription& f_service,
+                            const uint32_t f_deliverySize = MAX_RECEIVER_QUEUE_SIZE)
+    {
+        PortPair pair;
+        pair.m_sender = popo::SenderPort(m_runtime->getMiddlewareSender(f_service));
+        pair.m_receiver = popo::ReceiverPort(m_runtime->getMiddlewareReceiver(f_service));
+
+        pair.m_receiver.subscribe(true, f_deliverySize);
+        pair.m_sender.activate();
+        // let the in-process discovery connect the pair
+        m_roudiEnv.InterOpWait();
+        return pair;
+    }
+
+    RouDiEnvironment& getRouDiEnvironment()
+    {
+        return m_roudiEnv;
+    }
+
+    /// @brief the deterministic clock of this fixture, to be advanced by the test
+    ManualClock& getManualClock()
+    {
+        return m_manualClock;
+    }
+
+  private:
+    static RouDiConfig_t createConfig(const uint32_t f_chunkSize, const uint32_t f_chunkCount)
+    {
+        mepoo::MePooConfig mempoolConfig;
+        mempoolConfig.m_mempoolConfig.push_back({f_chunkSize, f_chunkCount});
+        auto currentGroup = posix::PosixGroup::getGroupOfCurrentProcess();
+        RouDiConfig_t roudiConfig;
+        roudiConfig.m_sharedMemorySegments.push_back({currentGroup.getName(), currentGroup.getName(), mempoolConfig});
+        return roudiConfig;
+    }
+
+    RouDiEnvironment m_roudiEnv;
+    runtime::PoshRuntime* m_runtime{nullptr};
+    ManualClock m_manualClock;
+};
+
+} // namespace roudi
+} // namespace iox
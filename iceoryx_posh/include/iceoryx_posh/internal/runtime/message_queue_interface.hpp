@@ -64,6 +64,8 @@ enum class MqMessageType : int32_t
     REPLAY,
     SERVICE_REGISTRY_CHANGE_COUNTER,
     MESSAGE_NOT_SUPPORTED,
+    CREATE_COMMAND_CHANNEL,
+    CREATE_COMMAND_CHANNEL_ACK,
     // etc..
     END,
 };
@@ -99,6 +101,22 @@ std::string mqMessageErrorTypeToString(const MqMessageErrorType msg) noexcept;
 class MqInterfaceUser;
 class MqInterfaceCreator;
 
+/// @brief Transport backend used by MqBase and its children. The posix
+///         message queue is the default. On platforms with a weak posix mq
+///         implementation the unix domain socket and the shared memory ring
+///         backend provide a faster control plane with a deeper queue, which
+///         avoids registration retries when many applications start at once.
+enum class MqTransportType : uint32_t
+{
+    PosixMq,
+    UnixDomainSocket,
+    ShmRing
+};
+
+/// ring buffer living in a shared memory segment, defined in the translation
+/// unit since it is an implementation detail of the ShmRing transport
+struct MqShmRing;
+
 /// @brief Base-Class should never be used by the end-user.
 ///     Handles the common properties and methods for the childs but does
 ///     not call mq_open, mq_close, mq_link or mq_unlink. The handling of
@@ -125,6 +143,15 @@ class MqBase
     ///         It also returns false if clock_gettime() failed
     bool timedReceive(const uint32_t timeout_ms, MqMessage& answer) const noexcept;
 
+    /// @brief Tries to receive a message from the message queue without
+    ///         blocking and stores it in answer; meant for draining the
+    ///         queue after a blocking receive already signalled pending
+    ///         messages.
+    /// @param[out] answer If a message is received it is stored there.
+    /// @return true if a valid message was pending, false if the queue
+    ///             was empty or receiving failed
+    bool tryReceive(MqMessage& answer) const noexcept;
+
     /// @brief Tries to send the message specified in msg.
     /// @param[in] msg Must be a valid message, if its an invalid message
     ///                 send will return false
@@ -185,7 +212,10 @@ class MqBase
     MqBase() = delete;
     // TODO: unique identifier problem, multiple MqBase objects with the
     //        same InterfaceName are using the same message queue
-    MqBase(const std::string& InterfaceName, const long maxMessages, const long messageSize) noexcept;
+    MqBase(const std::string& InterfaceName,
+           const long maxMessages,
+           const long messageSize,
+           const MqTransportType transport = MqTransportType::PosixMq) noexcept;
 
     MqBase(const MqBase&) = default;
     MqBase(MqBase&&) = default;
@@ -228,6 +258,32 @@ class MqBase
     ///             otherwise false.
     bool hasClosableMessageQueue() const noexcept;
 
+    /// @brief Opens the posix message queue backend with mq_open
+    bool openPosixMq(const std::string& name, const int oflag) noexcept;
+
+    /// @brief Opens the unix domain socket backend; with O_CREAT a stale
+    ///         socket file is removed and the socket is bound, without
+    ///         O_CREAT the socket is connected which fails like mq_open when
+    ///         the remote end does not exist
+    bool openUnixDomainSocket(const int oflag) noexcept;
+
+    /// @brief Opens the shared memory ring backend; with O_CREAT the segment
+    ///         is created and the ring is (re-)initialized, a stale ring of a
+    ///         previous run is discarded
+    bool openShmRing(const std::string& name, const int oflag) noexcept;
+
+    /// @brief Sends size bytes (including the null terminator) via the shared
+    ///         memory ring, blocking when the ring is full
+    /// @param[in] absTimeout absolute timeout, nullptr blocks indefinitely
+    bool sendToShmRing(const char* buffer, const size_t size, const timespec* absTimeout) const noexcept;
+
+    /// @brief Receives a message from the shared memory ring
+    /// @param[in] absTimeout absolute timeout, nullptr blocks indefinitely
+    bool receiveFromShmRing(MqMessage& answer, const timespec* absTimeout) const noexcept;
+
+    /// @brief File system path of the unix domain socket backend
+    std::string socketPath() const noexcept;
+
   protected:
     static constexpr long MQ_FLAGS = 0;    // ignored by mq_open
     static constexpr long MQ_CUR_MSGS = 0; // ignored by mq_open
@@ -248,6 +304,11 @@ class MqBase
     int m_oflag{O_RDONLY};
     mqd_t m_roudiMq{-1};
     std::string m_interfaceName;
+
+    MqTransportType m_transportType{MqTransportType::PosixMq};
+    /// socket or shared memory descriptor, depending on the transport
+    int m_transportFd{-1};
+    MqShmRing* m_ring{nullptr};
 };
 
 /// @brief Class for handling a message queue via mq_open and mq_close.
@@ -262,9 +323,11 @@ class MqInterfaceUser : public MqBase
     ///         is used for mq_open
     /// @param[in] maxMessages maximum number of queued messages
     /// @param[in] message size maximum message size
+    /// @param[in] transport transport backend which carries the messages
     MqInterfaceUser(const std::string& name,
                     const long maxMessages = APP_MAX_MESSAGES,
-                    const long messageSize = APP_MESSAGE_SIZE) noexcept;
+                    const long messageSize = APP_MESSAGE_SIZE,
+                    const MqTransportType transport = MqTransportType::PosixMq) noexcept;
 
     /// @brief The copy constructor and assignment operator are deleted since
     ///         this class manages a resource (message queue) which cannot
@@ -298,9 +361,11 @@ class MqInterfaceCreator : public MqBase
     ///         is used for mq_open
     /// @param[in] maxMessages maximum number of queued messages
     /// @param[in] message size maximum message size
+    /// @param[in] transport transport backend which carries the messages
     MqInterfaceCreator(const std::string& name,
                        const long maxMessages = ROUDI_MAX_MESSAGES,
-                       const long messageSize = ROUDI_MESSAGE_SIZE) noexcept;
+                       const long messageSize = ROUDI_MESSAGE_SIZE,
+                       const MqTransportType transport = MqTransportType::PosixMq) noexcept;
 
     /// @brief The copy constructor and assignment operator is deleted since
     ///         this class manages a resource (message queue) which cannot
@@ -327,9 +392,11 @@ class MqRuntimeInterface
     /// @param[in] roudiName name of the RouDi message queue
     /// @param[in] appName name of the appplication and its message queue
     /// @param[in] roudiWaitingTimeout timeout for searching the RouDi message queue
+    /// @param[in] keepAliveInterval keep alive interval requested from RouDi with the registration
     MqRuntimeInterface(const std::string& roudiName,
                        const std::string& appName,
-                       const units::Duration roudiWaitingTimeout) noexcept;
+                       const units::Duration roudiWaitingTimeout,
+                       const units::Duration keepAliveInterval = PROCESS_KEEP_ALIVE_INTERVAL) noexcept;
 
     MqRuntimeInterface(const MqRuntimeInterface&) = delete;
     MqRuntimeInterface& operator=(const MqRuntimeInterface&) = delete;
@@ -368,6 +435,19 @@ class MqRuntimeInterface
     /// @return segment id
     uint64_t getSegmentId() const noexcept;
 
+    /// @brief get the offset of the command channel in the management segment
+    /// @return offset, 0 if RouDi did not provide a command channel
+    uint64_t getCommandChannelOffset() const noexcept;
+
+    /// @brief get the index of the port id range RouDi handed out at registration
+    /// @return range index, unique per registered process
+    uint64_t getUniqueIdRangeIndex() const noexcept;
+
+    /// @brief get the offset of the introspection snapshot region in the
+    ///         management segment
+    /// @return offset, 0 if RouDi did not provide the snapshot region
+    uint64_t getIntrospectionSnapshotsOffset() const noexcept;
+
   private:
     enum class RegAckResult
     {
@@ -391,6 +471,9 @@ class MqRuntimeInterface
     MqInterfaceUser m_RoudiMqInterface;
     size_t m_shmTopicSize{0};
     uint64_t m_segmentId{0};
+    uint64_t m_commandChannelOffset{0};
+    uint64_t m_uniqueIdRangeIndex{0};
+    uint64_t m_introspectionSnapshotsOffset{0};
 };
 } // namespace runtime
 } // namespace iox
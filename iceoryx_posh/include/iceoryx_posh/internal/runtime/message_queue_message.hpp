@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 
 #include <cstdint>
@@ -36,9 +37,20 @@ namespace runtime
 ///    separator. A message is defined as valid if all entries contained in
 ///    that message are valid and it ends with the separator or it is empty,
 ///    otherwise it is defined as invalid.
+///
+///    The message is kept in a fixed size buffer which matches the size of
+///    the underlying transports, therefore building and parsing a message
+///    does not allocate dynamic memory and a MqMessage can be placed in
+///    shared memory. A message which would exceed the buffer becomes
+///    invalid.
 class MqMessage
 {
   public:
+    /// maximum size of the separator separated string including the null
+    /// terminator; matches the message size of the message queues and the
+    /// command channel so that every valid MqMessage fits on the wire
+    static constexpr uint32_t MAX_MESSAGE_SIZE{static_cast<uint32_t>(ROUDI_MESSAGE_SIZE)};
+
     /// @brief Creates an empty and valid message queue message.
     MqMessage() = default;
 
@@ -91,6 +103,17 @@ class MqMessage
     /// @return the current message as separator separated string
     std::string getMessage() const noexcept;
 
+    /// @brief Direct read access to the separator separated string. The
+    ///        buffer is always null terminated so it can be handed to the
+    ///        message queue without creating a temporary std::string.
+    /// @return pointer to the message buffer
+    const char* getMessageBuffer() const noexcept;
+
+    /// @brief size of the separator separated string without the null
+    ///        terminator
+    /// @return size of the current message
+    uint32_t getMessageSize() const noexcept;
+
     /// @brief Takes a separator separated string and interprets it as
     ///      a MqMessage. In this case the MqMessage can only become
     ///      invalid if it is not empty and does not end with the separator.
@@ -116,8 +139,25 @@ class MqMessage
     bool operator==(const MqMessage& rhs) const noexcept;
 
   private:
+    /// appends a validated entry followed by the separator to the buffer;
+    /// if it does not fit the message becomes invalid
+    void append(const char* f_entry, const size_t f_entrySize) noexcept;
+
+    /// overloads for the entry types used on the hot path which convert
+    /// without dynamic memory; everything else falls back to the
+    /// std::stringstream conversion of the template
+    void appendEntry(const std::string& entry) noexcept;
+    void appendEntry(const char* const entry) noexcept;
+    void appendEntry(const int32_t entry) noexcept;
+    void appendEntry(const uint32_t entry) noexcept;
+    void appendEntry(const int64_t entry) noexcept;
+    void appendEntry(const uint64_t entry) noexcept;
+    template <typename T>
+    void appendEntry(const T& entry) noexcept;
+
     static const char m_separator; // default value is ,
-    std::string m_msg;
+    char m_msg[MAX_MESSAGE_SIZE]{};
+    uint32_t m_size{0};
     bool m_isValid{true};
     uint32_t m_numberOfElements{0};
 };
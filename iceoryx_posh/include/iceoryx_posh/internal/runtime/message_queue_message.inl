@@ -20,20 +20,17 @@ namespace runtime
 {
 template <typename T>
 void MqMessage::addEntry(const T& entry) noexcept
+{
+    appendEntry(entry);
+}
+
+template <typename T>
+void MqMessage::appendEntry(const T& entry) noexcept
 {
     std::stringstream newEntry;
     newEntry << entry;
-
-    if (!isValidEntry(newEntry.str()))
-    {
-        LogError() << "\'" << newEntry.str().c_str() << "\' is an invalid message queue entry";
-        m_isValid = false;
-    }
-    else
-    {
-        m_msg.append(newEntry.str() + m_separator);
-        ++m_numberOfElements;
-    }
+    const std::string converted = newEntry.str();
+    append(converted.c_str(), converted.size());
 }
 
 template <typename T>
@@ -0,0 +1,112 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/message_queue_message.hpp"
+#include "iceoryx_utils/internal/concurrent/fifo.hpp"
+#include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
+#include "iceoryx_utils/posix_wrapper/futex_signal.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Bidirectional shared memory command channel between an application
+///         runtime and RouDi which replaces the message queue for runtime
+///         requests after the registration handshake. The channel is placed
+///         in the management segment by RouDi; the application receives its
+///         offset with the REG_ACK and accesses it via the relative pointer
+///         mechanism. Requests are written by the application and read by
+///         RouDi, responses the other way round, so each ring has exactly
+///         one producer and one consumer. Since the MqMessage keeps its
+///         payload in a fixed size buffer it is transferred as is, no
+///         serialization or dynamic memory is involved.
+class RuntimeCommandChannel
+{
+  public:
+    /// @brief writes a request for RouDi into the channel and posts the
+    ///         request signal; called by the application
+    /// @param[in] f_message request to transfer
+    /// @return false if the message is invalid or the channel is full,
+    ///         true otherwise
+    bool sendRequest(const MqMessage& f_message) noexcept;
+
+    /// @brief reads the next pending request; called by RouDi
+    /// @param[out] f_message filled with the request on success
+    /// @return true if there was a valid pending request, false otherwise
+    bool tryGetRequest(MqMessage& f_message) noexcept;
+
+    /// @brief writes a response for the application into the channel and
+    ///         wakes the waiting application; called by RouDi
+    /// @param[in] f_message response to transfer
+    /// @return false if the message is invalid or the channel is full,
+    ///         true otherwise
+    bool sendResponse(const MqMessage& f_message) noexcept;
+
+    /// @brief blocks until a response is available or the timeout expired;
+    ///         called by the application
+    /// @param[out] f_answer filled with the response on success
+    /// @param[in] f_timeoutMs timeout in milliseconds
+    /// @return true if a valid response was received, false otherwise
+    bool waitForResponse(MqMessage& f_answer, const uint32_t f_timeoutMs) noexcept;
+
+    /// @brief transfers a batch of requests and collects their responses; the
+    ///         request ring is kept as full as possible so RouDi processes the
+    ///         batch back to back without a round trip per request. Responses
+    ///         arrive in request order. Only usable for requests which are
+    ///         answered with exactly one response
+    /// @param[in] f_requests requests to transfer
+    /// @param[out] f_answers filled with one response per request
+    /// @param[in] f_timeoutMs timeout in milliseconds per response
+    /// @return true if all requests were answered with a valid response
+    bool transferRequestBatch(const std::vector<MqMessage>& f_requests,
+                              std::vector<MqMessage>& f_answers,
+                              const uint32_t f_timeoutMs) noexcept;
+
+    /// @brief connects the channel to the signal which wakes the RouDi
+    ///         command processing loop; set by RouDi on channel creation
+    /// @param[in] f_requestSignal signal to post when a request was written
+    void setRequestSignal(posix::FutexSignal* const f_requestSignal) noexcept;
+
+    /// @brief increments the heartbeat counter to signal liveness; called
+    ///         periodically by the application instead of sending a keep
+    ///         alive message
+    void sendHeartbeat() noexcept;
+
+    /// @brief the current value of the heartbeat counter; scanned by the
+    ///         RouDi process monitoring
+    /// @return heartbeat counter value
+    uint64_t getHeartbeatCount() const noexcept;
+
+  private:
+    concurrent::FiFo<MqMessage, COMMAND_CHANNEL_CAPACITY> m_requests;
+    concurrent::FiFo<MqMessage, COMMAND_CHANNEL_CAPACITY> m_responses;
+
+    /// wakes the RouDi command processing loop; shared by all channels and
+    /// living in the management segment
+    iox::relative_ptr<posix::FutexSignal> m_requestSignal;
+    /// wakes the application waiting for a response; exclusive to this channel
+    posix::FutexSignal m_responseSignal;
+    /// incremented by the application, read by the RouDi process monitoring
+    std::atomic<uint64_t> m_heartbeat{0u};
+};
+
+} // namespace runtime
+} // namespace iox
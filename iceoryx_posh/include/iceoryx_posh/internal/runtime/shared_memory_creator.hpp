@@ -20,6 +20,7 @@
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
+#include "iceoryx_posh/roudi/startup_profiler.hpp"
 #include "iceoryx_utils/cxx/helplets.hpp"
 #include "iceoryx_utils/cxx/optional.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object.hpp"
@@ -66,6 +67,12 @@ class SharedMemoryCreator
     uint64_t getSegmentId() const noexcept;
 
   private:
+    /// @brief tries to re-adopt the management segment of a crashed RouDi
+    ///        instance including a remap of its payload segments
+    /// @param[in] totalSharedMemorySize the size the current configuration requires
+    /// @return true if the segment was adopted, false if a fresh one has to be created
+    bool tryAdoptExistingShm(const uint64_t totalSharedMemorySize) noexcept;
+
     cxx::optional<posix::SharedMemoryObject> m_shmObject;
     ShmType* m_shmTypePtr{nullptr};
 };
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "iceoryx_posh/runtime/posh_domain.hpp"
+
 #include <cstdlib>
 #include <cstring>
 #include <signal.h>
@@ -62,13 +64,20 @@ inline SharedMemoryCreator<ShmType>::SharedMemoryCreator(const RouDiConfig_t& co
     newAct.sa_handler = sigbusHandler;
     newAct.sa_flags = 0;
     sigaction(SIGBUS, &newAct, &oldAct);
-    
+
+    if (config.roudi.m_persistentShm && tryAdoptExistingShm(totalSharedMemorySize))
+    {
+        // unregister signal handler
+        sigaction(SIGBUS, &oldAct, nullptr);
+        return;
+    }
+
     // we let the OS decide where to map the shm segments
     constexpr void* BASE_ADDRESS_HINT{nullptr};
 
     // create and map a shared memory region
     m_shmObject = posix::SharedMemoryObject::create(
-        SHM_NAME, totalSharedMemorySize, posix::AccessMode::readWrite, posix::OwnerShip::mine, BASE_ADDRESS_HINT);
+        PoshDomain::getMgmtShmName(), totalSharedMemorySize, posix::AccessMode::readWrite, posix::OwnerShip::mine, BASE_ADDRESS_HINT);
 
     if (!m_shmObject.has_value())
     {
@@ -86,6 +95,7 @@ inline SharedMemoryCreator<ShmType>::SharedMemoryCreator(const RouDiConfig_t& co
     LogInfo() << "Roudi registered management segment "
               << iox::log::HexFormat(reinterpret_cast<uint64_t>(m_shmObject->getBaseAddress())) << " with size "
               << m_shmObject->getSizeInBytes() << " to id " << managementSegmentId;
+    roudi::StartupProfiler::instance().phaseDone("management segment creation");
 
     // now construct our POSH shared memory object
     m_shmTypePtr = static_cast<ShmType*>(m_shmObject->allocate(sizeof(ShmType)));
@@ -96,20 +106,85 @@ inline SharedMemoryCreator<ShmType>::SharedMemoryCreator(const RouDiConfig_t& co
         config.roudi.m_verifySharedMemoryPlacement);
 
     m_shmTypePtr->m_segmentId = managementSegmentId;
+    roudi::StartupProfiler::instance().phaseDone("management segment init");
 
     m_shmTypePtr->m_roudiMemoryManager.configureMemoryManager(
         mempoolConfig, m_shmObject->getAllocator(), m_shmObject->getAllocator());
     m_shmObject->finalizeAllocation();
+    roudi::StartupProfiler::instance().phaseDone("introspection mempool init");
+
+    if (config.roudi.m_persistentShm)
+    {
+        m_shmTypePtr->m_requiredShmSize = totalSharedMemorySize;
+        m_shmTypePtr->m_generation = 1u;
+        // written last; only a fully initialized segment may be adopted
+        m_shmTypePtr->m_persistenceMagic = ShmType::PERSISTENCE_MAGIC;
+    }
 
     // unregister signal handler
     sigaction(SIGBUS, &oldAct, nullptr);
 }
 
+template <typename ShmType>
+inline bool SharedMemoryCreator<ShmType>::tryAdoptExistingShm(const uint64_t totalSharedMemorySize) noexcept
+{
+    // we let the OS decide where to map the segment; the content is fully
+    // relocatable and is accessed via relative pointers
+    constexpr void* BASE_ADDRESS_HINT{nullptr};
+
+    auto shmObject = posix::SharedMemoryObject::create(PoshDomain::getMgmtShmName(),
+                                                       totalSharedMemorySize,
+                                                       posix::AccessMode::readWrite,
+                                                       posix::OwnerShip::openExisting,
+                                                       BASE_ADDRESS_HINT);
+    if (!shmObject.has_value() || nullptr == shmObject->getBaseAddress())
+    {
+        LogInfo() << "No management segment found to adopt, creating a fresh one";
+        return false;
+    }
+
+    ShmType* shmTypePtr = static_cast<ShmType*>(shmObject->getBaseAddress());
+    if (shmTypePtr->m_persistenceMagic != ShmType::PERSISTENCE_MAGIC
+        || shmTypePtr->m_requiredShmSize != totalSharedMemorySize)
+    {
+        LogWarn() << "Existing management segment does not match the current configuration, creating a fresh one";
+        return false;
+    }
+
+    if (!RelativePointer::registerPtr(static_cast<RelativePointer::id_t>(shmTypePtr->m_segmentId),
+                                      shmObject->getBaseAddress(),
+                                      totalSharedMemorySize))
+    {
+        LogWarn() << "Unable to register the adopted management segment to its previous id, creating a fresh one";
+        return false;
+    }
+
+    if (!shmTypePtr->m_segmentManager.remapSegmentsForAdoption())
+    {
+        LogWarn() << "Unable to remap the payload segments, creating fresh segments";
+        RelativePointer::unregisterPtr(static_cast<RelativePointer::id_t>(shmTypePtr->m_segmentId));
+        return false;
+    }
+
+    m_shmObject = std::move(shmObject);
+    m_shmTypePtr = shmTypePtr;
+    m_shmTypePtr->m_generation++;
+
+    LogInfo() << "Roudi adopted management segment "
+              << iox::log::HexFormat(reinterpret_cast<uint64_t>(m_shmObject->getBaseAddress())) << " with size "
+              << m_shmObject->getSizeInBytes() << " at id " << m_shmTypePtr->m_segmentId << ", generation "
+              << m_shmTypePtr->m_generation;
+    roudi::StartupProfiler::instance().phaseDone("management segment adoption");
+    return true;
+}
+
 template <typename ShmType>
 inline SharedMemoryCreator<ShmType>::~SharedMemoryCreator() noexcept
 {
     if (m_shmTypePtr)
     {
+        // a destructed segment must never be adopted on the next start
+        m_shmTypePtr->m_persistenceMagic = 0u;
         m_shmTypePtr->~ShmType();
     }
 }
@@ -15,6 +15,7 @@
 #pragma once
 
 #include "iceoryx_posh/mepoo/chunk_info.hpp"
+#include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
 
 #include <atomic>
 #include <chrono>
@@ -40,11 +41,64 @@ struct alignas(32) ChunkHeader
         return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(this) + sizeof(ChunkHeader));
     }
 
-    /// @todo this is a temporary dummy variable to keep the size of the ChunkHeader at 64 byte for compatibility
-    /// reasons
-    void* m_payloadDummy{nullptr};
+#ifndef IOX_COMPACT_CHUNK_HEADER
+    /// @brief scatter-gather support: location of the ChunkManagement of the next
+    /// chunk when this chunk is the head of a composite sample spanning several
+    /// pool chunks; NULL_POINTER_OFFSET marks the end of a chain. The chain holds
+    /// one reference on the next chunk which is released together with this chunk.
+    /// The compact chunk header has no room for the link, chunk chaining is
+    /// therefore only available with the standard 64 byte header
+    RelativePointer::id_t m_nextChunkSegmentId{RelativePointer::NULL_POINTER_ID};
+    RelativePointer::offset_t m_nextChunkOffset{RelativePointer::NULL_POINTER_OFFSET};
+
+    /// @brief request/response correlation of the client and server ports; the
+    /// server copies the id of a request into the matching response
+    std::uint64_t m_correlationId{0u};
+
+    /// @brief CRC32C of the payload, stamped by the sender port on delivery
+    /// when the integrity mode of the topic is enabled; INTEGRITY_CRC_PRESENT
+    /// in m_integrityFlags marks a valid checksum. The compact chunk header
+    /// has no room for the checksum, integrity mode therefore needs the
+    /// standard 64 byte header
+    std::uint32_t m_payloadCrc{0u};
+    std::uint32_t m_integrityFlags{0u};
+
+    static constexpr std::uint32_t INTEGRITY_CRC_PRESENT{1u};
+
+    /// @brief true when this chunk is followed by another chunk of the same sample
+    bool hasNextChunk() const;
+
+    /// @brief follow the chain of a composite sample
+    /// @return chunk header of the next chunk, nullptr at the end of the chain
+    ChunkHeader* nextChunk() const;
+#endif
+
+    /// @brief stores the request/response correlation id; with the compact chunk
+    /// header the id is carried in ChunkInfo::m_sequenceNumber and truncated to
+    /// 32 bit
+    void setCorrelationId(const std::uint64_t f_correlationId);
+
+    /// @brief the request/response correlation id of this chunk
+    std::uint64_t correlationId() const;
+
+    /// @brief the transport level sequence number of this sample; stamped by the
+    /// sender port on delivery with one increment per delivered chunk, so a
+    /// receiver can detect loss and reordering generically instead of carrying
+    /// an own counter in the payload. When the application set an external
+    /// sequence number (m_externalSequenceNumber_bl) that one is returned
+    SequenceNumberType sequenceNumber() const;
 };
 
+/// building with -DCOMPACT_CHUNK_HEADER=ON drops the compatibility padding and halves
+/// the per-chunk overhead, which doubles cache density for small-sample topics; the
+/// option changes the shared memory layout and therefore has to be set consistently
+/// for every application of the whole stack
+#ifdef IOX_COMPACT_CHUNK_HEADER
+static_assert(sizeof(ChunkHeader) == 32, "compact ChunkHeader must be 32 bytes");
+#else
+static_assert(sizeof(ChunkHeader) == 64, "ChunkHeader must be 64 bytes for compatibility");
+#endif
+
 ChunkHeader* convertPayloadPointerToChunkHeader(void* const payload) noexcept;
 
 } // namespace mepoo
@@ -33,9 +33,36 @@ using SamplesCounterType = std::uint8_t;       // AGR counter for send and recei
 using DurationNs = std::chrono::duration<std::int64_t, std::nano>;
 using TimePointNs = std::chrono::time_point<BaseClock, DurationNs>;
 
+/// @brief clock the tx timestamp of a chunk is taken from; configured per sender
+/// port so deployments choose between precision and stamp cost. Timestamps are
+/// only comparable between stamps of the same source
+enum class TimestampSource : std::uint8_t
+{
+    /// std::chrono::steady_clock, the default; a vDSO read of CLOCK_MONOTONIC
+    MONOTONIC = 0,
+    /// CLOCK_MONOTONIC_RAW, not slewed by NTP; for latency accounting which must
+    /// not see clock adjustments
+    MONOTONIC_RAW,
+    /// raw TSC read, the cheapest local stamp; the unit is cycles, not
+    /// nanoseconds, only diffs against other TSC stamps of the same host are
+    /// meaningful
+    TSC,
+    /// PTP synchronized hardware time (CLOCK_TAI, disciplined from the PHC);
+    /// stamps are comparable across ECUs, for cross node latency accounting
+    /// through the network gateway
+    PTP
+};
+
 struct ChunkInfo
 {
     bool m_externalSequenceNumber_bl{false};
+    /// @brief source of m_txTimestamp, stamped together with it; placed in the
+    /// padding byte after the bool so the ChunkInfo layout does not change
+    TimestampSource m_txTimestampSource{TimestampSource::MONOTONIC};
+    /// @brief application defined tag (e.g. a message ID) which is matched against
+    /// the chunk filter of the receiver ports on delivery; placed in the former
+    /// padding after the bool so the ChunkInfo layout does not change
+    std::uint16_t m_filterTag{0};
     SequenceNumberType m_sequenceNumber{0};
 
     /// @brief size of the user data object
@@ -30,21 +30,84 @@ namespace mepoo
 struct MePooConfig
 {
   public:
+    /// @brief per mempool memory hints, combinable as a bitmask in Entry::m_memoryHints;
+    /// in contrast to the segment wide flags below, these are applied to the address
+    /// range of a single mempool so that pools with different access patterns can be
+    /// tuned individually (e.g. huge pages for large streamed samples, locked pages
+    /// for small latency-critical state topics)
+
+    /// back the pool with transparent huge pages (MADV_HUGEPAGE)
+    static constexpr uint32_t HINT_HUGE_PAGES{1u << 0};
+    /// chunks of this pool are written and read once in order, tell the kernel
+    /// not to keep their pages around (MADV_SEQUENTIAL)
+    static constexpr uint32_t HINT_SEQUENTIAL{1u << 1};
+    /// exclude the payload of this pool from core dumps (MADV_DONTDUMP)
+    static constexpr uint32_t HINT_DONT_DUMP{1u << 2};
+    /// lock the pool into RAM so its pages are never swapped out (mlock),
+    /// for latency-critical pools
+    static constexpr uint32_t HINT_LOCKED{1u << 3};
+
     struct Entry
     {
         /// @brief set the size and count of memory chunks
-        Entry(uint32_t f_size, uint32_t f_chunkCount)noexcept
+        /// @param [in] f_maxChunkCount when larger than f_chunkCount, memory for
+        /// f_maxChunkCount chunks is reserved and the mempool can be grown at runtime
+        /// up to that count
+        /// @param [in] f_highWatermarkPercent percentage of chunks in use at which an
+        /// exhaustion early warning event is emitted via the mempool introspection,
+        /// 0 disables the early warning for this mempool
+        /// @param [in] f_memoryHints bitmask of the HINT_ constants above, applied to
+        /// the address range of this mempool at segment creation, 0 for no hints
+        Entry(uint32_t f_size,
+              uint32_t f_chunkCount,
+              uint32_t f_maxChunkCount = 0u,
+              uint32_t f_highWatermarkPercent = 0u,
+              uint32_t f_memoryHints = 0u) noexcept
             : m_size(f_size)
             , m_chunkCount(f_chunkCount)
+            , m_maxChunkCount(f_maxChunkCount)
+            , m_highWatermarkPercent(f_highWatermarkPercent)
+            , m_memoryHints(f_memoryHints)
         {
         }
         uint32_t m_size{0};
         uint32_t m_chunkCount{0};
+        uint32_t m_maxChunkCount{0};
+        uint32_t m_highWatermarkPercent{0};
+        uint32_t m_memoryHints{0};
     };
 
     using MePooConfigContainerType = cxx::vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
 
+    /// @brief configures an additional buddy mempool for topics with dynamic payload
+    /// sizes; m_size is the minimal block size in bytes (multiple of 32), m_chunkCount
+    /// the number of minimal blocks; a m_chunkCount of 0 disables the buddy mempool
+    Entry m_dynamicPool{0u, 0u};
+
+    /// @brief back the payload segment with transparent huge pages to reduce TLB misses
+    /// for large samples; ignored on platforms without huge page support
+    bool m_hugePages{false};
+
+    /// @brief touch all pages of the payload segment when it is created and when an
+    /// application maps it, so the page faults are paid at startup and not on the
+    /// first samples
+    bool m_prefaultPages{false};
+
+    /// @brief bind the payload segment to a NUMA node so that publishers running on
+    /// that node write to local memory; -1 leaves the placement to the first touch
+    /// policy of the OS; the binding only affects pages faulted in afterwards, so it
+    /// should be combined with m_prefaultPages
+    int32_t m_numaNode{-1};
+
+    /// @brief place the ChunkManagement entries (i.e. the reference counts) of this
+    /// segment behind the chunk arrays in the payload segment instead of in the
+    /// management segment; the refcount and the payload of a sample are then served
+    /// by the TLB entries of one segment, which saves a page walk per sample on
+    /// high-rate topics. The trade-off is isolation: every writer of the payload
+    /// segment can also corrupt the reference counts of its own segment
+    bool m_segmentLocalManagement{false};
+
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() = default;
 
@@ -27,6 +27,9 @@ namespace mepoo
 {
 struct SegmentConfig
 {
+    /// @note on multi socket machines the m_numaNode of the MePooConfig can be used to
+    /// pin each segment to the memory controller of the node its writer group runs on;
+    /// publishers then allocate their chunks from node local memory
     struct SegmentEntry
     {
         std::string m_readerGroup;
@@ -0,0 +1,71 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/mepoo/chunk_info.hpp"
+
+#include <ctime>
+
+namespace iox
+{
+namespace mepoo
+{
+namespace internal
+{
+inline TimePointNs timestampFromPosixClock(const clockid_t f_clockId) noexcept
+{
+    struct timespec ts;
+    clock_gettime(f_clockId, &ts);
+    return TimePointNs(DurationNs(static_cast<std::int64_t>(ts.tv_sec) * 1000000000ll + ts.tv_nsec));
+}
+} // namespace internal
+
+/// @brief reads a timestamp from the given source; the result is carried in a
+/// TimePointNs independent of the source, but stamps are only comparable
+/// against stamps of the same source (and for TSC only of the same host)
+inline TimePointNs readTimestamp(const TimestampSource f_source) noexcept
+{
+    switch (f_source)
+    {
+    case TimestampSource::MONOTONIC_RAW:
+        return internal::timestampFromPosixClock(CLOCK_MONOTONIC_RAW);
+    case TimestampSource::TSC:
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        std::uint32_t lo;
+        std::uint32_t hi;
+        asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+        return TimePointNs(DurationNs(static_cast<std::int64_t>((static_cast<std::uint64_t>(hi) << 32) | lo)));
+#else
+        // no TSC available, the monotonic clock is the cheapest local stamp
+        return TimePointNs(BaseClock::now().time_since_epoch());
+#endif
+    }
+    case TimestampSource::PTP:
+#ifdef CLOCK_TAI
+        // CLOCK_TAI is disciplined from the PTP hardware clock by phc2sys, so
+        // stamps are comparable between PTP synchronized ECUs
+        return internal::timestampFromPosixClock(CLOCK_TAI);
+#else
+        return internal::timestampFromPosixClock(CLOCK_REALTIME);
+#endif
+    case TimestampSource::MONOTONIC:
+    default:
+        return TimePointNs(BaseClock::now().time_since_epoch());
+    }
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -0,0 +1,96 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_utils/cxx/inplace_function.hpp"
+#include "iceoryx_utils/posix_wrapper/semaphore.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Shared event dispatcher for chunk reception. setReceiveHandler spawns
+///         one thread per subscription; with thousands of subscriptions that
+///         does not scale. The dispatcher points the coalesced receive
+///         notification of all attached receiver ports at one group semaphore
+///         and serves every handler from a small fixed set of worker threads.
+///         A handler runs on at most one worker at a time, so per subscription
+///         the usual single threaded receive code works unchanged. Handlers
+///         have to drain their delivery FiFo completely since one wakeup can
+///         cover a burst of chunks and of subscriptions
+/// @concurrent attach and detach may be called from any thread
+class ChunkReceiveDispatcher
+{
+  public:
+    /// the handler is stored inplace, no heap allocation on assignment
+    using ReceiveHandler_t = cxx::inplace_function<void(void)>;
+
+    /// @brief Starts the worker threads
+    /// @param[in] f_numberOfThreads number of worker threads serving the
+    ///             attached subscriptions
+    explicit ChunkReceiveDispatcher(const uint32_t f_numberOfThreads = 1u) noexcept;
+
+    /// @brief Detaches nothing but stops and joins the worker threads; the
+    ///         attached receiver ports have to outlive the dispatcher
+    ~ChunkReceiveDispatcher() noexcept;
+
+    ChunkReceiveDispatcher(const ChunkReceiveDispatcher&) = delete;
+    ChunkReceiveDispatcher(ChunkReceiveDispatcher&&) = delete;
+    ChunkReceiveDispatcher& operator=(const ChunkReceiveDispatcher&) = delete;
+    ChunkReceiveDispatcher& operator=(ChunkReceiveDispatcher&&) = delete;
+
+    /// @brief Attaches a receiver port; its receive notification is redirected
+    ///         to the group semaphore of the dispatcher. The group semaphore is
+    ///         taken from the first attached port, which therefore has to stay
+    ///         attached as long as any other subscription is served
+    /// @param[in] f_receiver receiver port to serve
+    /// @param[in] f_handler called by a worker thread when the port has new chunks
+    /// @return false when no semaphore could be created for the port
+    bool attach(ReceiverPortType& f_receiver, const ReceiveHandler_t f_handler) noexcept;
+
+    /// @brief Detaches a receiver port and restores its unredirected notification
+    /// @param[in] f_receiver receiver port to detach
+    void detach(ReceiverPortType& f_receiver) noexcept;
+
+    /// @brief Number of currently attached subscriptions
+    uint32_t numberOfSubscriptions() const noexcept;
+
+  private:
+    struct Subscription
+    {
+        ReceiverPortType* m_receiver{nullptr};
+        ReceiveHandler_t m_handler{nullptr};
+        /// at most one worker runs the handler of a subscription at a time
+        std::shared_ptr<std::atomic<bool>> m_inProgress;
+    };
+
+    void dispatchLoop() noexcept;
+
+    mutable std::mutex m_subscriptionsMutex;
+    std::vector<std::shared_ptr<Subscription>> m_subscriptions;
+    std::atomic<posix::Semaphore*> m_groupSemaphore{nullptr};
+    std::atomic_bool m_runFlag{true};
+    std::vector<std::thread> m_workerThreads;
+};
+
+} // namespace popo
+} // namespace iox
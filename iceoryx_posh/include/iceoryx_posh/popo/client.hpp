@@ -0,0 +1,102 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/request_response.hpp"
+#include "iceoryx_utils/fixed_string/string100.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Client side of a zero-copy request/response pair. Requests are
+/// allocated from the client's mempool and sent like ordinary chunks; the
+/// matching server routes its response back over this client's delivery FiFo
+/// only, using the chunk filter of the response receiver. The correlation id
+/// in the chunk header matches a response to its request.
+class Client
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] service the service the requests are sent on; the responses
+    /// travel on the derived responseService()
+    /// @param[in] runnableName optional name of the runnable the client belongs to
+    Client(const capro::ServiceDescription& service, const cxx::CString100& runnableName = "") noexcept;
+
+    virtual ~Client() noexcept;
+
+    Client& operator=(const Client& other) = delete;
+    Client(const Client& other) = delete;
+
+    Client(Client&& other) = default;
+    Client& operator=(Client&&) = default;
+
+    /// @brief Allocate memory for a request from the client's mempool
+    /// @param[in] payloadSize size of the request payload
+    /// @return payload of the reserved chunk
+    void* allocateRequest(const uint32_t payloadSize) noexcept;
+
+    /// @brief Send a request; stamps the correlation id and the client tag so
+    /// the server can route the response back
+    /// @param[in] payload payload of a chunk allocated via allocateRequest
+    /// @return the correlation id the matching response will carry
+    uint64_t sendRequest(void* const payload) noexcept;
+
+    /// @brief check for a pending response without popping it
+    /// @return true if a response is waiting in the delivery FiFo
+    bool hasResponse() noexcept;
+
+    /// @brief Get the next response; has to be released via releaseResponse
+    /// @param[out] payload payload of the response chunk
+    /// @param[out] correlationId correlation id of the request this response answers
+    /// @return true if a response was popped, false otherwise
+    bool getResponse(const void** payload, uint64_t& correlationId) noexcept;
+
+    /// @brief Release a response chunk
+    /// @param[in] payload payload of the chunk handed out by getResponse
+    /// @return true if the chunk was released, false otherwise
+    bool releaseResponse(const void* const payload) noexcept;
+
+    /// @brief the tag the responses of this client are filtered on
+    uint16_t getClientTag() const noexcept;
+
+  protected:
+    // needed for unit testing, the ports are connected by the test directly
+    Client(SenderPortType&& requestSender, ReceiverPortType&& responseReceiver) noexcept;
+
+    /// connects the ports; called by both constructors
+    void connect() noexcept;
+
+  protected:
+    SenderPortType m_requestSender{nullptr};
+    mutable ReceiverPortType m_responseReceiver{nullptr};
+
+  private:
+    /// process wide unique client id; the low 16 bit mix is used as chunk
+    /// filter tag of the response receiver, the full id guards against tag
+    /// collisions between processes
+    uint32_t m_clientId{0u};
+    std::atomic<uint32_t> m_nextRequestId{1u};
+};
+
+} // namespace popo
+} // namespace iox
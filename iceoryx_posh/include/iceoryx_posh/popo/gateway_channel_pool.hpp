@@ -0,0 +1,89 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/cxx/vector.hpp"
+#include "iceoryx_utils/internal/concurrent/thread_pool.hpp"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Shards the forwarding work of a gateway across the workers of a
+///         concurrent::ThreadPool. A gateway registers one forwarding functor
+///         per channel and triggers a pass from its main loop; every channel
+///         pass is submitted as a task with the channel index as affinity
+///         hint, so channels spread over the workers and idle workers steal
+///         from loaded ones. Per-channel ordering is preserved by allowing at
+///         most one pass per channel in flight: a trigger skips channels whose
+///         previous pass has not finished, so no two workers ever forward the
+///         same channel concurrently
+class GatewayChannelPool
+{
+  public:
+    using ForwardFunction = std::function<void()>;
+
+    /// maximum number of channels of one pool
+    static constexpr uint32_t MAX_CHANNELS = 1024u;
+
+    /// @brief Creates the pool and its workers
+    /// @param[in] f_numberOfWorkers number of worker threads, 0 means one per
+    ///             hardware thread
+    GatewayChannelPool(const uint32_t f_numberOfWorkers = 0u) noexcept;
+
+    /// @brief Waits until the passes currently in flight are finished
+    ~GatewayChannelPool() noexcept;
+
+    GatewayChannelPool(const GatewayChannelPool&) = delete;
+    GatewayChannelPool(GatewayChannelPool&&) = delete;
+    GatewayChannelPool& operator=(const GatewayChannelPool&) = delete;
+    GatewayChannelPool& operator=(GatewayChannelPool&&) = delete;
+
+    /// @brief Registers the forwarding functor of one channel; the functor is
+    ///         expected to drain the pending work of its channel in one call
+    /// @param[in] f_forward functor executing one forwarding pass of the channel
+    /// @return true if the channel was added, false when MAX_CHANNELS is reached
+    bool addChannel(const ForwardFunction& f_forward) noexcept;
+
+    /// @brief Submits one forwarding pass per channel to the workers; channels
+    ///         with a pass still in flight are skipped and picked up by the
+    ///         next trigger, which keeps per-channel ordering intact
+    /// @return number of passes submitted in this trigger
+    uint32_t trigger() noexcept;
+
+    /// @brief Returns true when no pass is in flight anymore
+    bool idle() const noexcept;
+
+    /// @brief Returns the number of registered channels
+    uint32_t numberOfChannels() const noexcept;
+
+  private:
+    struct Channel
+    {
+        ForwardFunction m_forward;
+        /// set while a pass of this channel is queued or executing
+        std::shared_ptr<std::atomic<bool>> m_inFlight;
+    };
+
+    concurrent::ThreadPool m_threadPool;
+    cxx::vector<Channel, MAX_CHANNELS> m_channels;
+};
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,84 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_utils/cxx/vector.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Credit based flow control for the receive path of a gateway channel.
+///         A gateway holding chunks for a slow external sink keeps them out of
+///         the mempool; without a bound a stalled sink exhausts pools shared
+///         with local traffic. Every chunk handed to the sink takes a credit,
+///         the credit returns when the sink has consumed the chunk. When all
+///         credits are taken the policy decides: RELEASE_OLDEST drops the
+///         reference to the oldest held chunk so the pool gets it back (the
+///         sink loses that sample), PAUSE refuses new chunks so the channel
+///         stops fetching and the backlog stays in the delivery fifo where the
+///         overflow handling of the sender applies.
+/// @concurrent not thread safe, one instance belongs to exactly one channel
+///             which is forwarded by one worker at a time
+class GatewayChunkCredit
+{
+  public:
+    /// maximum number of credits of one channel
+    static constexpr uint32_t MAX_CREDITS = MAX_RECEIVER_QUEUE_SIZE;
+
+    enum class OverflowPolicy : uint32_t
+    {
+        RELEASE_OLDEST, ///< drop the oldest held chunk to make room
+        PAUSE           ///< refuse new chunks until a credit returns
+    };
+
+    /// @brief Creates the flow control with the given number of credits
+    /// @param[in] f_credits maximum number of chunks held at a time, clamped
+    ///             to MAX_CREDITS
+    /// @param[in] f_policy behavior when all credits are taken
+    GatewayChunkCredit(const uint32_t f_credits,
+                       const OverflowPolicy f_policy = OverflowPolicy::RELEASE_OLDEST) noexcept;
+
+    /// @brief Takes a credit for a chunk about to be handed to the external
+    ///         sink and keeps a reference on it
+    /// @param[in] f_chunk chunk the gateway fetched from its receiver port
+    /// @return true when the chunk is held, false when the policy is PAUSE and
+    ///         no credit is left; the caller must then stop fetching
+    bool hold(const mepoo::SharedChunk& f_chunk) noexcept;
+
+    /// @brief Returns the credit of a chunk the external sink has consumed
+    /// @param[in] f_chunk previously held chunk
+    /// @return true when the chunk was held, false otherwise
+    bool release(const mepoo::SharedChunk& f_chunk) noexcept;
+
+    /// @brief Returns the number of chunks currently held
+    uint32_t heldCount() const noexcept;
+
+    /// @brief Returns the number of chunks dropped by RELEASE_OLDEST; an
+    ///         advancing counter means the external sink loses samples
+    uint64_t droppedChunkCount() const noexcept;
+
+  private:
+    uint32_t m_credits;
+    OverflowPolicy m_policy;
+    uint64_t m_droppedChunkCount{0u};
+    /// the held references in arrival order, oldest at the front
+    cxx::vector<mepoo::SharedChunk, MAX_CREDITS> m_heldChunks;
+};
+
+} // namespace popo
+} // namespace iox
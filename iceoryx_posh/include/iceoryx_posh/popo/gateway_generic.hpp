@@ -29,6 +29,8 @@ struct CaproMessage;
 namespace popo
 {
 class InterfacePort;
+class ReceiverPort;
+class SenderPort;
 
 /// @brief Generic gateway for communication events
 class GatewayGeneric
@@ -47,6 +49,26 @@ class GatewayGeneric
     /// @param[in] msg Type of caro message
     bool getCaProMessage(CaproMessage& msg) noexcept;
 
+    /// @brief Drains a burst of capro messages from the interface port in one
+    /// pass; gateway threads forwarding high message rates should prefer this
+    /// over a wakeup-per-message getCaProMessage cycle and dispatch the fetched
+    /// group to their channels in one go
+    /// @param[out] msgs array with space for maxCount messages
+    /// @param[in] maxCount maximum number of messages to fetch
+    /// @return number of valid entries written to msgs
+    uint32_t getCaProMessages(CaproMessage* msgs, const uint32_t maxCount) noexcept;
+
+    /// @brief Zero-copy bridge for same-host domain forwarding: fetches the
+    /// pending chunks of a receiver port and re-delivers them on a sender port
+    /// of the other domain. Only the reference count of the shared chunks is
+    /// updated, no payload bytes are moved; the chunk is released to its
+    /// mempool when the last receiver of both domains returned it
+    /// @param[in] source receiver port the chunks are fetched from
+    /// @param[in] destination sender port the chunks are re-delivered on
+    /// @param[in] maxCount maximum number of chunks to bridge in this pass
+    /// @return number of bridged chunks
+    static uint32_t bridgeChunks(ReceiverPort& source, SenderPort& destination, const uint32_t maxCount) noexcept;
+
   protected:
     // needed for unit testing
     GatewayGeneric() noexcept
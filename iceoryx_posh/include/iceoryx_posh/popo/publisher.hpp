@@ -54,10 +54,31 @@ class Publisher
     /// @return Payload of the chunk reserved
     virtual void* allocateChunk(uint32_t payloadSize, bool useDynamicPayloadSizes = false) noexcept;
 
+    /// @brief Fixed size variant of allocateChunk() for topics whose payload size
+    /// is known at compile time (used by the TypedPublisher); the serving mempool
+    /// is resolved on the first allocation and the per sample size handling and
+    /// pool search are skipped afterwards
+    /// @param[in] payloadSize payload size of the topic, must not change between calls
+    /// @return Payload of the chunk reserved, nullptr when allocation failed
+    virtual void* allocateFixedSizeChunk(uint32_t payloadSize) noexcept;
+
+    /// @brief Link two allocated chunks into one composite sample (scatter-gather);
+    /// only the head chunk is sent, subscribers follow ChunkHeader::nextChunk()
+    /// @param[in] chunkHeader chunk the next one is appended to
+    /// @param[in] nextChunkHeader allocated chunk to append
+    /// @return true on success, false when chaining is not possible
+    virtual bool chainChunks(mepoo::ChunkHeader* const chunkHeader, mepoo::ChunkHeader* const nextChunkHeader) noexcept;
+
     /// @brief Send the chunk and deliver it on subscription
     /// @param[in] chunkHeader Information about the chunk to be sent
     virtual void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send a batch of chunks in one call; the receiver list traversal and the
+    /// wakeup of every receiver are paid once for the whole batch
+    /// @param[in] chunkHeaders array of count chunks to be sent in order
+    /// @param[in] count number of chunks
+    virtual void sendChunks(mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t count) noexcept;
+
     /// @brief Converts payload to ChunkHeader and send the chunk, deliver it on subscription
     /// @param[in] payload payload of the chunk
     virtual void sendChunk(const void* const payload) noexcept;
@@ -74,6 +95,19 @@ class Publisher
     /// @return void pointer to last chunk
     virtual const void* getLastChunk() const noexcept;
 
+    /// @brief Loan the last sent chunk back for writing when no subscriber holds a
+    /// reference to it anymore; the payload content is preserved, so incremental
+    /// updates of large samples skip the allocation and the full copy
+    /// @return payload of the last sent chunk, nullptr when it is still in use
+    virtual void* loanPreviousChunk() noexcept;
+
+    /// @brief Pre-allocates and immediately frees the allocation window of
+    ///         chunks and pre-touches the port bookkeeping, so the first real
+    ///         sample after offer() does not pay for page faults and cold
+    ///         caches. Call once before the time critical phase
+    /// @param[in] payloadSize size of the payload the real samples will have
+    void warmup(const uint32_t payloadSize) noexcept;
+
     /// @brief Function for offering event
     void offer() noexcept;
 
@@ -84,8 +118,30 @@ class Publisher
     /// @return true if there are subscribers otherwise false
     bool hasSubscribers() noexcept;
 
-    /// @brief Enable the functionality to send the last chunk to new subscribers
-    void enableDoDeliverOnSubscription() noexcept;
+    /// @brief Enable the functionality to send the latest chunks to new subscribers
+    /// @param[in] f_historyCapacity number of chunks a new subscriber receives on
+    /// connect; defaults to the last chunk only
+    void enableDoDeliverOnSubscription(const uint32_t f_historyCapacity = 1u) noexcept;
+
+    /// @brief Enable or disable the per send timestamping for the throughput
+    /// introspection; disabling saves a clock read per sent chunk on topics where
+    /// the throughput introspection is not consumed
+    /// @param[in] enabled true to track throughput (default), false to skip it
+    void setThroughputTrackingEnabled(const bool enabled) noexcept;
+
+    /// @brief Allows feeding this publisher from several threads without external
+    /// locking; chunk allocation and release stay lock-free, the delivery itself
+    /// is briefly serialized internally. The single producer chunk reuse
+    /// optimizations are disabled while enabled
+    /// @param[in] enabled true for multi threaded publishing, false (default)
+    void setConcurrentDeliveryEnabled(const bool enabled) noexcept;
+
+    /// @brief Enable or disable the integrity mode of this topic; every sent
+    /// chunk then carries a CRC32C of its payload in the chunk header which
+    /// subscribers can verify. Requires the standard 64 byte chunk header,
+    /// with the compact header the call is ignored
+    /// @param[in] enabled true to checksum every sent chunk, false (default)
+    void setIntegrityModeEnabled(const bool enabled) noexcept;
 
   protected:
     // needed for unit testing
@@ -0,0 +1,49 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/capro/service_description.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// requests and responses of one client/server pair share the service and
+/// instance id; the response direction flips the top bit of the event id so
+/// both directions are discovered as ordinary topics
+constexpr uint16_t RESPONSE_EVENT_FLAG{0x8000u};
+
+/// @brief derives the response service of a client/server pair
+/// @param [in] f_service the service the clients send their requests on
+/// @return the service the responses travel on
+inline capro::ServiceDescription responseService(const capro::ServiceDescription& f_service) noexcept
+{
+    return capro::ServiceDescription(f_service.getServiceID(),
+                                     static_cast<uint16_t>(f_service.getEventID() ^ RESPONSE_EVENT_FLAG),
+                                     f_service.getInstanceID());
+}
+
+/// @brief identifies a request while the server processes it; handed out by
+/// Server::getRequest and required to route the response back to the client
+struct RequestContext
+{
+    uint64_t m_correlationId{0u};
+    uint16_t m_clientTag{0u};
+};
+
+} // namespace popo
+} // namespace iox
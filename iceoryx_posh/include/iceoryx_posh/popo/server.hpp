@@ -0,0 +1,88 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/request_response.hpp"
+#include "iceoryx_utils/fixed_string/string100.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Server side of a zero-copy request/response pair. Requests of all
+/// clients arrive over one receiver port; responses are allocated from the
+/// server's mempool and stamped with the client tag of the request so that
+/// only the requesting client's delivery FiFo receives them.
+class Server
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] service the service the clients send their requests on
+    /// @param[in] runnableName optional name of the runnable the server belongs to
+    Server(const capro::ServiceDescription& service, const cxx::CString100& runnableName = "") noexcept;
+
+    virtual ~Server() noexcept;
+
+    Server& operator=(const Server& other) = delete;
+    Server(const Server& other) = delete;
+
+    Server(Server&& other) = default;
+    Server& operator=(Server&&) = default;
+
+    /// @brief check for a pending request without popping it
+    /// @return true if a request is waiting in the delivery FiFo
+    bool hasRequests() noexcept;
+
+    /// @brief Get the next request; has to be released via releaseRequest
+    /// @param[out] payload payload of the request chunk
+    /// @param[out] context correlation information required to send the response
+    /// @return true if a request was popped, false otherwise
+    bool getRequest(const void** payload, RequestContext& context) noexcept;
+
+    /// @brief Release a request chunk
+    /// @param[in] payload payload of the chunk handed out by getRequest
+    /// @return true if the chunk was released, false otherwise
+    bool releaseRequest(const void* const payload) noexcept;
+
+    /// @brief Allocate memory for a response from the server's mempool
+    /// @param[in] payloadSize size of the response payload
+    /// @return payload of the reserved chunk
+    void* allocateResponse(const uint32_t payloadSize) noexcept;
+
+    /// @brief Send a response back to the client the request came from
+    /// @param[in] payload payload of a chunk allocated via allocateResponse
+    /// @param[in] context the context handed out with the request
+    void sendResponse(void* const payload, const RequestContext& context) noexcept;
+
+  protected:
+    // needed for unit testing, the ports are connected by the test directly
+    Server(ReceiverPortType&& requestReceiver, SenderPortType&& responseSender) noexcept;
+
+    /// connects the ports; called by both constructors
+    void connect() noexcept;
+
+  protected:
+    mutable ReceiverPortType m_requestReceiver{nullptr};
+    SenderPortType m_responseSender{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
@@ -17,6 +17,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/popo/receiver_port.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_utils/cxx/inplace_function.hpp"
 #include "iceoryx_utils/fixed_string/string100.hpp"
 #include "iceoryx_utils/posix_wrapper/semaphore.hpp"
 
@@ -29,6 +30,8 @@ namespace iox
 {
 namespace popo
 {
+class ChunkReceiveDispatcher;
+
 enum class SubscriptionState
 {
     SUBSCRIBED,
@@ -36,17 +39,48 @@ enum class SubscriptionState
     SUBSCRIPTION_PENDING
 };
 
+/// @brief wakeup backend for the receive handler thread
+enum class ReceiveNotification
+{
+    /// posix semaphore in shared memory, one syscall per post and wait
+    SEMAPHORE,
+    /// futex word in shared memory; the sender side post is a plain atomic
+    /// increment as long as the callback thread is not parked
+    FUTEX
+};
+
+/// @brief wait strategies for Subscriber::waitForChunk
+enum class WaitPolicy
+{
+    /// park on the semaphore, one wakeup syscall per sample
+    BLOCKING,
+    /// poll the delivery FiFo for the whole timeout; lowest latency, occupies a core
+    BUSY_SPIN,
+    /// poll briefly, then keep polling with a yield in between
+    SPIN_THEN_YIELD,
+    /// poll, then yield, then fall back to the semaphore for the rest of the timeout
+    ADAPTIVE
+};
+
 class Subscriber
 {
   public:
     using mutex_t = std::mutex;
-    using ReceiveHandler_t = std::function<void(void)>;
+    /// the handler is stored inplace, no heap allocation on assignment
+    using ReceiveHandler_t = cxx::inplace_function<void(void)>;
 
     /// @brief Constructor
     /// @param[in] service Information on service , service, instance, event Id
     /// @param[in] runnableName optional name of the runnable the subscriber belongs to
     explicit Subscriber(const capro::ServiceDescription& service, const cxx::CString100& runnableName = "") noexcept;
 
+    /// @brief Constructor on an already acquired receiver port; used together
+    /// with PoshRuntime::getMiddlewareReceiverBatch so a multi-topic
+    /// application attaches to all its topics with a single RouDi
+    /// transaction instead of one blocking round trip per subscriber
+    /// @param[in] receiverPortData receiver port acquired from the runtime
+    explicit Subscriber(ReceiverPortType::MemberType_t* const receiverPortData) noexcept;
+
     /// @brief Destructor for event receiver
     virtual ~Subscriber() noexcept;
 
@@ -56,6 +90,11 @@ class Subscriber
     Subscriber(Subscriber&& other) = default;
     Subscriber& operator=(Subscriber&&) = default;
 
+    /// @brief Pre-touches the port bookkeeping, so the first real sample does
+    ///         not pay for page faults and cold caches on the receive path.
+    ///         Call once before the time critical phase
+    void warmup() noexcept;
+
     /// @brief Function for subscribing to event
     /// @param[in] cacheSize Size of the receiver queue
     void subscribe(const uint32_t cacheSize = MAX_RECEIVER_QUEUE_SIZE) noexcept;
@@ -67,13 +106,57 @@ class Subscriber
     /// @brief Function for Unsubscribing to an event
     void unsubscribe() noexcept;
 
+    /// @brief Registers a chunk filter; only chunks whose filter tag in the chunk
+    /// info satisfies (tag & filterMask) == filterValue are delivered, all others
+    /// are skipped at the sender before any queueing or wakeup for this subscriber
+    /// @param[in] filterMask mask applied to the filter tag of a sent chunk
+    /// @param[in] filterValue expected value of the masked filter tag
+    void setChunkFilter(const uint16_t filterMask, const uint16_t filterValue) noexcept;
+
+    /// @brief Removes the chunk filter, all chunks are delivered again
+    void clearChunkFilter() noexcept;
+
+    /// @brief Enable or disable verification of the payload checksum a publisher
+    /// with enabled integrity mode stamps into every chunk; corrupted chunks are
+    /// dropped with an error log instead of being handed to the application.
+    /// Chunks without a checksum pass unverified
+    /// @param[in] enabled true to verify received chunks, false (default)
+    void setIntegrityCheckEnabled(const bool enabled) noexcept;
+
     /// @brief Set function for Receiver callback handler
     /// @param[in] handler pointer to the receiver
-    void setReceiveHandler(ReceiveHandler_t handler) noexcept;
+    /// @param[in] notification wakeup backend for the callback thread, FUTEX avoids
+    /// the semaphore post syscall on the sender side while the thread is busy
+    void setReceiveHandler(ReceiveHandler_t handler,
+                           const ReceiveNotification notification = ReceiveNotification::SEMAPHORE) noexcept;
 
     /// @brief unset the value of callback handler
     void unsetReceiveHandler() noexcept;
 
+    /// @brief Serves the receive handler from the worker threads of a shared
+    /// dispatcher instead of a dedicated callback thread per subscriber; with
+    /// many subscriptions this is the scalable alternative to setReceiveHandler
+    /// @param[in] dispatcher shared dispatcher the subscription is served by
+    /// @param[in] handler called by a dispatcher worker when new chunks arrived,
+    /// has to drain all pending chunks since one wakeup can cover a burst
+    /// @return false when the subscription could not be attached
+    bool attachReceiveHandler(ChunkReceiveDispatcher& dispatcher, ReceiveHandler_t handler) noexcept;
+
+    /// @brief detach the subscription from the shared dispatcher again
+    /// @param[in] dispatcher the dispatcher passed to attachReceiveHandler
+    void detachReceiveHandler(ChunkReceiveDispatcher& dispatcher) noexcept;
+
+    /// @brief attaches the receive handler to the process wide event
+    /// dispatcher of the PoshRuntime; all subscriptions of the process share
+    /// its worker thread pool instead of spawning one thread each
+    /// @param[in] handler called by a dispatcher worker when new chunks arrived,
+    /// has to drain all pending chunks since one wakeup can cover a burst
+    /// @return false when the subscription could not be attached
+    bool setSharedReceiveHandler(ReceiveHandler_t handler) noexcept;
+
+    /// @brief detach the subscription from the process wide event dispatcher
+    void unsetSharedReceiveHandler() noexcept;
+
     /// @brief set the callback reference with shared memory semaphore
     /// @param[in] receiverWithRererenceToUse to get the shared memory semaphore
     void overrideCallbackReference(const Subscriber& receiverWithRererenceToUse) noexcept;
@@ -98,6 +181,13 @@ class Subscriber
     /// @return true when the chunk is received otherwise false
     bool getChunk(const void** payload) noexcept;
 
+    /// @brief Fetch a whole backlog of chunks in one call instead of one round trip
+    /// per chunk; every returned chunk has to be released via releaseChunk
+    /// @param[out] chunkHeaders array with space for maxCount chunk headers
+    /// @param[in] maxCount maximum number of chunks to fetch
+    /// @return number of valid entries written to chunkHeaders
+    uint32_t getChunks(const mepoo::ChunkHeader** chunkHeaders, const uint32_t maxCount) noexcept;
+
     /// @brief Function for cleaning up the stored smaples in FIFO
     void deleteNewChunks() noexcept;
 
@@ -111,10 +201,26 @@ class Subscriber
     /// @return true when the chunk is deleted , false when pointer is invalid
     bool releaseChunk(const void* const payload) noexcept;
 
+    /// @brief Choose the wait strategy used by waitForChunk; latency critical
+    /// receivers can trade a busy core for avoiding the semaphore syscall
+    /// @param[in] waitPolicy the policy to use from the next waitForChunk call on
+    void setWaitPolicy(const WaitPolicy waitPolicy) noexcept;
+
     /// @brief Function to check the availability of new chunk
     /// @return true when new chunk is available otherwise false
     bool hasNewChunks() const noexcept;
 
+    /// @brief Number of chunks this subscriber lost because its receive queue
+    /// overflowed; the counter is monotonic, a data-completeness monitor can
+    /// diff it between two queries instead of inferring loss from gaps
+    /// @return number of lost chunks since subscription
+    uint64_t getLostChunkCount() const noexcept;
+
+    /// @brief Sequence number of the most recently lost chunk
+    /// @return the sequence number, only meaningful when getLostChunkCount()
+    /// is greater than 0
+    uint64_t getLastLostSequenceNumber() const noexcept;
+
     /// @brief Get function for shared memory semaphore
     /// @return  posix::Semaphore pointer to shared memory
     posix::Semaphore* getSemaphore() const noexcept;
@@ -138,6 +244,7 @@ class Subscriber
     mutable ReceiverPortType m_receiver{
         nullptr}; /// @todo remove mutable, required since the receiverPort is modifying data in const methods
     bool m_subscribeDemand{false};
+    WaitPolicy m_waitPolicy{WaitPolicy::BLOCKING};
 
     // event callback related
     mutable mutex_t m_callbackHandlerMutex;
@@ -147,6 +254,7 @@ class Subscriber
     std::atomic_bool m_callbackThreadPresent{false};
     std::atomic_bool m_callbackRunFlag{false};
     posix::Semaphore* m_callbackSemaphore{nullptr};
+    posix::FutexSignal* m_callbackFutexSignal{nullptr};
 };
 
 } // namespace popo
@@ -0,0 +1,104 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/popo/publisher.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Typed front end of the Publisher. The payload size is the compile
+///         time constant sizeof(T), so the size is checked once at compile
+///         time instead of being passed and validated per sample, and the
+///         optimizer sees a constant through the whole allocate/send pair.
+///         allocate() constructs the sample in place and send() takes the
+///         typed pointer back, no user side cast needed
+/// @code
+///     TypedPublisher<CounterTopic> myPublisher(myServiceDescription);
+///     myPublisher.offer();
+///
+///     auto sample = myPublisher.allocate();
+///     if (sample != nullptr)
+///     {
+///         sample->counter = 42;
+///         myPublisher.send(sample);
+///     }
+/// @endcode
+template <typename T>
+class TypedPublisher : public Publisher
+{
+    static_assert(!std::is_polymorphic<T>::value, "a topic type must not be polymorphic");
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "a topic type must be trivially destructible, the destructor of a sent sample is never called");
+
+  public:
+    /// @brief Constructor
+    /// @param[in] f_service Information on service , service, instance, event Id
+    /// @param[in] f_runnableName optional name of the runnable the publisher belongs to
+    TypedPublisher(const capro::ServiceDescription& f_service, const cxx::CString100& f_runnableName = "") noexcept
+        : Publisher(f_service, f_runnableName)
+    {
+    }
+
+    /// @brief Allocates a chunk of sizeof(T) and constructs the sample in place;
+    ///         since the size can never change, the allocation goes through the
+    ///         fixed size path which skips the per sample size handling and
+    ///         mempool search of the untyped front end
+    /// @param[in] f_args constructor arguments forwarded to T
+    /// @return pointer to the constructed sample, nullptr when allocation failed
+    template <typename... Targs>
+    T* allocate(Targs&&... f_args) noexcept
+    {
+        auto payload = allocateFixedSizeChunk(sizeof(T));
+        if (payload == nullptr)
+        {
+            return nullptr;
+        }
+        return new (payload) T(std::forward<Targs>(f_args)...);
+    }
+
+    /// @brief Sends a previously allocated sample and delivers it on subscription
+    /// @param[in] f_sample sample returned by allocate()
+    void send(T* const f_sample) noexcept
+    {
+        sendChunk(static_cast<const void*>(f_sample));
+    }
+
+    /// @brief Releases a sample without sending it
+    /// @param[in] f_sample sample returned by allocate()
+    void free(T* const f_sample) noexcept
+    {
+        freeChunk(static_cast<void*>(f_sample));
+    }
+
+    /// @brief Loans the last sent sample back for writing when no subscriber
+    ///         holds a reference to it anymore; the content is preserved
+    /// @return pointer to the last sent sample, nullptr when it is still in use
+    T* loanPreviousSample() noexcept
+    {
+        return static_cast<T*>(loanPreviousChunk());
+    }
+
+  protected:
+    // needed for unit testing
+    TypedPublisher() noexcept = default;
+};
+
+} // namespace popo
+} // namespace iox
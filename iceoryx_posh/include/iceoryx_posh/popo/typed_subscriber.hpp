@@ -0,0 +1,83 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/popo/subscriber.hpp"
+
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Typed front end of the Subscriber. getSample() yields a typed
+///         reference into the shared memory chunk, the untyped cast and the
+///         per sample size bookkeeping of the void* interface disappear from
+///         the user code
+/// @code
+///     TypedSubscriber<CounterTopic> mySubscriber(myServiceDescription);
+///     mySubscriber.subscribe();
+///
+///     const CounterTopic* sample{nullptr};
+///     while (mySubscriber.getSample(sample))
+///     {
+///         process(*sample);
+///         mySubscriber.releaseSample(sample);
+///     }
+/// @endcode
+template <typename T>
+class TypedSubscriber : public Subscriber
+{
+    static_assert(!std::is_polymorphic<T>::value, "a topic type must not be polymorphic");
+
+  public:
+    /// @brief Constructor
+    /// @param[in] f_service Information on service , service, instance, event Id
+    /// @param[in] f_runnableName optional name of the runnable the subscriber belongs to
+    explicit TypedSubscriber(const capro::ServiceDescription& f_service,
+                             const cxx::CString100& f_runnableName = "") noexcept
+        : Subscriber(f_service, f_runnableName)
+    {
+    }
+
+    /// @brief Fetches the next sample from the delivery fifo
+    /// @param[out] f_sample typed pointer into the received chunk
+    /// @return true when a sample was received, otherwise false
+    bool getSample(const T*& f_sample) noexcept
+    {
+        const void* payload{nullptr};
+        if (!getChunk(&payload))
+        {
+            return false;
+        }
+        f_sample = static_cast<const T*>(payload);
+        return true;
+    }
+
+    /// @brief Releases a previously fetched sample back to its mempool
+    /// @param[in] f_sample sample returned by getSample()
+    /// @return true when the sample was released, false when the pointer is invalid
+    bool releaseSample(const T* const f_sample) noexcept
+    {
+        return releaseChunk(static_cast<const void*>(f_sample));
+    }
+
+  protected:
+    // needed for unit testing
+    TypedSubscriber() noexcept = default;
+};
+
+} // namespace popo
+} // namespace iox
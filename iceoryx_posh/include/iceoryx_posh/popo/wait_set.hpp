@@ -0,0 +1,99 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_utils/cxx/vector.hpp"
+#include "iceoryx_utils/posix_wrapper/semaphore.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Multiplexer that lets one thread wait for chunks on many receiver ports
+///        with a single blocking call. All attached ports post the same shared
+///        memory semaphore on delivery, so servicing n topics needs one wakeup and
+///        one thread instead of one callback thread per subscriber.
+///        Attaching a receiver claims its chunk send callback; a receiver can
+///        therefore not be in a wait set and have a receive handler at the same time.
+///        The class itself is not thread safe, it is meant to be owned and used by
+///        the one thread which does the waiting.
+class WaitSet
+{
+  public:
+    WaitSet() noexcept = default;
+
+    /// @brief Detaches all still attached receivers
+    ~WaitSet() noexcept;
+
+    WaitSet(const WaitSet& other) = delete;
+    WaitSet& operator=(const WaitSet& other) = delete;
+
+    WaitSet(WaitSet&& other) = default;
+    WaitSet& operator=(WaitSet&& other) = default;
+
+    /// @brief Attaches a receiver port; deliveries to it will from now on wake up
+    ///         wait and timedWait
+    /// @param[in] receiver port to attach, must outlive its attachment
+    /// @return false when the wait set is full or the shared memory semaphore
+    ///         could not be initialized, true otherwise
+    bool attachReceiver(ReceiverPortType& receiver) noexcept;
+
+    /// @brief Detaches a receiver port and releases its chunk send callback
+    /// @param[in] receiver port to detach
+    /// @return true when the port was attached, false otherwise
+    bool detachReceiver(ReceiverPortType& receiver) noexcept;
+
+    /// @brief Detaches all attached receivers
+    void detachAllReceivers() noexcept;
+
+    /// @brief Get function for the number of attached receivers
+    /// @return number of currently attached receivers
+    uint32_t getNumberOfAttachedReceivers() const noexcept;
+
+    /// @brief Blocks until at least one attached receiver has new chunks
+    /// @param[out] readyReceivers array with space for maxCount receiver pointers
+    /// @param[in] maxCount maximum number of ready receivers to report
+    /// @return number of valid entries written to readyReceivers
+    uint32_t wait(ReceiverPortType** readyReceivers, const uint32_t maxCount) noexcept;
+
+    /// @brief Like wait but gives up after the timeout
+    /// @param[out] readyReceivers array with space for maxCount receiver pointers
+    /// @param[in] maxCount maximum number of ready receivers to report
+    /// @param[in] timeoutMs the time in Milliseconds to wait
+    /// @return number of valid entries written to readyReceivers, 0 on timeout
+    uint32_t
+    timedWait(ReceiverPortType** readyReceivers, const uint32_t maxCount, const uint32_t timeoutMs) noexcept;
+
+    /// @brief Non blocking check which attached receivers have new chunks
+    /// @param[out] readyReceivers array with space for maxCount receiver pointers
+    /// @param[in] maxCount maximum number of ready receivers to report
+    /// @return number of valid entries written to readyReceivers
+    uint32_t tryWait(ReceiverPortType** readyReceivers, const uint32_t maxCount) noexcept;
+
+  private:
+    uint32_t collectReadyReceivers(ReceiverPortType** readyReceivers, const uint32_t maxCount) const noexcept;
+
+    cxx::vector<ReceiverPortType*, MAX_RECEIVERS_PER_WAITSET> m_attachedReceivers;
+    // the common wakeup semaphore, provided by the port data of one of the
+    // attached receivers since it has to live in shared memory
+    posix::Semaphore* m_waitSemaphore{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
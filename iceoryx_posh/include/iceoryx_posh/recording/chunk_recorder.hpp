@@ -0,0 +1,118 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_utils/cxx/optional.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/memory_map.hpp"
+
+#include <string>
+
+namespace iox
+{
+namespace recording
+{
+/// header at the start of a record file, followed by the ring region
+struct RecordFileHeader
+{
+    static constexpr uint64_t MAGIC = 0x4452434552454349u; // "ICERECRD" little endian
+    static constexpr uint32_t VERSION = 1u;
+
+    uint64_t m_magic{MAGIC};
+    uint32_t m_version{VERSION};
+    uint32_t m_reserved{0u};
+    /// size of the ring region in bytes
+    uint64_t m_ringCapacity{0u};
+    /// offset of the oldest valid entry relative to the ring start
+    uint64_t m_oldestOffset{0u};
+    /// offset of the next write relative to the ring start
+    uint64_t m_writeOffset{0u};
+    /// bytes of the ring currently occupied by entries and wrap markers
+    uint64_t m_validBytes{0u};
+    uint64_t m_recordedChunks{0u};
+    uint64_t m_overwrittenChunks{0u};
+};
+
+/// per chunk entry in the ring region, directly followed by the payload bytes.
+/// an entry never straddles the ring end; an entrySize of 0 is a wrap marker,
+/// the rest of the ring up to the end is unused then and reading continues at 0
+struct RecordEntryHeader
+{
+    /// total size of the entry including this header, 0 marks a wrap
+    uint32_t m_entrySize{0u};
+    uint32_t m_payloadSize{0u};
+    /// send timestamp of the recorded chunk in nanoseconds, replay restores the
+    /// original inter sample gaps from consecutive timestamps
+    uint64_t m_txTimestampNs{0u};
+    uint32_t m_sequenceNumber{0u};
+    uint8_t m_externalSequenceNumber{0u};
+    uint8_t m_padding[3u]{};
+};
+
+/// @brief Appends delivered chunks (chunk info and payload) into a memory
+///         mapped, ring structured file. Writing a chunk is a memcpy into the
+///         page cache, the kernel writes the pages back in the background and
+///         flushAsync() can request an asynchronous writeback explicitly, so
+///         recording does not block on disk. When the ring is full the oldest
+///         entries are overwritten, a long run therefore always holds the most
+///         recent history of the topic
+/// @concurrent not thread safe, one recorder belongs to one consumer thread
+class ChunkRecorder
+{
+  public:
+    /// @brief Creates (or truncates) the record file and maps it
+    /// @param[in] f_fileName path of the record file
+    /// @param[in] f_ringCapacity size of the ring region in bytes
+    ChunkRecorder(const std::string& f_fileName, const uint64_t f_ringCapacity) noexcept;
+    ~ChunkRecorder() noexcept;
+
+    ChunkRecorder(const ChunkRecorder&) = delete;
+    ChunkRecorder(ChunkRecorder&&) = delete;
+    ChunkRecorder& operator=(const ChunkRecorder&) = delete;
+    ChunkRecorder& operator=(ChunkRecorder&&) = delete;
+
+    /// @brief Returns false when the file could not be created or mapped
+    bool isInitialized() const noexcept;
+
+    /// @brief Appends one chunk to the ring, overwriting the oldest entries
+    ///         when the ring is full
+    /// @param[in] f_chunkHeader chunk as delivered to a receiver port
+    /// @return true when the chunk was recorded, false when it is larger than
+    ///         the whole ring or the recorder is not initialized
+    bool record(const mepoo::ChunkHeader* const f_chunkHeader) noexcept;
+
+    /// @brief Requests an asynchronous writeback of the mapped file; returns
+    ///         immediately, the disk write happens in the background
+    void flushAsync() noexcept;
+
+    /// @brief Number of chunks recorded since the file was created
+    uint64_t recordedChunks() const noexcept;
+
+    /// @brief Number of chunks overwritten because the ring was full
+    uint64_t overwrittenChunks() const noexcept;
+
+  private:
+    void advanceOldest() noexcept;
+    RecordFileHeader* fileHeader() const noexcept;
+    uint8_t* ringStart() const noexcept;
+
+    int m_fileDescriptor{-1};
+    uint64_t m_mappedLength{0u};
+    cxx::optional<posix::MemoryMap> m_memoryMap;
+};
+
+} // namespace recording
+} // namespace iox
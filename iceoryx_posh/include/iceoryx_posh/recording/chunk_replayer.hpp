@@ -0,0 +1,90 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/recording/chunk_recorder.hpp"
+
+#include <functional>
+
+namespace iox
+{
+namespace popo
+{
+class SenderPort;
+}
+
+namespace recording
+{
+/// one decoded entry of a record file handed to the visit callback
+struct ReplayedChunk
+{
+    const RecordEntryHeader* m_entry{nullptr};
+    const uint8_t* m_payload{nullptr};
+};
+
+/// @brief Reads a record file written by the ChunkRecorder and re-injects the
+///         chunks through a sender port. The entries are visited oldest first;
+///         replay() restores the original inter sample gaps from the recorded
+///         timestamps, so subscribers of the replayed topic see the timing of
+///         the recorded run
+/// @concurrent not thread safe, one replayer belongs to one thread
+class ChunkReplayer
+{
+  public:
+    /// @brief Maps an existing record file read only
+    /// @param[in] f_fileName path of the record file
+    ChunkReplayer(const std::string& f_fileName) noexcept;
+    ~ChunkReplayer() noexcept;
+
+    ChunkReplayer(const ChunkReplayer&) = delete;
+    ChunkReplayer(ChunkReplayer&&) = delete;
+    ChunkReplayer& operator=(const ChunkReplayer&) = delete;
+    ChunkReplayer& operator=(ChunkReplayer&&) = delete;
+
+    /// @brief Returns false when the file could not be mapped or is no record file
+    bool isInitialized() const noexcept;
+
+    /// @brief Number of entries in the file
+    uint64_t numberOfChunks() const noexcept;
+
+    /// @brief Visits every entry oldest first without any pacing
+    /// @param[in] f_visitor called once per entry
+    /// @return number of visited entries
+    uint64_t forEachChunk(const std::function<void(const ReplayedChunk&)>& f_visitor) const noexcept;
+
+    /// @brief Re-injects all recorded chunks through the given sender port.
+    ///         For every entry a chunk is reserved from the mempools of the
+    ///         sender, the recorded payload and sequence number are restored
+    ///         and the chunk is delivered. With f_preserveTiming the original
+    ///         gap between consecutive recorded timestamps is waited before
+    ///         each delivery
+    /// @param[in] f_sender offered sender port the chunks are delivered on
+    /// @param[in] f_preserveTiming true restores the recorded pacing, false
+    ///             replays as fast as possible
+    /// @return number of replayed chunks; entries whose chunk reservation
+    ///         failed are skipped
+    uint64_t replay(popo::SenderPort& f_sender, const bool f_preserveTiming = true) const noexcept;
+
+  private:
+    const RecordFileHeader* fileHeader() const noexcept;
+    const uint8_t* ringStart() const noexcept;
+
+    int m_fileDescriptor{-1};
+    uint64_t m_mappedLength{0u};
+    cxx::optional<posix::MemoryMap> m_memoryMap;
+};
+
+} // namespace recording
+} // namespace iox
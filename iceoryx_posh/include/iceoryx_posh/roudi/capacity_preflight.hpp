@@ -0,0 +1,92 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_utils/cxx/vector.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief expected load of one topic class, i.e. how the deployment tells
+/// RouDi what it is going to create; input of the preflight capacity
+/// validation
+struct ExpectedTopicLoad
+{
+    /// payload size of the topic in bytes
+    uint32_t m_payloadSize{0u};
+    /// number of sender ports publishing topics of this payload size
+    uint32_t m_senderPorts{1u};
+    /// depth of the receiver queues subscribed to these topics
+    uint32_t m_receiverQueueDepth{MAX_RECEIVER_QUEUE_SIZE};
+    /// samples retained for late subscribers (deliver on subscription)
+    uint32_t m_historyDepth{0u};
+    /// writer group of the segment the topics are published into; an empty
+    /// group checks the load against every segment
+    std::string m_writerGroup;
+};
+
+/// @brief what happens when the preflight validation finds a mempool whose
+/// capacity does not cover the worst-case demand of the expected load
+enum class CapacityPreflightMode : uint8_t
+{
+    /// no validation (default)
+    OFF,
+    /// log the findings and start anyway
+    WARN,
+    /// log the findings and refuse to start
+    REFUSE
+};
+
+/// @brief configuration of the preflight capacity validation; part of the
+/// RouDi config so a deployment turns a runtime allocation failure under load
+/// into a boot time check
+struct CapacityPreflightConfig
+{
+    static constexpr uint32_t MAX_EXPECTED_TOPIC_LOADS{128u};
+
+    CapacityPreflightMode m_mode{CapacityPreflightMode::OFF};
+    cxx::vector<ExpectedTopicLoad, MAX_EXPECTED_TOPIC_LOADS> m_expectedLoad;
+};
+
+/// @brief worst-case number of chunks the sender ports of one topic class can
+/// pin at the same time: the allocation window of each port, its retained
+/// last chunk, the retained history and a full receiver queue of distinct
+/// samples
+/// @param [in] f_load expected load of the topic class
+/// @return worst-case chunk demand of the topic class
+uint64_t worstCaseChunkDemand(const ExpectedTopicLoad& f_load);
+
+/// @brief validates the mempool configuration of one segment against the
+/// expected load: the demand of every load entry is accumulated onto the
+/// smallest mempool whose chunks fit the payload (the same first fit the
+/// memory manager applies) and compared against the chunk count of the pool.
+/// Every finding is logged
+/// @param [in] f_mempoolConfig mempool configuration of the segment
+/// @param [in] f_writerGroup writer group of the segment; load entries with a
+///             different non-empty writer group are skipped
+/// @param [in] f_preflightConfig the expected load
+/// @return true when every mempool covers the worst-case demand
+bool validateSegmentCapacity(const mepoo::MePooConfig& f_mempoolConfig,
+                             const std::string& f_writerGroup,
+                             const CapacityPreflightConfig& f_preflightConfig);
+
+} // namespace roudi
+} // namespace iox
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_utils/cxx/vector.hpp"
+#include "iceoryx_utils/internal/concurrent/snapshot_buffer.hpp"
 
 namespace iox
 {
@@ -37,6 +38,16 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
     uint32_t m_payloadSize{0};
+    /// number of getChunk calls which could not be served since the mempool was exhausted
+    uint64_t m_failedAllocations{0};
+    /// CAS retries in the lock-free free-list, an indicator for allocation contention
+    uint64_t m_freeListPopRetries{0};
+    /// number of used chunks at which the exhaustion early warning triggers, 0 if no
+    /// high watermark was configured for the mempool
+    uint32_t m_highWatermark{0};
+    /// CAS retries when freeing chunks back into the free-list, the counterpart of
+    /// m_freeListPopRetries for the release side
+    uint64_t m_freeListPushRetries{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -51,6 +62,60 @@ struct MemPoolIntrospectionTopic
     MemPoolInfoContainer m_mempoolInfo;
 };
 
+const capro::ServiceDescription IntrospectionMempoolEventService("Introspection", "RouDi_ID", "MemPoolEvents");
+
+/// @brief exhaustion early warning of a single mempool. An event is emitted when the
+/// chunk usage crosses the high watermark configured in the MePooConfig entry of the
+/// pool, so monitoring can react before getChunk calls start to fail.
+struct MemPoolEvent
+{
+    /// @brief id of the segment the mempool belongs to, matching the m_id of the
+    /// MemPoolIntrospectionTopic samples
+    uint32_t m_id{0};
+    /// @brief index of the mempool within the segment
+    uint32_t m_memPoolIndex{0};
+    uint32_t m_usedChunks{0};
+    uint32_t m_numChunks{0};
+    uint32_t m_highWatermark{0};
+    /// @brief true when the usage rose to or above the high watermark, false when it
+    /// dropped below it again
+    bool m_aboveHighWatermark{false};
+};
+
+/// @brief the topic for the mempool exhaustion early warning events that a user can
+/// subscribe to. In contrast to the periodic MemPoolIntrospectionTopic samples, a
+/// sample is only published when the usage of at least one mempool crossed its high
+/// watermark since the previous snapshot.
+struct MemPoolIntrospectionEventTopic
+{
+    /// @brief incremented with every published sample
+    uint64_t m_sequenceNumber{0};
+    cxx::vector<MemPoolEvent, MAX_NUMBER_OF_MEMPOOLS> m_events;
+};
+
+const capro::ServiceDescription IntrospectionMemoryAccountingService("Introspection", "RouDi_ID", "MemoryAccounting");
+
+/// @brief outstanding chunk count of one sender port in one memory segment,
+/// i.e. which topic is holding how much of the memory of the segment
+struct PortMemoryAccountingData
+{
+    /// @brief unique identifier of the port, matching the m_senderPortID of
+    /// the port introspection
+    uint64_t m_portID{0};
+    uint32_t m_outstandingChunks{0};
+    uint64_t m_totalAllocations{0};
+};
+
+/// @brief the topic for the per-port memory accounting that a user can
+/// subscribe to; one sample per memory segment, the m_id matches the one of
+/// the MemPoolIntrospectionTopic samples. Together with the mempool usage it
+/// answers which topic is eating which pool while the system runs
+struct MemoryAccountingIntrospectionTopic
+{
+    uint32_t m_id{0};
+    cxx::vector<PortMemoryAccountingData, MAX_ACCOUNTED_PORTS_PER_SEGMENT> m_portAccounting;
+};
+
 const capro::ServiceDescription IntrospectionPortService("Introspection", "RouDi_ID", "Port");
 
 /// @brief sender/receiver port information consisting of a process name,a capro service description string
@@ -71,7 +136,14 @@ struct ReceiverPortData : public PortData
 {
     /// @brief identifier of the sender port to which this receiver port is connected.
     /// If no matching sender port exists, this should equal -1.
+    /// The index is only valid within a complete state sample; in a delta sample
+    /// the connected sender is identified by m_connectedSenderPortID instead.
     int32_t m_senderIndex{-1};
+    /// @brief unique identifier of this receiver port
+    uint64_t m_receiverPortID{0};
+    /// @brief unique identifier of the sender port to which this receiver port is
+    /// connected, 0 if it is not connected
+    uint64_t m_connectedSenderPortID{0};
 };
 
 /// @brief container for sender port introspection data.
@@ -80,11 +152,26 @@ struct SenderPortData : public PortData
     uint64_t m_senderPortID{0};
 };
 
-/// @brief the topic for the port introspection that a user can subscribe to
+/// @brief the topic for the port introspection that a user can subscribe to.
+/// A sample either contains the complete port state or only the entries which
+/// changed since the previous sample (delta). The sequence number allows a
+/// subscriber to detect missed deltas; it then has to wait for the next
+/// complete state sample to resynchronize.
 struct PortIntrospectionFieldTopic
 {
+    /// @brief incremented with every published sample
+    uint64_t m_sequenceNumber{0};
+    /// @brief true if the sample contains all ports, false if it only contains
+    /// the entries which changed since the previous sample
+    bool m_completeState{true};
     cxx::vector<ReceiverPortData, MAX_PORT_NUMBER> m_receiverList;
     cxx::vector<SenderPortData, MAX_PORT_NUMBER> m_senderList;
+    /// @brief unique identifiers of the sender ports removed since the previous
+    /// sample, only used in delta samples
+    cxx::vector<uint64_t, MAX_PORT_NUMBER> m_removedSenderPortIDs;
+    /// @brief unique identifiers of the receiver ports removed since the
+    /// previous sample, only used in delta samples
+    cxx::vector<uint64_t, MAX_PORT_NUMBER> m_removedReceiverPortIDs;
 };
 
 const capro::ServiceDescription IntrospectionPortThroughputService("Introspection", "RouDi_ID", "PortThroughput");
@@ -97,6 +184,19 @@ struct PortThroughputData
     double m_chunksPerMinute{0};
     uint64_t m_lastSendIntervalInNanoseconds{0};
     bool m_isField{false};
+    /// histogram of the payload sizes requested with reserveChunk since port
+    /// creation, bucket i counts the requests of at most 2^i bytes; together
+    /// with the byte sums below a topic which allocates small payloads from
+    /// an oversized mempool shows up as a granted to requested ratio far
+    /// above one
+    uint64_t m_requestedPayloadHistogram[CHUNK_SIZE_HISTOGRAM_BUCKETS]{};
+    uint64_t m_requestedPayloadBytes{0};
+    uint64_t m_grantedChunkBytes{0};
+    /// chunk quota of the port, all zero when no quota is configured; a rising
+    /// denied count marks a publisher which keeps running into its quota
+    uint32_t m_chunkQuotaLimit{0};
+    uint32_t m_chunkQuotaUsedChunks{0};
+    uint64_t m_chunkQuotaDeniedRequests{0};
 };
 
 /// @brief the topic for the port throughput that a user can subscribe to
@@ -110,12 +210,23 @@ const capro::ServiceDescription
 
 struct ReceiverPortChangingData
 {
-    // index used to identify receiver is same as in PortIntrospectionFieldTopic->receiverList
+    // unique identifier to find the corresponding receiver in
+    // PortIntrospectionFieldTopic->receiverList, 0 for ports without port data
+    uint64_t receiverPortID{0};
     uint64_t fifoSize{0};
     uint64_t fifoCapacity{0};
     iox::SubscribeState subscriptionState{iox::SubscribeState::NOT_SUBSCRIBED};
     bool sampleSendCallbackActive{false};
     capro::Scope propagationScope{capro::Scope::INVALID};
+    // end-to-end latency of the port calculated from the tx timestamps of the
+    // fetched chunks, all zero unless latency tracking is enabled on the port
+    uint64_t latencySampleCount{0};
+    uint64_t latencyP50Ns{0};
+    uint64_t latencyP99Ns{0};
+    uint64_t latencyMaxNs{0};
+    // failed compare and swap attempts on the read index of the delivery FiFo,
+    // i.e. how often the sender overflowed while the receiver was reading
+    uint64_t fifoIndexConflicts{0};
 };
 
 struct ReceiverPortChangingIntrospectionFieldTopic
@@ -138,5 +249,22 @@ struct ProcessIntrospectionFieldTopic
     cxx::vector<ProcessIntrospectionData, MAX_PROCESS_NUMBER> m_processList;
 };
 
+/// @brief container with one MemPoolIntrospectionTopic entry per memory
+/// segment as written into the shared memory snapshot region; index 0 holds
+/// the internal RouDi memory manager
+using MemPoolIntrospectionTopicContainer = cxx::vector<MemPoolIntrospectionTopic, MAX_SHM_SEGMENTS + 1>;
+
+/// @brief snapshot region in the management segment which RouDi updates in
+/// place with the latest introspection state. In contrast to the subscribable
+/// introspection topics above, which RouDi has to serialize per subscriber
+/// per interval, any number of monitoring consumers can sample the snapshots
+/// without costing RouDi per consumer work
+struct IntrospectionShmSnapshots
+{
+    concurrent::SnapshotBuffer<MemPoolIntrospectionTopicContainer> m_memPoolTopics;
+    concurrent::SnapshotBuffer<ProcessIntrospectionFieldTopic> m_processTopic;
+    concurrent::SnapshotBuffer<PortIntrospectionFieldTopic> m_portTopic;
+};
+
 } // namespace roudi
 } // namespace iox
@@ -17,6 +17,7 @@
 #include "iceoryx_posh/iceoryx_posh_config.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_posh/roudi/roudi_config_file_parser.hpp"
+#include "iceoryx_posh/roudi/startup_profiler.hpp"
 #include "iceoryx_utils/log/logcommon.hpp"
 
 #include <cstdint>
@@ -66,6 +67,13 @@ class RouDiApp
     /// @brief interface to start the execution of the RouDi daemon
     virtual void run() noexcept = 0;
 
+    /// @brief report with the durations of the timed RouDi startup phases (segment
+    /// creation, mempool initialization, ACL setup, mq handling, introspection
+    /// start); complete once the daemon finished its startup. The report is also
+    /// logged once when RouDi is ready
+    /// @return the recorded startup phases in the order they finished
+    static StartupProfiler::PhaseContainer getStartupReport() noexcept;
+
   protected:
     enum class CmdLineArgumentParsingMode
     {
@@ -15,6 +15,8 @@
 #pragma once
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/roudi/capacity_preflight.hpp"
+#include "iceoryx_utils/posix_wrapper/thread_attributes.hpp"
 
 #include <cstdint>
 
@@ -24,13 +26,35 @@ namespace roudi
 {
 struct RouDiConfig
 {
+    /// preflight capacity validation of the mempool configuration against the
+    /// expected topology, see CapacityPreflightConfig; off by default
+    CapacityPreflightConfig preflight;
+
     struct
     {
         /// @todo since we are now fully relocatable, this can be removed
         uintptr_t m_sharedMemoryBaseAddressOffset = 0;
         bool m_verifySharedMemoryPlacement = false;
+        /// re-adopt the shared memory segments of a crashed RouDi instance on
+        /// restart instead of recreating them; the running applications keep
+        /// their ports and data flow is not interrupted
+        bool m_persistentShm = false;
     } roudi;
 
+    /// scheduling of RouDi's internal housekeeping threads; by default only
+    /// the names are set and the threads inherit affinity and policy, setting
+    /// an affinity mask allows to exile the housekeeping from the data path
+    /// cores
+    struct
+    {
+        posix::ThreadAttributes m_processManagement{0u, 0, "ProcessMgmt"};
+        posix::ThreadAttributes m_mqProcessing{0u, 0, "MQ-processing"};
+        posix::ThreadAttributes m_commandChannel{0u, 0, "CmdChannel"};
+        /// applied to all workers of the registration pool
+        posix::ThreadAttributes m_registration{0u, 0, "Registration"};
+        posix::ThreadAttributes m_portReclaimer{0u, 0, "PortReclaimer"};
+    } threads;
+
     RouDiConfig& setDefaults();
     RouDiConfig& optimize();
 };
@@ -0,0 +1,33 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_posh/iceoryx_posh_config.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief The RouDi configuration embedded into the binary at build time.
+/// Implemented by the translation unit which tools/roudi_config_codegen.py
+/// generates from a RouDi TOML config file; building with
+/// -DBUILTIN_CONFIG_FILE=<file> compiles it in. The segment and mempool
+/// tables live in .rodata, RouDi boots without any config file access,
+/// parsing or the TOML parser dependency
+/// @return the embedded RouDi configuration
+RouDiConfig_t builtinRouDiConfig() noexcept;
+
+} // namespace roudi
+} // namespace iox
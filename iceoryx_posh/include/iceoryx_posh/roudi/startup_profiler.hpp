@@ -0,0 +1,80 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/cxx/vector.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Collects the durations of the RouDi startup phases (segment creation,
+///        mempool initialization, ACL setup, message queue handling, introspection
+///        start). The phases are marked in the startup code itself, logged once
+///        when RouDi is ready and can be queried via RouDiApp::getStartupReport(),
+///        so boot time regressions are visible in CI and in the field without
+///        adding temporary printouts.
+/// @concurrent phaseDone() and the accessors are mutex protected, phases may be
+///             recorded from different threads during startup
+class StartupProfiler
+{
+  public:
+    static constexpr uint32_t MAX_PHASES{32u};
+
+    struct Phase
+    {
+        /// @brief name of the phase, a string literal provided at the mark site
+        const char* m_name{nullptr};
+        /// @brief time between the end of the previously recorded phase and this one
+        uint64_t m_durationNs{0u};
+    };
+    using PhaseContainer = cxx::vector<Phase, MAX_PHASES>;
+
+    /// @brief the profiler of this process; created with the first recorded phase
+    static StartupProfiler& instance() noexcept;
+
+    StartupProfiler(const StartupProfiler&) = delete;
+    StartupProfiler(StartupProfiler&&) = delete;
+    StartupProfiler& operator=(const StartupProfiler&) = delete;
+    StartupProfiler& operator=(StartupProfiler&&) = delete;
+
+    /// @brief records the end of a startup phase; the duration of the phase is the
+    ///        time since the end of the previously recorded phase, or since the
+    ///        first use of the profiler for the first phase. The same name may be
+    ///        recorded several times, e.g. once per payload segment
+    /// @param [in] f_phaseName name of the finished phase, has to be a string literal
+    void phaseDone(const char* f_phaseName) noexcept;
+
+    /// @brief logs all recorded phases and the sum in a single line; phases which
+    ///        finish afterwards are only visible in getReport()
+    void logReport() const noexcept;
+
+    /// @return a copy of the recorded phases in the order they finished
+    PhaseContainer getReport() const noexcept;
+
+  private:
+    StartupProfiler() noexcept;
+
+    mutable std::mutex m_mutex;
+    std::chrono::steady_clock::time_point m_lastPhaseEnd;
+    PhaseContainer m_phases;
+};
+
+} // namespace roudi
+} // namespace iox
@@ -0,0 +1,64 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief An iceoryx domain is one independent RouDi instance with its own
+///         management segment, message queue namespace, port capacity and
+///         fault domain. Several domains on one host scale the total port
+///         count past MAX_PORT_NUMBER and isolate their failures; topics are
+///         bridged between domains with GatewayGeneric::bridgeChunks or the
+///         UDP gateway on loopback. The domain of a process is selected once
+///         before the runtime or RouDi starts, either programmatically via
+///         setDomainId / PoshRuntime::getInstance with a domain id or with
+///         the environment variable IOX_DOMAIN_ID. Domain 0 is the default
+///         and keeps the legacy resource names
+/// @concurrent setDomainId is not thread safe against the first name query,
+///             select the domain before any other iceoryx call
+class PoshDomain
+{
+  public:
+    static constexpr uint32_t DEFAULT_DOMAIN_ID = 0u;
+    static constexpr uint32_t MAX_DOMAIN_ID = 255u;
+
+    /// @brief Selects the domain of this process, to be called before the
+    ///         runtime or RouDi starts; overrides IOX_DOMAIN_ID
+    /// @param[in] f_domainId id of the domain, at most MAX_DOMAIN_ID
+    /// @return false when the id is out of range
+    static bool setDomainId(const uint32_t f_domainId) noexcept;
+
+    /// @brief The domain id of this process
+    static uint32_t getDomainId() noexcept;
+
+    /// @brief Name of the RouDi message queue of the domain, "/roudi" for
+    ///         domain 0, "/roudi_<id>" otherwise
+    static const char* getRoudiMqName() noexcept;
+
+    /// @brief Name of the management shared memory segment of the domain,
+    ///         "/iceoryx_mgmt" for domain 0, "/iceoryx_mgmt_<id>" otherwise
+    static const char* getMgmtShmName() noexcept;
+
+  private:
+    static void ensureInitialized() noexcept;
+    static void formatNames(const uint32_t f_domainId) noexcept;
+};
+
+} // namespace runtime
+} // namespace iox
@@ -22,11 +22,16 @@
 #include "iceoryx_posh/internal/popo/sender_port.hpp"
 #include "iceoryx_posh/internal/runtime/message_queue_interface.hpp"
 #include "iceoryx_posh/internal/runtime/runnable_property.hpp"
+#include "iceoryx_posh/internal/runtime/runtime_command_channel.hpp"
 #include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
+#include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/service_discovery_notifier.hpp"
 #include "iceoryx_utils/fixed_string/string100.hpp"
+#include "iceoryx_utils/posix_wrapper/thread_attributes.hpp"
 
 #include <atomic>
+#include <condition_variable>
+#include <future>
 #include <map>
 #include <mutex>
 #include <thread>
@@ -39,6 +44,11 @@ namespace roudi
 class RuntimeTestInterface;
 } // namespace roudi
 
+namespace popo
+{
+class ChunkReceiveDispatcher;
+} // namespace popo
+
 namespace runtime
 {
 class Runnable;
@@ -55,10 +65,63 @@ class PoshRuntime
     /// @param[in] name name that is used for registering the process with the RouDi daemon
     static PoshRuntime& getInstance(const std::string& name = DEFAULT_RUNTIME_INSTANCE_NAME) noexcept;
 
+    /// @brief get the singleton and select the iceoryx domain of this process;
+    /// only the first call can choose the domain, the runtime stays in it for
+    /// the process lifetime. See PoshDomain for the domain concept
+    /// @param[in] name name of the runtime instance
+    /// @param[in] domainId id of the domain whose RouDi serves this process
+    /// @return PoshRuntime reference
+    static PoshRuntime& getInstance(const std::string& name, const uint32_t domainId) noexcept;
+
     /// @brief get the name that was used to register with RouDi
     /// @return name of the reistered application
     std::string getInstanceName() const noexcept;
 
+    /// @brief sets the scheduling attributes (affinity mask, SCHED_FIFO
+    /// priority, name) applied to the callback threads this process creates,
+    /// e.g. the receive handler threads of the subscribers; has to be set
+    /// before the threads are created, already running threads keep their
+    /// attributes. A name in the attributes overrides the generated one
+    static void setCallbackThreadAttributes(const posix::ThreadAttributes& f_attributes) noexcept;
+
+    /// @brief the scheduling attributes for callback threads of this process
+    static posix::ThreadAttributes getCallbackThreadAttributes() noexcept;
+
+    /// @brief sets the keep alive interval this process requests from RouDi
+    /// at registration; a slowly changing bulk application can lower its
+    /// share of RouDi's monitoring load with a long interval while a critical
+    /// application keeps a short one for fast failure detection. RouDi clamps
+    /// the interval into [PROCESS_KEEP_ALIVE_INTERVAL_MIN,
+    /// PROCESS_KEEP_ALIVE_INTERVAL_MAX] and removes the process after
+    /// PROCESS_KEEP_ALIVE_TIMEOUT_FACTOR missed intervals; has to be set
+    /// before the runtime singleton is created, a later call has no effect
+    /// @param[in] f_interval requested keep alive interval
+    static void setKeepAliveInterval(const units::Duration f_interval) noexcept;
+
+    /// @brief the keep alive interval requested at registration
+    static units::Duration getKeepAliveInterval() noexcept;
+
+    /// @brief the process wide event dispatcher; all receive handlers attached
+    /// to it share a small pool of worker threads instead of one dedicated
+    /// callback thread per subscriber (see Subscriber::setSharedReceiveHandler),
+    /// created on the first call
+    /// @return reference to the process wide dispatcher
+    static popo::ChunkReceiveDispatcher& getEventDispatcher() noexcept;
+
+    /// @brief number of worker threads of the process wide event dispatcher;
+    /// only effective when called before the first getEventDispatcher call,
+    /// the pool size cannot be changed for a running dispatcher
+    /// @param[in] f_numberOfThreads worker threads serving the attached handlers
+    static void setEventDispatcherThreadCount(const uint32_t f_numberOfThreads) noexcept;
+
+    /// @brief access to the introspection snapshot region in the management
+    /// segment; RouDi updates the snapshots in place and any number of
+    /// monitoring consumers can sample them without costing RouDi per
+    /// consumer work
+    /// @return pointer to the snapshot region, nullptr if RouDi did not
+    /// provide one
+    roudi::IntrospectionShmSnapshots* getIntrospectionSnapshots() noexcept;
+
     /// @brief find all services that match the provided service description
     /// @param[in] serviceDescription service to search for
     /// @param[out] instanceContainer container that is filled with all matching instances
@@ -95,10 +158,31 @@ class PoshRuntime
     /// @param[in] serviceDescription service description for the new sender port
     /// @param[in] interface interface to which the sender port shall belong
     /// @param[in] runnableName name of the runnable where the sender should belong to
+    /// @param[in] sampleAllocateCapacity allocation window of the port, i.e. how many
+    /// chunks it may hold unsent at the same time, clamped to
+    /// [1, MAX_SAMPLE_ALLOCATE_PER_SENDER_CAPACITY]; a deep pipeline can pre-stage
+    /// its buffers with a large window and never allocate mid-stream
     /// @return poiner to a created sender port data
-    SenderPortType::MemberType_t* getMiddlewareSender(const capro::ServiceDescription& service,
-                                                      const Interfaces interface = Interfaces::INTERNAL,
-                                                      const cxx::CString100& runnableName = "") noexcept;
+    SenderPortType::MemberType_t*
+    getMiddlewareSender(const capro::ServiceDescription& service,
+                        const Interfaces interface = Interfaces::INTERNAL,
+                        const cxx::CString100& runnableName = "",
+                        const uint32_t sampleAllocateCapacity = MAX_SAMPLE_ALLOCATE_PER_SENDER) noexcept;
+
+    /// @brief asynchronous variant of getMiddlewareSender which does not
+    /// block the calling thread for the round trip to the RouDi daemon; the
+    /// request is performed on a worker with its own command channel so port
+    /// creation can overlap with the rest of the application initialization
+    /// @param[in] serviceDescription service description for the new sender port
+    /// @param[in] interface interface to which the sender port shall belong
+    /// @param[in] runnableName name of the runnable where the sender should belong to
+    /// @param[in] sampleAllocateCapacity allocation window of the port, see getMiddlewareSender
+    /// @return future delivering the pointer to the created sender port data
+    std::future<SenderPortType::MemberType_t*>
+    getMiddlewareSenderAsync(const capro::ServiceDescription& service,
+                             const Interfaces interface = Interfaces::INTERNAL,
+                             const cxx::CString100& runnableName = "",
+                             const uint32_t sampleAllocateCapacity = MAX_SAMPLE_ALLOCATE_PER_SENDER) noexcept;
 
     /// @brief request the RouDi daemon to create a receiver port
     /// @param[in] serviceDescription service description for the new receiver port
@@ -109,6 +193,31 @@ class PoshRuntime
                                                           const Interfaces interface = Interfaces::INTERNAL,
                                                           const cxx::CString100& runnableName = "") noexcept;
 
+    /// @brief asynchronous variant of getMiddlewareReceiver, see
+    /// getMiddlewareSenderAsync for details
+    /// @param[in] serviceDescription service description for the new receiver port
+    /// @param[in] interface interface to which the receiver port shall belong
+    /// @param[in] runnableName name of the runnable where the receiver should belong to
+    /// @return future delivering the pointer to the created receiver port data
+    std::future<ReceiverPortType::MemberType_t*>
+    getMiddlewareReceiverAsync(const capro::ServiceDescription& service,
+                               const Interfaces interface = Interfaces::INTERNAL,
+                               const cxx::CString100& runnableName = "") noexcept;
+
+    /// @brief request the RouDi daemon to create many receiver ports with a
+    /// single pipelined transaction; applications attaching to hundreds of
+    /// topics pay one command channel hand shake instead of one blocking
+    /// round trip per port
+    /// @param[in] services service descriptions for the new receiver ports
+    /// @param[in] interface interface to which the receiver ports shall belong
+    /// @param[in] runnableName name of the runnable where the receivers should belong to
+    /// @return one pointer per requested service in request order, nullptr
+    ///         entries for ports RouDi could not create
+    std::vector<ReceiverPortType::MemberType_t*>
+    getMiddlewareReceiverBatch(const std::vector<capro::ServiceDescription>& services,
+                               const Interfaces interface = Interfaces::INTERNAL,
+                               const cxx::CString100& runnableName = "") noexcept;
+
     /// @brief request the RouDi daemon to create an interface port
     /// @param[in] interface interface to create
     /// @param[in] runnableName name of the runnable where the interface should belong to
@@ -147,6 +256,14 @@ class PoshRuntime
     /// @return true if sucessful send message, false on error
     bool sendMessageToRouDi(const MqMessage& msg) noexcept;
 
+    /// @brief sends a batch of requests to the RouDi daemon with a pipelined
+    ///        transfer instead of one round trip per request; the responses
+    ///        are returned in request order
+    /// @param[in] requests request messages to send
+    /// @param[out] answers one response per request
+    /// @return true if all requests were answered, false on error
+    bool sendRequestBatchToRouDi(const std::vector<MqMessage>& requests, std::vector<MqMessage>& answers) noexcept;
+
   public:
     PoshRuntime(const PoshRuntime&) = delete;
     PoshRuntime& operator=(const PoshRuntime&) = delete;
@@ -163,13 +280,45 @@ class PoshRuntime
     static PoshRuntime& defaultRuntimeFactory(const std::string& name) noexcept;
 
   private:
+    static std::mutex s_callbackThreadAttributesMutex;
+    static posix::ThreadAttributes s_callbackThreadAttributes;
+
+    static std::mutex s_keepAliveIntervalMutex;
+    static units::Duration s_keepAliveInterval;
+
     cxx::expected<SenderPortType::MemberType_t*, MqMessageErrorType>
     requestSenderFromRoudi(const MqMessage& sendBuffer) noexcept;
 
     ReceiverPortType::MemberType_t* requestReceiverFromRoudi(const MqMessage& sendBuffer) noexcept;
 
+    /// @brief extracts the receiver port data pointer from an IMPL_RECEIVER_ACK
+    ///         response, nullptr when the response is no valid acknowledgement
+    static ReceiverPortType::MemberType_t* receiverFromResponse(const MqMessage& receiveBuffer) noexcept;
+
     const std::string& verifyInstanceName(const std::string& name) noexcept;
 
+    /// @brief resolves the command channel from the offset received with the
+    /// REG_ACK and seeds the channel pool with it; requires the mapped
+    /// management segment, therefore it has to be called after the
+    /// construction of m_ShmInterface
+    /// @return pointer to the command channel, nullptr if RouDi did not provide one
+    RuntimeCommandChannel* resolveCommandChannel() noexcept;
+
+    /// @brief takes a command channel from the pool; grows the pool with
+    /// channels requested from RouDi while all channels are in use, blocks
+    /// when the pool is exhausted
+    /// @return an exclusively owned channel, never nullptr
+    RuntimeCommandChannel* acquireCommandChannel() noexcept;
+
+    /// @brief returns a channel taken with acquireCommandChannel to the pool
+    /// @param[in] channel the channel to return
+    void releaseCommandChannel(RuntimeCommandChannel* const channel) noexcept;
+
+    /// @brief requests an additional command channel from RouDi; uses the
+    /// message queue so it does not need a channel itself
+    /// @return pointer to the new channel, nullptr if RouDi has none left
+    RuntimeCommandChannel* requestCommandChannelFromRoudi() noexcept;
+
     const std::string m_appName;
     mutable std::mutex m_appMqRequestMutex;
 
@@ -177,15 +326,38 @@ class PoshRuntime
     MqRuntimeInterface m_MqInterface;
     // Shared memory interface for POSIX IPC from RouDi
     SharedMemoryUser m_ShmInterface;
+
+    /// an application may grow its channel pool up to this many channels so
+    /// that threads can issue runtime requests concurrently
+    static constexpr uint32_t MAX_COMMAND_CHANNELS_PER_RUNTIME{8u};
+    // pool of currently unused command channels; the channel received with the
+    // REG_ACK is the initial entry, more are requested from RouDi on demand
+    mutable std::mutex m_commandChannelPoolMutex;
+    std::condition_variable m_commandChannelAvailable;
+    std::vector<RuntimeCommandChannel*> m_freeCommandChannels;
+    uint32_t m_commandChannelCount{0u};
+
+    // Primary shared memory command channel for the runtime requests after
+    // registration; nullptr if RouDi did not provide one, then the message
+    // queue is used. The heartbeat always travels over this channel.
+    RuntimeCommandChannel* m_commandChannel{nullptr};
     popo::ApplicationPort m_applicationPort;
 
+    // requested once from RouDi, afterwards answered from this cached pointer
+    const std::atomic<uint64_t>* m_serviceRegistryChangeCounter{nullptr};
+    mutable std::mutex m_findServiceCacheMutex;
+    // findService responses keyed by the wire format of the queried service;
+    // valid as long as the service registry generation counter matches
+    std::map<std::string, InstanceContainer> m_findServiceCache;
+    uint64_t m_findServiceCacheGeneration{0u};
+
     void sendKeepAlive() noexcept;
     static_assert(PROCESS_KEEP_ALIVE_INTERVAL > DISCOVERY_INTERVAL, "Keep alive interval too small");
 
     ServiceDiscoveryNotifier m_serviceDiscoveryNotifier;
 
     /// @note the m_keepAliveTimer should always be the last member, so that it will be the first member to be detroyed
-    iox::posix::Timer m_keepAliveTimer{PROCESS_KEEP_ALIVE_INTERVAL, [&]() { this->sendKeepAlive(); }};
+    iox::posix::Timer m_keepAliveTimer{getKeepAliveInterval(), [&]() { this->sendKeepAlive(); }};
 };
 
 } // namespace runtime
@@ -19,6 +19,8 @@
 #include "iceoryx_utils/posix_wrapper/timer.hpp"
 
 #include <atomic>
+#include <map>
+#include <string>
 
 namespace iox
 {
@@ -84,8 +86,12 @@ class ServiceDiscoveryNotifier
     uint64_t m_changeCountAtLastServiceDiscovery{0};
 
 
-    // Store descriptor per registered service
-    iox::cxx::vector<ServiceHandlerDescription, MAX_START_FIND_SERVICE_CALLBACKS> m_handlers;
+    // Descriptors indexed by the service ID they monitor, so registration and
+    // deregistration do not have to scan all registered searches
+    std::map<std::string, ServiceHandlerDescription> m_handlersByService;
+
+    // Maps the handle returned by startFindService back to the service ID
+    std::map<FindServiceHandle, std::string> m_serviceByHandle;
 
     // Mutex to synchronise access to m_handlers
     mutable std::mutex m_queueAccessMutex;
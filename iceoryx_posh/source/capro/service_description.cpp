@@ -14,12 +14,59 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 
+#include <cstring>
 #include <iomanip>
 
 namespace iox
 {
 namespace capro
 {
+namespace
+{
+/// fixed layout POD image of a ServiceDescription; zero initialized before use so
+/// the padding and the unused tail of the strings encode deterministically
+struct ServiceDescriptionWire
+{
+    uint16_t m_serviceID;
+    uint16_t m_eventID;
+    uint16_t m_instanceID;
+    uint16_t m_scope;
+    uint32_t m_classHash[4];
+    uint8_t m_hasServiceOnlyDescription;
+    char m_serviceString[101];
+    char m_instanceString[101];
+    char m_eventString[101];
+};
+
+constexpr char HexDigits[] = "0123456789abcdef";
+
+/// FNV-1a, 64-Bit; a separator byte is folded in after every string so the
+/// field boundaries contribute to the hash
+uint64_t hashAppend(uint64_t f_hash, const char* f_string)
+{
+    constexpr uint64_t Prime = 0x100000001B3u;
+    for (; *f_string != '\0'; ++f_string)
+    {
+        f_hash = (f_hash ^ static_cast<uint8_t>(*f_string)) * Prime;
+    }
+    return (f_hash ^ 0xFFu) * Prime;
+}
+
+bool hexNibble(const char f_char, uint8_t& f_nibble)
+{
+    if (f_char >= '0' && f_char <= '9')
+    {
+        f_nibble = static_cast<uint8_t>(f_char - '0');
+        return true;
+    }
+    if (f_char >= 'a' && f_char <= 'f')
+    {
+        f_nibble = static_cast<uint8_t>(f_char - 'a' + 10);
+        return true;
+    }
+    return false;
+}
+} // namespace
 ServiceDescription::ClassHash::ClassHash(const std::initializer_list<uint32_t>& values) noexcept
 {
     uint64_t index = 0;
@@ -78,6 +125,7 @@ ServiceDescription::ServiceDescription(const cxx::Serialization& f_serial) noexc
     {
         m_scope = static_cast<Scope>(scope);
     }
+    updateHash();
 }
 
 ServiceDescription::ServiceDescription() noexcept
@@ -105,6 +153,7 @@ ServiceDescription::ServiceDescription(uint16_t f_serviceID, uint16_t f_eventID,
     , m_instanceString(std::to_string(f_instanceID).c_str())
     , m_eventString(std::to_string(f_eventID).c_str())
 {
+    updateHash();
 }
 
 ServiceDescription::ServiceDescription(const IdString& f_service,
@@ -142,10 +191,21 @@ ServiceDescription::ServiceDescription(const IdString& f_service,
     {
         m_eventID = InvalidID;
     }
+    updateHash();
 }
 
 bool ServiceDescription::operator==(const ServiceDescription& rhs) const
 {
+    // fast path when no wildcards are involved; different hashes imply
+    // different strings, equal hashes still require the full comparison
+    bool hasWildcards = (m_serviceID == AnyService) || (rhs.m_serviceID == AnyService)
+                        || (m_instanceID == AnyInstance) || (rhs.m_instanceID == AnyInstance)
+                        || (m_eventID == AnyEvent) || (rhs.m_eventID == AnyEvent);
+    if (!hasWildcards && (m_hash != rhs.m_hash))
+    {
+        return false;
+    }
+
     if ((m_serviceID != AnyService) && (rhs.m_serviceID != AnyService))
     {
         if ((m_serviceID != rhs.m_serviceID) || (m_serviceString != rhs.m_serviceString))
@@ -211,6 +271,7 @@ ServiceDescription& ServiceDescription::operator=(const ServiceDescription& othe
     m_hasServiceOnlyDescription = other.m_hasServiceOnlyDescription;
     m_classHash = other.m_classHash;
     m_scope = other.m_scope;
+    m_hash = other.m_hash;
 
     return *this;
 }
@@ -232,6 +293,82 @@ ServiceDescription::operator cxx::Serialization() const
                                       scope);
 }
 
+std::string ServiceDescription::toWireFormat() const noexcept
+{
+    ServiceDescriptionWire l_wire;
+    memset(&l_wire, 0, sizeof(l_wire));
+
+    l_wire.m_serviceID = m_serviceID;
+    l_wire.m_eventID = m_eventID;
+    l_wire.m_instanceID = m_instanceID;
+    l_wire.m_scope = static_cast<std::underlying_type<Scope>::type>(m_scope);
+    for (uint64_t i = 0u; i < 4u; ++i)
+    {
+        l_wire.m_classHash[i] = m_classHash[i];
+    }
+    l_wire.m_hasServiceOnlyDescription = m_hasServiceOnlyDescription ? 1u : 0u;
+    strncpy(l_wire.m_serviceString, m_serviceString.to_cstring(), sizeof(l_wire.m_serviceString) - 1u);
+    strncpy(l_wire.m_instanceString, m_instanceString.to_cstring(), sizeof(l_wire.m_instanceString) - 1u);
+    strncpy(l_wire.m_eventString, m_eventString.to_cstring(), sizeof(l_wire.m_eventString) - 1u);
+
+    std::string l_result(2u * sizeof(ServiceDescriptionWire), '0');
+    auto l_raw = reinterpret_cast<const uint8_t*>(&l_wire);
+    for (size_t i = 0u; i < sizeof(ServiceDescriptionWire); ++i)
+    {
+        l_result[2u * i] = HexDigits[l_raw[i] >> 4u];
+        l_result[2u * i + 1u] = HexDigits[l_raw[i] & 0x0Fu];
+    }
+    return l_result;
+}
+
+bool ServiceDescription::fromWireFormat(const std::string& f_wire, ServiceDescription& f_serviceDescription) noexcept
+{
+    if (f_wire.size() != 2u * sizeof(ServiceDescriptionWire))
+    {
+        return false;
+    }
+
+    ServiceDescriptionWire l_wire;
+    auto l_raw = reinterpret_cast<uint8_t*>(&l_wire);
+    for (size_t i = 0u; i < sizeof(ServiceDescriptionWire); ++i)
+    {
+        uint8_t l_high{0u};
+        uint8_t l_low{0u};
+        if (!hexNibble(f_wire[2u * i], l_high) || !hexNibble(f_wire[2u * i + 1u], l_low))
+        {
+            return false;
+        }
+        l_raw[i] = static_cast<uint8_t>((l_high << 4u) | l_low);
+    }
+
+    // the strings are null terminated by construction, enforce it for robustness
+    l_wire.m_serviceString[sizeof(l_wire.m_serviceString) - 1u] = '\0';
+    l_wire.m_instanceString[sizeof(l_wire.m_instanceString) - 1u] = '\0';
+    l_wire.m_eventString[sizeof(l_wire.m_eventString) - 1u] = '\0';
+
+    f_serviceDescription.m_serviceID = l_wire.m_serviceID;
+    f_serviceDescription.m_eventID = l_wire.m_eventID;
+    f_serviceDescription.m_instanceID = l_wire.m_instanceID;
+    f_serviceDescription.m_serviceString = IdString(l_wire.m_serviceString);
+    f_serviceDescription.m_instanceString = IdString(l_wire.m_instanceString);
+    f_serviceDescription.m_eventString = IdString(l_wire.m_eventString);
+    f_serviceDescription.m_hasServiceOnlyDescription = (l_wire.m_hasServiceOnlyDescription != 0u);
+    for (uint64_t i = 0u; i < 4u; ++i)
+    {
+        f_serviceDescription.m_classHash[i] = l_wire.m_classHash[i];
+    }
+    if (l_wire.m_scope > static_cast<std::underlying_type<Scope>::type>(Scope::INVALID))
+    {
+        f_serviceDescription.m_scope = Scope::INVALID;
+    }
+    else
+    {
+        f_serviceDescription.m_scope = static_cast<Scope>(l_wire.m_scope);
+    }
+    f_serviceDescription.updateHash();
+    return true;
+}
+
 std::string ServiceDescription::getServiceString() const noexcept
 {
     std::stringstream l_strStream;
@@ -297,6 +434,20 @@ ServiceDescription::ClassHash ServiceDescription::getClassHash() const noexcept
     return m_classHash;
 }
 
+uint64_t ServiceDescription::getHash() const noexcept
+{
+    return m_hash;
+}
+
+void ServiceDescription::updateHash() noexcept
+{
+    constexpr uint64_t OffsetBasis = 0xCBF29CE484222325u;
+    uint64_t l_hash = hashAppend(OffsetBasis, m_serviceString.to_cstring());
+    l_hash = hashAppend(l_hash, m_instanceString.to_cstring());
+    l_hash = hashAppend(l_hash, m_eventString.to_cstring());
+    m_hash = l_hash;
+}
+
 bool serviceMatch(const ServiceDescription& first, const ServiceDescription& second) noexcept
 {
     return (first.getServiceID() == second.getServiceID());
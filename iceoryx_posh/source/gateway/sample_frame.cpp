@@ -0,0 +1,116 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/gateway/sample_frame.hpp"
+
+#include "iceoryx_utils/cxx/payload_copy.hpp"
+
+namespace iox
+{
+namespace gateway
+{
+constexpr uint32_t FrameHeader::MAGIC;
+
+FrameBuilder::FrameBuilder(uint8_t* const f_buffer, const uint32_t f_capacity) noexcept
+    : m_buffer(f_buffer)
+    , m_capacity(f_capacity)
+    , m_header(reinterpret_cast<FrameHeader*>(f_buffer))
+{
+    *m_header = FrameHeader();
+}
+
+bool FrameBuilder::addSample(const uint64_t f_serviceHash,
+                             const uint32_t f_sequenceNumber,
+                             const void* const f_payload,
+                             const uint32_t f_payloadSize) noexcept
+{
+    const uint32_t neededBytes = static_cast<uint32_t>(sizeof(FrameSampleHeader)) + f_payloadSize;
+    if (m_header->m_frameBytes + neededBytes > m_capacity || m_header->m_frameBytes + neededBytes > UINT16_MAX)
+    {
+        return false;
+    }
+
+    FrameSampleHeader sampleHeader;
+    sampleHeader.m_serviceHash = f_serviceHash;
+    sampleHeader.m_payloadSize = f_payloadSize;
+    sampleHeader.m_sequenceNumber = f_sequenceNumber;
+
+    uint8_t* writePosition = m_buffer + m_header->m_frameBytes;
+    std::memcpy(writePosition, &sampleHeader, sizeof(FrameSampleHeader));
+    cxx::copyPayload(writePosition + sizeof(FrameSampleHeader), f_payload, f_payloadSize);
+
+    m_header->m_frameBytes = static_cast<uint16_t>(m_header->m_frameBytes + neededBytes);
+    ++m_header->m_sampleCount;
+    return true;
+}
+
+uint32_t FrameBuilder::sampleCount() const noexcept
+{
+    return m_header->m_sampleCount;
+}
+
+uint32_t FrameBuilder::frameBytes() const noexcept
+{
+    return m_header->m_frameBytes;
+}
+
+FrameParser::FrameParser(const uint8_t* const f_buffer, const uint32_t f_size) noexcept
+    : m_buffer(f_buffer)
+    , m_size(f_size)
+{
+    if (f_size < sizeof(FrameHeader))
+    {
+        return;
+    }
+
+    FrameHeader header;
+    std::memcpy(&header, f_buffer, sizeof(FrameHeader));
+    if (header.m_magic != FrameHeader::MAGIC || header.m_frameBytes > f_size)
+    {
+        return;
+    }
+
+    m_size = header.m_frameBytes;
+    m_remainingSamples = header.m_sampleCount;
+    m_isValid = true;
+}
+
+bool FrameParser::isValid() const noexcept
+{
+    return m_isValid;
+}
+
+bool FrameParser::nextSample(FrameSampleHeader& f_sampleHeader, const uint8_t*& f_payload) noexcept
+{
+    if (m_remainingSamples == 0u || m_readOffset + sizeof(FrameSampleHeader) > m_size)
+    {
+        return false;
+    }
+
+    std::memcpy(&f_sampleHeader, m_buffer + m_readOffset, sizeof(FrameSampleHeader));
+    if (m_readOffset + sizeof(FrameSampleHeader) + f_sampleHeader.m_payloadSize > m_size)
+    {
+        // truncated frame, do not hand out a payload beyond the buffer
+        m_remainingSamples = 0u;
+        return false;
+    }
+
+    f_payload = m_buffer + m_readOffset + sizeof(FrameSampleHeader);
+    m_readOffset += static_cast<uint32_t>(sizeof(FrameSampleHeader)) + f_sampleHeader.m_payloadSize;
+    --m_remainingSamples;
+    return true;
+}
+
+} // namespace gateway
+} // namespace iox
@@ -0,0 +1,189 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/gateway/udp_frame_transport.hpp"
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace iox
+{
+namespace gateway
+{
+constexpr uint32_t UdpFrameTransport::MAX_BATCH_SIZE;
+
+UdpFrameTransport::UdpFrameTransport(const uint16_t f_localPort,
+                                     const std::string& f_remoteAddress,
+                                     const uint16_t f_remotePort) noexcept
+    : m_remotePort(f_remotePort)
+{
+    if (::inet_pton(AF_INET, f_remoteAddress.c_str(), &m_remoteAddress) != 1)
+    {
+        return;
+    }
+
+    m_socket = ::socket(AF_INET, SOCK_DGRAM, 0);
+    if (m_socket < 0)
+    {
+        return;
+    }
+
+    struct sockaddr_in localAddress;
+    std::memset(&localAddress, 0, sizeof(localAddress));
+    localAddress.sin_family = AF_INET;
+    localAddress.sin_addr.s_addr = htonl(INADDR_ANY);
+    localAddress.sin_port = htons(f_localPort);
+    if (::bind(m_socket, reinterpret_cast<struct sockaddr*>(&localAddress), sizeof(localAddress)) != 0)
+    {
+        ::close(m_socket);
+        m_socket = -1;
+        return;
+    }
+
+    struct sockaddr_in boundAddress;
+    socklen_t boundAddressLength = sizeof(boundAddress);
+    if (::getsockname(m_socket, reinterpret_cast<struct sockaddr*>(&boundAddress), &boundAddressLength) == 0)
+    {
+        m_localPort = ntohs(boundAddress.sin_port);
+    }
+
+    int flags = ::fcntl(m_socket, F_GETFL, 0);
+    ::fcntl(m_socket, F_SETFL, flags | O_NONBLOCK);
+}
+
+UdpFrameTransport::~UdpFrameTransport() noexcept
+{
+    if (m_socket >= 0)
+    {
+        ::close(m_socket);
+    }
+}
+
+bool UdpFrameTransport::isInitialized() const noexcept
+{
+    return m_socket >= 0;
+}
+
+uint16_t UdpFrameTransport::localPort() const noexcept
+{
+    return m_localPort;
+}
+
+uint32_t UdpFrameTransport::sendFrames(const uint8_t* const* f_frames,
+                                       const uint32_t* f_frameSizes,
+                                       const uint32_t f_frameCount) noexcept
+{
+    if (!isInitialized() || f_frameCount == 0u || f_frameCount > MAX_BATCH_SIZE)
+    {
+        return 0u;
+    }
+
+    struct sockaddr_in remoteAddress;
+    std::memset(&remoteAddress, 0, sizeof(remoteAddress));
+    remoteAddress.sin_family = AF_INET;
+    remoteAddress.sin_addr.s_addr = m_remoteAddress;
+    remoteAddress.sin_port = htons(m_remotePort);
+
+#if defined(QNX) || defined(QNX__) || defined(__QNX__)
+    // QNX has no sendmmsg, fall back to one syscall per frame
+    uint32_t sentCount{0u};
+    for (uint32_t i = 0u; i < f_frameCount; ++i)
+    {
+        if (::sendto(m_socket,
+                     f_frames[i],
+                     f_frameSizes[i],
+                     0,
+                     reinterpret_cast<struct sockaddr*>(&remoteAddress),
+                     sizeof(remoteAddress))
+            < 0)
+        {
+            break;
+        }
+        ++sentCount;
+    }
+    return sentCount;
+#else
+    struct iovec iov[MAX_BATCH_SIZE];
+    struct mmsghdr messages[MAX_BATCH_SIZE];
+    std::memset(messages, 0, sizeof(messages));
+    for (uint32_t i = 0u; i < f_frameCount; ++i)
+    {
+        iov[i].iov_base = const_cast<uint8_t*>(f_frames[i]);
+        iov[i].iov_len = f_frameSizes[i];
+        messages[i].msg_hdr.msg_iov = &iov[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+        messages[i].msg_hdr.msg_name = &remoteAddress;
+        messages[i].msg_hdr.msg_namelen = sizeof(remoteAddress);
+    }
+
+    const int sentCount = ::sendmmsg(m_socket, messages, f_frameCount, 0);
+    return (sentCount < 0) ? 0u : static_cast<uint32_t>(sentCount);
+#endif
+}
+
+uint32_t UdpFrameTransport::receiveFrames(uint8_t* const* f_frames,
+                                          const uint32_t* f_frameCapacities,
+                                          uint32_t* f_frameSizes,
+                                          const uint32_t f_frameCount) noexcept
+{
+    if (!isInitialized() || f_frameCount == 0u || f_frameCount > MAX_BATCH_SIZE)
+    {
+        return 0u;
+    }
+
+#if defined(QNX) || defined(QNX__) || defined(__QNX__)
+    // QNX has no recvmmsg, fall back to one syscall per frame
+    uint32_t receivedCount{0u};
+    for (uint32_t i = 0u; i < f_frameCount; ++i)
+    {
+        const ssize_t receivedBytes = ::recvfrom(m_socket, f_frames[i], f_frameCapacities[i], 0, nullptr, nullptr);
+        if (receivedBytes < 0)
+        {
+            break;
+        }
+        f_frameSizes[i] = static_cast<uint32_t>(receivedBytes);
+        ++receivedCount;
+    }
+    return receivedCount;
+#else
+    struct iovec iov[MAX_BATCH_SIZE];
+    struct mmsghdr messages[MAX_BATCH_SIZE];
+    std::memset(messages, 0, sizeof(messages));
+    for (uint32_t i = 0u; i < f_frameCount; ++i)
+    {
+        iov[i].iov_base = f_frames[i];
+        iov[i].iov_len = f_frameCapacities[i];
+        messages[i].msg_hdr.msg_iov = &iov[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    const int receivedCount = ::recvmmsg(m_socket, messages, f_frameCount, 0, nullptr);
+    if (receivedCount < 0)
+    {
+        return 0u;
+    }
+    for (int i = 0; i < receivedCount; ++i)
+    {
+        f_frameSizes[i] = messages[i].msg_len;
+    }
+    return static_cast<uint32_t>(receivedCount);
+#endif
+}
+
+} // namespace gateway
+} // namespace iox
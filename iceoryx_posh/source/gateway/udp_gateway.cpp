@@ -0,0 +1,190 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/gateway/udp_gateway.hpp"
+
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_utils/cxx/payload_copy.hpp"
+
+namespace iox
+{
+namespace gateway
+{
+UdpGateway::UdpGateway(const Interfaces f_interface,
+                       const uint16_t f_localPort,
+                       const std::string& f_remoteAddress,
+                       const uint16_t f_remotePort) noexcept
+    : popo::GatewayGeneric(f_interface)
+    , m_transport(f_localPort, f_remoteAddress, f_remotePort)
+{
+}
+
+UdpGateway::UdpGateway(const uint16_t f_localPort,
+                       const std::string& f_remoteAddress,
+                       const uint16_t f_remotePort) noexcept
+    : m_transport(f_localPort, f_remoteAddress, f_remotePort)
+{
+}
+
+bool UdpGateway::isInitialized() const noexcept
+{
+    return m_transport.isInitialized();
+}
+
+uint16_t UdpGateway::localPort() const noexcept
+{
+    return m_transport.localPort();
+}
+
+uint32_t UdpGateway::forwardOutbound(popo::ReceiverPort& f_source,
+                                     const uint64_t f_serviceHash,
+                                     const uint32_t f_maxSamples) noexcept
+{
+    uint8_t frameStorage[UdpFrameTransport::MAX_BATCH_SIZE][FRAME_CAPACITY];
+    const uint8_t* framePointers[UdpFrameTransport::MAX_BATCH_SIZE];
+    uint32_t frameSizes[UdpFrameTransport::MAX_BATCH_SIZE];
+
+    uint32_t frameCount{0u};
+    uint32_t forwardedCount{0u};
+    FrameBuilder builder(frameStorage[0], FRAME_CAPACITY);
+
+    auto flushBatch = [&]() {
+        if (builder.sampleCount() > 0u)
+        {
+            framePointers[frameCount] = frameStorage[frameCount];
+            frameSizes[frameCount] = builder.frameBytes();
+            ++frameCount;
+        }
+        if (frameCount > 0u)
+        {
+            m_transport.sendFrames(framePointers, frameSizes, frameCount);
+            frameCount = 0u;
+        }
+        builder = FrameBuilder(frameStorage[0], FRAME_CAPACITY);
+    };
+
+    mepoo::SharedChunk chunk;
+    while (forwardedCount < f_maxSamples && f_source.getSharedChunk(chunk))
+    {
+        auto chunkHeader = chunk.getChunkHeader();
+        const uint32_t payloadSize = chunkHeader->m_info.m_payloadSize;
+        const uint32_t sequenceNumber = chunkHeader->m_info.m_sequenceNumber;
+
+        if (!builder.addSample(f_serviceHash, sequenceNumber, chunkHeader->payload(), payloadSize))
+        {
+            if (builder.sampleCount() == 0u)
+            {
+                // larger than one frame, cannot be transported
+                ++m_droppedSampleCount;
+                continue;
+            }
+
+            // frame is full, seal it and pack the sample into the next one
+            framePointers[frameCount] = frameStorage[frameCount];
+            frameSizes[frameCount] = builder.frameBytes();
+            ++frameCount;
+            if (frameCount == UdpFrameTransport::MAX_BATCH_SIZE)
+            {
+                m_transport.sendFrames(framePointers, frameSizes, frameCount);
+                frameCount = 0u;
+            }
+            builder = FrameBuilder(frameStorage[frameCount], FRAME_CAPACITY);
+            if (!builder.addSample(f_serviceHash, sequenceNumber, chunkHeader->payload(), payloadSize))
+            {
+                ++m_droppedSampleCount;
+                continue;
+            }
+        }
+        ++forwardedCount;
+    }
+
+    flushBatch();
+    return forwardedCount;
+}
+
+uint32_t UdpGateway::forwardInbound(const PortLookup& f_portLookup) noexcept
+{
+    uint8_t frameStorage[UdpFrameTransport::MAX_BATCH_SIZE][FRAME_CAPACITY];
+    uint8_t* framePointers[UdpFrameTransport::MAX_BATCH_SIZE];
+    uint32_t frameCapacities[UdpFrameTransport::MAX_BATCH_SIZE];
+    uint32_t frameSizes[UdpFrameTransport::MAX_BATCH_SIZE];
+    for (uint32_t i = 0u; i < UdpFrameTransport::MAX_BATCH_SIZE; ++i)
+    {
+        framePointers[i] = frameStorage[i];
+        frameCapacities[i] = FRAME_CAPACITY;
+    }
+
+    const uint32_t receivedFrameCount =
+        m_transport.receiveFrames(framePointers, frameCapacities, frameSizes, UdpFrameTransport::MAX_BATCH_SIZE);
+
+    uint32_t deliveredCount{0u};
+    for (uint32_t i = 0u; i < receivedFrameCount; ++i)
+    {
+        const uint32_t frameDeliveredCount = unpackFrame(frameStorage[i], frameSizes[i], f_portLookup);
+        deliveredCount += frameDeliveredCount;
+
+        if (frameSizes[i] >= sizeof(FrameHeader))
+        {
+            FrameHeader header;
+            std::memcpy(&header, frameStorage[i], sizeof(FrameHeader));
+            m_droppedSampleCount += header.m_sampleCount - frameDeliveredCount;
+        }
+    }
+    return deliveredCount;
+}
+
+uint64_t UdpGateway::droppedSampleCount() const noexcept
+{
+    return m_droppedSampleCount;
+}
+
+uint32_t UdpGateway::unpackFrame(const uint8_t* const f_frame,
+                                 const uint32_t f_frameSize,
+                                 const PortLookup& f_portLookup) noexcept
+{
+    FrameParser parser(f_frame, f_frameSize);
+    if (!parser.isValid())
+    {
+        return 0u;
+    }
+
+    uint32_t deliveredCount{0u};
+    FrameSampleHeader sampleHeader;
+    const uint8_t* payload{nullptr};
+    while (parser.nextSample(sampleHeader, payload))
+    {
+        popo::SenderPort* sender = f_portLookup(sampleHeader.m_serviceHash);
+        if (sender == nullptr)
+        {
+            continue;
+        }
+
+        auto chunkHeader = sender->reserveChunk(sampleHeader.m_payloadSize);
+        if (chunkHeader == nullptr)
+        {
+            continue;
+        }
+        cxx::copyPayload(chunkHeader->payload(), payload, sampleHeader.m_payloadSize);
+        chunkHeader->m_info.m_payloadSize = sampleHeader.m_payloadSize;
+        chunkHeader->m_info.m_externalSequenceNumber_bl = true;
+        chunkHeader->m_info.m_sequenceNumber = sampleHeader.m_sequenceNumber;
+        sender->deliverChunk(chunkHeader);
+        ++deliveredCount;
+    }
+    return deliveredCount;
+}
+
+} // namespace gateway
+} // namespace iox
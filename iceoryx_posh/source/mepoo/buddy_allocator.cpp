@@ -0,0 +1,232 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/mepoo/buddy_allocator.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace mepoo
+{
+namespace
+{
+uint32_t floorLog2(uint32_t value)
+{
+    uint32_t result{0u};
+    while (value >>= 1u)
+    {
+        ++result;
+    }
+    return result;
+}
+
+uint32_t ceilLog2(const uint32_t value)
+{
+    uint32_t result = floorLog2(value);
+    if ((1u << result) < value)
+    {
+        ++result;
+    }
+    return result;
+}
+
+/// largest order an aligned block starting at f_index may have
+uint32_t alignmentOrder(const uint32_t f_index, const uint32_t f_maxOrder)
+{
+    if (f_index == 0u)
+    {
+        return f_maxOrder;
+    }
+
+    uint32_t order{0u};
+    while (order < f_maxOrder && (f_index & (1u << order)) == 0u)
+    {
+        ++order;
+    }
+    return order;
+}
+} // namespace
+
+constexpr uint32_t BuddyAllocator::MAX_ORDER_COUNT;
+constexpr uint8_t BuddyAllocator::INTERIOR_BLOCK;
+
+void BuddyAllocator::init(cxx::not_null<void*> f_memory, const uint32_t f_numberOfMinBlocks)
+{
+    cxx::Expects(m_accessMutex.has_value());
+    cxx::Expects(f_numberOfMinBlocks > 0);
+    cxx::Expects(f_numberOfMinBlocks <= (1u << (MAX_ORDER_COUNT - 1u)));
+
+    m_numberOfMinBlocks = f_numberOfMinBlocks;
+    m_invalidIndex = m_numberOfMinBlocks;
+    m_orderCount = static_cast<uint8_t>(floorLog2(m_numberOfMinBlocks) + 1u);
+    m_blocks = static_cast<Block*>(static_cast<void*>(f_memory));
+
+    for (auto& head : m_freeListHeads)
+    {
+        head = m_invalidIndex;
+    }
+
+    for (uint32_t i = 0u; i < m_numberOfMinBlocks; ++i)
+    {
+        new (&m_blocks[i]) Block();
+    }
+
+    // seed the free-lists with the largest aligned blocks that fit, this also covers
+    // total sizes which are not a power of two
+    uint32_t index{0u};
+    while (index < m_numberOfMinBlocks)
+    {
+        uint32_t order =
+            std::min(alignmentOrder(index, m_orderCount - 1u), floorLog2(m_numberOfMinBlocks - index));
+        insert(index, static_cast<uint8_t>(order));
+        index += (1u << order);
+    }
+}
+
+void BuddyAllocator::insert(const uint32_t f_index, const uint8_t f_order)
+{
+    Block& block = m_blocks[f_index];
+    block.m_order = f_order;
+    block.m_free = true;
+    block.m_prev = m_invalidIndex;
+    block.m_next = m_freeListHeads[f_order];
+
+    if (block.m_next != m_invalidIndex)
+    {
+        m_blocks[block.m_next].m_prev = f_index;
+    }
+    m_freeListHeads[f_order] = f_index;
+}
+
+void BuddyAllocator::remove(const uint32_t f_index, const uint8_t f_order)
+{
+    Block& block = m_blocks[f_index];
+
+    if (block.m_prev != m_invalidIndex)
+    {
+        m_blocks[block.m_prev].m_next = block.m_next;
+    }
+    else
+    {
+        m_freeListHeads[f_order] = block.m_next;
+    }
+
+    if (block.m_next != m_invalidIndex)
+    {
+        m_blocks[block.m_next].m_prev = block.m_prev;
+    }
+
+    block.m_free = false;
+}
+
+uint32_t BuddyAllocator::pop(const uint32_t f_numberOfMinBlocks, uint32_t& f_index)
+{
+    if (m_numberOfMinBlocks == 0u || f_numberOfMinBlocks == 0u)
+    {
+        return 0u;
+    }
+
+    uint32_t order = ceilLog2(f_numberOfMinBlocks);
+    if (order >= m_orderCount)
+    {
+        return 0u;
+    }
+
+    std::lock_guard<posix::mutex> lock(*m_accessMutex);
+
+    uint32_t splitOrder = order;
+    while (splitOrder < m_orderCount && m_freeListHeads[splitOrder] == m_invalidIndex)
+    {
+        ++splitOrder;
+    }
+
+    if (splitOrder >= m_orderCount)
+    {
+        return 0u;
+    }
+
+    uint32_t index = m_freeListHeads[splitOrder];
+    remove(index, static_cast<uint8_t>(splitOrder));
+
+    // split the block down to the requested order, the upper half becomes a free buddy
+    while (splitOrder > order)
+    {
+        --splitOrder;
+        insert(index + (1u << splitOrder), static_cast<uint8_t>(splitOrder));
+    }
+
+    m_blocks[index].m_order = static_cast<uint8_t>(order);
+    m_blocks[index].m_free = false;
+
+    // invalidate the metadata of the interior blocks so that freeing an interior
+    // index is detected in push()
+    for (uint32_t i = index + 1u; i < index + (1u << order); ++i)
+    {
+        m_blocks[i].m_order = INTERIOR_BLOCK;
+        m_blocks[i].m_free = false;
+    }
+
+    f_index = index;
+    return (1u << order);
+}
+
+uint32_t BuddyAllocator::push(const uint32_t f_index)
+{
+    if (f_index >= m_numberOfMinBlocks)
+    {
+        return 0u;
+    }
+
+    std::lock_guard<posix::mutex> lock(*m_accessMutex);
+
+    Block& block = m_blocks[f_index];
+    if (block.m_free || block.m_order >= m_orderCount || (f_index & ((1u << block.m_order) - 1u)) != 0u)
+    {
+        return 0u;
+    }
+
+    uint32_t freedMinBlocks = (1u << block.m_order);
+
+    // merge with the buddy as long as it is free and of the same size
+    uint32_t index = f_index;
+    uint32_t order = block.m_order;
+    while (order + 1u < m_orderCount)
+    {
+        uint32_t buddyIndex = index ^ (1u << order);
+        if (buddyIndex + (1u << order) > m_numberOfMinBlocks)
+        {
+            break;
+        }
+
+        const Block& buddy = m_blocks[buddyIndex];
+        if (!buddy.m_free || buddy.m_order != order)
+        {
+            break;
+        }
+
+        remove(buddyIndex, static_cast<uint8_t>(order));
+        // the upper half start becomes an interior block of the merged block
+        m_blocks[std::max(index, buddyIndex)].m_order = INTERIOR_BLOCK;
+        index = std::min(index, buddyIndex);
+        ++order;
+    }
+
+    insert(index, static_cast<uint8_t>(order));
+
+    return freedMinBlocks;
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 
 namespace iox
@@ -23,6 +24,48 @@ ChunkHeader::ChunkHeader() noexcept
 {
 }
 
+#ifndef IOX_COMPACT_CHUNK_HEADER
+constexpr std::uint32_t ChunkHeader::INTEGRITY_CRC_PRESENT;
+
+bool ChunkHeader::hasNextChunk() const
+{
+    return m_nextChunkOffset != RelativePointer::NULL_POINTER_OFFSET;
+}
+
+ChunkHeader* ChunkHeader::nextChunk() const
+{
+    if (!hasNextChunk())
+    {
+        return nullptr;
+    }
+    auto chunkManagement = iox::relative_ptr<ChunkManagement>(m_nextChunkOffset, m_nextChunkSegmentId);
+    return chunkManagement->m_chunkHeader;
+}
+#endif
+
+void ChunkHeader::setCorrelationId(const std::uint64_t f_correlationId)
+{
+#ifndef IOX_COMPACT_CHUNK_HEADER
+    m_correlationId = f_correlationId;
+#else
+    m_info.m_sequenceNumber = static_cast<SequenceNumberType>(f_correlationId);
+#endif
+}
+
+std::uint64_t ChunkHeader::correlationId() const
+{
+#ifndef IOX_COMPACT_CHUNK_HEADER
+    return m_correlationId;
+#else
+    return m_info.m_sequenceNumber;
+#endif
+}
+
+SequenceNumberType ChunkHeader::sequenceNumber() const
+{
+    return m_info.m_sequenceNumber;
+}
+
 ChunkHeader* convertPayloadPointerToChunkHeader(void* const payload) noexcept
 {
     return reinterpret_cast<ChunkHeader*>(reinterpret_cast<uintptr_t>(payload) - sizeof(ChunkHeader));
@@ -14,8 +14,13 @@
 
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_utils/cxx/helplets.hpp"
+#include "iceoryx_utils/cxx/smart_c.hpp"
 #include "iceoryx_utils/error_handling/error_handling.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/system_configuration.hpp"
+
+#include <sys/mman.h>
 
 #include <algorithm>
 
@@ -26,18 +31,20 @@ namespace mepoo
 MemPool::MemPool(const cxx::greater_or_equal<uint32_t, MEMORY_ALIGNMENT> f_chunkSize,
                  const cxx::greater_or_equal<uint32_t, 1> f_numberOfChunks,
                  posix::Allocator* f_managementAllocator,
-                 posix::Allocator* f_payloadAllocator)
+                 posix::Allocator* f_payloadAllocator,
+                 const uint32_t f_maxNumberOfChunks)
     : m_chunkSize(f_chunkSize)
     , m_numberOfChunks(f_numberOfChunks)
+    , m_maxNumberOfChunks(std::max(static_cast<uint32_t>(f_numberOfChunks), f_maxNumberOfChunks))
     , m_minFree(f_numberOfChunks)
 {
     if (isMultipleOf32(f_chunkSize))
     {
-        m_rawMemory =
-            static_cast<uint8_t*>(f_payloadAllocator->allocate(static_cast<uint64_t>(m_numberOfChunks) * m_chunkSize));
-        auto memoryLoFFLi =
-            static_cast<uint32_t*>(f_managementAllocator->allocate(freeList_t::requiredMemorySize(m_numberOfChunks)));
-        m_freeIndices.init(memoryLoFFLi, m_numberOfChunks);
+        m_rawMemory = static_cast<uint8_t*>(
+            f_payloadAllocator->allocate(static_cast<uint64_t>(m_maxNumberOfChunks) * m_chunkSize));
+        auto memoryLoFFLi = static_cast<uint32_t*>(
+            f_managementAllocator->allocate(freeList_t::requiredMemorySize(m_maxNumberOfChunks)));
+        m_freeIndices.init(memoryLoFFLi, m_numberOfChunks, m_maxNumberOfChunks);
     }
     else
     {
@@ -46,6 +53,34 @@ MemPool::MemPool(const cxx::greater_or_equal<uint32_t, MEMORY_ALIGNMENT> f_chunk
     }
 }
 
+constexpr MemPool::BuddyPool_t MemPool::BuddyPool;
+
+MemPool::MemPool(const BuddyPool_t,
+                 const cxx::greater_or_equal<uint32_t, MEMORY_ALIGNMENT> f_minBlockSize,
+                 const cxx::greater_or_equal<uint32_t, 1> f_numberOfMinBlocks,
+                 posix::Allocator* f_managementAllocator,
+                 posix::Allocator* f_payloadAllocator)
+    : m_chunkSize(f_minBlockSize)
+    , m_numberOfChunks(f_numberOfMinBlocks)
+    , m_maxNumberOfChunks(f_numberOfMinBlocks)
+    , m_minFree(f_numberOfMinBlocks)
+    , m_isBuddyPool(true)
+{
+    if (isMultipleOf32(f_minBlockSize))
+    {
+        m_rawMemory = static_cast<uint8_t*>(
+            f_payloadAllocator->allocate(static_cast<uint64_t>(m_numberOfChunks) * m_chunkSize));
+        auto memoryBuddy =
+            f_managementAllocator->allocate(BuddyAllocator::requiredMemorySize(m_numberOfChunks));
+        m_buddyAllocator.init(memoryBuddy, m_numberOfChunks);
+    }
+    else
+    {
+        std::cerr << f_minBlockSize << " :: " << f_numberOfMinBlocks << std::endl;
+        errorHandler(Error::kMEPOO__MEMPOOL_CHUNKSIZE_MUST_BE_LARGER_32_AND_MULTIPLE_OF_32);
+    }
+}
+
 bool MemPool::isMultipleOf32(const uint32_t value) const
 {
     return (value % 32 == 0);
@@ -58,11 +93,128 @@ void MemPool::adjustMinFree()
                              m_minFree.load(std::memory_order_relaxed)));
 }
 
+MemPool::ThreadCacheRegistry::~ThreadCacheRegistry()
+{
+    // return all parked chunks to their pools when the thread terminates
+    for (auto& entry : m_entries)
+    {
+        if (entry.m_pool != nullptr)
+        {
+            entry.m_pool->flushThreadCache(entry.m_cache, 0u);
+        }
+    }
+}
+
+MemPool::ThreadCacheRegistry& MemPool::threadCacheRegistry()
+{
+    thread_local ThreadCacheRegistry registry;
+    return registry;
+}
+
+MemPool::~MemPool()
+{
+    // invalidate this thread's magazine so that a pool created later at the same address
+    // does not pick up stale indices; in deployment mempools are never destroyed
+    for (auto& entry : threadCacheRegistry().m_entries)
+    {
+        if (entry.m_pool == this)
+        {
+            entry.m_pool = nullptr;
+            entry.m_cache.m_size = 0u;
+        }
+    }
+}
+
+MemPool::ThreadCache* MemPool::getThreadCache()
+{
+    ThreadCacheRegistry::Entry* freeEntry{nullptr};
+    for (auto& entry : threadCacheRegistry().m_entries)
+    {
+        if (entry.m_pool == this)
+        {
+            return &entry.m_cache;
+        }
+        if (entry.m_pool == nullptr && freeEntry == nullptr)
+        {
+            freeEntry = &entry;
+        }
+    }
+
+    if (freeEntry != nullptr)
+    {
+        freeEntry->m_pool = this;
+        return &freeEntry->m_cache;
+    }
+
+    // registry exhausted, the caller falls back to the shared free-list
+    return nullptr;
+}
+
+bool MemPool::refillThreadCache(ThreadCache& f_cache)
+{
+    uint32_t popped = m_freeIndices.popBatch(&f_cache.m_indices[f_cache.m_size], ThreadCache::REFILL_BATCH);
+    f_cache.m_size += popped;
+
+    if (popped > 0u)
+    {
+        m_usedChunks.fetch_add(popped, std::memory_order_relaxed);
+        adjustMinFree();
+    }
+
+    return popped > 0u;
+}
+
+void MemPool::flushThreadCache(ThreadCache& f_cache, const uint32_t f_targetSize)
+{
+    if (f_cache.m_size <= f_targetSize)
+    {
+        return;
+    }
+
+    uint32_t flushed = f_cache.m_size - f_targetSize;
+    if (!m_freeIndices.pushBatch(&f_cache.m_indices[f_targetSize], flushed))
+    {
+        errorHandler(Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+    f_cache.m_size = f_targetSize;
+
+    if (flushed > 0u)
+    {
+        m_usedChunks.fetch_sub(flushed, std::memory_order_relaxed);
+    }
+}
+
+void MemPool::enableThreadLocalCache(const bool f_enable)
+{
+    m_threadCacheEnabled.store(f_enable, std::memory_order_relaxed);
+}
+
 void* MemPool::getChunk()
 {
+    if (m_isBuddyPool)
+    {
+        return getChunk(m_chunkSize);
+    }
+
+    ThreadCache* cache =
+        m_threadCacheEnabled.load(std::memory_order_relaxed) ? getThreadCache() : nullptr;
+    if (cache != nullptr)
+    {
+        if (cache->m_size == 0u && !refillThreadCache(*cache))
+        {
+            m_failedAllocations.fetch_add(1u, std::memory_order_relaxed);
+            std::cerr << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
+                      << ", used_chunks = " << m_usedChunks << " ] has no more space left" << std::endl;
+            return nullptr;
+        }
+
+        return m_rawMemory + cache->m_indices[--cache->m_size] * m_chunkSize;
+    }
+
     uint32_t l_index{0};
     if (!m_freeIndices.pop(l_index))
     {
+        m_failedAllocations.fetch_add(1u, std::memory_order_relaxed);
         std::cerr << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
                   << ", used_chunks = " << m_usedChunks << " ] has no more space left" << std::endl;
         return nullptr;
@@ -76,6 +228,33 @@ void* MemPool::getChunk()
     return m_rawMemory + l_index * m_chunkSize;
 }
 
+void* MemPool::getChunk(const uint32_t f_size)
+{
+    cxx::Expects(m_isBuddyPool);
+
+    uint32_t neededMinBlocks = (f_size + m_chunkSize - 1u) / m_chunkSize;
+
+    uint32_t l_index{0};
+    uint32_t allocatedMinBlocks = m_buddyAllocator.pop(neededMinBlocks, l_index);
+    if (allocatedMinBlocks == 0u)
+    {
+        m_failedAllocations.fetch_add(1u, std::memory_order_relaxed);
+        std::cerr << "Buddy mempool [minBlockSize = " << m_chunkSize << ", numberOfMinBlocks = " << m_numberOfChunks
+                  << ", usedMinBlocks = " << m_usedChunks << " ] cannot serve a chunk of size " << f_size << std::endl;
+        return nullptr;
+    }
+
+    m_usedChunks.fetch_add(allocatedMinBlocks, std::memory_order_relaxed);
+    adjustMinFree();
+
+    return m_rawMemory + static_cast<uint64_t>(l_index) * m_chunkSize;
+}
+
+bool MemPool::isBuddyPool() const
+{
+    return m_isBuddyPool;
+}
+
 void MemPool::freeChunk(const void* chunk)
 {
     cxx::Expects(m_rawMemory <= chunk
@@ -86,6 +265,29 @@ void MemPool::freeChunk(const void* chunk)
 
     uint32_t index = static_cast<uint32_t>(offset / m_chunkSize);
 
+    if (m_isBuddyPool)
+    {
+        uint32_t freedMinBlocks = m_buddyAllocator.push(index);
+        if (freedMinBlocks == 0u)
+        {
+            errorHandler(Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+        }
+        m_usedChunks.fetch_sub(freedMinBlocks, std::memory_order_relaxed);
+        return;
+    }
+
+    ThreadCache* cache =
+        m_threadCacheEnabled.load(std::memory_order_relaxed) ? getThreadCache() : nullptr;
+    if (cache != nullptr)
+    {
+        if (cache->m_size == ThreadCache::CAPACITY)
+        {
+            flushThreadCache(*cache, ThreadCache::CAPACITY / 2u);
+        }
+        cache->m_indices[cache->m_size++] = index;
+        return;
+    }
+
     if (!m_freeIndices.push(index))
     {
         errorHandler(Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
@@ -94,6 +296,125 @@ void MemPool::freeChunk(const void* chunk)
     m_usedChunks.fetch_sub(1, std::memory_order_relaxed);
 }
 
+bool MemPool::addChunks(const uint32_t f_numberOfChunks)
+{
+    if (f_numberOfChunks == 0u || m_numberOfChunks + f_numberOfChunks > m_maxNumberOfChunks)
+    {
+        return false;
+    }
+
+    uint32_t firstNewIndex = m_numberOfChunks;
+
+    // the new chunk count has to be visible before the new indices can be popped,
+    // otherwise the range check in freeChunk would reject them
+    m_numberOfChunks += f_numberOfChunks;
+
+    for (uint32_t i = 0u; i < f_numberOfChunks; ++i)
+    {
+        if (!m_freeIndices.push(firstNewIndex + i))
+        {
+            errorHandler(Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+        }
+    }
+
+    return true;
+}
+
+uint32_t MemPool::getMaxChunkCount() const
+{
+    return m_maxNumberOfChunks;
+}
+
+void MemPool::setHighWatermarkPercent(const uint32_t f_percent)
+{
+    m_highWatermarkPercent = f_percent;
+}
+
+uint32_t MemPool::getHighWatermark() const
+{
+    // the percentage is applied to the current chunk count, so growing the pool via
+    // addChunks() raises the watermark accordingly
+    return static_cast<uint32_t>(static_cast<uint64_t>(m_numberOfChunks) * m_highWatermarkPercent / 100u);
+}
+
+void MemPool::applyMemoryHints(const uint32_t f_hints)
+{
+    if (f_hints == 0u)
+    {
+        return;
+    }
+
+    uint8_t* l_poolStart = m_rawMemory;
+    const uint64_t l_poolSize = static_cast<uint64_t>(m_maxNumberOfChunks) * m_chunkSize;
+
+    if ((f_hints & MePooConfig::HINT_LOCKED) != 0u)
+    {
+        // mlock rounds to page boundaries internally, so the exact pool range can be passed
+        auto mlockCall = cxx::makeSmartC(
+            mlock, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, static_cast<void*>(l_poolStart), l_poolSize);
+        if (mlockCall.hasErrors())
+        {
+            std::cerr << "Unable to lock mempool memory into RAM : " << mlockCall.getErrorString() << std::endl;
+        }
+    }
+
+    // madvise requires a page aligned start address; the pools are only 32 byte aligned
+    // within the segment, so the advices are applied to the pages fully covered by the pool
+    const uint64_t l_pageSize = posix::pageSize().value_or(posix::MaxPageSize);
+    const uint64_t l_adviceBegin = cxx::align(reinterpret_cast<uint64_t>(l_poolStart), l_pageSize);
+    const uint64_t l_adviceEnd = (reinterpret_cast<uint64_t>(l_poolStart) + l_poolSize) & ~(l_pageSize - 1u);
+
+    if (l_adviceBegin >= l_adviceEnd)
+    {
+        // the pool does not fully cover a single page, nothing to advise on
+        return;
+    }
+
+    auto advise = [&](const int f_advice, const char* f_adviceName) {
+        auto madviseCall = cxx::makeSmartC(madvise,
+                                           cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
+                                           {-1},
+                                           {},
+                                           reinterpret_cast<void*>(l_adviceBegin),
+                                           l_adviceEnd - l_adviceBegin,
+                                           f_advice);
+        if (madviseCall.hasErrors())
+        {
+            std::cerr << "Unable to apply " << f_adviceName
+                      << " to mempool memory : " << madviseCall.getErrorString() << std::endl;
+        }
+    };
+
+    if ((f_hints & MePooConfig::HINT_HUGE_PAGES) != 0u)
+    {
+#if defined(MADV_HUGEPAGE)
+        advise(MADV_HUGEPAGE, "MADV_HUGEPAGE");
+#else
+        std::cerr << "Huge pages were requested for a mempool but are not supported on this platform" << std::endl;
+#endif
+    }
+
+    if ((f_hints & MePooConfig::HINT_SEQUENTIAL) != 0u)
+    {
+#if defined(MADV_SEQUENTIAL)
+        advise(MADV_SEQUENTIAL, "MADV_SEQUENTIAL");
+#else
+        std::cerr << "Sequential access was requested for a mempool but is not supported on this platform"
+                  << std::endl;
+#endif
+    }
+
+    if ((f_hints & MePooConfig::HINT_DONT_DUMP) != 0u)
+    {
+#if defined(MADV_DONTDUMP)
+        advise(MADV_DONTDUMP, "MADV_DONTDUMP");
+#else
+        std::cerr << "Core dump exclusion was requested for a mempool but is not supported on this platform"
+                  << std::endl;
+#endif
+    }
+}
+
 uint32_t MemPool::getChunkSize() const
 {
     return m_chunkSize;
@@ -119,7 +440,11 @@ MemPoolInfo MemPool::getInfo() const
     return {m_usedChunks.load(std::memory_order_relaxed),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
-            m_chunkSize};
+            m_chunkSize,
+            m_failedAllocations.load(std::memory_order_relaxed),
+            m_freeIndices.getPopRetries(),
+            getHighWatermark(),
+            m_freeIndices.getPushRetries()};
 }
 
 } // namespace mepoo
@@ -21,11 +21,109 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <ostream>
 
 namespace iox
 {
 namespace mepoo
 {
+namespace
+{
+uint32_t floorLog2(uint32_t value)
+{
+    uint32_t result{0u};
+    if (value >> 16u)
+    {
+        value >>= 16u;
+        result += 16u;
+    }
+    if (value >> 8u)
+    {
+        value >>= 8u;
+        result += 8u;
+    }
+    if (value >> 4u)
+    {
+        value >>= 4u;
+        result += 4u;
+    }
+    if (value >> 2u)
+    {
+        value >>= 2u;
+        result += 2u;
+    }
+    if (value >> 1u)
+    {
+        result += 1u;
+    }
+    return result;
+}
+} // namespace
+
+constexpr uint32_t MemoryManager::AllocationTrace::SIZE_CLASSES;
+constexpr uint32_t MemoryManager::AllocationTrace::RESERVOIR_SIZE;
+
+void MemoryManager::enableAllocationTracing()
+{
+    m_allocationTracing.store(true, std::memory_order_relaxed);
+}
+
+const MemoryManager::AllocationTrace& MemoryManager::getAllocationTrace() const
+{
+    return m_allocationTrace;
+}
+
+void MemoryManager::recordAllocation(const uint32_t f_payloadSize)
+{
+    m_allocationTrace.m_requestsPerSizeClass[floorLog2(std::max(1u, f_payloadSize))].fetch_add(
+        1u, std::memory_order_relaxed);
+
+    // uniform reservoir sampling; the pseudo random slot comes from a cheap LCG
+    // since the sample is for statistics only
+    auto l_request = m_allocationTrace.m_totalRequests.fetch_add(1u, std::memory_order_relaxed);
+    if (l_request < AllocationTrace::RESERVOIR_SIZE)
+    {
+        m_allocationTrace.m_reservoir[l_request].store(f_payloadSize, std::memory_order_relaxed);
+    }
+    else
+    {
+        uint64_t l_random = (l_request * 6364136223846793005ull + 1442695040888963407ull) >> 33;
+        uint64_t l_slot = l_random % (l_request + 1u);
+        if (l_slot < AllocationTrace::RESERVOIR_SIZE)
+        {
+            m_allocationTrace.m_reservoir[l_slot].store(f_payloadSize, std::memory_order_relaxed);
+        }
+    }
+}
+
+void MemoryManager::dumpAllocationTrace(std::ostream& f_stream) const
+{
+    auto l_totalRequests = m_allocationTrace.m_totalRequests.load(std::memory_order_relaxed);
+    f_stream << "# iceoryx mempool allocation trace v1\n";
+    f_stream << "total_requests " << l_totalRequests << "\n";
+    for (uint32_t i = 0u; i < AllocationTrace::SIZE_CLASSES; ++i)
+    {
+        auto l_count = m_allocationTrace.m_requestsPerSizeClass[i].load(std::memory_order_relaxed);
+        if (l_count > 0u)
+        {
+            f_stream << "sizeclass " << i << " " << l_count << "\n";
+        }
+    }
+    auto l_samples =
+        std::min(l_totalRequests, static_cast<uint64_t>(AllocationTrace::RESERVOIR_SIZE));
+    for (uint64_t i = 0u; i < l_samples; ++i)
+    {
+        f_stream << "sample " << m_allocationTrace.m_reservoir[i].load(std::memory_order_relaxed) << "\n";
+    }
+    for (uint32_t i = 0u; i < getNumberOfMemPools(); ++i)
+    {
+        auto l_info = getMemPoolInfo(i);
+        f_stream << "pool " << i << " " << l_info.m_chunkSize << " " << l_info.m_numChunks << " "
+                 << l_info.m_usedChunks << " " << l_info.m_minFreeChunks << " " << l_info.m_highWatermark << " "
+                 << l_info.m_failedAllocations << "\n";
+    }
+}
+
 void MemoryManager::printMemPoolVector() const
 {
     for (auto& l_mempool : m_memPoolVector)
@@ -39,7 +137,8 @@ void MemoryManager::printMemPoolVector() const
 void MemoryManager::addMemPool(posix::Allocator* f_managementAllocator,
                                posix::Allocator* f_payloadAllocator,
                                const cxx::greater_or_equal<uint32_t, MemPool::MEMORY_ALIGNMENT> f_payloadSize,
-                               const cxx::greater_or_equal<uint32_t, 1> f_numberOfChunks)
+                               const cxx::greater_or_equal<uint32_t, 1> f_numberOfChunks,
+                               const uint32_t f_maxNumberOfChunks)
 {
     uint32_t adjustedChunkSize = sizeWithChunkHeaderStruct(static_cast<uint32_t>(f_payloadSize));
     if (m_denyAddMemPool)
@@ -61,15 +160,45 @@ void MemoryManager::addMemPool(posix::Allocator* f_managementAllocator,
         errorHandler(Error::kMEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE);
     }
 
-    m_memPoolVector.emplace_back(adjustedChunkSize, f_numberOfChunks, f_managementAllocator, f_payloadAllocator);
-    m_totalNumberOfChunks += f_numberOfChunks;
+    m_memPoolVector.emplace_back(
+        adjustedChunkSize, f_numberOfChunks, f_managementAllocator, f_payloadAllocator, f_maxNumberOfChunks);
+    m_totalNumberOfChunks += std::max(static_cast<uint32_t>(f_numberOfChunks), f_maxNumberOfChunks);
+}
+
+void MemoryManager::addDynamicMemPool(posix::Allocator* f_managementAllocator,
+                                      posix::Allocator* f_payloadAllocator,
+                                      const cxx::greater_or_equal<uint32_t, MemPool::MEMORY_ALIGNMENT> f_minBlockSize,
+                                      const cxx::greater_or_equal<uint32_t, 1> f_numberOfMinBlocks)
+{
+    if (m_denyAddMemPool)
+    {
+        std::cerr
+            << "\nAfter the generation of the chunk management pool you are not allowed to create new mempools.\n";
+        errorHandler(Error::kMEPOO__MEMPOOL_ADDMEMPOOL_AFTER_GENERATECHUNKMANAGEMENTPOOL);
+    }
+
+    m_dynamicMemPool.emplace_back(
+        MemPool::BuddyPool, f_minBlockSize, f_numberOfMinBlocks, f_managementAllocator, f_payloadAllocator);
+    // in the worst case every minimal block is a separate allocation, each of which
+    // needs its own ChunkManagement entry
+    m_totalNumberOfChunks += f_numberOfMinBlocks;
 }
 
-void MemoryManager::generateChunkManagementPool(posix::Allocator* f_managementAllocator)
+void MemoryManager::generateChunkManagementPool(posix::Allocator* f_managementAllocator,
+                                                posix::Allocator* f_entryAllocator)
 {
     m_denyAddMemPool = true;
     uint32_t chunkSize = sizeof(ChunkManagement);
-    m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, f_managementAllocator, f_managementAllocator);
+    m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, f_managementAllocator, f_entryAllocator);
+}
+
+bool MemoryManager::extendMemPool(const uint32_t f_index, const uint32_t f_numberOfChunks)
+{
+    if (f_index >= m_memPoolVector.size())
+    {
+        return false;
+    }
+    return m_memPoolVector[f_index].addChunks(f_numberOfChunks);
 }
 
 uint32_t MemoryManager::getNumberOfMemPools() const
@@ -89,13 +218,10 @@ MemPoolInfo MemoryManager::getMemPoolInfo(uint32_t index) const
 uint32_t MemoryManager::getMempoolChunkSizeForPayloadSize(const uint32_t f_size) const
 {
     uint32_t adjustedSize = MemoryManager::sizeWithChunkHeaderStruct(f_size);
-    for (auto& memPool : m_memPoolVector)
+    uint32_t poolIndex = getMemPoolIndexForSize(adjustedSize);
+    if (poolIndex < m_memPoolVector.size())
     {
-        const auto chunkSize = memPool.getChunkSize();
-        if (chunkSize >= adjustedSize)
-        {
-            return chunkSize;
-        }
+        return m_memPoolVector[poolIndex].getChunkSize();
     }
 
     return 0;
@@ -109,10 +235,22 @@ uint32_t MemoryManager::sizeWithChunkHeaderStruct(const MaxSize_t f_size)
 uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& f_mePooConfig)
 {
     uint64_t memorySize{0};
+    uint64_t sumOfAllChunks{0};
     for (const auto& mempool : f_mePooConfig.m_mempoolConfig)
     {
-        memorySize +=
-            static_cast<uint64_t>(mempool.m_chunkCount) * MemoryManager::sizeWithChunkHeaderStruct(mempool.m_size);
+        uint64_t chunkCount = std::max(mempool.m_chunkCount, mempool.m_maxChunkCount);
+        sumOfAllChunks += chunkCount;
+        memorySize += chunkCount * MemoryManager::sizeWithChunkHeaderStruct(mempool.m_size);
+    }
+    // the buddy mempool places the ChunkHeader inside the minimal blocks
+    sumOfAllChunks += f_mePooConfig.m_dynamicPool.m_chunkCount;
+    memorySize +=
+        static_cast<uint64_t>(f_mePooConfig.m_dynamicPool.m_chunkCount) * f_mePooConfig.m_dynamicPool.m_size;
+
+    if (f_mePooConfig.m_segmentLocalManagement)
+    {
+        // the ChunkManagement entries are placed behind the chunk arrays
+        memorySize += sumOfAllChunks * sizeof(ChunkManagement);
     }
     return memorySize;
 }
@@ -123,11 +261,23 @@ uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& f_mePooC
     uint32_t sumOfAllChunks{0};
     for (const auto& mempool : f_mePooConfig.m_mempoolConfig)
     {
-        sumOfAllChunks += mempool.m_chunkCount;
-        memorySize += cxx::align(MemPool::freeList_t::requiredMemorySize(mempool.m_chunkCount), 32ul);
+        uint32_t chunkCount = std::max(mempool.m_chunkCount, mempool.m_maxChunkCount);
+        sumOfAllChunks += chunkCount;
+        memorySize += cxx::align(MemPool::freeList_t::requiredMemorySize(chunkCount), 32ul);
+    }
+
+    if (f_mePooConfig.m_dynamicPool.m_chunkCount > 0)
+    {
+        sumOfAllChunks += f_mePooConfig.m_dynamicPool.m_chunkCount;
+        memorySize += cxx::align(BuddyAllocator::requiredMemorySize(f_mePooConfig.m_dynamicPool.m_chunkCount), 32ul);
     }
 
-    memorySize += sumOfAllChunks * sizeof(ChunkManagement);
+    if (!f_mePooConfig.m_segmentLocalManagement)
+    {
+        memorySize += sumOfAllChunks * sizeof(ChunkManagement);
+    }
+    // the free list of the chunk management pool stays in the management
+    // segment even with the segment local layout
     memorySize += cxx::align(MemPool::freeList_t::requiredMemorySize(sumOfAllChunks), 32ul);
 
     return memorySize;
@@ -144,26 +294,118 @@ void MemoryManager::configureMemoryManager(const MePooConfig& f_mePooConfig,
 {
     for (auto entry : f_mePooConfig.m_mempoolConfig)
     {
-        addMemPool(f_managementAllocator, f_payloadAllocator, entry.m_size, entry.m_chunkCount);
+        addMemPool(f_managementAllocator, f_payloadAllocator, entry.m_size, entry.m_chunkCount, entry.m_maxChunkCount);
+        if (entry.m_highWatermarkPercent > 0u)
+        {
+            m_memPoolVector.back().setHighWatermarkPercent(entry.m_highWatermarkPercent);
+        }
+        if (entry.m_memoryHints != 0u)
+        {
+            m_memPoolVector.back().applyMemoryHints(entry.m_memoryHints);
+        }
     }
 
-    generateChunkManagementPool(f_managementAllocator);
+    if (f_mePooConfig.m_dynamicPool.m_chunkCount > 0)
+    {
+        addDynamicMemPool(f_managementAllocator,
+                          f_payloadAllocator,
+                          f_mePooConfig.m_dynamicPool.m_size,
+                          f_mePooConfig.m_dynamicPool.m_chunkCount);
+        if (f_mePooConfig.m_dynamicPool.m_memoryHints != 0u)
+        {
+            m_dynamicMemPool.back().applyMemoryHints(f_mePooConfig.m_dynamicPool.m_memoryHints);
+        }
+    }
+
+    // with the segment local layout the ChunkManagement entries land in the
+    // payload segment right behind the chunk arrays; the reference count of a
+    // sample then shares the TLB entries of the segment its payload lives in
+    generateChunkManagementPool(f_managementAllocator,
+                                f_mePooConfig.m_segmentLocalManagement ? f_payloadAllocator : f_managementAllocator);
+
+    buildSizeClassIndex();
+}
+
+void MemoryManager::buildSizeClassIndex()
+{
+    // mempools are ordered by increasing chunk size, so for every log2 size class we
+    // store the first mempool that can serve a request of that magnitude
+    const uint32_t numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    for (uint32_t sizeClass = 0u; sizeClass < SIZE_CLASS_COUNT; ++sizeClass)
+    {
+        uint32_t poolIndex = numberOfMemPools;
+        for (uint32_t i = 0u; i < numberOfMemPools; ++i)
+        {
+            if (sizeClass < 32u && m_memPoolVector[i].getChunkSize() >= (1ull << sizeClass))
+            {
+                poolIndex = i;
+                break;
+            }
+        }
+        m_sizeClassIndex[sizeClass] = static_cast<uint8_t>(poolIndex);
+    }
+}
+
+uint32_t MemoryManager::getMemPoolIndexForSize(const uint32_t f_adjustedSize) const
+{
+    uint32_t poolIndex = m_sizeClassIndex[floorLog2(f_adjustedSize)];
+
+    // pools in the same power-of-two band as the request may still be too small
+    while (poolIndex < m_memPoolVector.size() && m_memPoolVector[poolIndex].getChunkSize() < f_adjustedSize)
+    {
+        ++poolIndex;
+    }
+
+    return poolIndex;
 }
 
-SharedChunk MemoryManager::getChunk(const MaxSize_t f_size)
+bool MemoryManager::tryChargeQuota(ChunkQuota* const f_quota)
 {
+    if (f_quota == nullptr || f_quota->m_limit == 0u)
+    {
+        return true;
+    }
+    if (f_quota->m_usedChunks.load(std::memory_order_relaxed) >= f_quota->m_limit)
+    {
+        f_quota->m_deniedRequests.fetch_add(1u, std::memory_order_relaxed);
+        return false;
+    }
+    f_quota->m_usedChunks.fetch_add(1u, std::memory_order_relaxed);
+    return true;
+}
+
+void MemoryManager::unchargeQuota(ChunkQuota* const f_quota)
+{
+    if (f_quota != nullptr && f_quota->m_limit != 0u)
+    {
+        f_quota->m_usedChunks.fetch_sub(1u, std::memory_order_relaxed);
+    }
+}
+
+SharedChunk
+MemoryManager::getChunk(const MaxSize_t f_size, ChunkQuota* const f_quota, PortChunkAccounting* const f_accounting)
+{
+    if (m_allocationTracing.load(std::memory_order_relaxed))
+    {
+        recordAllocation(f_size);
+    }
+
+    if (!tryChargeQuota(f_quota))
+    {
+        std::cerr << "MemoryManager: chunk quota of the consumer reached, denying a chunk of size " << f_size
+                  << std::endl;
+        return SharedChunk(nullptr);
+    }
+
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
     uint32_t adjustedSize = MemoryManager::sizeWithChunkHeaderStruct(f_size);
 
-    for (auto& memPool : m_memPoolVector)
+    uint32_t poolIndex = getMemPoolIndexForSize(adjustedSize);
+    if (poolIndex < m_memPoolVector.size())
     {
-        if (memPool.getChunkSize() >= adjustedSize)
-        {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            break;
-        }
+        memPoolPointer = &m_memPoolVector[poolIndex];
+        chunk = memPoolPointer->getChunk();
     }
 
     if (memPoolPointer == nullptr)
@@ -173,6 +415,7 @@ SharedChunk MemoryManager::getChunk(const MaxSize_t f_size)
         std::cerr << "\nCould not find a fitting mempool for a chunk of size " << adjustedSize << std::endl;
 
         errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE);
+        unchargeQuota(f_quota);
         return SharedChunk(nullptr);
     }
     else if (chunk == nullptr)
@@ -180,6 +423,7 @@ SharedChunk MemoryManager::getChunk(const MaxSize_t f_size)
         std::cerr << "MemoryManager: unable to acquire a chunk with a payload size of " << f_size << std::endl;
         std::cerr << "The following mempools are available:" << std::endl;
         printMemPoolVector();
+        unchargeQuota(f_quota);
         return SharedChunk(nullptr);
     }
     else
@@ -190,8 +434,183 @@ SharedChunk MemoryManager::getChunk(const MaxSize_t f_size)
         ChunkManagement* chunkManagement = static_cast<ChunkManagement*>(m_chunkManagementPool[0].getChunk());
         new (chunkManagement)
             ChunkManagement(static_cast<ChunkHeader*>(chunk), memPoolPointer, &m_chunkManagementPool[0]);
+        if (f_quota != nullptr && f_quota->m_limit != 0u)
+        {
+            // remembered so the release hands the charge back
+            chunkManagement->m_quota = f_quota;
+        }
+        if (f_accounting != nullptr)
+        {
+            // remembered so the release decrements the outstanding count
+            chunkManagement->m_accounting = f_accounting;
+            f_accounting->m_outstandingChunks.fetch_add(1u, std::memory_order_relaxed);
+            f_accounting->m_totalAllocations.fetch_add(1u, std::memory_order_relaxed);
+        }
         return SharedChunk(chunkManagement);
     }
 }
+
+bool MemoryManager::hasDynamicMemPool() const
+{
+    return m_dynamicMemPool.size() > 0;
+}
+
+uint32_t MemoryManager::getMemPoolIndexForPayloadSize(const uint32_t f_payloadSize) const
+{
+    return getMemPoolIndexForSize(sizeWithChunkHeaderStruct(f_payloadSize));
+}
+
+SharedChunk MemoryManager::getChunkFromPool(const uint32_t f_poolIndex,
+                                            const MaxSize_t f_payloadSize,
+                                            ChunkQuota* const f_quota,
+                                            PortChunkAccounting* const f_accounting)
+{
+    if (m_allocationTracing.load(std::memory_order_relaxed))
+    {
+        recordAllocation(f_payloadSize);
+    }
+
+    if (!tryChargeQuota(f_quota))
+    {
+        std::cerr << "MemoryManager: chunk quota of the consumer reached, denying a chunk of payload size "
+                  << f_payloadSize << std::endl;
+        return SharedChunk(nullptr);
+    }
+
+    if (f_poolIndex >= m_memPoolVector.size())
+    {
+        std::cerr << "The following mempools are available:" << std::endl;
+        printMemPoolVector();
+        std::cerr << "\nCould not find a fitting mempool for a chunk of payload size " << f_payloadSize << std::endl;
+
+        errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE);
+        unchargeQuota(f_quota);
+        return SharedChunk(nullptr);
+    }
+
+    MemPool* memPoolPointer = &m_memPoolVector[f_poolIndex];
+    void* chunk = memPoolPointer->getChunk();
+
+    if (chunk == nullptr)
+    {
+        std::cerr << "MemoryManager: unable to acquire a chunk with a payload size of " << f_payloadSize << std::endl;
+        std::cerr << "The following mempools are available:" << std::endl;
+        printMemPoolVector();
+        unchargeQuota(f_quota);
+        return SharedChunk(nullptr);
+    }
+
+    uint32_t adjustedSize = MemoryManager::sizeWithChunkHeaderStruct(f_payloadSize);
+    new (chunk) ChunkHeader();
+    static_cast<ChunkHeader*>(chunk)->m_info.m_payloadSize = f_payloadSize;
+    static_cast<ChunkHeader*>(chunk)->m_info.m_usedSizeOfChunk = adjustedSize;
+    ChunkManagement* chunkManagement = static_cast<ChunkManagement*>(m_chunkManagementPool[0].getChunk());
+    new (chunkManagement)
+        ChunkManagement(static_cast<ChunkHeader*>(chunk), memPoolPointer, &m_chunkManagementPool[0]);
+    if (f_quota != nullptr && f_quota->m_limit != 0u)
+    {
+        chunkManagement->m_quota = f_quota;
+    }
+    if (f_accounting != nullptr)
+    {
+        chunkManagement->m_accounting = f_accounting;
+        f_accounting->m_outstandingChunks.fetch_add(1u, std::memory_order_relaxed);
+        f_accounting->m_totalAllocations.fetch_add(1u, std::memory_order_relaxed);
+    }
+    return SharedChunk(chunkManagement);
+}
+
+SharedChunk MemoryManager::getDynamicChunk(const MaxSize_t f_size,
+                                           ChunkQuota* const f_quota,
+                                           PortChunkAccounting* const f_accounting)
+{
+    if (m_dynamicMemPool.size() == 0)
+    {
+        // no buddy mempool configured, serve the request from the fixed size mempools
+        return getChunk(f_size, f_quota, f_accounting);
+    }
+
+    if (m_allocationTracing.load(std::memory_order_relaxed))
+    {
+        recordAllocation(f_size);
+    }
+
+    if (!tryChargeQuota(f_quota))
+    {
+        std::cerr << "MemoryManager: chunk quota of the consumer reached, denying a dynamic chunk of size " << f_size
+                  << std::endl;
+        return SharedChunk(nullptr);
+    }
+
+    uint32_t adjustedSize = MemoryManager::sizeWithChunkHeaderStruct(f_size);
+    void* chunk = m_dynamicMemPool[0].getChunk(adjustedSize);
+
+    if (chunk == nullptr)
+    {
+        std::cerr << "MemoryManager: unable to acquire a dynamic chunk with a payload size of " << f_size
+                  << std::endl;
+        unchargeQuota(f_quota);
+        return SharedChunk(nullptr);
+    }
+
+    new (chunk) ChunkHeader();
+    static_cast<ChunkHeader*>(chunk)->m_info.m_payloadSize = f_size;
+    static_cast<ChunkHeader*>(chunk)->m_info.m_usedSizeOfChunk = adjustedSize;
+    ChunkManagement* chunkManagement = static_cast<ChunkManagement*>(m_chunkManagementPool[0].getChunk());
+    new (chunkManagement)
+        ChunkManagement(static_cast<ChunkHeader*>(chunk), &m_dynamicMemPool[0], &m_chunkManagementPool[0]);
+    if (f_quota != nullptr && f_quota->m_limit != 0u)
+    {
+        chunkManagement->m_quota = f_quota;
+    }
+    if (f_accounting != nullptr)
+    {
+        chunkManagement->m_accounting = f_accounting;
+        f_accounting->m_outstandingChunks.fetch_add(1u, std::memory_order_relaxed);
+        f_accounting->m_totalAllocations.fetch_add(1u, std::memory_order_relaxed);
+    }
+    return SharedChunk(chunkManagement);
+}
+
+PortChunkAccounting* MemoryManager::fetchPortAccounting(const uint64_t f_portID)
+{
+    if (0u == f_portID)
+    {
+        return nullptr;
+    }
+
+    for (auto& entry : m_portAccounting)
+    {
+        uint64_t l_claimedID = entry.m_portID.load(std::memory_order_relaxed);
+        if (l_claimedID == f_portID)
+        {
+            return &entry;
+        }
+        if (l_claimedID == 0u)
+        {
+            // claim the free entry; when a concurrent claim wins the entry may
+            // now belong to the same port which raced itself
+            if (entry.m_portID.compare_exchange_strong(l_claimedID, f_portID, std::memory_order_relaxed)
+                || l_claimedID == f_portID)
+            {
+                return &entry;
+            }
+        }
+    }
+    return nullptr;
+}
+
+MemoryManager::PortAccountingInfo MemoryManager::getPortAccountingInfo(const uint32_t f_index) const
+{
+    PortAccountingInfo l_info;
+    if (f_index < PORT_ACCOUNTING_CAPACITY)
+    {
+        const auto& entry = m_portAccounting[f_index];
+        l_info.m_portID = entry.m_portID.load(std::memory_order_relaxed);
+        l_info.m_outstandingChunks = entry.m_outstandingChunks.load(std::memory_order_relaxed);
+        l_info.m_totalAllocations = entry.m_totalAllocations.load(std::memory_order_relaxed);
+    }
+    return l_info;
+}
 } // namespace mepoo
 } // namespace iox
@@ -20,6 +20,11 @@ namespace iox
 {
 namespace mepoo
 {
+constexpr uint32_t MePooConfig::HINT_HUGE_PAGES;
+constexpr uint32_t MePooConfig::HINT_SEQUENTIAL;
+constexpr uint32_t MePooConfig::HINT_DONT_DUMP;
+constexpr uint32_t MePooConfig::HINT_LOCKED;
+
 const MePooConfig::MePooConfigContainerType* MePooConfig::getMemPoolConfig() const noexcept
 {
     return &m_mempoolConfig;
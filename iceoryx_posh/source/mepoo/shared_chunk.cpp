@@ -54,14 +54,50 @@ void SharedChunk::incrementReferenceCounter()
 void SharedChunk::decrementReferenceCounter()
 {
     if ((m_chunkManagement != nullptr)
-        && (m_chunkManagement->m_referenceCounter.fetch_sub(1u, std::memory_order_relaxed) == 1))
+        && (m_chunkManagement->m_referenceCounter.fetch_sub(1u, std::memory_order_release) == 1))
     {
+        // pairs with the release decrements of the other owners so that all their
+        // accesses to the chunk happened before we hand it back to the mempool
+        std::atomic_thread_fence(std::memory_order_acquire);
         freeChunk();
     }
 }
 
+void SharedChunk::addReferences(const uint32_t f_count) const
+{
+    if (m_chunkManagement != nullptr)
+    {
+        m_chunkManagement->m_referenceCounter.fetch_add(f_count, std::memory_order_relaxed);
+    }
+}
+
+SharedChunk SharedChunk::claimAddedReference() const
+{
+    // the SharedChunk constructor takes ownership of a reference without incrementing
+    return SharedChunk(m_chunkManagement);
+}
+
 void SharedChunk::freeChunk()
 {
+#ifndef IOX_COMPACT_CHUNK_HEADER
+    // release the reference held by the chain link of a composite sample; the
+    // temporary frees the rest of the chain recursively when we were the last owner
+    ChunkHeader* l_chunkHeader = m_chunkManagement->m_chunkHeader;
+    if (l_chunkHeader->hasNextChunk())
+    {
+        SharedChunk l_nextChunk(
+            relative_ptr<ChunkManagement>(l_chunkHeader->m_nextChunkOffset, l_chunkHeader->m_nextChunkSegmentId));
+    }
+#endif
+    if (m_chunkManagement->m_quota != nullptr)
+    {
+        // hand the quota share back together with the chunk
+        m_chunkManagement->m_quota->m_usedChunks.fetch_sub(1u, std::memory_order_relaxed);
+    }
+    if (m_chunkManagement->m_accounting != nullptr)
+    {
+        m_chunkManagement->m_accounting->m_outstandingChunks.fetch_sub(1u, std::memory_order_relaxed);
+    }
     m_chunkManagement->m_mempool->freeChunk(m_chunkManagement->m_chunkHeader);
     m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
 }
@@ -18,7 +18,9 @@ namespace iox
 {
 namespace popo
 {
+constexpr uint64_t BasePort::MemberType_t::UNIQUE_ID_RANGE_SHIFT;
 std::atomic<uint64_t> BasePort::MemberType_t::s_uniqueIdCounter{1};
+std::atomic<uint64_t> BasePort::MemberType_t::s_uniqueIdRangeBase{0};
 
 BasePort::BasePort(BasePortData* const f_basePortDataPtr) noexcept
     : m_basePortDataPtr(f_basePortDataPtr)
@@ -18,8 +18,19 @@ namespace iox
 {
 namespace popo
 {
+void BasePortData::setUniqueIdRange(const uint64_t f_rangeIndex) noexcept
+{
+    s_uniqueIdRangeBase.store(f_rangeIndex << UNIQUE_ID_RANGE_SHIFT, std::memory_order_relaxed);
+}
+
+uint64_t BasePortData::generateUniqueId() noexcept
+{
+    return s_uniqueIdRangeBase.load(std::memory_order_relaxed)
+           | s_uniqueIdCounter.fetch_add(1, std::memory_order_relaxed);
+}
+
 BasePortData::BasePortData() noexcept
-    : m_uniqueId(s_uniqueIdCounter.fetch_add(1, std::memory_order_relaxed))
+    : m_uniqueId(generateUniqueId())
 {
 }
 
@@ -32,7 +43,7 @@ BasePortData::BasePortData(const capro::ServiceDescription& serviceDescription,
     , m_serviceDescription(serviceDescription)
     , m_processName(processName)
     , m_interface(interface)
-    , m_uniqueId(s_uniqueIdCounter.fetch_add(1, std::memory_order_relaxed))
+    , m_uniqueId(generateUniqueId())
     , m_runnable(runnable)
 {
 }
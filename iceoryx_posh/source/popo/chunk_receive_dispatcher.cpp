@@ -0,0 +1,154 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/popo/chunk_receive_dispatcher.hpp"
+
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+
+#include <chrono>
+#include <ctime>
+
+namespace iox
+{
+namespace popo
+{
+ChunkReceiveDispatcher::ChunkReceiveDispatcher(const uint32_t f_numberOfThreads) noexcept
+{
+    for (uint32_t i = 0u; i < f_numberOfThreads; ++i)
+    {
+        m_workerThreads.emplace_back(&ChunkReceiveDispatcher::dispatchLoop, this);
+    }
+}
+
+ChunkReceiveDispatcher::~ChunkReceiveDispatcher() noexcept
+{
+    m_runFlag = false;
+    auto groupSemaphore = m_groupSemaphore.load(std::memory_order_relaxed);
+    if (groupSemaphore != nullptr)
+    {
+        // one post per worker to leave the wait immediately
+        for (size_t i = 0u; i < m_workerThreads.size(); ++i)
+        {
+            groupSemaphore->post();
+        }
+    }
+    for (auto& workerThread : m_workerThreads)
+    {
+        workerThread.join();
+    }
+}
+
+bool ChunkReceiveDispatcher::attach(ReceiverPortType& f_receiver, const ReceiveHandler_t f_handler) noexcept
+{
+    std::lock_guard<std::mutex> g(m_subscriptionsMutex);
+
+    if (m_groupSemaphore.load(std::memory_order_relaxed) == nullptr)
+    {
+        auto groupSemaphore = f_receiver.GetShmSemaphore();
+        if (groupSemaphore == nullptr)
+        {
+            return false;
+        }
+        m_groupSemaphore.store(groupSemaphore, std::memory_order_release);
+    }
+
+    f_receiver.SetCallbackReferences(m_groupSemaphore.load(std::memory_order_relaxed));
+
+    auto subscription = std::make_shared<Subscription>();
+    subscription->m_receiver = &f_receiver;
+    subscription->m_handler = f_handler;
+    subscription->m_inProgress = std::make_shared<std::atomic<bool>>(false);
+    m_subscriptions.push_back(subscription);
+    return true;
+}
+
+void ChunkReceiveDispatcher::detach(ReceiverPortType& f_receiver) noexcept
+{
+    std::lock_guard<std::mutex> g(m_subscriptionsMutex);
+
+    for (auto iter = m_subscriptions.begin(); iter != m_subscriptions.end(); ++iter)
+    {
+        if ((*iter)->m_receiver == &f_receiver)
+        {
+            f_receiver.UnsetCallbackReferences();
+            m_subscriptions.erase(iter);
+            return;
+        }
+    }
+}
+
+uint32_t ChunkReceiveDispatcher::numberOfSubscriptions() const noexcept
+{
+    std::lock_guard<std::mutex> g(m_subscriptionsMutex);
+    return static_cast<uint32_t>(m_subscriptions.size());
+}
+
+void ChunkReceiveDispatcher::dispatchLoop() noexcept
+{
+    std::vector<std::shared_ptr<Subscription>> activeSubscriptions;
+
+    while (m_runFlag)
+    {
+        auto groupSemaphore = m_groupSemaphore.load(std::memory_order_acquire);
+        if (groupSemaphore == nullptr)
+        {
+            // nothing attached yet
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        // bounded wait so a late detach of the semaphore owner or shutdown
+        // cannot park a worker forever
+        struct timespec timeout;
+        ::clock_gettime(CLOCK_REALTIME, &timeout);
+        timeout.tv_nsec += 10 * 1000 * 1000;
+        if (timeout.tv_nsec >= 1000 * 1000 * 1000)
+        {
+            timeout.tv_nsec -= 1000 * 1000 * 1000;
+            ++timeout.tv_sec;
+        }
+        groupSemaphore->timedWait(&timeout, true);
+        if (!m_runFlag)
+        {
+            return;
+        }
+
+        // handlers run without the lock, attach and detach stay possible
+        {
+            std::lock_guard<std::mutex> g(m_subscriptionsMutex);
+            activeSubscriptions = m_subscriptions;
+        }
+
+        for (auto& subscription : activeSubscriptions)
+        {
+            if (!subscription->m_receiver->newData())
+            {
+                continue;
+            }
+            bool expected{false};
+            if (!subscription->m_inProgress->compare_exchange_strong(expected, true))
+            {
+                continue;
+            }
+            // re-arm the coalesced notification before draining, a chunk
+            // delivered while the handler runs posts a new wakeup
+            subscription->m_receiver->clearPendingNotification();
+            subscription->m_handler();
+            subscription->m_inProgress->store(false, std::memory_order_release);
+        }
+    }
+}
+
+} // namespace popo
+} // namespace iox
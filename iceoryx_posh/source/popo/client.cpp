@@ -0,0 +1,132 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/popo/client.hpp"
+
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <unistd.h>
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+/// in-flight requests per client; bounds the response delivery FiFo
+constexpr uint32_t RESPONSE_QUEUE_SIZE{16u};
+
+uint32_t generateClientId() noexcept
+{
+    static std::atomic<uint16_t> s_clientCounter{0u};
+    return (static_cast<uint32_t>(getpid()) << 16) | s_clientCounter.fetch_add(1u, std::memory_order_relaxed);
+}
+} // namespace
+
+Client::Client(const capro::ServiceDescription& service, const cxx::CString100& runnableName) noexcept
+    : m_requestSender(
+        runtime::PoshRuntime::getInstance().getMiddlewareSender(service, Interfaces::INTERNAL, runnableName))
+    , m_responseReceiver(runtime::PoshRuntime::getInstance().getMiddlewareReceiver(
+          responseService(service), Interfaces::INTERNAL, runnableName))
+    , m_clientId(generateClientId())
+{
+    connect();
+}
+
+Client::Client(SenderPortType&& requestSender, ReceiverPortType&& responseReceiver) noexcept
+    : m_requestSender(std::move(requestSender))
+    , m_responseReceiver(std::move(responseReceiver))
+    , m_clientId(generateClientId())
+{
+    connect();
+}
+
+Client::~Client() noexcept
+{
+    m_responseReceiver.unsubscribe();
+    m_requestSender.deactivate();
+}
+
+void Client::connect() noexcept
+{
+    // only chunks stamped with this client's tag end up in the delivery FiFo,
+    // responses for other clients are dropped at the server's sender port
+    m_responseReceiver.setChunkFilter(0xFFFFu, getClientTag());
+    m_responseReceiver.subscribe(true, RESPONSE_QUEUE_SIZE);
+    m_requestSender.activate();
+}
+
+void* Client::allocateRequest(const uint32_t payloadSize) noexcept
+{
+    auto chunkHeader = m_requestSender.reserveChunk(payloadSize);
+    return chunkHeader->payload();
+}
+
+uint64_t Client::sendRequest(void* const payload) noexcept
+{
+    auto chunkHeader = mepoo::convertPayloadPointerToChunkHeader(payload);
+
+    uint64_t l_correlationId = (static_cast<uint64_t>(m_clientId) << 32)
+                               | m_nextRequestId.fetch_add(1u, std::memory_order_relaxed);
+    chunkHeader->setCorrelationId(l_correlationId);
+    // the tag travels with the request so the server can stamp the response
+    // for this client's chunk filter; the request direction is not filtered
+    chunkHeader->m_info.m_filterTag = getClientTag();
+
+    m_requestSender.deliverChunk(chunkHeader);
+    return l_correlationId;
+}
+
+bool Client::hasResponse() noexcept
+{
+    return m_responseReceiver.newData();
+}
+
+bool Client::getResponse(const void** payload, uint64_t& correlationId) noexcept
+{
+    const mepoo::ChunkHeader* chunkHeader = nullptr;
+    while (m_responseReceiver.getChunk(chunkHeader))
+    {
+#ifndef IOX_COMPACT_CHUNK_HEADER
+        // the 16 bit tag can collide between processes, the full client id in
+        // the correlation id cannot; drop responses of a colliding client.
+        // The compact chunk header truncates the id to 32 bit which strips the
+        // client part, there a collision delivers the foreign response
+        if (static_cast<uint32_t>(chunkHeader->correlationId() >> 32) != m_clientId)
+        {
+            m_responseReceiver.releaseChunk(chunkHeader);
+            continue;
+        }
+#endif
+        *payload = chunkHeader->payload();
+        correlationId = chunkHeader->correlationId();
+        return true;
+    }
+    *payload = nullptr;
+    return false;
+}
+
+bool Client::releaseResponse(const void* const payload) noexcept
+{
+    auto chunkHeader = mepoo::convertPayloadPointerToChunkHeader(const_cast<void* const>(payload));
+    return m_responseReceiver.releaseChunk(chunkHeader);
+}
+
+uint16_t Client::getClientTag() const noexcept
+{
+    return static_cast<uint16_t>((m_clientId >> 16) ^ m_clientId);
+}
+
+} // namespace popo
+} // namespace iox
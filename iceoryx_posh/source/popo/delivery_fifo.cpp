@@ -14,6 +14,11 @@
 
 #include "iceoryx_posh/internal/popo/delivery_fifo.hpp"
 
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
 namespace iox
 {
 namespace popo
@@ -21,49 +26,339 @@ namespace popo
 bool DeliveryFiFo::pop(mepoo::SharedChunk& chunk)
 {
     DeliveryFiFo::ChunkManagementTransport chunkTransport;
-    bool retVal = m_fifo.pop(chunkTransport);
+    bool retVal = m_latestValueMode.load(std::memory_order_relaxed) ? popLatestValue(chunkTransport)
+                                                                    : m_fifo.pop(chunkTransport);
     if (retVal == true)
     {
-        auto chunkManagement =
-            iox::relative_ptr<mepoo::ChunkManagement>(chunkTransport.m_chunkOffset, chunkTransport.m_segmentId);
-        chunk = mepoo::SharedChunk(chunkManagement);
+        if (chunkTransport.m_inlinePayloadSize != 0u)
+        {
+            assert(false && "inline sample delivered to a chunk topic, fetch it with popInline");
+            return false;
+        }
+        // validated once here, SharedChunk then works on the raw pointer
+        chunk = mepoo::SharedChunk(chunkTransport.validatedChunkManagement());
     }
     return retVal;
 }
 
+uint32_t DeliveryFiFo::popBatch(mepoo::SharedChunk* f_chunks, const uint32_t f_count)
+{
+    if (m_latestValueMode.load(std::memory_order_relaxed))
+    {
+        return (f_count > 0u && pop(f_chunks[0])) ? 1u : 0u;
+    }
+
+    constexpr uint32_t SliceCapacity{32u};
+    DeliveryFiFo::ChunkManagementTransport chunkTransports[SliceCapacity];
+
+    uint32_t popped{0u};
+    while (popped < f_count)
+    {
+        const uint32_t remaining = f_count - popped;
+        const uint32_t sliceSize = (remaining < SliceCapacity) ? remaining : SliceCapacity;
+        const uint32_t sliceCount = m_fifo.popBatch(chunkTransports, sliceSize);
+        for (uint32_t i = 0u; i < sliceCount; ++i)
+        {
+            assert(chunkTransports[i].m_inlinePayloadSize == 0u
+                   && "inline sample delivered to a chunk topic, fetch it with popInline");
+            f_chunks[popped + i] = mepoo::SharedChunk(chunkTransports[i].validatedChunkManagement());
+        }
+        popped += sliceCount;
+        if (sliceCount < sliceSize)
+        {
+            break;
+        }
+    }
+    return popped;
+}
+
+void DeliveryFiFo::pushBatch(mepoo::SharedChunk* f_chunks, const uint32_t f_count)
+{
+    // latest value topics and the non default overflow policies have per chunk
+    // semantics (slot swap, blocking, discarding), they stay on the single push
+    if (m_latestValueMode.load(std::memory_order_relaxed)
+        || m_overflowPolicy.load(std::memory_order_relaxed) != OverflowPolicy::OVERWRITE_OLDEST)
+    {
+        for (uint32_t i = 0u; i < f_count; ++i)
+        {
+            mepoo::SharedChunk l_chunk{nullptr};
+            push(std::move(f_chunks[i]), l_chunk);
+        }
+        return;
+    }
+
+    constexpr uint32_t SliceCapacity{32u};
+    DeliveryFiFo::ChunkManagementTransport chunkTransports[SliceCapacity];
+    DeliveryFiFo::ChunkManagementTransport overflowTransports[SliceCapacity];
+
+    uint32_t pushed{0u};
+    while (pushed < f_count)
+    {
+        const uint32_t remaining = f_count - pushed;
+        const uint32_t sliceSize = (remaining < SliceCapacity) ? remaining : SliceCapacity;
+        for (uint32_t i = 0u; i < sliceSize; ++i)
+        {
+            chunkTransports[i] = DeliveryFiFo::ChunkManagementTransport(f_chunks[pushed + i].releaseWithRelativePtr());
+        }
+
+        const uint32_t overflowCount = m_fifo.pushBatch(chunkTransports, sliceSize, overflowTransports);
+        for (uint32_t i = 0u; i < overflowCount; ++i)
+        {
+            // reclaiming the overwritten chunk releases it when droppedChunk
+            // goes out of scope
+            mepoo::SharedChunk droppedChunk{nullptr};
+            reclaimDropped(overflowTransports[i], droppedChunk);
+        }
+        pushed += sliceSize;
+    }
+}
+
 bool DeliveryFiFo::push(mepoo::SharedChunk&& chunkIn, mepoo::SharedChunk& chunkOut)
 {
+    const auto policy = m_overflowPolicy.load(std::memory_order_relaxed);
+    if (policy != OverflowPolicy::OVERWRITE_OLDEST && full())
+    {
+        if (discardAfterOverflowPolicy(policy))
+        {
+            // discard the incoming chunk, handing it back for release like the
+            // overwritten one in the OVERWRITE_OLDEST case
+            chunkOut = std::move(chunkIn);
+            recordDrop(chunkOut);
+            return false;
+        }
+    }
+
     DeliveryFiFo::ChunkManagementTransport chunkTransportIn(chunkIn.releaseWithRelativePtr());
     DeliveryFiFo::ChunkManagementTransport chunkTransportOut;
 
-    bool retVal = m_fifo.push(std::move(chunkTransportIn), chunkTransportOut);
+    bool retVal = m_latestValueMode.load(std::memory_order_relaxed)
+                      ? pushLatestValue(std::move(chunkTransportIn), chunkTransportOut)
+                      : m_fifo.push(std::move(chunkTransportIn), chunkTransportOut);
 
     if (retVal == false)
     {
-        auto chunkManagement =
-            iox::relative_ptr<mepoo::ChunkManagement>(chunkTransportOut.m_chunkOffset, chunkTransportOut.m_segmentId);
-        chunkOut = mepoo::SharedChunk(chunkManagement);
+        reclaimDropped(chunkTransportOut, chunkOut);
     }
     return retVal;
 }
 
+bool DeliveryFiFo::pushInline(const void* const f_payload, const uint32_t f_size, mepoo::SharedChunk& f_chunkOut)
+{
+    if (f_size == 0u || f_size > ChunkManagementTransport::INLINE_PAYLOAD_CAPACITY)
+    {
+        return false;
+    }
+
+    const auto policy = m_overflowPolicy.load(std::memory_order_relaxed);
+    if (policy != OverflowPolicy::OVERWRITE_OLDEST && full())
+    {
+        if (discardAfterOverflowPolicy(policy))
+        {
+            // the discarded sample occupies no chunk, only the loss is counted
+            m_dropCounter.fetch_add(1u, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    DeliveryFiFo::ChunkManagementTransport transportIn;
+    transportIn.m_inlinePayloadSize = f_size;
+    memcpy(transportIn.m_inlinePayload, f_payload, f_size);
+    DeliveryFiFo::ChunkManagementTransport transportOut;
+
+    bool retVal = m_latestValueMode.load(std::memory_order_relaxed)
+                      ? pushLatestValue(std::move(transportIn), transportOut)
+                      : m_fifo.push(std::move(transportIn), transportOut);
+
+    if (retVal == false)
+    {
+        reclaimDropped(transportOut, f_chunkOut);
+    }
+    return retVal;
+}
+
+bool DeliveryFiFo::popInline(void* const f_payload, uint32_t& f_size)
+{
+    DeliveryFiFo::ChunkManagementTransport transport;
+    bool retVal = m_latestValueMode.load(std::memory_order_relaxed) ? popLatestValue(transport) : m_fifo.pop(transport);
+    if (retVal == false)
+    {
+        return false;
+    }
+
+    if (transport.m_inlinePayloadSize == 0u)
+    {
+        // a chunk reference on an inline topic is a contract violation; reclaim
+        // the chunk so it is not leaked
+        mepoo::SharedChunk l_droppedChunk{nullptr};
+        reclaimDropped(transport, l_droppedChunk);
+        assert(false && "chunk delivered to an inline topic, fetch it with pop");
+        return false;
+    }
+
+    f_size = transport.m_inlinePayloadSize;
+    memcpy(f_payload, transport.m_inlinePayload, f_size);
+    return true;
+}
+
+bool DeliveryFiFo::discardAfterOverflowPolicy(const OverflowPolicy f_policy)
+{
+    if (f_policy == OverflowPolicy::BLOCK_WITH_TIMEOUT)
+    {
+        // wait for the receiver to free a slot, polling is sufficient here
+        // since blocking senders are a tuning decision, not a fast path
+        using namespace std::chrono;
+        constexpr uint32_t PollIntervalUs{100u};
+        const auto deadline = steady_clock::now() + milliseconds(m_overflowTimeoutMs.load(std::memory_order_relaxed));
+        while (full() && steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(microseconds(PollIntervalUs));
+        }
+    }
+    return full();
+}
+
+void DeliveryFiFo::reclaimDropped(const ChunkManagementTransport& f_transport, mepoo::SharedChunk& f_chunkOut)
+{
+    if (f_transport.m_inlinePayloadSize != 0u)
+    {
+        // an overwritten inline sample pins no chunk, only the loss is counted;
+        // inline samples carry no sequence number
+        m_dropCounter.fetch_add(1u, std::memory_order_relaxed);
+        return;
+    }
+    f_chunkOut = mepoo::SharedChunk(f_transport.validatedChunkManagement());
+    recordDrop(f_chunkOut);
+}
+
+bool DeliveryFiFo::pushLatestValue(ChunkManagementTransport&& f_transportIn, ChunkManagementTransport& f_transportOut)
+{
+    for (;;)
+    {
+        auto state = m_latestValueState.load(std::memory_order_relaxed);
+        if (state == LatestValueState::READING)
+        {
+            // the consumer is just copying the slot out, which is a bounded
+            // copy of at most one slot, so spinning here cannot take long
+            continue;
+        }
+        if (m_latestValueState.compare_exchange_weak(
+                state, LatestValueState::WRITING, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            if (state == LatestValueState::FULL)
+            {
+                // give the overwritten entry back to the caller for accounting,
+                // like the FiFo does on overflow
+                f_transportOut = m_latestValueSlot;
+            }
+            m_latestValueSlot = f_transportIn;
+            m_latestValueState.store(LatestValueState::FULL, std::memory_order_release);
+            return state != LatestValueState::FULL;
+        }
+    }
+}
+
+bool DeliveryFiFo::popLatestValue(ChunkManagementTransport& f_transport)
+{
+    for (;;)
+    {
+        auto state = m_latestValueState.load(std::memory_order_relaxed);
+        if (state == LatestValueState::EMPTY)
+        {
+            return false;
+        }
+        if (state == LatestValueState::WRITING)
+        {
+            // the producer is just filling the slot, wait for the bounded copy
+            continue;
+        }
+        if (m_latestValueState.compare_exchange_weak(
+                state, LatestValueState::READING, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            f_transport = m_latestValueSlot;
+            m_latestValueState.store(LatestValueState::EMPTY, std::memory_order_release);
+            return true;
+        }
+    }
+}
+
+void DeliveryFiFo::setOverflowPolicy(const OverflowPolicy f_policy, const uint32_t f_timeoutMs)
+{
+    m_overflowTimeoutMs.store(f_timeoutMs, std::memory_order_relaxed);
+    m_overflowPolicy.store(f_policy, std::memory_order_release);
+}
+
+DeliveryFiFo::OverflowPolicy DeliveryFiFo::getOverflowPolicy() const
+{
+    return m_overflowPolicy.load(std::memory_order_relaxed);
+}
+
+uint64_t DeliveryFiFo::getDropCount() const
+{
+    return m_dropCounter.load(std::memory_order_relaxed);
+}
+
+uint64_t DeliveryFiFo::getLastDroppedSequenceNumber() const
+{
+    return m_lastDroppedSequenceNumber.load(std::memory_order_relaxed);
+}
+
+void DeliveryFiFo::recordDrop(const mepoo::SharedChunk& f_droppedChunk)
+{
+    // two relaxed stores, the pushing sender never waits here; the counter and
+    // the sequence number are not updated atomically together, a reader seeing
+    // a new counter with the previous sequence number observes a loss which
+    // happened either way
+    m_lastDroppedSequenceNumber.store(
+        static_cast<uint64_t>(f_droppedChunk.getChunkHeader()->m_info.m_sequenceNumber), std::memory_order_relaxed);
+    m_dropCounter.fetch_add(1u, std::memory_order_relaxed);
+}
+
+uint64_t DeliveryFiFo::getIndexConflicts() const
+{
+    return m_fifo.getIndexConflicts();
+}
+
+bool DeliveryFiFo::full() const
+{
+    return getSize() >= getCapacity();
+}
+
 bool DeliveryFiFo::empty() const
 {
+    if (m_latestValueMode.load(std::memory_order_relaxed))
+    {
+        return m_latestValueState.load(std::memory_order_relaxed) != LatestValueState::FULL;
+    }
     return m_fifo.empty();
 }
 
 bool DeliveryFiFo::resize(const uint32_t f_size)
 {
+    // a latest value topic needs no ring buffer, a single swapped slot touches
+    // fewer cache lines per sample
+    m_latestValueMode.store(f_size == 1u, std::memory_order_relaxed);
+    if (f_size == 1u)
+    {
+        return true;
+    }
     return m_fifo.resize(f_size);
 }
 
 uint64_t DeliveryFiFo::getCapacity() const
 {
+    if (m_latestValueMode.load(std::memory_order_relaxed))
+    {
+        return 1u;
+    }
     return m_fifo.capacity();
 }
 
 uint64_t DeliveryFiFo::getSize() const
 {
+    if (m_latestValueMode.load(std::memory_order_relaxed))
+    {
+        return (m_latestValueState.load(std::memory_order_relaxed) == LatestValueState::FULL) ? 1u : 0u;
+    }
     return m_fifo.size();
 }
 
@@ -0,0 +1,134 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/popo/fan_out_pool.hpp"
+
+#include <algorithm>
+#include <pthread.h>
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+/// configurable until the pool of the process is created on the first wide
+/// fan-out, afterwards the worker count is fixed
+std::atomic<uint32_t> s_fanOutWorkerCount{3u};
+} // namespace
+
+constexpr uint32_t FanOutPool::PARALLEL_FANOUT_THRESHOLD;
+
+FanOutPool& FanOutPool::get() noexcept
+{
+    static FanOutPool s_pool(s_fanOutWorkerCount.load(std::memory_order_relaxed));
+    return s_pool;
+}
+
+void FanOutPool::setWorkerCount(const uint32_t f_numberOfThreads) noexcept
+{
+    s_fanOutWorkerCount.store(std::max(1u, f_numberOfThreads), std::memory_order_relaxed);
+}
+
+FanOutPool::FanOutPool(const uint32_t f_numberOfThreads) noexcept
+{
+    for (uint32_t i = 0u; i < f_numberOfThreads; ++i)
+    {
+        m_workers.emplace_back(new Worker);
+        Worker& l_worker = *m_workers.back();
+        l_worker.m_thread = std::thread([this, &l_worker] { workerLoop(l_worker); });
+        pthread_setname_np(l_worker.m_thread.native_handle(), "FanOut");
+    }
+}
+
+FanOutPool::~FanOutPool() noexcept
+{
+    m_runFlag.store(false, std::memory_order_relaxed);
+    for (auto& worker : m_workers)
+    {
+        {
+            std::lock_guard<std::mutex> lock(worker->m_mutex);
+        }
+        worker->m_condVar.notify_one();
+        worker->m_thread.join();
+    }
+}
+
+void FanOutPool::workerLoop(Worker& f_worker) noexcept
+{
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(f_worker.m_mutex);
+        f_worker.m_condVar.wait(
+            lock, [&] { return f_worker.m_hasTask || !m_runFlag.load(std::memory_order_relaxed); });
+        if (!f_worker.m_hasTask)
+        {
+            return;
+        }
+        auto l_execute = f_worker.m_execute;
+        auto l_context = f_worker.m_context;
+        auto l_begin = f_worker.m_begin;
+        auto l_end = f_worker.m_end;
+        auto l_remaining = f_worker.m_remaining;
+        f_worker.m_hasTask = false;
+        lock.unlock();
+
+        l_execute(l_context, l_begin, l_end);
+        l_remaining->fetch_sub(1u, std::memory_order_release);
+    }
+}
+
+void FanOutPool::runPartitioned(void (*f_execute)(void* f_context, const uint32_t f_begin, const uint32_t f_end),
+                                void* const f_context,
+                                const uint32_t f_count) noexcept
+{
+    std::lock_guard<std::mutex> submitLock(m_submitMutex);
+
+    const uint32_t l_numberOfWorkers = static_cast<uint32_t>(m_workers.size());
+    // every participant gets a range of at least rangeSize indices, the calling
+    // thread takes the remainder range at the end
+    const uint32_t l_rangeSize = f_count / (l_numberOfWorkers + 1u);
+    std::atomic<uint32_t> l_remaining{0u};
+
+    uint32_t l_begin{0u};
+    for (uint32_t i = 0u; i < l_numberOfWorkers && l_rangeSize > 0u; ++i)
+    {
+        Worker& l_worker = *m_workers[i];
+        // counted before the task is visible, a fast worker must not decrement
+        // below zero
+        l_remaining.fetch_add(1u, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(l_worker.m_mutex);
+            l_worker.m_execute = f_execute;
+            l_worker.m_context = f_context;
+            l_worker.m_begin = l_begin;
+            l_worker.m_end = l_begin + l_rangeSize;
+            l_worker.m_remaining = &l_remaining;
+            l_worker.m_hasTask = true;
+        }
+        l_worker.m_condVar.notify_one();
+        l_begin += l_rangeSize;
+    }
+
+    // the calling thread processes its own share instead of idling
+    f_execute(f_context, l_begin, f_count);
+
+    while (l_remaining.load(std::memory_order_acquire) != 0u)
+    {
+        std::this_thread::yield();
+    }
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,98 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/popo/gateway_channel_pool.hpp"
+
+namespace iox
+{
+namespace popo
+{
+GatewayChannelPool::GatewayChannelPool(const uint32_t f_numberOfWorkers) noexcept
+    : m_threadPool(f_numberOfWorkers)
+{
+}
+
+GatewayChannelPool::~GatewayChannelPool() noexcept
+{
+    // the thread pool joins its workers; passes still queued are discarded
+    // which is fine since the pool is going away with the gateway
+}
+
+bool GatewayChannelPool::addChannel(const ForwardFunction& f_forward) noexcept
+{
+    if (m_channels.size() >= MAX_CHANNELS)
+    {
+        return false;
+    }
+    Channel l_channel;
+    l_channel.m_forward = f_forward;
+    // the flag lives behind a shared_ptr since atomics are not copyable and the
+    // submitted task has to keep it alive independently of the channel vector
+    l_channel.m_inFlight = std::make_shared<std::atomic<bool>>(false);
+    m_channels.emplace_back(l_channel);
+    return true;
+}
+
+uint32_t GatewayChannelPool::trigger() noexcept
+{
+    uint32_t l_submittedCount{0u};
+    for (uint32_t index = 0u; index < m_channels.size(); ++index)
+    {
+        auto& l_channel = m_channels[index];
+        bool expected{false};
+        if (!l_channel.m_inFlight->compare_exchange_strong(expected, true))
+        {
+            // previous pass of this channel still in flight, the next trigger
+            // will pick it up; skipping keeps per-channel ordering intact
+            continue;
+        }
+
+        auto l_forward = l_channel.m_forward;
+        auto l_inFlight = l_channel.m_inFlight;
+        if (m_threadPool.submit(
+                [l_forward, l_inFlight] {
+                    l_forward();
+                    l_inFlight->store(false, std::memory_order_release);
+                },
+                index))
+        {
+            ++l_submittedCount;
+        }
+        else
+        {
+            l_channel.m_inFlight->store(false, std::memory_order_release);
+        }
+    }
+    return l_submittedCount;
+}
+
+bool GatewayChannelPool::idle() const noexcept
+{
+    for (auto& l_channel : m_channels)
+    {
+        if (l_channel.m_inFlight->load(std::memory_order_acquire))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t GatewayChannelPool::numberOfChannels() const noexcept
+{
+    return static_cast<uint32_t>(m_channels.size());
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,72 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/popo/gateway_chunk_credit.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace popo
+{
+constexpr uint32_t GatewayChunkCredit::MAX_CREDITS;
+
+GatewayChunkCredit::GatewayChunkCredit(const uint32_t f_credits, const OverflowPolicy f_policy) noexcept
+    : m_credits(std::min(f_credits, MAX_CREDITS))
+    , m_policy(f_policy)
+{
+}
+
+bool GatewayChunkCredit::hold(const mepoo::SharedChunk& f_chunk) noexcept
+{
+    if (m_heldChunks.size() >= m_credits)
+    {
+        if (OverflowPolicy::PAUSE == m_policy)
+        {
+            return false;
+        }
+        // dropping the reference returns the chunk to its mempool when the
+        // gateway was the last holder
+        m_heldChunks.erase(m_heldChunks.begin());
+        ++m_droppedChunkCount;
+    }
+    m_heldChunks.push_back(f_chunk);
+    return true;
+}
+
+bool GatewayChunkCredit::release(const mepoo::SharedChunk& f_chunk) noexcept
+{
+    for (auto it = m_heldChunks.begin(); it != m_heldChunks.end(); ++it)
+    {
+        if (*it == f_chunk)
+        {
+            m_heldChunks.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t GatewayChunkCredit::heldCount() const noexcept
+{
+    return static_cast<uint32_t>(m_heldChunks.size());
+}
+
+uint64_t GatewayChunkCredit::droppedChunkCount() const noexcept
+{
+    return m_droppedChunkCount;
+}
+
+} // namespace popo
+} // namespace iox
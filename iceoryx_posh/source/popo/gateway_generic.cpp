@@ -15,6 +15,8 @@
 #include "iceoryx_posh/popo/gateway_generic.hpp"
 
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
 namespace iox
@@ -31,5 +33,25 @@ bool GatewayGeneric::getCaProMessage(CaproMessage& msg) noexcept
     return m_interfaceImpl.getCaProMessage(msg);
 }
 
+uint32_t GatewayGeneric::getCaProMessages(CaproMessage* msgs, const uint32_t maxCount) noexcept
+{
+    return m_interfaceImpl.getCaProMessages(msgs, maxCount);
+}
+
+uint32_t GatewayGeneric::bridgeChunks(ReceiverPort& source, SenderPort& destination, const uint32_t maxCount) noexcept
+{
+    uint32_t bridgedCount{0u};
+    mepoo::SharedChunk chunk;
+    while (bridgedCount < maxCount && source.getSharedChunk(chunk))
+    {
+        // re-delivery of the shared chunk; the receivers of the destination
+        // domain take additional references on the very same chunk, the
+        // payload stays where the original sender wrote it
+        destination.forwardChunk(chunk);
+        ++bridgedCount;
+    }
+    return bridgedCount;
+}
+
 } // namespace popo
 } // namespace iox
@@ -26,14 +26,42 @@ InterfacePort::InterfacePort(InterfacePortData* const f_member)
 
 bool InterfacePort::dispatchCaProMessage(const capro::CaproMessage& f_message)
 {
-    bool returner = getMembers()->m_caproMessageFiFo.push(f_message);
+    bool returner = (getMembers()->m_caproMessageFiFo.size() < getMembers()->m_caproMessageFiFoCapacity)
+                    && getMembers()->m_caproMessageFiFo.push(f_message);
     if (!returner)
     {
+        getMembers()->m_dismissedCaproMessageCount.fetch_add(1u, std::memory_order_relaxed);
         errorHandler(Error::kPOSH__INTERFACEPORT_CAPRO_MESSAGE_DISMISSED, nullptr, iox::ErrorLevel::SEVERE);
     }
     return returner;
 }
 
+uint32_t InterfacePort::dispatchCaProMessages(const capro::CaproMessage* f_messages, const uint32_t f_count)
+{
+    const uint64_t l_fifoSize = getMembers()->m_caproMessageFiFo.size();
+    const uint64_t l_effectiveCapacity = getMembers()->m_caproMessageFiFoCapacity;
+    const uint32_t l_available =
+        (l_fifoSize < l_effectiveCapacity) ? static_cast<uint32_t>(l_effectiveCapacity - l_fifoSize) : 0u;
+    const uint32_t l_accepted =
+        getMembers()->m_caproMessageFiFo.pushBatch(f_messages, (f_count < l_available) ? f_count : l_available);
+    if (l_accepted < f_count)
+    {
+        getMembers()->m_dismissedCaproMessageCount.fetch_add(f_count - l_accepted, std::memory_order_relaxed);
+        errorHandler(Error::kPOSH__INTERFACEPORT_CAPRO_MESSAGE_DISMISSED, nullptr, iox::ErrorLevel::SEVERE);
+    }
+    return l_accepted;
+}
+
+uint32_t InterfacePort::getCaProMessages(capro::CaproMessage* f_messages, const uint32_t f_count)
+{
+    return getMembers()->m_caproMessageFiFo.popBatch(f_messages, f_count);
+}
+
+uint64_t InterfacePort::getDismissedCaProMessageCount() const
+{
+    return getMembers()->m_dismissedCaproMessageCount.load(std::memory_order_relaxed);
+}
+
 bool InterfacePort::getCaProMessage(capro::CaproMessage& f_message)
 {
     auto msg = getMembers()->m_caproMessageFiFo.pop();
@@ -20,12 +20,14 @@ namespace popo
 {
 InterfacePortData::InterfacePortData(const std::string& applicationName,
                                      const Interfaces interface,
-                                     runtime::RunnableData* const runnable) noexcept
+                                     runtime::RunnableData* const runnable,
+                                     const uint32_t caproMessageFiFoCapacity) noexcept
     : BasePortData(capro::ServiceDescription(),
                    BasePortType::INTERFACE_PORT,
                    applicationName,
                    interface,
                    runnable)
+    , m_caproMessageFiFoCapacity(caproMessageFiFoCapacity)
 {
 }
 } // namespace popo
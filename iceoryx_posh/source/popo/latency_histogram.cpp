@@ -0,0 +1,94 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/popo/latency_histogram.hpp"
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+uint32_t floorLog2(const uint64_t value)
+{
+    return (value == 0u) ? 0u : (63u - static_cast<uint32_t>(__builtin_clzll(value)));
+}
+} // namespace
+
+constexpr uint32_t LatencyHistogram::NUMBER_OF_BUCKETS;
+
+LatencyHistogram::LatencyHistogram() noexcept
+    : m_totalCount(0u)
+    , m_maxNs(0u)
+{
+    for (auto& count : m_counts)
+    {
+        count.store(0u, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::record(const uint64_t f_latencyNs) noexcept
+{
+    m_counts[floorLog2(f_latencyNs)].fetch_add(1u, std::memory_order_relaxed);
+    m_totalCount.fetch_add(1u, std::memory_order_relaxed);
+
+    auto currentMax = m_maxNs.load(std::memory_order_relaxed);
+    while (f_latencyNs > currentMax
+           && !m_maxNs.compare_exchange_weak(currentMax, f_latencyNs, std::memory_order_relaxed))
+    {
+    }
+}
+
+uint64_t LatencyHistogram::percentile(const double f_percentile) const noexcept
+{
+    const uint64_t total = m_totalCount.load(std::memory_order_relaxed);
+    if (total == 0u)
+    {
+        return 0u;
+    }
+
+    uint64_t targetCount = static_cast<uint64_t>(static_cast<double>(total) * f_percentile / 100.);
+    if (targetCount == 0u)
+    {
+        targetCount = 1u;
+    }
+
+    const uint64_t max = m_maxNs.load(std::memory_order_relaxed);
+    uint64_t cumulativeCount{0u};
+    for (uint32_t i = 0u; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        cumulativeCount += m_counts[i].load(std::memory_order_relaxed);
+        if (cumulativeCount >= targetCount)
+        {
+            // upper edge of bucket i, the maximum is tracked exactly
+            const uint64_t upperEdge = (i >= 63u) ? max : ((1ull << (i + 1u)) - 1u);
+            return (upperEdge < max) ? upperEdge : max;
+        }
+    }
+
+    return max;
+}
+
+uint64_t LatencyHistogram::totalCount() const noexcept
+{
+    return m_totalCount.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::maxNs() const noexcept
+{
+    return m_maxNs.load(std::memory_order_relaxed);
+}
+
+} // namespace popo
+} // namespace iox
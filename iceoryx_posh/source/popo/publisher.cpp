@@ -35,6 +35,12 @@ const void* Publisher::getLastChunk() const noexcept
     return nullptr;
 }
 
+void* Publisher::loanPreviousChunk() noexcept
+{
+    auto chunkHeader = m_sender.loanPreviousChunk();
+    return (chunkHeader != nullptr) ? chunkHeader->payload() : nullptr;
+}
+
 mepoo::ChunkHeader* Publisher::allocateChunkWithHeader(uint32_t payloadSize, bool useDynamicPayloadSizes) noexcept
 {
     return m_sender.reserveChunk(payloadSize, useDynamicPayloadSizes);
@@ -46,11 +52,27 @@ void* Publisher::allocateChunk(uint32_t payloadSize, bool useDynamicPayloadSizes
     return chunkHeader->payload();
 }
 
+void* Publisher::allocateFixedSizeChunk(uint32_t payloadSize) noexcept
+{
+    auto chunkHeader = m_sender.reserveChunkFixedSize(payloadSize);
+    return (chunkHeader != nullptr) ? chunkHeader->payload() : nullptr;
+}
+
+bool Publisher::chainChunks(mepoo::ChunkHeader* const chunkHeader, mepoo::ChunkHeader* const nextChunkHeader) noexcept
+{
+    return m_sender.chainChunks(chunkHeader, nextChunkHeader);
+}
+
 void Publisher::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_sender.deliverChunk(chunkHeader);
 }
 
+void Publisher::sendChunks(mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t count) noexcept
+{
+    m_sender.deliverChunks(chunkHeaders, count);
+}
+
 void Publisher::sendChunk(const void* const payload) noexcept
 {
     auto chunkHeader = iox::mepoo::convertPayloadPointerToChunkHeader(const_cast<void* const>(payload));
@@ -68,6 +90,11 @@ void Publisher::freeChunk(void* const payload) noexcept
     m_sender.freeChunk(chunkHeader);
 }
 
+void Publisher::warmup(const uint32_t payloadSize) noexcept
+{
+    m_sender.warmup(payloadSize);
+}
+
 void Publisher::offer() noexcept
 {
     m_sender.activate();
@@ -83,9 +110,24 @@ bool Publisher::hasSubscribers() noexcept
     return m_sender.hasSubscribers();
 }
 
-void Publisher::enableDoDeliverOnSubscription() noexcept
+void Publisher::enableDoDeliverOnSubscription(const uint32_t f_historyCapacity) noexcept
+{
+    m_sender.enableDoDeliverOnSubscription(f_historyCapacity);
+}
+
+void Publisher::setThroughputTrackingEnabled(const bool enabled) noexcept
+{
+    m_sender.setThroughputTrackingEnabled(enabled);
+}
+
+void Publisher::setConcurrentDeliveryEnabled(const bool enabled) noexcept
+{
+    m_sender.setConcurrentDeliveryEnabled(enabled);
+}
+
+void Publisher::setIntegrityModeEnabled(const bool enabled) noexcept
 {
-    m_sender.enableDoDeliverOnSubscription();
+    m_sender.setIntegrityModeEnabled(enabled);
 }
 
 } // namespace popo
@@ -13,15 +13,80 @@
 // limitations under the License.
 
 #include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/mepoo/timestamp_source.hpp"
+#include "iceoryx_utils/cxx/crc32c.hpp"
 #include "iceoryx_utils/cxx/helplets.hpp"
 #include "iceoryx_utils/error_handling/error_handling.hpp"
+#include "iceoryx_utils/trace/tracepoint.hpp"
 
-#include "cassert"
+#include "ac3log/simplelogger.hpp"
+
+#include <algorithm>
+#include <cassert>
 
 namespace iox
 {
 namespace popo
 {
+namespace
+{
+/// transition of the receiver side CaPro protocol for one (message type,
+/// subscription state) pair
+struct CaproTransition
+{
+    SubscribeState m_nextState;
+    bool m_changesState;
+    bool m_respondsWithSub;
+};
+
+/// the subscription protocol compiled to a table: dispatch indexes it with the
+/// integer message type and subscription state instead of running through the
+/// branch chains for every discovery event on every port; entries not listed
+/// in the constructor leave the state untouched and respond with nothing
+struct SubscriptionTransitionTable
+{
+    static constexpr uint32_t MESSAGE_TYPES{static_cast<uint32_t>(capro::CaproMessageType::MESSGAGE_TYPE_END)};
+    static constexpr uint32_t SUBSCRIBE_STATES{static_cast<uint32_t>(SubscribeState::WAIT_FOR_OFFER) + 1u};
+
+    SubscriptionTransitionTable()
+    {
+        set(capro::CaproMessageType::OFFER, SubscribeState::WAIT_FOR_OFFER, SubscribeState::SUBSCRIBE_REQUESTED, true);
+        set(capro::CaproMessageType::STOP_OFFER, SubscribeState::SUBSCRIBED, SubscribeState::WAIT_FOR_OFFER, false);
+        set(capro::CaproMessageType::ACK, SubscribeState::SUBSCRIBE_REQUESTED, SubscribeState::SUBSCRIBED, false);
+        set(capro::CaproMessageType::ACK,
+            SubscribeState::UNSUBSCRIBE_REQUESTED,
+            SubscribeState::NOT_SUBSCRIBED,
+            false);
+        set(capro::CaproMessageType::NACK, SubscribeState::SUBSCRIBE_REQUESTED, SubscribeState::WAIT_FOR_OFFER, false);
+        set(capro::CaproMessageType::NACK,
+            SubscribeState::UNSUBSCRIBE_REQUESTED,
+            SubscribeState::NOT_SUBSCRIBED,
+            false);
+    }
+
+    const CaproTransition& lookup(const capro::CaproMessageType f_type, const SubscribeState f_state) const
+    {
+        return m_entries[static_cast<uint32_t>(f_type)][static_cast<uint32_t>(f_state)];
+    }
+
+  private:
+    void set(const capro::CaproMessageType f_type,
+             const SubscribeState f_state,
+             const SubscribeState f_nextState,
+             const bool f_respondsWithSub)
+    {
+        auto& l_entry = m_entries[static_cast<uint32_t>(f_type)][static_cast<uint32_t>(f_state)];
+        l_entry.m_nextState = f_nextState;
+        l_entry.m_changesState = true;
+        l_entry.m_respondsWithSub = f_respondsWithSub;
+    }
+
+    CaproTransition m_entries[MESSAGE_TYPES][SUBSCRIBE_STATES]{};
+};
+
+const SubscriptionTransitionTable s_subscriptionTransitions;
+} // namespace
+
 // BEGIN REGION_ROUDI // /* access from RouDi------------------------------------
 
 ReceiverPort::ReceiverPort(ReceiverPortData* f_member)
@@ -67,66 +132,31 @@ cxx::optional<capro::CaproMessage> ReceiverPort::getCaProMessage()
     }
 }
 
-cxx::optional<capro::CaproMessage> ReceiverPort::dispatchCaProMessage(capro::CaproMessage f_caProMessage)
+cxx::optional<capro::CaproMessage> ReceiverPort::dispatchCaProMessage(const capro::CaproMessage& f_caProMessage)
 {
     const auto l_currentSubscribeState = getMembers()->m_subscriptionState.load(std::memory_order_relaxed);
 
-    if ((capro::CaproMessageType::OFFER == f_caProMessage.m_type)
-        && (SubscribeState::WAIT_FOR_OFFER == l_currentSubscribeState))
+    // table driven: one lookup decides the state change and the response; a
+    // (message, state) pair outside the protocol is a no-op like before. The
+    // string bearing response message is only built for the single transition
+    // which answers with a SUB
+    const CaproTransition& l_transition = s_subscriptionTransitions.lookup(f_caProMessage.m_type,
+                                                                           l_currentSubscribeState);
+
+    if (l_transition.m_changesState)
     {
-        getMembers()->m_subscriptionState.store(SubscribeState::SUBSCRIBE_REQUESTED, std::memory_order_relaxed);
+        getMembers()->m_subscriptionState.store(l_transition.m_nextState, std::memory_order_relaxed);
+    }
 
+    if (l_transition.m_respondsWithSub)
+    {
         capro::CaproMessage l_caproMessage(capro::CaproMessageType::SUB, BasePort::getMembers()->m_serviceDescription);
         l_caproMessage.m_requestPort = this->getMembers();
 
         return cxx::make_optional<capro::CaproMessage>(l_caproMessage);
     }
-    else if ((capro::CaproMessageType::STOP_OFFER == f_caProMessage.m_type)
-             && (SubscribeState::SUBSCRIBED == l_currentSubscribeState))
-    {
-        getMembers()->m_subscriptionState.store(SubscribeState::WAIT_FOR_OFFER, std::memory_order_relaxed);
-
-        return cxx::nullopt_t();
-    }
-    else if (capro::CaproMessageType::ACK == f_caProMessage.m_type)
-    {
-        if (SubscribeState::SUBSCRIBE_REQUESTED == l_currentSubscribeState)
-        {
-            getMembers()->m_subscriptionState.store(SubscribeState::SUBSCRIBED, std::memory_order_relaxed);
-        }
-        else if (SubscribeState::UNSUBSCRIBE_REQUESTED == l_currentSubscribeState)
-        {
-            getMembers()->m_subscriptionState.store(SubscribeState::NOT_SUBSCRIBED, std::memory_order_relaxed);
-        }
-        else
-        {
-            // error wrong protocol
-        }
 
-        return cxx::nullopt_t();
-    }
-    else if (capro::CaproMessageType::NACK == f_caProMessage.m_type)
-    {
-        if (SubscribeState::SUBSCRIBE_REQUESTED == l_currentSubscribeState)
-        {
-            getMembers()->m_subscriptionState.store(SubscribeState::WAIT_FOR_OFFER, std::memory_order_relaxed);
-        }
-        else if (SubscribeState::UNSUBSCRIBE_REQUESTED == l_currentSubscribeState)
-        {
-            getMembers()->m_subscriptionState.store(SubscribeState::NOT_SUBSCRIBED, std::memory_order_relaxed);
-        }
-        else
-        {
-            // error wrong protocol
-        }
-
-        return cxx::nullopt_t();
-    }
-    else
-    {
-        // error wrong protocol
-        return cxx::nullopt_t();
-    }
+    return cxx::nullopt_t();
 }
 
 // tidy up as good as possible
@@ -141,6 +171,7 @@ void ReceiverPort::cleanup() noexcept
 
     // release all the chunks currently held by the no more present user process
     getMembers()->m_deliveredChunkList.cleanup();
+    getMembers()->m_heldChunkCount.store(0u, std::memory_order_relaxed);
 }
 // END REGION__ROUDI
 
@@ -151,6 +182,54 @@ void ReceiverPort::subscribe(const bool f_autoResubscribe, const uint32_t f_deli
     subscribe(f_deliverySize);
 }
 
+void ReceiverPort::subscribeWithDeadline(const uint64_t f_deadlineNs, const uint32_t f_deliverySize)
+{
+    getMembers()->m_deadlineMissCount.store(0u, std::memory_order_relaxed);
+    getMembers()->m_deadlineNs.store(f_deadlineNs, std::memory_order_relaxed);
+    subscribe(f_deliverySize);
+}
+
+void ReceiverPort::subscribeWithChunkBudget(const uint32_t f_chunkBudget, const uint32_t f_deliverySize)
+{
+    getMembers()->m_creditSkipCount.store(0u, std::memory_order_relaxed);
+    getMembers()->m_chunkBudget.store(f_chunkBudget, std::memory_order_relaxed);
+    subscribe(f_deliverySize);
+}
+
+uint32_t ReceiverPort::getChunkBudget() const
+{
+    return getMembers()->m_chunkBudget.load(std::memory_order_relaxed);
+}
+
+uint64_t ReceiverPort::getCreditSkipCount() const
+{
+    return getMembers()->m_creditSkipCount.load(std::memory_order_relaxed);
+}
+
+bool ReceiverPort::hasDeliveryCredit() const
+{
+    const uint32_t l_budget = getMembers()->m_chunkBudget.load(std::memory_order_relaxed);
+    if (0u == l_budget)
+    {
+        return true;
+    }
+    // in flight are the chunks still waiting in the delivery FiFo plus the ones
+    // the application fetched but did not release yet
+    const uint64_t l_inFlight =
+        getMembers()->m_deliveryFiFo.getSize() + getMembers()->m_heldChunkCount.load(std::memory_order_relaxed);
+    return l_inFlight < l_budget;
+}
+
+uint64_t ReceiverPort::getDeadlineNs() const
+{
+    return getMembers()->m_deadlineNs.load(std::memory_order_relaxed);
+}
+
+uint64_t ReceiverPort::getDeadlineMissCount() const
+{
+    return getMembers()->m_deadlineMissCount.load(std::memory_order_relaxed);
+}
+
 void ReceiverPort::subscribe(const uint32_t f_deliverySize)
 {
     if (!getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
@@ -166,6 +245,13 @@ void ReceiverPort::subscribe(const uint32_t f_deliverySize)
         getMembers()->m_deliveryFiFo.resize(f_deliverySize);
 
         getMembers()->m_subscribeRequested.store(true, std::memory_order_relaxed);
+
+        // wake the RouDi discovery loop so the subscription is processed right
+        // away instead of on the next polling cycle
+        if (getMembers()->m_discoverySignal != nullptr)
+        {
+            getMembers()->m_discoverySignal->post();
+        }
     }
 }
 
@@ -174,9 +260,69 @@ void ReceiverPort::unsubscribe()
     if (getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_subscribeRequested.store(false, std::memory_order_relaxed);
+
+        if (getMembers()->m_discoverySignal != nullptr)
+        {
+            getMembers()->m_discoverySignal->post();
+        }
     }
 }
 
+void ReceiverPort::setChunkFilter(const uint16_t f_mask, const uint16_t f_value)
+{
+    getMembers()->m_filterMask.store(f_mask, std::memory_order_relaxed);
+    getMembers()->m_filterValue.store(f_value, std::memory_order_relaxed);
+    // the release store makes mask and value visible to a sender that observes the
+    // filter as active
+    getMembers()->m_filterActive.store(true, std::memory_order_release);
+}
+
+void ReceiverPort::clearChunkFilter()
+{
+    getMembers()->m_filterActive.store(false, std::memory_order_relaxed);
+}
+
+void ReceiverPort::setIntegrityCheckEnabled(const bool f_enabled)
+{
+    getMembers()->m_verifyIntegrity.store(f_enabled, std::memory_order_relaxed);
+}
+
+void ReceiverPort::declareSingleWriter()
+{
+    getMembers()->m_deliveredChunkList.declareSingleWriter();
+}
+
+bool ReceiverPort::verifyIntegrity(const mepoo::ChunkHeader* const f_chunkHeader) const noexcept
+{
+#ifndef IOX_COMPACT_CHUNK_HEADER
+    if (!(f_chunkHeader->m_integrityFlags & mepoo::ChunkHeader::INTEGRITY_CRC_PRESENT))
+    {
+        // the sender does not stamp checksums, nothing to verify
+        return true;
+    }
+    return cxx::crc32c(f_chunkHeader->payload(), f_chunkHeader->m_info.m_payloadSize) == f_chunkHeader->m_payloadCrc;
+#else
+    // the compact chunk header carries no checksum
+    static_cast<void>(f_chunkHeader);
+    return true;
+#endif
+}
+
+bool ReceiverPort::hasChunkFilter() const
+{
+    return getMembers()->m_filterActive.load(std::memory_order_relaxed);
+}
+
+bool ReceiverPort::wantsChunk(const mepoo::ChunkInfo& f_chunkInfo) const
+{
+    if (!getMembers()->m_filterActive.load(std::memory_order_acquire))
+    {
+        return true;
+    }
+    return (f_chunkInfo.m_filterTag & getMembers()->m_filterMask.load(std::memory_order_relaxed))
+           == getMembers()->m_filterValue.load(std::memory_order_relaxed);
+}
+
 bool ReceiverPort::isSubscribed() const
 {
     const auto l_currentSubscribeState = getMembers()->m_subscriptionState.load(std::memory_order_relaxed);
@@ -190,15 +336,34 @@ SubscribeState ReceiverPort::getSubscribeState() const
 }
 
 bool ReceiverPort::getChunk(const mepoo::ChunkHeader*& f_chunkHeader) noexcept
+{
+    ChunkSlotHandle l_slotHandle{MemberType_t::DELIVERED_LIST_SIZE};
+    return getChunk(f_chunkHeader, l_slotHandle);
+}
+
+bool ReceiverPort::getChunk(const mepoo::ChunkHeader*& f_chunkHeader, ChunkSlotHandle& f_slotHandle) noexcept
 {
     mepoo::SharedChunk l_chunk;
 
     if (getMembers()->m_deliveryFiFo.pop(l_chunk))
     {
+        if (getMembers()->m_verifyIntegrity.load(std::memory_order_relaxed)
+            && !verifyIntegrity(l_chunk.getChunkHeader()))
+        {
+            // drop the corrupted chunk, l_chunk releases it on scope exit
+            ERR_PRINTF("Payload checksum mismatch, dropping corrupted chunk\n");
+            return false;
+        }
         // store the chunk that is provided to the user side
-        if (getMembers()->m_deliveredChunkList.insert(l_chunk))
+        if (getMembers()->m_deliveredChunkList.insert(l_chunk, f_slotHandle))
         {
+            getMembers()->m_heldChunkCount.fetch_add(1u, std::memory_order_relaxed);
             f_chunkHeader = l_chunk.getChunkHeader();
+            IOX_TRACEPOINT1(receiver_get_chunk, f_chunkHeader);
+            if (getMembers()->m_latencyTrackingActive.load(std::memory_order_relaxed))
+            {
+                recordLatency(f_chunkHeader);
+            }
             return true;
         }
         else
@@ -233,6 +398,7 @@ bool ReceiverPort::releaseChunk(const mepoo::ChunkHeader* f_chunkHeader)
 
     if (getMembers()->m_deliveredChunkList.remove(f_chunkHeader, l_chunk))
     {
+        getMembers()->m_heldChunkCount.fetch_sub(1u, std::memory_order_relaxed);
         return true;
     }
     else
@@ -242,6 +408,21 @@ bool ReceiverPort::releaseChunk(const mepoo::ChunkHeader* f_chunkHeader)
     }
 }
 
+bool ReceiverPort::releaseChunk(const mepoo::ChunkHeader* f_chunkHeader, const ChunkSlotHandle f_slotHandle)
+{
+    mepoo::SharedChunk l_chunk(nullptr);
+
+    if (getMembers()->m_deliveredChunkList.removeAt(f_slotHandle, f_chunkHeader, l_chunk))
+    {
+        getMembers()->m_heldChunkCount.fetch_sub(1u, std::memory_order_relaxed);
+        return true;
+    }
+
+    // a stale handle does not match the slot content anymore, fall back to the
+    // linear search instead of rejecting a valid chunk
+    return releaseChunk(f_chunkHeader);
+}
+
 void ReceiverPort::clearDeliveryFiFo()
 {
     mepoo::SharedChunk l_crap{nullptr};
@@ -250,6 +431,17 @@ void ReceiverPort::clearDeliveryFiFo()
     }
 }
 
+void ReceiverPort::warmup()
+{
+    // the delivery FiFo and the delivered chunk list are inline members of the
+    // port data, one read per cache line walks all of them
+    volatile const uint8_t* l_portData = reinterpret_cast<volatile const uint8_t*>(getMembers());
+    for (size_t i = 0u; i < sizeof(MemberType_t); i += 64u)
+    {
+        static_cast<void>(l_portData[i]);
+    }
+}
+
 /* expects an initialized POSIX semaphore, stored in shared memory! */
 void ReceiverPort::SetCallbackReferences(posix::Semaphore* f_callbackSemaphore,
                                          std::atomic<ChunksCounterType>*) noexcept
@@ -260,6 +452,8 @@ void ReceiverPort::SetCallbackReferences(posix::Semaphore* f_callbackSemaphore,
     assert((getMembers()->m_chunkSendCallbackActive.load(std::memory_order_relaxed) == false)
            && "SetCallbackReferences: callback semaphore already set - please Unset first.");
     getMembers()->m_chunkSendSemaphore = f_callbackSemaphore;
+    // a stale pending flag from a previous registration would swallow the first post
+    getMembers()->m_notificationPending.store(false, std::memory_order_relaxed);
     getMembers()->m_chunkSendCallbackActive.store(true, std::memory_order_release);
 }
 
@@ -268,7 +462,30 @@ void ReceiverPort::UnsetCallbackReferences() noexcept
     std::lock_guard<mutex_t> g(*getMembers()->m_chunkSendCallbackMutex);
 
     getMembers()->m_chunkSendCallbackActive.store(false, std::memory_order_release);
+    getMembers()->m_chunkSendFutexActive.store(false, std::memory_order_release);
     getMembers()->m_chunkSendSemaphore = nullptr;
+    getMembers()->m_notificationPending.store(false, std::memory_order_relaxed);
+}
+
+void ReceiverPort::clearPendingNotification() noexcept
+{
+    getMembers()->m_notificationPending.store(false, std::memory_order_release);
+}
+
+void ReceiverPort::SetFutexCallbackReference() noexcept
+{
+    std::lock_guard<mutex_t> g(*getMembers()->m_chunkSendCallbackMutex);
+
+    assert((getMembers()->m_chunkSendCallbackActive.load(std::memory_order_relaxed) == false)
+           && "SetFutexCallbackReference: callback semaphore already set - please Unset first.");
+    getMembers()->m_chunkSendFutexActive.store(true, std::memory_order_release);
+    getMembers()->m_chunkSendCallbackActive.store(true, std::memory_order_release);
+}
+
+// the futex word stored in shared memory, to wait on with the futex backend
+posix::FutexSignal* ReceiverPort::GetShmFutexSignal()
+{
+    return &getMembers()->m_shmFutexSignal;
 }
 
 bool ReceiverPort::AreCallbackReferencesSet()
@@ -316,19 +533,202 @@ bool ReceiverPort::deliver(mepoo::SharedChunk f_chunk_p) noexcept
         return false;
     }
 
+    // credit based flow control (opt-in): a port which already has its whole
+    // chunk budget in flight is skipped and the skip is counted; the chunk
+    // reference claimed for this receiver is dropped on return
+    if (!hasDeliveryCredit())
+    {
+        getMembers()->m_creditSkipCount.fetch_add(1u, std::memory_order_relaxed);
+        return false;
+    }
+
+    // feed the deadline tracking from the timestamp the sender already wrote
+    // into the chunk info, one relaxed store when the deadline QoS is active
+    if (getMembers()->m_deadlineNs.load(std::memory_order_relaxed) != 0u)
+    {
+        auto l_timestampNs =
+            static_cast<uint64_t>(f_chunk_p.getChunkHeader()->m_info.m_txTimestamp.time_since_epoch().count());
+        if (l_timestampNs == 0u
+            || f_chunk_p.getChunkHeader()->m_info.m_txTimestampSource != mepoo::TimestampSource::MONOTONIC)
+        {
+            // sender without throughput tracking does not stamp the chunk, and
+            // the deadline monitor of RouDi compares against the monotonic
+            // clock, so stamps of another source cannot be used for it
+            l_timestampNs = static_cast<uint64_t>(mepoo::BaseClock::now().time_since_epoch().count());
+        }
+        getMembers()->m_lastDeliveryTimestampNs.store(l_timestampNs, std::memory_order_relaxed);
+    }
+
     mepoo::SharedChunk l_chunk{nullptr};
 
+    IOX_TRACEPOINT1(receiver_fifo_push, f_chunk_p.getChunkHeader());
     getMembers()->m_deliveryFiFo.push(std::move(f_chunk_p), l_chunk);
 
     // check for registered event callback handler - trigger if existing
     // note that we also call in the overflow case of a push above
+    notifyChunkSendCallback();
+
+    return true;
+}
+
+bool ReceiverPort::deliverInline(const void* const f_payload, const uint32_t f_size) noexcept
+{
+    if (SubscribeState::SUBSCRIBED == getMembers()->m_subscriptionState.load(std::memory_order_relaxed))
+    {
+        // most common case, continue with the delivery below
+    }
+    else if (getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
+    {
+        // same subscribe race as in deliver, see the description there
+        getMembers()->m_subscriptionState.store(SubscribeState::SUBSCRIBED, std::memory_order_relaxed);
+    }
+    else
+    {
+        // state was neither SUBSCRIPTION_REQUESTED nor SUBSCRIBED, do nothing
+        return false;
+    }
+
+    // inline samples pin no mempool chunks and the FiFo bounds them by itself,
+    // the credit based flow control therefore does not apply here
+
+    if (getMembers()->m_deadlineNs.load(std::memory_order_relaxed) != 0u)
+    {
+        // inline samples carry no tx timestamp, feed the deadline tracking
+        // with the delivery time
+        getMembers()->m_lastDeliveryTimestampNs.store(
+            static_cast<uint64_t>(mepoo::BaseClock::now().time_since_epoch().count()), std::memory_order_relaxed);
+    }
+
+    mepoo::SharedChunk l_chunk{nullptr};
+    getMembers()->m_deliveryFiFo.pushInline(f_payload, f_size, l_chunk);
+
+    notifyChunkSendCallback();
+
+    return true;
+}
+
+bool ReceiverPort::getInlineSample(void* const f_payload, uint32_t& f_size) noexcept
+{
+    return getMembers()->m_deliveryFiFo.popInline(f_payload, f_size);
+}
+
+void ReceiverPort::notifyChunkSendCallback() noexcept
+{
     if (getMembers()->m_chunkSendCallbackActive.load(std::memory_order_acquire))
     {
-        if (getMembers()->m_chunkSendSemaphore != nullptr)
+        if (getMembers()->m_chunkSendFutexActive.load(std::memory_order_acquire))
+        {
+            IOX_TRACEPOINT(receiver_wakeup);
+            getMembers()->m_shmFutexSignal.post();
+        }
+        else if (getMembers()->m_chunkSendSemaphore != nullptr)
         {
-            getMembers()->m_chunkSendSemaphore->post();
+            // coalesce the wakeups: a pending post covers all chunks delivered
+            // until the receiver clears the flag, so a burst costs one post
+            if (!getMembers()->m_notificationPending.exchange(true, std::memory_order_acq_rel))
+            {
+                IOX_TRACEPOINT(receiver_wakeup);
+                getMembers()->m_chunkSendSemaphore->post();
+            }
         }
     }
+}
+
+uint32_t ReceiverPort::getChunks(const mepoo::ChunkHeader** f_chunkHeaders, const uint32_t f_maxCount) noexcept
+{
+    uint32_t l_total{0u};
+    // drain in slices to bound the stack usage
+    constexpr uint32_t SliceCapacity{32u};
+    mepoo::SharedChunk l_chunks[SliceCapacity];
+
+    while (l_total < f_maxCount)
+    {
+        uint32_t l_sliceSize = std::min(SliceCapacity, f_maxCount - l_total);
+        uint32_t l_popped = getMembers()->m_deliveryFiFo.popBatch(l_chunks, l_sliceSize);
+        if (l_popped == 0u)
+        {
+            break;
+        }
+
+        // the headers have to be taken before the delivered chunk list consumes the chunks
+        const bool l_latencyTracking = getMembers()->m_latencyTrackingActive.load(std::memory_order_relaxed);
+        const bool l_verifyIntegrity = getMembers()->m_verifyIntegrity.load(std::memory_order_relaxed);
+        uint32_t l_kept{0u};
+        for (uint32_t i = 0u; i < l_popped; ++i)
+        {
+            if (l_verifyIntegrity && !verifyIntegrity(l_chunks[i].getChunkHeader()))
+            {
+                // drop the corrupted chunk and compact the slice
+                ERR_PRINTF("Payload checksum mismatch, dropping corrupted chunk\n");
+                l_chunks[i] = nullptr;
+                continue;
+            }
+            if (l_kept != i)
+            {
+                l_chunks[l_kept] = l_chunks[i];
+                l_chunks[i] = nullptr;
+            }
+            f_chunkHeaders[l_total + l_kept] = l_chunks[l_kept].getChunkHeader();
+            if (l_latencyTracking)
+            {
+                recordLatency(f_chunkHeaders[l_total + l_kept]);
+            }
+            ++l_kept;
+        }
+
+        uint32_t l_inserted = getMembers()->m_deliveredChunkList.insertBatch(l_chunks, l_kept);
+        getMembers()->m_heldChunkCount.fetch_add(l_inserted, std::memory_order_relaxed);
+        l_total += l_inserted;
+        if (l_inserted < l_kept)
+        {
+            // release the chunks which could not be registered
+            for (uint32_t i = l_inserted; i < l_kept; ++i)
+            {
+                l_chunks[i] = nullptr;
+            }
+            assert(false && "deliveredChunkList overflow");
+            break;
+        }
+
+        if (l_popped < l_sliceSize)
+        {
+            break;
+        }
+    }
+
+    return l_total;
+}
+
+bool ReceiverPort::deliverBatch(mepoo::SharedChunk* f_chunks, const uint32_t f_count) noexcept
+{
+    if (SubscribeState::SUBSCRIBED == getMembers()->m_subscriptionState.load(std::memory_order_relaxed))
+    {
+        // most common case, continue with the delivery below
+    }
+    else if (getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
+    {
+        // same subscribe race as in deliver, see the description there
+        getMembers()->m_subscriptionState.store(SubscribeState::SUBSCRIBED, std::memory_order_relaxed);
+    }
+    else
+    {
+        // state was neither SUBSCRIPTION_REQUESTED nor SUBSCRIBED, do nothing
+        return false;
+    }
+
+    // the credit is evaluated once for the whole batch, with flow control
+    // active a batch may overshoot the budget by at most the batch size
+    if (!hasDeliveryCredit())
+    {
+        getMembers()->m_creditSkipCount.fetch_add(f_count, std::memory_order_relaxed);
+        return false;
+    }
+
+    // a single write index publication for the whole batch
+    getMembers()->m_deliveryFiFo.pushBatch(f_chunks, f_count);
+
+    // a single wakeup for the whole batch, the callback has to drain the delivery FiFo
+    notifyChunkSendCallback();
 
     return true;
 }
@@ -343,6 +743,56 @@ uint64_t ReceiverPort::getDeliveryFiFoSize() const
     return getMembers()->m_deliveryFiFo.getSize();
 }
 
+void ReceiverPort::setOverflowPolicy(const DeliveryFiFo::OverflowPolicy f_policy, const uint32_t f_timeoutMs)
+{
+    getMembers()->m_deliveryFiFo.setOverflowPolicy(f_policy, f_timeoutMs);
+}
+
+uint64_t ReceiverPort::getDropCount() const
+{
+    return getMembers()->m_deliveryFiFo.getDropCount();
+}
+
+uint64_t ReceiverPort::getLastDroppedSequenceNumber() const
+{
+    return getMembers()->m_deliveryFiFo.getLastDroppedSequenceNumber();
+}
+
+uint64_t ReceiverPort::getDeliveryFiFoIndexConflicts() const
+{
+    return getMembers()->m_deliveryFiFo.getIndexConflicts();
+}
+
+void ReceiverPort::setLatencyTrackingEnabled(const bool f_enable)
+{
+    getMembers()->m_latencyTrackingActive.store(f_enable, std::memory_order_relaxed);
+}
+
+const LatencyHistogram& ReceiverPort::getLatencyHistogram() const
+{
+    return getMembers()->m_latencyHistogram;
+}
+
+void ReceiverPort::recordLatency(const mepoo::ChunkHeader* f_chunkHeader) noexcept
+{
+    // the tx timestamp is only written when the sender has throughput tracking
+    // enabled, chunks without a timestamp are skipped
+    if (f_chunkHeader->m_info.m_txTimestamp.time_since_epoch().count() == 0)
+    {
+        return;
+    }
+
+    // read "now" from the source the sender stamped with, so the diff is taken
+    // on one clock; with the TSC source the recorded unit is cycles instead of
+    // nanoseconds
+    auto latency =
+        mepoo::readTimestamp(f_chunkHeader->m_info.m_txTimestampSource) - f_chunkHeader->m_info.m_txTimestamp;
+    if (latency.count() > 0)
+    {
+        getMembers()->m_latencyHistogram.record(static_cast<uint64_t>(latency.count()));
+    }
+}
+
 const ReceiverPort::MemberType_t* ReceiverPort::getMembers() const
 {
     return reinterpret_cast<const MemberType_t*>(BasePort::getMembers());
@@ -13,11 +13,15 @@
 // limitations under the License.
 
 #include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_posh/mepoo/timestamp_source.hpp"
+#include "iceoryx_utils/cxx/crc32c.hpp"
 #include "iceoryx_utils/cxx/helplets.hpp"
 #include "iceoryx_utils/error_handling/error_handling.hpp"
+#include "iceoryx_utils/trace/tracepoint.hpp"
 
 #include "ac3log/simplelogger.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 
@@ -69,7 +73,7 @@ cxx::optional<capro::CaproMessage> SenderPort::getCaProMessage()
     }
 }
 
-cxx::optional<capro::CaproMessage> SenderPort::dispatchCaProMessage(capro::CaproMessage caProMessage)
+cxx::optional<capro::CaproMessage> SenderPort::dispatchCaProMessage(const capro::CaproMessage& caProMessage)
 {
     capro::CaproMessage l_responseMessage(capro::CaproMessageType::NACK,
                                           this->getMembers()->m_serviceDescription,
@@ -108,6 +112,10 @@ void SenderPort::cleanup()
     // remove all chunks currently allocated by the application
     clearAllocatedChunkContainer();
     getMembers()->m_lastChunk = nullptr;
+    for (auto& stashedChunk : getMembers()->m_recycleStash)
+    {
+        stashedChunk = nullptr;
+    }
 }
 
 void SenderPort::setThroughput(const uint32_t payloadSize)
@@ -118,12 +126,42 @@ void SenderPort::setThroughput(const uint32_t payloadSize)
 }
 
 mepoo::ChunkHeader* SenderPort::reserveChunk(const uint32_t payloadSize, bool useDynamicPayloadSizes)
+{
+    return reserveChunkInternal(payloadSize, useDynamicPayloadSizes, NO_RESOLVED_POOL);
+}
+
+constexpr uint32_t SenderPort::NO_RESOLVED_POOL;
+
+mepoo::ChunkHeader* SenderPort::reserveChunkFixedSize(const uint32_t payloadSize)
 {
     if (!getMembers()->m_memoryMgr)
     {
         ERR_PRINTF("There is no shared memory available to allocate from! Terminating!");
         exit(EXIT_FAILURE);
     }
+
+    if (m_fixedSizePoolIndex == NO_RESOLVED_POOL)
+    {
+        // the pool layout is runtime configuration, so the serving pool is looked
+        // up once on the first reservation and reused for every further sample
+        m_fixedSizePoolIndex = getMembers()->m_memoryMgr->getMemPoolIndexForPayloadSize(payloadSize);
+    }
+
+    return reserveChunkInternal(payloadSize, false, m_fixedSizePoolIndex);
+}
+
+mepoo::ChunkHeader* SenderPort::reserveChunkInternal(const uint32_t payloadSize,
+                                                     const bool useDynamicPayloadSizes,
+                                                     const uint32_t resolvedPoolIndex)
+{
+    if (!getMembers()->m_memoryMgr)
+    {
+        ERR_PRINTF("There is no shared memory available to allocate from! Terminating!");
+        exit(EXIT_FAILURE);
+    }
+
+    recordChunkStatistics(payloadSize);
+
     /// @todo The chunk size should be set in the constructor
     /// this needs to be done in the upcoming refactoring
     auto activePayloadSize = getMembers()->m_activePayloadSize.load(std::memory_order_relaxed);
@@ -136,14 +174,29 @@ mepoo::ChunkHeader* SenderPort::reserveChunk(const uint32_t payloadSize, bool us
         errorHandler(Error::kPOSH__SENDERPORT_SAMPLE_SIZE_CHANGED_FOR_ACTIVE_PORT);
     }
 
+    // the last chunk and the recycle stash are maintained by a single producer
+    // only, with concurrent publishers every thread goes straight to the
+    // lock-free mempool
+    const bool l_concurrent = getMembers()->m_concurrentDelivery.load(std::memory_order_relaxed);
+
+    if (!m_chunkAccountingResolved)
+    {
+        // claimed once; reused and recycled chunks keep the attribution of
+        // their original acquisition
+        m_chunkAccounting = getMembers()->m_memoryMgr->fetchPortAccounting(getUniqueID());
+        m_chunkAccountingResolved = true;
+    }
+
     // if it is no field and we have a last chunk which is only owned by us, then use this chunk again
-    if (!getMembers()->m_receiverHandler.doesDeliverOnSubscribe() && getMembers()->m_lastChunk
+    if (!l_concurrent && !getMembers()->m_receiverHandler.doesDeliverOnSubscribe() && getMembers()->m_lastChunk
         && getMembers()->m_lastChunk.hasNoOtherOwners()
         && getMembers()->m_lastChunk.getChunkHeader()->m_info.m_usedSizeOfChunk
                >= getMembers()->m_memoryMgr->sizeWithChunkHeaderStruct(payloadSize))
     {
         if (pushToAllocatedChunkContainer(getMembers()->m_lastChunk))
         {
+            // a reused chunk may still carry the chain link of a composite sample
+            releaseChunkChain(getMembers()->m_lastChunk.getChunkHeader());
             getMembers()->m_lastChunk.getChunkHeader()->m_info.m_payloadSize = payloadSize;
             getMembers()->m_lastChunk.getChunkHeader()->m_info.m_usedSizeOfChunk =
                 getMembers()->m_memoryMgr->sizeWithChunkHeaderStruct(payloadSize);
@@ -157,8 +210,33 @@ mepoo::ChunkHeader* SenderPort::reserveChunk(const uint32_t payloadSize, bool us
     }
     else
     {
-        // get a new chunk
-        mepoo::SharedChunk l_chunk = getMembers()->m_memoryMgr->getChunk(payloadSize);
+        // check the recycle stash for a cache-hot chunk before going to the mempool
+        mepoo::SharedChunk l_chunk(nullptr);
+        if (!l_concurrent && !getMembers()->m_receiverHandler.doesDeliverOnSubscribe()
+            && popFromRecycleStash(payloadSize, l_chunk))
+        {
+            // a recycled chunk may still carry the chain link of a composite sample
+            releaseChunkChain(l_chunk.getChunkHeader());
+            l_chunk.getChunkHeader()->m_info.m_usedSizeOfChunk =
+                getMembers()->m_memoryMgr->sizeWithChunkHeaderStruct(payloadSize);
+        }
+        else if (resolvedPoolIndex != NO_RESOLVED_POOL)
+        {
+            // fixed size path: the serving pool was already resolved, no per
+            // sample pool search
+            l_chunk = getMembers()->m_memoryMgr->getChunkFromPool(
+                resolvedPoolIndex, payloadSize, &getMembers()->m_chunkQuota, m_chunkAccounting);
+        }
+        else
+        {
+            // get a new chunk; topics flagged as dynamic are served from the buddy mempool
+            // when one is configured, which avoids rounding up to the next fixed chunk size
+            l_chunk =
+                (useDynamicPayloadSizes && getMembers()->m_memoryMgr->hasDynamicMemPool())
+                    ? getMembers()->m_memoryMgr->getDynamicChunk(
+                          payloadSize, &getMembers()->m_chunkQuota, m_chunkAccounting)
+                    : getMembers()->m_memoryMgr->getChunk(payloadSize, &getMembers()->m_chunkQuota, m_chunkAccounting);
+        }
 
         if (l_chunk)
         {
@@ -194,21 +272,177 @@ mepoo::ChunkHeader* SenderPort::reserveChunk(const uint32_t payloadSize, bool us
     }
 }
 
+bool SenderPort::chainChunks(mepoo::ChunkHeader* const chunkHeader, mepoo::ChunkHeader* const nextChunkHeader)
+{
+#ifdef IOX_COMPACT_CHUNK_HEADER
+    (void)chunkHeader;
+    (void)nextChunkHeader;
+    return false;
+#else
+    if (chunkHeader == nullptr || nextChunkHeader == nullptr || chunkHeader->hasNextChunk())
+    {
+        return false;
+    }
+
+    mepoo::SharedChunk l_nextChunk(nullptr);
+    if (!popFromAllocatedChunkContainer(nextChunkHeader, l_nextChunk))
+    {
+        return false;
+    }
+
+    // the chain takes over the reference held so far by the allocated chunk
+    // container, it is released again when the head chunk is freed
+    auto l_chunkManagement = l_nextChunk.releaseWithRelativePtr();
+    chunkHeader->m_nextChunkSegmentId = l_chunkManagement.getId();
+    chunkHeader->m_nextChunkOffset = l_chunkManagement.getOffset();
+    return true;
+#endif
+}
+
+void SenderPort::releaseChunkChain(mepoo::ChunkHeader* const chunkHeader)
+{
+#ifndef IOX_COMPACT_CHUNK_HEADER
+    if (chunkHeader->hasNextChunk())
+    {
+        // drop the chain reference before the chunk is reused for a new sample,
+        // the temporary releases the rest of the chain
+        mepoo::SharedChunk l_nextChunk(iox::relative_ptr<mepoo::ChunkManagement>(chunkHeader->m_nextChunkOffset,
+                                                                                chunkHeader->m_nextChunkSegmentId));
+        chunkHeader->m_nextChunkSegmentId = RelativePointer::NULL_POINTER_ID;
+        chunkHeader->m_nextChunkOffset = RelativePointer::NULL_POINTER_OFFSET;
+    }
+#else
+    (void)chunkHeader;
+#endif
+}
+
+mepoo::ChunkHeader* SenderPort::loanPreviousChunk()
+{
+    // fields keep their last chunk for late subscribers, handing it out writable
+    // would change the sample they receive
+    if (!getMembers()->m_receiverHandler.doesDeliverOnSubscribe() && getMembers()->m_lastChunk
+        && getMembers()->m_lastChunk.hasNoOtherOwners())
+    {
+        if (pushToAllocatedChunkContainer(getMembers()->m_lastChunk))
+        {
+            // in contrast to the reuse path in reserveChunk the payload size and the
+            // content are kept, the caller wants to update the sample in place
+            return getMembers()->m_lastChunk.getChunkHeader();
+        }
+        else
+        {
+            assert(false && "Application allocates too much chunks");
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+void SenderPort::setThroughputTrackingEnabled(const bool enabled)
+{
+    getMembers()->m_throughputTracking.store(enabled, std::memory_order_relaxed);
+}
+
+void SenderPort::setConcurrentDeliveryEnabled(const bool enabled)
+{
+    getMembers()->m_concurrentDelivery.store(enabled, std::memory_order_release);
+}
+
+void SenderPort::declareSingleWriter()
+{
+    if (getMembers()->m_concurrentDelivery.load(std::memory_order_relaxed))
+    {
+        // contradicting declarations, keep the thread safe path
+        return;
+    }
+    getMembers()->m_allocatedChunksList.declareSingleWriter();
+}
+
+void SenderPort::setRealTimePublishModeEnabled(const bool enabled)
+{
+    if (enabled && getMembers()->m_concurrentDelivery.load(std::memory_order_relaxed))
+    {
+        // contradicting configuration, keep the thread safe path
+        return;
+    }
+    m_realTimePublishMode = enabled;
+    if (enabled)
+    {
+        syncReceiverSnapshot();
+    }
+    else
+    {
+        m_pinnedReceivers.clear();
+    }
+}
+
+void SenderPort::syncReceiverSnapshot()
+{
+    m_pinnedReceivers = getMembers()->m_receiverHandler.copyReceiverList();
+}
+
+void SenderPort::setTimestampSource(const mepoo::TimestampSource source)
+{
+    getMembers()->m_timestampSource.store(source, std::memory_order_relaxed);
+}
+
+mepoo::TimestampSource SenderPort::getTimestampSource() const
+{
+    return getMembers()->m_timestampSource.load(std::memory_order_relaxed);
+}
+
+void SenderPort::setIntegrityModeEnabled(const bool enabled)
+{
+#ifndef IOX_COMPACT_CHUNK_HEADER
+    getMembers()->m_integrityMode.store(enabled, std::memory_order_relaxed);
+#else
+    // the compact chunk header has no room for the checksum
+    static_cast<void>(enabled);
+#endif
+}
+
+void SenderPort::stampIntegrityChecksum(mepoo::ChunkHeader* const chunkHeader)
+{
+#ifndef IOX_COMPACT_CHUNK_HEADER
+    chunkHeader->m_payloadCrc = cxx::crc32c(chunkHeader->payload(), chunkHeader->m_info.m_payloadSize);
+    chunkHeader->m_integrityFlags |= mepoo::ChunkHeader::INTEGRITY_CRC_PRESENT;
+#else
+    static_cast<void>(chunkHeader);
+#endif
+}
+
 void SenderPort::setThroughputDeliveryData(mepoo::ChunkInfo& chunkInfo, bool updateTimeInChunk)
 {
+    if (!getMembers()->m_throughputTracking.load(std::memory_order_relaxed))
+    {
+        return;
+    }
     getMembers()->m_throughput.lastDeliveryTimestamp = getMembers()->m_throughput.currentDeliveryTimestamp;
     getMembers()->m_throughput.currentDeliveryTimestamp = mepoo::BaseClock::now();
     if (updateTimeInChunk)
     {
-        chunkInfo.m_txTimestamp = getMembers()->m_throughput.currentDeliveryTimestamp;
+        const auto l_source = getMembers()->m_timestampSource.load(std::memory_order_relaxed);
+        // the default source reuses the clock read of the throughput bookkeeping
+        chunkInfo.m_txTimestamp = (l_source == mepoo::TimestampSource::MONOTONIC)
+                                      ? getMembers()->m_throughput.currentDeliveryTimestamp
+                                      : mepoo::readTimestamp(l_source);
+        chunkInfo.m_txTimestampSource = l_source;
     }
 
     getMembers()->m_throughput.sequenceNumber = getMembers()->m_sequenceNumber;
-    getMembers()->m_throughputExchange.store(getMembers()->m_throughput, MemberType_t::ThreadContext::Application);
+
+    // seqlock publish: two counter bumps and a plain copy, the send path never
+    // blocks on a concurrent introspection read
+    auto sequence = getMembers()->m_monitoring.m_throughputSequence.load(std::memory_order_relaxed);
+    getMembers()->m_monitoring.m_throughputSequence.store(sequence + 1u, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    getMembers()->m_monitoring.m_throughputPublished = getMembers()->m_throughput;
+    getMembers()->m_monitoring.m_throughputSequence.store(sequence + 2u, std::memory_order_release);
 }
 
 void SenderPort::deliverChunk(mepoo::ChunkHeader* const chunkHeader)
 {
+    IOX_TRACEPOINT1(sender_deliver_chunk, chunkHeader);
     bool l_isOffered = getMembers()->m_activateRequested.load(std::memory_order_relaxed);
     bool l_isField = getMembers()->m_receiverHandler.doesDeliverOnSubscribe();
 
@@ -224,6 +458,17 @@ void SenderPort::deliverChunk(mepoo::ChunkHeader* const chunkHeader)
     {
         // we have to process this chunk
 
+        // with concurrent publishers the sequencing, throughput bookkeeping and
+        // the fan-out have to be serialized, the delivery FiFos of the receivers
+        // are single producer
+        const bool l_serialize = getMembers()->m_concurrentDelivery.load(std::memory_order_relaxed);
+        if (l_serialize)
+        {
+            while (getMembers()->m_deliveryLock.test_and_set(std::memory_order_acquire))
+            {
+            }
+        }
+
         // get chunk from allocated List
         mepoo::SharedChunk l_chunk(nullptr);
 
@@ -240,6 +485,10 @@ void SenderPort::deliverChunk(mepoo::ChunkHeader* const chunkHeader)
                 getMembers()->m_sequenceNumber++; // for Introspection, else nobody updates.
             }
             setThroughputDeliveryData(chunkInfo);
+            if (getMembers()->m_integrityMode.load(std::memory_order_relaxed))
+            {
+                stampIntegrityChecksum(l_chunk.getChunkHeader());
+            }
         }
         else
         {
@@ -248,9 +497,28 @@ void SenderPort::deliverChunk(mepoo::ChunkHeader* const chunkHeader)
 
         if (l_isOffered && !l_isField)
         {
-            // deliver the chunk and store the last chunk for recycling if it is free on next reserveChunk
-            getMembers()->m_receiverHandler.appContext().deliverChunk(l_chunk);
-            getMembers()->m_lastChunk = l_chunk;
+            // deliver the chunk and store the last chunk for recycling if it is free on next reserveChunk;
+            // the previous last chunk moves to the recycle stash where it can still be
+            // reused once the receivers have released it
+            if (m_realTimePublishMode)
+            {
+                // bounded fan-out to the pinned snapshot, see setRealTimePublishModeEnabled
+                getMembers()->m_receiverHandler.appContext().deliverChunkToSnapshot(m_pinnedReceivers, l_chunk);
+            }
+            else
+            {
+                getMembers()->m_receiverHandler.appContext().deliverChunk(l_chunk);
+            }
+            if (!l_serialize)
+            {
+                // the recycling members are not consulted by concurrent reserves,
+                // keeping chunks stashed there would only pin them
+                if (getMembers()->m_lastChunk != l_chunk)
+                {
+                    pushToRecycleStash(getMembers()->m_lastChunk);
+                }
+                getMembers()->m_lastChunk = l_chunk;
+            }
         }
         else if (l_isOffered && l_isField)
         {
@@ -263,6 +531,127 @@ void SenderPort::deliverChunk(mepoo::ChunkHeader* const chunkHeader)
             // a not offered field so we have to update the last chunk in the receiver handler
             getMembers()->m_receiverHandler.appContext().updateLastChunk(l_chunk);
         }
+
+        if (l_serialize)
+        {
+            getMembers()->m_deliveryLock.clear(std::memory_order_release);
+        }
+    }
+}
+
+bool SenderPort::deliverInline(const void* const payload, const uint32_t size)
+{
+    if (size == 0u || size > DeliveryFiFo::ChunkManagementTransport::INLINE_PAYLOAD_CAPACITY)
+    {
+        return false;
+    }
+    if (!getMembers()->m_activateRequested.load(std::memory_order_relaxed))
+    {
+        // inline delivery has no chunk to keep for a field history, a not
+        // offered port simply drops the sample
+        return false;
+    }
+
+    // the sequencing and the fan-out have to be serialized with concurrent
+    // publishers, like in deliverChunk
+    const bool l_serialize = getMembers()->m_concurrentDelivery.load(std::memory_order_relaxed);
+    if (l_serialize)
+    {
+        while (getMembers()->m_deliveryLock.test_and_set(std::memory_order_acquire))
+        {
+        }
+    }
+
+    // counted so the introspection still sees the samples of inline topics
+    getMembers()->m_sequenceNumber++;
+
+    getMembers()->m_receiverHandler.appContext().deliverInline(payload, size);
+
+    if (l_serialize)
+    {
+        getMembers()->m_deliveryLock.clear(std::memory_order_release);
+    }
+    return true;
+}
+
+void SenderPort::deliverChunks(mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t count)
+{
+    bool l_isOffered = getMembers()->m_activateRequested.load(std::memory_order_relaxed);
+    bool l_isField = getMembers()->m_receiverHandler.doesDeliverOnSubscribe();
+
+    if (!l_isOffered || l_isField)
+    {
+        // the not offered and the field cases do not profit from batching
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            deliverChunk(chunkHeaders[i]);
+        }
+        return;
+    }
+
+    // with concurrent publishers the whole batch is serialized, see deliverChunk
+    const bool l_serialize = getMembers()->m_concurrentDelivery.load(std::memory_order_relaxed);
+    if (l_serialize)
+    {
+        while (getMembers()->m_deliveryLock.test_and_set(std::memory_order_acquire))
+        {
+        }
+    }
+
+    const bool l_integrityMode = getMembers()->m_integrityMode.load(std::memory_order_relaxed);
+
+    // process the batch in slices to bound the stack usage
+    constexpr uint32_t SliceCapacity{32u};
+    for (uint32_t offset = 0u; offset < count; offset += SliceCapacity)
+    {
+        mepoo::SharedChunk l_chunks[SliceCapacity];
+        uint32_t l_sliceSize = std::min(SliceCapacity, count - offset);
+
+        for (uint32_t i = 0u; i < l_sliceSize; ++i)
+        {
+            if (popFromAllocatedChunkContainer(chunkHeaders[offset + i], l_chunks[i]))
+            {
+                auto& chunkInfo = l_chunks[i].getChunkHeader()->m_info;
+                if (!chunkInfo.m_externalSequenceNumber_bl)
+                {
+                    chunkInfo.m_sequenceNumber = getMembers()->m_sequenceNumber;
+                    getMembers()->m_sequenceNumber++;
+                }
+                else
+                {
+                    getMembers()->m_sequenceNumber++; // for Introspection, else nobody updates.
+                }
+                setThroughputDeliveryData(chunkInfo);
+                if (l_integrityMode)
+                {
+                    stampIntegrityChecksum(l_chunks[i].getChunkHeader());
+                }
+            }
+            else
+            {
+                assert(false && "Application provided invalid chunk pointer to deliver");
+            }
+        }
+
+        getMembers()->m_receiverHandler.appContext().deliverChunks(l_chunks, l_sliceSize);
+
+        // same recycling bookkeeping as for a single delivery, chunk by chunk
+        if (!l_serialize)
+        {
+            for (uint32_t i = 0u; i < l_sliceSize; ++i)
+            {
+                if (getMembers()->m_lastChunk != l_chunks[i])
+                {
+                    pushToRecycleStash(getMembers()->m_lastChunk);
+                }
+                getMembers()->m_lastChunk = l_chunks[i];
+            }
+        }
+    }
+
+    if (l_serialize)
+    {
+        getMembers()->m_deliveryLock.clear(std::memory_order_release);
     }
 }
 
@@ -274,6 +663,58 @@ void SenderPort::freeChunk(mepoo::ChunkHeader* const chunkHeader)
     }
 }
 
+void SenderPort::warmup(const uint32_t payloadSize)
+{
+    if (!getMembers()->m_memoryMgr)
+    {
+        return;
+    }
+
+    // touch the port data once so the first real reservation does not pay the
+    // page faults and cache misses of the bookkeeping
+    volatile const uint8_t* l_portData = reinterpret_cast<volatile const uint8_t*>(getMembers());
+    for (size_t i = 0u; i < sizeof(MemberType_t); i += 64u)
+    {
+        static_cast<void>(l_portData[i]);
+    }
+
+    if (!m_chunkAccountingResolved)
+    {
+        m_chunkAccounting = getMembers()->m_memoryMgr->fetchPortAccounting(getUniqueID());
+        m_chunkAccountingResolved = true;
+    }
+
+    // the full allocation window is drawn from the mempool and handed back
+    // right away; this initializes the free list and used chunk list entries
+    // the real samples will run over. MemoryManager::getChunk is used directly
+    // since a pool that cannot serve the whole window is no error here
+    mepoo::ChunkHeader* l_chunkHeaders[MAX_SAMPLE_ALLOCATE_PER_SENDER];
+    uint32_t l_acquired{0u};
+    for (uint32_t i = 0u; i < MAX_SAMPLE_ALLOCATE_PER_SENDER; ++i)
+    {
+        auto l_chunk = getMembers()->m_memoryMgr->getChunk(payloadSize, &getMembers()->m_chunkQuota, m_chunkAccounting);
+        if (!l_chunk || !pushToAllocatedChunkContainer(l_chunk))
+        {
+            break;
+        }
+
+        // fault in the payload pages, they are written to by the application
+        // before delivery anyway
+        uint8_t* l_payload = reinterpret_cast<uint8_t*>(l_chunk.getChunkHeader()->payload());
+        for (uint32_t offset = 0u; offset < payloadSize; offset += 4096u)
+        {
+            l_payload[offset] = 0u;
+        }
+
+        l_chunkHeaders[l_acquired++] = l_chunk.getChunkHeader();
+    }
+
+    for (uint32_t i = 0u; i < l_acquired; ++i)
+    {
+        freeChunk(l_chunkHeaders[i]);
+    }
+}
+
 void SenderPort::activate()
 {
     if (!getMembers()->m_activateRequested.load(std::memory_order_relaxed))
@@ -285,6 +726,13 @@ void SenderPort::activate()
         {
             errorHandler(Error::kPOSH__SENDERPORT_ACTIVATE_FIELD_WITHOUT_DATA);
         }
+
+        // wake the RouDi discovery loop so the offer is processed right away
+        // instead of on the next polling cycle
+        if (getMembers()->m_discoverySignal != nullptr)
+        {
+            getMembers()->m_discoverySignal->post();
+        }
     }
 }
 
@@ -295,6 +743,11 @@ void SenderPort::deactivate()
         this->getMembers()->m_activateRequested.store(false, std::memory_order_relaxed);
 
         getMembers()->m_activePayloadSize.store(0, std::memory_order_relaxed);
+
+        if (getMembers()->m_discoverySignal != nullptr)
+        {
+            getMembers()->m_discoverySignal->post();
+        }
     }
 }
 
@@ -315,12 +768,68 @@ void SenderPort::forwardChunk(mepoo::SharedChunk chunk)
     getMembers()->m_receiverHandler.appContext().deliverChunk(chunk);
 }
 
+void SenderPort::recordChunkStatistics(const uint32_t payloadSize)
+{
+    // bucket i counts the requests with a payload size of at most 2^i bytes,
+    // the last bucket takes everything larger
+    uint32_t l_bucket{0u};
+    while (l_bucket < CHUNK_SIZE_HISTOGRAM_BUCKETS - 1u && (1u << l_bucket) < payloadSize)
+    {
+        l_bucket++;
+    }
+    getMembers()->m_monitoring.m_requestedPayloadHistogram[l_bucket].fetch_add(1u, std::memory_order_relaxed);
+    getMembers()->m_monitoring.m_requestedPayloadBytes.fetch_add(payloadSize, std::memory_order_relaxed);
+    getMembers()->m_monitoring.m_grantedChunkBytes.fetch_add(
+        getMembers()->m_memoryMgr->getMempoolChunkSizeForPayloadSize(payloadSize), std::memory_order_relaxed);
+}
+
+SenderPort::MemberType_t::ChunkSizeStatistics SenderPort::getChunkSizeStatistics() const
+{
+    MemberType_t::ChunkSizeStatistics l_statistics;
+    for (uint32_t i = 0u; i < CHUNK_SIZE_HISTOGRAM_BUCKETS; ++i)
+    {
+        l_statistics.m_requestedPayloadHistogram[i] =
+            getMembers()->m_monitoring.m_requestedPayloadHistogram[i].load(std::memory_order_relaxed);
+    }
+    l_statistics.m_requestedPayloadBytes = getMembers()->m_monitoring.m_requestedPayloadBytes.load(std::memory_order_relaxed);
+    l_statistics.m_grantedChunkBytes = getMembers()->m_monitoring.m_grantedChunkBytes.load(std::memory_order_relaxed);
+    return l_statistics;
+}
+
+void SenderPort::setChunkQuotaLimit(const uint32_t limit)
+{
+    getMembers()->m_chunkQuota.m_limit = limit;
+}
+
+SenderPort::MemberType_t::ChunkQuotaStatistics SenderPort::getChunkQuotaStatistics() const
+{
+    MemberType_t::ChunkQuotaStatistics l_statistics;
+    l_statistics.m_limit = getMembers()->m_chunkQuota.m_limit;
+    l_statistics.m_usedChunks = getMembers()->m_chunkQuota.m_usedChunks.load(std::memory_order_relaxed);
+    l_statistics.m_deniedRequests = getMembers()->m_chunkQuota.m_deniedRequests.load(std::memory_order_relaxed);
+    return l_statistics;
+}
+
 SenderPort::MemberType_t::Throughput SenderPort::getThroughput() const
 {
-    auto updatedValue = getMembers()->m_throughputExchange.take(MemberType_t::ThreadContext::RouDi);
-    if (updatedValue.has_value())
+    // seqlock read: retry while a publish is in flight (odd sequence) or happened
+    // during the copy; the retry loop is bounded so a sender publishing in a tight
+    // loop cannot starve the introspection, which then reports the last stable value
+    constexpr uint32_t MaxReadAttempts{10u};
+    for (uint32_t attempt = 0u; attempt < MaxReadAttempts; ++attempt)
     {
-        getMembers()->m_throughputReadCache = updatedValue.value();
+        auto sequenceBefore = getMembers()->m_monitoring.m_throughputSequence.load(std::memory_order_acquire);
+        if ((sequenceBefore & 1u) != 0u)
+        {
+            continue;
+        }
+        MemberType_t::Throughput snapshot = getMembers()->m_monitoring.m_throughputPublished;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (getMembers()->m_monitoring.m_throughputSequence.load(std::memory_order_relaxed) == sequenceBefore)
+        {
+            getMembers()->m_throughputReadCache = snapshot;
+            break;
+        }
     }
     return getMembers()->m_throughputReadCache;
 }
@@ -342,9 +851,9 @@ void SenderPort::disconnectAllReceiver()
     getMembers()->m_receiverHandler.roudiContext().removeAll();
 }
 
-void SenderPort::enableDoDeliverOnSubscription()
+void SenderPort::enableDoDeliverOnSubscription(const uint32_t f_historyCapacity)
 {
-    getMembers()->m_receiverHandler.appContext().enableDoDeliverOnSubscription();
+    getMembers()->m_receiverHandler.appContext().enableDoDeliverOnSubscription(f_historyCapacity);
 }
 
 bool SenderPort::doesDeliverOnSubscribe() const
@@ -388,6 +897,37 @@ void SenderPort::clearAllocatedChunkContainer()
     getMembers()->m_allocatedChunksList.cleanup();
 }
 
+void SenderPort::pushToRecycleStash(mepoo::SharedChunk chunk)
+{
+    if (!chunk)
+    {
+        return;
+    }
+
+    // overwrite the oldest entry, its chunk then goes back to the mempool free-list
+    // if nobody else holds it
+    auto& members = *getMembers();
+    members.m_recycleStash[members.m_recycleStashInsertPosition] = chunk;
+    members.m_recycleStashInsertPosition =
+        (members.m_recycleStashInsertPosition + 1u) % MemberType_t::RECYCLE_STASH_SIZE;
+}
+
+bool SenderPort::popFromRecycleStash(const uint32_t payloadSize, mepoo::SharedChunk& chunk)
+{
+    auto neededSizeOfChunk = getMembers()->m_memoryMgr->sizeWithChunkHeaderStruct(payloadSize);
+    for (auto& stashedChunk : getMembers()->m_recycleStash)
+    {
+        if (stashedChunk && stashedChunk.hasNoOtherOwners()
+            && stashedChunk.getChunkHeader()->m_info.m_usedSizeOfChunk >= neededSizeOfChunk)
+        {
+            chunk = stashedChunk;
+            stashedChunk = nullptr;
+            return true;
+        }
+    }
+    return false;
+}
+
 uint32_t SenderPort::getMaxDeliveryFiFoCapacity()
 {
     return getMembers()->m_receiverHandler.getMaxDeliveryFiFoCapacity();
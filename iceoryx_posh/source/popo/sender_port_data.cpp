@@ -23,6 +23,7 @@ SenderPortData::SenderPortData(mepoo::MemoryManager* const f_memoryMgr, mepoo::S
     , m_memoryMgr(f_memoryMgr)
     , m_lastChunk(f_lastChunk)
 {
+    m_allocatedChunksList.setCapacity(MAX_SAMPLE_ALLOCATE_PER_SENDER);
 }
 SenderPortData::SenderPortData(const capro::ServiceDescription& serviceDescription,
                                mepoo::MemoryManager* const memMgr,
@@ -32,6 +33,7 @@ SenderPortData::SenderPortData(const capro::ServiceDescription& serviceDescripti
     : BasePortData(serviceDescription, BasePortType::SENDER_PORT, applicationName, interface, runnable)
     , m_memoryMgr(memMgr)
 {
+    m_allocatedChunksList.setCapacity(MAX_SAMPLE_ALLOCATE_PER_SENDER);
 }
 
 } // namespace popo
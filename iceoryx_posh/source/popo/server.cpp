@@ -0,0 +1,101 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/popo/server.hpp"
+
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+/// pending requests over all clients; bounds the request delivery FiFo
+constexpr uint32_t REQUEST_QUEUE_SIZE{64u};
+} // namespace
+
+Server::Server(const capro::ServiceDescription& service, const cxx::CString100& runnableName) noexcept
+    : m_requestReceiver(
+        runtime::PoshRuntime::getInstance().getMiddlewareReceiver(service, Interfaces::INTERNAL, runnableName))
+    , m_responseSender(runtime::PoshRuntime::getInstance().getMiddlewareSender(
+          responseService(service), Interfaces::INTERNAL, runnableName))
+{
+    connect();
+}
+
+Server::Server(ReceiverPortType&& requestReceiver, SenderPortType&& responseSender) noexcept
+    : m_requestReceiver(std::move(requestReceiver))
+    , m_responseSender(std::move(responseSender))
+{
+    connect();
+}
+
+Server::~Server() noexcept
+{
+    m_requestReceiver.unsubscribe();
+    m_responseSender.deactivate();
+}
+
+void Server::connect() noexcept
+{
+    m_requestReceiver.subscribe(true, REQUEST_QUEUE_SIZE);
+    m_responseSender.activate();
+}
+
+bool Server::hasRequests() noexcept
+{
+    return m_requestReceiver.newData();
+}
+
+bool Server::getRequest(const void** payload, RequestContext& context) noexcept
+{
+    const mepoo::ChunkHeader* chunkHeader = nullptr;
+    if (m_requestReceiver.getChunk(chunkHeader))
+    {
+        *payload = chunkHeader->payload();
+        context.m_correlationId = chunkHeader->correlationId();
+        context.m_clientTag = chunkHeader->m_info.m_filterTag;
+        return true;
+    }
+    *payload = nullptr;
+    return false;
+}
+
+bool Server::releaseRequest(const void* const payload) noexcept
+{
+    auto chunkHeader = mepoo::convertPayloadPointerToChunkHeader(const_cast<void* const>(payload));
+    return m_requestReceiver.releaseChunk(chunkHeader);
+}
+
+void* Server::allocateResponse(const uint32_t payloadSize) noexcept
+{
+    auto chunkHeader = m_responseSender.reserveChunk(payloadSize);
+    return chunkHeader->payload();
+}
+
+void Server::sendResponse(void* const payload, const RequestContext& context) noexcept
+{
+    auto chunkHeader = mepoo::convertPayloadPointerToChunkHeader(payload);
+
+    chunkHeader->setCorrelationId(context.m_correlationId);
+    // the client subscribed its response receiver with a chunk filter on its
+    // tag, only its delivery FiFo sees this chunk
+    chunkHeader->m_info.m_filterTag = context.m_clientTag;
+
+    m_responseSender.deliverChunk(chunkHeader);
+}
+
+} // namespace popo
+} // namespace iox
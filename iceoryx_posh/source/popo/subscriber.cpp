@@ -14,12 +14,15 @@
 
 #include "iceoryx_posh/popo/subscriber.hpp"
 
+#include "iceoryx_posh/popo/chunk_receive_dispatcher.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/timespec.hpp"
 
 #include "ac3log/simplelogger.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 
 namespace iox
 {
@@ -35,6 +38,11 @@ Subscriber::Subscriber(const capro::ServiceDescription& service, const cxx::CStr
 {
 }
 
+Subscriber::Subscriber(ReceiverPortType::MemberType_t* const receiverPortData) noexcept
+    : m_receiver(receiverPortData)
+{
+}
+
 Subscriber::~Subscriber() noexcept
 {
     unsetReceiveHandler();
@@ -42,6 +50,11 @@ Subscriber::~Subscriber() noexcept
     //          is called in the dtor. You cannot expect the user to call it before destruction
 }
 
+void Subscriber::warmup() noexcept
+{
+    m_receiver.warmup();
+}
+
 void Subscriber::subscribe(const uint32_t cacheSize) noexcept
 {
     m_subscribeDemand = true;
@@ -81,22 +94,46 @@ void Subscriber::unsubscribe() noexcept
     m_subscribeDemand = false;
 }
 
-void Subscriber::setReceiveHandler(ReceiveHandler_t cbHandler) noexcept
+void Subscriber::setChunkFilter(const uint16_t filterMask, const uint16_t filterValue) noexcept
+{
+    m_receiver.setChunkFilter(filterMask, filterValue);
+}
+
+void Subscriber::clearChunkFilter() noexcept
+{
+    m_receiver.clearChunkFilter();
+}
+
+void Subscriber::setIntegrityCheckEnabled(const bool enabled) noexcept
+{
+    m_receiver.setIntegrityCheckEnabled(enabled);
+}
+
+void Subscriber::setReceiveHandler(ReceiveHandler_t cbHandler, const ReceiveNotification notification) noexcept
 {
     // no need to guard this assignment since the thread accessing the cb
     // handler will be created later
     assert(m_callbackHandler == nullptr && "SetReceiveHandler: callback handler already set - please Unset first.");
     m_callbackHandler = cbHandler;
 
-    // (re-)init thread & semaphore
-    m_callbackSemaphore = m_receiver.GetShmSemaphore();
-    if (!m_callbackSemaphore)
+    if (notification == ReceiveNotification::FUTEX)
     {
-        m_callbackHandler = nullptr;
-        WARN_PRINTF("shared memory semaphore could not be initialized!\n");
-        return;
+        // (re-)init thread & futex word
+        m_callbackFutexSignal = m_receiver.GetShmFutexSignal();
+        m_receiver.SetFutexCallbackReference();
+    }
+    else
+    {
+        // (re-)init thread & semaphore
+        m_callbackSemaphore = m_receiver.GetShmSemaphore();
+        if (!m_callbackSemaphore)
+        {
+            m_callbackHandler = nullptr;
+            WARN_PRINTF("shared memory semaphore could not be initialized!\n");
+            return;
+        }
+        m_receiver.SetCallbackReferences(m_callbackSemaphore);
     }
-    m_receiver.SetCallbackReferences(m_callbackSemaphore);
 
     m_callbackRunFlag = true;
     m_callbackThread = std::thread(&Subscriber::eventCallbackMain, this);
@@ -109,6 +146,11 @@ void Subscriber::setReceiveHandler(ReceiveHandler_t cbHandler) noexcept
     pthread_setname_np(thread_handle, threadname); // thread name restricted to 16 chars
 // (incl. '0') but name buffer needs to be at least 16 chars
 #endif // __unix__
+    // the process wide attributes can pin the callback thread to the data
+    // path cores or raise it to SCHED_FIFO; a name set there overrides the
+    // generated one
+    posix::applyThreadAttributes(m_callbackThread.native_handle(),
+                                 runtime::PoshRuntime::getCallbackThreadAttributes());
     m_callbackThreadPresent = true;
 }
 
@@ -117,7 +159,12 @@ void Subscriber::unsetReceiveHandler() noexcept
     // stop callback thread
     m_callbackRunFlag = false;
 
-    if (m_callbackSemaphore)
+    if (m_callbackFutexSignal)
+    {
+        m_callbackFutexSignal->post();
+        m_receiver.UnsetCallbackReferences();
+    }
+    else if (m_callbackSemaphore)
     {
         m_callbackSemaphore->post();
         m_receiver.UnsetCallbackReferences();
@@ -131,9 +178,31 @@ void Subscriber::unsetReceiveHandler() noexcept
     // no need to guard this assignment since the thread accessing the cb
     // handler has been joined already
     m_callbackHandler = nullptr;
+    m_callbackFutexSignal = nullptr;
     m_callbackThreadPresent = false;
 }
 
+bool Subscriber::attachReceiveHandler(ChunkReceiveDispatcher& dispatcher, ReceiveHandler_t handler) noexcept
+{
+    assert(m_callbackHandler == nullptr && "AttachReceiveHandler: callback handler already set - please Unset first.");
+    return dispatcher.attach(m_receiver, handler);
+}
+
+void Subscriber::detachReceiveHandler(ChunkReceiveDispatcher& dispatcher) noexcept
+{
+    dispatcher.detach(m_receiver);
+}
+
+bool Subscriber::setSharedReceiveHandler(ReceiveHandler_t handler) noexcept
+{
+    return attachReceiveHandler(runtime::PoshRuntime::getEventDispatcher(), handler);
+}
+
+void Subscriber::unsetSharedReceiveHandler() noexcept
+{
+    detachReceiveHandler(runtime::PoshRuntime::getEventDispatcher());
+}
+
 void Subscriber::overrideCallbackReference(const Subscriber& receiverWithRererenceToUse) noexcept
 {
     const auto semaphore = receiverWithRererenceToUse.m_receiver.GetShmSemaphore();
@@ -141,15 +210,101 @@ void Subscriber::overrideCallbackReference(const Subscriber& receiverWithRereren
     m_receiver.SetCallbackReferences(semaphore);
 }
 
+void Subscriber::setWaitPolicy(const WaitPolicy waitPolicy) noexcept
+{
+    m_waitPolicy = waitPolicy;
+}
+
 bool Subscriber::waitForChunk(const uint32_t timeoutMs) noexcept
 {
+    if (m_waitPolicy == WaitPolicy::BLOCKING)
+    {
+        // the sender coalesces the notifications, a single post may cover a whole
+        // burst; drain the delivery FiFo without a syscall before parking again
+        if (hasNewChunks())
+        {
+            return true;
+        }
+
+        const auto semaphore = m_receiver.GetShmSemaphore();
+        assert(semaphore != nullptr && "WaitForChunk: semaphore is not set");
+
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts = posix::addTimeMs(ts, timeoutMs);
+        if (semaphore->timedWait(&ts, true))
+        {
+            m_receiver.clearPendingNotification();
+            return true;
+        }
+        return hasNewChunks();
+    }
+
+    // the polling policies watch the delivery FiFo directly and skip the
+    // sem_post/sem_wait syscall pair on the wakeup path
+    using namespace std::chrono;
+    constexpr uint32_t SpinPhaseUs{100u};
+    constexpr uint32_t YieldPhaseUs{1000u};
+
+    const auto entry = steady_clock::now();
+    const auto deadline = entry + milliseconds(timeoutMs);
+
+    const auto spinDeadline =
+        (m_waitPolicy == WaitPolicy::BUSY_SPIN) ? deadline : std::min(deadline, entry + microseconds(SpinPhaseUs));
+    while (steady_clock::now() < spinDeadline)
+    {
+        if (hasNewChunks())
+        {
+            return true;
+        }
+    }
+
+    if (m_waitPolicy == WaitPolicy::BUSY_SPIN)
+    {
+        return hasNewChunks();
+    }
+
+    const auto yieldDeadline = (m_waitPolicy == WaitPolicy::SPIN_THEN_YIELD)
+                                   ? deadline
+                                   : std::min(deadline, entry + microseconds(YieldPhaseUs));
+    while (steady_clock::now() < yieldDeadline)
+    {
+        if (hasNewChunks())
+        {
+            return true;
+        }
+        std::this_thread::yield();
+    }
+
+    if (m_waitPolicy == WaitPolicy::SPIN_THEN_YIELD)
+    {
+        return hasNewChunks();
+    }
+
+    // adaptive: no data showed up while polling, park on the semaphore for the rest
+    if (hasNewChunks())
+    {
+        return true;
+    }
+
     const auto semaphore = m_receiver.GetShmSemaphore();
     assert(semaphore != nullptr && "WaitForChunk: semaphore is not set");
 
+    auto remaining = duration_cast<milliseconds>(deadline - steady_clock::now());
+    if (remaining.count() <= 0)
+    {
+        return false;
+    }
+
     struct timespec ts;
     clock_gettime(CLOCK_REALTIME, &ts);
-    ts = posix::addTimeMs(ts, timeoutMs);
-    return semaphore->timedWait(&ts, true);
+    ts = posix::addTimeMs(ts, static_cast<uint32_t>(remaining.count()));
+    if (semaphore->timedWait(&ts, true))
+    {
+        m_receiver.clearPendingNotification();
+        return true;
+    }
+    return hasNewChunks();
 }
 
 bool Subscriber::tryWaitForChunk() noexcept
@@ -157,7 +312,12 @@ bool Subscriber::tryWaitForChunk() noexcept
     const auto semaphore = m_receiver.GetShmSemaphore();
     assert(semaphore != nullptr && "TryWaitForChunk: semaphore is not set");
 
-    return semaphore->tryWait();
+    if (semaphore->tryWait())
+    {
+        m_receiver.clearPendingNotification();
+        return true;
+    }
+    return false;
 }
 
 bool Subscriber::getChunk(const mepoo::ChunkHeader** chunkHeader) noexcept
@@ -165,6 +325,11 @@ bool Subscriber::getChunk(const mepoo::ChunkHeader** chunkHeader) noexcept
     return (m_receiver.getChunk(*chunkHeader));
 }
 
+uint32_t Subscriber::getChunks(const mepoo::ChunkHeader** chunkHeaders, const uint32_t maxCount) noexcept
+{
+    return m_receiver.getChunks(chunkHeaders, maxCount);
+}
+
 bool Subscriber::getChunk(const void** payload) noexcept
 {
     const mepoo::ChunkHeader* chunkHeader = nullptr;
@@ -201,6 +366,16 @@ bool Subscriber::hasNewChunks() const noexcept
     return m_receiver.newData();
 }
 
+uint64_t Subscriber::getLostChunkCount() const noexcept
+{
+    return m_receiver.getDropCount();
+}
+
+uint64_t Subscriber::getLastLostSequenceNumber() const noexcept
+{
+    return m_receiver.getLastDroppedSequenceNumber();
+}
+
 posix::Semaphore* Subscriber::getSemaphore() const noexcept
 {
     // Temporary solution as long as there is no other mechanism to request a semophore
@@ -224,9 +399,19 @@ void Subscriber::eventCallbackMain() noexcept
 {
     while (m_callbackRunFlag)
     {
-        if (m_callbackSemaphore && !m_callbackSemaphore->wait())
+        if (m_callbackFutexSignal)
+        {
+            m_callbackFutexSignal->wait();
+        }
+        else if (m_callbackSemaphore)
         {
-            // TODO: error handling
+            if (!m_callbackSemaphore->wait())
+            {
+                // TODO: error handling
+            }
+            // the consumed post may cover a whole burst, the handler below has to
+            // drain the delivery FiFo until it is empty
+            m_receiver.clearPendingNotification();
         }
         // in case new data arrived during a call to the handler, we
         // might loop the outer while-loop several times without
@@ -0,0 +1,164 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/popo/wait_set.hpp"
+
+#include "iceoryx_utils/internal/posix_wrapper/timespec.hpp"
+
+namespace iox
+{
+namespace popo
+{
+WaitSet::~WaitSet() noexcept
+{
+    detachAllReceivers();
+}
+
+bool WaitSet::attachReceiver(ReceiverPortType& receiver) noexcept
+{
+    if (m_attachedReceivers.size() == m_attachedReceivers.capacity())
+    {
+        return false;
+    }
+
+    // the first attached receiver provides the shared memory semaphore which
+    // all further receivers post on delivery
+    if (m_waitSemaphore == nullptr)
+    {
+        m_waitSemaphore = receiver.GetShmSemaphore();
+        if (m_waitSemaphore == nullptr)
+        {
+            return false;
+        }
+    }
+
+    receiver.SetCallbackReferences(m_waitSemaphore);
+    m_attachedReceivers.push_back(&receiver);
+    return true;
+}
+
+bool WaitSet::detachReceiver(ReceiverPortType& receiver) noexcept
+{
+    for (auto it = m_attachedReceivers.begin(); it != m_attachedReceivers.end(); ++it)
+    {
+        if (*it == &receiver)
+        {
+            m_attachedReceivers.erase(it);
+            receiver.UnsetCallbackReferences();
+
+            // when the detached receiver provided the wakeup semaphore the
+            // remaining ones are rewired to the semaphore of another member
+            if (m_waitSemaphore == receiver.GetShmSemaphore())
+            {
+                m_waitSemaphore = nullptr;
+                if (m_attachedReceivers.size() > 0u)
+                {
+                    m_waitSemaphore = m_attachedReceivers.front()->GetShmSemaphore();
+                    for (auto attachedReceiver : m_attachedReceivers)
+                    {
+                        attachedReceiver->UnsetCallbackReferences();
+                        attachedReceiver->SetCallbackReferences(m_waitSemaphore);
+                    }
+                }
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void WaitSet::detachAllReceivers() noexcept
+{
+    for (auto attachedReceiver : m_attachedReceivers)
+    {
+        attachedReceiver->UnsetCallbackReferences();
+    }
+    m_attachedReceivers.clear();
+    m_waitSemaphore = nullptr;
+}
+
+uint32_t WaitSet::getNumberOfAttachedReceivers() const noexcept
+{
+    return static_cast<uint32_t>(m_attachedReceivers.size());
+}
+
+uint32_t WaitSet::wait(ReceiverPortType** readyReceivers, const uint32_t maxCount) noexcept
+{
+    // chunks delivered before the attachment or already signalled ones are
+    // caught by scanning before parking on the semaphore
+    uint32_t readyCount = collectReadyReceivers(readyReceivers, maxCount);
+    while (readyCount == 0u)
+    {
+        if (m_waitSemaphore == nullptr || !m_waitSemaphore->wait())
+        {
+            return 0u;
+        }
+        // the counting semaphore can hold more posts than unfetched chunks, in
+        // that case the scan comes up empty and we just park again
+        readyCount = collectReadyReceivers(readyReceivers, maxCount);
+    }
+    return readyCount;
+}
+
+uint32_t WaitSet::timedWait(ReceiverPortType** readyReceivers, const uint32_t maxCount, const uint32_t timeoutMs) noexcept
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts = posix::addTimeMs(ts, timeoutMs);
+
+    uint32_t readyCount = collectReadyReceivers(readyReceivers, maxCount);
+    while (readyCount == 0u)
+    {
+        if (m_waitSemaphore == nullptr)
+        {
+            return 0u;
+        }
+        if (!m_waitSemaphore->timedWait(&ts, true))
+        {
+            // timed out; a last scan covers a delivery racing with the timeout
+            return collectReadyReceivers(readyReceivers, maxCount);
+        }
+        readyCount = collectReadyReceivers(readyReceivers, maxCount);
+    }
+    return readyCount;
+}
+
+uint32_t WaitSet::tryWait(ReceiverPortType** readyReceivers, const uint32_t maxCount) noexcept
+{
+    return collectReadyReceivers(readyReceivers, maxCount);
+}
+
+uint32_t WaitSet::collectReadyReceivers(ReceiverPortType** readyReceivers, const uint32_t maxCount) const noexcept
+{
+    uint32_t readyCount = 0u;
+    for (auto attachedReceiver : m_attachedReceivers)
+    {
+        if (readyCount == maxCount)
+        {
+            break;
+        }
+        // clearing before the FiFo check re-arms the coalesced notification of the
+        // port, so a delivery racing with the scan posts the semaphore again
+        attachedReceiver->clearPendingNotification();
+        if (attachedReceiver->newData())
+        {
+            readyReceivers[readyCount] = attachedReceiver;
+            ++readyCount;
+        }
+    }
+    return readyCount;
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,196 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/recording/chunk_recorder.hpp"
+
+#include "iceoryx_utils/cxx/payload_copy.hpp"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace iox
+{
+namespace recording
+{
+constexpr uint64_t RecordFileHeader::MAGIC;
+constexpr uint32_t RecordFileHeader::VERSION;
+
+ChunkRecorder::ChunkRecorder(const std::string& f_fileName, const uint64_t f_ringCapacity) noexcept
+{
+    m_mappedLength = sizeof(RecordFileHeader) + f_ringCapacity;
+
+    m_fileDescriptor = ::open(f_fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (m_fileDescriptor < 0)
+    {
+        return;
+    }
+    if (::ftruncate(m_fileDescriptor, static_cast<off_t>(m_mappedLength)) != 0)
+    {
+        ::close(m_fileDescriptor);
+        m_fileDescriptor = -1;
+        return;
+    }
+
+    m_memoryMap = posix::MemoryMap::create(nullptr, m_mappedLength, m_fileDescriptor, posix::AccessMode::readWrite);
+    if (!m_memoryMap.has_value())
+    {
+        ::close(m_fileDescriptor);
+        m_fileDescriptor = -1;
+        return;
+    }
+
+    RecordFileHeader* header = new (fileHeader()) RecordFileHeader();
+    header->m_ringCapacity = f_ringCapacity;
+}
+
+ChunkRecorder::~ChunkRecorder() noexcept
+{
+    if (isInitialized())
+    {
+        // synchronous flush on shutdown so the file is complete when we return
+        ::msync(m_memoryMap->getBaseAddress(), m_mappedLength, MS_SYNC);
+    }
+    if (m_fileDescriptor >= 0)
+    {
+        ::close(m_fileDescriptor);
+    }
+}
+
+bool ChunkRecorder::isInitialized() const noexcept
+{
+    return m_memoryMap.has_value();
+}
+
+bool ChunkRecorder::record(const mepoo::ChunkHeader* const f_chunkHeader) noexcept
+{
+    if (!isInitialized())
+    {
+        return false;
+    }
+
+    auto header = fileHeader();
+    const uint64_t payloadSize = f_chunkHeader->m_info.m_payloadSize;
+    const uint64_t entrySize = sizeof(RecordEntryHeader) + payloadSize;
+    if (entrySize > header->m_ringCapacity)
+    {
+        return false;
+    }
+
+    // a wrap consumes the tail of the ring in addition to the entry itself
+    uint64_t tail = header->m_ringCapacity - header->m_writeOffset;
+    uint64_t neededBytes = (tail < entrySize) ? entrySize + tail : entrySize;
+
+    while ((header->m_ringCapacity - header->m_validBytes < neededBytes) && (header->m_validBytes > 0u))
+    {
+        advanceOldest();
+    }
+    if (header->m_validBytes == 0u)
+    {
+        // ring is empty, start over at the beginning so no wrap is needed
+        header->m_oldestOffset = 0u;
+        header->m_writeOffset = 0u;
+        tail = header->m_ringCapacity;
+        neededBytes = entrySize;
+    }
+
+    if (tail < entrySize)
+    {
+        if (tail >= sizeof(RecordEntryHeader))
+        {
+            new (ringStart() + header->m_writeOffset) RecordEntryHeader();
+        }
+        header->m_validBytes += tail;
+        header->m_writeOffset = 0u;
+    }
+
+    RecordEntryHeader* entry = new (ringStart() + header->m_writeOffset) RecordEntryHeader();
+    entry->m_entrySize = static_cast<uint32_t>(entrySize);
+    entry->m_payloadSize = static_cast<uint32_t>(payloadSize);
+    entry->m_txTimestampNs =
+        static_cast<uint64_t>(f_chunkHeader->m_info.m_txTimestamp.time_since_epoch().count());
+    entry->m_sequenceNumber = f_chunkHeader->m_info.m_sequenceNumber;
+    entry->m_externalSequenceNumber = f_chunkHeader->m_info.m_externalSequenceNumber_bl ? 1u : 0u;
+    cxx::copyPayload(ringStart() + header->m_writeOffset + sizeof(RecordEntryHeader), f_chunkHeader->payload(), payloadSize);
+
+    header->m_writeOffset += entrySize;
+    if (header->m_writeOffset == header->m_ringCapacity)
+    {
+        header->m_writeOffset = 0u;
+    }
+    header->m_validBytes += entrySize;
+    ++header->m_recordedChunks;
+    return true;
+}
+
+void ChunkRecorder::advanceOldest() noexcept
+{
+    auto header = fileHeader();
+    const uint64_t tail = header->m_ringCapacity - header->m_oldestOffset;
+    if (tail < sizeof(RecordEntryHeader))
+    {
+        header->m_validBytes -= tail;
+        header->m_oldestOffset = 0u;
+        return;
+    }
+
+    auto entry = reinterpret_cast<const RecordEntryHeader*>(ringStart() + header->m_oldestOffset);
+    if (entry->m_entrySize == 0u)
+    {
+        // wrap marker, the rest of the ring up to the end is unused
+        header->m_validBytes -= tail;
+        header->m_oldestOffset = 0u;
+        return;
+    }
+
+    header->m_validBytes -= entry->m_entrySize;
+    header->m_oldestOffset += entry->m_entrySize;
+    if (header->m_oldestOffset == header->m_ringCapacity)
+    {
+        header->m_oldestOffset = 0u;
+    }
+    ++header->m_overwrittenChunks;
+}
+
+void ChunkRecorder::flushAsync() noexcept
+{
+    if (isInitialized())
+    {
+        ::msync(m_memoryMap->getBaseAddress(), m_mappedLength, MS_ASYNC);
+    }
+}
+
+uint64_t ChunkRecorder::recordedChunks() const noexcept
+{
+    return isInitialized() ? fileHeader()->m_recordedChunks : 0u;
+}
+
+uint64_t ChunkRecorder::overwrittenChunks() const noexcept
+{
+    return isInitialized() ? fileHeader()->m_overwrittenChunks : 0u;
+}
+
+RecordFileHeader* ChunkRecorder::fileHeader() const noexcept
+{
+    return static_cast<RecordFileHeader*>(m_memoryMap->getBaseAddress());
+}
+
+uint8_t* ChunkRecorder::ringStart() const noexcept
+{
+    return static_cast<uint8_t*>(m_memoryMap->getBaseAddress()) + sizeof(RecordFileHeader);
+}
+
+} // namespace recording
+} // namespace iox
@@ -0,0 +1,176 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/recording/chunk_replayer.hpp"
+
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_utils/cxx/payload_copy.hpp"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+namespace iox
+{
+namespace recording
+{
+ChunkReplayer::ChunkReplayer(const std::string& f_fileName) noexcept
+{
+    m_fileDescriptor = ::open(f_fileName.c_str(), O_RDONLY);
+    if (m_fileDescriptor < 0)
+    {
+        return;
+    }
+
+    struct stat fileStat;
+    if (::fstat(m_fileDescriptor, &fileStat) != 0
+        || static_cast<uint64_t>(fileStat.st_size) < sizeof(RecordFileHeader))
+    {
+        ::close(m_fileDescriptor);
+        m_fileDescriptor = -1;
+        return;
+    }
+    m_mappedLength = static_cast<uint64_t>(fileStat.st_size);
+
+    m_memoryMap = posix::MemoryMap::create(nullptr, m_mappedLength, m_fileDescriptor, posix::AccessMode::readOnly);
+    if (!m_memoryMap.has_value())
+    {
+        ::close(m_fileDescriptor);
+        m_fileDescriptor = -1;
+        return;
+    }
+
+    auto header = fileHeader();
+    if (header->m_magic != RecordFileHeader::MAGIC || header->m_version != RecordFileHeader::VERSION
+        || m_mappedLength < sizeof(RecordFileHeader) + header->m_ringCapacity)
+    {
+        m_memoryMap.reset();
+        ::close(m_fileDescriptor);
+        m_fileDescriptor = -1;
+    }
+}
+
+ChunkReplayer::~ChunkReplayer() noexcept
+{
+    if (m_fileDescriptor >= 0)
+    {
+        ::close(m_fileDescriptor);
+    }
+}
+
+bool ChunkReplayer::isInitialized() const noexcept
+{
+    return m_memoryMap.has_value();
+}
+
+uint64_t ChunkReplayer::numberOfChunks() const noexcept
+{
+    if (!isInitialized())
+    {
+        return 0u;
+    }
+    auto header = fileHeader();
+    return header->m_recordedChunks - header->m_overwrittenChunks;
+}
+
+uint64_t ChunkReplayer::forEachChunk(const std::function<void(const ReplayedChunk&)>& f_visitor) const noexcept
+{
+    if (!isInitialized())
+    {
+        return 0u;
+    }
+
+    auto header = fileHeader();
+    uint64_t offset = header->m_oldestOffset;
+    uint64_t remainingBytes = header->m_validBytes;
+    uint64_t visitedCount{0u};
+
+    while (remainingBytes > 0u)
+    {
+        const uint64_t tail = header->m_ringCapacity - offset;
+        if (tail < sizeof(RecordEntryHeader))
+        {
+            remainingBytes -= tail;
+            offset = 0u;
+            continue;
+        }
+
+        auto entry = reinterpret_cast<const RecordEntryHeader*>(ringStart() + offset);
+        if (entry->m_entrySize == 0u)
+        {
+            // wrap marker, the rest of the ring up to the end is unused
+            remainingBytes -= tail;
+            offset = 0u;
+            continue;
+        }
+
+        ReplayedChunk replayedChunk;
+        replayedChunk.m_entry = entry;
+        replayedChunk.m_payload = ringStart() + offset + sizeof(RecordEntryHeader);
+        f_visitor(replayedChunk);
+        ++visitedCount;
+
+        remainingBytes -= entry->m_entrySize;
+        offset += entry->m_entrySize;
+        if (offset == header->m_ringCapacity)
+        {
+            offset = 0u;
+        }
+    }
+    return visitedCount;
+}
+
+uint64_t ChunkReplayer::replay(popo::SenderPort& f_sender, const bool f_preserveTiming) const noexcept
+{
+    uint64_t replayedCount{0u};
+    uint64_t previousTimestampNs{0u};
+
+    forEachChunk([&](const ReplayedChunk& f_chunk) {
+        if (f_preserveTiming && previousTimestampNs != 0u
+            && f_chunk.m_entry->m_txTimestampNs > previousTimestampNs)
+        {
+            std::this_thread::sleep_for(
+                std::chrono::nanoseconds(f_chunk.m_entry->m_txTimestampNs - previousTimestampNs));
+        }
+        previousTimestampNs = f_chunk.m_entry->m_txTimestampNs;
+
+        auto chunkHeader = f_sender.reserveChunk(f_chunk.m_entry->m_payloadSize);
+        if (chunkHeader == nullptr)
+        {
+            return;
+        }
+        cxx::copyPayload(chunkHeader->payload(), f_chunk.m_payload, f_chunk.m_entry->m_payloadSize);
+        chunkHeader->m_info.m_payloadSize = f_chunk.m_entry->m_payloadSize;
+        chunkHeader->m_info.m_externalSequenceNumber_bl = (f_chunk.m_entry->m_externalSequenceNumber != 0u);
+        chunkHeader->m_info.m_sequenceNumber = f_chunk.m_entry->m_sequenceNumber;
+        f_sender.deliverChunk(chunkHeader);
+        ++replayedCount;
+    });
+    return replayedCount;
+}
+
+const RecordFileHeader* ChunkReplayer::fileHeader() const noexcept
+{
+    return static_cast<const RecordFileHeader*>(m_memoryMap->getBaseAddress());
+}
+
+const uint8_t* ChunkReplayer::ringStart() const noexcept
+{
+    return static_cast<const uint8_t*>(m_memoryMap->getBaseAddress()) + sizeof(RecordFileHeader);
+}
+
+} // namespace recording
+} // namespace iox
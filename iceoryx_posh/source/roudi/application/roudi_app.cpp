@@ -17,6 +17,8 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/roudi/roudi_multi_process.hpp"
+#include "iceoryx_posh/runtime/posh_domain.hpp"
+#include "iceoryx_utils/cxx/convert.hpp"
 #include "iceoryx_utils/cxx/helplets.hpp"
 #include "iceoryx_utils/cxx/optional.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/posix_access_rights.hpp"
@@ -75,6 +77,11 @@ RouDiApp::RouDiApp(int argc, char* argv[], const mepoo::MePooConfig* mePooConfig
 {
 }
 
+StartupProfiler::PhaseContainer RouDiApp::getStartupReport() noexcept
+{
+    return StartupProfiler::instance().getReport();
+}
+
 RouDiApp::RouDiApp(int argc, char* argv[], const RouDiConfig_t& config) noexcept
     : RouDiApp(config)
 {
@@ -142,10 +149,12 @@ void RouDiApp::parseCmdLineArguments(int argc, char* argv[], CmdLineArgumentPars
                                       {"monitoring-mode", required_argument, nullptr, 'm'},
                                       {"log-level", required_argument, nullptr, 'l'},
                                       {"config-file", required_argument, nullptr, 'c'},
+                                      {"domain-id", required_argument, nullptr, 'd'},
+                                      {"persistent-shm", no_argument, nullptr, 'p'},
                                       {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hvm:l:b:c:";
+    constexpr const char* shortOptions = "hvm:l:b:c:d:p";
     int index;
     int opt{-1};
     while (opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1)
@@ -165,6 +174,10 @@ void RouDiApp::parseCmdLineArguments(int argc, char* argv[], CmdLineArgumentPars
             std::cout << "-l, --log-level <LEVEL>           Set log level." << std::endl;
             std::cout << "                                  <LEVEL> {off, fatal, error, warning, info, debug, verbose}"
                       << std::endl;
+            std::cout << "-d, --domain-id <ID>              Id of the iceoryx domain this RouDi serves." << std::endl;
+            std::cout << "                                  default = 0 (legacy resource names)" << std::endl;
+            std::cout << "-p, --persistent-shm              Keep the shared memory of a crashed RouDi" << std::endl;
+            std::cout << "                                  and re-adopt it on restart." << std::endl;
             std::cout << "-c, --config-file                 Path to the RouDi Config File."
                          "                                  Have a look at the documentation for the format."
                       << std::endl;
@@ -233,6 +246,22 @@ void RouDiApp::parseCmdLineArguments(int argc, char* argv[], CmdLineArgumentPars
             break;
         }
 
+        case 'd':
+        {
+            uint32_t domainId{0u};
+            if (!cxx::convert::fromString(optarg, domainId)
+                || !runtime::PoshDomain::setDomainId(domainId))
+            {
+                LogFatal() << "Invalid domain id '" << optarg << "'!";
+                exit(EXIT_FAILURE);
+            }
+            break;
+        }
+        case 'p':
+        {
+            m_config.roudi.m_persistentShm = true;
+            break;
+        }
         case 'c':
         {
             if (!m_configFileParser)
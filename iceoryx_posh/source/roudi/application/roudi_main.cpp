@@ -18,7 +18,11 @@
 #include "iceoryx_posh/roudi/roudi_config_file_parser.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/posix_access_rights.hpp"
 
-#ifdef TOML_CONFIG_FILE
+#ifdef IOX_BUILTIN_ROUDI_CONFIG
+#include "iceoryx_posh/roudi/roudi_config_builtin.hpp"
+#endif
+
+#if defined(TOML_CONFIG_FILE) && !defined(IOX_BUILTIN_ROUDI_CONFIG)
 #include "cpptoml.h"
 
 class TomlRouDiConfigFileParser : public iox::roudi::RouDiConfigFileParser
@@ -104,7 +108,11 @@ int main(int argc, char* argv[])
 {
     using iox::roudi::IceOryxRouDiApp;
 
-#ifdef TOML_CONFIG_FILE
+#if defined(IOX_BUILTIN_ROUDI_CONFIG)
+    // the configuration was generated into the binary at build time, nothing is
+    // parsed at boot and no parser is carried in the binary
+    IceOryxRouDiApp roudi(argc, argv, iox::roudi::builtinRouDiConfig());
+#elif defined(TOML_CONFIG_FILE)
     TomlRouDiConfigFileParser configFileParser;
 
     IceOryxRouDiApp roudi(argc, argv, &configFileParser);
@@ -0,0 +1,111 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/roudi/capacity_preflight.hpp"
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+#include "ac3log/simplelogger.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+constexpr uint32_t CapacityPreflightConfig::MAX_EXPECTED_TOPIC_LOADS;
+
+uint64_t worstCaseChunkDemand(const ExpectedTopicLoad& f_load)
+{
+    // per port: the allocation window (chunks reserved but not yet sent), the
+    // retained last chunk, the retained history for late subscribers and a
+    // receiver queue completely filled with distinct samples; receivers of
+    // the same port share the delivered samples, so one full queue bounds
+    // them all
+    const uint64_t l_perPort = static_cast<uint64_t>(MAX_SAMPLE_ALLOCATE_PER_SENDER) + 1u + f_load.m_historyDepth
+                               + f_load.m_receiverQueueDepth;
+    return static_cast<uint64_t>(f_load.m_senderPorts) * l_perPort;
+}
+
+bool validateSegmentCapacity(const mepoo::MePooConfig& f_mempoolConfig,
+                             const std::string& f_writerGroup,
+                             const CapacityPreflightConfig& f_preflightConfig)
+{
+    const auto& l_pools = f_mempoolConfig.m_mempoolConfig;
+    uint64_t l_demand[MAX_NUMBER_OF_MEMPOOLS] = {};
+
+    bool l_allServed = true;
+    for (const auto& load : f_preflightConfig.m_expectedLoad)
+    {
+        if (!load.m_writerGroup.empty() && load.m_writerGroup != f_writerGroup)
+        {
+            continue;
+        }
+
+        // the smallest mempool whose chunks fit the payload serves the topic,
+        // the same first fit the memory manager applies at runtime
+        const uint64_t l_neededChunkSize = static_cast<uint64_t>(load.m_payloadSize) + sizeof(mepoo::ChunkHeader);
+        uint64_t l_servingPool = l_pools.size();
+        for (uint64_t i = 0u; i < l_pools.size(); ++i)
+        {
+            if (l_pools[static_cast<int>(i)].m_size >= l_neededChunkSize
+                && (l_servingPool == l_pools.size()
+                    || l_pools[static_cast<int>(i)].m_size < l_pools[static_cast<int>(l_servingPool)].m_size))
+            {
+                l_servingPool = i;
+            }
+        }
+
+        if (l_servingPool == l_pools.size())
+        {
+            ERR_PRINTF("Capacity preflight: no mempool of segment \"%s\" fits a payload of %u bytes\n",
+                       f_writerGroup.c_str(),
+                       load.m_payloadSize);
+            l_allServed = false;
+            continue;
+        }
+        l_demand[l_servingPool] += worstCaseChunkDemand(load);
+    }
+
+    for (uint64_t i = 0u; i < l_pools.size(); ++i)
+    {
+        const auto& pool = l_pools[static_cast<int>(i)];
+        if (l_demand[i] <= pool.m_chunkCount)
+        {
+            continue;
+        }
+        if (l_demand[i] <= pool.m_maxChunkCount)
+        {
+            WARN_PRINTF("Capacity preflight: mempool %lu of segment \"%s\" (chunk size %u) covers the worst-case "
+                        "demand of %lu chunks only after growing from %u to its reserved %u chunks\n",
+                        static_cast<unsigned long>(i),
+                        f_writerGroup.c_str(),
+                        pool.m_size,
+                        static_cast<unsigned long>(l_demand[i]),
+                        pool.m_chunkCount,
+                        pool.m_maxChunkCount);
+            continue;
+        }
+        ERR_PRINTF("Capacity preflight: mempool %lu of segment \"%s\" (chunk size %u) provides %u chunks but the "
+                   "worst-case demand of the expected load is %lu chunks\n",
+                   static_cast<unsigned long>(i),
+                   f_writerGroup.c_str(),
+                   pool.m_size,
+                   pool.m_chunkCount,
+                   static_cast<unsigned long>(l_demand[i]));
+        l_allServed = false;
+    }
+    return l_allServed;
+}
+
+} // namespace roudi
+} // namespace iox
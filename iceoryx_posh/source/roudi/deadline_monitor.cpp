@@ -0,0 +1,115 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/roudi/deadline_monitor.hpp"
+
+#include "iceoryx_posh/mepoo/chunk_info.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+DeadlineMonitor::DeadlineMonitor(const ViolationHandler_t& f_violationHandler) noexcept
+    : m_violationHandler(f_violationHandler)
+{
+}
+
+DeadlineMonitor::~DeadlineMonitor() noexcept
+{
+    std::lock_guard<std::mutex> g(m_entriesMutex);
+    for (auto& entry : m_entries)
+    {
+        posix::TimingWheel::instance().unregisterTask(entry.m_taskHandle);
+    }
+    m_entries.clear();
+}
+
+bool DeadlineMonitor::startMonitoring(popo::ReceiverPortData* const f_portData) noexcept
+{
+    const uint64_t deadlineNs = f_portData->m_deadlineNs.load(std::memory_order_relaxed);
+    if (deadlineNs == 0u)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> g(m_entriesMutex);
+    for (const auto& entry : m_entries)
+    {
+        if (entry.m_portData == f_portData)
+        {
+            // already armed, e.g. on a resubscribe
+            return true;
+        }
+    }
+
+    auto taskHandle =
+        posix::TimingWheel::instance().registerTask([this, f_portData]() { checkDeadline(f_portData); });
+    if (!taskHandle.has_value())
+    {
+        return false;
+    }
+
+    // the tracking starts now, not at the last delivery before arming
+    f_portData->m_lastDeliveryTimestampNs.store(
+        static_cast<uint64_t>(mepoo::BaseClock::now().time_since_epoch().count()), std::memory_order_relaxed);
+
+    // check with the deadline as period; the wheel clamps to its tick granularity
+    posix::TimingWheel::instance().startTask(
+        taskHandle.value(), units::Duration(std::chrono::nanoseconds(deadlineNs)), true);
+
+    Entry entry;
+    entry.m_portData = f_portData;
+    entry.m_taskHandle = taskHandle.value();
+    m_entries.push_back(entry);
+    return true;
+}
+
+void DeadlineMonitor::stopMonitoring(popo::ReceiverPortData* const f_portData) noexcept
+{
+    std::lock_guard<std::mutex> g(m_entriesMutex);
+    for (auto iter = m_entries.begin(); iter != m_entries.end(); ++iter)
+    {
+        if (iter->m_portData == f_portData)
+        {
+            posix::TimingWheel::instance().unregisterTask(iter->m_taskHandle);
+            m_entries.erase(iter);
+            return;
+        }
+    }
+}
+
+uint32_t DeadlineMonitor::numberOfMonitoredPorts() const noexcept
+{
+    std::lock_guard<std::mutex> g(m_entriesMutex);
+    return static_cast<uint32_t>(m_entries.size());
+}
+
+void DeadlineMonitor::checkDeadline(popo::ReceiverPortData* const f_portData) noexcept
+{
+    const uint64_t deadlineNs = f_portData->m_deadlineNs.load(std::memory_order_relaxed);
+    const uint64_t lastDeliveryNs = f_portData->m_lastDeliveryTimestampNs.load(std::memory_order_relaxed);
+    const uint64_t nowNs = static_cast<uint64_t>(mepoo::BaseClock::now().time_since_epoch().count());
+
+    if (nowNs > lastDeliveryNs && nowNs - lastDeliveryNs > deadlineNs)
+    {
+        const uint64_t missCount = f_portData->m_deadlineMissCount.fetch_add(1u, std::memory_order_relaxed) + 1u;
+        if (m_violationHandler)
+        {
+            m_violationHandler(f_portData->m_serviceDescription, missCount);
+        }
+    }
+}
+
+} // namespace roudi
+} // namespace iox
@@ -13,13 +13,22 @@
 // limitations under the License.
 
 #include "iceoryx_posh/internal/roudi/roudi_multi_process.hpp"
+
+#include "iceoryx_posh/runtime/posh_domain.hpp"
 #include "iceoryx_posh/internal/runtime/message_queue_interface.hpp"
 #include "iceoryx_posh/internal/runtime/runnable_property.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
+#include "iceoryx_posh/roudi/startup_profiler.hpp"
 #include "iceoryx_utils/cxx/convert.hpp"
 #include "iceoryx_utils/fixed_string/string100.hpp"
+#include "iceoryx_utils/posix_wrapper/thread_attributes.hpp"
 #include "iceoryx_utils/posix_wrapper/timer.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
 namespace iox
 {
 namespace roudi
@@ -32,27 +41,69 @@ RouDiMultiProcess::RouDiMultiProcess(RouDiApp::MonitoringMode monitoringMode,
     , m_roudilock()
     , m_cleanupBeforeStart(cleanupBeforeStart())
     , m_shmMgr(config)
-    , m_prcMgr(m_shmMgr)
+    , m_prcMgr(m_shmMgr, config.threads.m_portReclaimer)
     , m_mempoolIntrospection(m_shmMgr.getShmInterface().getShmInterface()->m_roudiMemoryManager,
                              m_shmMgr.getShmInterface().getShmInterface()->m_segmentManager,
-                             m_prcMgr.addIntrospectionSenderPort(IntrospectionMempoolService, MQ_ROUDI_NAME))
+                             m_prcMgr.addIntrospectionSenderPort(IntrospectionMempoolService, runtime::PoshDomain::getRoudiMqName()))
     , m_monitoringMode(monitoringMode)
 {
+    // preflight capacity validation: a mempool which cannot cover the worst
+    // case demand of the expected topology is a boot time finding here
+    // instead of an allocation failure under load
+    if (config.preflight.m_mode != CapacityPreflightMode::OFF)
+    {
+        bool l_capacitySufficient = true;
+        for (const auto& segment : config.m_sharedMemorySegments)
+        {
+            if (!validateSegmentCapacity(segment.m_mempoolConfig, segment.m_writerGroup, config.preflight))
+            {
+                l_capacitySufficient = false;
+            }
+        }
+        if (!l_capacitySufficient && config.preflight.m_mode == CapacityPreflightMode::REFUSE)
+        {
+            ERR_PRINTF("The mempool capacity does not cover the expected topology! Terminating!\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    auto introspectionSnapshots = &m_shmMgr.getShmInterface().getShmInterface()->m_introspectionSnapshots;
     m_processIntrospection.registerSenderPort(
-        m_prcMgr.addIntrospectionSenderPort(IntrospectionProcessService, MQ_ROUDI_NAME));
+        m_prcMgr.addIntrospectionSenderPort(IntrospectionProcessService, runtime::PoshDomain::getRoudiMqName()));
+    m_processIntrospection.registerSnapshotBuffer(&introspectionSnapshots->m_processTopic);
     m_prcMgr.initIntrospection(&m_processIntrospection);
     m_processIntrospection.run();
+    m_mempoolIntrospection.registerEventSenderPort(
+        m_prcMgr.addIntrospectionSenderPort(IntrospectionMempoolEventService, runtime::PoshDomain::getRoudiMqName()));
+    m_mempoolIntrospection.registerAccountingSenderPort(
+        m_prcMgr.addIntrospectionSenderPort(IntrospectionMemoryAccountingService, runtime::PoshDomain::getRoudiMqName()));
+    m_mempoolIntrospection.registerSnapshotBuffer(&introspectionSnapshots->m_memPoolTopics);
     m_mempoolIntrospection.start();
+    StartupProfiler::instance().phaseDone("introspection start");
 
     // since RouDi offers the introspection services, also add it to the list of processes
-    m_processIntrospection.addProcess(getpid(), MQ_ROUDI_NAME);
+    m_processIntrospection.addProcess(getpid(), runtime::PoshDomain::getRoudiMqName());
 
     // run the threads
     m_processManagementThread = std::thread(&RouDiMultiProcess::processThread, this);
-    pthread_setname_np(m_processManagementThread.native_handle(), "ProcessMgmt");
+    posix::applyThreadAttributes(m_processManagementThread.native_handle(), config.threads.m_processManagement);
 
     m_processMQThread = std::thread(&RouDiMultiProcess::mqThread, this);
-    pthread_setname_np(m_processMQThread.native_handle(), "MQ-processing");
+    posix::applyThreadAttributes(m_processMQThread.native_handle(), config.threads.m_mqProcessing);
+
+    m_commandChannelThread = std::thread(&RouDiMultiProcess::commandChannelThread, this);
+    posix::applyThreadAttributes(m_commandChannelThread.native_handle(), config.threads.m_commandChannel);
+
+    for (uint32_t i = 0u; i < REGISTRATION_WORKER_COUNT; ++i)
+    {
+        m_registrationWorkers[i].m_thread = std::thread(&RouDiMultiProcess::registrationWorkerMain, this, i);
+        posix::applyThreadAttributes(m_registrationWorkers[i].m_thread.native_handle(), config.threads.m_registration);
+    }
+
+    StartupProfiler::instance().phaseDone("thread startup");
+    // phases which finish later (e.g. the mq creation in the mq thread) are only
+    // contained in the report queried via RouDiApp::getStartupReport()
+    StartupProfiler::instance().logReport();
 
 #ifdef PRINT_MEMORY_CONSUMPTION
     INFO_PRINTF("-----------------------\n");
@@ -93,6 +144,20 @@ void RouDiMultiProcess::shutdown()
         m_processMQThread.join();
         LOG_DEBUG("...'MQ-processing' thread joined.");
     }
+    if (m_commandChannelThread.joinable())
+    {
+        LOG_DEBUG("Joining 'CmdChannel' thread...");
+        m_commandChannelThread.join();
+        LOG_DEBUG("...'CmdChannel' thread joined.");
+    }
+    for (auto& worker : m_registrationWorkers)
+    {
+        worker.m_trigger.notify_all();
+        if (worker.m_thread.joinable())
+        {
+            worker.m_thread.join();
+        }
+    }
 }
 
 void RouDiMultiProcess::cyclicUpdateHook()
@@ -112,7 +177,14 @@ void RouDiMultiProcess::processThread()
 
 void RouDiMultiProcess::mqThread()
 {
-    runtime::MqInterfaceCreator roudiMqInterface{MQ_ROUDI_NAME};
+    runtime::MqInterfaceCreator roudiMqInterface{runtime::PoshDomain::getRoudiMqName()};
+    StartupProfiler::instance().phaseDone("mq creation");
+    // upper bound for the messages handled per wakeup; bounds the time the
+    // loop runs without checking m_runThreads during a registration storm
+    constexpr size_t MAX_MESSAGES_PER_WAKEUP{64u};
+    std::vector<std::pair<runtime::MqMessage, runtime::MqMessageType>> batch;
+    batch.reserve(MAX_MESSAGES_PER_WAKEUP);
+
     while (m_runThreads)
     {
         // read RouDi message queue
@@ -125,22 +197,135 @@ void RouDiMultiProcess::mqThread()
         }
         else
         {
+            // when many applications start at once the queue backs up behind a
+            // single receive per wakeup; drain what is already queued and parse
+            // the message type once per message while doing so
+            batch.clear();
+            batch.emplace_back(message, runtime::stringToMqMessageType(message.getElementAtIndex(0).c_str()));
+            while (batch.size() < MAX_MESSAGES_PER_WAKEUP && roudiMqInterface.tryReceive(message))
+            {
+                batch.emplace_back(message, runtime::stringToMqMessageType(message.getElementAtIndex(0).c_str()));
+            }
+
+            // dispatch grouped by message type so the handler code and data of
+            // one type stay cache hot through a burst of identical requests;
+            // the per type order is preserved and each application has at most
+            // one request in flight, so no per process ordering can be broken
+            std::stable_sort(batch.begin(),
+                             batch.end(),
+                             [](const std::pair<runtime::MqMessage, runtime::MqMessageType>& lhs,
+                                const std::pair<runtime::MqMessage, runtime::MqMessageType>& rhs) {
+                                 return lhs.second < rhs.second;
+                             });
+
+            for (auto& entry : batch)
+            {
+                std::string processName = entry.first.getElementAtIndex(1);
+                if (entry.second == runtime::MqMessageType::REG)
+                {
+                    // the admission of a process blocks on the reply mqueue of
+                    // the starting application; hand it to the registration
+                    // pool so that one slow application does not stall the
+                    // admission of all the others queued behind it
+                    enqueueRegistration(entry.first, processName);
+                }
+                else
+                {
+                    processMessage(entry.first, entry.second, processName);
+                }
+            }
+        }
+    }
+}
+
+void RouDiMultiProcess::enqueueRegistration(const runtime::MqMessage& f_message, const std::string& f_name)
+{
+    // selecting the worker by the process name keeps the registrations of one
+    // process on one worker, so a re-registration after a restart can never
+    // overtake the registration of the previous incarnation
+    auto& l_worker = m_registrationWorkers[std::hash<std::string>()(f_name) % REGISTRATION_WORKER_COUNT];
+    {
+        std::lock_guard<std::mutex> g(l_worker.m_mutex);
+        l_worker.m_pending.push_back(f_message);
+    }
+    l_worker.m_trigger.notify_one();
+}
+
+void RouDiMultiProcess::registrationWorkerMain(const uint32_t f_workerIndex)
+{
+    auto& l_worker = m_registrationWorkers[f_workerIndex];
+    std::vector<runtime::MqMessage> l_requests;
+    while (m_runThreads)
+    {
+        {
+            std::unique_lock<std::mutex> l_lock(l_worker.m_mutex);
+            l_worker.m_trigger.wait(l_lock, [&] { return !l_worker.m_pending.empty() || !m_runThreads; });
+            if (!m_runThreads)
+            {
+                return;
+            }
+            // take the whole queue in one go, the admission runs unlocked
+            l_requests.swap(l_worker.m_pending);
+        }
+
+        for (auto& message : l_requests)
+        {
+            std::string processName = message.getElementAtIndex(1);
+            processMessage(message, runtime::MqMessageType::REG, processName);
+        }
+        l_requests.clear();
+    }
+}
+
+void RouDiMultiProcess::commandChannelThread()
+{
+    auto& commandSignal = m_shmMgr.getShmInterface().getShmInterface()->m_commandSignal;
+    while (m_runThreads)
+    {
+        // the signal is posted for every request written to any channel, so no
+        // request is missed even when several channels carry pending requests;
+        // the timeout only bounds the shutdown latency
+        if (!commandSignal.timedWait(m_MessageQueueTimeoutMilliseconds))
+        {
+            continue;
+        }
+
+        // only drain the channels while they are locked; the dispatch happens
+        // outside so that no channel lock is held while the process manager
+        // locks are taken (channel creation and removal run under those locks)
+        std::vector<std::pair<runtime::MqMessage, runtime::RuntimeCommandChannel*>> pendingRequests;
+        m_shmMgr.forEachCommandChannel([&](runtime::RuntimeCommandChannel* channel) {
+            runtime::MqMessage message;
+            while (channel->tryGetRequest(message))
+            {
+                pendingRequests.push_back({message, channel});
+            }
+        });
+
+        for (auto& request : pendingRequests)
+        {
+            auto& message = request.first;
             auto cmd = runtime::stringToMqMessageType(message.getElementAtIndex(0).c_str());
             std::string processName = message.getElementAtIndex(1);
 
+            // route the response back over the channel the request arrived on
+            RouDiProcess::setReplyChannel(request.second);
             processMessage(message, cmd, processName);
         }
+        RouDiProcess::setReplyChannel(nullptr);
     }
 }
 
 void RouDiMultiProcess::parseRegisterMessage(const runtime::MqMessage& message,
                                              int& pid,
                                              uid_t& userId,
-                                             int64_t& transmissionTimestamp)
+                                             int64_t& transmissionTimestamp,
+                                             uint32_t& keepAliveInterval_ms)
 {
     cxx::convert::fromString(message.getElementAtIndex(2).c_str(), pid);
     cxx::convert::fromString(message.getElementAtIndex(3).c_str(), userId);
     cxx::convert::fromString(message.getElementAtIndex(4).c_str(), transmissionTimestamp);
+    cxx::convert::fromString(message.getElementAtIndex(5).c_str(), keepAliveInterval_ms);
 }
 
 
@@ -157,7 +342,7 @@ void RouDiMultiProcess::processMessage(const runtime::MqMessage& message,
     }
     case runtime::MqMessageType::REG:
     {
-        if (message.getNumberOfElements() != 5)
+        if (message.getNumberOfElements() != 6)
         {
             ERR_PRINTF("Wrong number of parameter for \"MqMessageType::REG\" from \"%s\"received!\n",
                        processName.c_str());
@@ -167,10 +352,16 @@ void RouDiMultiProcess::processMessage(const runtime::MqMessage& message,
             int pid;
             uid_t userId;
             int64_t transmissionTimestamp;
+            uint32_t keepAliveInterval_ms;
 
-            parseRegisterMessage(message, pid, userId, transmissionTimestamp);
+            parseRegisterMessage(message, pid, userId, transmissionTimestamp, keepAliveInterval_ms);
 
-            registerProcess(processName, pid, {userId}, transmissionTimestamp, getUniqueSessionIdForProcess());
+            registerProcess(processName,
+                            pid,
+                            {userId},
+                            transmissionTimestamp,
+                            getUniqueSessionIdForProcess(),
+                            keepAliveInterval_ms);
         }
         break;
     }
@@ -183,7 +374,13 @@ void RouDiMultiProcess::processMessage(const runtime::MqMessage& message,
         }
         else
         {
-            capro::ServiceDescription service(cxx::Serialization(message.getElementAtIndex(2)));
+            capro::ServiceDescription service;
+            if (!capro::ServiceDescription::fromWireFormat(message.getElementAtIndex(2), service))
+            {
+                ERR_PRINTF("Invalid service description for \"MqMessageType::IMPL_SENDER\" from \"%s\"received!\n",
+                           processName.c_str());
+                break;
+            }
             Interfaces interface = StringToEInterfaces(message.getElementAtIndex(3));
 
             m_prcMgr.addSenderForProcess(processName, service, interface, message.getElementAtIndex(4));
@@ -199,7 +396,13 @@ void RouDiMultiProcess::processMessage(const runtime::MqMessage& message,
         }
         else
         {
-            capro::ServiceDescription service(cxx::Serialization(message.getElementAtIndex(2)));
+            capro::ServiceDescription service;
+            if (!capro::ServiceDescription::fromWireFormat(message.getElementAtIndex(2), service))
+            {
+                ERR_PRINTF("Invalid service description for \"MqMessageType::IMPL_RECEIVER\" from \"%s\"received!\n",
+                           processName.c_str());
+                break;
+            }
             Interfaces interface = StringToEInterfaces(message.getElementAtIndex(3));
 
             m_prcMgr.addReceiverForProcess(processName, service, interface, message.getElementAtIndex(4));
@@ -272,7 +475,13 @@ void RouDiMultiProcess::processMessage(const runtime::MqMessage& message,
         }
         else
         {
-            capro::ServiceDescription service(cxx::Serialization(message.getElementAtIndex(2)));
+            capro::ServiceDescription service;
+            if (!capro::ServiceDescription::fromWireFormat(message.getElementAtIndex(2), service))
+            {
+                ERR_PRINTF("Invalid service description for \"MqMessageType::FIND_SERVICE\" from \"%s\"received!\n",
+                           processName.c_str());
+                break;
+            }
 
             m_prcMgr.findServiceForProcess(processName, service);
         }
@@ -283,6 +492,19 @@ void RouDiMultiProcess::processMessage(const runtime::MqMessage& message,
         m_prcMgr.updateLivlinessOfProcess(processName);
         break;
     }
+    case runtime::MqMessageType::CREATE_COMMAND_CHANNEL:
+    {
+        if (message.getNumberOfElements() != 2)
+        {
+            ERR_PRINTF("Wrong number of parameter for \"MqMessageType::CREATE_COMMAND_CHANNEL\" from \"%s\"received!\n",
+                       processName.c_str());
+        }
+        else
+        {
+            m_prcMgr.createCommandChannelForProcess(processName);
+        }
+        break;
+    }
     default:
     {
         ERR_PRINTF("Unknown MQ Command [%s]\n", runtime::mqMessageTypeToString(cmd).c_str());
@@ -293,17 +515,36 @@ void RouDiMultiProcess::processMessage(const runtime::MqMessage& message,
     }
 }
 
-bool RouDiMultiProcess::registerProcess(
-    const std::string& name, int pid, posix::PosixUser user, int64_t transmissionTimestamp, const uint64_t sessionId)
+bool RouDiMultiProcess::registerProcess(const std::string& name,
+                                        int pid,
+                                        posix::PosixUser user,
+                                        int64_t transmissionTimestamp,
+                                        const uint64_t sessionId,
+                                        uint32_t keepAliveInterval_ms)
 {
     bool monitorProcess = (m_monitoringMode == RouDiApp::MonitoringMode::ON);
 
-    return m_prcMgr.registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId);
+    // the requested interval is bounded; too short would let the monitoring
+    // burn cycles, too long would delay the failure detection unreasonably
+    auto l_clampedInterval_ms = keepAliveInterval_ms;
+    l_clampedInterval_ms = std::max(l_clampedInterval_ms, PROCESS_KEEP_ALIVE_INTERVAL_MIN.milliSeconds<uint32_t>());
+    l_clampedInterval_ms = std::min(l_clampedInterval_ms, PROCESS_KEEP_ALIVE_INTERVAL_MAX.milliSeconds<uint32_t>());
+    if (l_clampedInterval_ms != keepAliveInterval_ms)
+    {
+        WARN_PRINTF("Application %s requested a keep alive interval of %u ms - clamping it to %u ms\n",
+                    name.c_str(),
+                    keepAliveInterval_ms,
+                    l_clampedInterval_ms);
+    }
+
+    return m_prcMgr.registerProcess(
+        name, pid, user, monitorProcess, transmissionTimestamp, sessionId, l_clampedInterval_ms);
 }
 
 uint64_t RouDiMultiProcess::getUniqueSessionIdForProcess()
 {
-    static uint64_t sessionId = 0;
+    // the registration workers draw session ids concurrently
+    static std::atomic<uint64_t> sessionId{0u};
     return ++sessionId;
 }
 
@@ -312,7 +553,8 @@ bool RouDiMultiProcess::cleanupBeforeStart()
     // this temporary object will create a roudi mqueue and close it immediatelly
     // if there was an outdated roudi message queue, it will be cleaned up
     // if there is an outdated mqueue, the start of the apps will be terminated
-    runtime::MqBase::cleanupOutdatedMessageQueue(MQ_ROUDI_NAME);
+    runtime::MqBase::cleanupOutdatedMessageQueue(runtime::PoshDomain::getRoudiMqName());
+    StartupProfiler::instance().phaseDone("mq cleanup");
     return true;
 }
 
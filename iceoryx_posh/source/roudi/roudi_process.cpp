@@ -19,8 +19,11 @@
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
+#include <utility>
+#include <vector>
 
 namespace iox
 {
@@ -31,12 +34,20 @@ RouDiProcess::RouDiProcess(std::string name,
                            mepoo::MemoryManager* payloadMemoryManager,
                            bool isMonitored,
                            const uint64_t payloadSegmentId,
-                           const uint64_t sessionId)
+                           const uint64_t sessionId,
+                           const uint32_t keepAliveInterval_ms,
+                           const ProcessPriority priority)
     : m_pid(pid)
     , m_mq(name)
     , m_timestamp(mepoo::BaseClock::now())
     , m_payloadMemoryManager(payloadMemoryManager)
     , m_isMonitored(isMonitored)
+    // a LOW priority process is not worth a frequent liveness check; relaxing
+    // the interval also relaxes the timeout since it is a multiple of it
+    , m_keepAliveInterval_ms(priority == ProcessPriority::LOW
+                                 ? keepAliveInterval_ms * PROCESS_LOW_PRIORITY_MONITORING_RELAXATION
+                                 : keepAliveInterval_ms)
+    , m_priority(priority)
     , m_payloadSegmentId(payloadSegmentId)
     , m_sessionId(sessionId)
 {
@@ -52,11 +63,47 @@ const std::string& RouDiProcess::getName() const
     return m_mq.getInterfaceName();
 }
 
+thread_local runtime::RuntimeCommandChannel* RouDiProcess::s_replyChannel{nullptr};
+
 void RouDiProcess::sendToMQ(const runtime::MqMessage& f_data)
 {
+    // responses are routed back over the channel the request arrived on; the
+    // mqueue carries responses to mqueue requests and serves as fallback
+    if (s_replyChannel != nullptr && s_replyChannel->sendResponse(f_data))
+    {
+        return;
+    }
     m_mq.send(f_data);
 }
 
+void RouDiProcess::setReplyChannel(runtime::RuntimeCommandChannel* const f_replyChannel)
+{
+    s_replyChannel = f_replyChannel;
+}
+
+void RouDiProcess::addCommandChannel(runtime::RuntimeCommandChannel* const f_commandChannel)
+{
+    m_commandChannels.push_back(f_commandChannel);
+}
+
+const std::vector<runtime::RuntimeCommandChannel*>& RouDiProcess::getCommandChannels() const
+{
+    return m_commandChannels;
+}
+
+void RouDiProcess::updateHeartbeat()
+{
+    if (!m_commandChannels.empty())
+    {
+        auto heartbeat = m_commandChannels.front()->getHeartbeatCount();
+        if (heartbeat != m_lastHeartbeatCount)
+        {
+            m_lastHeartbeatCount = heartbeat;
+            setTimestamp(mepoo::BaseClock::now());
+        }
+    }
+}
+
 uint64_t RouDiProcess::getSessionId()
 {
     return m_sessionId.load(std::memory_order_relaxed);
@@ -87,9 +134,60 @@ bool RouDiProcess::isMonitored() const
     return m_isMonitored;
 }
 
+uint32_t RouDiProcess::getKeepAliveInterval_ms() const
+{
+    return m_keepAliveInterval_ms;
+}
+
+uint32_t RouDiProcess::getKeepAliveTimeout_ms() const
+{
+    return m_keepAliveInterval_ms * PROCESS_KEEP_ALIVE_TIMEOUT_FACTOR;
+}
+
+ProcessPriority RouDiProcess::getPriority() const
+{
+    return m_priority;
+}
+
+void RouDiProcess::setReclaimablePorts(const std::vector<SenderPortType::MemberType_t*>& f_senderPorts,
+                                       const std::vector<ReceiverPortType::MemberType_t*>& f_receiverPorts)
+{
+    m_reclaimableSenderPorts = f_senderPorts;
+    m_reclaimableReceiverPorts = f_receiverPorts;
+}
+
+SenderPortType::MemberType_t* RouDiProcess::takeReclaimableSenderPort(const capro::ServiceDescription& f_service)
+{
+    for (auto it = m_reclaimableSenderPorts.begin(); it != m_reclaimableSenderPorts.end(); ++it)
+    {
+        if (f_service == SenderPortType(*it).getCaProServiceDescription())
+        {
+            auto l_port = *it;
+            m_reclaimableSenderPorts.erase(it);
+            return l_port;
+        }
+    }
+    return nullptr;
+}
+
+ReceiverPortType::MemberType_t* RouDiProcess::takeReclaimableReceiverPort(const capro::ServiceDescription& f_service)
+{
+    for (auto it = m_reclaimableReceiverPorts.begin(); it != m_reclaimableReceiverPorts.end(); ++it)
+    {
+        if (f_service == ReceiverPortType(*it).getCaProServiceDescription())
+        {
+            auto l_port = *it;
+            m_reclaimableReceiverPorts.erase(it);
+            return l_port;
+        }
+    }
+    return nullptr;
+}
+
 //--------------------------------------------------------------------------------------------------
 
-ProcessManager::ProcessManager(SharedMemoryManager& f_shmMgr)
+ProcessManager::ProcessManager(SharedMemoryManager& f_shmMgr,
+                               const posix::ThreadAttributes& f_portReclaimerThreadAttributes)
     : m_shmMgr(f_shmMgr)
 {
     auto currentUser = posix::PosixUser::getUserOfCurrentProcess();
@@ -97,21 +195,137 @@ ProcessManager::ProcessManager(SharedMemoryManager& f_shmMgr)
         m_shmMgr.getShmInterface().getShmInterface()->m_segmentManager.getSegmentInformationForUser(currentUser);
     m_memoryManagerOfCurrentProcess = m_segmentInfo.m_memoryManager;
     m_segmentIdOfCurrentProcess = m_segmentInfo.m_segmentID;
+
+    m_portReclaimerThread = std::thread(&ProcessManager::portReclaimerMain, this);
+    posix::applyThreadAttributes(m_portReclaimerThread.native_handle(), f_portReclaimerThreadAttributes);
 }
 
-void ProcessManager::killAllProcesses()
+ProcessManager::~ProcessManager()
 {
-    std::lock_guard<std::mutex> g(m_mutex);
+    m_portReclaimerRunning.store(false, std::memory_order_relaxed);
+    m_portReclaimerTrigger.notify_all();
+    if (m_portReclaimerThread.joinable())
+    {
+        m_portReclaimerThread.join();
+    }
 
-    // send SIGTERM to all running applications
-    typename ProcessList_t::iterator l_it = m_processList.begin();
-    const typename ProcessList_t::iterator l_itEnd = m_processList.end();
+    std::lock_guard<std::mutex> g(m_monitoringClassesMutex);
+    for (auto& monitoringClass : m_monitoringClasses)
+    {
+        if (monitoringClass->m_taskRegistered)
+        {
+            posix::TimingWheel::instance().stopTask(monitoringClass->m_task);
+            posix::TimingWheel::instance().unregisterTask(monitoringClass->m_task);
+        }
+    }
+}
 
-    for (; l_itEnd != l_it; ++l_it)
+void ProcessManager::reclaimPortsOfProcessAsync(const std::string& f_name, const ProcessPriority f_priority)
+{
+    {
+        std::lock_guard<std::mutex> g(m_portReclaimerMutex);
+        // keep the queue ordered by descending priority tier so the reclaimer
+        // frees the chunks of the traffic critical processes first; within one
+        // tier the processes are reclaimed in the order they died
+        auto it = m_pendingPortReclamations.begin();
+        while (it != m_pendingPortReclamations.end() && it->m_priority >= f_priority)
+        {
+            ++it;
+        }
+        m_pendingPortReclamations.insert(it, {f_name, f_priority});
+    }
+    m_portReclaimerTrigger.notify_one();
+}
+
+void ProcessManager::flushPendingPortReclamation(const std::string& f_name)
+{
+    bool l_wasPending = false;
     {
-        if (-1 == kill(static_cast<pid_t>(l_it->getPid()), 15))
+        std::unique_lock<std::mutex> l_lock(m_portReclaimerMutex);
+
+        for (auto it = m_pendingPortReclamations.begin(); it != m_pendingPortReclamations.end(); ++it)
         {
-            WARN_PRINTF("Process %d could not be killed\n", l_it->getPid());
+            if (it->m_name == f_name)
+            {
+                m_pendingPortReclamations.erase(it);
+                l_wasPending = true;
+                break;
+            }
+        }
+
+        if (m_reclamationInProgress == f_name)
+        {
+            l_wasPending = true;
+            // the reclaimer notifies when it finished the process it works on
+            m_portReclaimerTrigger.wait(l_lock, [&] { return m_reclamationInProgress != f_name; });
+        }
+    }
+
+    if (l_wasPending)
+    {
+        // delete whatever is left synchronously; the process must not find
+        // ports of its previous incarnation which are about to be swept away
+        std::lock_guard<std::mutex> g(m_mutex);
+        m_shmMgr.deletePortsOfProcess(f_name);
+    }
+}
+
+void ProcessManager::portReclaimerMain()
+{
+    while (m_portReclaimerRunning.load(std::memory_order_relaxed))
+    {
+        {
+            std::unique_lock<std::mutex> l_lock(m_portReclaimerMutex);
+            m_portReclaimerTrigger.wait(l_lock, [&] {
+                return !m_pendingPortReclamations.empty()
+                       || !m_portReclaimerRunning.load(std::memory_order_relaxed);
+            });
+            if (!m_portReclaimerRunning.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+            m_reclamationInProgress = m_pendingPortReclamations.front().m_name;
+            m_pendingPortReclamations.erase(m_pendingPortReclamations.begin());
+        }
+
+        bool l_portDeleted = true;
+        while (l_portDeleted && m_portReclaimerRunning.load(std::memory_order_relaxed))
+        {
+            {
+                std::lock_guard<std::mutex> g(m_mutex);
+                l_portDeleted = m_shmMgr.deleteNextPortOfProcess(m_reclamationInProgress);
+            }
+            // m_mutex is dropped between the ports so that discovery and
+            // process registration can interleave with the reclamation
+            std::this_thread::yield();
+        }
+
+        {
+            std::lock_guard<std::mutex> g(m_portReclaimerMutex);
+            m_reclamationInProgress.clear();
+        }
+        m_portReclaimerTrigger.notify_all();
+    }
+}
+
+ProcessManager::ProcessShard& ProcessManager::shardFor(const std::string& f_name)
+{
+    return m_processShards[std::hash<std::string>()(f_name) % PROCESS_SHARD_COUNT];
+}
+
+void ProcessManager::killAllProcesses()
+{
+    // send SIGTERM to all running applications
+    for (auto& shard : m_processShards)
+    {
+        std::lock_guard<std::mutex> g(shard.m_mutex);
+
+        for (auto& process : shard.m_processList)
+        {
+            if (-1 == kill(static_cast<pid_t>(process.getPid()), 15))
+            {
+                WARN_PRINTF("Process %d could not be killed\n", process.getPid());
+            }
         }
     }
 }
@@ -121,12 +335,19 @@ bool ProcessManager::registerProcess(const std::string& name,
                                      posix::PosixUser user,
                                      bool isMonitored,
                                      int64_t transmissionTimestamp,
-                                     const uint64_t sessionId)
+                                     const uint64_t sessionId,
+                                     const uint32_t keepAliveInterval_ms,
+                                     const ProcessPriority priority)
 {
+    // a reclamation of the previous incarnation which is queued or running in
+    // the background has to be finished before the process recreates its ports
+    flushPendingPortReclamation(name);
+
     bool wasPreviouslyMonitored; // must be in outer scope but is only initialized before use
     bool processExists = false;
     {
-        std::lock_guard<std::mutex> g(m_mutex);
+        auto& l_shard = shardFor(name);
+        std::lock_guard<std::mutex> g(l_shard.m_mutex);
         auto process = getProcessFromList(name); // process existence check
         if (process)
         {
@@ -153,7 +374,9 @@ bool ProcessManager::registerProcess(const std::string& name,
                           isMonitored,
                           transmissionTimestamp,
                           segmentInfo.m_segmentID,
-                          sessionId);
+                          sessionId,
+                          keepAliveInterval_ms,
+                          priority);
     }
 
     // process is already in list (i.e. registered)
@@ -191,7 +414,9 @@ bool ProcessManager::registerProcess(const std::string& name,
                           isMonitored,
                           transmissionTimestamp,
                           segmentInfo.m_segmentID,
-                          sessionId); // call will acquire lock
+                          sessionId,
+                          keepAliveInterval_ms,
+                          priority); // call will acquire lock
     }
 
     return false;
@@ -203,17 +428,57 @@ bool ProcessManager::addProcess(const std::string& name,
                                 bool isMonitored,
                                 int64_t transmissionTimestamp,
                                 const uint64_t payloadSegmentId,
-                                const uint64_t sessionId)
+                                const uint64_t sessionId,
+                                const uint32_t keepAliveInterval_ms,
+                                const ProcessPriority priority)
 {
     std::lock_guard<std::mutex> g(m_mutex);
-    // overflow check
-    if (m_processList.size() >= MAX_PROCESS_NUMBER)
+    auto& l_shard = shardFor(name);
+    std::lock_guard<std::mutex> gs(l_shard.m_mutex);
+    // overflow check over all shards
+    if (m_processCount.load(std::memory_order_relaxed) >= MAX_PROCESS_NUMBER)
     {
         LOG_ERR("Could not register process - too many processes");
         return false;
     }
 
-    m_processList.emplace_back(name, pid, payloadMemoryManager, isMonitored, payloadSegmentId, sessionId);
+    l_shard.m_processList.emplace_back(
+        name, pid, payloadMemoryManager, isMonitored, payloadSegmentId, sessionId, keepAliveInterval_ms, priority);
+    m_processCount.fetch_add(1u, std::memory_order_relaxed);
+
+    if (isMonitored)
+    {
+        // the process already applied the relaxation of its priority tier
+        ensureMonitoringIntervalClass(l_shard.m_processList.back().getKeepAliveInterval_ms());
+    }
+
+    // if the ports of a previous incarnation of this process are still
+    // retained this is a warm restart; the new incarnation reclaims the
+    // sender and receiver ports instead of recreating each of them, only the
+    // interface ports, application ports and runnables start from scratch
+    for (auto it = m_retainedPorts.begin(); it != m_retainedPorts.end(); ++it)
+    {
+        if (it->m_name == name)
+        {
+            std::vector<SenderPortType::MemberType_t*> l_senderPorts;
+            std::vector<ReceiverPortType::MemberType_t*> l_receiverPorts;
+            m_shmMgr.collectPortsOfProcess(name, l_senderPorts, l_receiverPorts);
+            m_shmMgr.deleteRuntimeObjectsOfProcess(name);
+            l_shard.m_processList.back().setReclaimablePorts(l_senderPorts, l_receiverPorts);
+            m_retainedPorts.erase(it);
+            DEBUG_PRINTF("Warm restart of application %s - %lu ports can be reclaimed\n",
+                         name.c_str(),
+                         static_cast<unsigned long>(l_senderPorts.size() + l_receiverPorts.size()));
+            break;
+        }
+    }
+
+    // the command channel for the runtime requests following the registration
+    auto l_commandChannel = m_shmMgr.acquireCommandChannel();
+    if (nullptr == l_commandChannel)
+    {
+        WARN_PRINTF("No command channel left for application %s - falling back to the message queue\n", name.c_str());
+    }
 
     // send REG_ACK and BaseAddrString
     runtime::MqMessage l_sendBuffer;
@@ -221,13 +486,31 @@ bool ProcessManager::addProcess(const std::string& name,
     auto mgmtSegmentId = m_shmMgr.getShmInterface().getShmInterface()->m_segmentId;
     auto offset =
         RelativePointer::getOffset(mgmtSegmentId, &m_shmMgr.getShmInterface().getShmInterface()->m_segmentManager);
-    l_sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::REG_ACK) << m_shmMgr.GetShmAddrString()
-                 << m_shmMgr.getShmSizeInBytes() << offset << transmissionTimestamp << mgmtSegmentId;
+    RelativePointer::offset_t l_commandChannelOffset{0u};
+    if (l_commandChannel != nullptr)
+    {
+        l_commandChannelOffset = RelativePointer::getOffset(mgmtSegmentId, l_commandChannel);
+    }
+    // offset of the introspection snapshot region so monitoring consumers can
+    // sample it directly from the management segment
+    auto l_introspectionSnapshotsOffset = RelativePointer::getOffset(
+        mgmtSegmentId, &m_shmMgr.getShmInterface().getShmInterface()->m_introspectionSnapshots);
 
-    m_processList.back().sendToMQ(l_sendBuffer);
+    l_sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::REG_ACK) << m_shmMgr.GetShmAddrString()
+                 << m_shmMgr.getShmSizeInBytes() << offset << transmissionTimestamp << mgmtSegmentId
+                 << l_commandChannelOffset << m_uniqueIdRangeCounter.fetch_add(1u, std::memory_order_relaxed)
+                 << l_introspectionSnapshotsOffset;
+
+    // the REG_ACK itself has to go over the mqueue since the application does
+    // not know the channel before it received the offset
+    l_shard.m_processList.back().sendToMQ(l_sendBuffer);
+    if (l_commandChannel != nullptr)
+    {
+        l_shard.m_processList.back().addCommandChannel(l_commandChannel);
+    }
 
     // set current timestamp again (already done in RouDiProcess's constructor
-    m_processList.back().setTimestamp(mepoo::BaseClock::now());
+    l_shard.m_processList.back().setTimestamp(mepoo::BaseClock::now());
 
     m_processIntrospection->addProcess(pid, cxx::CString100(name.c_str()));
 
@@ -238,20 +521,28 @@ bool ProcessManager::addProcess(const std::string& name,
 bool ProcessManager::removeProcess(const std::string& f_name)
 {
     std::lock_guard<std::mutex> g(m_mutex);
-    // we need to search for the process (currently linear search)
+    auto& l_shard = shardFor(f_name);
+    std::lock_guard<std::mutex> gs(l_shard.m_mutex);
+    // we need to search for the process (currently linear search within its shard)
 
-    auto it = m_processList.begin();
-    while (it != m_processList.end())
+    auto it = l_shard.m_processList.begin();
+    while (it != l_shard.m_processList.end())
     {
         auto name = it->getName();
         if (name == f_name)
         {
             m_shmMgr.deletePortsOfProcess(name);
 
+            for (auto channel : it->getCommandChannels())
+            {
+                m_shmMgr.releaseCommandChannel(channel);
+            }
+
             m_processIntrospection->removeProcess(it->getPid());
 
             // delete application
-            it = m_processList.erase(it);
+            it = l_shard.m_processList.erase(it);
+            m_processCount.fetch_sub(1u, std::memory_order_relaxed);
 
             DEBUG_PRINTF("New Registration - removed existing application %s\n", f_name.c_str());
             return true; // we can assume there are no other processes with this name
@@ -265,7 +556,8 @@ bool ProcessManager::sendMessageToProcess(const std::string& name,
                                           const iox::runtime::MqMessage& message,
                                           const uint64_t sessionId)
 {
-    std::lock_guard<std::mutex> g(m_mutex);
+    auto& l_shard = shardFor(name);
+    std::lock_guard<std::mutex> g(l_shard.m_mutex);
 
     RouDiProcess* process = getProcessFromList(name);
     if (process == nullptr)
@@ -292,7 +584,10 @@ bool ProcessManager::sendMessageToProcess(const std::string& name,
 
 void ProcessManager::updateLivlinessOfProcess(const std::string& f_name)
 {
-    std::lock_guard<std::mutex> g(m_mutex);
+    // the keep alive handling only needs the shard of this process, it never
+    // contends with the monitoring or cleanup of processes in other shards
+    auto& l_shard = shardFor(f_name);
+    std::lock_guard<std::mutex> g(l_shard.m_mutex);
 
     RouDiProcess* l_process = getProcessFromList(f_name);
     if (nullptr != l_process)
@@ -309,6 +604,8 @@ void ProcessManager::updateLivlinessOfProcess(const std::string& f_name)
 void ProcessManager::findServiceForProcess(const std::string& f_name, const capro::ServiceDescription& f_service)
 {
     std::lock_guard<std::mutex> g(m_mutex);
+    auto& l_shard = shardFor(f_name);
+    std::lock_guard<std::mutex> gs(l_shard.m_mutex);
 
     RouDiProcess* l_process = getProcessFromList(f_name);
     if (nullptr != l_process)
@@ -323,11 +620,46 @@ void ProcessManager::findServiceForProcess(const std::string& f_name, const capr
     }
 }
 
+void ProcessManager::createCommandChannelForProcess(const std::string& f_name)
+{
+    std::lock_guard<std::mutex> g(m_mutex);
+    auto& l_shard = shardFor(f_name);
+    std::lock_guard<std::mutex> gs(l_shard.m_mutex);
+
+    RouDiProcess* l_process = getProcessFromList(f_name);
+    if (nullptr != l_process)
+    {
+        auto l_channel = m_shmMgr.acquireCommandChannel();
+        RelativePointer::offset_t l_offset{0u};
+        if (l_channel != nullptr)
+        {
+            auto mgmtSegmentId = m_shmMgr.getShmInterface().getShmInterface()->m_segmentId;
+            l_offset = RelativePointer::getOffset(mgmtSegmentId, l_channel);
+            l_process->addCommandChannel(l_channel);
+        }
+        else
+        {
+            WARN_PRINTF("No command channel left for application %s\n", f_name.c_str());
+        }
+
+        runtime::MqMessage l_sendBuffer;
+        l_sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::CREATE_COMMAND_CHANNEL_ACK)
+                     << std::to_string(l_offset);
+        l_process->sendToMQ(l_sendBuffer);
+    }
+    else
+    {
+        WARN_PRINTF("Unknown application %s requested a command channel.\n", f_name.c_str());
+    }
+}
+
 void ProcessManager::addInterfaceForProcess(const std::string& f_name,
                                             Interfaces f_interface,
                                             const std::string& f_runnable)
 {
     std::lock_guard<std::mutex> g(m_mutex);
+    auto& l_shard = shardFor(f_name);
+    std::lock_guard<std::mutex> gs(l_shard.m_mutex);
 
     RouDiProcess* l_process = getProcessFromList(f_name);
     if (nullptr != l_process)
@@ -355,6 +687,8 @@ void ProcessManager::addInterfaceForProcess(const std::string& f_name,
 void ProcessManager::sendServiceRegistryChangeCounterToProcess(const std::string& processName)
 {
     std::lock_guard<std::mutex> g(m_mutex);
+    auto& l_shard = shardFor(processName);
+    std::lock_guard<std::mutex> gs(l_shard.m_mutex);
     RouDiProcess* l_process = getProcessFromList(processName);
     if (nullptr != l_process)
     {
@@ -377,6 +711,8 @@ void ProcessManager::sendServiceRegistryChangeCounterToProcess(const std::string
 void ProcessManager::addApplicationForProcess(const std::string& f_name, Interfaces f_interface)
 {
     std::lock_guard<std::mutex> g(m_mutex);
+    auto& l_shard = shardFor(f_name);
+    std::lock_guard<std::mutex> gs(l_shard.m_mutex);
 
     RouDiProcess* l_process = getProcessFromList(f_name);
     if (nullptr != l_process)
@@ -402,6 +738,8 @@ void ProcessManager::addApplicationForProcess(const std::string& f_name, Interfa
 void ProcessManager::addRunnableForProcess(const std::string& f_process, const std::string& f_runnable)
 {
     std::lock_guard<std::mutex> g(m_mutex);
+    auto& l_shard = shardFor(f_process);
+    std::lock_guard<std::mutex> gs(l_shard.m_mutex);
 
     RouDiProcess* l_process = getProcessFromList(f_process);
     if (nullptr != l_process)
@@ -425,6 +763,8 @@ void ProcessManager::addRunnableForProcess(const std::string& f_process, const s
 void ProcessManager::removeRunnableForProcess(const std::string& f_process, const std::string& f_runnable)
 {
     std::lock_guard<std::mutex> g(m_mutex);
+    auto& l_shard = shardFor(f_process);
+    std::lock_guard<std::mutex> gs(l_shard.m_mutex);
 
     RouDiProcess* l_process = getProcessFromList(f_process);
     if (nullptr != l_process)
@@ -442,7 +782,8 @@ void ProcessManager::removeRunnableForProcess(const std::string& f_process, cons
 
 void ProcessManager::sendMessageNotSupportedToRuntime(const std::string& f_name)
 {
-    std::lock_guard<std::mutex> g(m_mutex);
+    auto& l_shard = shardFor(f_name);
+    std::lock_guard<std::mutex> g(l_shard.m_mutex);
 
     RouDiProcess* l_process = getProcessFromList(f_name);
     if (nullptr != l_process)
@@ -461,10 +802,30 @@ void ProcessManager::addReceiverForProcess(const std::string& f_name,
                                            const std::string& f_runnable)
 {
     std::lock_guard<std::mutex> g(m_mutex);
+    auto& l_shard = shardFor(f_name);
+    std::lock_guard<std::mutex> gs(l_shard.m_mutex);
 
     RouDiProcess* l_process = getProcessFromList(f_name);
     if (nullptr != l_process)
     {
+        // a warm restarting process reclaims the receiver port of its previous
+        // incarnation; the port is still subscribed so data flows again
+        // without a new discovery round trip
+        ReceiverPortType::MemberType_t* l_reclaimed = l_process->takeReclaimableReceiverPort(f_service);
+        if (nullptr != l_reclaimed)
+        {
+            RelativePointer::id_t segmentId = m_shmMgr.getShmInterface().getSegmentId();
+            auto offset = RelativePointer::getOffset(segmentId, l_reclaimed);
+
+            runtime::MqMessage l_sendBuffer;
+            l_sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::IMPL_RECEIVER_ACK)
+                         << std::to_string(offset) << std::to_string(segmentId);
+            l_process->sendToMQ(l_sendBuffer);
+
+            DEBUG_PRINTF("Application %s reclaimed its ReceiverPortImpl after a warm restart\n", f_name.c_str());
+            return;
+        }
+
         // create a ReceiverPort
         ReceiverPortType::MemberType_t* l_receiver =
             m_shmMgr.acquireReceiverPortData(f_service, f_interface, f_name, f_runnable);
@@ -492,10 +853,30 @@ void ProcessManager::addSenderForProcess(const std::string& f_name,
                                          const std::string& f_runnable)
 {
     std::lock_guard<std::mutex> g(m_mutex);
+    auto& l_shard = shardFor(f_name);
+    std::lock_guard<std::mutex> gs(l_shard.m_mutex);
 
     RouDiProcess* l_process = getProcessFromList(f_name);
     if (nullptr != l_process)
     {
+        // a warm restarting process reclaims the sender port of its previous
+        // incarnation; the port is still offered and its subscriptions stay
+        // intact, so data flows again without a new discovery round trip
+        SenderPortType::MemberType_t* l_reclaimed = l_process->takeReclaimableSenderPort(f_service);
+        if (nullptr != l_reclaimed)
+        {
+            RelativePointer::id_t segmentId = m_shmMgr.getShmInterface().getSegmentId();
+            auto offset = RelativePointer::getOffset(segmentId, l_reclaimed);
+
+            runtime::MqMessage l_sendBuffer;
+            l_sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::IMPL_SENDER_ACK)
+                         << std::to_string(offset) << std::to_string(segmentId);
+            l_process->sendToMQ(l_sendBuffer);
+
+            DEBUG_PRINTF("Application %s reclaimed its SenderPortImpl after a warm restart\n", f_name.c_str());
+            return;
+        }
+
         // create a SenderPort
         auto l_sender = m_shmMgr.acquireSenderPortData(
             f_service, f_interface, f_name, l_process->getPayloadMemoryManager(), f_runnable);
@@ -540,7 +921,11 @@ void ProcessManager::run()
 {
     monitorProcesses();
     discoveryUpdate();
-    std::this_thread::sleep_for(std::chrono::milliseconds(DISCOVERY_INTERVAL.milliSeconds<int64_t>()));
+    // block until a port signals a pending CaPro state change instead of sleeping
+    // the full interval unconditionally; the timeout keeps the cyclic process
+    // monitoring alive when nothing happens
+    m_shmMgr.getShmInterface().getShmInterface()->m_discoverySignal.timedWait(
+        DISCOVERY_INTERVAL.milliSeconds<uint32_t>());
 }
 
 SenderPortType ProcessManager::addIntrospectionSenderPort(const capro::ServiceDescription& f_service,
@@ -595,8 +980,9 @@ RouDiProcess* ProcessManager::getProcessFromList(const std::string& f_name)
 {
     RouDiProcess* l_processPtr = nullptr;
 
-    typename ProcessList_t::iterator l_it = m_processList.begin();
-    const typename ProcessList_t::iterator l_itEnd = m_processList.end();
+    auto& l_processList = shardFor(f_name).m_processList;
+    typename ProcessList_t::iterator l_it = l_processList.begin();
+    const typename ProcessList_t::iterator l_itEnd = l_processList.end();
 
     for (; l_itEnd != l_it; ++l_it)
     {
@@ -610,45 +996,165 @@ RouDiProcess* ProcessManager::getProcessFromList(const std::string& f_name)
     return l_processPtr;
 }
 
+void ProcessManager::ensureMonitoringIntervalClass(const uint32_t f_keepAliveInterval_ms)
+{
+    std::lock_guard<std::mutex> g(m_monitoringClassesMutex);
+    for (auto& monitoringClass : m_monitoringClasses)
+    {
+        if (monitoringClass->m_interval_ms == f_keepAliveInterval_ms)
+        {
+            return;
+        }
+    }
+
+    m_monitoringClasses.emplace_back(new MonitoringIntervalClass());
+    auto& l_class = *m_monitoringClasses.back();
+    l_class.m_interval_ms = f_keepAliveInterval_ms;
+
+    // the address of the class is stable, the vector only holds the pointer
+    auto l_task = posix::TimingWheel::instance().registerTask(
+        [&l_class]() { l_class.m_due.store(true, std::memory_order_relaxed); });
+    if (l_task.has_value())
+    {
+        l_class.m_task = *l_task;
+        l_class.m_taskRegistered = true;
+        posix::TimingWheel::instance().startTask(
+            l_class.m_task, units::Duration::milliseconds(static_cast<unsigned long long>(f_keepAliveInterval_ms)), true);
+    }
+    else
+    {
+        // without a timing wheel task the class stays permanently due and its
+        // processes are checked with every monitoring cycle as before
+        WARN_PRINTF("No timing wheel task left for the %u ms keep alive interval class\n", f_keepAliveInterval_ms);
+    }
+}
+
 void ProcessManager::monitorProcesses()
 {
-    std::lock_guard<std::mutex> g(m_mutex);
+    // collect the interval classes whose timing wheel task fired since the
+    // last cycle; with nothing due the scan is skipped entirely, so the idle
+    // monitoring cost scales with the keep alive cadence the processes asked
+    // for and not with every DISCOVERY_INTERVAL wakeup times the fleet size
+    std::vector<uint32_t> l_dueIntervals_ms;
+    {
+        std::lock_guard<std::mutex> g(m_monitoringClassesMutex);
+        for (auto& monitoringClass : m_monitoringClasses)
+        {
+            bool l_due = monitoringClass->m_taskRegistered
+                             ? monitoringClass->m_due.exchange(false, std::memory_order_relaxed)
+                             : true;
+            if (l_due)
+            {
+                l_dueIntervals_ms.push_back(monitoringClass->m_interval_ms);
+            }
+        }
+    }
+    if (l_dueIntervals_ms.empty())
+    {
+        return;
+    }
 
     auto currentTimestamp = mepoo::BaseClock::now();
 
-    auto processIterator = m_processList.begin();
-    while (processIterator != m_processList.end())
+    // processes which missed their keep alive deadline; the scan only holds the
+    // lock of the shard it currently checks, so liveness updates of processes in
+    // the other shards are never stalled by it
+    struct DeadProcess
     {
-        if (processIterator->isMonitored())
-        {
-            auto timediff_ms = std::chrono::duration_cast<std::chrono::milliseconds>(currentTimestamp
-                                                                                     - processIterator->getTimestamp())
-                                   .count();
+        std::string m_name;
+        int m_pid;
+        std::vector<runtime::RuntimeCommandChannel*> m_commandChannels;
+        ProcessPriority m_priority;
+    };
+    std::vector<DeadProcess> l_deadProcesses;
+
+    for (auto& shard : m_processShards)
+    {
+        std::lock_guard<std::mutex> g(shard.m_mutex);
 
-            static_assert(PROCESS_KEEP_ALIVE_TIMEOUT > PROCESS_KEEP_ALIVE_INTERVAL, "keep alive timeout too small");
-            if (std::chrono::milliseconds(timediff_ms)
-                > std::chrono::milliseconds(PROCESS_KEEP_ALIVE_TIMEOUT.milliSeconds<int64_t>()))
+        auto processIterator = shard.m_processList.begin();
+        while (processIterator != shard.m_processList.end())
+        {
+            if (processIterator->isMonitored()
+                && std::find(l_dueIntervals_ms.begin(),
+                             l_dueIntervals_ms.end(),
+                             processIterator->getKeepAliveInterval_ms())
+                       != l_dueIntervals_ms.end())
             {
-                WARN_PRINTF("Application %s not responding (last response %d milliseconds ago) --> removing it\n",
-                            processIterator->getName().c_str(),
-                            timediff_ms);
+                // liveness of applications with a command channel is signalled
+                // by the heartbeat counter, one relaxed load per process
+                processIterator->updateHeartbeat();
+
+                auto timediff_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                       currentTimestamp - processIterator->getTimestamp())
+                                       .count();
+
+                static_assert(PROCESS_KEEP_ALIVE_TIMEOUT > PROCESS_KEEP_ALIVE_INTERVAL, "keep alive timeout too small");
+                if (std::chrono::milliseconds(timediff_ms)
+                    > std::chrono::milliseconds(static_cast<int64_t>(processIterator->getKeepAliveTimeout_ms())))
+                {
+                    WARN_PRINTF("Application %s not responding (last response %d milliseconds ago) --> removing it\n",
+                                processIterator->getName().c_str(),
+                                timediff_ms);
+
+                    l_deadProcesses.push_back({processIterator->getName(),
+                                               processIterator->getPid(),
+                                               processIterator->getCommandChannels(),
+                                               processIterator->getPriority()});
+
+                    // delete application
+                    processIterator = shard.m_processList.erase(processIterator);
+                    m_processCount.fetch_sub(1u, std::memory_order_relaxed);
+                    continue; // erase returns first element after the removed one --> skip iterator increment
+                }
+            }
+            ++processIterator;
+        }
+    }
 
-                // note: if we would want to use the removeProcess function, it would search for the process again (but
-                // we already found it and have an iterator to remove it)
+    // the port cleanup runs outside of the shard locks; it only serializes with
+    // the other shared memory operations
+    for (auto& deadProcess : l_deadProcesses)
+    {
+        std::lock_guard<std::mutex> g(m_mutex);
 
-                // delete all associated receiver and sender impl in shared
-                // memory and the associated RouDi discovery ports
-                // @todo Check if ShmManager and Process Manager end up in unintended condition
-                m_shmMgr.deletePortsOfProcess(processIterator->getName());
+        // the receiver and sender impl in shared memory are not deleted
+        // immediately; they are retained so that a restart of the process can
+        // reclaim them and data flows again without recreating each port
+        // @todo Check if ShmManager and Process Manager end up in unintended condition
+        m_retainedPorts.push_back({deadProcess.m_name, currentTimestamp, deadProcess.m_priority});
 
-                m_processIntrospection->removeProcess(processIterator->getPid());
+        for (auto channel : deadProcess.m_commandChannels)
+        {
+            m_shmMgr.releaseCommandChannel(channel);
+        }
 
-                // delete application
-                processIterator = m_processList.erase(processIterator);
-                continue; // erase returns first element after the removed one --> skip iterator increment
+        m_processIntrospection->removeProcess(deadProcess.m_pid);
+    }
+
+    // delete the ports of dead processes which were not reclaimed in time
+    {
+        std::lock_guard<std::mutex> g(m_mutex);
+
+        auto it = m_retainedPorts.begin();
+        while (it != m_retainedPorts.end())
+        {
+            auto age_ms =
+                std::chrono::duration_cast<std::chrono::milliseconds>(currentTimestamp - it->m_timestamp).count();
+            if (std::chrono::milliseconds(age_ms)
+                > std::chrono::milliseconds(PROCESS_WARM_RESTART_RETENTION.milliSeconds<int64_t>()))
+            {
+                DEBUG_PRINTF("Retained ports of application %s were not reclaimed --> deleting them\n",
+                             it->m_name.c_str());
+                // the cleanup walks all the chunks of the dead process and can
+                // take tens of milliseconds; hand it to the background reclaimer
+                // instead of stalling the monitoring and discovery cycle
+                reclaimPortsOfProcessAsync(it->m_name, it->m_priority);
+                it = m_retainedPorts.erase(it);
+                continue;
             }
+            ++it;
         }
-        ++processIterator;
     }
 }
 
@@ -13,18 +13,25 @@
 // limitations under the License.
 
 #include "iceoryx_posh/internal/roudi/shared_memory_manager.hpp"
+
+#include "iceoryx_posh/runtime/posh_domain.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/runnable.hpp"
 #include "iceoryx_utils/cxx/vector.hpp"
 #include "iceoryx_utils/error_handling/error_handling.hpp"
 
+#include <atomic>
 #include <cstdint>
+#include <map>
+#include <thread>
 
 namespace iox
 {
 namespace roudi
 {
+constexpr uint64_t MiddlewareShm::PERSISTENCE_MAGIC;
+
 Interfaces StringToEInterfaces(std::string f_str)
 {
     int32_t i;
@@ -45,24 +52,27 @@ SharedMemoryManager::SharedMemoryManager(const RouDiConfig_t& f_config)
 
     auto portGeneric = acquireSenderPortData(IntrospectionPortService,
                                              Interfaces::INTERNAL,
-                                             MQ_ROUDI_NAME,
+                                             runtime::PoshDomain::getRoudiMqName(),
                                              &m_ShmInterface.getShmInterface()->m_roudiMemoryManager)
                            .get_value();
 
     auto portThroughput = acquireSenderPortData(IntrospectionPortThroughputService,
                                                 Interfaces::INTERNAL,
-                                                MQ_ROUDI_NAME,
+                                                runtime::PoshDomain::getRoudiMqName(),
                                                 &m_ShmInterface.getShmInterface()->m_roudiMemoryManager)
                               .get_value();
 
     auto receiverPortsData = acquireSenderPortData(IntrospectionReceiverPortChangingDataService,
                                                    Interfaces::INTERNAL,
-                                                   MQ_ROUDI_NAME,
+                                                   runtime::PoshDomain::getRoudiMqName(),
                                                    &m_ShmInterface.getShmInterface()->m_roudiMemoryManager)
                                  .get_value();
 
     m_portIntrospection.registerSenderPort(portGeneric, portThroughput, receiverPortsData);
+    m_portIntrospection.registerSnapshotBuffer(
+        &m_ShmInterface.getShmInterface()->m_introspectionSnapshots.m_portTopic);
     m_portIntrospection.run();
+    StartupProfiler::instance().phaseDone("port introspection start");
 }
 
 void SharedMemoryManager::stopPortIntrospection()
@@ -79,6 +89,10 @@ void SharedMemoryManager::doDiscovery()
     handleApplications();
 
     handleInterfaces();
+
+    // the CaPro messages of this cycle reach the gateways as batches, one fifo
+    // commit per batch instead of one per message
+    flushInterfaceCaproBatches();
 }
 
 void SharedMemoryManager::handleSenderPorts()
@@ -133,6 +147,16 @@ void SharedMemoryManager::handleReceiverPorts()
 
             m_portIntrospection.reportMessage(caproMessage);
 
+            // arm or disarm the deadline tracking requested with the subscription
+            if (capro::CaproMessageType::SUB == caproMessage.m_type)
+            {
+                m_deadlineMonitor.startMonitoring(l_receiverPortData);
+            }
+            else if (capro::CaproMessageType::UNSUB == caproMessage.m_type)
+            {
+                m_deadlineMonitor.stopMonitoring(l_receiverPortData);
+            }
+
             if (!sendToAllMatchingSenderPorts(caproMessage, l_receiverPort))
             {
                 DEBUG_PRINTF("capro::SUB/UNSUB, no matching sender!!\n");
@@ -184,7 +208,7 @@ void SharedMemoryManager::handleInterfaces()
                     // do not offer on same interface
                     if (l_senderPort.getInterface() != interfacePort.getInterface())
                     {
-                        interfacePort.dispatchCaProMessage(l_caproMessage);
+                        enqueueToInterfacePort(interfacePortData, l_caproMessage);
                     }
                 }
             }
@@ -204,8 +228,7 @@ void SharedMemoryManager::handleInterfaces()
 
                 for (auto& interfacePortData : l_interfacePortsForInitialForwarding)
                 {
-                    auto interfacePort = popo::InterfacePort(interfacePortData);
-                    interfacePort.dispatchCaProMessage(l_caproMessage);
+                    enqueueToInterfacePort(interfacePortData, l_caproMessage);
                 }
             }
         }
@@ -254,51 +277,53 @@ bool SharedMemoryManager::sendToAllMatchingSenderPorts(const capro::CaproMessage
                                                        ReceiverPortType& f_receiverSource)
 {
     bool l_senderFound = false;
-    for (auto l_senderPortData : m_ShmInterface.getShmInterface()->m_senderPortMembers.content())
-    {
-        SenderPortType l_senderPort(l_senderPortData);
-        if (f_receiverSource.getCaProServiceDescription() == l_senderPort.getCaProServiceDescription())
-        {
-            auto senderResponse = l_senderPort.dispatchCaProMessage(f_message);
-            if (senderResponse.has_value())
+    // the index only returns the sender ports whose service description can match
+    m_senderPortIndex.forEachCandidate(
+        f_receiverSource.getCaProServiceDescription(), [&](SenderPortType::MemberType_t* l_senderPortData) {
+            SenderPortType l_senderPort(l_senderPortData);
+            if (f_receiverSource.getCaProServiceDescription() == l_senderPort.getCaProServiceDescription())
             {
-                // inform introspection
-                m_portIntrospection.reportMessage(senderResponse.value());
+                auto senderResponse = l_senderPort.dispatchCaProMessage(f_message);
+                if (senderResponse.has_value())
+                {
+                    // inform introspection
+                    m_portIntrospection.reportMessage(senderResponse.value());
+                }
+                l_senderFound = true;
             }
-            l_senderFound = true;
-        }
-    }
+        });
     return l_senderFound;
 }
 
 void SharedMemoryManager::sendToAllMatchingReceiverPorts(const capro::CaproMessage& f_message,
                                                          SenderPortType& f_senderSource)
 {
-    for (auto l_receiverPortData : m_ShmInterface.getShmInterface()->m_receiverPortMembers.content())
-    {
-        ReceiverPortType l_receiverPort(l_receiverPortData);
-        if (l_receiverPort.getCaProServiceDescription() == f_senderSource.getCaProServiceDescription())
-        {
-            auto receiverResponse = l_receiverPort.dispatchCaProMessage(f_message);
-
-            // if the receivers react on the change, process it immediately on sender side
-            if (receiverResponse.has_value())
+    // the index only returns the receiver ports whose service description can match
+    m_receiverPortIndex.forEachCandidate(
+        f_senderSource.getCaProServiceDescription(), [&](ReceiverPortType::MemberType_t* l_receiverPortData) {
+            ReceiverPortType l_receiverPort(l_receiverPortData);
+            if (l_receiverPort.getCaProServiceDescription() == f_senderSource.getCaProServiceDescription())
             {
-                // we only expect reaction on OFFER
-                assert(capro::CaproMessageType::OFFER == f_message.m_type);
-
-                // inform introspection
-                m_portIntrospection.reportMessage(receiverResponse.value());
+                auto receiverResponse = l_receiverPort.dispatchCaProMessage(f_message);
 
-                auto senderResponse = f_senderSource.dispatchCaProMessage(receiverResponse.value());
-                if (senderResponse.has_value())
+                // if the receivers react on the change, process it immediately on sender side
+                if (receiverResponse.has_value())
                 {
+                    // we only expect reaction on OFFER
+                    assert(capro::CaproMessageType::OFFER == f_message.m_type);
+
                     // inform introspection
-                    m_portIntrospection.reportMessage(senderResponse.value());
+                    m_portIntrospection.reportMessage(receiverResponse.value());
+
+                    auto senderResponse = f_senderSource.dispatchCaProMessage(receiverResponse.value());
+                    if (senderResponse.has_value())
+                    {
+                        // inform introspection
+                        m_portIntrospection.reportMessage(senderResponse.value());
+                    }
                 }
             }
-        }
-    }
+        });
 }
 
 void SharedMemoryManager::sendToAllMatchingInterfacePorts(const capro::CaproMessage& f_message,
@@ -310,12 +335,57 @@ void SharedMemoryManager::sendToAllMatchingInterfacePorts(const capro::CaproMess
         // not to the interface the port is located
         if (f_interfaceSource != l_interfacePort.getInterface())
         {
-            if (!l_interfacePort.dispatchCaProMessage(f_message))
-            {
-                errorHandler(Error::kROUDI_SHM__INTERFACE_FIFO_OVERFLOW);
-            }
+            enqueueToInterfacePort(l_interfacePortData, f_message);
+        }
+    }
+}
+
+void SharedMemoryManager::enqueueToInterfacePort(popo::InterfacePortData* const f_portData,
+                                                 const capro::CaproMessage& f_message)
+{
+    InterfaceCaproBatch* l_batch = nullptr;
+    for (auto& batch : m_interfaceCaproBatches)
+    {
+        if (batch.m_portData == f_portData)
+        {
+            l_batch = &batch;
+            break;
+        }
+    }
+    if (l_batch == nullptr)
+    {
+        m_interfaceCaproBatches.emplace_back();
+        l_batch = &m_interfaceCaproBatches.back();
+        l_batch->m_portData = f_portData;
+    }
+
+    l_batch->m_messages[l_batch->m_count++] = f_message;
+    if (l_batch->m_count == INTERFACE_CAPRO_BATCH_SIZE)
+    {
+        flushInterfaceCaproBatch(*l_batch);
+    }
+}
+
+void SharedMemoryManager::flushInterfaceCaproBatch(InterfaceCaproBatch& f_batch)
+{
+    iox::popo::InterfacePort l_interfacePort(f_batch.m_portData);
+    if (l_interfacePort.dispatchCaProMessages(f_batch.m_messages, f_batch.m_count) < f_batch.m_count)
+    {
+        errorHandler(Error::kROUDI_SHM__INTERFACE_FIFO_OVERFLOW);
+    }
+    f_batch.m_count = 0u;
+}
+
+void SharedMemoryManager::flushInterfaceCaproBatches()
+{
+    for (auto& batch : m_interfaceCaproBatches)
+    {
+        if (batch.m_count > 0u)
+        {
+            flushInterfaceCaproBatch(batch);
         }
     }
+    m_interfaceCaproBatches.clear();
 }
 
 bool SharedMemoryManager::areAllReceiverPortsSubscribed(std::string f_appName)
@@ -335,56 +405,349 @@ bool SharedMemoryManager::areAllReceiverPortsSubscribed(std::string f_appName)
     return numberOfReceiverPorts == numberOfConnectedReceiverPorts;
 }
 
-void SharedMemoryManager::deletePortsOfProcess(std::string f_processName)
+void SharedMemoryManager::deleteSenderPort(SenderPortType::MemberType_t* const f_port,
+                                           const std::string& f_processName)
 {
-    MiddlewareShm* const l_shm = m_ShmInterface.getShmInterface();
+    SenderPortType l_sender(f_port);
 
-    for (auto port : l_shm->m_senderPortMembers.content())
+    const auto& serviceDescription = l_sender.getCaProServiceDescription();
+    removeEntryFromServiceRegistry(serviceDescription.getServiceIDString(), serviceDescription.getInstanceIDString());
+    l_sender.cleanup();
+
+    capro::CaproMessage message(capro::CaproMessageType::STOP_OFFER, serviceDescription);
+    m_portIntrospection.reportMessage(message);
+
+    sendToAllMatchingReceiverPorts(message, l_sender);
+
+    m_portIntrospection.removeSender(f_processName, serviceDescription);
+
+    // delete sender impl from list after StopOffer was processed
+    m_senderPortIndex.remove(f_port);
+    m_ShmInterface.getShmInterface()->m_senderPortMembers.erase(f_port);
+    DEBUG_PRINTF("Deleted SenderPortImpl of application %s\n", f_processName.c_str());
+}
+
+void SharedMemoryManager::deleteReceiverPort(ReceiverPortType::MemberType_t* const f_port,
+                                             const std::string& f_processName)
+{
+    ReceiverPortType l_receiver(f_port);
+
+    // do the complete cleanup for the receiver port for being able to erase it
+    l_receiver.cleanup();
+
+    const auto& serviceDescription = l_receiver.getCaProServiceDescription();
+    capro::CaproMessage message(capro::CaproMessageType::UNSUB, serviceDescription);
+    message.m_requestPort = f_port;
+    m_portIntrospection.reportMessage(message);
+
+    sendToAllMatchingSenderPorts(message, l_receiver);
+
+    m_portIntrospection.removeReceiver(f_processName, serviceDescription);
+
+    // delete receiver impl from list after unsubscribe was processed
+    m_deadlineMonitor.stopMonitoring(f_port);
+    m_receiverPortIndex.remove(f_port);
+    m_ShmInterface.getShmInterface()->m_receiverPortMembers.erase(f_port);
+    DEBUG_PRINTF("Deleted ReceiverPortImpl of application %s\n", f_processName.c_str());
+}
+
+void SharedMemoryManager::sendDisconnectToMatchingSenderPorts(const capro::CaproMessage& f_message,
+                                                              ReceiverPortType& f_receiverSource,
+                                                              const bool f_includeKeyed,
+                                                              const bool f_includeWildcards,
+                                                              std::vector<capro::CaproMessage>& f_responses)
+{
+    auto l_dispatch = [&](SenderPortType::MemberType_t* l_senderPortData) {
+        SenderPortType l_senderPort(l_senderPortData);
+        if (f_receiverSource.getCaProServiceDescription() == l_senderPort.getCaProServiceDescription())
+        {
+            auto senderResponse = l_senderPort.dispatchCaProMessage(f_message);
+            if (senderResponse.has_value())
+            {
+                // the introspection is not thread safe, the caller reports the
+                // responses after all groups are finished
+                f_responses.push_back(senderResponse.value());
+            }
+        }
+    };
+
+    if (f_includeKeyed)
+    {
+        m_senderPortIndex.forEachKeyedCandidate(f_receiverSource.getCaProServiceDescription(), l_dispatch);
+    }
+    if (f_includeWildcards)
+    {
+        m_senderPortIndex.forEachWildcardPort(l_dispatch);
+    }
+}
+
+void SharedMemoryManager::sendDisconnectToMatchingReceiverPorts(const capro::CaproMessage& f_message,
+                                                                SenderPortType& f_senderSource,
+                                                                const bool f_includeKeyed,
+                                                                const bool f_includeWildcards)
+{
+    auto l_dispatch = [&](ReceiverPortType::MemberType_t* l_receiverPortData) {
+        ReceiverPortType l_receiverPort(l_receiverPortData);
+        if (l_receiverPort.getCaProServiceDescription() == f_senderSource.getCaProServiceDescription())
+        {
+            // a STOP_OFFER only changes the subscription state on the receiver
+            // side and produces no response
+            l_receiverPort.dispatchCaProMessage(f_message);
+        }
+    };
+
+    if (f_includeKeyed)
+    {
+        m_receiverPortIndex.forEachKeyedCandidate(f_senderSource.getCaProServiceDescription(), l_dispatch);
+    }
+    if (f_includeWildcards)
+    {
+        m_receiverPortIndex.forEachWildcardPort(l_dispatch);
+    }
+}
+
+void SharedMemoryManager::deletePortsBatch(const std::vector<SenderPortType::MemberType_t*>& f_senderPorts,
+                                           const std::vector<ReceiverPortType::MemberType_t*>& f_receiverPorts,
+                                           const std::string& f_processName)
+{
+    if (f_senderPorts.empty() && f_receiverPorts.empty())
+    {
+        return;
+    }
+
+    // serial bookkeeping first; removing the dying ports from the indices up
+    // front also means the fan-out below does not dispatch between two dying
+    // ports of the same process
+    for (auto port : f_senderPorts)
     {
         SenderPortType l_sender(port);
-        if (f_processName == l_sender.getApplicationName())
+        const auto& serviceDescription = l_sender.getCaProServiceDescription();
+        removeEntryFromServiceRegistry(serviceDescription.getServiceIDString(),
+                                       serviceDescription.getInstanceIDString());
+        l_sender.cleanup();
+        m_portIntrospection.reportMessage(capro::CaproMessage(capro::CaproMessageType::STOP_OFFER, serviceDescription));
+        m_portIntrospection.removeSender(f_processName, serviceDescription);
+        m_senderPortIndex.remove(port);
+    }
+
+    for (auto port : f_receiverPorts)
+    {
+        ReceiverPortType l_receiver(port);
+        const auto& serviceDescription = l_receiver.getCaProServiceDescription();
+        l_receiver.cleanup();
+        capro::CaproMessage message(capro::CaproMessageType::UNSUB, serviceDescription);
+        message.m_requestPort = port;
+        m_portIntrospection.reportMessage(message);
+        m_portIntrospection.removeReceiver(f_processName, serviceDescription);
+        m_deadlineMonitor.stopMonitoring(port);
+        m_receiverPortIndex.remove(port);
+    }
+
+    // group the dying ports by the hash of their service description; ports of
+    // different groups fan out to disjoint sets of keyed counterparts, so the
+    // groups can run concurrently. Ports with a wildcard ID can match anything
+    // and are kept out of the parallel phase, as are the surviving wildcard
+    // ports of the indices
+    struct PortGroup
+    {
+        std::vector<SenderPortType::MemberType_t*> m_senders;
+        std::vector<ReceiverPortType::MemberType_t*> m_receivers;
+    };
+    std::map<uint64_t, PortGroup> l_groups;
+    PortGroup l_wildcardGroup;
+
+    for (auto port : f_senderPorts)
+    {
+        const auto& service = port->m_serviceDescription;
+        if (ServicePortIndex<SenderPortType::MemberType_t>::containsWildcard(service))
+        {
+            l_wildcardGroup.m_senders.push_back(port);
+        }
+        else
         {
-            const auto& serviceDescription = l_sender.getCaProServiceDescription();
-            removeEntryFromServiceRegistry(serviceDescription.getServiceIDString(),
-                                           serviceDescription.getInstanceIDString());
-            l_sender.cleanup();
+            l_groups[service.getHash()].m_senders.push_back(port);
+        }
+    }
+    for (auto port : f_receiverPorts)
+    {
+        const auto& service = port->m_serviceDescription;
+        if (ServicePortIndex<ReceiverPortType::MemberType_t>::containsWildcard(service))
+        {
+            l_wildcardGroup.m_receivers.push_back(port);
+        }
+        else
+        {
+            l_groups[service.getHash()].m_receivers.push_back(port);
+        }
+    }
+
+    // one response collection per group plus one for the serial leftovers, so
+    // the concurrently running groups need no synchronization
+    std::vector<std::vector<capro::CaproMessage>> l_responses(l_groups.size() + 1u);
+
+    auto l_fanOutGroup = [this](const PortGroup& f_group,
+                                const bool f_includeWildcards,
+                                std::vector<capro::CaproMessage>& f_groupResponses) {
+        for (auto senderData : f_group.m_senders)
+        {
+            SenderPortType l_sender(senderData);
+            capro::CaproMessage l_message(capro::CaproMessageType::STOP_OFFER, l_sender.getCaProServiceDescription());
+            sendDisconnectToMatchingReceiverPorts(l_message, l_sender, true, f_includeWildcards);
+        }
+        for (auto receiverData : f_group.m_receivers)
+        {
+            ReceiverPortType l_receiver(receiverData);
+            capro::CaproMessage l_message(capro::CaproMessageType::UNSUB, l_receiver.getCaProServiceDescription());
+            l_message.m_requestPort = receiverData;
+            sendDisconnectToMatchingSenderPorts(l_message, l_receiver, true, f_includeWildcards, f_groupResponses);
+        }
+    };
 
-            capro::CaproMessage message(capro::CaproMessageType::STOP_OFFER, serviceDescription);
-            m_portIntrospection.reportMessage(message);
+    constexpr uint32_t TEARDOWN_WORKERS{4u};
+    if (l_groups.size() > 1u && !m_portTeardownPool.has_value())
+    {
+        m_portTeardownPool.emplace(TEARDOWN_WORKERS);
+    }
 
-            sendToAllMatchingReceiverPorts(message, l_sender);
+    if (l_groups.size() > 1u && m_portTeardownPool.has_value() && m_portTeardownPool->isInitialized())
+    {
+        std::atomic<uint32_t> l_pendingGroups{0u};
+        size_t l_groupIndex{0u};
+        for (auto& entry : l_groups)
+        {
+            const PortGroup* l_group = &entry.second;
+            std::vector<capro::CaproMessage>* l_groupResponses = &l_responses[l_groupIndex++];
+            l_pendingGroups.fetch_add(1u, std::memory_order_relaxed);
+            auto l_task = [this, l_group, l_groupResponses, &l_fanOutGroup, &l_pendingGroups] {
+                l_fanOutGroup(*l_group, false, *l_groupResponses);
+                l_pendingGroups.fetch_sub(1u, std::memory_order_release);
+            };
+            if (!m_portTeardownPool->submit(l_task))
+            {
+                // queues full, run the group on the calling thread
+                l_task();
+            }
+        }
+        while (l_pendingGroups.load(std::memory_order_acquire) != 0u)
+        {
+            std::this_thread::yield();
+        }
+    }
+    else
+    {
+        size_t l_groupIndex{0u};
+        for (auto& entry : l_groups)
+        {
+            l_fanOutGroup(entry.second, false, l_responses[l_groupIndex++]);
+        }
+    }
 
-            m_portIntrospection.removeSender(f_processName, serviceDescription);
+    // serial leftovers: the dying wildcard ports can match ports of any group
+    // and the surviving wildcard ports are shared between all groups
+    auto& l_leftoverResponses = l_responses.back();
+    l_fanOutGroup(l_wildcardGroup, true, l_leftoverResponses);
+    for (auto& entry : l_groups)
+    {
+        for (auto senderData : entry.second.m_senders)
+        {
+            SenderPortType l_sender(senderData);
+            capro::CaproMessage l_message(capro::CaproMessageType::STOP_OFFER, l_sender.getCaProServiceDescription());
+            sendDisconnectToMatchingReceiverPorts(l_message, l_sender, false, true);
+        }
+        for (auto receiverData : entry.second.m_receivers)
+        {
+            ReceiverPortType l_receiver(receiverData);
+            capro::CaproMessage l_message(capro::CaproMessageType::UNSUB, l_receiver.getCaProServiceDescription());
+            l_message.m_requestPort = receiverData;
+            sendDisconnectToMatchingSenderPorts(l_message, l_receiver, false, true, l_leftoverResponses);
+        }
+    }
 
-            // delete sender impl from list after StopOffer was processed
-            l_shm->m_senderPortMembers.erase(port);
-            DEBUG_PRINTF("Deleted SenderPortImpl of application %s\n", f_processName.c_str());
+    // inform introspection about the collected responses
+    for (auto& groupResponses : l_responses)
+    {
+        for (auto& response : groupResponses)
+        {
+            m_portIntrospection.reportMessage(response);
+        }
+    }
+
+    // the port data has to stay alive up to here; the UNSUB messages carry a
+    // pointer to the dying receiver port and the senders dispatch their ACK
+    // onto it
+    MiddlewareShm* const l_shm = m_ShmInterface.getShmInterface();
+    for (auto port : f_senderPorts)
+    {
+        l_shm->m_senderPortMembers.erase(port);
+        DEBUG_PRINTF("Deleted SenderPortImpl of application %s\n", f_processName.c_str());
+    }
+    for (auto port : f_receiverPorts)
+    {
+        l_shm->m_receiverPortMembers.erase(port);
+        DEBUG_PRINTF("Deleted ReceiverPortImpl of application %s\n", f_processName.c_str());
+    }
+}
+
+void SharedMemoryManager::deletePortsOfProcess(std::string f_processName)
+{
+    MiddlewareShm* const l_shm = m_ShmInterface.getShmInterface();
+
+    std::vector<SenderPortType::MemberType_t*> l_senderPorts;
+    std::vector<ReceiverPortType::MemberType_t*> l_receiverPorts;
+
+    for (auto port : l_shm->m_senderPortMembers.content())
+    {
+        if (f_processName == SenderPortType(port).getApplicationName())
+        {
+            l_senderPorts.push_back(port);
         }
     }
 
     for (auto port : l_shm->m_receiverPortMembers.content())
     {
-        ReceiverPortType l_receiver(port);
-        if (f_processName == l_receiver.getApplicationName())
+        if (f_processName == ReceiverPortType(port).getApplicationName())
         {
-            // do the complete cleanup for the receiver port for being able to erase it
-            l_receiver.cleanup();
+            l_receiverPorts.push_back(port);
+        }
+    }
 
-            const auto& serviceDescription = l_receiver.getCaProServiceDescription();
-            capro::CaproMessage message(capro::CaproMessageType::UNSUB, serviceDescription);
-            message.m_requestPort = port;
-            m_portIntrospection.reportMessage(message);
+    deletePortsBatch(l_senderPorts, l_receiverPorts, f_processName);
 
-            sendToAllMatchingSenderPorts(message, l_receiver);
+    deleteRuntimeObjectsOfProcess(f_processName);
+}
 
-            m_portIntrospection.removeReceiver(f_processName, serviceDescription);
+bool SharedMemoryManager::deleteNextPortOfProcess(std::string f_processName)
+{
+    MiddlewareShm* const l_shm = m_ShmInterface.getShmInterface();
+
+    for (auto port : l_shm->m_senderPortMembers.content())
+    {
+        if (f_processName == SenderPortType(port).getApplicationName())
+        {
+            deleteSenderPort(port, f_processName);
+            return true;
+        }
+    }
 
-            // delete receiver impl from list after unsubscribe was processed
-            l_shm->m_receiverPortMembers.erase(port);
-            DEBUG_PRINTF("Deleted ReceiverPortImpl of application %s\n", f_processName.c_str());
+    for (auto port : l_shm->m_receiverPortMembers.content())
+    {
+        if (f_processName == ReceiverPortType(port).getApplicationName())
+        {
+            deleteReceiverPort(port, f_processName);
+            return true;
         }
     }
 
+    // no sender or receiver port left; the remaining runtime objects are cheap
+    // to delete in one go
+    deleteRuntimeObjectsOfProcess(f_processName);
+    return false;
+}
+
+void SharedMemoryManager::deleteRuntimeObjectsOfProcess(std::string f_processName)
+{
+    MiddlewareShm* const l_shm = m_ShmInterface.getShmInterface();
+
     for (auto port : l_shm->m_interfacePortMembers.content())
     {
         popo::InterfacePort l_interface(port);
@@ -415,6 +778,29 @@ void SharedMemoryManager::deletePortsOfProcess(std::string f_processName)
     }
 }
 
+void SharedMemoryManager::collectPortsOfProcess(const std::string& f_processName,
+                                                std::vector<SenderPortType::MemberType_t*>& f_senderPorts,
+                                                std::vector<ReceiverPortType::MemberType_t*>& f_receiverPorts)
+{
+    MiddlewareShm* const l_shm = m_ShmInterface.getShmInterface();
+
+    for (auto port : l_shm->m_senderPortMembers.content())
+    {
+        if (f_processName == SenderPortType(port).getApplicationName())
+        {
+            f_senderPorts.push_back(port);
+        }
+    }
+
+    for (auto port : l_shm->m_receiverPortMembers.content())
+    {
+        if (f_processName == ReceiverPortType(port).getApplicationName())
+        {
+            f_receiverPorts.push_back(port);
+        }
+    }
+}
+
 void SharedMemoryManager::deleteRunnableAndItsPorts(std::string f_runnableName)
 {
     ERR_PRINTF("Not yet supported");
@@ -516,6 +902,9 @@ SharedMemoryManager::acquireSenderPortData(const capro::ServiceDescription& f_se
         //  we don't use the runnable reference in the ports yet. So set it to nullptr
         auto senderPortData =
             l_shm->m_senderPortMembers.insert(f_service, f_payloadMemoryManager, f_processName, f_interface, nullptr);
+        // let the port wake the discovery loop on activate/deactivate
+        senderPortData->m_discoverySignal = &l_shm->m_discoverySignal;
+        m_senderPortIndex.add(senderPortData);
         m_portIntrospection.addSender(senderPortData, f_processName, f_service, f_runnable);
         return cxx::success<SenderPortType::MemberType_t*>(senderPortData);
     }
@@ -551,6 +940,10 @@ ReceiverPortType::MemberType_t* SharedMemoryManager::acquireReceiverPortData(con
         //  we don't use the runnable reference in the ports yet. So set it to nullptr
         auto port = l_shm->m_receiverPortMembers.insert(*service, f_processName, f_interface, nullptr);
 
+        // let the port wake the discovery loop on subscribe/unsubscribe
+        port->m_discoverySignal = &l_shm->m_discoverySignal;
+        m_receiverPortIndex.add(port);
+
         m_portIntrospection.addReceiver(port, f_processName, *service, f_runnable);
 
         return port;
@@ -594,6 +987,25 @@ popo::ApplicationPortData* SharedMemoryManager::acquireApplicationPortData(Inter
     }
 }
 
+runtime::RuntimeCommandChannel* SharedMemoryManager::acquireCommandChannel()
+{
+    std::lock_guard<std::mutex> g(m_commandChannelMutex);
+    MiddlewareShm* const l_shm = m_ShmInterface.getShmInterface();
+    if (!l_shm->m_commandChannels.hasFreeSpace())
+    {
+        return nullptr;
+    }
+    auto l_channel = l_shm->m_commandChannels.insert();
+    l_channel->setRequestSignal(&l_shm->m_commandSignal);
+    return l_channel;
+}
+
+void SharedMemoryManager::releaseCommandChannel(runtime::RuntimeCommandChannel* const f_channel)
+{
+    std::lock_guard<std::mutex> g(m_commandChannelMutex);
+    m_ShmInterface.getShmInterface()->m_commandChannels.erase(f_channel);
+}
+
 void SharedMemoryManager::addEntryToServiceRegistry(const capro::ServiceDescription::IdString& service,
                                                     const capro::ServiceDescription::IdString& instance) noexcept
 {
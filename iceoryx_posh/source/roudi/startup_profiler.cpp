@@ -0,0 +1,73 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/roudi/startup_profiler.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+#include <sstream>
+
+namespace iox
+{
+namespace roudi
+{
+constexpr uint32_t StartupProfiler::MAX_PHASES;
+
+StartupProfiler& StartupProfiler::instance() noexcept
+{
+    static StartupProfiler profiler;
+    return profiler;
+}
+
+StartupProfiler::StartupProfiler() noexcept
+    : m_lastPhaseEnd(std::chrono::steady_clock::now())
+{
+}
+
+void StartupProfiler::phaseDone(const char* f_phaseName) noexcept
+{
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_phases.emplace_back())
+    {
+        return; // more phases than MAX_PHASES, the surplus ones are dropped
+    }
+    m_phases.back().m_name = f_phaseName;
+    m_phases.back().m_durationNs =
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_lastPhaseEnd).count());
+    m_lastPhaseEnd = now;
+}
+
+void StartupProfiler::logReport() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    uint64_t totalNs{0u};
+    std::stringstream report;
+    report << "RouDi startup phases [us]:";
+    for (const auto& phase : m_phases)
+    {
+        report << " " << phase.m_name << " " << phase.m_durationNs / 1000u << ";";
+        totalNs += phase.m_durationNs;
+    }
+    report << " total " << totalNs / 1000u;
+    LogInfo() << report.str();
+}
+
+StartupProfiler::PhaseContainer StartupProfiler::getReport() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_phases;
+}
+
+} // namespace roudi
+} // namespace iox
@@ -14,19 +14,62 @@
 
 #include "iceoryx_posh/internal/runtime/message_queue_interface.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/popo/base_port_data.hpp"
 #include "iceoryx_utils/cxx/convert.hpp"
 #include "iceoryx_utils/cxx/smart_c.hpp"
 #include "iceoryx_utils/error_handling/error_handling.hpp"
 #include "iceoryx_utils/fixed_string/string100.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/timespec.hpp"
-
+#include "iceoryx_utils/posix_wrapper/futex_semaphore.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 #include <thread>
 
 namespace iox
 {
 namespace runtime
 {
+namespace
+{
+/// directory which holds the socket files of the unix domain socket backend
+constexpr char UDS_PATH_PREFIX[] = "/tmp";
+/// suffix of the shared memory segment of the ShmRing backend
+constexpr char SHM_RING_SUFFIX[] = "_ring";
+} // namespace
+
+/// @brief Multi producer, single consumer message ring living in a shared
+///         memory segment. The futex semaphores resolve in userspace when the
+///         ring is neither full nor empty, so the per message cost is a few
+///         atomic operations instead of an mq syscall pair. A single consumer
+///         is sufficient since only the owner of a control plane queue drains
+///         it. The capacity is far deeper than APP_MAX_MESSAGES to avoid
+///         registration retries when many applications start at once.
+struct MqShmRing
+{
+    static constexpr uint32_t CAPACITY{64u};
+    static constexpr uint32_t MESSAGE_SIZE{4096u};
+
+    struct Slot
+    {
+        std::atomic<uint32_t> hasData{0u};
+        char data[MESSAGE_SIZE];
+    };
+
+    posix::FutexSemaphore freeSlots{CAPACITY};
+    posix::FutexSemaphore filledSlots{0u};
+    std::atomic<uint32_t> pushIndex{0u};
+    std::atomic<uint32_t> popIndex{0u};
+    Slot slots[CAPACITY];
+};
+constexpr uint32_t MqShmRing::CAPACITY;
+constexpr uint32_t MqShmRing::MESSAGE_SIZE;
+
 MqMessageType stringToMqMessageType(const char* str) noexcept
 {
     std::underlying_type<MqMessageType>::type msg;
@@ -61,8 +104,12 @@ std::string mqMessageErrorTypeToString(const MqMessageErrorType msg) noexcept
     return std::to_string(static_cast<std::underlying_type<MqMessageErrorType>::type>(msg));
 }
 
-MqBase::MqBase(const std::string& InterfaceName, const long maxMessages, const long messageSize) noexcept
+MqBase::MqBase(const std::string& InterfaceName,
+               const long maxMessages,
+               const long messageSize,
+               const MqTransportType transport) noexcept
     : m_interfaceName(InterfaceName)
+    , m_transportType(transport)
 {
     auto maxMessageSize = messageSize;
     if (messageSize > MAX_MESSAGE_LENGTH)
@@ -83,7 +130,22 @@ MqBase::MqBase(const std::string& InterfaceName, const long maxMessages, const l
 
 bool MqBase::receive(MqMessage& answer) const noexcept
 {
+    if (m_transportType == MqTransportType::ShmRing)
+    {
+        return receiveFromShmRing(answer, nullptr);
+    }
+
     char buffer[MAX_MESSAGE_LENGTH];
+    if (m_transportType == MqTransportType::UnixDomainSocket)
+    {
+        if (-1 == recv(m_transportFd, buffer, static_cast<size_t>(m_attr.mq_msgsize), 0))
+        {
+            LogError() << "Calling recv() failed : " << strerror(errno);
+            return false;
+        }
+        return MqBase::setMessageFromString(buffer, answer);
+    }
+
     if (-1 == mq_receive(m_roudiMq, buffer, static_cast<size_t>(m_attr.mq_msgsize), NULL))
     {
         LogError() << "Calling mq_receive() failed : " << strerror(errno);
@@ -97,6 +159,25 @@ bool MqBase::receive(MqMessage& answer) const noexcept
 
 bool MqBase::timedReceive(const uint32_t timeout_ms, MqMessage& answer) const noexcept
 {
+    if (m_transportType == MqTransportType::UnixDomainSocket)
+    {
+        struct timeval socketTimeout;
+        socketTimeout.tv_sec = timeout_ms / 1000u;
+        socketTimeout.tv_usec = static_cast<suseconds_t>(timeout_ms % 1000u) * 1000;
+        setsockopt(m_transportFd, SOL_SOCKET, SO_RCVTIMEO, &socketTimeout, sizeof(socketTimeout));
+
+        char buffer[MAX_MESSAGE_LENGTH];
+        if (-1 == recv(m_transportFd, buffer, static_cast<size_t>(m_attr.mq_msgsize), 0))
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                LogError() << "Calling recv() failed : " << strerror(errno);
+            }
+            return false;
+        }
+        return MqBase::setMessageFromString(buffer, answer);
+    }
+
     timespec timeout;
     // get current system time
     if (-1 == (clock_gettime(CLOCK_REALTIME, &timeout)))
@@ -106,6 +187,11 @@ bool MqBase::timedReceive(const uint32_t timeout_ms, MqMessage& answer) const no
     }
     timeout = posix::addTimeMs(timeout, timeout_ms);
 
+    if (m_transportType == MqTransportType::ShmRing)
+    {
+        return receiveFromShmRing(answer, &timeout);
+    }
+
     char buffer[MAX_MESSAGE_LENGTH];
     if (-1 == mq_timedreceive(m_roudiMq, buffer, static_cast<size_t>(m_attr.mq_msgsize), NULL, &timeout))
     {
@@ -125,6 +211,48 @@ bool MqBase::timedReceive(const uint32_t timeout_ms, MqMessage& answer) const no
     }
 }
 
+bool MqBase::tryReceive(MqMessage& answer) const noexcept
+{
+    if (m_transportType == MqTransportType::UnixDomainSocket)
+    {
+        char buffer[MAX_MESSAGE_LENGTH];
+        if (-1 == recv(m_transportFd, buffer, static_cast<size_t>(m_attr.mq_msgsize), MSG_DONTWAIT))
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                LogError() << "Calling recv() failed : " << strerror(errno);
+            }
+            return false;
+        }
+        return MqBase::setMessageFromString(buffer, answer);
+    }
+
+    // an absolute timeout lying in the past makes the remaining transports
+    // return immediately when no message is pending
+    timespec now;
+    if (-1 == (clock_gettime(CLOCK_REALTIME, &now)))
+    {
+        LogError() << "Calling clock_gettime() failed : " << strerror(errno);
+        return false;
+    }
+
+    if (m_transportType == MqTransportType::ShmRing)
+    {
+        return receiveFromShmRing(answer, &now);
+    }
+
+    char buffer[MAX_MESSAGE_LENGTH];
+    if (-1 == mq_timedreceive(m_roudiMq, buffer, static_cast<size_t>(m_attr.mq_msgsize), NULL, &now))
+    {
+        if (errno != ETIMEDOUT && errno != EINTR && errno != EAGAIN)
+        {
+            LogError() << "Calling mq_timedReceive() failed : " << strerror(errno);
+        }
+        return false;
+    }
+    return MqBase::setMessageFromString(buffer, answer);
+}
+
 bool MqBase::setMessageFromString(const char* buffer, MqMessage& answer) noexcept
 {
     answer.setMessage(buffer);
@@ -145,7 +273,7 @@ bool MqBase::send(const MqMessage& msg) const noexcept
         return false;
     }
 
-    const size_t messageSize = static_cast<size_t>(msg.getMessage().size()) + NULL_TERMINATOR_SIZE;
+    const size_t messageSize = static_cast<size_t>(msg.getMessageSize()) + NULL_TERMINATOR_SIZE;
     if (messageSize > static_cast<size_t>(m_attr.mq_msgsize))
     {
         LogError() << "msg size of " << messageSize << "bigger than " << m_attr.mq_msgsize
@@ -153,8 +281,23 @@ bool MqBase::send(const MqMessage& msg) const noexcept
         return false;
     }
 
+    if (m_transportType == MqTransportType::ShmRing)
+    {
+        return sendToShmRing(msg.getMessageBuffer(), messageSize, nullptr);
+    }
+
+    if (m_transportType == MqTransportType::UnixDomainSocket)
+    {
+        if (-1 == ::send(m_transportFd, msg.getMessageBuffer(), messageSize, 0))
+        {
+            LogError() << "Calling send() failed : " << strerror(errno);
+            return false;
+        }
+        return true;
+    }
+
     unsigned int prio = 1;
-    if (-1 == mq_send(m_roudiMq, msg.getMessage().c_str(), messageSize, prio))
+    if (-1 == mq_send(m_roudiMq, msg.getMessageBuffer(), messageSize, prio))
     {
         LogError() << "Calling mq_send() failed : " << strerror(errno);
         return false;
@@ -174,7 +317,7 @@ bool MqBase::timedSend(const MqMessage& msg, units::Duration timeout) const noex
         return false;
     }
 
-    const size_t messageSize = msg.getMessage().size() + NULL_TERMINATOR_SIZE;
+    const size_t messageSize = static_cast<size_t>(msg.getMessageSize()) + NULL_TERMINATOR_SIZE;
     if (messageSize > static_cast<size_t>(m_attr.mq_msgsize))
     {
         LogError() << "msg size of " << messageSize << "bigger than " << m_attr.mq_msgsize
@@ -182,14 +325,39 @@ bool MqBase::timedSend(const MqMessage& msg, units::Duration timeout) const noex
         return false;
     }
 
+    if (m_transportType == MqTransportType::UnixDomainSocket)
+    {
+        timespec relativeTimeout = timeout.timespec(units::TimeSpecReference::None);
+        struct timeval socketTimeout;
+        socketTimeout.tv_sec = relativeTimeout.tv_sec;
+        socketTimeout.tv_usec = static_cast<suseconds_t>(relativeTimeout.tv_nsec / 1000);
+        setsockopt(m_transportFd, SOL_SOCKET, SO_SNDTIMEO, &socketTimeout, sizeof(socketTimeout));
+
+        if (-1 == ::send(m_transportFd, msg.getMessageBuffer(), messageSize, 0))
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                LogError() << "Calling send() failed : " << strerror(errno);
+            }
+            return false;
+        }
+        return true;
+    }
+
     timespec l_timeout = timeout.timespec(units::TimeSpecReference::Epoch);
+
+    if (m_transportType == MqTransportType::ShmRing)
+    {
+        return sendToShmRing(msg.getMessageBuffer(), messageSize, &l_timeout);
+    }
+
     unsigned int l_prio = 1;
     auto sendRetVal = cxx::makeSmartC(mq_timedsend,
                                       cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
                                       {-1},
                                       {ETIMEDOUT, EINTR},
                                       m_roudiMq,
-                                      msg.getMessage().c_str(),
+                                      msg.getMessageBuffer(),
                                       messageSize,
                                       l_prio,
                                       &l_timeout);
@@ -220,6 +388,20 @@ bool MqBase::isInitialized() const noexcept
 bool MqBase::openMessageQueue(const std::string& name, const int oflag) noexcept
 {
     m_oflag = oflag;
+    switch (m_transportType)
+    {
+    case MqTransportType::UnixDomainSocket:
+        return openUnixDomainSocket(oflag);
+    case MqTransportType::ShmRing:
+        return openShmRing(name, oflag);
+    case MqTransportType::PosixMq:
+    default:
+        return openPosixMq(name, oflag);
+    }
+}
+
+bool MqBase::openPosixMq(const std::string& name, const int oflag) noexcept
+{
     m_roudiMq = mq_open(name.c_str(), m_oflag, m_perms, &m_attr);
     if (-1 == m_roudiMq)
     {
@@ -234,9 +416,178 @@ bool MqBase::openMessageQueue(const std::string& name, const int oflag) noexcept
     return true;
 }
 
+bool MqBase::openUnixDomainSocket(const int oflag) noexcept
+{
+    const std::string path = socketPath();
+
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+    int socketFd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (-1 == socketFd)
+    {
+        LogError() << "Calling socket() failed : " << strerror(errno);
+        return false;
+    }
+
+    if (oflag & O_CREAT)
+    {
+        // a stale socket file of a previous unclean termination would make bind fail
+        ::unlink(path.c_str());
+        if (-1 == bind(socketFd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)))
+        {
+            LogError() << "Calling bind() failed : " << strerror(errno);
+            ::close(socketFd);
+            return false;
+        }
+    }
+    else
+    {
+        // connecting checks that the remote socket exists, equivalent to
+        // mq_open without O_CREAT which is also used for polling RouDi
+        if (-1 == connect(socketFd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)))
+        {
+            ::close(socketFd);
+            return false;
+        }
+    }
+
+    m_transportFd = socketFd;
+    return true;
+}
+
+bool MqBase::openShmRing(const std::string& name, const int oflag) noexcept
+{
+    const std::string shmName = name + SHM_RING_SUFFIX;
+    int openFlags = O_RDWR | ((oflag & O_CREAT) ? O_CREAT : 0);
+
+    // the mask will be applied to the permissions, therefore we need to set it to 0
+    mode_t umaskSaved = umask(0);
+    int shmFd = shm_open(shmName.c_str(), openFlags, static_cast<mode_t>(m_perms));
+    umask(umaskSaved);
+
+    if (-1 == shmFd)
+    {
+        if (oflag & O_CREAT)
+        {
+            LogError() << "Calling shm_open() failed : " << strerror(errno);
+        }
+        return false;
+    }
+
+    if ((oflag & O_CREAT) && -1 == ftruncate(shmFd, static_cast<off_t>(sizeof(MqShmRing))))
+    {
+        LogError() << "Calling ftruncate() failed : " << strerror(errno);
+        ::close(shmFd);
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, sizeof(MqShmRing), PROT_READ | PROT_WRITE, MAP_SHARED, shmFd, 0);
+    if (MAP_FAILED == mapping)
+    {
+        LogError() << "Calling mmap() failed : " << strerror(errno);
+        ::close(shmFd);
+        return false;
+    }
+
+    m_transportFd = shmFd;
+    m_ring = static_cast<MqShmRing*>(mapping);
+    if (oflag & O_CREAT)
+    {
+        // the creator owns the ring state, a stale ring of a previous unclean
+        // termination is discarded
+        new (m_ring) MqShmRing();
+    }
+    return true;
+}
+
+bool MqBase::sendToShmRing(const char* buffer, const size_t size, const timespec* absTimeout) const noexcept
+{
+    if (absTimeout != nullptr)
+    {
+        if (!m_ring->freeSlots.timedWait(absTimeout))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        m_ring->freeSlots.wait();
+    }
+
+    const uint32_t index = m_ring->pushIndex.fetch_add(1u, std::memory_order_relaxed) % MqShmRing::CAPACITY;
+    auto& slot = m_ring->slots[index];
+    // the consumer drains the slots in ticket order, therefore the previous
+    // occupant of this slot was already consumed when the free slot token was
+    // acquired
+    memcpy(slot.data, buffer, size);
+    slot.hasData.store(1u, std::memory_order_release);
+    m_ring->filledSlots.post();
+    return true;
+}
+
+bool MqBase::receiveFromShmRing(MqMessage& answer, const timespec* absTimeout) const noexcept
+{
+    if (absTimeout != nullptr)
+    {
+        if (!m_ring->filledSlots.timedWait(absTimeout))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        m_ring->filledSlots.wait();
+    }
+
+    const uint32_t index = m_ring->popIndex.fetch_add(1u, std::memory_order_relaxed) % MqShmRing::CAPACITY;
+    auto& slot = m_ring->slots[index];
+    // another producer may have posted the filled slot token; the producer
+    // which acquired this slot could still be copying its message
+    while (slot.hasData.load(std::memory_order_acquire) == 0u)
+    {
+    }
+
+    char buffer[MAX_MESSAGE_LENGTH];
+    memcpy(buffer, slot.data, sizeof(buffer));
+    slot.hasData.store(0u, std::memory_order_release);
+    m_ring->freeSlots.post();
+    return MqBase::setMessageFromString(buffer, answer);
+}
+
+std::string MqBase::socketPath() const noexcept
+{
+    return (!m_interfaceName.empty() && m_interfaceName.front() == '/')
+               ? std::string(UDS_PATH_PREFIX) + m_interfaceName
+               : std::string(UDS_PATH_PREFIX) + "/" + m_interfaceName;
+}
+
 bool MqBase::closeMessageQueue() const noexcept
 {
     // m_interfaceName is only empty when the object was moved
+    if (m_transportType == MqTransportType::UnixDomainSocket)
+    {
+        if (-1 == ::close(m_transportFd))
+        {
+            LogError() << "Calling close() failed : " << strerror(errno);
+            return false;
+        }
+        return true;
+    }
+
+    if (m_transportType == MqTransportType::ShmRing)
+    {
+        bool hasSuccess = (-1 != munmap(m_ring, sizeof(MqShmRing)));
+        hasSuccess &= (-1 != ::close(m_transportFd));
+        if (!hasSuccess)
+        {
+            LogError() << "Unable to unmap or close the message ring : " << strerror(errno);
+        }
+        return hasSuccess;
+    }
+
     if (-1 == mq_close(m_roudiMq))
     {
         LogError() << "Calling mq_close() failed : " << strerror(errno);
@@ -262,6 +613,20 @@ bool MqBase::mqMapsToFile() noexcept
         return false;
     }
     struct stat sb;
+    if (m_transportType == MqTransportType::UnixDomainSocket)
+    {
+        return 0 == stat(socketPath().c_str(), &sb);
+    }
+
+    if (m_transportType == MqTransportType::ShmRing)
+    {
+        if (-1 == fstat(m_transportFd, &sb))
+        {
+            return false;
+        }
+        return sb.st_nlink > 0;
+    }
+
     if (cxx::makeSmartC(fstat, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_roudiMq, &sb).hasErrors())
     {
         errorHandler(Error::kMQ_INTERFACE__CHECK_MQ_MAPS_TO_FILE);
@@ -271,6 +636,26 @@ bool MqBase::mqMapsToFile() noexcept
 
 bool MqBase::unlinkMessageQueue() const noexcept
 {
+    if (m_transportType == MqTransportType::UnixDomainSocket)
+    {
+        if (-1 == ::unlink(socketPath().c_str()))
+        {
+            LogError() << "Calling unlink() failed : " << strerror(errno);
+            return false;
+        }
+        return true;
+    }
+
+    if (m_transportType == MqTransportType::ShmRing)
+    {
+        if (-1 == shm_unlink((m_interfaceName + SHM_RING_SUFFIX).c_str()))
+        {
+            LogError() << "Calling shm_unlink() failed : " << strerror(errno);
+            return false;
+        }
+        return true;
+    }
+
     if (-1 == mq_unlink(m_interfaceName.c_str()))
     {
         LogError() << "Calling mq_unlink() failed : " << strerror(errno);
@@ -295,8 +680,11 @@ void MqBase::cleanupOutdatedMessageQueue(const std::string& name) noexcept
     }
 }
 
-MqInterfaceUser::MqInterfaceUser(const std::string& name, const long maxMessages, const long messageSize) noexcept
-    : MqBase(name, maxMessages, messageSize)
+MqInterfaceUser::MqInterfaceUser(const std::string& name,
+                                 const long maxMessages,
+                                 const long messageSize,
+                                 const MqTransportType transport) noexcept
+    : MqBase(name, maxMessages, messageSize, transport)
 {
     m_isInitialized = openMessageQueue(name, O_RDWR);
 }
@@ -331,16 +719,23 @@ MqInterfaceUser::~MqInterfaceUser() noexcept
     }
 }
 
-MqInterfaceCreator::MqInterfaceCreator(const std::string& name, const long maxMessages, const long messageSize) noexcept
-    : MqBase(name, maxMessages, messageSize)
+MqInterfaceCreator::MqInterfaceCreator(const std::string& name,
+                                       const long maxMessages,
+                                       const long messageSize,
+                                       const MqTransportType transport) noexcept
+    : MqBase(name, maxMessages, messageSize, transport)
 {
     // @todo set umask to 0 to get 0666 permissions, create extra users for
     // daemon and applications later
     umask(0);
 
     // check if the mq is still there (e.g. because of no proper termination
-    // of the process)
-    cleanupOutdatedMessageQueue(name);
+    // of the process); the other transports discard stale artifacts when
+    // opening with O_CREAT
+    if (transport == MqTransportType::PosixMq)
+    {
+        cleanupOutdatedMessageQueue(name);
+    }
 
     m_isInitialized = openMessageQueue(name, O_CREAT | O_RDWR);
 }
@@ -379,7 +774,8 @@ MqInterfaceCreator::~MqInterfaceCreator() noexcept
 
 MqRuntimeInterface::MqRuntimeInterface(const std::string& roudiName,
                                        const std::string& appName,
-                                       const units::Duration roudiWaitingTimeout) noexcept
+                                       const units::Duration roudiWaitingTimeout,
+                                       const units::Duration keepAliveInterval) noexcept
     : m_appName(appName)
     , m_AppMqInterface(appName)
     , m_RoudiMqInterface(roudiName)
@@ -433,7 +829,8 @@ MqRuntimeInterface::MqRuntimeInterface(const std::string& roudiName,
                                               m_appName,
                                               std::to_string(getpid()),
                                               std::to_string(posix::PosixUser::getUserOfCurrentProcess().getID()),
-                                              std::to_string(transmissionTimestamp)},
+                                              std::to_string(transmissionTimestamp),
+                                              std::to_string(keepAliveInterval.milliSeconds<uint32_t>())},
                                              100_ms);
 
             if (successfullySent)
@@ -479,7 +876,9 @@ MqRuntimeInterface::MqRuntimeInterface(const std::string& roudiName,
         errorHandler(Error::kMQ_INTERFACE__REG_ACK_NO_RESPONSE);
         break;
     case RegState::FINISHED:
-        // nothing to do, move along
+        // the port ids of this process come from the id range handed out with
+        // the REG_ACK, set it before the first port is created
+        popo::BasePortData::setUniqueIdRange(m_uniqueIdRangeIndex);
         break;
     }
 }
@@ -577,7 +976,7 @@ MqRuntimeInterface::RegAckResult MqRuntimeInterface::waitForRegAck(int64_t trans
 
             if (stringToMqMessageType(cmd.c_str()) == MqMessageType::REG_ACK)
             {
-                constexpr uint32_t REGISTER_ACK_PARAMETERS = 6;
+                constexpr uint32_t REGISTER_ACK_PARAMETERS = 9;
                 if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS)
                 {
                     errorHandler(Error::kMQ_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
@@ -591,6 +990,9 @@ MqRuntimeInterface::RegAckResult MqRuntimeInterface::waitForRegAck(int64_t trans
                 int64_t receivedTimestamp;
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(4).c_str(), receivedTimestamp);
                 cxx::convert::fromString(receiveBuffer.getElementAtIndex(5).c_str(), m_segmentId);
+                cxx::convert::fromString(receiveBuffer.getElementAtIndex(6).c_str(), m_commandChannelOffset);
+                cxx::convert::fromString(receiveBuffer.getElementAtIndex(7).c_str(), m_uniqueIdRangeIndex);
+                cxx::convert::fromString(receiveBuffer.getElementAtIndex(8).c_str(), m_introspectionSnapshotsOffset);
                 if (transmissionTimestamp == receivedTimestamp)
                 {
                     return RegAckResult::SUCCESS;
@@ -615,5 +1017,20 @@ uint64_t MqRuntimeInterface::getSegmentId() const noexcept
     return m_segmentId;
 }
 
+uint64_t MqRuntimeInterface::getCommandChannelOffset() const noexcept
+{
+    return m_commandChannelOffset;
+}
+
+uint64_t MqRuntimeInterface::getUniqueIdRangeIndex() const noexcept
+{
+    return m_uniqueIdRangeIndex;
+}
+
+uint64_t MqRuntimeInterface::getIntrospectionSnapshotsOffset() const noexcept
+{
+    return m_introspectionSnapshotsOffset;
+}
+
 } // namespace runtime
 } // namespace iox
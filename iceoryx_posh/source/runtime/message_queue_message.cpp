@@ -15,6 +15,9 @@
 #include "iceoryx_posh/internal/runtime/message_queue_message.hpp"
 
 #include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
 
 namespace iox
 {
@@ -22,9 +25,11 @@ namespace runtime
 {
 const char MqMessage::m_separator = ',';
 
+constexpr uint32_t MqMessage::MAX_MESSAGE_SIZE;
+
 MqMessage::MqMessage(const std::initializer_list<std::string>& msg) noexcept
 {
-    for (auto element : msg)
+    for (auto& element : msg)
     {
         addEntry(element);
     }
@@ -42,19 +47,24 @@ uint32_t MqMessage::getNumberOfElements() const noexcept
 
 std::string MqMessage::getElementAtIndex(const uint32_t index) const noexcept
 {
-    std::string messageRemainder(m_msg);
-    size_t startPos = 0;
-    size_t endPos = messageRemainder.find_first_of(m_separator, startPos);
+    const char* startPos = m_msg;
+    const char* const messageEnd = m_msg + m_size;
 
-    for (uint32_t counter = 0; endPos != std::string::npos; ++counter)
+    for (uint32_t counter = 0; startPos < messageEnd; ++counter)
     {
+        const char* endPos =
+            static_cast<const char*>(std::memchr(startPos, m_separator, static_cast<size_t>(messageEnd - startPos)));
+        if (endPos == nullptr)
+        {
+            break;
+        }
+
         if (counter == index)
         {
-            return messageRemainder.substr(startPos, endPos - startPos);
+            return std::string(startPos, static_cast<size_t>(endPos - startPos));
         }
 
         startPos = endPos + 1;
-        endPos = messageRemainder.find_first_of(m_separator, startPos);
     }
 
     return std::string();
@@ -75,36 +85,112 @@ bool MqMessage::isValid() const noexcept
 }
 
 std::string MqMessage::getMessage() const noexcept
+{
+    return std::string(m_msg, m_size);
+}
+
+const char* MqMessage::getMessageBuffer() const noexcept
 {
     return m_msg;
 }
 
+uint32_t MqMessage::getMessageSize() const noexcept
+{
+    return m_size;
+}
+
 void MqMessage::setMessage(const std::string& msg) noexcept
 {
     clearMessage();
 
-    m_msg = msg;
-    if (m_msg.back() != m_separator && m_msg.size() > 0)
+    if (msg.size() > static_cast<size_t>(MAX_MESSAGE_SIZE) - 1)
+    {
+        LogError() << "\'" << msg << "\' exceeds the maximum message size of " << MAX_MESSAGE_SIZE;
+        m_isValid = false;
+        return;
+    }
+
+    std::memcpy(m_msg, msg.c_str(), msg.size() + 1);
+    m_size = static_cast<uint32_t>(msg.size());
+    if (m_size > 0 && m_msg[m_size - 1] != m_separator)
     {
         m_isValid = false;
     }
     else
     {
-        m_numberOfElements = static_cast<uint32_t>(
-            std::count_if(m_msg.begin(), m_msg.end(), [&](char c) { return c == m_separator; }));
+        m_numberOfElements =
+            static_cast<uint32_t>(std::count_if(m_msg, m_msg + m_size, [&](char c) { return c == m_separator; }));
     }
 }
 
 void MqMessage::clearMessage() noexcept
 {
-    m_msg.clear();
+    m_msg[0] = '\0';
+    m_size = 0;
     m_numberOfElements = 0;
     m_isValid = true;
 }
 
 bool MqMessage::operator==(const MqMessage& rhs) const noexcept
 {
-    return this->getMessage() == rhs.getMessage();
+    return m_size == rhs.m_size && std::memcmp(m_msg, rhs.m_msg, m_size) == 0;
+}
+
+void MqMessage::append(const char* f_entry, const size_t f_entrySize) noexcept
+{
+    if (std::memchr(f_entry, m_separator, f_entrySize) != nullptr)
+    {
+        LogError() << "\'" << std::string(f_entry, f_entrySize) << "\' is an invalid message queue entry";
+        m_isValid = false;
+    }
+    else if (static_cast<size_t>(m_size) + f_entrySize + 1 > static_cast<size_t>(MAX_MESSAGE_SIZE) - 1)
+    {
+        LogError() << "adding the entry \'" << std::string(f_entry, f_entrySize)
+                   << "\' exceeds the maximum message size of " << MAX_MESSAGE_SIZE;
+        m_isValid = false;
+    }
+    else
+    {
+        std::memcpy(&m_msg[m_size], f_entry, f_entrySize);
+        m_size += static_cast<uint32_t>(f_entrySize);
+        m_msg[m_size++] = m_separator;
+        m_msg[m_size] = '\0';
+        ++m_numberOfElements;
+    }
+}
+
+void MqMessage::appendEntry(const std::string& entry) noexcept
+{
+    append(entry.c_str(), entry.size());
+}
+
+void MqMessage::appendEntry(const char* const entry) noexcept
+{
+    append(entry, strlen(entry));
+}
+
+void MqMessage::appendEntry(const int32_t entry) noexcept
+{
+    appendEntry(static_cast<int64_t>(entry));
+}
+
+void MqMessage::appendEntry(const uint32_t entry) noexcept
+{
+    appendEntry(static_cast<uint64_t>(entry));
+}
+
+void MqMessage::appendEntry(const int64_t entry) noexcept
+{
+    char buffer[32];
+    const int size = snprintf(buffer, sizeof(buffer), "%" PRIi64, entry);
+    append(buffer, static_cast<size_t>(size));
+}
+
+void MqMessage::appendEntry(const uint64_t entry) noexcept
+{
+    char buffer[32];
+    const int size = snprintf(buffer, sizeof(buffer), "%" PRIu64, entry);
+    append(buffer, static_cast<size_t>(size));
 }
 
 } // namespace runtime
@@ -0,0 +1,109 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/runtime/posh_domain.hpp"
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+
+namespace iox
+{
+namespace runtime
+{
+constexpr uint32_t PoshDomain::DEFAULT_DOMAIN_ID;
+constexpr uint32_t PoshDomain::MAX_DOMAIN_ID;
+
+namespace
+{
+constexpr size_t NAME_CAPACITY = 32u;
+
+std::atomic<uint32_t> s_domainId{PoshDomain::DEFAULT_DOMAIN_ID};
+std::atomic<bool> s_explicitlySet{false};
+std::once_flag s_environmentOnce;
+char s_roudiMqName[NAME_CAPACITY] = "/roudi";
+char s_mgmtShmName[NAME_CAPACITY] = "/iceoryx_mgmt";
+} // namespace
+
+bool PoshDomain::setDomainId(const uint32_t f_domainId) noexcept
+{
+    if (f_domainId > MAX_DOMAIN_ID)
+    {
+        return false;
+    }
+    s_explicitlySet.store(true, std::memory_order_relaxed);
+    s_domainId.store(f_domainId, std::memory_order_relaxed);
+    formatNames(f_domainId);
+    return true;
+}
+
+uint32_t PoshDomain::getDomainId() noexcept
+{
+    ensureInitialized();
+    return s_domainId.load(std::memory_order_relaxed);
+}
+
+const char* PoshDomain::getRoudiMqName() noexcept
+{
+    ensureInitialized();
+    return s_roudiMqName;
+}
+
+const char* PoshDomain::getMgmtShmName() noexcept
+{
+    ensureInitialized();
+    return s_mgmtShmName;
+}
+
+void PoshDomain::ensureInitialized() noexcept
+{
+    std::call_once(s_environmentOnce, []() {
+        if (s_explicitlySet.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        const char* environmentValue = std::getenv("IOX_DOMAIN_ID");
+        if (environmentValue == nullptr)
+        {
+            return;
+        }
+        const long parsedId = std::strtol(environmentValue, nullptr, 10);
+        if (parsedId > 0 && static_cast<uint32_t>(parsedId) <= MAX_DOMAIN_ID)
+        {
+            s_domainId.store(static_cast<uint32_t>(parsedId), std::memory_order_relaxed);
+            formatNames(static_cast<uint32_t>(parsedId));
+        }
+    });
+}
+
+void PoshDomain::formatNames(const uint32_t f_domainId) noexcept
+{
+    if (f_domainId == DEFAULT_DOMAIN_ID)
+    {
+        // domain 0 keeps the legacy names for compatibility
+        snprintf(s_roudiMqName, NAME_CAPACITY, "%s", MQ_ROUDI_NAME);
+        snprintf(s_mgmtShmName, NAME_CAPACITY, "%s", SHM_NAME);
+    }
+    else
+    {
+        snprintf(s_roudiMqName, NAME_CAPACITY, "%s_%u", MQ_ROUDI_NAME, f_domainId);
+        snprintf(s_mgmtShmName, NAME_CAPACITY, "%s_%u", SHM_NAME, f_domainId);
+    }
+}
+
+} // namespace runtime
+} // namespace iox
@@ -14,14 +14,18 @@
 
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
+#include "iceoryx_posh/runtime/posh_domain.hpp"
+
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/runtime/message_queue_message.hpp"
+#include "iceoryx_posh/popo/chunk_receive_dispatcher.hpp"
 #include "iceoryx_posh/runtime/runnable.hpp"
 #include "iceoryx_utils/cxx/convert.hpp"
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
 #include "iceoryx_utils/posix_wrapper/timer.hpp"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace iox
@@ -31,6 +35,52 @@ namespace runtime
 std::function<PoshRuntime&(const std::string& name)> PoshRuntime::s_runtimeFactory =
     PoshRuntime::defaultRuntimeFactory;
 
+std::mutex PoshRuntime::s_callbackThreadAttributesMutex;
+posix::ThreadAttributes PoshRuntime::s_callbackThreadAttributes;
+
+void PoshRuntime::setCallbackThreadAttributes(const posix::ThreadAttributes& f_attributes) noexcept
+{
+    std::lock_guard<std::mutex> g(s_callbackThreadAttributesMutex);
+    s_callbackThreadAttributes = f_attributes;
+}
+
+posix::ThreadAttributes PoshRuntime::getCallbackThreadAttributes() noexcept
+{
+    std::lock_guard<std::mutex> g(s_callbackThreadAttributesMutex);
+    return s_callbackThreadAttributes;
+}
+
+std::mutex PoshRuntime::s_keepAliveIntervalMutex;
+units::Duration PoshRuntime::s_keepAliveInterval{PROCESS_KEEP_ALIVE_INTERVAL};
+
+void PoshRuntime::setKeepAliveInterval(const units::Duration f_interval) noexcept
+{
+    std::lock_guard<std::mutex> g(s_keepAliveIntervalMutex);
+    s_keepAliveInterval = f_interval;
+}
+
+units::Duration PoshRuntime::getKeepAliveInterval() noexcept
+{
+    std::lock_guard<std::mutex> g(s_keepAliveIntervalMutex);
+    return s_keepAliveInterval;
+}
+
+namespace
+{
+std::atomic<uint32_t> s_eventDispatcherThreadCount{2u};
+}
+
+popo::ChunkReceiveDispatcher& PoshRuntime::getEventDispatcher() noexcept
+{
+    static popo::ChunkReceiveDispatcher dispatcher(s_eventDispatcherThreadCount.load(std::memory_order_relaxed));
+    return dispatcher;
+}
+
+void PoshRuntime::setEventDispatcherThreadCount(const uint32_t f_numberOfThreads) noexcept
+{
+    s_eventDispatcherThreadCount.store(f_numberOfThreads, std::memory_order_relaxed);
+}
+
 
 PoshRuntime& PoshRuntime::defaultRuntimeFactory(const std::string& name) noexcept
 {
@@ -44,14 +94,23 @@ PoshRuntime& PoshRuntime::getInstance(const std::string& name) noexcept
     return PoshRuntime::s_runtimeFactory(name);
 }
 
+PoshRuntime& PoshRuntime::getInstance(const std::string& name, const uint32_t domainId) noexcept
+{
+    // has to happen before the runtime singleton is constructed, a later call
+    // cannot move the process into another domain anymore
+    PoshDomain::setDomainId(domainId);
+    return PoshRuntime::s_runtimeFactory(name);
+}
+
 PoshRuntime::PoshRuntime(const std::string& name, const bool doMapSharedMemoryIntoThread) noexcept
     : m_appName(verifyInstanceName(name))
-    , m_MqInterface(MQ_ROUDI_NAME, name, PROCESS_WAITING_FOR_ROUDI_TIMEOUT)
+    , m_MqInterface(PoshDomain::getRoudiMqName(), name, PROCESS_WAITING_FOR_ROUDI_TIMEOUT, getKeepAliveInterval())
     , m_ShmInterface(m_MqInterface.getShmBaseAddr(),
                      doMapSharedMemoryIntoThread,
                      m_MqInterface.getShmTopicSize(),
                      m_MqInterface.getSegmentManagerAddr(),
                      m_MqInterface.getSegmentId())
+    , m_commandChannel(resolveCommandChannel())
     , m_applicationPort(getMiddlewareApplication(Interfaces::INTERNAL))
     , m_serviceDiscoveryNotifier(name, getServiceRegistryChangeCounter())
 {
@@ -81,6 +140,91 @@ const std::string& PoshRuntime::verifyInstanceName(const std::string& name) noex
     return name;
 }
 
+roudi::IntrospectionShmSnapshots* PoshRuntime::getIntrospectionSnapshots() noexcept
+{
+    auto offset = m_MqInterface.getIntrospectionSnapshotsOffset();
+    if (0u == offset)
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<roudi::IntrospectionShmSnapshots*>(
+        RelativePointer::getPtr(m_MqInterface.getSegmentId(), offset));
+}
+
+RuntimeCommandChannel* PoshRuntime::resolveCommandChannel() noexcept
+{
+    auto offset = m_MqInterface.getCommandChannelOffset();
+    if (0u == offset)
+    {
+        LogWarn() << "RouDi did not provide a command channel - using the message queue for runtime requests";
+        return nullptr;
+    }
+    auto channel =
+        reinterpret_cast<RuntimeCommandChannel*>(RelativePointer::getPtr(m_MqInterface.getSegmentId(), offset));
+    m_freeCommandChannels.push_back(channel);
+    m_commandChannelCount = 1u;
+    return channel;
+}
+
+RuntimeCommandChannel* PoshRuntime::acquireCommandChannel() noexcept
+{
+    std::unique_lock<std::mutex> lock(m_commandChannelPoolMutex);
+    while (m_freeCommandChannels.empty())
+    {
+        if (m_commandChannelCount < MAX_COMMAND_CHANNELS_PER_RUNTIME)
+        {
+            // reserve the slot before the round trip so that concurrent
+            // threads do not request more channels than the pool limit
+            ++m_commandChannelCount;
+            lock.unlock();
+            auto channel = requestCommandChannelFromRoudi();
+            lock.lock();
+            if (channel != nullptr)
+            {
+                return channel;
+            }
+            --m_commandChannelCount;
+            // RouDi has no channel left; wait for one of ours to become free
+        }
+        m_commandChannelAvailable.wait(lock);
+    }
+    auto channel = m_freeCommandChannels.back();
+    m_freeCommandChannels.pop_back();
+    return channel;
+}
+
+void PoshRuntime::releaseCommandChannel(RuntimeCommandChannel* const channel) noexcept
+{
+    {
+        std::lock_guard<std::mutex> g(m_commandChannelPoolMutex);
+        m_freeCommandChannels.push_back(channel);
+    }
+    m_commandChannelAvailable.notify_one();
+}
+
+RuntimeCommandChannel* PoshRuntime::requestCommandChannelFromRoudi() noexcept
+{
+    MqMessage sendBuffer;
+    sendBuffer << mqMessageTypeToString(MqMessageType::CREATE_COMMAND_CHANNEL) << m_appName;
+    MqMessage receiveBuffer;
+
+    std::lock_guard<std::mutex> g(m_appMqRequestMutex);
+    if (m_MqInterface.sendRequestToRouDi(sendBuffer, receiveBuffer) && (2 == receiveBuffer.getNumberOfElements())
+        && (stringToMqMessageType(receiveBuffer.getElementAtIndex(0).c_str())
+            == MqMessageType::CREATE_COMMAND_CHANNEL_ACK))
+    {
+        RelativePointer::offset_t offset;
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(1).c_str(), offset);
+        if (offset != 0u)
+        {
+            return reinterpret_cast<RuntimeCommandChannel*>(
+                RelativePointer::getPtr(m_MqInterface.getSegmentId(), offset));
+        }
+    }
+    LogWarn() << "Could not get an additional command channel from RouDi";
+    return nullptr;
+}
+
 std::string PoshRuntime::getInstanceName() const noexcept
 {
     return m_appName;
@@ -88,6 +232,11 @@ std::string PoshRuntime::getInstanceName() const noexcept
 
 const std::atomic<uint64_t>* PoshRuntime::getServiceRegistryChangeCounter() noexcept
 {
+    if (m_serviceRegistryChangeCounter != nullptr)
+    {
+        return m_serviceRegistryChangeCounter;
+    }
+
     MqMessage sendBuffer;
     sendBuffer << mqMessageTypeToString(MqMessageType::SERVICE_REGISTRY_CHANGE_COUNTER) << m_appName;
     MqMessage receiveBuffer;
@@ -99,7 +248,8 @@ const std::atomic<uint64_t>* PoshRuntime::getServiceRegistryChangeCounter() noex
         cxx::convert::fromString(receiveBuffer.getElementAtIndex(1).c_str(), segmentId);
         auto ptr = RelativePointer::getPtr(segmentId, offset);
 
-        return reinterpret_cast<std::atomic<uint64_t>*>(ptr);
+        m_serviceRegistryChangeCounter = reinterpret_cast<std::atomic<uint64_t>*>(ptr);
+        return m_serviceRegistryChangeCounter;
     }
     else
     {
@@ -111,11 +261,12 @@ const std::atomic<uint64_t>* PoshRuntime::getServiceRegistryChangeCounter() noex
 
 SenderPortType::MemberType_t* PoshRuntime::getMiddlewareSender(const capro::ServiceDescription& service,
                                                                const Interfaces interface,
-                                                               const cxx::CString100& runnableName) noexcept
+                                                               const cxx::CString100& runnableName,
+                                                               const uint32_t sampleAllocateCapacity) noexcept
 {
     MqMessage sendBuffer;
     sendBuffer << mqMessageTypeToString(MqMessageType::IMPL_SENDER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << static_cast<uint32_t>(interface)
+               << service.toWireFormat() << static_cast<uint32_t>(interface)
                << runnableName;
 
     auto requestedSenderPort = requestSenderFromRoudi(sendBuffer);
@@ -141,9 +292,36 @@ SenderPortType::MemberType_t* PoshRuntime::getMiddlewareSender(const capro::Serv
         }
         return nullptr;
     }
+
+    // the allocation window only restricts the application side reservation
+    // path, so it is configured directly on the received port data and does
+    // not need to travel with the request
+    auto l_window = sampleAllocateCapacity;
+    l_window = std::max(l_window, 1u);
+    l_window = std::min(l_window, MAX_SAMPLE_ALLOCATE_PER_SENDER_CAPACITY);
+    if (l_window != sampleAllocateCapacity)
+    {
+        LogWarn() << "Requested allocation window of " << std::to_string(sampleAllocateCapacity)
+                  << " chunks is out of bounds, clamping it to " << std::to_string(l_window);
+    }
+    requestedSenderPort.get_value()->m_allocatedChunksList.setCapacity(l_window);
+
     return requestedSenderPort.get_value();
 }
 
+std::future<SenderPortType::MemberType_t*>
+PoshRuntime::getMiddlewareSenderAsync(const capro::ServiceDescription& service,
+                                      const Interfaces interface,
+                                      const cxx::CString100& runnableName,
+                                      const uint32_t sampleAllocateCapacity) noexcept
+{
+    // the worker acquires its own command channel from the pool, therefore
+    // several port creations and the callers initialization run concurrently
+    return std::async(std::launch::async, [=]() -> SenderPortType::MemberType_t* {
+        return this->getMiddlewareSender(service, interface, runnableName, sampleAllocateCapacity);
+    });
+}
+
 cxx::expected<SenderPortType::MemberType_t*, MqMessageErrorType>
 PoshRuntime::requestSenderFromRoudi(const MqMessage& sendBuffer) noexcept
 {
@@ -194,34 +372,33 @@ ReceiverPortType::MemberType_t* PoshRuntime::getMiddlewareReceiver(const capro::
 {
     MqMessage sendBuffer;
     sendBuffer << mqMessageTypeToString(MqMessageType::IMPL_RECEIVER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << static_cast<uint32_t>(interface)
+               << service.toWireFormat() << static_cast<uint32_t>(interface)
                << runnableName;
 
     return requestReceiverFromRoudi(sendBuffer);
 }
 
+std::future<ReceiverPortType::MemberType_t*>
+PoshRuntime::getMiddlewareReceiverAsync(const capro::ServiceDescription& service,
+                                        const Interfaces interface,
+                                        const cxx::CString100& runnableName) noexcept
+{
+    return std::async(std::launch::async, [=]() -> ReceiverPortType::MemberType_t* {
+        return this->getMiddlewareReceiver(service, interface, runnableName);
+    });
+}
+
 ReceiverPortType::MemberType_t* PoshRuntime::requestReceiverFromRoudi(const MqMessage& sendBuffer) noexcept
 {
     MqMessage receiveBuffer;
-    if (sendRequestToRouDi(sendBuffer, receiveBuffer) && (3 == receiveBuffer.getNumberOfElements()))
+    if (sendRequestToRouDi(sendBuffer, receiveBuffer))
     {
-        std::string mqMessage = receiveBuffer.getElementAtIndex(0);
-
-        if (stringToMqMessageType(mqMessage.c_str()) == MqMessageType::IMPL_RECEIVER_ACK)
-        {
-            RelativePointer::id_t segmentId;
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2).c_str(), segmentId);
-            RelativePointer::offset_t offset;
-            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1).c_str(), offset);
-            auto ptr = RelativePointer::getPtr(segmentId, offset);
-            return reinterpret_cast<ReceiverPortType::MemberType_t*>(ptr);
-        }
-        else
+        auto l_port = receiverFromResponse(receiveBuffer);
+        if (l_port == nullptr)
         {
-            LogError() << "Wrong response from message queue " << mqMessage;
             assert(false);
-            return nullptr;
         }
+        return l_port;
     }
     else
     {
@@ -231,6 +408,68 @@ ReceiverPortType::MemberType_t* PoshRuntime::requestReceiverFromRoudi(const MqMe
     }
 }
 
+ReceiverPortType::MemberType_t* PoshRuntime::receiverFromResponse(const MqMessage& receiveBuffer) noexcept
+{
+    if (3 != receiveBuffer.getNumberOfElements())
+    {
+        LogError() << "Wrong response from message queue";
+        return nullptr;
+    }
+
+    std::string mqMessage = receiveBuffer.getElementAtIndex(0);
+    if (stringToMqMessageType(mqMessage.c_str()) != MqMessageType::IMPL_RECEIVER_ACK)
+    {
+        LogError() << "Wrong response from message queue " << mqMessage;
+        return nullptr;
+    }
+
+    RelativePointer::id_t segmentId;
+    cxx::convert::fromString(receiveBuffer.getElementAtIndex(2).c_str(), segmentId);
+    RelativePointer::offset_t offset;
+    cxx::convert::fromString(receiveBuffer.getElementAtIndex(1).c_str(), offset);
+    auto ptr = RelativePointer::getPtr(segmentId, offset);
+    return reinterpret_cast<ReceiverPortType::MemberType_t*>(ptr);
+}
+
+std::vector<ReceiverPortType::MemberType_t*>
+PoshRuntime::getMiddlewareReceiverBatch(const std::vector<capro::ServiceDescription>& services,
+                                        const Interfaces interface,
+                                        const cxx::CString100& runnableName) noexcept
+{
+    std::vector<ReceiverPortType::MemberType_t*> l_ports;
+    if (services.empty())
+    {
+        return l_ports;
+    }
+
+    std::vector<MqMessage> l_requests;
+    l_requests.reserve(services.size());
+    for (auto& service : services)
+    {
+        MqMessage sendBuffer;
+        sendBuffer << mqMessageTypeToString(MqMessageType::IMPL_RECEIVER) << m_appName << service.toWireFormat()
+                   << static_cast<uint32_t>(interface) << runnableName;
+        l_requests.push_back(sendBuffer);
+    }
+
+    std::vector<MqMessage> l_answers;
+    if (!sendRequestBatchToRouDi(l_requests, l_answers) || l_answers.size() != services.size())
+    {
+        LogError() << "Could not create the receiver port batch.";
+        errorHandler(Error::kPOSH__RUNTIME_RECEIVER_BATCH_INCOMPLETE, nullptr, ErrorLevel::SEVERE);
+        return l_ports;
+    }
+
+    // the responses arrive in request order, so the nth pointer belongs to
+    // the nth requested service
+    l_ports.reserve(l_answers.size());
+    for (auto& answer : l_answers)
+    {
+        l_ports.push_back(receiverFromResponse(answer));
+    }
+    return l_ports;
+}
+
 popo::InterfacePortData* PoshRuntime::getMiddlewareInterface(const Interfaces interface,
                                                              const cxx::CString100& runnableName) noexcept
 {
@@ -322,9 +561,29 @@ void PoshRuntime::removeRunnable(const Runnable& runnable) noexcept
 cxx::expected<Error> PoshRuntime::findService(const capro::ServiceDescription& serviceDescription,
                                               InstanceContainer& instanceContainer) noexcept
 {
+    // answer the query locally as long as the service registry generation
+    // counter did not change since the cached response
+    auto changeCounter = getServiceRegistryChangeCounter();
+    uint64_t generation{0u};
+    const std::string cacheKey = serviceDescription.toWireFormat();
+    if (changeCounter != nullptr)
+    {
+        generation = changeCounter->load(std::memory_order_acquire);
+        std::lock_guard<std::mutex> g(m_findServiceCacheMutex);
+        if (generation == m_findServiceCacheGeneration)
+        {
+            auto entry = m_findServiceCache.find(cacheKey);
+            if (entry != m_findServiceCache.end())
+            {
+                instanceContainer = entry->second;
+                return {cxx::success<>()};
+            }
+        }
+    }
+
     MqMessage sendBuffer;
     sendBuffer << mqMessageTypeToString(MqMessageType::FIND_SERVICE) << m_appName
-               << static_cast<cxx::Serialization>(serviceDescription).toString();
+               << serviceDescription.toWireFormat();
 
     MqMessage requestResponse;
 
@@ -353,6 +612,19 @@ cxx::expected<Error> PoshRuntime::findService(const capro::ServiceDescription& s
         errorHandler(Error::kPOSH__SERVICE_DISCOVERY_INSTANCE_CONTAINER_OVERFLOW, nullptr, ErrorLevel::MODERATE);
         return cxx::error<Error>(Error::kPOSH__SERVICE_DISCOVERY_INSTANCE_CONTAINER_OVERFLOW);
     }
+
+    if (changeCounter != nullptr)
+    {
+        // tagged with the generation read before the request, so a registry
+        // change during the round trip invalidates the entry on the next query
+        std::lock_guard<std::mutex> g(m_findServiceCacheMutex);
+        if (generation != m_findServiceCacheGeneration)
+        {
+            m_findServiceCache.clear();
+            m_findServiceCacheGeneration = generation;
+        }
+        m_findServiceCache[cacheKey] = instanceContainer;
+    }
     return {cxx::success<>()};
 }
 
@@ -418,6 +690,25 @@ popo::ApplicationPortData* PoshRuntime::getMiddlewareApplication(Interfaces inte
 
 bool PoshRuntime::sendRequestToRouDi(const MqMessage& msg, MqMessage& answer) noexcept
 {
+    if (m_commandChannel != nullptr)
+    {
+        // each request owns a channel from the pool for its round trip, so
+        // threads issue their requests concurrently instead of serializing
+        // behind a runtime wide lock
+        auto channel = acquireCommandChannel();
+        bool result = channel->sendRequest(msg);
+        if (result)
+        {
+            result = channel->waitForResponse(answer, PROCESS_WAITING_FOR_ROUDI_TIMEOUT.milliSeconds<uint32_t>());
+        }
+        if (!result)
+        {
+            LogError() << "Could not transfer request via command channel.\n";
+        }
+        releaseCommandChannel(channel);
+        return result;
+    }
+
     // runtime must be thread safe
     std::lock_guard<std::mutex> g(m_appMqRequestMutex);
     return m_MqInterface.sendRequestToRouDi(msg, answer);
@@ -425,15 +716,62 @@ bool PoshRuntime::sendRequestToRouDi(const MqMessage& msg, MqMessage& answer) no
 
 bool PoshRuntime::sendMessageToRouDi(const MqMessage& msg) noexcept
 {
+    if (m_commandChannel != nullptr)
+    {
+        auto channel = acquireCommandChannel();
+        bool result = channel->sendRequest(msg);
+        releaseCommandChannel(channel);
+        return result;
+    }
+
     // runtime must be thread safe
     std::lock_guard<std::mutex> g(m_appMqRequestMutex);
     return m_MqInterface.sendMessageToRouDi(msg);
 }
 
+bool PoshRuntime::sendRequestBatchToRouDi(const std::vector<MqMessage>& requests,
+                                          std::vector<MqMessage>& answers) noexcept
+{
+    answers.clear();
+    if (m_commandChannel != nullptr)
+    {
+        auto channel = acquireCommandChannel();
+        bool result =
+            channel->transferRequestBatch(requests, answers, PROCESS_WAITING_FOR_ROUDI_TIMEOUT.milliSeconds<uint32_t>());
+        if (!result)
+        {
+            LogError() << "Could not transfer request batch via command channel.\n";
+        }
+        releaseCommandChannel(channel);
+        return result;
+    }
+
+    // without a command channel the batch degrades to one round trip per request
+    std::lock_guard<std::mutex> g(m_appMqRequestMutex);
+    for (auto& request : requests)
+    {
+        MqMessage answer;
+        if (!m_MqInterface.sendRequestToRouDi(request, answer))
+        {
+            return false;
+        }
+        answers.push_back(answer);
+    }
+    return true;
+}
+
 // this is the callback for the m_keepAliveTimer
 void PoshRuntime::sendKeepAlive() noexcept
 {
-    if (!m_MqInterface.sendKeepalive())
+    // liveness is signalled via the heartbeat counter of the command channel:
+    // a single atomic increment which RouDi scans, instead of a keep alive
+    // message which RouDi has to dequeue and parse
+    if (m_commandChannel != nullptr)
+    {
+        m_commandChannel->sendHeartbeat();
+        return;
+    }
+    if (!sendMessageToRouDi({mqMessageTypeToString(MqMessageType::KEEPALIVE), m_appName}))
     {
         LogWarn() << "Error in sending keep alive";
     }
@@ -0,0 +1,137 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/runtime/runtime_command_channel.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+bool RuntimeCommandChannel::sendRequest(const MqMessage& f_message) noexcept
+{
+    // drop stale responses of a previous request which ran into a timeout;
+    // the application is the consumer of the response ring so this is safe
+    while (m_responses.pop().has_value())
+    {
+    }
+
+    if (!f_message.isValid() || !m_requests.push(f_message))
+    {
+        return false;
+    }
+    if (m_requestSignal != nullptr)
+    {
+        m_requestSignal->post();
+    }
+    return true;
+}
+
+bool RuntimeCommandChannel::tryGetRequest(MqMessage& f_message) noexcept
+{
+    auto l_entry = m_requests.pop();
+    if (!l_entry.has_value())
+    {
+        return false;
+    }
+    f_message = *l_entry;
+    return f_message.isValid();
+}
+
+bool RuntimeCommandChannel::sendResponse(const MqMessage& f_message) noexcept
+{
+    if (!f_message.isValid() || !m_responses.push(f_message))
+    {
+        return false;
+    }
+    m_responseSignal.post();
+    return true;
+}
+
+bool RuntimeCommandChannel::waitForResponse(MqMessage& f_answer, const uint32_t f_timeoutMs) noexcept
+{
+    // a stale signal can remain from a previous request which ran into a
+    // timeout, therefore retry until an entry is available
+    while (m_responseSignal.timedWait(f_timeoutMs))
+    {
+        auto l_entry = m_responses.pop();
+        if (l_entry.has_value())
+        {
+            f_answer = *l_entry;
+            return f_answer.isValid();
+        }
+    }
+    return false;
+}
+
+bool RuntimeCommandChannel::transferRequestBatch(const std::vector<MqMessage>& f_requests,
+                                                 std::vector<MqMessage>& f_answers,
+                                                 const uint32_t f_timeoutMs) noexcept
+{
+    // drop stale responses of a previous request which ran into a timeout
+    while (m_responses.pop().has_value())
+    {
+    }
+
+    size_t sent = 0u;
+    size_t received = 0u;
+    while (received < f_requests.size())
+    {
+        // keep the request ring as full as possible so RouDi can process the
+        // batch back to back
+        while (sent < f_requests.size())
+        {
+            if (!f_requests[sent].isValid())
+            {
+                return false;
+            }
+            if (!m_requests.push(f_requests[sent]))
+            {
+                // ring full; responses have to be consumed first
+                break;
+            }
+            ++sent;
+            if (m_requestSignal != nullptr)
+            {
+                m_requestSignal->post();
+            }
+        }
+
+        MqMessage l_answer;
+        if (!waitForResponse(l_answer, f_timeoutMs))
+        {
+            return false;
+        }
+        f_answers.push_back(l_answer);
+        ++received;
+    }
+    return true;
+}
+
+void RuntimeCommandChannel::setRequestSignal(posix::FutexSignal* const f_requestSignal) noexcept
+{
+    m_requestSignal = f_requestSignal;
+}
+
+void RuntimeCommandChannel::sendHeartbeat() noexcept
+{
+    m_heartbeat.fetch_add(1u, std::memory_order_relaxed);
+}
+
+uint64_t RuntimeCommandChannel::getHeartbeatCount() const noexcept
+{
+    return m_heartbeat.load(std::memory_order_relaxed);
+}
+
+} // namespace runtime
+} // namespace iox
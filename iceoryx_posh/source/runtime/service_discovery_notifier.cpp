@@ -50,18 +50,15 @@ cxx::expected<FindServiceHandle, Error> ServiceDiscoveryNotifier::startFindServi
         // Ensure that this function is called only once per service, unless StopFindService() is called.
         // If it's called for the same service, it returns the already registered handle.
         // Callback handler is not updated from the new request.
-        auto found =
-            std::find_if(m_handlers.begin(), m_handlers.end(), [&serviceId](const ServiceHandlerDescription& it) {
-                return (serviceId == it.serviceId);
-            });
+        auto found = m_handlersByService.find(std::string(serviceId.to_cstring()));
         // Given service is already registered, return the handler
-        if (found != m_handlers.end())
+        if (found != m_handlersByService.end())
         {
-            return cxx::success<FindServiceHandle>(found->handle);
+            return cxx::success<FindServiceHandle>(found->second.handle);
         }
 
         // No room to accomodate new handlers
-        if (m_handlers.size() == m_handlers.capacity())
+        if (m_handlersByService.size() == MAX_START_FIND_SERVICE_CALLBACKS)
         {
             LogError() << "Could not register FindServiceHandler for " << serviceId << " \n";
             errorHandler(Error::kPOSH__SERVICE_DISCOVERY_FIND_SERVICE_CALLBACKS_CONTAINER_OVERFLOW,
@@ -83,7 +80,8 @@ cxx::expected<FindServiceHandle, Error> ServiceDiscoveryNotifier::startFindServi
         {
             serviceHandleDescriptor.instances.clear();
         }
-        m_handlers.push_back(serviceHandleDescriptor);
+        m_handlersByService[std::string(serviceId.to_cstring())] = serviceHandleDescriptor;
+        m_serviceByHandle[serviceHandleDescriptor.handle] = std::string(serviceId.to_cstring());
     }
 
     // handler should be called immediately with the available instances, upon startFindService() call
@@ -95,17 +93,16 @@ cxx::expected<FindServiceHandle, Error> ServiceDiscoveryNotifier::startFindServi
 void ServiceDiscoveryNotifier::stopFindService(const FindServiceHandle handle) noexcept
 {
     std::lock_guard<std::mutex> g(m_queueAccessMutex);
-    auto found = std::find_if(m_handlers.begin(), m_handlers.end(), [handle](const ServiceHandlerDescription& it) {
-        return (it.handle == handle);
-    });
+    auto found = m_serviceByHandle.find(handle);
 
-    if (found != m_handlers.end())
+    if (found != m_serviceByHandle.end())
     {
-        m_handlers.erase(found);
+        m_handlersByService.erase(found->second);
+        m_serviceByHandle.erase(found);
     }
 
     // No services to monitor. Stop the timer
-    if (m_handlers.size() == 0)
+    if (m_handlersByService.size() == 0)
     {
         m_serviceDiscovery.stop();
         m_serviceDiscoveryTimerActive = false;
@@ -123,8 +120,9 @@ void ServiceDiscoveryNotifier::serviceDiscoveryNotifier() noexcept
         // Synchronise access to m_handlers
         std::lock_guard<std::mutex> g(m_queueAccessMutex);
         // Do service discovery for all the registered services, If there are changes, then call the handler
-        for (auto& element : m_handlers)
+        for (auto& handlerEntry : m_handlersByService)
         {
+            auto& element = handlerEntry.second;
             InstanceContainer lastKnownInstances(element.instances);
             element.instances.clear();
 
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "iceoryx_posh/internal/runtime/shared_memory_user.hpp"
+#include "iceoryx_posh/runtime/posh_domain.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
 #include "iceoryx_utils/cxx/convert.hpp"
@@ -32,18 +33,36 @@ SharedMemoryUser::SharedMemoryUser(std::string baseAddrString[[gnu::unused]],
 {
     if (doMapSharedMemoryIntoThread)
     {
+#ifdef IOX_FIXED_SEGMENT_MAPPING
+        // fixed address mode: map the management segment at the address where
+        // RouDi mapped it, so all processes agree on the virtual addresses and
+        // SharedChunk can skip the relative_ptr translation
+        uintptr_t l_mgmtBaseAddress{0u};
+        iox::cxx::convert::fromString(baseAddrString.c_str(), l_mgmtBaseAddress);
+        void* BASE_ADDRESS_HINT{reinterpret_cast<void*>(l_mgmtBaseAddress)};
+#else
         // we let the OS decide where to map the shm segments
         constexpr void* BASE_ADDRESS_HINT{nullptr};
+#endif
 
         // create and map the already existing shared memory region
         m_shmObject = posix::SharedMemoryObject::create(
-            SHM_NAME, topicSize, posix::AccessMode::readWrite, posix::OwnerShip::openExisting, BASE_ADDRESS_HINT);
+            PoshDomain::getMgmtShmName(), topicSize, posix::AccessMode::readWrite, posix::OwnerShip::openExisting, BASE_ADDRESS_HINT);
 
         if (!m_shmObject.has_value())
         {
             errorHandler(Error::kPOSH__SHM_APP_MAPP_ERR);
         }
 
+#ifdef IOX_FIXED_SEGMENT_MAPPING
+        if (m_shmObject->getBaseAddress() != BASE_ADDRESS_HINT)
+        {
+            // the addresses have to match in every process, a segment mapped
+            // elsewhere would corrupt the raw pointers exchanged by the ports
+            errorHandler(Error::kPOSH__SHM_APP_MAPP_ERR);
+        }
+#endif
+
         RelativePointer::registerPtr(segmentId, m_shmObject->getBaseAddress(), m_shmObject->getSizeInBytes());
 
         LogInfo() << "Application registered management segment "
@@ -59,18 +78,37 @@ SharedMemoryUser::SharedMemoryUser(std::string baseAddrString[[gnu::unused]],
         for (const auto& segment : segmentMapping)
         {
             auto accessMode = segment.m_isWritable ? posix::AccessMode::readWrite : posix::AccessMode::readOnly;
+#ifdef IOX_FIXED_SEGMENT_MAPPING
+            // payload segments go to the addresses RouDi reserved for them
+            void* l_segmentAddressHint{segment.m_startAddress};
+#else
+            void* l_segmentAddressHint{BASE_ADDRESS_HINT};
+#endif
             auto shmObject = posix::SharedMemoryObject::create(segment.m_sharedMemoryName.c_str(),
                                                                segment.m_size,
                                                                accessMode,
                                                                posix::OwnerShip::openExisting,
-                                                               BASE_ADDRESS_HINT);
+                                                               l_segmentAddressHint);
             if (shmObject.has_value())
             {
+#ifdef IOX_FIXED_SEGMENT_MAPPING
+                if (shmObject->getBaseAddress() != segment.m_startAddress)
+                {
+                    errorHandler(Error::kPOSH__SHM_APP_SEGMENT_MAPP_ERR);
+                }
+#endif
                 if (static_cast<uint32_t>(m_payloadShmObjects.size()) >= MAX_SHM_SEGMENTS)
                 {
                     errorHandler(Error::kPOSH__SHM_APP_SEGMENT_COUNT_OVERFLOW);
                 }
 
+                if (segment.m_prefault)
+                {
+                    // pay the page faults of the freshly mapped segment here at registration
+                    // time instead of on the first samples
+                    shmObject->prefault();
+                }
+
                 RelativePointer::registerPtr(
                     segment.m_segmentId, shmObject->getBaseAddress(), shmObject->getSizeInBytes());
 
@@ -0,0 +1,88 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/roudi_environment/perf_test_fixture.hpp"
+#include "iceoryx_utils/cxx/optional.hpp"
+#include "test.hpp"
+
+#include <iostream>
+
+using namespace ::testing;
+
+class PortPairPerformance_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        internal::CaptureStderr();
+        m_perfEnv.emplace();
+        m_pair = m_perfEnv->createPortPair({1, 2, 3});
+    }
+
+    void TearDown() override
+    {
+        m_pair.m_sender.deactivate();
+        m_pair.m_receiver.unsubscribe();
+        m_perfEnv.reset();
+        std::string output = internal::GetCapturedStderr();
+        if (Test::HasFailure())
+        {
+            std::cout << output << std::endl;
+        }
+    }
+
+    static constexpr uint64_t ITERATIONS{10000u};
+    static constexpr uint32_t PAYLOAD_SIZE{128u};
+
+    iox::cxx::optional<iox::roudi::PerfTestEnvironment> m_perfEnv;
+    iox::roudi::PortPair m_pair;
+};
+
+constexpr uint64_t PortPairPerformance_test::ITERATIONS;
+constexpr uint32_t PortPairPerformance_test::PAYLOAD_SIZE;
+
+TEST_F(PortPairPerformance_test, DeliverAndReceiveRoundtrip)
+{
+    uint64_t receivedChunks{0u};
+
+    auto measurement = iox::roudi::CycleTimer::measure(ITERATIONS, [&] {
+        auto chunkHeader = m_pair.m_sender.reserveChunk(PAYLOAD_SIZE);
+        chunkHeader->m_info.m_payloadSize = PAYLOAD_SIZE;
+        m_pair.m_sender.deliverChunk(chunkHeader);
+
+        const iox::mepoo::ChunkHeader* receivedHeader{nullptr};
+        if (m_pair.m_receiver.getChunk(receivedHeader))
+        {
+            ++receivedChunks;
+            m_pair.m_receiver.releaseChunk(receivedHeader);
+        }
+    });
+
+    // the perf number is informational, a hard cycle bound would be flaky
+    // across CI machines; the gate on regressions is iceperf-compare
+    std::cerr << "sender to receiver roundtrip: " << measurement.cyclesPerIteration() << " cycles, "
+              << measurement.nsPerIteration() << " ns per iteration" << std::endl;
+
+    EXPECT_THAT(receivedChunks, Eq(ITERATIONS));
+    EXPECT_THAT(m_pair.m_receiver.getDropCount(), Eq(0u));
+}
+
+TEST_F(PortPairPerformance_test, ManualClockIsDeterministic)
+{
+    auto& clock = m_perfEnv->getManualClock();
+    auto start = clock.now();
+    clock.advance(1000u);
+    clock.advance(500u);
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::nanoseconds>(clock.now() - start).count(), Eq(1500));
+}
@@ -89,8 +89,11 @@ class CMqInterfaceStartupRace_test : public Test
         constexpr uint32_t DUMMY_SHM_OFFSET{73};
         constexpr uint32_t DUMMY_SEGMENT_ID{13};
         constexpr uint32_t INDEX_OF_TIMESTAMP{4};
+        constexpr uint32_t DUMMY_COMMAND_CHANNEL_OFFSET{0}; // 0 means no command channel provided
+        constexpr uint32_t DUMMY_UNIQUE_ID_RANGE{1};
         regAck << mqMessageTypeToString(MqMessageType::REG_ACK) << DUMMY_SHM_ADDRESS << DUMMY_SHM_SIZE
-               << DUMMY_SHM_OFFSET << oldMsg.getElementAtIndex(INDEX_OF_TIMESTAMP) << DUMMY_SEGMENT_ID;
+               << DUMMY_SHM_OFFSET << oldMsg.getElementAtIndex(INDEX_OF_TIMESTAMP) << DUMMY_SEGMENT_ID
+               << DUMMY_COMMAND_CHANNEL_OFFSET << DUMMY_UNIQUE_ID_RANGE;
 
         if (m_appQueue.has_error())
         {
@@ -25,5 +25,9 @@ class MePooMemoryManager_MOCK
         return iox::MAX_NUMBER_OF_MEMPOOLS;
     }
     MOCK_CONST_METHOD1(getMemPoolInfo, iox::mepoo::MemPoolInfo(uint32_t));
+    iox::mepoo::MemoryManager::PortAccountingInfo getPortAccountingInfo(uint32_t) const
+    {
+        return iox::mepoo::MemoryManager::PortAccountingInfo();
+    }
 };
 
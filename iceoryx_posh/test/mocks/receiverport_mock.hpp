@@ -69,6 +69,14 @@ class ReceiverPort_MOCK
     MOCK_CONST_METHOD0(getDeliveryFiFoSize, uint64_t());
     MOCK_CONST_METHOD0(getSubscriptionState, uint32_t());
     MOCK_CONST_METHOD0(getDeliveryFiFoCapacity, uint32_t());
+    MOCK_CONST_METHOD0(getDeliveryFiFoIndexConflicts, uint64_t());
     MOCK_CONST_METHOD0(getCaProServiceDescription, iox::capro::ServiceDescription());
     MOCK_METHOD0(AreCallbackReferencesSet, bool());
+    MOCK_CONST_METHOD0(getUniqueID, uint64_t());
+
+    const iox::popo::LatencyHistogram& getLatencyHistogram() const
+    {
+        return *m_latencyHistogram;
+    }
+    std::shared_ptr<iox::popo::LatencyHistogram> m_latencyHistogram{new iox::popo::LatencyHistogram()};
 };
@@ -42,6 +42,10 @@ class SenderPort_MOCK
         uint64_t getUniqueIDReturn{0};
         uint64_t getThroughput{0};
         typename iox::popo::SenderPortData::Throughput getThroughputReturn;
+        uint64_t getChunkSizeStatistics{0};
+        typename iox::popo::SenderPortData::ChunkSizeStatistics getChunkSizeStatisticsReturn;
+        uint64_t getChunkQuotaStatistics{0};
+        typename iox::popo::SenderPortData::ChunkQuotaStatistics getChunkQuotaStatisticsReturn;
         uint64_t getNanosecondsBetweenLastTwoDeliveries{0};
         uint64_t getNanosecondsBetweenLastTwoDeliveriesReturn{0};
         uint64_t isConnectedToMembers;
@@ -88,7 +92,7 @@ class SenderPort_MOCK
         }
         return details->hasSubscribersReturn;
     }
-    void enableDoDeliverOnSubscription()
+    void enableDoDeliverOnSubscription(const uint32_t = 1u)
     {
         if (globalDetails)
         {
@@ -144,6 +148,26 @@ class SenderPort_MOCK
         }
         return details->getThroughputReturn;
     }
+    typename iox::popo::SenderPortData::ChunkSizeStatistics getChunkSizeStatistics() const
+    {
+        details->getChunkSizeStatistics++;
+        if (globalDetails)
+        {
+            globalDetails->getChunkSizeStatistics++;
+            return globalDetails->getChunkSizeStatisticsReturn;
+        }
+        return details->getChunkSizeStatisticsReturn;
+    }
+    typename iox::popo::SenderPortData::ChunkQuotaStatistics getChunkQuotaStatistics() const
+    {
+        details->getChunkQuotaStatistics++;
+        if (globalDetails)
+        {
+            globalDetails->getChunkQuotaStatistics++;
+            return globalDetails->getChunkQuotaStatisticsReturn;
+        }
+        return details->getChunkQuotaStatisticsReturn;
+    }
     uint64_t getNanosecondsBetweenLastTwoDeliveries()
     {
         details->getNanosecondsBetweenLastTwoDeliveries++;
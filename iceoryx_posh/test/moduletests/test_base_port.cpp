@@ -236,3 +236,19 @@ INSTANTIATE_TEST_CASE_P(
     CaPro,
     BasePortParamtest,
     Values(&CreateCaProPort, &CreateReceiverPort, &CreateSenderPort, &CreateInterfacePort, &CreateApplicationPort));
+
+TEST(BasePortUniqueId, UniqueIdRangeIsEncodedInTheUpperBits)
+{
+    BasePortData::setUniqueIdRange(5u);
+    BasePortData portData;
+    EXPECT_THAT(portData.m_uniqueId.load() >> BasePortData::UNIQUE_ID_RANGE_SHIFT, Eq(5u));
+
+    BasePortData::setUniqueIdRange(6u);
+    BasePortData nextPortData;
+    EXPECT_THAT(nextPortData.m_uniqueId.load() >> BasePortData::UNIQUE_ID_RANGE_SHIFT, Eq(6u));
+    // the counter in the lower bits keeps running over range changes
+    EXPECT_THAT(nextPortData.m_uniqueId.load() & ((1ull << BasePortData::UNIQUE_ID_RANGE_SHIFT) - 1u),
+                Gt(portData.m_uniqueId.load() & ((1ull << BasePortData::UNIQUE_ID_RANGE_SHIFT) - 1u)));
+
+    BasePortData::setUniqueIdRange(0u);
+}
@@ -213,3 +213,95 @@ TEST_F(ServiceDescription_test, CopyAssignmentClassHash)
     EXPECT_EQ(desc2.getClassHash()[2], desc1.getClassHash()[2]);
     EXPECT_EQ(desc2.getClassHash()[3], desc1.getClassHash()[3]);
 }
+
+TEST_F(ServiceDescription_test, WireFormatRoundTrip)
+{
+    ServiceDescription desc1("TestService", "TestInstance", "TestEvent", {1, 2, 3, 4});
+    desc1.setInternal();
+
+    ServiceDescription desc2;
+    EXPECT_TRUE(ServiceDescription::fromWireFormat(desc1.toWireFormat(), desc2));
+
+    EXPECT_THAT(desc2.getServiceIDString(), Eq("TestService"));
+    EXPECT_THAT(desc2.getInstanceIDString(), Eq("TestInstance"));
+    EXPECT_THAT(desc2.getEventIDString(), Eq("TestEvent"));
+    EXPECT_EQ(desc2.getClassHash()[0], desc1.getClassHash()[0]);
+    EXPECT_EQ(desc2.getClassHash()[1], desc1.getClassHash()[1]);
+    EXPECT_EQ(desc2.getClassHash()[2], desc1.getClassHash()[2]);
+    EXPECT_EQ(desc2.getClassHash()[3], desc1.getClassHash()[3]);
+    EXPECT_TRUE(desc2.isInternal());
+    EXPECT_TRUE(desc1 == desc2);
+}
+
+TEST_F(ServiceDescription_test, WireFormatRoundTripIDs)
+{
+    ServiceDescription desc1(1, 2, 3);
+
+    ServiceDescription desc2;
+    EXPECT_TRUE(ServiceDescription::fromWireFormat(desc1.toWireFormat(), desc2));
+
+    EXPECT_EQ(desc2.getServiceID(), 1);
+    EXPECT_EQ(desc2.getEventID(), 2);
+    EXPECT_EQ(desc2.getInstanceID(), 3);
+    EXPECT_FALSE(desc2.hasServiceOnlyDescription());
+    EXPECT_TRUE(desc1 == desc2);
+}
+
+TEST_F(ServiceDescription_test, WireFormatRoundTripServiceOnlyDescription)
+{
+    ServiceDescription desc1(1, 2);
+
+    ServiceDescription desc2;
+    EXPECT_TRUE(ServiceDescription::fromWireFormat(desc1.toWireFormat(), desc2));
+
+    EXPECT_TRUE(desc2.hasServiceOnlyDescription());
+    EXPECT_TRUE(desc1 == desc2);
+}
+
+TEST_F(ServiceDescription_test, WireFormatRejectsInvalidInput)
+{
+    ServiceDescription desc;
+    EXPECT_FALSE(ServiceDescription::fromWireFormat("", desc));
+    EXPECT_FALSE(ServiceDescription::fromWireFormat("abcdef", desc));
+
+    auto wire = ServiceDescription(1, 2, 3).toWireFormat();
+    wire[0] = 'x';
+    EXPECT_FALSE(ServiceDescription::fromWireFormat(wire, desc));
+}
+
+TEST_F(ServiceDescription_test, HashIsStableOverConstructionPaths)
+{
+    ServiceDescription fromIDs(1, 2, 3);
+    ServiceDescription fromStrings("1", "3", "2");
+    EXPECT_THAT(fromIDs.getHash(), Eq(fromStrings.getHash()));
+
+    ServiceDescription fromSerial(static_cast<iox::cxx::Serialization>(fromIDs));
+    EXPECT_THAT(fromSerial.getHash(), Eq(fromIDs.getHash()));
+
+    ServiceDescription fromWire;
+    EXPECT_TRUE(ServiceDescription::fromWireFormat(fromIDs.toWireFormat(), fromWire));
+    EXPECT_THAT(fromWire.getHash(), Eq(fromIDs.getHash()));
+
+    ServiceDescription assigned;
+    assigned = fromIDs;
+    EXPECT_THAT(assigned.getHash(), Eq(fromIDs.getHash()));
+}
+
+TEST_F(ServiceDescription_test, HashDiffersForDifferentDescriptions)
+{
+    ServiceDescription lhs("foo", "bar", "baz");
+    ServiceDescription rhs("foo", "bar", "qux");
+    EXPECT_THAT(lhs.getHash(), Ne(rhs.getHash()));
+
+    // the field separator keeps shifted boundaries apart
+    ServiceDescription shiftedLhs("foob", "ar", "baz");
+    EXPECT_THAT(lhs.getHash(), Ne(shiftedLhs.getHash()));
+}
+
+TEST_F(ServiceDescription_test, WildcardsStillMatchWithDifferentHashes)
+{
+    ServiceDescription anyEvent(1, iox::capro::AnyEvent, 3);
+    ServiceDescription someEvent(1, 2, 3);
+    EXPECT_THAT(anyEvent.getHash(), Ne(someEvent.getHash()));
+    EXPECT_TRUE(anyEvent == someEvent);
+}
@@ -0,0 +1,247 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/gateway/udp_gateway.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "test.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace ::testing;
+using namespace iox::gateway;
+
+namespace
+{
+struct NetworkTopic
+{
+    uint64_t m_value{0u};
+};
+
+// gives the tests access to the runtime-less constructor
+class TestUdpGateway : public UdpGateway
+{
+  public:
+    TestUdpGateway(const uint16_t f_localPort, const std::string& f_remoteAddress, const uint16_t f_remotePort)
+        : UdpGateway(f_localPort, f_remoteAddress, f_remotePort)
+    {
+    }
+};
+} // namespace
+
+class UdpGateway_test : public Test
+{
+  public:
+    void SetUp()
+    {
+        iox::posix::Allocator allocator(m_memory, sizeof(m_memory));
+        iox::mepoo::MePooConfig mempoolconf;
+        mempoolconf.addMemPool({128, 20});
+        m_memoryManager.configureMemoryManager(mempoolconf, &allocator, &allocator);
+    }
+
+    // a connected in-process sender and receiver pair like in the sender port tests
+    void connect(iox::SenderPortType& f_sender, iox::ReceiverPortType& f_receiver)
+    {
+        f_sender.activate();
+        auto offerMessage = f_sender.getCaProMessage();
+        ASSERT_TRUE(offerMessage.has_value());
+        f_receiver.subscribe(true, 10u);
+        auto subMessage = f_receiver.getCaProMessage();
+        ASSERT_TRUE(subMessage.has_value());
+        f_sender.dispatchCaProMessage(subMessage.value());
+    }
+
+    void deliverTopic(iox::SenderPortType& f_sender, const uint64_t f_value)
+    {
+        auto chunkHeader = f_sender.reserveChunk(sizeof(NetworkTopic));
+        ASSERT_THAT(chunkHeader, Ne(nullptr));
+        static_cast<NetworkTopic*>(chunkHeader->payload())->m_value = f_value;
+        f_sender.deliverChunk(chunkHeader);
+    }
+
+    char m_memory[1024 * 1024];
+    iox::mepoo::MemoryManager m_memoryManager;
+};
+
+TEST_F(UdpGateway_test, FrameRoundTripKeepsSamplesAndOrder)
+{
+    uint8_t frame[FRAME_CAPACITY];
+    FrameBuilder builder(frame, FRAME_CAPACITY);
+
+    for (uint32_t k = 0u; k < 5u; ++k)
+    {
+        uint64_t payload = 100u + k;
+        EXPECT_TRUE(builder.addSample(0xABCDu, k, &payload, sizeof(payload)));
+    }
+    EXPECT_THAT(builder.sampleCount(), Eq(5u));
+
+    FrameParser parser(frame, builder.frameBytes());
+    ASSERT_TRUE(parser.isValid());
+
+    FrameSampleHeader sampleHeader;
+    const uint8_t* payload{nullptr};
+    for (uint32_t k = 0u; k < 5u; ++k)
+    {
+        ASSERT_TRUE(parser.nextSample(sampleHeader, payload));
+        EXPECT_THAT(sampleHeader.m_serviceHash, Eq(0xABCDu));
+        EXPECT_THAT(sampleHeader.m_sequenceNumber, Eq(k));
+        uint64_t value{0u};
+        std::memcpy(&value, payload, sizeof(value));
+        EXPECT_THAT(value, Eq(100u + k));
+    }
+    EXPECT_FALSE(parser.nextSample(sampleHeader, payload));
+}
+
+TEST_F(UdpGateway_test, FullFrameRejectsFurtherSamples)
+{
+    uint8_t frame[FRAME_CAPACITY];
+    FrameBuilder builder(frame, FRAME_CAPACITY);
+
+    uint8_t payload[256];
+    uint32_t packedCount{0u};
+    while (builder.addSample(1u, packedCount, payload, sizeof(payload)))
+    {
+        ++packedCount;
+    }
+    EXPECT_THAT(packedCount, Gt(1u));
+    EXPECT_THAT(builder.frameBytes(), Le(FRAME_CAPACITY));
+    EXPECT_THAT(builder.frameBytes() + sizeof(FrameSampleHeader) + sizeof(payload), Gt(FRAME_CAPACITY));
+}
+
+TEST_F(UdpGateway_test, ParserRejectsForeignAndTruncatedBuffers)
+{
+    uint8_t garbage[64];
+    std::memset(garbage, 0xAA, sizeof(garbage));
+    EXPECT_FALSE(FrameParser(garbage, sizeof(garbage)).isValid());
+
+    uint8_t frame[FRAME_CAPACITY];
+    FrameBuilder builder(frame, FRAME_CAPACITY);
+    uint64_t payload{42u};
+    EXPECT_TRUE(builder.addSample(1u, 0u, &payload, sizeof(payload)));
+    // a frame cut short during reception is rejected
+    EXPECT_FALSE(FrameParser(frame, builder.frameBytes() - 1u).isValid());
+}
+
+TEST_F(UdpGateway_test, TransportMovesFrameBatchOverLoopback)
+{
+    UdpFrameTransport receiverTransport(0u, "127.0.0.1", 1u);
+    ASSERT_TRUE(receiverTransport.isInitialized());
+    UdpFrameTransport senderTransport(0u, "127.0.0.1", receiverTransport.localPort());
+    ASSERT_TRUE(senderTransport.isInitialized());
+
+    uint8_t sendStorage[3][FRAME_CAPACITY];
+    const uint8_t* sendFrames[3];
+    uint32_t sendSizes[3];
+    for (uint32_t i = 0u; i < 3u; ++i)
+    {
+        FrameBuilder builder(sendStorage[i], FRAME_CAPACITY);
+        uint64_t payload = 7u + i;
+        EXPECT_TRUE(builder.addSample(1u, i, &payload, sizeof(payload)));
+        sendFrames[i] = sendStorage[i];
+        sendSizes[i] = builder.frameBytes();
+    }
+    EXPECT_THAT(senderTransport.sendFrames(sendFrames, sendSizes, 3u), Eq(3u));
+
+    uint8_t receiveStorage[UdpFrameTransport::MAX_BATCH_SIZE][FRAME_CAPACITY];
+    uint8_t* receiveFrames[UdpFrameTransport::MAX_BATCH_SIZE];
+    uint32_t receiveCapacities[UdpFrameTransport::MAX_BATCH_SIZE];
+    uint32_t receiveSizes[UdpFrameTransport::MAX_BATCH_SIZE];
+    for (uint32_t i = 0u; i < UdpFrameTransport::MAX_BATCH_SIZE; ++i)
+    {
+        receiveFrames[i] = receiveStorage[i];
+        receiveCapacities[i] = FRAME_CAPACITY;
+    }
+
+    uint32_t receivedCount{0u};
+    for (uint32_t retry = 0u; retry < 100u && receivedCount < 3u; ++retry)
+    {
+        receivedCount += receiverTransport.receiveFrames(&receiveFrames[receivedCount],
+                                                         &receiveCapacities[receivedCount],
+                                                         &receiveSizes[receivedCount],
+                                                         UdpFrameTransport::MAX_BATCH_SIZE - receivedCount);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_THAT(receivedCount, Eq(3u));
+
+    for (uint32_t i = 0u; i < 3u; ++i)
+    {
+        FrameParser parser(receiveStorage[i], receiveSizes[i]);
+        ASSERT_TRUE(parser.isValid());
+        FrameSampleHeader sampleHeader;
+        const uint8_t* payload{nullptr};
+        ASSERT_TRUE(parser.nextSample(sampleHeader, payload));
+        uint64_t value{0u};
+        std::memcpy(&value, payload, sizeof(value));
+        EXPECT_THAT(value, Eq(7u + i));
+    }
+}
+
+TEST_F(UdpGateway_test, SamplesTravelFromPortToPortOverLoopback)
+{
+    iox::capro::ServiceDescription service{"Radar", "FrontLeft", "Object"};
+
+    // sending node: an application publishes, the gateway forwards to the network
+    iox::SenderPortType::MemberType_t appSenderData(service, &m_memoryManager, "", iox::Interfaces::INTERNAL, nullptr);
+    iox::SenderPortType appSender(&appSenderData);
+    iox::ReceiverPortType::MemberType_t gatewayReceiverData(service, "", iox::Interfaces::INTERNAL, nullptr);
+    iox::ReceiverPortType gatewayReceiver(&gatewayReceiverData);
+    connect(appSender, gatewayReceiver);
+
+    // receiving node: the gateway publishes, an application subscribes
+    iox::SenderPortType::MemberType_t gatewaySenderData(
+        service, &m_memoryManager, "", iox::Interfaces::INTERNAL, nullptr);
+    iox::SenderPortType gatewaySender(&gatewaySenderData);
+    iox::ReceiverPortType::MemberType_t appReceiverData(service, "", iox::Interfaces::INTERNAL, nullptr);
+    iox::ReceiverPortType appReceiver(&appReceiverData);
+    connect(gatewaySender, appReceiver);
+
+    TestUdpGateway inboundGateway(0u, "127.0.0.1", 1u);
+    ASSERT_TRUE(inboundGateway.isInitialized());
+    TestUdpGateway outboundGateway(0u, "127.0.0.1", inboundGateway.localPort());
+    ASSERT_TRUE(outboundGateway.isInitialized());
+
+    for (uint64_t k = 0u; k < 4u; ++k)
+    {
+        deliverTopic(appSender, 1000u + k);
+    }
+    EXPECT_THAT(outboundGateway.forwardOutbound(gatewayReceiver, service.getHash(), 10u), Eq(4u));
+
+    auto portLookup = [&](const uint64_t f_serviceHash) -> iox::SenderPortType* {
+        return (f_serviceHash == service.getHash()) ? &gatewaySender : nullptr;
+    };
+
+    uint32_t deliveredCount{0u};
+    for (uint32_t retry = 0u; retry < 100u && deliveredCount < 4u; ++retry)
+    {
+        deliveredCount += inboundGateway.forwardInbound(portLookup);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_THAT(deliveredCount, Eq(4u));
+    EXPECT_THAT(inboundGateway.droppedSampleCount(), Eq(0u));
+
+    uint64_t expectedValue{1000u};
+    const iox::mepoo::ChunkHeader* receivedChunk{nullptr};
+    while (appReceiver.getChunk(receivedChunk))
+    {
+        EXPECT_THAT(static_cast<const NetworkTopic*>(receivedChunk->payload())->m_value, Eq(expectedValue));
+        ++expectedValue;
+        appReceiver.releaseChunk(receivedChunk);
+    }
+    EXPECT_THAT(expectedValue, Eq(1004u));
+}
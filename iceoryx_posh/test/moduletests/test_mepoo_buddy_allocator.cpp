@@ -0,0 +1,134 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test.hpp"
+#include "iceoryx_posh/internal/mepoo/buddy_allocator.hpp"
+
+#include <vector>
+
+using namespace ::testing;
+
+class BuddyAllocator_test : public Test
+{
+  public:
+    static constexpr uint32_t NumberOfMinBlocks{16};
+
+    void SetUp() override
+    {
+        sut.init(m_memory, NumberOfMinBlocks);
+    }
+
+    void TearDown() override
+    {
+    }
+
+    alignas(32) uint8_t m_memory[iox::mepoo::BuddyAllocator::requiredMemorySize(NumberOfMinBlocks)];
+    iox::mepoo::BuddyAllocator sut;
+};
+
+TEST_F(BuddyAllocator_test, PopSingleMinBlock)
+{
+    uint32_t index{42};
+    EXPECT_THAT(sut.pop(1, index), Eq(1u));
+    EXPECT_THAT(index, Lt(NumberOfMinBlocks));
+}
+
+TEST_F(BuddyAllocator_test, PopRoundsUpToNextPowerOfTwo)
+{
+    uint32_t index{0};
+    EXPECT_THAT(sut.pop(3, index), Eq(4u));
+    EXPECT_THAT(sut.pop(5, index), Eq(8u));
+}
+
+TEST_F(BuddyAllocator_test, PopAllMinBlocks)
+{
+    uint32_t index{0};
+    for (uint32_t i = 0; i < NumberOfMinBlocks; i++)
+    {
+        EXPECT_THAT(sut.pop(1, index), Eq(1u));
+    }
+    EXPECT_THAT(sut.pop(1, index), Eq(0u));
+}
+
+TEST_F(BuddyAllocator_test, PopTooLarge)
+{
+    uint32_t index{0};
+    EXPECT_THAT(sut.pop(NumberOfMinBlocks + 1, index), Eq(0u));
+}
+
+TEST_F(BuddyAllocator_test, PopReturnsDistinctBlocks)
+{
+    uint32_t firstIndex{0};
+    uint32_t secondIndex{0};
+    EXPECT_THAT(sut.pop(4, firstIndex), Eq(4u));
+    EXPECT_THAT(sut.pop(4, secondIndex), Eq(4u));
+
+    // the blocks must not overlap
+    EXPECT_THAT(firstIndex + 4 <= secondIndex || secondIndex + 4 <= firstIndex, Eq(true));
+}
+
+TEST_F(BuddyAllocator_test, PushMergesBuddiesBackToFullBlock)
+{
+    std::vector<uint32_t> indices;
+    uint32_t index{0};
+    while (sut.pop(1, index) == 1u)
+    {
+        indices.push_back(index);
+    }
+    EXPECT_THAT(indices.size(), Eq(NumberOfMinBlocks));
+
+    for (const auto& item : indices)
+    {
+        EXPECT_THAT(sut.push(item), Eq(1u));
+    }
+
+    // after all buddies merged again the full block must be allocatable
+    EXPECT_THAT(sut.pop(NumberOfMinBlocks, index), Eq(NumberOfMinBlocks));
+    EXPECT_THAT(index, Eq(0u));
+}
+
+TEST_F(BuddyAllocator_test, PushDoubleFree)
+{
+    uint32_t index{0};
+    EXPECT_THAT(sut.pop(4, index), Eq(4u));
+    EXPECT_THAT(sut.push(index), Eq(4u));
+    EXPECT_THAT(sut.push(index), Eq(0u));
+}
+
+TEST_F(BuddyAllocator_test, PushInteriorIndex)
+{
+    uint32_t index{0};
+    EXPECT_THAT(sut.pop(4, index), Eq(4u));
+    EXPECT_THAT(sut.push(index + 1), Eq(0u));
+    EXPECT_THAT(sut.push(index), Eq(4u));
+}
+
+TEST_F(BuddyAllocator_test, PushOutOfBoundIndex)
+{
+    EXPECT_THAT(sut.push(NumberOfMinBlocks), Eq(0u));
+    EXPECT_THAT(sut.push(NumberOfMinBlocks + 42), Eq(0u));
+}
+
+TEST_F(BuddyAllocator_test, NonPowerOfTwoNumberOfMinBlocks)
+{
+    constexpr uint32_t MinBlocks{12};
+    alignas(32) uint8_t memory[iox::mepoo::BuddyAllocator::requiredMemorySize(MinBlocks)];
+    iox::mepoo::BuddyAllocator allocator;
+    allocator.init(memory, MinBlocks);
+
+    uint32_t index{0};
+    EXPECT_THAT(allocator.pop(8, index), Eq(8u));
+    EXPECT_THAT(allocator.pop(4, index), Eq(4u));
+    EXPECT_THAT(allocator.pop(1, index), Eq(0u));
+}
@@ -17,6 +17,8 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 
+#include <sstream>
+
 using namespace ::testing;
 
 class MemoryManager_test : public Test
@@ -96,6 +98,53 @@ TEST_F(MemoryManager_test, getNumberOfMemPools)
     EXPECT_THAT(sut->getNumberOfMemPools(), Eq(3u));
 }
 
+TEST_F(MemoryManager_test, segmentLocalManagementPlacesChunkManagementWithThePayload)
+{
+    // a separate payload allocator makes the placement of the ChunkManagement
+    // entries observable
+    size_t payloadMemorySize = 1000000;
+    void* payloadMemory = malloc(payloadMemorySize);
+    iox::posix::Allocator payloadAllocator(payloadMemory, payloadMemorySize);
+
+    mempoolconf.addMemPool({128, 10});
+    mempoolconf.m_segmentLocalManagement = true;
+    sut->configureMemoryManager(mempoolconf, allocator, &payloadAllocator);
+
+    {
+        auto chunk = sut->getChunk(50);
+        ASSERT_THAT(chunk, Eq(true));
+
+        auto l_management = reinterpret_cast<uintptr_t>(chunk.release());
+        EXPECT_THAT(l_management >= reinterpret_cast<uintptr_t>(payloadMemory), Eq(true));
+        EXPECT_THAT(l_management < reinterpret_cast<uintptr_t>(payloadMemory) + payloadMemorySize, Eq(true));
+        iox::mepoo::SharedChunk restoredOwnership(reinterpret_cast<iox::mepoo::ChunkManagement*>(l_management));
+    }
+
+    free(payloadMemory);
+}
+
+TEST_F(MemoryManager_test, defaultLayoutPlacesChunkManagementInTheManagementMemory)
+{
+    size_t payloadMemorySize = 1000000;
+    void* payloadMemory = malloc(payloadMemorySize);
+    iox::posix::Allocator payloadAllocator(payloadMemory, payloadMemorySize);
+
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, &payloadAllocator);
+
+    {
+        auto chunk = sut->getChunk(50);
+        ASSERT_THAT(chunk, Eq(true));
+
+        auto l_management = reinterpret_cast<uintptr_t>(chunk.release());
+        EXPECT_THAT(l_management >= reinterpret_cast<uintptr_t>(rawMemory), Eq(true));
+        EXPECT_THAT(l_management < reinterpret_cast<uintptr_t>(rawMemory) + rawMemorySize, Eq(true));
+        iox::mepoo::SharedChunk restoredOwnership(reinterpret_cast<iox::mepoo::ChunkManagement*>(l_management));
+    }
+
+    free(payloadMemory);
+}
+
 TEST_F(MemoryManager_test, getChunkWithNoMemPool)
 {
     EXPECT_DEATH({ sut->getChunk(15); }, ".*");
@@ -152,6 +201,68 @@ TEST_F(MemoryManager_test, getChunkSingleMemPoolToMuchChunks)
 }
 
 
+TEST_F(MemoryManager_test, chunkQuotaDeniesReservationsBeyondTheLimit)
+{
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    iox::mepoo::ChunkQuota quota;
+    quota.m_limit = 2u;
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    chunkStore.push_back(sut->getChunk(50, &quota));
+    chunkStore.push_back(sut->getChunk(50, &quota));
+    EXPECT_THAT(chunkStore[0], Eq(true));
+    EXPECT_THAT(chunkStore[1], Eq(true));
+    EXPECT_THAT(quota.m_usedChunks.load(), Eq(2u));
+
+    // the pool still has chunks but the quota of this consumer is drained
+    EXPECT_THAT(sut->getChunk(50, &quota), Eq(false));
+    EXPECT_THAT(quota.m_deniedRequests.load(), Eq(1u));
+
+    // releasing a chunk hands the charge back and reservations succeed again
+    chunkStore.pop_back();
+    EXPECT_THAT(quota.m_usedChunks.load(), Eq(1u));
+    chunkStore.push_back(sut->getChunk(50, &quota));
+    EXPECT_THAT(chunkStore.back(), Eq(true));
+
+    // a consumer without a quota is not affected
+    EXPECT_THAT(sut->getChunk(50), Eq(true));
+}
+
+TEST_F(MemoryManager_test, portAccountingAttributesOutstandingChunksToThePort)
+{
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    constexpr uint64_t PortID{4711u};
+    auto accounting = sut->fetchPortAccounting(PortID);
+    ASSERT_THAT(accounting, Ne(nullptr));
+    // fetching again for the same port yields the same entry
+    EXPECT_THAT(sut->fetchPortAccounting(PortID), Eq(accounting));
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    chunkStore.push_back(sut->getChunk(50, nullptr, accounting));
+    chunkStore.push_back(sut->getChunk(50, nullptr, accounting));
+    EXPECT_THAT(accounting->m_outstandingChunks.load(), Eq(2u));
+    EXPECT_THAT(accounting->m_totalAllocations.load(), Eq(2u));
+
+    // releasing a chunk hands the count back, the total keeps growing
+    chunkStore.pop_back();
+    EXPECT_THAT(accounting->m_outstandingChunks.load(), Eq(1u));
+    EXPECT_THAT(accounting->m_totalAllocations.load(), Eq(2u));
+
+    // the snapshot of the claimed entry reports the attribution
+    auto info = sut->getPortAccountingInfo(0u);
+    EXPECT_THAT(info.m_portID, Eq(PortID));
+    EXPECT_THAT(info.m_outstandingChunks, Eq(1u));
+    EXPECT_THAT(info.m_totalAllocations, Eq(2u));
+
+    // chunks acquired without accounting are simply not attributed
+    EXPECT_THAT(sut->getChunk(50), Eq(true));
+    EXPECT_THAT(accounting->m_outstandingChunks.load(), Eq(1u));
+}
+
 TEST_F(MemoryManager_test, freeChunkSingleMemPoolFullToEmptyToFull)
 {
     constexpr uint32_t ChunkCount{100};
@@ -326,3 +437,104 @@ TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
     mempoolconf.addMemPool({32, 0});
     EXPECT_DEATH({ sut->configureMemoryManager(mempoolconf, allocator, allocator); }, ".*");
 }
+
+TEST_F(MemoryManager_test, allocationTracingRecordsRequestedSizes)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+    sut->enableAllocationTracing();
+
+    auto chunk1 = sut->getChunk(20);
+    auto chunk2 = sut->getChunk(20);
+    auto chunk3 = sut->getChunk(100);
+
+    auto& trace = sut->getAllocationTrace();
+    EXPECT_THAT(trace.m_totalRequests.load(), Eq(3u));
+    // 20 byte requests fall into size class 4, the 100 byte request into class 6
+    EXPECT_THAT(trace.m_requestsPerSizeClass[4].load(), Eq(2u));
+    EXPECT_THAT(trace.m_requestsPerSizeClass[6].load(), Eq(1u));
+    EXPECT_THAT(trace.m_reservoir[0].load(), Eq(20u));
+    EXPECT_THAT(trace.m_reservoir[2].load(), Eq(100u));
+}
+
+TEST_F(MemoryManager_test, allocationTracingDisabledRecordsNothing)
+{
+    mempoolconf.addMemPool({32, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk = sut->getChunk(20);
+
+    EXPECT_THAT(sut->getAllocationTrace().m_totalRequests.load(), Eq(0u));
+}
+
+TEST_F(MemoryManager_test, allocationTraceDumpContainsHistogramAndPools)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+    sut->enableAllocationTracing();
+
+    auto chunk = sut->getChunk(100);
+
+    std::stringstream dump;
+    sut->dumpAllocationTrace(dump);
+    auto content = dump.str();
+    EXPECT_THAT(content.find("total_requests 1"), Ne(std::string::npos));
+    EXPECT_THAT(content.find("sizeclass 6 1"), Ne(std::string::npos));
+    EXPECT_THAT(content.find("sample 100"), Ne(std::string::npos));
+    EXPECT_THAT(content.find("pool 1 "), Ne(std::string::npos));
+}
+
+TEST_F(MemoryManager_test, configEntryCarriesMemoryHints)
+{
+    iox::mepoo::MePooConfig::Entry entryWithoutHints{32, 10};
+    EXPECT_THAT(entryWithoutHints.m_memoryHints, Eq(0u));
+
+    iox::mepoo::MePooConfig::Entry entry{
+        32, 10, 0, 0, iox::mepoo::MePooConfig::HINT_SEQUENTIAL | iox::mepoo::MePooConfig::HINT_DONT_DUMP};
+    EXPECT_THAT(entry.m_memoryHints,
+                Eq(iox::mepoo::MePooConfig::HINT_SEQUENTIAL | iox::mepoo::MePooConfig::HINT_DONT_DUMP));
+}
+
+TEST_F(MemoryManager_test, memoryHintsAreAppliedDuringConfiguration)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool(
+        {128, 10, 0, 0, iox::mepoo::MePooConfig::HINT_SEQUENTIAL | iox::mepoo::MePooConfig::HINT_DONT_DUMP});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    // the hints are applied per pool at configuration time and must not impair
+    // the chunks handed out afterwards
+    auto chunk = sut->getChunk(100);
+    ASSERT_TRUE(static_cast<bool>(chunk));
+    *reinterpret_cast<uint8_t*>(chunk.getPayload()) = 37;
+    EXPECT_THAT(*reinterpret_cast<uint8_t*>(chunk.getPayload()), Eq(37));
+}
+
+TEST_F(MemoryManager_test, getMemPoolIndexForPayloadSizeResolvesTheFittingPool)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({64, 10});
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    EXPECT_THAT(sut->getMemPoolIndexForPayloadSize(50), Eq(1u));
+    // too large payloads resolve to an out of range index
+    EXPECT_THAT(sut->getMemPoolIndexForPayloadSize(1000), Eq(sut->getNumberOfMemPools()));
+}
+
+TEST_F(MemoryManager_test, getChunkFromPoolSkipsThePoolSearch)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({64, 10});
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto poolIndex = sut->getMemPoolIndexForPayloadSize(50);
+    auto chunk = sut->getChunkFromPool(poolIndex, 50);
+
+    ASSERT_TRUE(static_cast<bool>(chunk));
+    EXPECT_THAT(chunk.getChunkHeader()->m_info.m_payloadSize, Eq(50u));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(1u));
+}
@@ -14,6 +14,7 @@
 
 #include "test.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 
 using namespace ::testing;
@@ -86,6 +87,23 @@ TEST_F(MemPool_test, GetChunkWhenFull)
     EXPECT_THAT(sut.getChunk(), Eq(nullptr));
 }
 
+TEST_F(MemPool_test, getInfoCountsFailedAllocations)
+{
+    for (uint8_t i = 0; i < NumberOfChunks; i++)
+    {
+        sut.getChunk();
+    }
+    EXPECT_THAT(sut.getInfo().m_failedAllocations, Eq(0u));
+
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+
+    auto info = sut.getInfo();
+    EXPECT_THAT(info.m_failedAllocations, Eq(2u));
+    // single threaded, the free-list CAS never has to be retried
+    EXPECT_THAT(info.m_freeListPopRetries, Eq(0u));
+}
+
 TEST_F(MemPool_test, getChunkSize)
 {
     EXPECT_THAT(sut.getChunkSize(), Eq(ChunkSize));
@@ -203,6 +221,166 @@ TEST_F(MemPool_test, getMinFreeWithSecondGetChunk)
     }
 }
 
+TEST_F(MemPool_test, addChunksGrowsPoolUpToReservedCapacity)
+{
+    constexpr uint32_t MaxChunks{NumberOfChunks + 20};
+    alignas(32) uint8_t rawMemory[MaxChunks * ChunkSize + LoFFLiMemoryRequirement];
+    iox::posix::Allocator growAllocator(rawMemory, sizeof(rawMemory));
+    iox::mepoo::MemPool sut(ChunkSize, NumberOfChunks, &growAllocator, &growAllocator, MaxChunks);
+
+    EXPECT_THAT(sut.getChunkCount(), Eq(NumberOfChunks));
+    EXPECT_THAT(sut.getMaxChunkCount(), Eq(MaxChunks));
+
+    std::vector<uint8_t*> chunks;
+    for (uint32_t i = 0; i < NumberOfChunks; ++i)
+    {
+        chunks.push_back(reinterpret_cast<uint8_t*>(sut.getChunk()));
+    }
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+
+    EXPECT_THAT(sut.addChunks(20), Eq(true));
+    EXPECT_THAT(sut.getChunkCount(), Eq(MaxChunks));
+
+    for (uint32_t i = 0; i < 20; ++i)
+    {
+        auto chunk = sut.getChunk();
+        ASSERT_THAT(chunk, Ne(nullptr));
+        chunks.push_back(reinterpret_cast<uint8_t*>(chunk));
+    }
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+
+    EXPECT_THAT(sut.addChunks(1), Eq(false));
+
+    for (auto chunk : chunks)
+    {
+        sut.freeChunk(chunk);
+    }
+}
+
+TEST_F(MemPool_test, addChunksWithoutReservedCapacityFails)
+{
+    EXPECT_THAT(sut.addChunks(1), Eq(false));
+}
+
+TEST_F(MemPool_test, threadLocalCacheWriteAllChunks)
+{
+    sut.enableThreadLocalCache(true);
+
+    std::vector<uint8_t*> chunks;
+    for (uint8_t i = 0; i < NumberOfChunks; i++)
+    {
+        auto chunk = sut.getChunk();
+        ASSERT_THAT(chunk, Ne(nullptr));
+        chunks.push_back(reinterpret_cast<uint8_t*>(chunk));
+        *chunks.back() = i;
+    }
+
+    for (uint8_t i = 0; i < NumberOfChunks; i++)
+    {
+        EXPECT_THAT(*chunks[i], Eq(i));
+    }
+
+    for (auto chunk : chunks)
+    {
+        sut.freeChunk(chunk);
+    }
+}
+
+TEST_F(MemPool_test, threadLocalCacheGetChunkWhenFull)
+{
+    sut.enableThreadLocalCache(true);
+
+    for (uint8_t i = 0; i < NumberOfChunks; i++)
+    {
+        sut.getChunk();
+    }
+
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+}
+
+TEST_F(MemPool_test, threadLocalCacheFreeAndReuseChunks)
+{
+    sut.enableThreadLocalCache(true);
+
+    std::vector<uint8_t*> chunks;
+    for (uint32_t i = 0; i < NumberOfChunks; ++i)
+    {
+        chunks.push_back(reinterpret_cast<uint8_t*>(sut.getChunk()));
+    }
+
+    for (uint32_t i = 0; i < NumberOfChunks; ++i)
+    {
+        sut.freeChunk(chunks[i]);
+    }
+
+    chunks.clear();
+
+    for (uint8_t i = 0; i < NumberOfChunks; ++i)
+    {
+        auto chunk = sut.getChunk();
+        ASSERT_THAT(chunk, Ne(nullptr));
+        chunks.push_back(reinterpret_cast<uint8_t*>(chunk));
+        *chunks.back() = i;
+    }
+
+    for (uint8_t i = 0; i < NumberOfChunks; ++i)
+    {
+        EXPECT_THAT(*chunks[i], Eq(i));
+    }
+}
+
+TEST_F(MemPool_test, buddyPoolGetChunkOfDynamicSize)
+{
+    constexpr uint32_t MinBlockSize{32};
+    constexpr uint32_t MinBlocks{16};
+    alignas(32) uint8_t rawMemory[MinBlocks * MinBlockSize + 10000];
+    iox::posix::Allocator buddyAllocator(rawMemory, sizeof(rawMemory));
+    iox::mepoo::MemPool sut(iox::mepoo::MemPool::BuddyPool, MinBlockSize, MinBlocks, &buddyAllocator, &buddyAllocator);
+
+    EXPECT_THAT(sut.isBuddyPool(), Eq(true));
+
+    // a request of three minimal blocks is rounded up to four
+    uint8_t* chunk = reinterpret_cast<uint8_t*>(sut.getChunk(3 * MinBlockSize));
+    ASSERT_THAT(chunk, Ne(nullptr));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(4u));
+
+    *chunk = 73;
+    EXPECT_THAT(*chunk, Eq(73));
+
+    sut.freeChunk(chunk);
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0u));
+
+    // after the free the whole pool must be allocatable in one piece again
+    EXPECT_THAT(sut.getChunk(MinBlocks * MinBlockSize), Ne(nullptr));
+    EXPECT_THAT(sut.getChunk(MinBlockSize), Eq(nullptr));
+}
+
+TEST_F(MemPool_test, buddyPoolFreeAndReuseDifferentSizes)
+{
+    constexpr uint32_t MinBlockSize{32};
+    constexpr uint32_t MinBlocks{16};
+    alignas(32) uint8_t rawMemory[MinBlocks * MinBlockSize + 10000];
+    iox::posix::Allocator buddyAllocator(rawMemory, sizeof(rawMemory));
+    iox::mepoo::MemPool sut(iox::mepoo::MemPool::BuddyPool, MinBlockSize, MinBlocks, &buddyAllocator, &buddyAllocator);
+
+    std::vector<uint8_t*> chunks;
+    for (uint32_t i = 0; i < MinBlocks; ++i)
+    {
+        auto chunk = sut.getChunk(MinBlockSize);
+        ASSERT_THAT(chunk, Ne(nullptr));
+        chunks.push_back(reinterpret_cast<uint8_t*>(chunk));
+    }
+    EXPECT_THAT(sut.getChunk(MinBlockSize), Eq(nullptr));
+
+    for (auto chunk : chunks)
+    {
+        sut.freeChunk(chunk);
+    }
+
+    EXPECT_THAT(sut.getChunk(MinBlocks / 2 * MinBlockSize), Ne(nullptr));
+    EXPECT_THAT(sut.getChunk(MinBlocks / 2 * MinBlockSize), Ne(nullptr));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     EXPECT_DEATH({ iox::mepoo::MemPool sut(12, 10, &allocator, &allocator); }, ".*");
@@ -212,3 +390,24 @@ TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsNotPowerOf32)
 {
     EXPECT_DEATH({ iox::mepoo::MemPool sut(333, 10, &allocator, &allocator); }, ".*");
 }
+
+TEST_F(MemPool_test, applyMemoryHintsKeepsChunksUsable)
+{
+    // the hints are best effort, unsupported ones only emit a warning; the pool
+    // has to stay fully functional in any case
+    sut.applyMemoryHints(iox::mepoo::MePooConfig::HINT_HUGE_PAGES | iox::mepoo::MePooConfig::HINT_SEQUENTIAL
+                         | iox::mepoo::MePooConfig::HINT_DONT_DUMP | iox::mepoo::MePooConfig::HINT_LOCKED);
+
+    uint8_t* chunk = reinterpret_cast<uint8_t*>(sut.getChunk());
+    ASSERT_THAT(chunk, Ne(nullptr));
+    *chunk = 73;
+    EXPECT_THAT(*chunk, Eq(73));
+    sut.freeChunk(chunk);
+}
+
+TEST_F(MemPool_test, applyMemoryHintsWithoutHintsIsANoOp)
+{
+    sut.applyMemoryHints(0u);
+
+    EXPECT_THAT(sut.getChunk(), Ne(nullptr));
+}
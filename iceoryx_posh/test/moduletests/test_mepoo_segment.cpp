@@ -76,6 +76,20 @@ class MePooSegment_test : public Test
         {
         }
 
+        bool adviseHugePages()
+        {
+            return true;
+        }
+
+        void prefault()
+        {
+        }
+
+        bool bindToNumaNode(const uint32_t)
+        {
+            return true;
+        }
+
         void* allocate(const uint64_t, const uint64_t = 0)
         {
             return nullptr;
@@ -43,7 +43,7 @@ class SharedChunk_Test : public Test
     char memory[4096];
     iox::posix::Allocator allocator{memory, 4096};
     MemPool mempool{64, 10, &allocator, &allocator};
-    MemPool chunkMgmtPool{64, 10, &allocator, &allocator};
+    MemPool chunkMgmtPool{128, 10, &allocator, &allocator}; // must fit sizeof(ChunkManagement)
     void* memoryChunk{mempool.getChunk()};
     ChunkManagement* chunkManagement = GetChunkManagement(memoryChunk);
     iox::mepoo::SharedChunk sut{chunkManagement};
@@ -178,6 +178,33 @@ TEST_F(SharedChunk_Test, hasNoOtherOwnersForMultipleOwner)
     EXPECT_THAT(sut.hasNoOtherOwners(), Eq(false));
 }
 
+TEST_F(SharedChunk_Test, addedReferencesKeepChunkAlive)
+{
+    constexpr uint32_t NumberOfReceivers{3};
+    sut.addReferences(NumberOfReceivers);
+
+    {
+        iox::mepoo::SharedChunk claimed1 = sut.claimAddedReference();
+        iox::mepoo::SharedChunk claimed2 = sut.claimAddedReference();
+        iox::mepoo::SharedChunk claimed3 = sut.claimAddedReference();
+
+        EXPECT_THAT(sut.hasNoOtherOwners(), Eq(false));
+        sut = nullptr;
+        EXPECT_THAT(mempool.getUsedChunks(), Eq(1));
+    }
+
+    // all claimed references are released, the chunk must be back in the mempool
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(0));
+    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(0));
+}
+
+TEST_F(SharedChunk_Test, claimAddedReferenceOnInvalidChunk)
+{
+    iox::mepoo::SharedChunk invalidChunk;
+    invalidChunk.addReferences(5);
+    EXPECT_THAT(static_cast<bool>(invalidChunk.claimAddedReference()), Eq(false));
+}
+
 TEST_F(SharedChunk_Test, getPayloadWhenInvalid)
 {
     SharedChunk sut2(nullptr);
@@ -126,7 +126,7 @@ class SharedPointer_Test : public Test
     char memory[4096];
     iox::posix::Allocator allocator{memory, 4096};
     MemPool mempool{64, 10, &allocator, &allocator};
-    MemPool chunkMgmtPool{64, 10, &allocator, &allocator};
+    MemPool chunkMgmtPool{128, 10, &allocator, &allocator}; // must fit sizeof(ChunkManagement)
 
     void* memoryChunk{mempool.getChunk()};
     ChunkManagement* chunkManagement = GetChunkManagement(memoryChunk);
@@ -336,3 +336,33 @@ TEST_F(SharedPointer_Test, MoveFromEmpty)
     }
     EXPECT_THAT(TestClass::counter.dtor, Eq(1));
 }
+
+TEST_F(SharedPointer_Test, ViewAccessesTheManagedObject)
+{
+    auto view = sutComplex.view();
+    ASSERT_THAT(static_cast<bool>(view), Eq(true));
+    EXPECT_THAT(view->a, Eq(1337));
+    EXPECT_THAT((*view).b, Eq(851));
+
+    view->Increase();
+    EXPECT_THAT(sutComplex->a, Eq(1349));
+}
+
+TEST_F(SharedPointer_Test, ViewDoesNotChangeTheReferenceCounter)
+{
+    auto referenceCount = chunkManagement2->m_referenceCounter.load();
+    {
+        auto view = sutComplex.view();
+        EXPECT_THAT(chunkManagement2->m_referenceCounter.load(), Eq(referenceCount));
+        EXPECT_THAT(view.get(), Eq(sutComplex.get()));
+    }
+    EXPECT_THAT(chunkManagement2->m_referenceCounter.load(), Eq(referenceCount));
+}
+
+TEST_F(SharedPointer_Test, ViewOfEmptySharedPointerIsEmpty)
+{
+    SharedPointer<TestClass> emptySut;
+    auto view = emptySut.view();
+    EXPECT_THAT(static_cast<bool>(view), Eq(false));
+    EXPECT_THAT(view.get(), Eq(nullptr));
+}
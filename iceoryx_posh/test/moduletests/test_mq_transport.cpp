@@ -0,0 +1,155 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test.hpp"
+
+#include "iceoryx_posh/internal/runtime/message_queue_interface.hpp"
+#include "iceoryx_posh/internal/runtime/message_queue_message.hpp"
+
+using namespace ::testing;
+
+using iox::runtime::MqInterfaceCreator;
+using iox::runtime::MqInterfaceUser;
+using iox::runtime::MqMessage;
+using iox::runtime::MqTransportType;
+
+constexpr long MAX_MESSAGES = 10;
+constexpr long MESSAGE_SIZE = 512;
+
+class MqTransport_test : public Test
+{
+  public:
+    void SetUp()
+    {
+    }
+    virtual void TearDown()
+    {
+    }
+};
+
+TEST_F(MqTransport_test, UnixDomainSocketRoundTrip)
+{
+    MqInterfaceCreator creator("/mqtransport_test_uds", MAX_MESSAGES, MESSAGE_SIZE, MqTransportType::UnixDomainSocket);
+    ASSERT_THAT(creator.isInitialized(), Eq(true));
+
+    MqInterfaceUser user("/mqtransport_test_uds", MAX_MESSAGES, MESSAGE_SIZE, MqTransportType::UnixDomainSocket);
+    ASSERT_THAT(user.isInitialized(), Eq(true));
+
+    EXPECT_THAT(user.send({"1", "hello"}), Eq(true));
+
+    MqMessage answer;
+    ASSERT_THAT(creator.timedReceive(1000, answer), Eq(true));
+    EXPECT_THAT(answer.getElementAtIndex(1), Eq("hello"));
+}
+
+TEST_F(MqTransport_test, UnixDomainSocketUserFailsWithoutCreator)
+{
+    MqInterfaceUser user(
+        "/mqtransport_test_uds_orphan", MAX_MESSAGES, MESSAGE_SIZE, MqTransportType::UnixDomainSocket);
+    EXPECT_THAT(user.isInitialized(), Eq(false));
+}
+
+TEST_F(MqTransport_test, UnixDomainSocketTimedReceiveTimesOutWhenEmpty)
+{
+    MqInterfaceCreator creator(
+        "/mqtransport_test_uds_empty", MAX_MESSAGES, MESSAGE_SIZE, MqTransportType::UnixDomainSocket);
+    ASSERT_THAT(creator.isInitialized(), Eq(true));
+
+    MqMessage answer;
+    EXPECT_THAT(creator.timedReceive(10, answer), Eq(false));
+}
+
+TEST_F(MqTransport_test, ShmRingRoundTrip)
+{
+    MqInterfaceCreator creator("/mqtransport_test_ring", MAX_MESSAGES, MESSAGE_SIZE, MqTransportType::ShmRing);
+    ASSERT_THAT(creator.isInitialized(), Eq(true));
+
+    MqInterfaceUser user("/mqtransport_test_ring", MAX_MESSAGES, MESSAGE_SIZE, MqTransportType::ShmRing);
+    ASSERT_THAT(user.isInitialized(), Eq(true));
+
+    EXPECT_THAT(user.send({"1", "hello"}), Eq(true));
+
+    MqMessage answer;
+    ASSERT_THAT(creator.timedReceive(1000, answer), Eq(true));
+    EXPECT_THAT(answer.getElementAtIndex(1), Eq("hello"));
+}
+
+TEST_F(MqTransport_test, ShmRingUserFailsWithoutCreator)
+{
+    MqInterfaceUser user("/mqtransport_test_ring_orphan", MAX_MESSAGES, MESSAGE_SIZE, MqTransportType::ShmRing);
+    EXPECT_THAT(user.isInitialized(), Eq(false));
+}
+
+TEST_F(MqTransport_test, ShmRingKeepsMessageOrderBeyondMqDepth)
+{
+    MqInterfaceCreator creator("/mqtransport_test_ring_depth", MAX_MESSAGES, MESSAGE_SIZE, MqTransportType::ShmRing);
+    ASSERT_THAT(creator.isInitialized(), Eq(true));
+
+    MqInterfaceUser user("/mqtransport_test_ring_depth", MAX_MESSAGES, MESSAGE_SIZE, MqTransportType::ShmRing);
+    ASSERT_THAT(user.isInitialized(), Eq(true));
+
+    // more messages than the posix mq depth of MAX_MESSAGES fit into the ring
+    constexpr uint32_t NUMBER_OF_MESSAGES = 20u;
+    for (uint32_t i = 0u; i < NUMBER_OF_MESSAGES; ++i)
+    {
+        EXPECT_THAT(user.send({"1", std::to_string(i)}), Eq(true));
+    }
+
+    for (uint32_t i = 0u; i < NUMBER_OF_MESSAGES; ++i)
+    {
+        MqMessage answer;
+        ASSERT_THAT(creator.timedReceive(1000, answer), Eq(true));
+        EXPECT_THAT(answer.getElementAtIndex(1), Eq(std::to_string(i)));
+    }
+}
+
+TEST_F(MqTransport_test, UnixDomainSocketTryReceiveDrainsPendingMessages)
+{
+    MqInterfaceCreator creator(
+        "/mqtransport_test_uds_drain", MAX_MESSAGES, MESSAGE_SIZE, MqTransportType::UnixDomainSocket);
+    ASSERT_THAT(creator.isInitialized(), Eq(true));
+
+    MqInterfaceUser user("/mqtransport_test_uds_drain", MAX_MESSAGES, MESSAGE_SIZE, MqTransportType::UnixDomainSocket);
+    ASSERT_THAT(user.isInitialized(), Eq(true));
+
+    EXPECT_THAT(user.send({"1", "first"}), Eq(true));
+    EXPECT_THAT(user.send({"1", "second"}), Eq(true));
+
+    MqMessage answer;
+    ASSERT_THAT(creator.timedReceive(1000, answer), Eq(true));
+    EXPECT_THAT(answer.getElementAtIndex(1), Eq("first"));
+
+    // the second message is already pending and is drained without blocking
+    ASSERT_THAT(creator.tryReceive(answer), Eq(true));
+    EXPECT_THAT(answer.getElementAtIndex(1), Eq("second"));
+
+    EXPECT_THAT(creator.tryReceive(answer), Eq(false));
+}
+
+TEST_F(MqTransport_test, ShmRingTryReceiveReturnsFalseWhenEmpty)
+{
+    MqInterfaceCreator creator(
+        "/mqtransport_test_ring_drain", MAX_MESSAGES, MESSAGE_SIZE, MqTransportType::ShmRing);
+    ASSERT_THAT(creator.isInitialized(), Eq(true));
+
+    MqInterfaceUser user("/mqtransport_test_ring_drain", MAX_MESSAGES, MESSAGE_SIZE, MqTransportType::ShmRing);
+    ASSERT_THAT(user.isInitialized(), Eq(true));
+
+    MqMessage answer;
+    EXPECT_THAT(creator.tryReceive(answer), Eq(false));
+
+    EXPECT_THAT(user.send({"1", "hello"}), Eq(true));
+    ASSERT_THAT(creator.tryReceive(answer), Eq(true));
+    EXPECT_THAT(answer.getElementAtIndex(1), Eq("hello"));
+}
@@ -0,0 +1,197 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/popo/chunk_receive_dispatcher.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace ::testing;
+using namespace iox::popo;
+
+class ChunkReceiveDispatcher_test : public Test
+{
+  protected:
+    ChunkReceiveDispatcher_test()
+        : m_memoryAllocator(m_memory, 1024 * 1024)
+    {
+        mempoolconf.addMemPool({32, 40});
+        m_memPoolHandler.configureMemoryManager(mempoolconf, &m_memoryAllocator, &m_memoryAllocator);
+    }
+
+    // a connected in-process sender and receiver pair like in the receiver port tests
+    void createConnectedPair(iox::SenderPortType*& f_sender, iox::ReceiverPortType*& f_receiver)
+    {
+        auto senderData =
+            new iox::SenderPortType::MemberType_t(m_service, &m_memPoolHandler, "", iox::Interfaces::INTERNAL, nullptr);
+        f_sender = new iox::SenderPortType(senderData);
+        auto receiverData = new iox::ReceiverPortType::MemberType_t(m_service, "", iox::Interfaces::INTERNAL, nullptr);
+        f_receiver = new iox::ReceiverPortType(receiverData);
+        m_cleanup.push_back([=]() {
+            delete f_sender;
+            delete f_receiver;
+            delete senderData;
+            delete receiverData;
+        });
+
+        f_sender->activate();
+        auto offerMessage = f_sender->getCaProMessage();
+        ASSERT_TRUE(offerMessage.has_value());
+        f_receiver->subscribe(true, 10u);
+        auto subMessage = f_receiver->getCaProMessage();
+        ASSERT_TRUE(subMessage.has_value());
+        f_sender->dispatchCaProMessage(subMessage.value());
+    }
+
+    ~ChunkReceiveDispatcher_test()
+    {
+        for (auto& cleanup : m_cleanup)
+        {
+            cleanup();
+        }
+    }
+
+    void deliver(iox::SenderPortType& f_sender, const uint32_t f_value)
+    {
+        auto chunkHeader = f_sender.reserveChunk(sizeof(uint32_t));
+        ASSERT_THAT(chunkHeader, Ne(nullptr));
+        *static_cast<uint32_t*>(chunkHeader->payload()) = f_value;
+        f_sender.deliverChunk(chunkHeader);
+    }
+
+    // drains all pending chunks of a receiver, one wakeup can cover a burst
+    static uint32_t drain(iox::ReceiverPortType& f_receiver)
+    {
+        uint32_t drainedCount{0u};
+        const iox::mepoo::ChunkHeader* chunkHeader{nullptr};
+        while (f_receiver.getChunk(chunkHeader))
+        {
+            ++drainedCount;
+            f_receiver.releaseChunk(chunkHeader);
+        }
+        return drainedCount;
+    }
+
+    template <typename Condition>
+    bool waitFor(const Condition& f_condition, const uint32_t f_timeoutMs = 1000u)
+    {
+        for (uint32_t elapsedMs = 0u; elapsedMs < f_timeoutMs; ++elapsedMs)
+        {
+            if (f_condition())
+            {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return f_condition();
+    }
+
+    char m_memory[1024 * 1024];
+    iox::posix::Allocator m_memoryAllocator;
+    iox::mepoo::MemoryManager m_memPoolHandler;
+    iox::mepoo::MePooConfig mempoolconf;
+    iox::capro::ServiceDescription m_service{1, 1, 1};
+    std::vector<std::function<void()>> m_cleanup;
+};
+
+TEST_F(ChunkReceiveDispatcher_test, HandlerRunsWhenChunksArrive)
+{
+    iox::SenderPortType* sender{nullptr};
+    iox::ReceiverPortType* receiver{nullptr};
+    createConnectedPair(sender, receiver);
+
+    ChunkReceiveDispatcher dispatcher(1u);
+    std::atomic<uint32_t> receivedCount{0u};
+    ASSERT_TRUE(dispatcher.attach(*receiver, [&]() { receivedCount += drain(*receiver); }));
+    EXPECT_THAT(dispatcher.numberOfSubscriptions(), Eq(1u));
+
+    deliver(*sender, 42u);
+    EXPECT_TRUE(waitFor([&]() { return receivedCount.load() == 1u; }));
+
+    deliver(*sender, 43u);
+    deliver(*sender, 44u);
+    EXPECT_TRUE(waitFor([&]() { return receivedCount.load() == 3u; }));
+
+    dispatcher.detach(*receiver);
+    EXPECT_THAT(dispatcher.numberOfSubscriptions(), Eq(0u));
+}
+
+TEST_F(ChunkReceiveDispatcher_test, ManySubscriptionsAreServedByFewThreads)
+{
+    constexpr uint32_t SUBSCRIPTION_COUNT = 8u;
+    iox::SenderPortType* senders[SUBSCRIPTION_COUNT];
+    iox::ReceiverPortType* receivers[SUBSCRIPTION_COUNT];
+    std::atomic<uint32_t> receivedCounts[SUBSCRIPTION_COUNT];
+
+    ChunkReceiveDispatcher dispatcher(2u);
+    for (uint32_t i = 0u; i < SUBSCRIPTION_COUNT; ++i)
+    {
+        createConnectedPair(senders[i], receivers[i]);
+        receivedCounts[i] = 0u;
+        auto receiver = receivers[i];
+        auto receivedCount = &receivedCounts[i];
+        ASSERT_TRUE(dispatcher.attach(*receiver, [=]() { *receivedCount += drain(*receiver); }));
+    }
+    EXPECT_THAT(dispatcher.numberOfSubscriptions(), Eq(SUBSCRIPTION_COUNT));
+
+    for (uint32_t i = 0u; i < SUBSCRIPTION_COUNT; ++i)
+    {
+        deliver(*senders[i], i);
+        deliver(*senders[i], i + 100u);
+    }
+
+    EXPECT_TRUE(waitFor([&]() {
+        for (uint32_t i = 0u; i < SUBSCRIPTION_COUNT; ++i)
+        {
+            if (receivedCounts[i].load() != 2u)
+            {
+                return false;
+            }
+        }
+        return true;
+    }));
+
+    for (uint32_t i = 0u; i < SUBSCRIPTION_COUNT; ++i)
+    {
+        dispatcher.detach(*receivers[i]);
+    }
+}
+
+TEST_F(ChunkReceiveDispatcher_test, DetachedSubscriptionIsNotServedAnymore)
+{
+    iox::SenderPortType* sender{nullptr};
+    iox::ReceiverPortType* receiver{nullptr};
+    createConnectedPair(sender, receiver);
+
+    ChunkReceiveDispatcher dispatcher(1u);
+    std::atomic<uint32_t> receivedCount{0u};
+    ASSERT_TRUE(dispatcher.attach(*receiver, [&]() { receivedCount += drain(*receiver); }));
+
+    deliver(*sender, 1u);
+    EXPECT_TRUE(waitFor([&]() { return receivedCount.load() == 1u; }));
+
+    dispatcher.detach(*receiver);
+    deliver(*sender, 2u);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_THAT(receivedCount.load(), Eq(1u));
+    EXPECT_THAT(drain(*receiver), Eq(1u));
+}
@@ -0,0 +1,213 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/popo/client.hpp"
+#include "iceoryx_posh/popo/request_response.hpp"
+#include "iceoryx_posh/popo/server.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "test.hpp"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::capro;
+
+namespace
+{
+class ClientUnderTest : public Client
+{
+  public:
+    ClientUnderTest(iox::SenderPortType&& f_requestSender, iox::ReceiverPortType&& f_responseReceiver)
+        : Client(std::move(f_requestSender), std::move(f_responseReceiver))
+    {
+    }
+};
+
+class ServerUnderTest : public Server
+{
+  public:
+    ServerUnderTest(iox::ReceiverPortType&& f_requestReceiver, iox::SenderPortType&& f_responseSender)
+        : Server(std::move(f_requestReceiver), std::move(f_responseSender))
+    {
+    }
+};
+} // namespace
+
+class ClientServer_test : public Test
+{
+  protected:
+    ClientServer_test()
+        : m_memoryAllocator(m_memory, 1024 * 1024)
+    {
+        mempoolconf.addMemPool({128, 20});
+        mempoolconf.addMemPool({256, 20});
+        m_memPoolHandler.configureMemoryManager(mempoolconf, &m_memoryAllocator, &m_memoryAllocator);
+    }
+
+    void SetUp()
+    {
+    }
+
+    void TearDown()
+    {
+    }
+
+    iox::ReceiverPortType::MemberType_t* CreateReceiverData(const ServiceDescription& f_service)
+    {
+        auto data = new iox::ReceiverPortType::MemberType_t(f_service, "", iox::Interfaces::INTERNAL, nullptr);
+        m_portData.emplace_back(data);
+        return data;
+    }
+
+    iox::SenderPortType::MemberType_t* CreateSenderData(const ServiceDescription& f_service)
+    {
+        auto data =
+            new iox::SenderPortType::MemberType_t(f_service, &m_memPoolHandler, "", iox::Interfaces::INTERNAL, nullptr);
+        m_portData.emplace_back(data);
+        return data;
+    }
+
+    /// subscribes the receiver to the sender, what RouDi does for connected
+    /// processes; the pending OFFER/SUB requests of the ports are discarded
+    /// since the test wires a fixed topology
+    void Connect(iox::ReceiverPortType::MemberType_t* f_receiverData, iox::SenderPortType::MemberType_t* f_senderData)
+    {
+        iox::ReceiverPortType l_receiver(f_receiverData);
+        iox::SenderPortType l_sender(f_senderData);
+        while (l_sender.getCaProMessage().has_value())
+        {
+        }
+        while (l_receiver.getCaProMessage().has_value())
+        {
+        }
+        CaproMessage l_subscription(CaproMessageType::SUB, l_receiver.getCaProServiceDescription());
+        l_subscription.m_requestPort = f_receiverData;
+        l_sender.dispatchCaProMessage(l_subscription);
+    }
+
+    std::unique_ptr<ClientUnderTest> CreateClient(const ServiceDescription& f_service)
+    {
+        auto requestSenderData = CreateSenderData(f_service);
+        auto responseReceiverData = CreateReceiverData(responseService(f_service));
+        std::unique_ptr<ClientUnderTest> l_client{new ClientUnderTest(iox::SenderPortType(requestSenderData),
+                                                                      iox::ReceiverPortType(responseReceiverData))};
+        Connect(m_serverRequestReceiverData, requestSenderData);
+        Connect(responseReceiverData, m_serverResponseSenderData);
+        return l_client;
+    }
+
+    std::unique_ptr<ServerUnderTest> CreateServer(const ServiceDescription& f_service)
+    {
+        m_serverRequestReceiverData = CreateReceiverData(f_service);
+        m_serverResponseSenderData = CreateSenderData(responseService(f_service));
+        return std::unique_ptr<ServerUnderTest>{new ServerUnderTest(
+            iox::ReceiverPortType(m_serverRequestReceiverData), iox::SenderPortType(m_serverResponseSenderData))};
+    }
+
+    char m_memory[1024 * 1024];
+    iox::posix::Allocator m_memoryAllocator;
+    iox::mepoo::MemoryManager m_memPoolHandler;
+    iox::mepoo::MePooConfig mempoolconf;
+    ServiceDescription m_service{4, 4, 4};
+    std::vector<BasePortData*> m_portData;
+    iox::ReceiverPortType::MemberType_t* m_serverRequestReceiverData{nullptr};
+    iox::SenderPortType::MemberType_t* m_serverResponseSenderData{nullptr};
+    // the server has to exist first, CreateClient connects against its ports
+    std::unique_ptr<ServerUnderTest> m_server = CreateServer(m_service);
+    std::unique_ptr<ClientUnderTest> m_client = CreateClient(m_service);
+
+    ~ClientServer_test()
+    {
+        m_client.reset();
+        m_server.reset();
+        for (auto member : m_portData)
+        {
+            delete member;
+        }
+    }
+};
+
+TEST_F(ClientServer_test, requestReachesServerWithContext)
+{
+    auto request = static_cast<uint64_t*>(m_client->allocateRequest(sizeof(uint64_t)));
+    *request = 0xAFFEu;
+    auto l_correlationId = m_client->sendRequest(request);
+
+    EXPECT_THAT(m_server->hasRequests(), Eq(true));
+
+    const void* payload{nullptr};
+    RequestContext context;
+    ASSERT_THAT(m_server->getRequest(&payload, context), Eq(true));
+    EXPECT_THAT(*static_cast<const uint64_t*>(payload), Eq(0xAFFEu));
+    EXPECT_THAT(context.m_correlationId, Eq(l_correlationId));
+    EXPECT_THAT(context.m_clientTag, Eq(m_client->getClientTag()));
+    EXPECT_THAT(m_server->releaseRequest(payload), Eq(true));
+}
+
+TEST_F(ClientServer_test, responseCarriesCorrelationIdOfRequest)
+{
+    auto request = static_cast<uint64_t*>(m_client->allocateRequest(sizeof(uint64_t)));
+    *request = 20u;
+    auto l_correlationId = m_client->sendRequest(request);
+
+    const void* requestPayload{nullptr};
+    RequestContext context;
+    ASSERT_THAT(m_server->getRequest(&requestPayload, context), Eq(true));
+    auto response = static_cast<uint64_t*>(m_server->allocateResponse(sizeof(uint64_t)));
+    *response = *static_cast<const uint64_t*>(requestPayload) * 2u;
+    m_server->sendResponse(response, context);
+    m_server->releaseRequest(requestPayload);
+
+    EXPECT_THAT(m_client->hasResponse(), Eq(true));
+    const void* responsePayload{nullptr};
+    uint64_t l_responseCorrelationId{0u};
+    ASSERT_THAT(m_client->getResponse(&responsePayload, l_responseCorrelationId), Eq(true));
+    EXPECT_THAT(*static_cast<const uint64_t*>(responsePayload), Eq(40u));
+    EXPECT_THAT(l_responseCorrelationId, Eq(l_correlationId));
+    EXPECT_THAT(m_client->releaseResponse(responsePayload), Eq(true));
+}
+
+TEST_F(ClientServer_test, responseIsRoutedToRequestingClientOnly)
+{
+    auto secondClient = CreateClient(m_service);
+
+    auto request = static_cast<uint64_t*>(m_client->allocateRequest(sizeof(uint64_t)));
+    *request = 1u;
+    m_client->sendRequest(request);
+
+    const void* requestPayload{nullptr};
+    RequestContext context;
+    ASSERT_THAT(m_server->getRequest(&requestPayload, context), Eq(true));
+    auto response = static_cast<uint64_t*>(m_server->allocateResponse(sizeof(uint64_t)));
+    *response = 2u;
+    m_server->sendResponse(response, context);
+    m_server->releaseRequest(requestPayload);
+
+    // the chunk filter of the second client drops the foreign response
+    EXPECT_THAT(secondClient->hasResponse(), Eq(false));
+    EXPECT_THAT(m_client->hasResponse(), Eq(true));
+
+    const void* responsePayload{nullptr};
+    uint64_t l_responseCorrelationId{0u};
+    ASSERT_THAT(m_client->getResponse(&responsePayload, l_responseCorrelationId), Eq(true));
+    m_client->releaseResponse(responsePayload);
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/popo/latency_histogram.hpp"
+#include "test.hpp"
+
+using namespace ::testing;
+using iox::popo::LatencyHistogram;
+
+class LatencyHistogram_test : public Test
+{
+  public:
+    LatencyHistogram m_histogram;
+};
+
+TEST_F(LatencyHistogram_test, emptyHistogram)
+{
+    EXPECT_THAT(m_histogram.totalCount(), Eq(0u));
+    EXPECT_THAT(m_histogram.maxNs(), Eq(0u));
+    EXPECT_THAT(m_histogram.percentile(50.), Eq(0u));
+    EXPECT_THAT(m_histogram.percentile(99.), Eq(0u));
+}
+
+TEST_F(LatencyHistogram_test, singleValue)
+{
+    m_histogram.record(1000u);
+
+    EXPECT_THAT(m_histogram.totalCount(), Eq(1u));
+    EXPECT_THAT(m_histogram.maxNs(), Eq(1000u));
+    // a single value is its own percentile, clamped to the exactly tracked maximum
+    EXPECT_THAT(m_histogram.percentile(50.), Eq(1000u));
+    EXPECT_THAT(m_histogram.percentile(99.), Eq(1000u));
+}
+
+TEST_F(LatencyHistogram_test, percentilesWithFactorTwoResolution)
+{
+    // 99 values in the bucket [1024, 2047] and one outlier
+    for (uint64_t i = 0u; i < 99u; ++i)
+    {
+        m_histogram.record(1500u);
+    }
+    m_histogram.record(1000000u);
+
+    EXPECT_THAT(m_histogram.totalCount(), Eq(100u));
+    EXPECT_THAT(m_histogram.maxNs(), Eq(1000000u));
+    // the percentiles report the upper edge of the bucket they fall into
+    EXPECT_THAT(m_histogram.percentile(50.), Eq(2047u));
+    EXPECT_THAT(m_histogram.percentile(99.), Eq(2047u));
+    EXPECT_THAT(m_histogram.percentile(100.), Eq(1000000u));
+}
+
+TEST_F(LatencyHistogram_test, maximumIsTrackedExactly)
+{
+    m_histogram.record(100u);
+    m_histogram.record(12345u);
+    m_histogram.record(54u);
+
+    EXPECT_THAT(m_histogram.maxNs(), Eq(12345u));
+    EXPECT_THAT(m_histogram.percentile(100.), Eq(12345u));
+}
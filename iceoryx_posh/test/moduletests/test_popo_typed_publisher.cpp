@@ -0,0 +1,114 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/popo/typed_publisher.hpp"
+#include "test.hpp"
+
+using namespace ::testing;
+using namespace iox::popo;
+
+namespace
+{
+struct CounterTopic
+{
+    CounterTopic() = default;
+    CounterTopic(uint32_t f_counter)
+        : counter(f_counter)
+    {
+    }
+    uint32_t counter{73u};
+};
+
+/// test double which captures the calls the typed front end forwards to the
+/// untyped base; no runtime and no ports are needed this way
+class TypedPublisherDouble : public TypedPublisher<CounterTopic>
+{
+  public:
+    TypedPublisherDouble() = default;
+
+    void* allocateFixedSizeChunk(uint32_t f_payloadSize) noexcept override
+    {
+        m_lastRequestedSize = f_payloadSize;
+        return m_nextAllocation;
+    }
+
+    void sendChunk(const void* const f_payload) noexcept override
+    {
+        m_lastSentPayload = f_payload;
+    }
+
+    void freeChunk(void* const f_payload) noexcept override
+    {
+        m_lastFreedPayload = f_payload;
+    }
+
+    uint32_t m_lastRequestedSize{0u};
+    void* m_nextAllocation{nullptr};
+    const void* m_lastSentPayload{nullptr};
+    void* m_lastFreedPayload{nullptr};
+};
+} // namespace
+
+class TypedPublisher_test : public Test
+{
+  public:
+    void SetUp()
+    {
+    }
+
+    void TearDown()
+    {
+    }
+
+    alignas(CounterTopic) uint8_t m_buffer[sizeof(CounterTopic)];
+    TypedPublisherDouble sut;
+};
+
+TEST_F(TypedPublisher_test, AllocateRequestsSizeofTopicAndConstructsInPlace)
+{
+    sut.m_nextAllocation = m_buffer;
+
+    auto sample = sut.allocate();
+    ASSERT_THAT(sample, Ne(nullptr));
+    EXPECT_THAT(sut.m_lastRequestedSize, Eq(static_cast<uint32_t>(sizeof(CounterTopic))));
+    EXPECT_THAT(static_cast<void*>(sample), Eq(static_cast<void*>(m_buffer)));
+    EXPECT_THAT(sample->counter, Eq(73u));
+}
+
+TEST_F(TypedPublisher_test, AllocateForwardsConstructorArguments)
+{
+    sut.m_nextAllocation = m_buffer;
+
+    auto sample = sut.allocate(42u);
+    ASSERT_THAT(sample, Ne(nullptr));
+    EXPECT_THAT(sample->counter, Eq(42u));
+}
+
+TEST_F(TypedPublisher_test, AllocateReturnsNullptrWhenOutOfChunks)
+{
+    sut.m_nextAllocation = nullptr;
+    EXPECT_THAT(sut.allocate(), Eq(nullptr));
+}
+
+TEST_F(TypedPublisher_test, SendAndFreeForwardTheTypedSample)
+{
+    sut.m_nextAllocation = m_buffer;
+    auto sample = sut.allocate();
+
+    sut.send(sample);
+    EXPECT_THAT(sut.m_lastSentPayload, Eq(static_cast<const void*>(sample)));
+
+    sut.free(sample);
+    EXPECT_THAT(sut.m_lastFreedPayload, Eq(static_cast<void*>(sample)));
+}
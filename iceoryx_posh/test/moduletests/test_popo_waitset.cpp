@@ -0,0 +1,221 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "test.hpp"
+
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::capro;
+using CaproMessage = iox::capro::CaproMessage;
+
+class WaitSet_test : public Test
+{
+  protected:
+    WaitSet_test()
+        : m_memoryAllocator(m_memory, 1024 * 1024)
+    {
+        mempoolconf.addMemPool({32, 20});
+        m_memPoolHandler.configureMemoryManager(mempoolconf, &m_memoryAllocator, &m_memoryAllocator);
+
+        ActivateSender(m_sender1, m_service1);
+        ActivateSender(m_sender2, m_service2);
+        SubscribeReceiverToSender(m_receiver1, m_sender1);
+        SubscribeReceiverToSender(m_receiver2, m_sender2);
+    }
+
+    ~WaitSet_test()
+    {
+        // detach before the ports are deleted, the wait set destructor would
+        // otherwise access them
+        m_sut.detachAllReceivers();
+        for (auto port : m_ports)
+        {
+            delete port;
+        }
+        for (auto member : m_portData)
+        {
+            delete member;
+        }
+    }
+
+    void SetUp()
+    {
+    }
+
+    void TearDown()
+    {
+    }
+
+    void SubscribeReceiverToSender(iox::ReceiverPortType* f_receiver, iox::SenderPortType* f_sender)
+    {
+        f_receiver->subscribe(true, 10);
+
+        auto returnedCaproMessage = f_receiver->getCaProMessage();
+        ASSERT_THAT(returnedCaproMessage.has_value(), Eq(true));
+        auto senderResponse = f_sender->dispatchCaProMessage(returnedCaproMessage.value());
+        ASSERT_THAT(senderResponse.has_value(), Eq(true));
+        ASSERT_THAT(f_receiver->isSubscribed(), Eq(true));
+    }
+
+    iox::ReceiverPortType* CreateReceiver(const ServiceDescription& f_service)
+    {
+        iox::ReceiverPortType::MemberType_t* data =
+            new iox::ReceiverPortType::MemberType_t(f_service, "", iox::Interfaces::INTERNAL, nullptr);
+        m_portData.emplace_back(data);
+        iox::ReceiverPortType* l_receiver = new iox::ReceiverPortType(data);
+        m_ports.emplace_back(l_receiver);
+        return l_receiver;
+    }
+
+    iox::SenderPortType* CreateSender(const ServiceDescription& f_service)
+    {
+        iox::SenderPortType::MemberType_t* data =
+            new iox::SenderPortType::MemberType_t(f_service, &m_memPoolHandler, "", iox::Interfaces::INTERNAL, nullptr);
+        m_portData.emplace_back(data);
+        iox::SenderPortType* l_sender = new iox::SenderPortType(data);
+        m_ports.emplace_back(l_sender);
+
+        return l_sender;
+    }
+
+    void ActivateSender(iox::SenderPortType* const f_sender, const ServiceDescription& f_service)
+    {
+        f_sender->activate();
+        CaproMessage expect_offer_msg = {iox::capro::CaproMessageType::OFFER, f_service};
+
+        auto returnedCaproMessage = f_sender->getCaProMessage();
+        ASSERT_THAT(returnedCaproMessage.has_value(), Eq(true));
+        EXPECT_THAT(returnedCaproMessage.value().m_type, Eq(expect_offer_msg.m_type));
+    }
+
+    void Deliver(iox::SenderPortType* f_sender)
+    {
+        int l_data = 100;
+        auto l_delivery = f_sender->reserveChunk(sizeof(l_data));
+        l_delivery->m_info.m_payloadSize = sizeof(l_data);
+        f_sender->deliverChunk(l_delivery);
+    }
+
+    void Drain(iox::ReceiverPortType* f_receiver)
+    {
+        const iox::mepoo::ChunkHeader* l_chunkHeader;
+        while (f_receiver->getChunk(l_chunkHeader))
+        {
+            f_receiver->releaseChunk(l_chunkHeader);
+        }
+    }
+
+    char m_memory[1024 * 1024];
+    std::vector<BasePort*> m_ports;
+    std::vector<BasePortData*> m_portData;
+    iox::posix::Allocator m_memoryAllocator;
+    iox::mepoo::MemoryManager m_memPoolHandler;
+    ServiceDescription m_service1{1, 1, 1};
+    ServiceDescription m_service2{1, 1, 2};
+    iox::mepoo::MePooConfig mempoolconf;
+    iox::SenderPortType* m_sender1 = CreateSender(m_service1);
+    iox::SenderPortType* m_sender2 = CreateSender(m_service2);
+    iox::ReceiverPortType* m_receiver1 = CreateReceiver(m_service1);
+    iox::ReceiverPortType* m_receiver2 = CreateReceiver(m_service2);
+
+    WaitSet m_sut;
+    iox::ReceiverPortType* m_ready[iox::MAX_RECEIVERS_PER_WAITSET];
+};
+
+TEST_F(WaitSet_test, attachAndDetach)
+{
+    EXPECT_THAT(m_sut.getNumberOfAttachedReceivers(), Eq(0u));
+    EXPECT_THAT(m_sut.attachReceiver(*m_receiver1), Eq(true));
+    EXPECT_THAT(m_sut.attachReceiver(*m_receiver2), Eq(true));
+    EXPECT_THAT(m_sut.getNumberOfAttachedReceivers(), Eq(2u));
+
+    EXPECT_THAT(m_sut.detachReceiver(*m_receiver1), Eq(true));
+    EXPECT_THAT(m_sut.detachReceiver(*m_receiver1), Eq(false));
+    EXPECT_THAT(m_sut.getNumberOfAttachedReceivers(), Eq(1u));
+}
+
+TEST_F(WaitSet_test, tryWaitWithoutDelivery)
+{
+    ASSERT_THAT(m_sut.attachReceiver(*m_receiver1), Eq(true));
+    ASSERT_THAT(m_sut.attachReceiver(*m_receiver2), Eq(true));
+
+    EXPECT_THAT(m_sut.tryWait(m_ready, iox::MAX_RECEIVERS_PER_WAITSET), Eq(0u));
+}
+
+TEST_F(WaitSet_test, waitReturnsTheReadyReceiver)
+{
+    ASSERT_THAT(m_sut.attachReceiver(*m_receiver1), Eq(true));
+    ASSERT_THAT(m_sut.attachReceiver(*m_receiver2), Eq(true));
+
+    Deliver(m_sender2);
+
+    auto readyCount = m_sut.wait(m_ready, iox::MAX_RECEIVERS_PER_WAITSET);
+    ASSERT_THAT(readyCount, Eq(1u));
+    EXPECT_THAT(m_ready[0], Eq(m_receiver2));
+}
+
+TEST_F(WaitSet_test, waitReturnsAllReadyReceivers)
+{
+    ASSERT_THAT(m_sut.attachReceiver(*m_receiver1), Eq(true));
+    ASSERT_THAT(m_sut.attachReceiver(*m_receiver2), Eq(true));
+
+    Deliver(m_sender1);
+    Deliver(m_sender2);
+
+    auto readyCount = m_sut.wait(m_ready, iox::MAX_RECEIVERS_PER_WAITSET);
+    ASSERT_THAT(readyCount, Eq(2u));
+    EXPECT_THAT(m_ready[0], Eq(m_receiver1));
+    EXPECT_THAT(m_ready[1], Eq(m_receiver2));
+}
+
+TEST_F(WaitSet_test, timedWaitTimesOut)
+{
+    ASSERT_THAT(m_sut.attachReceiver(*m_receiver1), Eq(true));
+
+    EXPECT_THAT(m_sut.timedWait(m_ready, iox::MAX_RECEIVERS_PER_WAITSET, 10u), Eq(0u));
+}
+
+TEST_F(WaitSet_test, deliveryBeforeAttachIsSeen)
+{
+    Deliver(m_sender1);
+
+    ASSERT_THAT(m_sut.attachReceiver(*m_receiver1), Eq(true));
+
+    auto readyCount = m_sut.timedWait(m_ready, iox::MAX_RECEIVERS_PER_WAITSET, 10u);
+    ASSERT_THAT(readyCount, Eq(1u));
+    EXPECT_THAT(m_ready[0], Eq(m_receiver1));
+}
+
+TEST_F(WaitSet_test, detachOfSemaphoreProviderRewiresRemainingReceivers)
+{
+    ASSERT_THAT(m_sut.attachReceiver(*m_receiver1), Eq(true));
+    ASSERT_THAT(m_sut.attachReceiver(*m_receiver2), Eq(true));
+
+    // receiver1 provided the wakeup semaphore
+    ASSERT_THAT(m_sut.detachReceiver(*m_receiver1), Eq(true));
+
+    Deliver(m_sender2);
+
+    auto readyCount = m_sut.wait(m_ready, iox::MAX_RECEIVERS_PER_WAITSET);
+    ASSERT_THAT(readyCount, Eq(1u));
+    EXPECT_THAT(m_ready[0], Eq(m_receiver2));
+    Drain(m_receiver2);
+}
@@ -0,0 +1,114 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/popo/gateway_channel_pool.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace testing;
+using namespace iox::popo;
+
+class GatewayChannelPool_test : public Test
+{
+  public:
+    void SetUp()
+    {
+    }
+
+    void TearDown()
+    {
+    }
+
+    void waitUntil(const std::function<bool()>& condition)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!condition() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+};
+
+TEST_F(GatewayChannelPool_test, TriggerRunsOnePassPerChannel)
+{
+    constexpr uint32_t NUMBER_OF_CHANNELS = 8u;
+    GatewayChannelPool pool(2u);
+    std::atomic<uint32_t> passCounter{0u};
+
+    for (uint32_t i = 0u; i < NUMBER_OF_CHANNELS; ++i)
+    {
+        EXPECT_THAT(pool.addChannel([&] { passCounter.fetch_add(1u); }), Eq(true));
+    }
+    EXPECT_THAT(pool.numberOfChannels(), Eq(NUMBER_OF_CHANNELS));
+
+    EXPECT_THAT(pool.trigger(), Eq(NUMBER_OF_CHANNELS));
+    waitUntil([&] { return passCounter.load() == NUMBER_OF_CHANNELS && pool.idle(); });
+    EXPECT_THAT(passCounter.load(), Eq(NUMBER_OF_CHANNELS));
+    EXPECT_THAT(pool.idle(), Eq(true));
+}
+
+TEST_F(GatewayChannelPool_test, ChannelWithPassInFlightIsSkipped)
+{
+    GatewayChannelPool pool(2u);
+    std::atomic<bool> block{true};
+    std::atomic<uint32_t> passCounter{0u};
+
+    pool.addChannel([&] {
+        passCounter.fetch_add(1u);
+        while (block.load())
+        {
+            std::this_thread::yield();
+        }
+    });
+
+    EXPECT_THAT(pool.trigger(), Eq(1u));
+    waitUntil([&] { return passCounter.load() == 1u; });
+
+    // the first pass is still executing, a second one must not be submitted
+    EXPECT_THAT(pool.trigger(), Eq(0u));
+    EXPECT_THAT(pool.idle(), Eq(false));
+
+    block.store(false);
+    waitUntil([&] { return pool.idle(); });
+    EXPECT_THAT(pool.trigger(), Eq(1u));
+    waitUntil([&] { return pool.idle(); });
+    EXPECT_THAT(passCounter.load(), Eq(2u));
+}
+
+TEST_F(GatewayChannelPool_test, PerChannelOrderIsPreservedAcrossTriggers)
+{
+    constexpr uint32_t NUMBER_OF_PASSES = 100u;
+    GatewayChannelPool pool(4u);
+    std::vector<uint32_t> sequence;
+    uint32_t nextValue{0u};
+
+    // no lock needed, at most one pass of this channel runs at a time
+    pool.addChannel([&] { sequence.push_back(nextValue++); });
+
+    uint32_t submitted{0u};
+    while (submitted < NUMBER_OF_PASSES)
+    {
+        submitted += pool.trigger();
+    }
+    waitUntil([&] { return pool.idle(); });
+
+    ASSERT_THAT(sequence.size(), Eq(NUMBER_OF_PASSES));
+    for (uint32_t i = 0u; i < NUMBER_OF_PASSES; ++i)
+    {
+        EXPECT_THAT(sequence[i], Eq(i));
+    }
+}
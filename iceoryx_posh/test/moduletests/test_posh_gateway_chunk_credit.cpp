@@ -0,0 +1,98 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/popo/gateway_chunk_credit.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "test.hpp"
+
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::mepoo;
+
+class GatewayChunkCredit_test : public Test
+{
+  public:
+    void SetUp()
+    {
+    }
+
+    void TearDown()
+    {
+    }
+
+    SharedChunk getChunk()
+    {
+        void* memoryChunk = mempool.getChunk();
+        ChunkManagement* v = static_cast<ChunkManagement*>(chunkMgmtPool.getChunk());
+        ChunkHeader* chunkHeader = new (memoryChunk) ChunkHeader();
+        new (v) ChunkManagement{chunkHeader, &mempool, &chunkMgmtPool};
+        return SharedChunk(v);
+    }
+
+    char memory[4096];
+    iox::posix::Allocator allocator{memory, 4096};
+    MemPool mempool{64, 10, &allocator, &allocator};
+    MemPool chunkMgmtPool{128, 10, &allocator, &allocator}; // must fit sizeof(ChunkManagement)
+};
+
+TEST_F(GatewayChunkCredit_test, HoldTakesCreditsUntilExhausted)
+{
+    GatewayChunkCredit sut(2u, GatewayChunkCredit::OverflowPolicy::PAUSE);
+
+    EXPECT_TRUE(sut.hold(getChunk()));
+    EXPECT_TRUE(sut.hold(getChunk()));
+    EXPECT_THAT(sut.heldCount(), Eq(2u));
+
+    EXPECT_FALSE(sut.hold(getChunk()));
+    EXPECT_THAT(sut.heldCount(), Eq(2u));
+    EXPECT_THAT(sut.droppedChunkCount(), Eq(0u));
+}
+
+TEST_F(GatewayChunkCredit_test, ReleaseReturnsCredit)
+{
+    GatewayChunkCredit sut(1u, GatewayChunkCredit::OverflowPolicy::PAUSE);
+    auto chunk = getChunk();
+
+    EXPECT_TRUE(sut.hold(chunk));
+    EXPECT_FALSE(sut.hold(getChunk()));
+
+    EXPECT_TRUE(sut.release(chunk));
+    EXPECT_THAT(sut.heldCount(), Eq(0u));
+    EXPECT_TRUE(sut.hold(getChunk()));
+
+    // a chunk which is not held returns no credit
+    EXPECT_FALSE(sut.release(chunk));
+}
+
+TEST_F(GatewayChunkCredit_test, ReleaseOldestFreesTheMempool)
+{
+    GatewayChunkCredit sut(2u, GatewayChunkCredit::OverflowPolicy::RELEASE_OLDEST);
+
+    EXPECT_TRUE(sut.hold(getChunk()));
+    EXPECT_TRUE(sut.hold(getChunk()));
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(2u));
+
+    // the third chunk displaces the oldest one, which goes back to the pool
+    EXPECT_TRUE(sut.hold(getChunk()));
+    EXPECT_THAT(sut.heldCount(), Eq(2u));
+    EXPECT_THAT(sut.droppedChunkCount(), Eq(1u));
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(2u));
+}
+
+TEST_F(GatewayChunkCredit_test, CreditsAreClampedToMaximum)
+{
+    GatewayChunkCredit sut(GatewayChunkCredit::MAX_CREDITS + 100u);
+    EXPECT_THAT(sut.heldCount(), Eq(0u));
+    EXPECT_TRUE(sut.hold(getChunk()));
+}
@@ -0,0 +1,118 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/popo/interface_port.hpp"
+#include "iceoryx_utils/error_handling/error_handling.hpp"
+#include "test.hpp"
+
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::capro;
+
+class InterfacePort_test : public Test
+{
+  public:
+    void SetUp()
+    {
+    }
+
+    void TearDown()
+    {
+    }
+
+    CaproMessage m_message{CaproMessageType::OFFER, ServiceDescription(1, 2, 3)};
+};
+
+TEST_F(InterfacePort_test, DefaultCapacityIsCompileTimeMaximum)
+{
+    InterfacePortData data("", iox::Interfaces::INTERNAL, nullptr);
+    EXPECT_THAT(data.m_caproMessageFiFoCapacity, Eq(iox::MAX_INTERFACE_CAPRO_FIFO_SIZE));
+}
+
+TEST_F(InterfacePort_test, DispatchRespectsEffectiveCapacity)
+{
+    constexpr uint32_t Capacity{2u};
+    InterfacePortData data("", iox::Interfaces::INTERNAL, nullptr, Capacity);
+    InterfacePort port(&data);
+
+    // the error handler is triggered for every dismissed message
+    uint32_t errorHandlerCallCount{0u};
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&errorHandlerCallCount](const iox::Error, const std::function<void()>, const iox::ErrorLevel) {
+            ++errorHandlerCallCount;
+        });
+
+    for (uint32_t k = 0u; k < Capacity; ++k)
+    {
+        EXPECT_TRUE(port.dispatchCaProMessage(m_message));
+    }
+    EXPECT_THAT(port.getDismissedCaProMessageCount(), Eq(0u));
+
+    EXPECT_FALSE(port.dispatchCaProMessage(m_message));
+    EXPECT_THAT(port.getDismissedCaProMessageCount(), Eq(1u));
+    EXPECT_THAT(errorHandlerCallCount, Eq(1u));
+
+    // draining the fifo makes room again
+    CaproMessage message;
+    EXPECT_TRUE(port.getCaProMessage(message));
+    EXPECT_TRUE(port.dispatchCaProMessage(m_message));
+    EXPECT_THAT(port.getDismissedCaProMessageCount(), Eq(1u));
+}
+
+TEST_F(InterfacePort_test, BatchDispatchReachesTheConsumerInOrder)
+{
+    InterfacePortData data("", iox::Interfaces::INTERNAL, nullptr);
+    InterfacePort port(&data);
+
+    constexpr uint32_t BatchSize{5u};
+    CaproMessage messages[BatchSize];
+    for (uint32_t k = 0u; k < BatchSize; ++k)
+    {
+        messages[k] = CaproMessage(CaproMessageType::OFFER, ServiceDescription(k, k, k));
+    }
+
+    EXPECT_THAT(port.dispatchCaProMessages(messages, BatchSize), Eq(BatchSize));
+
+    CaproMessage fetched[BatchSize];
+    ASSERT_THAT(port.getCaProMessages(fetched, BatchSize), Eq(BatchSize));
+    for (uint32_t k = 0u; k < BatchSize; ++k)
+    {
+        EXPECT_TRUE(fetched[k].m_serviceDescription == messages[k].m_serviceDescription);
+    }
+}
+
+TEST_F(InterfacePort_test, BatchDispatchRespectsEffectiveCapacity)
+{
+    constexpr uint32_t Capacity{3u};
+    InterfacePortData data("", iox::Interfaces::INTERNAL, nullptr, Capacity);
+    InterfacePort port(&data);
+
+    uint32_t errorHandlerCallCount{0u};
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&errorHandlerCallCount](const iox::Error, const std::function<void()>, const iox::ErrorLevel) {
+            ++errorHandlerCallCount;
+        });
+
+    CaproMessage messages[Capacity + 2u];
+    for (auto& message : messages)
+    {
+        message = m_message;
+    }
+
+    // the overhang of the batch is dismissed and counted, with one error
+    // handler call for the whole batch
+    EXPECT_THAT(port.dispatchCaProMessages(messages, Capacity + 2u), Eq(Capacity));
+    EXPECT_THAT(port.getDismissedCaProMessageCount(), Eq(2u));
+    EXPECT_THAT(errorHandlerCallCount, Eq(1u));
+}
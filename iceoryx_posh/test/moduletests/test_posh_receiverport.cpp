@@ -17,9 +17,13 @@
 #include "iceoryx_posh/internal/popo/receiver_port.hpp"
 #include "iceoryx_posh/internal/popo/sender_port.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/mepoo/timestamp_source.hpp"
+#include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "test.hpp"
 
+#include <chrono>
+
 using namespace ::testing;
 using namespace iox::popo;
 using namespace iox::capro;
@@ -163,6 +167,385 @@ TEST_F(ReceiverPort_test, releaseChunk)
     EXPECT_THAT(m_receiver->newData(), Eq(false));
 }
 
+TEST_F(ReceiverPort_test, declaredSingleWriterStillFetchesAndReleasesChunks)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+    m_receiver->declareSingleWriter();
+
+    int l_data = 100;
+    auto l_delivery = m_sender->reserveChunk(sizeof(l_data));
+    l_delivery->m_info.m_payloadSize = sizeof(l_data);
+    m_sender->deliverChunk(l_delivery);
+
+    const iox::mepoo::ChunkHeader* chunkHeader;
+    ASSERT_THAT(m_receiver->getChunk(chunkHeader), true);
+    EXPECT_THAT(chunkHeader->m_info.m_payloadSize, Eq(sizeof(l_data)));
+    EXPECT_THAT(m_receiver->releaseChunk(chunkHeader), true);
+    EXPECT_THAT(m_receiver->newData(), Eq(false));
+}
+
+TEST_F(ReceiverPort_test, overflowPolicyOverwriteOldestCountsDrops)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+    const auto l_capacity = static_cast<uint32_t>(m_receiver->getDeliveryFiFoCapacity());
+
+    const uint32_t l_delivered = l_capacity + 3u;
+    for (uint32_t i = 0u; i < l_delivered; ++i)
+    {
+        auto l_delivery = m_sender->reserveChunk(sizeof(uint32_t));
+        l_delivery->m_info.m_payloadSize = sizeof(uint32_t);
+        l_delivery->m_info.m_externalSequenceNumber_bl = true;
+        l_delivery->m_info.m_sequenceNumber = i;
+        m_sender->deliverChunk(l_delivery);
+    }
+
+    // the oldest chunks were overwritten and counted as dropped; everything
+    // delivered is either retained in order or accounted in the drop counter
+    const auto l_dropped = static_cast<uint32_t>(m_receiver->getDropCount());
+    EXPECT_THAT(l_dropped, Gt(0u));
+    uint32_t l_retained{0u};
+    const iox::mepoo::ChunkHeader* l_chunkHeader;
+    while (m_receiver->getChunk(l_chunkHeader))
+    {
+        EXPECT_THAT(l_chunkHeader->m_info.m_sequenceNumber, Eq(l_dropped + l_retained));
+        EXPECT_THAT(m_receiver->releaseChunk(l_chunkHeader), Eq(true));
+        ++l_retained;
+    }
+    EXPECT_THAT(l_retained + l_dropped, Eq(l_delivered));
+}
+
+TEST_F(ReceiverPort_test, transportSequenceNumberIsStampedMonotonically)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+
+    // no external sequence number is set, so the sender port stamps its own
+    // monotonically increasing one into the chunk info on delivery
+    for (uint32_t i = 0u; i < 3u; ++i)
+    {
+        auto l_delivery = m_sender->reserveChunk(sizeof(uint32_t));
+        l_delivery->m_info.m_payloadSize = sizeof(uint32_t);
+        m_sender->deliverChunk(l_delivery);
+    }
+
+    for (uint32_t i = 0u; i < 3u; ++i)
+    {
+        const iox::mepoo::ChunkHeader* l_chunkHeader;
+        ASSERT_THAT(m_receiver->getChunk(l_chunkHeader), Eq(true));
+        EXPECT_THAT(l_chunkHeader->sequenceNumber(), Eq(i));
+        EXPECT_THAT(m_receiver->releaseChunk(l_chunkHeader), Eq(true));
+    }
+}
+
+TEST_F(ReceiverPort_test, timestampSourceIsStampedIntoTheChunk)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+    m_sender->setTimestampSource(iox::mepoo::TimestampSource::MONOTONIC_RAW);
+
+    auto l_delivery = m_sender->reserveChunk(sizeof(uint32_t));
+    l_delivery->m_info.m_payloadSize = sizeof(uint32_t);
+    m_sender->deliverChunk(l_delivery);
+
+    const iox::mepoo::ChunkHeader* l_chunkHeader;
+    ASSERT_THAT(m_receiver->getChunk(l_chunkHeader), Eq(true));
+    EXPECT_THAT(l_chunkHeader->m_info.m_txTimestampSource, Eq(iox::mepoo::TimestampSource::MONOTONIC_RAW));
+
+    // the stamp has to come from the raw clock: it lies between two reads of it
+    const auto l_now = iox::mepoo::readTimestamp(iox::mepoo::TimestampSource::MONOTONIC_RAW);
+    EXPECT_THAT(l_chunkHeader->m_info.m_txTimestamp.time_since_epoch().count(), Gt(0));
+    EXPECT_THAT(l_chunkHeader->m_info.m_txTimestamp.time_since_epoch().count(),
+                Le(l_now.time_since_epoch().count()));
+    EXPECT_THAT(m_receiver->releaseChunk(l_chunkHeader), Eq(true));
+}
+
+TEST_F(ReceiverPort_test, lastDroppedSequenceNumberNamesTheLostChunk)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+    const auto l_capacity = static_cast<uint32_t>(m_receiver->getDeliveryFiFoCapacity());
+
+    for (uint32_t i = 0u; i < l_capacity + 3u; ++i)
+    {
+        auto l_delivery = m_sender->reserveChunk(sizeof(uint32_t));
+        l_delivery->m_info.m_payloadSize = sizeof(uint32_t);
+        l_delivery->m_info.m_externalSequenceNumber_bl = true;
+        l_delivery->m_info.m_sequenceNumber = i;
+        m_sender->deliverChunk(l_delivery);
+    }
+
+    // the oldest chunks were overwritten, so the most recently lost chunk is
+    // the one with the highest dropped sequence number
+    const auto l_dropped = m_receiver->getDropCount();
+    EXPECT_THAT(l_dropped, Gt(0u));
+    EXPECT_THAT(m_receiver->getLastDroppedSequenceNumber(), Eq(l_dropped - 1u));
+}
+
+TEST_F(ReceiverPort_test, chunkBudgetLimitsChunksInFlight)
+{
+    constexpr uint32_t ChunkBudget{4u};
+    m_receiver->subscribeWithChunkBudget(ChunkBudget, 10u);
+    SubscribeReceiverToSender(m_receiver, m_sender);
+    EXPECT_THAT(m_receiver->getChunkBudget(), Eq(ChunkBudget));
+
+    auto deliverOne = [&] {
+        auto l_delivery = m_sender->reserveChunk(sizeof(uint32_t));
+        l_delivery->m_info.m_payloadSize = sizeof(uint32_t);
+        m_sender->deliverChunk(l_delivery);
+    };
+
+    // only the budget makes it into the delivery FiFo, the rest is skipped
+    for (uint32_t i = 0u; i < 2u * ChunkBudget; ++i)
+    {
+        deliverOne();
+    }
+    EXPECT_THAT(m_receiver->getDeliveryFiFoSize(), Eq(ChunkBudget));
+    EXPECT_THAT(m_receiver->getCreditSkipCount(), Eq(ChunkBudget));
+    EXPECT_THAT(m_receiver->getDropCount(), Eq(0u));
+
+    // chunks fetched but not released still count against the budget
+    const iox::mepoo::ChunkHeader* l_held[2u];
+    ASSERT_THAT(m_receiver->getChunk(l_held[0u]), Eq(true));
+    ASSERT_THAT(m_receiver->getChunk(l_held[1u]), Eq(true));
+    deliverOne();
+    EXPECT_THAT(m_receiver->getCreditSkipCount(), Eq(ChunkBudget + 1u));
+
+    // releasing returns credit and delivery resumes
+    EXPECT_THAT(m_receiver->releaseChunk(l_held[0u]), Eq(true));
+    EXPECT_THAT(m_receiver->releaseChunk(l_held[1u]), Eq(true));
+    deliverOne();
+    EXPECT_THAT(m_receiver->getCreditSkipCount(), Eq(ChunkBudget + 1u));
+    EXPECT_THAT(m_receiver->getDeliveryFiFoSize(), Eq(ChunkBudget - 1u));
+}
+
+TEST_F(ReceiverPort_test, inlineSamplesBypassTheMempool)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+    const auto l_usedChunksBefore = m_memPoolHandler.getMemPoolInfo(0u).m_usedChunks;
+
+    for (uint32_t i = 1u; i <= 3u; ++i)
+    {
+        EXPECT_THAT(m_sender->deliverInline(&i, sizeof(i)), Eq(true));
+    }
+    // the samples sit by value in the delivery FiFo slots, no chunk was taken
+    EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0u).m_usedChunks, Eq(l_usedChunksBefore));
+    EXPECT_THAT(m_receiver->newData(), Eq(true));
+
+    for (uint32_t i = 1u; i <= 3u; ++i)
+    {
+        uint32_t l_value{0u};
+        uint32_t l_size{0u};
+        ASSERT_THAT(m_receiver->getInlineSample(&l_value, l_size), Eq(true));
+        EXPECT_THAT(l_size, Eq(static_cast<uint32_t>(sizeof(l_value))));
+        EXPECT_THAT(l_value, Eq(i));
+    }
+    EXPECT_THAT(m_receiver->newData(), Eq(false));
+}
+
+TEST_F(ReceiverPort_test, inlineSampleBiggerThanTheInlineCapacityIsRejected)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+
+    uint8_t l_tooBig[DeliveryFiFo::ChunkManagementTransport::INLINE_PAYLOAD_CAPACITY + 1u] = {};
+    EXPECT_THAT(m_sender->deliverInline(l_tooBig, sizeof(l_tooBig)), Eq(false));
+    EXPECT_THAT(m_receiver->newData(), Eq(false));
+}
+
+TEST_F(ReceiverPort_test, inlineSamplesWorkInLatestValueMode)
+{
+    m_receiver->subscribe(true, 1u);
+    SubscribeReceiverToSender(m_receiver, m_sender);
+
+    // the second sample overwrites the first in the latest value slot
+    for (uint32_t i = 1u; i <= 2u; ++i)
+    {
+        EXPECT_THAT(m_sender->deliverInline(&i, sizeof(i)), Eq(true));
+    }
+    EXPECT_THAT(m_receiver->getDropCount(), Eq(1u));
+
+    uint32_t l_value{0u};
+    uint32_t l_size{0u};
+    ASSERT_THAT(m_receiver->getInlineSample(&l_value, l_size), Eq(true));
+    EXPECT_THAT(l_value, Eq(2u));
+    EXPECT_THAT(m_receiver->getInlineSample(&l_value, l_size), Eq(false));
+}
+
+TEST_F(ReceiverPort_test, overflowPolicyDiscardNewestKeepsQueuedChunks)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+    m_receiver->setOverflowPolicy(DeliveryFiFo::OverflowPolicy::DISCARD_NEWEST);
+    const auto l_capacity = static_cast<uint32_t>(m_receiver->getDeliveryFiFoCapacity());
+
+    for (uint32_t i = 0u; i < l_capacity + 3u; ++i)
+    {
+        auto l_delivery = m_sender->reserveChunk(sizeof(uint32_t));
+        l_delivery->m_info.m_payloadSize = sizeof(uint32_t);
+        l_delivery->m_info.m_externalSequenceNumber_bl = true;
+        l_delivery->m_info.m_sequenceNumber = i;
+        m_sender->deliverChunk(l_delivery);
+    }
+
+    EXPECT_THAT(m_receiver->getDropCount(), Eq(3u));
+
+    // the queued chunks are untouched, the surplus ones were discarded
+    for (uint32_t i = 0u; i < l_capacity; ++i)
+    {
+        const iox::mepoo::ChunkHeader* l_chunkHeader;
+        ASSERT_THAT(m_receiver->getChunk(l_chunkHeader), Eq(true));
+        EXPECT_THAT(l_chunkHeader->m_info.m_sequenceNumber, Eq(i));
+        EXPECT_THAT(m_receiver->releaseChunk(l_chunkHeader), Eq(true));
+    }
+    EXPECT_THAT(m_receiver->newData(), Eq(false));
+}
+
+TEST_F(ReceiverPort_test, overflowPolicyBlockWithTimeoutWaitsBeforeDiscarding)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+    constexpr uint32_t TimeoutMs{20u};
+    m_receiver->setOverflowPolicy(DeliveryFiFo::OverflowPolicy::BLOCK_WITH_TIMEOUT, TimeoutMs);
+    const auto l_capacity = static_cast<uint32_t>(m_receiver->getDeliveryFiFoCapacity());
+
+    for (uint32_t i = 0u; i < l_capacity; ++i)
+    {
+        auto l_delivery = m_sender->reserveChunk(sizeof(uint32_t));
+        l_delivery->m_info.m_payloadSize = sizeof(uint32_t);
+        m_sender->deliverChunk(l_delivery);
+    }
+    EXPECT_THAT(m_receiver->getDropCount(), Eq(0u));
+
+    // nobody pops, so the push waits for the timeout and then discards
+    auto l_delivery = m_sender->reserveChunk(sizeof(uint32_t));
+    l_delivery->m_info.m_payloadSize = sizeof(uint32_t);
+    const auto l_entry = std::chrono::steady_clock::now();
+    m_sender->deliverChunk(l_delivery);
+    const auto l_elapsed =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - l_entry);
+
+    EXPECT_THAT(l_elapsed.count(), Ge(TimeoutMs));
+    EXPECT_THAT(m_receiver->getDropCount(), Eq(1u));
+}
+
+TEST_F(ReceiverPort_test, coalescedNotificationPostsOncePerBurst)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+
+    auto l_semaphore = m_receiver->GetShmSemaphore();
+    ASSERT_THAT(l_semaphore, Ne(nullptr));
+    m_receiver->SetCallbackReferences(l_semaphore);
+
+    for (uint32_t i = 0u; i < 3u; ++i)
+    {
+        auto l_delivery = m_sender->reserveChunk(sizeof(uint32_t));
+        l_delivery->m_info.m_payloadSize = sizeof(uint32_t);
+        m_sender->deliverChunk(l_delivery);
+    }
+
+    // the whole burst is covered by a single post
+    int l_semaphoreValue{0};
+    ASSERT_THAT(l_semaphore->getValue(l_semaphoreValue), Eq(true));
+    EXPECT_THAT(l_semaphoreValue, Eq(1));
+
+    // consuming the post and clearing the flag re-arms the notification
+    EXPECT_THAT(l_semaphore->tryWait(), Eq(true));
+    m_receiver->clearPendingNotification();
+
+    auto l_delivery = m_sender->reserveChunk(sizeof(uint32_t));
+    l_delivery->m_info.m_payloadSize = sizeof(uint32_t);
+    m_sender->deliverChunk(l_delivery);
+    ASSERT_THAT(l_semaphore->getValue(l_semaphoreValue), Eq(true));
+    EXPECT_THAT(l_semaphoreValue, Eq(1));
+
+    m_receiver->UnsetCallbackReferences();
+}
+
+TEST_F(ReceiverPort_test, releaseChunkViaSlotHandle)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+
+    // several chunks in flight, released out of order via their slot handles
+    constexpr uint32_t ChunksInFlight{5u};
+    const iox::mepoo::ChunkHeader* l_chunkHeaders[ChunksInFlight];
+    iox::ReceiverPortType::ChunkSlotHandle l_slotHandles[ChunksInFlight];
+
+    for (uint32_t i = 0u; i < ChunksInFlight; ++i)
+    {
+        auto l_delivery = m_sender->reserveChunk(sizeof(uint32_t));
+        l_delivery->m_info.m_payloadSize = sizeof(uint32_t);
+        m_sender->deliverChunk(l_delivery);
+        ASSERT_THAT(m_receiver->getChunk(l_chunkHeaders[i], l_slotHandles[i]), Eq(true));
+    }
+
+    for (int32_t i = ChunksInFlight - 1; i >= 0; --i)
+    {
+        EXPECT_THAT(m_receiver->releaseChunk(l_chunkHeaders[i], l_slotHandles[i]), Eq(true));
+    }
+    EXPECT_THAT(m_receiver->newData(), Eq(false));
+
+    // a stale handle falls back to the linear search and still releases the chunk
+    auto l_delivery = m_sender->reserveChunk(sizeof(uint32_t));
+    l_delivery->m_info.m_payloadSize = sizeof(uint32_t);
+    m_sender->deliverChunk(l_delivery);
+    const iox::mepoo::ChunkHeader* l_chunkHeader;
+    iox::ReceiverPortType::ChunkSlotHandle l_slotHandle;
+    ASSERT_THAT(m_receiver->getChunk(l_chunkHeader, l_slotHandle), Eq(true));
+    EXPECT_THAT(m_receiver->releaseChunk(l_chunkHeader, l_slotHandle + 1u), Eq(true));
+}
+
+TEST_F(ReceiverPort_test, latestValueDeliveryKeepsOnlyTheNewestChunk)
+{
+    // a delivery size of 1 activates the single slot latest value mode
+    m_receiver->subscribe(true, 1);
+    auto returnedCaproMessage = m_receiver->getCaProMessage();
+    ASSERT_THAT(returnedCaproMessage.has_value(), Eq(true));
+    m_sender->dispatchCaProMessage(returnedCaproMessage.value());
+    ASSERT_THAT(m_receiver->isSubscribed(), Eq(true));
+
+    for (uint32_t i = 0u; i < 3u; ++i)
+    {
+        auto l_sample = m_sender->reserveChunk(sizeof(uint32_t));
+        *static_cast<uint32_t*>(l_sample->payload()) = i;
+        l_sample->m_info.m_payloadSize = sizeof(uint32_t);
+        m_sender->deliverChunk(l_sample);
+    }
+
+    // only the newest sample is retained, the overwritten ones were released
+    const iox::mepoo::ChunkHeader* l_chunkHeader;
+    ASSERT_THAT(m_receiver->getChunk(l_chunkHeader), Eq(true));
+    EXPECT_THAT(*static_cast<const uint32_t*>(l_chunkHeader->payload()), Eq(2u));
+    EXPECT_THAT(m_receiver->releaseChunk(l_chunkHeader), Eq(true));
+    EXPECT_THAT(m_receiver->newData(), Eq(false));
+}
+
+TEST_F(ReceiverPort_test, getChunksDrainsBacklogInOnePass)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+
+    constexpr uint32_t BacklogSize{8u};
+    for (uint32_t i = 0u; i < BacklogSize; ++i)
+    {
+        auto l_delivery = m_sender->reserveChunk(sizeof(uint32_t));
+        new (l_delivery->payload()) uint32_t(i);
+        l_delivery->m_info.m_payloadSize = sizeof(uint32_t);
+        m_sender->deliverChunk(l_delivery);
+    }
+    EXPECT_THAT(m_receiver->newData(), Eq(true));
+
+    const iox::mepoo::ChunkHeader* chunkHeaders[BacklogSize + 2u];
+    EXPECT_THAT(m_receiver->getChunks(chunkHeaders, BacklogSize + 2u), Eq(BacklogSize));
+    EXPECT_THAT(m_receiver->newData(), Eq(false));
+
+    for (uint32_t i = 0u; i < BacklogSize; ++i)
+    {
+        EXPECT_THAT(*static_cast<const uint32_t*>(chunkHeaders[i]->payload()), Eq(i));
+        EXPECT_THAT(m_receiver->releaseChunk(chunkHeaders[i]), Eq(true));
+    }
+}
+
+TEST_F(ReceiverPort_test, getChunksOnEmptyFiFo)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+
+    const iox::mepoo::ChunkHeader* chunkHeaders[4u];
+    EXPECT_THAT(m_receiver->getChunks(chunkHeaders, 4u), Eq(0u));
+}
+
 // test the state machine logic (unit test does not account for concurrency)
 // here the common use cases are tested
 ///@todo: do we cover all relevant cases?
@@ -349,3 +732,36 @@ TEST_F(ReceiverPort_test, stopOffer)
     EXPECT_TRUE(m_receiver->isSubscribed());
     EXPECT_FALSE(response.has_value());
 }
+
+TEST_F(ReceiverPort_test, subscriberOnPreAcquiredReceiverPortData)
+{
+    // a Subscriber built on an already acquired receiver port (the batch
+    // acquisition path of PoshRuntime::getMiddlewareReceiverBatch) has to
+    // behave like one created via the runtime
+    auto* l_portData = new iox::ReceiverPortType::MemberType_t(m_service, "", iox::Interfaces::INTERNAL, nullptr);
+    m_portData.emplace_back(l_portData);
+    iox::ReceiverPortType l_roudiSide(l_portData);
+
+    iox::popo::Subscriber l_subscriber(l_portData);
+    EXPECT_THAT(l_subscriber.getSubscriptionState(), Eq(iox::popo::SubscriptionState::NOT_SUBSCRIBED));
+
+    l_subscriber.subscribe(10);
+    EXPECT_THAT(l_subscriber.getSubscriptionState(), Eq(iox::popo::SubscriptionState::SUBSCRIPTION_PENDING));
+
+    // the discovery loop picks up the request via the RouDi side view of the same port
+    auto l_caproMessage = l_roudiSide.getCaProMessage();
+    ASSERT_THAT(l_caproMessage.has_value(), Eq(true));
+    auto l_senderResponse = m_sender->dispatchCaProMessage(l_caproMessage.value());
+    ASSERT_THAT(l_senderResponse.has_value(), Eq(true));
+    EXPECT_THAT(l_subscriber.getSubscriptionState(), Eq(iox::popo::SubscriptionState::SUBSCRIBED));
+
+    int l_data = 37;
+    auto l_delivery = m_sender->reserveChunk(sizeof(l_data));
+    l_delivery->m_info.m_payloadSize = sizeof(l_data);
+    m_sender->deliverChunk(l_delivery);
+
+    const iox::mepoo::ChunkHeader* l_chunkHeader{nullptr};
+    ASSERT_THAT(l_subscriber.getChunk(&l_chunkHeader), Eq(true));
+    EXPECT_THAT(l_chunkHeader->m_info.m_payloadSize, Eq(sizeof(l_data)));
+    EXPECT_THAT(l_subscriber.releaseChunk(l_chunkHeader), Eq(true));
+}
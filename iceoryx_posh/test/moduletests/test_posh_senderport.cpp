@@ -17,9 +17,14 @@
 #include "iceoryx_posh/internal/popo/receiver_port.hpp"
 #include "iceoryx_posh/internal/popo/sender_port.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/popo/gateway_generic.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "test.hpp"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 using namespace ::testing;
 using namespace iox::popo;
 using namespace iox::capro;
@@ -179,6 +184,163 @@ TEST_F(SenderPort_test, reserveSample_MultipleSamples)
     EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0).m_usedChunks, Eq(2u));
 }
 
+TEST_F(SenderPort_test, allocatedChunkContainerHonorsTheConfiguredWindow)
+{
+    iox::popo::ConcurrentUsedChunkList<8> l_list;
+    l_list.setCapacity(2u);
+    EXPECT_THAT(l_list.capacity(), Eq(2u));
+
+    EXPECT_TRUE(l_list.insert(m_memPoolHandler.getChunk(50u)));
+    EXPECT_TRUE(l_list.insert(m_memPoolHandler.getChunk(50u)));
+    // the third chunk exceeds the configured window even though the container
+    // itself still has free slots
+    EXPECT_FALSE(l_list.insert(m_memPoolHandler.getChunk(50u)));
+
+    // a window beyond the compiled in capacity is clamped
+    l_list.setCapacity(100u);
+    EXPECT_THAT(l_list.capacity(), Eq(8u));
+    EXPECT_TRUE(l_list.insert(m_memPoolHandler.getChunk(50u)));
+
+    l_list.cleanup();
+}
+
+TEST_F(SenderPort_test, declaredSingleWriterStillReservesAndFreesChunks)
+{
+    m_sender->declareSingleWriter();
+
+    auto sample1 = m_sender->reserveChunk(sizeof(DummySample));
+    auto sample2 = m_sender->reserveChunk(sizeof(DummySample));
+    ASSERT_THAT(sample1, Ne(nullptr));
+    ASSERT_THAT(sample2, Ne(nullptr));
+    EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0).m_usedChunks, Eq(2u));
+
+    m_sender->freeChunk(sample1);
+    m_sender->freeChunk(sample2);
+    EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(SenderPort_test, monitoringBlockLivesOnItsOwnCacheLines)
+{
+    // the introspection reader must never pull cache lines of the publish
+    // working set, so the monitoring block is cache line aligned
+    EXPECT_THAT(alignof(iox::popo::SenderPortData::MonitoringData), Eq(64u));
+    EXPECT_THAT(sizeof(iox::popo::SenderPortData::MonitoringData) % 64u, Eq(0u));
+
+    iox::popo::SenderPortData l_portData;
+    const auto l_offset =
+        reinterpret_cast<uintptr_t>(&l_portData.m_monitoring) - reinterpret_cast<uintptr_t>(&l_portData);
+    EXPECT_THAT(l_offset % 64u, Eq(0u));
+}
+
+TEST_F(SenderPort_test, warmupHandsAllChunksBackToThePool)
+{
+    m_sender->warmup(sizeof(DummySample));
+
+    // the full allocation window was drawn and freed again, nothing leaks
+    EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+
+    auto sample = m_sender->reserveChunk(sizeof(DummySample));
+    EXPECT_THAT(sample, Ne(nullptr));
+    EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0).m_usedChunks, Eq(1u));
+}
+
+TEST_F(SenderPort_test, warmupLeavesAlreadyReservedChunksUntouched)
+{
+    auto sample1 = m_sender->reserveChunk(sizeof(DummySample));
+    auto sample2 = m_sender->reserveChunk(sizeof(DummySample));
+    ASSERT_THAT(sample1, Ne(nullptr));
+    ASSERT_THAT(sample2, Ne(nullptr));
+
+    m_sender->warmup(sizeof(DummySample));
+
+    // only the warmup chunks were freed, the application still owns its samples
+    EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0).m_usedChunks, Eq(2u));
+    m_sender->freeChunk(sample1);
+    m_sender->freeChunk(sample2);
+    EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(SenderPort_test, receiverWarmupDoesNotDisturbDelivery)
+{
+    m_receiver->warmup();
+
+    auto sample = m_sender->reserveChunk(sizeof(DummySample));
+    m_sender->deliverChunk(sample);
+    EXPECT_THAT(m_receiver->newData(), Eq(true));
+    ReceiveDummyData();
+}
+
+TEST_F(SenderPort_test, realTimePublishModeDeliversToThePinnedSnapshot)
+{
+    m_sender->setRealTimePublishModeEnabled(true); // pins the fixture receiver
+
+    auto sample = m_sender->reserveChunk(sizeof(DummySample));
+    m_sender->deliverChunk(sample);
+    EXPECT_THAT(m_receiver->newData(), Eq(true));
+    ReceiveDummyData();
+
+    // a receiver subscribed after the last sync point is not part of the
+    // pinned snapshot ...
+    auto lateReceiver = CreateReceiver(m_service);
+    SubscribeReceiverToSender(lateReceiver, m_sender);
+
+    sample = m_sender->reserveChunk(sizeof(DummySample));
+    m_sender->deliverChunk(sample);
+    EXPECT_THAT(lateReceiver->newData(), Eq(false));
+    EXPECT_THAT(m_receiver->newData(), Eq(true));
+    ReceiveDummyData();
+
+    // ... and gets delivered to after the explicit sync
+    m_sender->syncReceiverSnapshot();
+    sample = m_sender->reserveChunk(sizeof(DummySample));
+    m_sender->deliverChunk(sample);
+    EXPECT_THAT(lateReceiver->newData(), Eq(true));
+}
+
+TEST_F(SenderPort_test, chunkSizeStatisticsRecordRequestedAndGrantedSizes)
+{
+    auto sample1 = m_sender->reserveChunk(50u, m_useDynamicPayloadSizes);
+    auto sample2 = m_sender->reserveChunk(50u, m_useDynamicPayloadSizes);
+    auto sample3 = m_sender->reserveChunk(150u, m_useDynamicPayloadSizes);
+    EXPECT_THAT(sample1, Ne(nullptr));
+    EXPECT_THAT(sample2, Ne(nullptr));
+    EXPECT_THAT(sample3, Ne(nullptr));
+
+    auto statistics = m_sender->getChunkSizeStatistics();
+    // 50 byte payloads fall into the 64 byte bucket, 150 bytes into the 256 byte bucket
+    EXPECT_THAT(statistics.m_requestedPayloadHistogram[6], Eq(2u));
+    EXPECT_THAT(statistics.m_requestedPayloadHistogram[8], Eq(1u));
+    EXPECT_THAT(statistics.m_requestedPayloadBytes, Eq(250u));
+    // the granted bytes are the chunk sizes of the pools which served the requests
+    const uint64_t expectedGrantedBytes = 2u * m_memPoolHandler.getMempoolChunkSizeForPayloadSize(50u)
+                                          + m_memPoolHandler.getMempoolChunkSizeForPayloadSize(150u);
+    EXPECT_THAT(statistics.m_grantedChunkBytes, Eq(expectedGrantedBytes));
+}
+
+TEST_F(SenderPort_test, reserveSample_FixedSizePathServesFromTheFittingPool)
+{
+    auto sample1 = m_sender->reserveChunk<sizeof(DummySample)>();
+    ASSERT_THAT(sample1, Ne(nullptr));
+    EXPECT_THAT(sample1->m_info.m_payloadSize, Eq(static_cast<uint32_t>(sizeof(DummySample))));
+    EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0).m_usedChunks, Eq(1u));
+
+    // the serving pool is cached after the first reservation, further samples
+    // still come from the fitting pool
+    auto sample2 = m_sender->reserveChunk<sizeof(DummySample)>();
+    EXPECT_THAT(sample2, Ne(nullptr));
+    EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0).m_usedChunks, Eq(2u));
+}
+
+TEST_F(SenderPort_test, reserveSample_FixedSizePathDeliversLikeTheRuntimePath)
+{
+    auto sample = m_sender->reserveChunk<sizeof(DummySample)>();
+    ASSERT_THAT(sample, Ne(nullptr));
+    new (sample->payload()) DummySample();
+    m_sender->deliverChunk(sample);
+
+    ReceiveDummyData();
+}
+
 TEST_F(SenderPort_test, reserveSample_DynamicSamplesSameSizeReturningValidLastChunk)
 {
     auto sentSample1 = m_sender->reserveChunk(sizeof(DummySample), m_useDynamicPayloadSizes);
@@ -221,6 +383,198 @@ TEST_F(SenderPort_test, reserveSample_DynamicSamplesLargerSizeReturningNotLastCh
     EXPECT_THAT(sentSample2->payload(), Ne(sentSample1->payload()));
 }
 
+TEST_F(SenderPort_test, reserveSample_RecycleStashReturnsPreviouslySentChunk)
+{
+    auto sentSample1 = m_sender->reserveChunk(sizeof(DummySample), m_useDynamicPayloadSizes);
+    m_sender->deliverChunk(sentSample1);
+
+    ReceiveDummyData();
+
+    // a larger sample moves the first chunk from the last chunk slot into the recycle stash
+    auto sentSample2 = m_sender->reserveChunk(sizeof(DummySample) + 200, m_useDynamicPayloadSizes);
+    m_sender->deliverChunk(sentSample2);
+
+    // the last chunk is still held by the receiver, so the next small sample must be
+    // served from the recycle stash with the cache-hot first chunk
+    auto sentSample3 = m_sender->reserveChunk(sizeof(DummySample), m_useDynamicPayloadSizes);
+    EXPECT_THAT(sentSample3->m_info.m_payloadSize, Eq(sizeof(DummySample)));
+    EXPECT_THAT(sentSample3->payload(), Eq(sentSample1->payload()));
+}
+
+#ifndef IOX_COMPACT_CHUNK_HEADER
+TEST_F(SenderPort_test, chainChunks_ReceiverFollowsTheChain)
+{
+    auto headSample = m_sender->reserveChunk(sizeof(DummySample));
+    auto imageSample = m_sender->reserveChunk(sizeof(DummySample));
+    static_cast<DummySample*>(headSample->payload())->dummy = 1u;
+    static_cast<DummySample*>(imageSample->payload())->dummy = 2u;
+
+    ASSERT_THAT(m_sender->chainChunks(headSample, imageSample), Eq(true));
+    // a chunk can only have one successor
+    EXPECT_THAT(m_sender->chainChunks(headSample, imageSample), Eq(false));
+
+    // only the head is delivered, the chain travels with it
+    m_sender->deliverChunk(headSample);
+
+    const ChunkHeader* receivedSample;
+    ASSERT_THAT(m_receiver->getChunk(receivedSample), Eq(true));
+    ASSERT_THAT(receivedSample->hasNextChunk(), Eq(true));
+    auto receivedNext = receivedSample->nextChunk();
+    ASSERT_THAT(receivedNext, Eq(imageSample));
+    EXPECT_THAT(static_cast<DummySample*>(receivedNext->payload())->dummy, Eq(2u));
+    EXPECT_THAT(receivedNext->hasNextChunk(), Eq(false));
+
+    m_receiver->releaseChunk(receivedSample);
+}
+
+TEST_F(SenderPort_test, chainChunks_ChainedChunkIsFreedWithTheHead)
+{
+    auto headSample = m_sender->reserveChunk(sizeof(DummySample));
+    auto imageSample = m_sender->reserveChunk(sizeof(DummySample));
+    ASSERT_THAT(m_sender->chainChunks(headSample, imageSample), Eq(true));
+    EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0).m_usedChunks, Eq(2u));
+
+    // freeing the head releases the chained chunk as well
+    m_sender->freeChunk(headSample);
+    EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(SenderPort_test, integrityMode_ValidChunkPassesVerification)
+{
+    m_sender->setIntegrityModeEnabled(true);
+    m_receiver->setIntegrityCheckEnabled(true);
+
+    auto sentSample = m_sender->reserveChunk(sizeof(DummySample));
+    static_cast<DummySample*>(sentSample->payload())->dummy = 73u;
+    m_sender->deliverChunk(sentSample);
+
+    const ChunkHeader* receivedSample;
+    ASSERT_THAT(m_receiver->getChunk(receivedSample), Eq(true));
+    EXPECT_THAT(receivedSample->m_integrityFlags & ChunkHeader::INTEGRITY_CRC_PRESENT, Ne(0u));
+    EXPECT_THAT(static_cast<const DummySample*>(receivedSample->payload())->dummy, Eq(73u));
+
+    m_receiver->releaseChunk(receivedSample);
+}
+
+TEST_F(SenderPort_test, integrityMode_CorruptedChunkIsDropped)
+{
+    m_sender->setIntegrityModeEnabled(true);
+    m_receiver->setIntegrityCheckEnabled(true);
+
+    auto sentSample = m_sender->reserveChunk(sizeof(DummySample));
+    static_cast<DummySample*>(sentSample->payload())->dummy = 73u;
+    m_sender->deliverChunk(sentSample);
+
+    // flip payload bits behind the back of the sender, like a memory corruption
+    // between send and fetch would
+    static_cast<DummySample*>(sentSample->payload())->dummy = 74u;
+
+    const ChunkHeader* receivedSample;
+    EXPECT_THAT(m_receiver->getChunk(receivedSample), Eq(false));
+}
+
+TEST_F(SenderPort_test, integrityMode_UnstampedChunkPassesTheCheck)
+{
+    // receiver side check enabled but the sender does not stamp checksums
+    m_receiver->setIntegrityCheckEnabled(true);
+
+    auto sentSample = m_sender->reserveChunk(sizeof(DummySample));
+    m_sender->deliverChunk(sentSample);
+
+    const ChunkHeader* receivedSample;
+    ASSERT_THAT(m_receiver->getChunk(receivedSample), Eq(true));
+    EXPECT_THAT(receivedSample->m_integrityFlags & ChunkHeader::INTEGRITY_CRC_PRESENT, Eq(0u));
+    m_receiver->releaseChunk(receivedSample);
+}
+#endif // IOX_COMPACT_CHUNK_HEADER
+
+TEST_F(SenderPort_test, wideFanOut_EveryReceiverGetsTheChunk)
+{
+    // crossing the threshold splits the fan-out across the worker pool of the
+    // process; every receiver still has to get exactly one reference
+    std::vector<iox::ReceiverPortType*> l_receivers;
+    for (uint32_t i = 0u; i < FanOutPool::PARALLEL_FANOUT_THRESHOLD; ++i)
+    {
+        auto l_receiver = CreateReceiver(m_service);
+        SubscribeReceiverToSender(l_receiver, m_sender);
+        l_receivers.push_back(l_receiver);
+    }
+
+    auto sentSample = m_sender->reserveChunk(sizeof(DummySample));
+    static_cast<DummySample*>(sentSample->payload())->dummy = 37u;
+    m_sender->deliverChunk(sentSample);
+
+    const ChunkHeader* receivedSample;
+    ASSERT_THAT(m_receiver->getChunk(receivedSample), Eq(true));
+    m_receiver->releaseChunk(receivedSample);
+    for (auto receiver : l_receivers)
+    {
+        ASSERT_THAT(receiver->getChunk(receivedSample), Eq(true));
+        EXPECT_THAT(static_cast<const DummySample*>(receivedSample->payload())->dummy, Eq(37u));
+        receiver->releaseChunk(receivedSample);
+    }
+
+    // all claimed references are released again, only the recycling reference of
+    // the sender is left
+    EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0).m_usedChunks, Eq(1u));
+}
+
+TEST_F(SenderPort_test, disabledThroughputTrackingSkipsDeliveryTimestamping)
+{
+    m_sender->setThroughputTrackingEnabled(false);
+
+    auto sentSample = m_sender->reserveChunk(sizeof(DummySample));
+    m_sender->deliverChunk(sentSample);
+
+    // neither the chunk nor the throughput exchange got a timestamp
+    EXPECT_THAT(sentSample->m_info.m_txTimestamp.time_since_epoch().count(), Eq(0));
+    auto throughput = m_sender->getThroughput();
+    EXPECT_THAT(throughput.currentDeliveryTimestamp.time_since_epoch().count(), Eq(0));
+    EXPECT_THAT(throughput.sequenceNumber, Eq(0u));
+
+    ReceiveDummyData();
+    m_sender->setThroughputTrackingEnabled(true);
+
+    auto sentSample2 = m_sender->reserveChunk(sizeof(DummySample));
+    m_sender->deliverChunk(sentSample2);
+
+    EXPECT_THAT(sentSample2->m_info.m_txTimestamp.time_since_epoch().count(), Gt(0));
+    throughput = m_sender->getThroughput();
+    EXPECT_THAT(throughput.currentDeliveryTimestamp.time_since_epoch().count(), Gt(0));
+}
+
+TEST_F(SenderPort_test, loanPreviousChunk_ReturnsLastChunkWithContentPreserved)
+{
+    auto sentSample = m_sender->reserveChunk(sizeof(DummySample));
+    auto dummySample = new (sentSample->payload()) DummySample();
+    dummySample->dummy = 4711u;
+    m_sender->deliverChunk(sentSample);
+
+    ReceiveDummyData();
+
+    auto loanedSample = m_sender->loanPreviousChunk();
+    ASSERT_THAT(loanedSample, Ne(nullptr));
+    EXPECT_THAT(loanedSample, Eq(sentSample));
+    EXPECT_THAT(static_cast<DummySample*>(loanedSample->payload())->dummy, Eq(4711u));
+
+    // the loaned chunk can be updated in place and sent again
+    static_cast<DummySample*>(loanedSample->payload())->dummy = 4712u;
+    m_sender->deliverChunk(loanedSample);
+}
+
+TEST_F(SenderPort_test, loanPreviousChunk_FailsWhileReceiverHoldsTheChunk)
+{
+    auto sentSample = m_sender->reserveChunk(sizeof(DummySample));
+    m_sender->deliverChunk(sentSample);
+
+    // the chunk is still referenced by the receiver queue
+    EXPECT_THAT(m_sender->loanPreviousChunk(), Eq(nullptr));
+
+    ReceiveDummyData();
+
+    EXPECT_THAT(m_sender->loanPreviousChunk(), Ne(nullptr));
+}
+
 TEST_F(SenderPort_test, reserveSample_Overflow)
 {
     std::vector<ChunkHeader*> samples;
@@ -264,6 +618,31 @@ TEST_F(SenderPort_test, doNotDeliverDataOnSubscription)
     EXPECT_THAT(m_receiver->newData(), Eq(false));
 }
 
+TEST_F(SenderPort_test, bridgeChunks_ForwardsWithoutCopy)
+{
+    // second domain with its own sender and receiver, bridged by the gateway
+    ServiceDescription bridgedService{2, 2, 2};
+    auto bridgeSender = CreateSender(bridgedService);
+    ActivateSender(bridgeSender);
+    auto bridgeReceiver = CreateReceiver(bridgedService);
+    SubscribeReceiverToSender(bridgeReceiver, bridgeSender);
+
+    auto sample = m_sender->reserveChunk(sizeof(DummySample));
+    new (sample) DummySample();
+    sample->m_info.m_payloadSize = sizeof(DummySample);
+    m_sender->deliverChunk(sample);
+
+    EXPECT_THAT(GatewayGeneric::bridgeChunks(*m_receiver, *bridgeSender, 10), Eq(1u));
+    // the source receiver queue is drained, a second pass bridges nothing
+    EXPECT_THAT(GatewayGeneric::bridgeChunks(*m_receiver, *bridgeSender, 10), Eq(0u));
+
+    const iox::mepoo::ChunkHeader* receivedSample;
+    ASSERT_THAT(bridgeReceiver->getChunk(receivedSample), Eq(true));
+    // zero-copy, the bridged receiver sees the very same chunk
+    EXPECT_THAT(receivedSample, Eq(sample));
+    EXPECT_THAT(bridgeReceiver->releaseChunk(receivedSample), Eq(true));
+}
+
 TEST_F(SenderPort_test, deliverSample_OneSample)
 {
     auto sample = m_sender->reserveChunk(sizeof(DummySample));
@@ -309,6 +688,153 @@ TEST_F(SenderPort_test, deliverSample_MultipleSample)
     ASSERT_THAT(receivedSample->m_info.m_sequenceNumber, Eq(42u));
 }
 
+TEST_F(SenderPort_test, deliverSample_BatchKeepsOrder)
+{
+    constexpr uint32_t BatchSize{5u};
+    iox::mepoo::ChunkHeader* samples[BatchSize];
+    for (uint32_t i = 0u; i < BatchSize; ++i)
+    {
+        samples[i] = m_sender->reserveChunk(sizeof(DummySample));
+        new (samples[i]->payload()) DummySample();
+        samples[i]->m_info.m_payloadSize = sizeof(DummySample);
+        samples[i]->m_info.m_externalSequenceNumber_bl = true;
+        samples[i]->m_info.m_sequenceNumber = 1000u + i;
+    }
+
+    m_sender->deliverChunks(samples, BatchSize);
+
+    ASSERT_THAT(m_receiver->newData(), Eq(true));
+    for (uint32_t i = 0u; i < BatchSize; ++i)
+    {
+        const iox::mepoo::ChunkHeader* receivedSample;
+        ASSERT_THAT(m_receiver->getChunk(receivedSample), Eq(true));
+        ASSERT_THAT(m_receiver->releaseChunk(receivedSample), Eq(true));
+        ASSERT_THAT(receivedSample->m_info.m_sequenceNumber, Eq(1000u + i));
+    }
+}
+
+TEST_F(SenderPort_test, concurrentDelivery_WorkerPoolPublishesWithoutExternalLocking)
+{
+    m_sender->setConcurrentDeliveryEnabled(true);
+
+    constexpr uint32_t NumThreads{4u};
+    constexpr uint32_t IterationsPerThread{200u};
+    std::atomic<uint32_t> l_failedReserves{0u};
+
+    // a consumer drains the receiver concurrently, releasing the chunks
+    std::atomic<bool> l_producersDone{false};
+    std::thread l_consumer([&] {
+        const iox::mepoo::ChunkHeader* l_chunkHeader;
+        while (!l_producersDone.load() || m_receiver->newData())
+        {
+            if (m_receiver->getChunk(l_chunkHeader))
+            {
+                m_receiver->releaseChunk(l_chunkHeader);
+            }
+        }
+    });
+
+    std::vector<std::thread> l_workers;
+    for (uint32_t t = 0u; t < NumThreads; ++t)
+    {
+        l_workers.emplace_back([&] {
+            for (uint32_t i = 0u; i < IterationsPerThread; ++i)
+            {
+                auto l_sample = m_sender->reserveChunk(sizeof(DummySample));
+                if (l_sample == nullptr)
+                {
+                    ++l_failedReserves;
+                    continue;
+                }
+                new (l_sample->payload()) DummySample();
+                l_sample->m_info.m_payloadSize = sizeof(DummySample);
+                m_sender->deliverChunk(l_sample);
+            }
+        });
+    }
+    for (auto& l_worker : l_workers)
+    {
+        l_worker.join();
+    }
+    l_producersDone.store(true);
+    l_consumer.join();
+
+    EXPECT_THAT(l_failedReserves.load(), Eq(0u));
+    // every chunk found its way back to the mempool, none was lost or leaked
+    EXPECT_THAT(m_memPoolHandler.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(SenderPort_test, chunkFilter_SkipsNonMatchingReceiver)
+{
+    auto filteredReceiver = CreateReceiver(m_service);
+    SubscribeReceiverToSender(filteredReceiver, m_sender);
+    // deliver only chunks whose lower tag byte equals 0x42
+    filteredReceiver->setChunkFilter(0x00FFu, 0x0042u);
+
+    auto sample1 = m_sender->reserveChunk(sizeof(DummySample));
+    new (sample1->payload()) DummySample();
+    sample1->m_info.m_payloadSize = sizeof(DummySample);
+    sample1->m_info.m_filterTag = 0x1142u;
+    m_sender->deliverChunk(sample1);
+
+    auto sample2 = m_sender->reserveChunk(sizeof(DummySample));
+    new (sample2->payload()) DummySample();
+    sample2->m_info.m_payloadSize = sizeof(DummySample);
+    sample2->m_info.m_filterTag = 0x0007u;
+    m_sender->deliverChunk(sample2);
+
+    // the filtered receiver only gets the matching chunk
+    const iox::mepoo::ChunkHeader* receivedSample;
+    ASSERT_THAT(filteredReceiver->getChunk(receivedSample), Eq(true));
+    EXPECT_THAT(receivedSample->m_info.m_filterTag, Eq(0x1142u));
+    ASSERT_THAT(filteredReceiver->releaseChunk(receivedSample), Eq(true));
+    EXPECT_THAT(filteredReceiver->newData(), Eq(false));
+
+    // the unfiltered receiver gets both
+    ASSERT_THAT(m_receiver->getChunk(receivedSample), Eq(true));
+    ASSERT_THAT(m_receiver->releaseChunk(receivedSample), Eq(true));
+    ASSERT_THAT(m_receiver->getChunk(receivedSample), Eq(true));
+    ASSERT_THAT(m_receiver->releaseChunk(receivedSample), Eq(true));
+    EXPECT_THAT(m_receiver->newData(), Eq(false));
+}
+
+TEST_F(SenderPort_test, chunkFilter_AppliedPerChunkInBatchDelivery)
+{
+    m_receiver->setChunkFilter(0x000Fu, 0x0001u);
+
+    constexpr uint32_t BatchSize{4u};
+    iox::mepoo::ChunkHeader* samples[BatchSize];
+    for (uint32_t i = 0u; i < BatchSize; ++i)
+    {
+        samples[i] = m_sender->reserveChunk(sizeof(DummySample));
+        new (samples[i]->payload()) DummySample();
+        samples[i]->m_info.m_payloadSize = sizeof(DummySample);
+        // tags 0, 1, 2, 3; only tag 1 matches the filter
+        samples[i]->m_info.m_filterTag = static_cast<uint16_t>(i);
+        samples[i]->m_info.m_externalSequenceNumber_bl = true;
+        samples[i]->m_info.m_sequenceNumber = 2000u + i;
+    }
+
+    m_sender->deliverChunks(samples, BatchSize);
+
+    const iox::mepoo::ChunkHeader* receivedSample;
+    ASSERT_THAT(m_receiver->getChunk(receivedSample), Eq(true));
+    EXPECT_THAT(receivedSample->m_info.m_sequenceNumber, Eq(2001u));
+    ASSERT_THAT(m_receiver->releaseChunk(receivedSample), Eq(true));
+    EXPECT_THAT(m_receiver->newData(), Eq(false));
+
+    // after clearing the filter everything is delivered again
+    m_receiver->clearChunkFilter();
+    auto sample = m_sender->reserveChunk(sizeof(DummySample));
+    new (sample->payload()) DummySample();
+    sample->m_info.m_payloadSize = sizeof(DummySample);
+    sample->m_info.m_filterTag = 0x0002u;
+    m_sender->deliverChunk(sample);
+    EXPECT_THAT(m_receiver->newData(), Eq(true));
+    ASSERT_THAT(m_receiver->getChunk(receivedSample), Eq(true));
+    ASSERT_THAT(m_receiver->releaseChunk(receivedSample), Eq(true));
+}
+
 TEST_F(SenderPort_test, DISABLED_doDeliverOnSubscription_InitialValue)
 {
     ServiceDescription l_service2{2, 2, 2};
@@ -351,6 +877,35 @@ TEST_F(SenderPort_test, doDeliverOnSubscription_LatestValue)
     m_receiver2->releaseChunk(latestValue);
 }
 
+TEST_F(SenderPort_test, doDeliverOnSubscription_HistoryIsReplayedInSendOrder)
+{
+    constexpr uint32_t HistoryCapacity{4u};
+    m_sender->enableDoDeliverOnSubscription(HistoryCapacity);
+
+    // send more samples than the history holds, only the newest ones are replayed
+    constexpr uint32_t SampleCount{6u};
+    for (uint32_t i = 0u; i < SampleCount; ++i)
+    {
+        auto sample = m_sender->reserveChunk(sizeof(DummySample));
+        sample->m_info.m_externalSequenceNumber_bl = true;
+        sample->m_info.m_sequenceNumber = 100u + i;
+        m_sender->deliverChunk(sample);
+    }
+
+    auto m_receiver2 = CreateReceiver(m_service);
+    SubscribeReceiverToSender(m_receiver2, m_sender);
+
+    ASSERT_THAT(m_receiver2->newData(), Eq(true));
+    for (uint32_t i = 0u; i < HistoryCapacity; ++i)
+    {
+        const iox::mepoo::ChunkHeader* receivedSample;
+        ASSERT_THAT(m_receiver2->getChunk(receivedSample), Eq(true));
+        EXPECT_THAT(receivedSample->m_info.m_sequenceNumber, Eq(100u + SampleCount - HistoryCapacity + i));
+        m_receiver2->releaseChunk(receivedSample);
+    }
+    EXPECT_THAT(m_receiver2->newData(), Eq(false));
+}
+
 TEST_F(SenderPort_test, testCaPro)
 {
     m_sender->enableDoDeliverOnSubscription();
@@ -0,0 +1,186 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/recording/chunk_recorder.hpp"
+#include "iceoryx_posh/recording/chunk_replayer.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "mocks/chunk_mock.hpp"
+#include "test.hpp"
+
+#include <cstdio>
+
+using namespace ::testing;
+using namespace iox::recording;
+
+namespace
+{
+struct RecordTopic
+{
+    uint64_t m_value{0u};
+};
+} // namespace
+
+class ChunkRecorder_test : public Test
+{
+  public:
+    void SetUp()
+    {
+        // every test runs on a fresh file
+        std::remove(m_fileName.c_str());
+    }
+
+    void TearDown()
+    {
+        std::remove(m_fileName.c_str());
+    }
+
+    void recordTopic(ChunkRecorder& f_recorder, const uint64_t f_value, const uint32_t f_sequenceNumber)
+    {
+        ChunkMock<RecordTopic> chunk;
+        chunk.chunkHeader()->m_info.m_payloadSize = sizeof(RecordTopic);
+        chunk.chunkHeader()->m_info.m_sequenceNumber = f_sequenceNumber;
+        chunk.sample()->m_value = f_value;
+        EXPECT_TRUE(f_recorder.record(chunk.chunkHeader()));
+    }
+
+    std::string m_fileName{"/tmp/iox_chunk_recorder_test.rec"};
+};
+
+TEST_F(ChunkRecorder_test, RecordedChunksAreReplayedInOrder)
+{
+    {
+        ChunkRecorder recorder(m_fileName, 4096u);
+        ASSERT_TRUE(recorder.isInitialized());
+        for (uint64_t k = 0u; k < 3u; ++k)
+        {
+            recordTopic(recorder, 100u + k, static_cast<uint32_t>(k));
+        }
+        EXPECT_THAT(recorder.recordedChunks(), Eq(3u));
+        EXPECT_THAT(recorder.overwrittenChunks(), Eq(0u));
+    }
+
+    ChunkReplayer replayer(m_fileName);
+    ASSERT_TRUE(replayer.isInitialized());
+    EXPECT_THAT(replayer.numberOfChunks(), Eq(3u));
+
+    uint64_t expectedValue{100u};
+    auto visitedCount = replayer.forEachChunk([&](const ReplayedChunk& chunk) {
+        EXPECT_THAT(chunk.m_entry->m_payloadSize, Eq(static_cast<uint32_t>(sizeof(RecordTopic))));
+        EXPECT_THAT(reinterpret_cast<const RecordTopic*>(chunk.m_payload)->m_value, Eq(expectedValue));
+        ++expectedValue;
+    });
+    EXPECT_THAT(visitedCount, Eq(3u));
+}
+
+TEST_F(ChunkRecorder_test, FullRingOverwritesOldestEntries)
+{
+    constexpr uint64_t ENTRY_SIZE = sizeof(RecordEntryHeader) + sizeof(RecordTopic);
+    {
+        // room for two entries, the third one displaces the oldest
+        ChunkRecorder recorder(m_fileName, 2u * ENTRY_SIZE);
+        ASSERT_TRUE(recorder.isInitialized());
+        for (uint64_t k = 0u; k < 5u; ++k)
+        {
+            recordTopic(recorder, k, static_cast<uint32_t>(k));
+        }
+        EXPECT_THAT(recorder.recordedChunks(), Eq(5u));
+        EXPECT_THAT(recorder.overwrittenChunks(), Eq(3u));
+    }
+
+    ChunkReplayer replayer(m_fileName);
+    ASSERT_TRUE(replayer.isInitialized());
+    EXPECT_THAT(replayer.numberOfChunks(), Eq(2u));
+
+    // the most recent history survives
+    uint64_t expectedValue{3u};
+    replayer.forEachChunk([&](const ReplayedChunk& chunk) {
+        EXPECT_THAT(reinterpret_cast<const RecordTopic*>(chunk.m_payload)->m_value, Eq(expectedValue));
+        ++expectedValue;
+    });
+    EXPECT_THAT(expectedValue, Eq(5u));
+}
+
+TEST_F(ChunkRecorder_test, TooLargeChunkIsRejected)
+{
+    ChunkRecorder recorder(m_fileName, sizeof(RecordEntryHeader) + 1u);
+    ASSERT_TRUE(recorder.isInitialized());
+
+    ChunkMock<RecordTopic> chunk;
+    chunk.chunkHeader()->m_info.m_payloadSize = sizeof(RecordTopic);
+    EXPECT_FALSE(recorder.record(chunk.chunkHeader()));
+    EXPECT_THAT(recorder.recordedChunks(), Eq(0u));
+}
+
+TEST_F(ChunkRecorder_test, ReplayerRejectsForeignFiles)
+{
+    {
+        FILE* file = fopen(m_fileName.c_str(), "w");
+        ASSERT_THAT(file, Ne(nullptr));
+        fputs("this is no record file", file);
+        fclose(file);
+    }
+    ChunkReplayer replayer(m_fileName);
+    EXPECT_FALSE(replayer.isInitialized());
+    EXPECT_THAT(replayer.numberOfChunks(), Eq(0u));
+}
+
+TEST_F(ChunkRecorder_test, ReplayDeliversThroughSenderPort)
+{
+    {
+        ChunkRecorder recorder(m_fileName, 4096u);
+        ASSERT_TRUE(recorder.isInitialized());
+        recordTopic(recorder, 42u, 7u);
+        recordTopic(recorder, 43u, 8u);
+    }
+
+    // in process sender and receiver like in the sender port tests
+    char memory[1024 * 1024];
+    iox::posix::Allocator allocator(memory, sizeof(memory));
+    iox::mepoo::MemoryManager memoryManager;
+    iox::mepoo::MePooConfig mempoolconf;
+    mempoolconf.addMemPool({128, 20});
+    memoryManager.configureMemoryManager(mempoolconf, &allocator, &allocator);
+
+    iox::capro::ServiceDescription service{1, 1, 1};
+    iox::SenderPortType::MemberType_t senderData(service, &memoryManager, "", iox::Interfaces::INTERNAL, nullptr);
+    iox::SenderPortType sender(&senderData);
+    iox::ReceiverPortType::MemberType_t receiverData(service, "", iox::Interfaces::INTERNAL, nullptr);
+    iox::ReceiverPortType receiver(&receiverData);
+
+    sender.activate();
+    auto offerMessage = sender.getCaProMessage();
+    ASSERT_TRUE(offerMessage.has_value());
+    receiver.subscribe(true, 10u);
+    auto subMessage = receiver.getCaProMessage();
+    ASSERT_TRUE(subMessage.has_value());
+    sender.dispatchCaProMessage(subMessage.value());
+
+    ChunkReplayer replayer(m_fileName);
+    ASSERT_TRUE(replayer.isInitialized());
+    EXPECT_THAT(replayer.replay(sender, false), Eq(2u));
+
+    uint64_t expectedValue{42u};
+    const iox::mepoo::ChunkHeader* receivedChunk{nullptr};
+    while (receiver.getChunk(receivedChunk))
+    {
+        EXPECT_THAT(static_cast<const RecordTopic*>(receivedChunk->payload())->m_value, Eq(expectedValue));
+        ++expectedValue;
+        receiver.releaseChunk(receivedChunk);
+    }
+    EXPECT_THAT(expectedValue, Eq(44u));
+}
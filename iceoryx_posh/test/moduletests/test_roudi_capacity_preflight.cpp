@@ -0,0 +1,107 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/roudi/capacity_preflight.hpp"
+#include "test.hpp"
+
+using namespace ::testing;
+using namespace iox;
+using namespace iox::roudi;
+
+TEST(CapacityPreflight_test, worstCaseDemandCoversWindowLastChunkHistoryAndQueue)
+{
+    ExpectedTopicLoad load;
+    load.m_senderPorts = 3u;
+    load.m_receiverQueueDepth = 10u;
+    load.m_historyDepth = 2u;
+
+    EXPECT_THAT(worstCaseChunkDemand(load), Eq(3u * (MAX_SAMPLE_ALLOCATE_PER_SENDER + 1u + 2u + 10u)));
+}
+
+TEST(CapacityPreflight_test, sufficientCapacityPasses)
+{
+    mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({1024, 100});
+
+    CapacityPreflightConfig preflight;
+    preflight.m_mode = CapacityPreflightMode::REFUSE;
+    ExpectedTopicLoad load;
+    load.m_payloadSize = 128u;
+    load.m_senderPorts = 1u;
+    load.m_receiverQueueDepth = 8u;
+    preflight.m_expectedLoad.push_back(load);
+
+    EXPECT_TRUE(validateSegmentCapacity(mempoolConfig, "group", preflight));
+}
+
+TEST(CapacityPreflight_test, demandBeyondChunkCountFails)
+{
+    mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({1024, 10});
+
+    CapacityPreflightConfig preflight;
+    preflight.m_mode = CapacityPreflightMode::REFUSE;
+    ExpectedTopicLoad load;
+    load.m_payloadSize = 128u;
+    load.m_senderPorts = 4u;
+    preflight.m_expectedLoad.push_back(load);
+
+    EXPECT_FALSE(validateSegmentCapacity(mempoolConfig, "group", preflight));
+}
+
+TEST(CapacityPreflight_test, loadIsAccountedOnTheSmallestFittingPool)
+{
+    // the small pool cannot serve the payload once the chunk header is added,
+    // so the demand lands on the second pool and exceeds its capacity
+    mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({128, 1000});
+    mempoolConfig.addMemPool({1024, 10});
+
+    CapacityPreflightConfig preflight;
+    ExpectedTopicLoad load;
+    load.m_payloadSize = 128u - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader)) + 1u;
+    load.m_senderPorts = 1u;
+    preflight.m_expectedLoad.push_back(load);
+
+    EXPECT_FALSE(validateSegmentCapacity(mempoolConfig, "group", preflight));
+}
+
+TEST(CapacityPreflight_test, oversizedPayloadWithoutFittingPoolFails)
+{
+    mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({128, 10});
+
+    CapacityPreflightConfig preflight;
+    ExpectedTopicLoad load;
+    load.m_payloadSize = 4096u;
+    preflight.m_expectedLoad.push_back(load);
+
+    EXPECT_FALSE(validateSegmentCapacity(mempoolConfig, "group", preflight));
+}
+
+TEST(CapacityPreflight_test, loadOfAnotherWriterGroupIsSkipped)
+{
+    mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({1024, 1});
+
+    CapacityPreflightConfig preflight;
+    ExpectedTopicLoad load;
+    load.m_payloadSize = 128u;
+    load.m_senderPorts = 100u;
+    load.m_writerGroup = "otherGroup";
+    preflight.m_expectedLoad.push_back(load);
+
+    EXPECT_TRUE(validateSegmentCapacity(mempoolConfig, "group", preflight));
+}
@@ -0,0 +1,144 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_posh/internal/roudi/deadline_monitor.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace ::testing;
+using namespace iox::roudi;
+
+class DeadlineMonitor_test : public Test
+{
+  protected:
+    DeadlineMonitor_test()
+        : m_memoryAllocator(m_memory, 1024 * 1024)
+        , m_senderData(m_service, &m_memPoolHandler, "", iox::Interfaces::INTERNAL, nullptr)
+        , m_sender(&m_senderData)
+        , m_receiverData(m_service, "", iox::Interfaces::INTERNAL, nullptr)
+        , m_receiver(&m_receiverData)
+    {
+        mempoolconf.addMemPool({32, 20});
+        m_memPoolHandler.configureMemoryManager(mempoolconf, &m_memoryAllocator, &m_memoryAllocator);
+    }
+
+    void connectWithDeadline(const uint64_t f_deadlineNs)
+    {
+        m_sender.activate();
+        auto offerMessage = m_sender.getCaProMessage();
+        ASSERT_TRUE(offerMessage.has_value());
+        m_receiver.subscribeWithDeadline(f_deadlineNs, 10u);
+        auto subMessage = m_receiver.getCaProMessage();
+        ASSERT_TRUE(subMessage.has_value());
+        m_sender.dispatchCaProMessage(subMessage.value());
+    }
+
+    void deliver(const uint32_t f_value)
+    {
+        auto chunkHeader = m_sender.reserveChunk(sizeof(uint32_t));
+        ASSERT_THAT(chunkHeader, Ne(nullptr));
+        *static_cast<uint32_t*>(chunkHeader->payload()) = f_value;
+        m_sender.deliverChunk(chunkHeader);
+    }
+
+    char m_memory[1024 * 1024];
+    iox::posix::Allocator m_memoryAllocator;
+    iox::mepoo::MemoryManager m_memPoolHandler;
+    iox::mepoo::MePooConfig mempoolconf;
+    iox::capro::ServiceDescription m_service{1, 1, 1};
+    iox::SenderPortType::MemberType_t m_senderData;
+    iox::SenderPortType m_sender;
+    iox::ReceiverPortType::MemberType_t m_receiverData;
+    iox::ReceiverPortType m_receiver;
+};
+
+TEST_F(DeadlineMonitor_test, PortWithoutDeadlineIsNotMonitored)
+{
+    connectWithDeadline(0u);
+    DeadlineMonitor monitor;
+    EXPECT_FALSE(monitor.startMonitoring(&m_receiverData));
+    EXPECT_THAT(monitor.numberOfMonitoredPorts(), Eq(0u));
+}
+
+TEST_F(DeadlineMonitor_test, KeptDeadlineCountsNoMiss)
+{
+    constexpr uint64_t DeadlineNs = 50u * 1000u * 1000u; // 50 ms
+    connectWithDeadline(DeadlineNs);
+
+    DeadlineMonitor monitor;
+    ASSERT_TRUE(monitor.startMonitoring(&m_receiverData));
+    EXPECT_THAT(monitor.numberOfMonitoredPorts(), Eq(1u));
+
+    // deliver well within the deadline for a few cycles
+    for (uint32_t k = 0u; k < 10u; ++k)
+    {
+        deliver(k);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_THAT(m_receiver.getDeadlineMissCount(), Eq(0u));
+
+    monitor.stopMonitoring(&m_receiverData);
+    EXPECT_THAT(monitor.numberOfMonitoredPorts(), Eq(0u));
+}
+
+TEST_F(DeadlineMonitor_test, StalledTopicIsDetectedAndReported)
+{
+    constexpr uint64_t DeadlineNs = 20u * 1000u * 1000u; // 20 ms
+    connectWithDeadline(DeadlineNs);
+
+    std::atomic<uint64_t> reportedMissCount{0u};
+    iox::capro::ServiceDescription reportedService;
+    DeadlineMonitor monitor([&](const iox::capro::ServiceDescription& f_service, const uint64_t f_missCount) {
+        reportedService = f_service;
+        reportedMissCount = f_missCount;
+    });
+    ASSERT_TRUE(monitor.startMonitoring(&m_receiverData));
+
+    deliver(1u);
+    // no further delivery, the deadline is missed cycle after cycle
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_THAT(m_receiver.getDeadlineMissCount(), Ge(1u));
+    EXPECT_THAT(reportedMissCount.load(), Ge(1u));
+    EXPECT_TRUE(reportedService == m_service);
+
+    // a delivery recovers the topic, the miss count stays where it was
+    deliver(2u);
+    const auto missCountAfterRecovery = m_receiver.getDeadlineMissCount();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_THAT(m_receiver.getDeadlineMissCount(), Eq(missCountAfterRecovery));
+
+    monitor.stopMonitoring(&m_receiverData);
+}
+
+TEST_F(DeadlineMonitor_test, ResubscribeArmsOnlyOnce)
+{
+    constexpr uint64_t DeadlineNs = 50u * 1000u * 1000u;
+    connectWithDeadline(DeadlineNs);
+
+    DeadlineMonitor monitor;
+    ASSERT_TRUE(monitor.startMonitoring(&m_receiverData));
+    EXPECT_TRUE(monitor.startMonitoring(&m_receiverData));
+    EXPECT_THAT(monitor.numberOfMonitoredPorts(), Eq(1u));
+    monitor.stopMonitoring(&m_receiverData);
+}
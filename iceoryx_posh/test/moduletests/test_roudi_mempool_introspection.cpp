@@ -209,6 +209,130 @@ TEST_F(MemPoolIntrospection_test, DISABLED_send_withSubscribers)
     EXPECT_THAT(compareMemPoolInfo(memPoolInfoContainer, chunk.sample()->m_mempoolInfo), Eq(true));
 }
 
+TEST_F(MemPoolIntrospection_test, highWatermarkEvents)
+{
+    using EventTopic = iox::roudi::MemPoolIntrospectionEventTopic;
+
+    auto mock = m_senderPortImpl_mock.details;
+    MemPoolIntrospection m_introspection(
+        m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_senderPortImpl_mock));
+
+    SenderPort_MOCK eventSenderPort;
+    auto eventMock = eventSenderPort.details;
+    eventMock->isConnectedToMembersReturn = true;
+    eventMock->hasSubscribersReturn = true;
+    ChunkMock<EventTopic> eventChunk;
+    eventMock->reserveSampleReturn = eventChunk.chunkHeader();
+    m_introspection.registerEventSenderPort(std::move(eventSenderPort));
+    EXPECT_THAT(eventMock->activate, Eq(1));
+
+    // the high watermark of all mempools of the RouDi internal memory manager is set
+    // to 8 of 10 chunks, the mempools of the segment have no high watermark configured
+    uint32_t usedChunks = 9;
+    EXPECT_CALL(m_rouDiInternalMemoryManager_mock, getMemPoolInfo(_)).WillRepeatedly(Invoke([&](uint32_t) {
+        return MemPoolInfo(usedChunks, 10 - usedChunks, 10, 128, 0, 0, 8);
+    }));
+    EXPECT_CALL(m_segmentManager_mock.m_segmentContainer.front().getMemoryManager(), getMemPoolInfo(_))
+        .WillRepeatedly(Invoke([&](uint32_t) { return MemPoolInfo(0, 10, 10, 128); }));
+
+    // no subscribers on the regular introspection topic, the events are sent nevertheless
+    mock->hasSubscribersReturn = false;
+
+    // rising edge above the high watermark
+    m_introspection.send();
+    EXPECT_THAT(mock->reserveChunk, Eq(0));
+    ASSERT_THAT(eventMock->deliverChunk, Eq(1));
+    ASSERT_THAT(eventChunk.sample()->m_events.size(), Eq(iox::MAX_NUMBER_OF_MEMPOOLS));
+    EXPECT_THAT(eventChunk.sample()->m_events[0].m_id, Eq(0u));
+    EXPECT_THAT(eventChunk.sample()->m_events[0].m_usedChunks, Eq(9u));
+    EXPECT_THAT(eventChunk.sample()->m_events[0].m_highWatermark, Eq(8u));
+    EXPECT_THAT(eventChunk.sample()->m_events[0].m_aboveHighWatermark, Eq(true));
+
+    // staying above the high watermark is not an event
+    m_introspection.send();
+    EXPECT_THAT(eventMock->deliverChunk, Eq(1));
+
+    // falling edge below the high watermark
+    usedChunks = 3;
+    m_introspection.send();
+    ASSERT_THAT(eventMock->deliverChunk, Eq(2));
+    EXPECT_THAT(eventChunk.sample()->m_events[0].m_usedChunks, Eq(3u));
+    EXPECT_THAT(eventChunk.sample()->m_events[0].m_aboveHighWatermark, Eq(false));
+    EXPECT_THAT(eventChunk.sample()->m_sequenceNumber, Eq(1u));
+}
+
+TEST_F(MemPoolIntrospection_test, publishOnChangeSkipsStaticUsage)
+{
+    auto mock = m_senderPortImpl_mock.details;
+    MemPoolIntrospection m_introspection(
+        m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_senderPortImpl_mock));
+
+    uint32_t usedChunks = 3;
+    EXPECT_CALL(m_rouDiInternalMemoryManager_mock, getMemPoolInfo(_)).WillRepeatedly(Invoke([&](uint32_t) {
+        return MemPoolInfo(usedChunks, 10 - usedChunks, 10, 128);
+    }));
+    EXPECT_CALL(m_segmentManager_mock.m_segmentContainer.front().getMemoryManager(), getMemPoolInfo(_))
+        .WillRepeatedly(Invoke([&](uint32_t) { return MemPoolInfo(0, 10, 10, 128); }));
+
+    ChunkMock<Topic> chunk;
+    mock->hasSubscribersReturn = true;
+    mock->reserveSampleReturn = chunk.chunkHeader();
+
+    // the first call publishes, one sample for the RouDi internal memory
+    // manager and one for the segment
+    m_introspection.send();
+    EXPECT_THAT(mock->deliverChunk, Eq(2));
+
+    // static usage is not published again
+    m_introspection.send();
+    EXPECT_THAT(mock->deliverChunk, Eq(2));
+
+    // a change of the used chunk count triggers a publication
+    usedChunks = 5;
+    m_introspection.send();
+    EXPECT_THAT(mock->deliverChunk, Eq(4));
+
+    // the heartbeat forces a publication without any change
+    m_introspection.setHeartbeatInterval(2);
+    m_introspection.send();
+    EXPECT_THAT(mock->deliverChunk, Eq(4));
+    m_introspection.send();
+    EXPECT_THAT(mock->deliverChunk, Eq(6));
+}
+
+TEST_F(MemPoolIntrospection_test, publicationDeltaSuppressesSmallChanges)
+{
+    auto mock = m_senderPortImpl_mock.details;
+    MemPoolIntrospection m_introspection(
+        m_rouDiInternalMemoryManager_mock, m_segmentManager_mock, std::move(m_senderPortImpl_mock));
+
+    uint32_t usedChunks = 3;
+    EXPECT_CALL(m_rouDiInternalMemoryManager_mock, getMemPoolInfo(_)).WillRepeatedly(Invoke([&](uint32_t) {
+        return MemPoolInfo(usedChunks, 10 - usedChunks, 10, 128);
+    }));
+    EXPECT_CALL(m_segmentManager_mock.m_segmentContainer.front().getMemoryManager(), getMemPoolInfo(_))
+        .WillRepeatedly(Invoke([&](uint32_t) { return MemPoolInfo(0, 10, 10, 128); }));
+
+    ChunkMock<Topic> chunk;
+    mock->hasSubscribersReturn = true;
+    mock->reserveSampleReturn = chunk.chunkHeader();
+
+    m_introspection.setPublicationDelta(3);
+
+    m_introspection.send();
+    EXPECT_THAT(mock->deliverChunk, Eq(2));
+
+    // a change below the configured delta is suppressed
+    usedChunks = 5;
+    m_introspection.send();
+    EXPECT_THAT(mock->deliverChunk, Eq(2));
+
+    // crossing the delta relative to the last publication triggers
+    usedChunks = 6;
+    m_introspection.send();
+    EXPECT_THAT(mock->deliverChunk, Eq(4));
+}
+
 TEST_F(MemPoolIntrospection_test, thread)
 {
     auto mock = m_senderPortImpl_mock.details;
@@ -32,9 +32,9 @@ template <typename SenderPort, typename ReceiverPort>
 class PortIntrospectionAccess : public iox::roudi::PortIntrospection<SenderPort, ReceiverPort>
 {
   public:
-    void sendPortData()
+    void sendPortData(const bool f_completeState = true)
     {
-        iox::roudi::PortIntrospection<SenderPort, ReceiverPort>::sendPortData();
+        iox::roudi::PortIntrospection<SenderPort, ReceiverPort>::sendPortData(f_completeState);
     }
     void sendThroughputData()
     {
@@ -331,13 +331,16 @@ TEST_F(PortIntrospection_test, addAndRemoveSender)
 
     // test adding of ports
 
-    // remark: duplicate sender port insertions are not possible
+    // remark: the add and remove calls only hand a command over to the
+    // introspection thread and always return true; duplicate sender port
+    // insertions are rejected when the command is applied, which the
+    // published sample reflects
 
     iox::popo::SenderPortData portData1, portData2;
     EXPECT_THAT(m_introspection->addSender(&portData1, name1, service1, "4"), Eq(true));
-    EXPECT_THAT(m_introspection->addSender(&portData1, name1, service1, "4"), Eq(false));
+    EXPECT_THAT(m_introspection->addSender(&portData1, name1, service1, "4"), Eq(true));
+    EXPECT_THAT(m_introspection->addSender(&portData2, name2, service2, "jkl"), Eq(true));
     EXPECT_THAT(m_introspection->addSender(&portData2, name2, service2, "jkl"), Eq(true));
-    EXPECT_THAT(m_introspection->addSender(&portData2, name2, service2, "jkl"), Eq(false));
 
     mockPort1->getUniqueIDReturn = 1;
     mockPort2->getUniqueIDReturn = 2;
@@ -371,7 +374,7 @@ TEST_F(PortIntrospection_test, addAndRemoveSender)
     // test removal of ports
 
     EXPECT_THAT(m_introspection->removeSender(name1, service1), Eq(true));
-    EXPECT_THAT(m_introspection->removeSender(name1, service1), Eq(false));
+    EXPECT_THAT(m_introspection->removeSender(name1, service1), Eq(true));
 
     m_introspectionAccess.sendPortData();
 
@@ -383,7 +386,7 @@ TEST_F(PortIntrospection_test, addAndRemoveSender)
     }
 
     EXPECT_THAT(m_introspection->removeSender(name2, service2), Eq(true));
-    EXPECT_THAT(m_introspection->removeSender(name2, service2), Eq(false));
+    EXPECT_THAT(m_introspection->removeSender(name2, service2), Eq(true));
 
     m_introspectionAccess.sendPortData();
 
@@ -392,7 +395,7 @@ TEST_F(PortIntrospection_test, addAndRemoveSender)
         ASSERT_THAT(sample->m_receiverList.size(), Eq(0));
     }
 
-    EXPECT_THAT(m_introspection->removeSender(name2, service2), Eq(false));
+    EXPECT_THAT(m_introspection->removeSender(name2, service2), Eq(true));
 
     m_introspectionAccess.sendPortData();
 
@@ -480,7 +483,7 @@ TEST_F(PortIntrospection_test, addAndRemoveReceiver)
     // test removal of ports
 
     EXPECT_THAT(m_introspection->removeReceiver(name1, service1), Eq(true));
-    EXPECT_THAT(m_introspection->removeReceiver(name1, service1), Eq(false));
+    EXPECT_THAT(m_introspection->removeReceiver(name1, service1), Eq(true));
 
     m_introspectionAccess.sendPortData();
 
@@ -494,7 +497,7 @@ TEST_F(PortIntrospection_test, addAndRemoveReceiver)
     }
 
     EXPECT_THAT(m_introspection->removeReceiver(name2, service2), Eq(true));
-    EXPECT_THAT(m_introspection->removeReceiver(name2, service2), Eq(false));
+    EXPECT_THAT(m_introspection->removeReceiver(name2, service2), Eq(true));
 
     m_introspectionAccess.sendPortData();
 
@@ -503,7 +506,7 @@ TEST_F(PortIntrospection_test, addAndRemoveReceiver)
         ASSERT_THAT(sample->m_receiverList.size(), Eq(0));
     }
 
-    EXPECT_THAT(m_introspection->removeReceiver(name2, service2), Eq(false));
+    EXPECT_THAT(m_introspection->removeReceiver(name2, service2), Eq(true));
 
     m_introspectionAccess.sendPortData();
 
@@ -742,3 +745,58 @@ TEST_F(PortIntrospection_test, thread)
     EXPECT_TRUE(4 <= m_portThroughput_mock->deliverChunk && m_portThroughput_mock->deliverChunk <= 8);
     EXPECT_TRUE(4 <= m_receiverPortData_mock->deliverChunk && m_receiverPortData_mock->deliverChunk <= 8);
 }
+
+TEST_F(PortIntrospection_test, sendPortDataDelta)
+{
+    using Topic = iox::roudi::PortIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+    m_senderPortImpl_mock->reserveSampleReturn = chunk->chunkHeader();
+
+    std::string name1("name1");
+    std::string name2("name2");
+    iox::capro::ServiceDescription service1("a", "b", "c");
+    iox::capro::ServiceDescription service2("d", "e", "f");
+
+    iox::popo::SenderPortData senderPortData;
+    iox::popo::ReceiverPortData receiverPortData;
+    EXPECT_THAT(m_introspection->addSender(&senderPortData, name1, service1, ""), Eq(true));
+    EXPECT_THAT(m_introspection->addReceiver(&receiverPortData, name2, service2, ""), Eq(true));
+
+    // a complete state contains all ports and clears the dirty state
+    m_introspectionAccess.sendPortData();
+
+    auto sample = chunk->sample();
+    EXPECT_THAT(sample->m_completeState, Eq(true));
+    ASSERT_THAT(sample->m_senderList.size(), Eq(1));
+    ASSERT_THAT(sample->m_receiverList.size(), Eq(1));
+    auto lastSequenceNumber = sample->m_sequenceNumber;
+
+    // nothing changed, the delta is empty
+    m_introspectionAccess.sendPortData(false);
+    EXPECT_THAT(sample->m_completeState, Eq(false));
+    EXPECT_THAT(sample->m_sequenceNumber, Eq(lastSequenceNumber + 1));
+    EXPECT_THAT(sample->m_senderList.size(), Eq(0));
+    EXPECT_THAT(sample->m_receiverList.size(), Eq(0));
+    EXPECT_THAT(sample->m_removedSenderPortIDs.size(), Eq(0));
+    EXPECT_THAT(sample->m_removedReceiverPortIDs.size(), Eq(0));
+
+    // a new receiver is the only entry of the next delta
+    iox::popo::ReceiverPortData receiverPortData2;
+    EXPECT_THAT(m_introspection->addReceiver(&receiverPortData2, name1, service1, ""), Eq(true));
+    m_introspectionAccess.sendPortData(false);
+    EXPECT_THAT(sample->m_senderList.size(), Eq(0));
+    ASSERT_THAT(sample->m_receiverList.size(), Eq(1));
+
+    // a removed port shows up in the removal list of the next delta
+    EXPECT_THAT(m_introspection->removeSender(name1, service1), Eq(true));
+    m_introspectionAccess.sendPortData(false);
+    EXPECT_THAT(sample->m_senderList.size(), Eq(0));
+    ASSERT_THAT(sample->m_removedSenderPortIDs.size(), Eq(1));
+
+    // the removal was published and is not part of the following delta anymore
+    m_introspectionAccess.sendPortData(false);
+    EXPECT_THAT(sample->m_removedSenderPortIDs.size(), Eq(0));
+
+    sample->~PortIntrospectionFieldTopic();
+}
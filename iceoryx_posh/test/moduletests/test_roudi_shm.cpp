@@ -105,6 +105,35 @@ class SharedMemoryManager_test : public Test
 };
 
 
+TEST(FixedPositionContainer_test, contentTracksInsertAndErase)
+{
+    iox::roudi::FixedPositionContainer<uint32_t, 256> sut;
+
+    uint32_t* elements[5];
+    for (uint32_t i = 0u; i < 5u; ++i)
+    {
+        elements[i] = sut.insert(i);
+        ASSERT_THAT(elements[i], Ne(nullptr));
+    }
+    EXPECT_THAT(sut.content().size(), Eq(5u));
+
+    // erased slots disappear from the content, also across a word boundary
+    // sized table; the surviving elements keep their position
+    sut.erase(elements[1]);
+    sut.erase(elements[3]);
+    auto content = sut.content();
+    ASSERT_THAT(content.size(), Eq(3u));
+    EXPECT_THAT(*content[0], Eq(0u));
+    EXPECT_THAT(*content[1], Eq(2u));
+    EXPECT_THAT(*content[2], Eq(4u));
+
+    // a reused slot shows up again
+    auto replacement = sut.insert(73u);
+    ASSERT_THAT(replacement, Ne(nullptr));
+    content = sut.content();
+    ASSERT_THAT(content.size(), Eq(4u));
+}
+
 TEST_F(SharedMemoryManager_test, doDiscovery_singleShotSenderFirst)
 {
     SenderPort sender(
@@ -124,8 +153,8 @@ TEST_F(SharedMemoryManager_test, doDiscovery_singleShotSenderFirst)
 
     m_shmManager->doDiscovery();
 
-    ASSERT_THAT(sender.getMembers()->m_receiverHandler.m_receiverVector.size(), Eq(1));
-    auto it = sender.getMembers()->m_receiverHandler.m_receiverVector.begin();
+    ASSERT_THAT(sender.getMembers()->m_receiverHandler.getReceiverList().size(), Eq(1));
+    auto it = sender.getMembers()->m_receiverHandler.getReceiverList().begin();
 
     // is the correct receiver in the receiver list
     EXPECT_THAT(iox::popo::ReceiverPort(*it).getMembers()->m_processName, Eq(receiver1.getMembers()->m_processName));
@@ -153,8 +182,8 @@ TEST_F(SharedMemoryManager_test, doDiscovery_singleShotReceiverFirst)
 
     m_shmManager->doDiscovery();
 
-    ASSERT_THAT(sender.getMembers()->m_receiverHandler.m_receiverVector.size(), Eq(1));
-    auto it = sender.getMembers()->m_receiverHandler.m_receiverVector.begin();
+    ASSERT_THAT(sender.getMembers()->m_receiverHandler.getReceiverList().size(), Eq(1));
+    auto it = sender.getMembers()->m_receiverHandler.getReceiverList().begin();
 
     // is the correct receiver in the receiver list
     EXPECT_THAT(iox::popo::ReceiverPort(*it).getMembers()->m_processName, Eq(receiver1.getMembers()->m_processName));
@@ -182,8 +211,8 @@ TEST_F(SharedMemoryManager_test, doDiscovery_singleShotReceiverFirstWithDiscover
 
     m_shmManager->doDiscovery();
 
-    ASSERT_THAT(sender.getMembers()->m_receiverHandler.m_receiverVector.size(), Eq(1));
-    auto it = sender.getMembers()->m_receiverHandler.m_receiverVector.begin();
+    ASSERT_THAT(sender.getMembers()->m_receiverHandler.getReceiverList().size(), Eq(1));
+    auto it = sender.getMembers()->m_receiverHandler.getReceiverList().begin();
 
     // is the correct receiver in the receiver list
     EXPECT_THAT(iox::popo::ReceiverPort(*it).getMembers()->m_processName, Eq(receiver1.getMembers()->m_processName));
@@ -215,8 +244,8 @@ TEST_F(SharedMemoryManager_test, doDiscovery_rightOrdering)
     m_shmManager->doDiscovery();
 
     // check if all receivers are subscribed
-    ASSERT_THAT(sender.getMembers()->m_receiverHandler.m_receiverVector.size(), Eq(2));
-    auto it = sender.getMembers()->m_receiverHandler.m_receiverVector.begin();
+    ASSERT_THAT(sender.getMembers()->m_receiverHandler.getReceiverList().size(), Eq(2));
+    auto it = sender.getMembers()->m_receiverHandler.getReceiverList().begin();
 
     // check if the receivers are in the right order
     EXPECT_THAT(iox::popo::ReceiverPort(*it).getMembers()->m_processName, Eq(receiver1.getMembers()->m_processName));
@@ -228,6 +257,68 @@ TEST_F(SharedMemoryManager_test, doDiscovery_rightOrdering)
     EXPECT_TRUE(receiver2.isSubscribed());
 }
 
+TEST_F(SharedMemoryManager_test, deletePortsOfProcess_disconnectsAllCounterparts)
+{
+    // the dying process offers two different services and subscribes to a third
+    SenderPort dyingSender1(
+        m_shmManager
+            ->acquireSenderPortData({1, 1, 1},
+                                    iox::Interfaces::INTERNAL,
+                                    "/dying",
+                                    &m_shmManager->getShmInterface().getShmInterface()->m_roudiMemoryManager)
+            .get_value());
+    ASSERT_TRUE(dyingSender1);
+    dyingSender1.activate();
+
+    SenderPort dyingSender2(
+        m_shmManager
+            ->acquireSenderPortData({2, 2, 2},
+                                    iox::Interfaces::INTERNAL,
+                                    "/dying",
+                                    &m_shmManager->getShmInterface().getShmInterface()->m_roudiMemoryManager)
+            .get_value());
+    ASSERT_TRUE(dyingSender2);
+    dyingSender2.activate();
+
+    ReceiverPort dyingReceiver(m_shmManager->acquireReceiverPortData({3, 3, 3}, iox::Interfaces::INTERNAL, "/dying"));
+    ASSERT_TRUE(dyingReceiver);
+    dyingReceiver.subscribe(true);
+
+    // the surviving counterparts
+    ReceiverPort receiver1(m_shmManager->acquireReceiverPortData({1, 1, 1}, iox::Interfaces::INTERNAL, "/schlomo"));
+    ASSERT_TRUE(receiver1);
+    receiver1.subscribe(true);
+
+    ReceiverPort receiver2(m_shmManager->acquireReceiverPortData({2, 2, 2}, iox::Interfaces::INTERNAL, "/schlomo"));
+    ASSERT_TRUE(receiver2);
+    receiver2.subscribe(true);
+
+    SenderPort survivingSender(
+        m_shmManager
+            ->acquireSenderPortData({3, 3, 3},
+                                    iox::Interfaces::INTERNAL,
+                                    "/guiseppe",
+                                    &m_shmManager->getShmInterface().getShmInterface()->m_roudiMemoryManager)
+            .get_value());
+    ASSERT_TRUE(survivingSender);
+    survivingSender.activate();
+
+    m_shmManager->doDiscovery();
+
+    EXPECT_TRUE(receiver1.isSubscribed());
+    EXPECT_TRUE(receiver2.isSubscribed());
+    EXPECT_TRUE(dyingReceiver.isSubscribed());
+    ASSERT_THAT(survivingSender.getMembers()->m_receiverHandler.getReceiverList().size(), Eq(1));
+
+    m_shmManager->deletePortsOfProcess("/dying");
+
+    // the surviving receivers got the STOP_OFFER of the dying senders and the
+    // surviving sender got the UNSUB of the dying receiver
+    EXPECT_FALSE(receiver1.isSubscribed());
+    EXPECT_FALSE(receiver2.isSubscribed());
+    EXPECT_THAT(survivingSender.getMembers()->m_receiverHandler.getReceiverList().size(), Eq(0));
+}
+
 TEST_F(SharedMemoryManager_test, DISABLED_CheckDeleteOfPortsFromProcess1)
 {
     /// @todo refactor this part of the code, this is a hard whitebox test which
@@ -0,0 +1,193 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/runtime/runtime_command_channel.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+using namespace iox;
+using namespace iox::runtime;
+
+class RuntimeCommandChannel_test : public Test
+{
+  public:
+    void SetUp()
+    {
+        m_channel.setRequestSignal(&m_requestSignal);
+    }
+
+    void TearDown()
+    {
+    }
+
+    posix::FutexSignal m_requestSignal;
+    RuntimeCommandChannel m_channel;
+};
+
+TEST_F(RuntimeCommandChannel_test, requestRoundTrip)
+{
+    MqMessage request;
+    request << "FOO"
+            << "/bar" << 42;
+    EXPECT_THAT(m_channel.sendRequest(request), Eq(true));
+    EXPECT_THAT(m_requestSignal.tryWait(), Eq(true));
+
+    MqMessage received;
+    ASSERT_THAT(m_channel.tryGetRequest(received), Eq(true));
+    EXPECT_THAT(received.getMessage(), Eq(request.getMessage()));
+}
+
+TEST_F(RuntimeCommandChannel_test, tryGetRequestOnEmptyChannel)
+{
+    MqMessage received;
+    EXPECT_THAT(m_channel.tryGetRequest(received), Eq(false));
+}
+
+TEST_F(RuntimeCommandChannel_test, responseRoundTrip)
+{
+    MqMessage response;
+    response << "ACK"
+            << "1234";
+    EXPECT_THAT(m_channel.sendResponse(response), Eq(true));
+
+    MqMessage received;
+    ASSERT_THAT(m_channel.waitForResponse(received, 100), Eq(true));
+    EXPECT_THAT(received.getMessage(), Eq(response.getMessage()));
+}
+
+TEST_F(RuntimeCommandChannel_test, waitForResponseTimeout)
+{
+    MqMessage received;
+    EXPECT_THAT(m_channel.waitForResponse(received, 10), Eq(false));
+}
+
+TEST_F(RuntimeCommandChannel_test, requestOverflow)
+{
+    MqMessage request;
+    request << "FOO"
+            << "/bar";
+    for (uint32_t i = 0; i < COMMAND_CHANNEL_CAPACITY; ++i)
+    {
+        EXPECT_THAT(m_channel.sendRequest(request), Eq(true));
+    }
+    EXPECT_THAT(m_channel.sendRequest(request), Eq(false));
+}
+
+TEST_F(RuntimeCommandChannel_test, oversizedMessageIsRejected)
+{
+    MqMessage request;
+    request << std::string(static_cast<size_t>(ROUDI_MESSAGE_SIZE), 'x');
+    EXPECT_THAT(m_channel.sendRequest(request), Eq(false));
+    EXPECT_THAT(m_channel.sendResponse(request), Eq(false));
+}
+
+TEST_F(RuntimeCommandChannel_test, staleResponseIsDroppedOnNextRequest)
+{
+    MqMessage staleResponse;
+    staleResponse << "STALE";
+    EXPECT_THAT(m_channel.sendResponse(staleResponse), Eq(true));
+
+    MqMessage request;
+    request << "FOO"
+            << "/bar";
+    EXPECT_THAT(m_channel.sendRequest(request), Eq(true));
+
+    MqMessage response;
+    response << "ACK";
+    EXPECT_THAT(m_channel.sendResponse(response), Eq(true));
+
+    MqMessage received;
+    ASSERT_THAT(m_channel.waitForResponse(received, 100), Eq(true));
+    EXPECT_THAT(received.getMessage(), Eq(response.getMessage()));
+}
+
+TEST_F(RuntimeCommandChannel_test, requestBatchLargerThanRingCapacity)
+{
+    // echo server which answers every request like the RouDi dispatch would
+    std::atomic<bool> run{true};
+    std::thread server([&] {
+        while (run)
+        {
+            MqMessage request;
+            while (m_channel.tryGetRequest(request))
+            {
+                MqMessage response;
+                response << "ACK" << request.getElementAtIndex(1);
+                m_channel.sendResponse(response);
+            }
+            std::this_thread::yield();
+        }
+    });
+
+    constexpr uint32_t BATCH_SIZE = 2 * COMMAND_CHANNEL_CAPACITY + 3;
+    std::vector<MqMessage> requests;
+    for (uint32_t i = 0; i < BATCH_SIZE; ++i)
+    {
+        MqMessage request;
+        request << "FOO" << i;
+        requests.push_back(request);
+    }
+
+    std::vector<MqMessage> answers;
+    EXPECT_THAT(m_channel.transferRequestBatch(requests, answers, 1000), Eq(true));
+    run = false;
+    server.join();
+
+    ASSERT_THAT(answers.size(), Eq(static_cast<size_t>(BATCH_SIZE)));
+    for (uint32_t i = 0; i < BATCH_SIZE; ++i)
+    {
+        EXPECT_THAT(answers[i].getElementAtIndex(1), Eq(std::to_string(i)));
+    }
+}
+
+TEST_F(RuntimeCommandChannel_test, requestBatchTimeoutWithoutResponder)
+{
+    std::vector<MqMessage> requests;
+    MqMessage request;
+    request << "FOO"
+            << "/bar";
+    requests.push_back(request);
+
+    std::vector<MqMessage> answers;
+    EXPECT_THAT(m_channel.transferRequestBatch(requests, answers, 10), Eq(false));
+    EXPECT_THAT(answers.empty(), Eq(true));
+}
+
+TEST_F(RuntimeCommandChannel_test, heartbeatCounter)
+{
+    EXPECT_THAT(m_channel.getHeartbeatCount(), Eq(0u));
+    m_channel.sendHeartbeat();
+    EXPECT_THAT(m_channel.getHeartbeatCount(), Eq(1u));
+    m_channel.sendHeartbeat();
+    m_channel.sendHeartbeat();
+    EXPECT_THAT(m_channel.getHeartbeatCount(), Eq(3u));
+}
+
+TEST_F(RuntimeCommandChannel_test, sendRequestWithoutSignalConnected)
+{
+    RuntimeCommandChannel channel;
+    MqMessage request;
+    request << "FOO"
+            << "/bar";
+    EXPECT_THAT(channel.sendRequest(request), Eq(true));
+
+    MqMessage received;
+    ASSERT_THAT(channel.tryGetRequest(received), Eq(true));
+    EXPECT_THAT(received.getMessage(), Eq(request.getMessage()));
+}
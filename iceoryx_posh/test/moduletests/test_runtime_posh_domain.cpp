@@ -0,0 +1,62 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/runtime/posh_domain.hpp"
+#include "test.hpp"
+
+using namespace ::testing;
+using iox::runtime::PoshDomain;
+
+class PoshDomain_test : public Test
+{
+  public:
+    void TearDown()
+    {
+        // the domain selection is process global, do not leak it into other tests
+        PoshDomain::setDomainId(PoshDomain::DEFAULT_DOMAIN_ID);
+    }
+};
+
+TEST_F(PoshDomain_test, DefaultDomainKeepsLegacyNames)
+{
+    ASSERT_TRUE(PoshDomain::setDomainId(PoshDomain::DEFAULT_DOMAIN_ID));
+    EXPECT_THAT(PoshDomain::getDomainId(), Eq(PoshDomain::DEFAULT_DOMAIN_ID));
+    EXPECT_THAT(PoshDomain::getRoudiMqName(), StrEq(iox::MQ_ROUDI_NAME));
+    EXPECT_THAT(PoshDomain::getMgmtShmName(), StrEq(iox::SHM_NAME));
+}
+
+TEST_F(PoshDomain_test, NonDefaultDomainGetsSuffixedNames)
+{
+    ASSERT_TRUE(PoshDomain::setDomainId(3u));
+    EXPECT_THAT(PoshDomain::getDomainId(), Eq(3u));
+    EXPECT_THAT(PoshDomain::getRoudiMqName(), StrEq("/roudi_3"));
+    EXPECT_THAT(PoshDomain::getMgmtShmName(), StrEq("/iceoryx_mgmt_3"));
+}
+
+TEST_F(PoshDomain_test, OutOfRangeDomainIdIsRejected)
+{
+    ASSERT_TRUE(PoshDomain::setDomainId(7u));
+    EXPECT_FALSE(PoshDomain::setDomainId(PoshDomain::MAX_DOMAIN_ID + 1u));
+    // the previous selection stays untouched
+    EXPECT_THAT(PoshDomain::getDomainId(), Eq(7u));
+    EXPECT_THAT(PoshDomain::getRoudiMqName(), StrEq("/roudi_7"));
+}
+
+TEST_F(PoshDomain_test, MaximumDomainIdIsAccepted)
+{
+    ASSERT_TRUE(PoshDomain::setDomainId(PoshDomain::MAX_DOMAIN_ID));
+    EXPECT_THAT(PoshDomain::getRoudiMqName(), StrEq("/roudi_255"));
+    EXPECT_THAT(PoshDomain::getMgmtShmName(), StrEq("/iceoryx_mgmt_255"));
+}
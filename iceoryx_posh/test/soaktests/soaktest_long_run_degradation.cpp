@@ -0,0 +1,322 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @brief Soak harness which measures long-run performance degradation. On top
+/// of the in-process RouDi environment it runs publish/subscribe churn plus
+/// simulated process restarts and samples three metrics continuously:
+///
+///   - allocation latency: reserveChunk on the sender port
+///   - delivery latency:   deliverChunk until the chunk is fetched
+///   - RouDi response:     port creation round trips of a restarting process
+///
+/// The run is divided into fixed windows; for every window the p50/p99/max of
+/// each metric is printed. At the end the last window is compared against the
+/// first one and the harness fails when a p99 degraded beyond the allowed
+/// factor, which catches slow creep like free-list fragmentation, ABA counter
+/// pathologies or a RouDi mq that gets slower with uptime:
+///
+///     posh_soaktests [durationSeconds [windowSeconds]]
+///
+/// The default duration is a smoke run; for the real soak let it run for hours
+/// (e.g. posh_soaktests 14400). The harness is a standalone executable and not
+/// executed by the test runner.
+
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_posh/internal/roudi_environment/roudi_environment.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t DEFAULT_DURATION_SECONDS{60u};
+constexpr uint64_t DEFAULT_WINDOW_SECONDS{10u};
+/// a p99 of the last window larger than this factor times the p99 of the first
+/// window is considered degradation; generous enough for scheduling noise,
+/// tight enough to catch systematic creep over hours
+constexpr uint64_t DEGRADATION_FACTOR{3u};
+/// absolute slack added on top of the baseline so that short smoke runs with
+/// single digit microsecond baselines do not fail on a single outlier
+constexpr uint64_t DEGRADATION_SLACK_NS{100u * 1000u};
+/// wall clock distance of two simulated process restarts
+constexpr uint64_t RESTART_PERIOD_MS{1000u};
+
+using Clock = std::chrono::steady_clock;
+
+uint64_t nowNs()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+}
+
+struct SoakTopic
+{
+    uint64_t m_sendTimeNs{0u};
+    uint64_t m_sequenceNumber{0u};
+    uint8_t m_padding[48];
+};
+
+struct Percentiles
+{
+    uint64_t p50{0u};
+    uint64_t p99{0u};
+    uint64_t max{0u};
+};
+
+Percentiles summarize(std::vector<uint64_t>& f_samples)
+{
+    Percentiles result;
+    if (f_samples.empty())
+    {
+        return result;
+    }
+    std::sort(f_samples.begin(), f_samples.end());
+    result.p50 = f_samples[f_samples.size() / 2u];
+    result.p99 = f_samples[(f_samples.size() * 99u) / 100u];
+    result.max = f_samples.back();
+    return result;
+}
+
+struct WindowResult
+{
+    uint64_t windowIndex{0u};
+    uint64_t iterations{0u};
+    Percentiles allocation;
+    Percentiles delivery;
+    Percentiles roudiResponse;
+};
+
+void printWindow(const WindowResult& f_window)
+{
+    std::cout << "| " << std::setw(6) << f_window.windowIndex << " | " << std::setw(10) << f_window.iterations << " | "
+              << std::setw(8) << f_window.allocation.p50 << " " << std::setw(8) << f_window.allocation.p99 << " "
+              << std::setw(9) << f_window.allocation.max << " | " << std::setw(8) << f_window.delivery.p50 << " "
+              << std::setw(8) << f_window.delivery.p99 << " " << std::setw(9) << f_window.delivery.max << " | "
+              << std::setw(8) << f_window.roudiResponse.p50 << " " << std::setw(8) << f_window.roudiResponse.p99 << " "
+              << std::setw(9) << f_window.roudiResponse.max << " |" << std::endl;
+}
+
+void printJson(const std::vector<WindowResult>& f_windows)
+{
+    std::cout << "{\"soak\":\"posh_long_run\",\"windows\":[";
+    for (size_t i = 0u; i < f_windows.size(); ++i)
+    {
+        const auto& window = f_windows[i];
+        std::cout << (i == 0u ? "" : ",") << "{\"window\":" << window.windowIndex
+                  << ",\"iterations\":" << window.iterations << ",\"alloc_ns\":{\"p50\":" << window.allocation.p50
+                  << ",\"p99\":" << window.allocation.p99 << ",\"max\":" << window.allocation.max
+                  << "},\"delivery_ns\":{\"p50\":" << window.delivery.p50 << ",\"p99\":" << window.delivery.p99
+                  << ",\"max\":" << window.delivery.max << "},\"roudi_ns\":{\"p50\":" << window.roudiResponse.p50
+                  << ",\"p99\":" << window.roudiResponse.p99 << ",\"max\":" << window.roudiResponse.max << "}}";
+    }
+    std::cout << "]}" << std::endl;
+}
+
+/// @brief simulates one process restart: a fresh runtime registers at RouDi,
+///         creates one sender and one receiver port and vanishes again, upon
+///         which RouDi has to recover the resources of the gone process
+/// @return duration of the port creation round trips in nanoseconds
+uint64_t restartCycle(iox::roudi::RouDiEnvironment& f_env, const iox::capro::ServiceDescription& f_service)
+{
+    const std::string name{"/soak_churn"};
+
+    auto start = nowNs();
+    auto& runtime = iox::runtime::PoshRuntime::getInstance(name);
+    {
+        iox::popo::SenderPort sender(runtime.getMiddlewareSender(f_service));
+        iox::popo::ReceiverPort receiver(runtime.getMiddlewareReceiver(f_service));
+    }
+    auto responseTime = nowNs() - start;
+
+    // tearing down the runtime makes RouDi treat the process like a terminated
+    // one and reclaim its ports, exactly what a real restart loop exercises
+    f_env.CleanupAppResources(name);
+
+    return responseTime;
+}
+
+bool degraded(const char* f_metric, const Percentiles& f_baseline, const Percentiles& f_last)
+{
+    uint64_t bound = f_baseline.p99 * DEGRADATION_FACTOR + DEGRADATION_SLACK_NS;
+    if (f_last.p99 > bound)
+    {
+        std::cout << "DEGRADATION: " << f_metric << " p99 went from " << f_baseline.p99 << " ns to " << f_last.p99
+                  << " ns (bound " << bound << " ns)" << std::endl;
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    uint64_t durationSeconds{DEFAULT_DURATION_SECONDS};
+    uint64_t windowSeconds{DEFAULT_WINDOW_SECONDS};
+    if (argc > 1)
+    {
+        auto duration = std::atoll(argv[1]);
+        if (duration <= 0)
+        {
+            std::cerr << "usage: " << argv[0] << " [durationSeconds [windowSeconds]]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        durationSeconds = static_cast<uint64_t>(duration);
+    }
+    if (argc > 2)
+    {
+        auto window = std::atoll(argv[2]);
+        if (window <= 0 || static_cast<uint64_t>(window) > durationSeconds)
+        {
+            std::cerr << "usage: " << argv[0] << " [durationSeconds [windowSeconds]]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        windowSeconds = static_cast<uint64_t>(window);
+    }
+
+    std::cout << "#### Posh Long-Run Soak ####" << std::endl;
+    std::cout << durationSeconds << " s runtime, " << windowSeconds << " s windows, restart every "
+              << RESTART_PERIOD_MS << " ms, sample size " << sizeof(SoakTopic) << " bytes" << std::endl;
+
+    iox::roudi::RouDiEnvironment roudiEnv;
+
+    const iox::capro::ServiceDescription service{99u, 99u, 99u};
+    const iox::capro::ServiceDescription churnService{99u, 99u, 100u};
+
+    auto& senderRuntime = iox::runtime::PoshRuntime::getInstance("/soak_sender");
+    iox::popo::SenderPort senderPort(senderRuntime.getMiddlewareSender(service));
+    auto& receiverRuntime = iox::runtime::PoshRuntime::getInstance("/soak_receiver");
+    iox::popo::ReceiverPort receiverPort(receiverRuntime.getMiddlewareReceiver(service));
+
+    senderPort.activate();
+    roudiEnv.InterOpWait();
+    receiverPort.subscribe(true, 100u);
+    roudiEnv.InterOpWait();
+
+    if (!senderPort.isPortActive() || !receiverPort.isSubscribed())
+    {
+        std::cerr << "could not establish the publish/subscribe connection" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<uint64_t> allocationSamples;
+    std::vector<uint64_t> deliverySamples;
+    std::vector<uint64_t> roudiSamples;
+    std::vector<WindowResult> windows;
+
+    const uint64_t windowNs = windowSeconds * 1000000000ull;
+    const uint64_t restartPeriodNs = RESTART_PERIOD_MS * 1000000ull;
+    const uint64_t endOfRun = nowNs() + durationSeconds * 1000000000ull;
+    uint64_t windowStart = nowNs();
+    uint64_t lastRestart = windowStart;
+    uint64_t iterations = 0u;
+    uint64_t sequenceNumber = 0u;
+    bool failed = false;
+
+    std::cout << std::endl;
+    std::cout << "| window | iterations |      alloc p50/p99/max [ns]  |   delivery p50/p99/max [ns]  |"
+                 "      roudi p50/p99/max [ns]  |"
+              << std::endl;
+
+    while (nowNs() < endOfRun)
+    {
+        // allocation latency
+        auto allocStart = nowNs();
+        auto* sample = senderPort.reserveChunk(sizeof(SoakTopic));
+        allocationSamples.push_back(nowNs() - allocStart);
+        if (sample == nullptr)
+        {
+            std::cerr << "mempool exhausted after " << sequenceNumber << " samples, chunks are leaking" << std::endl;
+            failed = true;
+            break;
+        }
+
+        // delivery latency, measured from right before the delivery until the
+        // chunk was fetched from the delivery FiFo
+        auto* topic = new (sample->payload()) SoakTopic;
+        topic->m_sequenceNumber = sequenceNumber++;
+        sample->m_info.m_payloadSize = sizeof(SoakTopic);
+        topic->m_sendTimeNs = nowNs();
+        senderPort.deliverChunk(sample);
+
+        const iox::mepoo::ChunkHeader* receivedChunk{nullptr};
+        if (!receiverPort.getChunk(receivedChunk))
+        {
+            std::cerr << "sample " << sequenceNumber - 1u << " was not delivered" << std::endl;
+            failed = true;
+            break;
+        }
+        auto* receivedTopic = static_cast<const SoakTopic*>(receivedChunk->payload());
+        deliverySamples.push_back(nowNs() - receivedTopic->m_sendTimeNs);
+        receiverPort.releaseChunk(receivedChunk);
+        ++iterations;
+
+        // simulated process restart with RouDi response measurement
+        auto now = nowNs();
+        if (now - lastRestart >= restartPeriodNs)
+        {
+            roudiSamples.push_back(restartCycle(roudiEnv, churnService));
+            lastRestart = now;
+        }
+
+        // window rollover
+        if (now - windowStart >= windowNs)
+        {
+            WindowResult window;
+            window.windowIndex = windows.size();
+            window.iterations = iterations;
+            window.allocation = summarize(allocationSamples);
+            window.delivery = summarize(deliverySamples);
+            window.roudiResponse = summarize(roudiSamples);
+            printWindow(window);
+            windows.push_back(window);
+
+            allocationSamples.clear();
+            deliverySamples.clear();
+            roudiSamples.clear();
+            iterations = 0u;
+            windowStart = now;
+        }
+    }
+
+    receiverPort.unsubscribe();
+    senderPort.deactivate();
+
+    if (windows.size() < 2u)
+    {
+        std::cerr << "run too short for a degradation verdict, need at least two complete windows" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << std::endl;
+    std::cout << "#### JSON ####" << std::endl;
+    printJson(windows);
+
+    const auto& baseline = windows.front();
+    const auto& last = windows.back();
+    failed = degraded("allocation latency", baseline.allocation, last.allocation) || failed;
+    failed = degraded("delivery latency", baseline.delivery, last.delivery) || failed;
+    failed = degraded("roudi response time", baseline.roudiResponse, last.roudiResponse) || failed;
+
+    std::cout << std::endl << (failed ? "SOAK FAILED" : "SOAK PASSED") << std::endl;
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
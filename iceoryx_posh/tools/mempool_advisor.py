@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Derives an optimized MePooConfig from a recorded allocation trace.
+
+Input is the dump written by MemoryManager::dumpAllocationTrace() after a
+recorded drive with allocation tracing enabled: a log2 histogram of the
+requested payload sizes, a reservoir sample of exact sizes and the usage
+counters of the pools that were configured during the recording.
+
+The suggested layout has one mempool per power-of-two band with traffic.
+Chunk sizes come from the largest sampled request of the band (rounded up to
+the 32 byte mempool alignment), so the band wastes no memory on unused slack;
+chunk counts distribute the observed peak concurrent usage by the traffic
+share of the band, with a safety margin for bursts the recording missed.
+
+Usage: mempool_advisor.py <trace.dump> [--margin <factor>]
+"""
+
+import math
+import sys
+
+ALIGNMENT = 32
+MIN_CHUNK_COUNT = 10
+DEFAULT_MARGIN = 1.3
+
+
+def fail(message):
+    sys.stderr.write("mempool_advisor: " + message + "\n")
+    sys.exit(1)
+
+
+def parse_dump(path):
+    size_classes = {}
+    samples = []
+    pools = []
+    total_requests = 0
+    with open(path, "r") as dump:
+        for raw_line in dump:
+            line = raw_line.strip()
+            if not line or line.startswith("#"):
+                continue
+            fields = line.split()
+            if fields[0] == "total_requests":
+                total_requests = int(fields[1])
+            elif fields[0] == "sizeclass":
+                size_classes[int(fields[1])] = int(fields[2])
+            elif fields[0] == "sample":
+                samples.append(int(fields[1]))
+            elif fields[0] == "pool":
+                # pool <index> <chunkSize> <numChunks> <usedChunks> <minFree> ...
+                pools.append({"chunk_size": int(fields[2]),
+                              "num_chunks": int(fields[3]),
+                              "min_free": int(fields[5])})
+    if total_requests == 0 or not size_classes:
+        fail("no recorded allocations in " + path)
+    return total_requests, size_classes, samples, pools
+
+
+def align_up(value):
+    return max(ALIGNMENT, (value + ALIGNMENT - 1) // ALIGNMENT * ALIGNMENT)
+
+
+def suggest(total_requests, size_classes, samples, pools, margin):
+    # observed peak concurrent usage over all recorded pools; this is what the
+    # new chunk counts have to cover, lifetime enters through concurrency
+    peak_used = sum(p["num_chunks"] - p["min_free"] for p in pools)
+    if peak_used == 0:
+        peak_used = MIN_CHUNK_COUNT
+
+    suggestions = []
+    for size_class in sorted(size_classes):
+        count = size_classes[size_class]
+        band_samples = [s for s in samples if s and int(math.log(s, 2)) == size_class]
+        if band_samples:
+            payload_size = align_up(max(band_samples))
+        else:
+            # no exact sample survived in the reservoir, cover the whole band
+            payload_size = align_up(2 ** (size_class + 1) - 1)
+        share = float(count) / float(total_requests)
+        chunk_count = max(MIN_CHUNK_COUNT, int(math.ceil(peak_used * share * margin)))
+        suggestions.append((payload_size, chunk_count, count, share))
+    return suggestions
+
+
+def main():
+    args = sys.argv[1:]
+    margin = DEFAULT_MARGIN
+    if "--margin" in args:
+        index = args.index("--margin")
+        margin = float(args[index + 1])
+        del args[index:index + 2]
+    if len(args) != 1:
+        fail("usage: mempool_advisor.py <trace.dump> [--margin <factor>]")
+
+    total_requests, size_classes, samples, pools = parse_dump(args[0])
+    suggestions = suggest(total_requests, size_classes, samples, pools, margin)
+
+    print("# suggested mempool layout derived from %s" % args[0])
+    print("# %u recorded allocations, margin %.2f" % (total_requests, margin))
+    for payload_size, chunk_count, count, share in suggestions:
+        print("")
+        print("# %u requests (%.1f%% of traffic)" % (count, share * 100.0))
+        print("[[segment.mempool]]")
+        print("size = %u" % payload_size)
+        print("count = %u" % chunk_count)
+
+
+if __name__ == "__main__":
+    main()
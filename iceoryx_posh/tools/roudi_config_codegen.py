@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generates a C++ translation unit embedding a RouDi configuration.
+
+Reads the same TOML config file format as the TOML config file parser of the
+RouDi application (general.version, [[segment]] with reader/writer groups and
+[[segment.mempool]] with size/count) and emits a translation unit implementing
+iox::roudi::builtinRouDiConfig(). Production RouDi built with
+-DBUILTIN_CONFIG_FILE=<file> then boots from the embedded tables in .rodata
+without any config file access or parsing and without carrying the TOML
+parser.
+
+Usage: roudi_config_codegen.py <config.toml> <output.cpp>
+"""
+
+import re
+import sys
+
+
+def fail(message):
+    sys.stderr.write("roudi_config_codegen: " + message + "\n")
+    sys.exit(1)
+
+
+def parse_config(path):
+    """Minimal parser for the TOML subset the RouDi config file uses."""
+    general = {}
+    segments = []
+    current = None
+
+    with open(path, "r") as config_file:
+        for raw_line in config_file:
+            line = raw_line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            if line == "[general]":
+                current = general
+            elif line == "[[segment]]":
+                segments.append({"mempools": []})
+                current = segments[-1]
+            elif line == "[[segment.mempool]]":
+                if not segments:
+                    fail("mempool outside of a segment in " + path)
+                segments[-1]["mempools"].append({})
+                current = segments[-1]["mempools"][-1]
+            elif line.startswith("["):
+                fail("unsupported table " + line + " in " + path)
+            else:
+                match = re.match(r"^([A-Za-z0-9_-]+)\s*=\s*(.+)$", line)
+                if not match or current is None:
+                    fail("cannot parse line '" + line + "' in " + path)
+                key, value = match.group(1), match.group(2).strip()
+                if value.startswith('"') and value.endswith('"'):
+                    current[key] = value[1:-1]
+                else:
+                    try:
+                        current[key] = int(value)
+                    except ValueError:
+                        fail("cannot parse value '" + value + "' in " + path)
+
+    if general.get("version") != 1:
+        fail("unsupported or missing config file version in " + path)
+    if not segments:
+        fail("at least one segment has to be defined in " + path)
+    for segment in segments:
+        if not segment["mempools"]:
+            fail("a segment without mempools was found in " + path)
+        for mempool in segment["mempools"]:
+            if "size" not in mempool:
+                fail("a mempool without chunk size was found in " + path)
+            if "count" not in mempool:
+                fail("a mempool without chunk count was found in " + path)
+    return segments
+
+
+def group_expression(segment, key):
+    """Missing reader/writer groups default to the group of the RouDi process,
+    like in the TOML config file parser."""
+    if key in segment:
+        return '"' + segment[key] + '"'
+    return "l_groupOfCurrentProcess"
+
+
+def emit(segments, config_path, out):
+    out.write("// Generated by tools/roudi_config_codegen.py from\n")
+    out.write("// " + config_path + " - do not edit\n")
+    out.write("\n")
+    out.write('#include "iceoryx_posh/roudi/roudi_config_builtin.hpp"\n')
+    out.write('#include "iceoryx_utils/internal/posix_wrapper/posix_access_rights.hpp"\n')
+    out.write("\n")
+    out.write("namespace iox\n{\nnamespace roudi\n{\nnamespace\n{\n")
+    out.write("struct MemPoolEntry\n{\n")
+    out.write("    uint32_t m_size;\n")
+    out.write("    uint32_t m_chunkCount;\n")
+    out.write("};\n")
+    for index, segment in enumerate(segments):
+        out.write("\nconstexpr MemPoolEntry SEGMENT_%d_MEMPOOLS[] = {\n" % index)
+        for mempool in segment["mempools"]:
+            out.write("    {%uu, %uu},\n" % (mempool["size"], mempool["count"]))
+        out.write("};\n")
+    out.write("} // namespace\n")
+    out.write("\n")
+    out.write("RouDiConfig_t builtinRouDiConfig() noexcept\n{\n")
+    out.write("    RouDiConfig_t l_config;\n")
+    out.write("    const auto l_groupOfCurrentProcess = "
+              "posix::PosixGroup::getGroupOfCurrentProcess().getName();\n")
+    out.write("    static_cast<void>(l_groupOfCurrentProcess);\n")
+    for index, segment in enumerate(segments):
+        out.write("\n    {\n")
+        out.write("        mepoo::MePooConfig l_mempoolConfig;\n")
+        out.write("        for (const auto& entry : SEGMENT_%d_MEMPOOLS)\n" % index)
+        out.write("        {\n")
+        out.write("            l_mempoolConfig.addMemPool({entry.m_size, entry.m_chunkCount});\n")
+        out.write("        }\n")
+        out.write("        l_config.m_sharedMemorySegments.push_back(\n")
+        out.write("            {%s, %s, l_mempoolConfig});\n"
+                  % (group_expression(segment, "reader"), group_expression(segment, "writer")))
+        out.write("    }\n")
+    out.write("\n    return l_config;\n")
+    out.write("}\n")
+    out.write("\n} // namespace roudi\n} // namespace iox\n")
+
+
+def main():
+    if len(sys.argv) != 3:
+        fail("usage: roudi_config_codegen.py <config.toml> <output.cpp>")
+    segments = parse_config(sys.argv[1])
+    with open(sys.argv[2], "w") as out:
+        emit(segments, sys.argv[1], out)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,102 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/cxx/vector.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t Capacity{50u};
+constexpr uint64_t Repetitions{100000u};
+
+// mimics the IdString payload of the InstanceContainer in iceoryx_posh
+struct IdStringLike
+{
+    char value[100];
+};
+
+template <typename Functor>
+uint64_t measureNanoseconds(const Functor& f_functor)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0u; i < Repetitions; ++i)
+    {
+        f_functor();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count())
+           / Repetitions;
+}
+
+void printResult(const char* f_name, const uint64_t f_cxxNanoseconds, const uint64_t f_stdNanoseconds)
+{
+    std::cout << std::left << std::setw(20) << f_name << " cxx::vector " << std::right << std::setw(6)
+              << f_cxxNanoseconds << " ns   std::vector " << std::setw(6) << f_stdNanoseconds << " ns" << std::endl;
+}
+} // namespace
+
+int main()
+{
+    IdStringLike dummy;
+    std::memset(dummy.value, 'x', sizeof(dummy.value) - 1u);
+    dummy.value[sizeof(dummy.value) - 1u] = '\0';
+
+    iox::cxx::vector<IdStringLike, Capacity> cxxSource;
+    std::vector<IdStringLike> stdSource;
+    for (uint64_t i = 0u; i < Capacity; ++i)
+    {
+        cxxSource.emplace_back(dummy);
+        stdSource.emplace_back(dummy);
+    }
+
+    auto fillCxx = measureNanoseconds([&] {
+        iox::cxx::vector<IdStringLike, Capacity> sut;
+        for (uint64_t i = 0u; i < Capacity; ++i)
+        {
+            sut.emplace_back(dummy);
+        }
+    });
+    auto fillStd = measureNanoseconds([&] {
+        std::vector<IdStringLike> sut;
+        for (uint64_t i = 0u; i < Capacity; ++i)
+        {
+            sut.emplace_back(dummy);
+        }
+    });
+    printResult("fill", fillCxx, fillStd);
+
+    iox::cxx::vector<IdStringLike, Capacity> cxxDestination;
+    std::vector<IdStringLike> stdDestination;
+    auto copyCxx = measureNanoseconds([&] { cxxDestination = cxxSource; });
+    auto copyStd = measureNanoseconds([&] { stdDestination = stdSource; });
+    printResult("copy assignment", copyCxx, copyStd);
+
+    auto eraseCxx = measureNanoseconds([&] {
+        auto sut = cxxSource;
+        sut.erase(sut.begin());
+    });
+    auto eraseStd = measureNanoseconds([&] {
+        auto sut = stdSource;
+        sut.erase(sut.begin());
+    });
+    printResult("copy + erase front", eraseCxx, eraseStd);
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/cxx/optional.hpp"
+#include "iceoryx_utils/internal/concurrent/fifo.hpp"
+#include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
+#include "iceoryx_utils/internal/units/duration.hpp"
+#include "iceoryx_utils/posix_wrapper/semaphore.hpp"
+
+#include <type_traits>
+
+namespace iox
+{
+/// @brief zero-copy communication channel protocol for payloads residing in
+///         shared memory. In contrast to the FiFoProtocol the payload is not
+///         copied through the fifo; only a relocatable reference consisting of
+///         the segment id and the offset within the segment travels by value,
+///         so the cost per message is independent of the payload size. The
+///         DataType of the channel has to be a pointer to the payload and the
+///         payload has to live in a memory segment registered with
+///         RelativePointer::registerPtr, ownership of the payload is not
+///         transferred
+/// @param[in] DataType pointer type to the payload which should be transferred
+/// @param[in] Capacity capacity of the underlying fifo
+template <typename DataType, uint64_t Capacity>
+class RelocatableProtocol
+{
+    static_assert(std::is_pointer<DataType>::value,
+                  "the zero-copy protocol transfers payload references, DataType has to be a pointer type");
+    using Payload_t = typename std::remove_pointer<DataType>::type;
+
+  public:
+    /// @brief non blocking send which delivers a relocatable reference to the payload
+    /// @param[in] f_message pointer to a payload inside a registered memory segment
+    /// @return if the message cannot be delivered it returns false, otherwise true
+    bool Send(const DataType& f_message);
+
+    /// @brief non blocking receive.
+    /// @return if the protocol received a message the optional does contain the
+    ///         pointer to the payload otherwise a cxx::nullopt is returned
+    cxx::optional<DataType> TryReceive();
+
+    /// @brief blocking receive. if the protocol received a message the
+    ///         optional does contain it.
+    /// @return if the destructor is called from a different thread
+    ///         then this method returns a cxx::nullopt and this class should not be
+    ///         used anymore.
+    cxx::optional<DataType> BlockingReceive();
+
+    /// @brief blocking receive with timeout.
+    /// @param[in] f_timeout timeout of timedReceive
+    /// @return if a message is received during the
+    ///         timeout period the message is stored inside the optional, otherwise
+    ///         the optional contains a cxx::nullopt
+    cxx::optional<DataType> timedReceive(const units::Duration& f_timeout);
+
+  private:
+    /// relocatable reference to the payload which travels through the fifo; the
+    /// same scheme the chunk delivery uses to hand chunk references between
+    /// processes without touching the payload
+    struct PayloadTransport
+    {
+        PayloadTransport() = default;
+        PayloadTransport(iox::relative_ptr<Payload_t> f_payload)
+            : m_segmentId(f_payload.getId())
+            , m_payloadOffset(f_payload.getOffset())
+        {
+        }
+
+        RelativePointer::id_t m_segmentId{iox::RelativePointer::NULL_POINTER_ID};
+        RelativePointer::offset_t m_payloadOffset{iox::RelativePointer::NULL_POINTER_OFFSET};
+    };
+
+    DataType toPointer(const PayloadTransport& f_transport) const;
+
+    concurrent::FiFo<PayloadTransport, Capacity> m_fifo;
+    posix::Semaphore m_semaphore = std::move(posix::Semaphore::create(0)
+                                                 .on_error([] {
+                                                     std::cerr << "unable to create the semaphore for the "
+                                                                  "relocatable protocol"
+                                                               << std::endl;
+                                                     std::terminate();
+                                                 })
+                                                 .get_value());
+};
+} // namespace iox
+
+#include "iceoryx_utils/internal/communication_channel/protocol/relocatable_protocol.inl"
@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include "iceoryx_utils/cxx/helplets.hpp"
+
+#include <cstdint>
+
 namespace iox
 {
 namespace algorithm
@@ -76,6 +80,69 @@ constexpr T min(const T& left, const T& right) noexcept;
 template <typename T, typename... Targs>
 constexpr T min(const T& left, const T& right, const Targs&... args) noexcept;
 
+/// @brief Returns the minimum gained with operator<() of a contiguous range
+/// @param T type which implements operator<()
+/// @param[in] f_data pointer to the first element of the range
+/// @param[in] f_size number of elements in the range, has to be greater than zero
+/// @return returns the minimum value of the range
+template <typename T>
+T minOfRange(const T* const f_data, const uint64_t f_size) noexcept;
+
+/// @brief Returns the maximum gained with operator<() of a contiguous range
+/// @param T type which implements operator<()
+/// @param[in] f_data pointer to the first element of the range
+/// @param[in] f_size number of elements in the range, has to be greater than zero
+/// @return returns the maximum value of the range
+template <typename T>
+T maxOfRange(const T* const f_data, const uint64_t f_size) noexcept;
+
+/// @brief Returns the sum gained with operator+() of a contiguous range,
+///          the accumulation is performed in T
+/// @param T type which implements operator+()
+/// @param[in] f_data pointer to the first element of the range
+/// @param[in] f_size number of elements in the range
+/// @return returns the sum of the range, T() for an empty range
+template <typename T>
+T sumOfRange(const T* const f_data, const uint64_t f_size) noexcept;
+
+/// @brief Returns the position of the first element in a contiguous range
+///          which is equal to the given value
+/// @param T type which implements operator==()
+/// @param[in] f_data pointer to the first element of the range
+/// @param[in] f_size number of elements in the range
+/// @param[in] f_value value to search for
+/// @return position of the first occurrence, f_size if the range does not
+///          contain the value
+template <typename T>
+uint64_t findInRange(const T* const f_data, const uint64_t f_size, const T& f_value) noexcept;
+
+/// @brief Returns the number of elements in a contiguous range which are
+///          equal to the given value
+/// @param T type which implements operator==()
+/// @param[in] f_data pointer to the first element of the range
+/// @param[in] f_size number of elements in the range
+/// @param[in] f_value value to count
+/// @return number of occurrences of the value in the range
+template <typename T>
+uint64_t countInRange(const T* const f_data, const uint64_t f_size, const T& f_value) noexcept;
+
+/// @brief SIMD overload which processes four floats per step on SSE
+inline float minOfRange(const float* const f_data, const uint64_t f_size) noexcept;
+
+/// @copydoc minOfRange(const float* const, const uint64_t)
+inline float maxOfRange(const float* const f_data, const uint64_t f_size) noexcept;
+
+/// @brief SIMD overload which accumulates four partial sums on SSE; the
+///          summation order differs from the scalar loop which can change the
+///          result in the last float bits
+inline float sumOfRange(const float* const f_data, const uint64_t f_size) noexcept;
+
+/// @brief SIMD overload which compares 16 bytes per step on SSE2
+inline uint64_t findInRange(const uint8_t* const f_data, const uint64_t f_size, const uint8_t f_value) noexcept;
+
+/// @copydoc findInRange(const uint8_t* const, const uint64_t, const uint8_t)
+inline uint64_t countInRange(const uint8_t* const f_data, const uint64_t f_size, const uint8_t f_value) noexcept;
+
 } // namespace algorithm
 } // namespace iox
 
@@ -19,6 +19,8 @@
 
 #include <climits>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <sstream>
@@ -40,6 +42,19 @@ namespace cxx
 /// @endcode
 class convert
 {
+  private:
+    /// integral types which take the fast integer formatting path; the
+    /// character types are excluded since streams format them as characters
+    /// and not as numbers
+    template <typename T>
+    struct IsFastIntegral
+        : std::integral_constant<bool,
+                                 std::is_integral<T>::value && !std::is_same<T, char>::value
+                                     && !std::is_same<T, signed char>::value
+                                     && !std::is_same<T, unsigned char>::value>
+    {
+    };
+
   public:
     enum class NumberType
     {
@@ -54,9 +69,33 @@ class convert
     /// @param[in] t value which should be converted to a string
     /// @return string representation of t
     template <typename Source>
-    static typename std::enable_if<!std::is_convertible<Source, std::string>::value, std::string>::type
+    static typename std::enable_if<!std::is_convertible<Source, std::string>::value
+                                       && !IsFastIntegral<Source>::value,
+                                   std::string>::type
     toString(const Source& t);
 
+    /// @brief Converts an integral value to a string with a branch-lean
+    ///         two-digits-at-a-time formatter; no stream, locale or heap
+    ///         allocation is involved
+    /// @param Source integral type of the value
+    /// @param[in] t value which should be converted to a string
+    /// @return string representation of t
+    template <typename Source>
+    static typename std::enable_if<IsFastIntegral<Source>::value, std::string>::type toString(const Source& t);
+
+    /// @brief Converts a float to a string with snprintf into a stack buffer
+    ///         instead of a stringstream; the output format is identical to
+    ///         the stream default
+    /// @param[in] t value which should be converted to a string
+    /// @return string representation of t
+    static std::string toString(const float t);
+
+    /// @copydoc toString(const float)
+    static std::string toString(const double t);
+
+    /// @copydoc toString(const float)
+    static std::string toString(const long double t);
+
     /// @brief Converts every type which is either a pod (plain old data) type or is convertable
     ///         to a string (this means that the operator std::string() is defined)
     /// @param Source type of the value which should be converted to a string
@@ -80,6 +119,21 @@ class convert
     /// @return true if the given string is a number, otherwise false
     static bool stringIsNumber(const char* v, const NumberType type);
 
+    /// @brief from-chars style parser for unsigned decimal integers; no
+    ///         locale, errno or heap allocation is involved and the whole
+    ///         string has to be consumed
+    /// @param[in] v string which contains the number
+    /// @param[out] value the parsed number
+    /// @return false if v is not a valid number or overflows, otherwise true
+    static bool fromChars(const char* v, uint64_t& value) noexcept;
+
+    /// @brief from-chars style parser for signed decimal integers, accepts a
+    ///         leading + or -
+    /// @param[in] v string which contains the number
+    /// @param[out] value the parsed number
+    /// @return false if v is not a valid number or overflows, otherwise true
+    static bool fromChars(const char* v, int64_t& value) noexcept;
+
   private:
     static bool stringIsNumberWithErrorMessage(const char* v, const NumberType type);
 };
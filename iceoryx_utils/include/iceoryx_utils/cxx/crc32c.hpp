@@ -0,0 +1,34 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace iox
+{
+namespace cxx
+{
+/// @brief CRC32C (Castagnoli polynomial 0x1EDC6F41) of a buffer; uses the
+/// CRC instructions of SSE4.2 or ARMv8 when the CPU provides them, detected
+/// once at runtime, and falls back to a table driven implementation otherwise
+/// @param[in] f_data buffer to checksum
+/// @param[in] f_size size of the buffer in bytes
+/// @param[in] f_seed checksum of the preceding data when checksumming in
+/// chunks, 0 for the first or only chunk
+/// @return the checksum of the buffer
+uint32_t crc32c(const void* const f_data, const uint64_t f_size, const uint32_t f_seed = 0u) noexcept;
+
+} // namespace cxx
+} // namespace iox
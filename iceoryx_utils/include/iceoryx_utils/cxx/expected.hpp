@@ -16,13 +16,32 @@
 
 #include "iceoryx_utils/cxx/variant.hpp"
 
-#include <functional>
+#include <type_traits>
 #include <utility>
 
 namespace iox
 {
 namespace cxx
 {
+namespace internal
+{
+/// @brief verifies in the style of std::is_invocable whether Callable can be
+///         called with ArgTypes, used to select the matching monadic overload
+template <typename Callable, typename... ArgTypes>
+class is_invocable
+{
+  private:
+    template <typename C>
+    static auto test(int) -> decltype(std::declval<C>()(std::declval<ArgTypes>()...), std::true_type());
+    template <typename C>
+    static std::false_type test(...);
+
+  public:
+    using type = decltype(test<Callable>(0));
+    static constexpr bool value = type::value;
+};
+} // namespace internal
+
 /// @brief helper struct to create an expected which is signalling success more easily
 /// @param T type which the success helper class should contain
 /// @code
@@ -206,72 +225,30 @@ class expected<ErrorType>
     /// @return rvalue reference to the internally contained error
     const ErrorType&& get_error() const&& noexcept;
 
-    /// @brief  if the expected does contain an error the given callable is called and
-    ///         a reference to the expected is given as an argument to the callable
+    /// @brief  if the expected does contain an error the given callable is
+    ///         called; the callable can either take a reference to the
+    ///         expected as argument or no argument at all. The callable type
+    ///         is deduced so that no std::function with its potential heap
+    ///         allocation is created
     /// @param[in] callable callable which will be called if the expected contains an error
     /// @return const reference to the expected itself
     /// @code
-    ///     someExpected.on_error([](cxx::expected<int, float> & result){
+    ///     someExpected.on_error([](cxx::expected<float> & result){
     ///         std::cout << "error occured : " << result.get_error() << std::endl;
     ///     })
     /// @endcode
-    const expected& on_error(const std::function<void(expected&)>& callable) const noexcept;
-
-    /// @brief  if the expected does contain an error the given callable is called and
-    ///         a reference to the expected is given as an argument to the callable
-    /// @param[in] callable callable which will be called if the expected contains an error
-    /// @return const reference to the expected itself
-    /// @code
-    ///     someExpected.on_error([](cxx::expected<int, float> & result){
-    ///         std::cout << "error occured : " << result.get_error() << std::endl;
-    ///     })
-    /// @endcode
-    expected& on_error(const std::function<void(expected&)>& callable) noexcept;
-
-    /// @brief  if the expected does contain an error the given callable is called
-    /// @param[in] callable callable which will be called if the expected contains an error
-    /// @return const reference to the expected itself
-    /// @code
-    ///     someExpected.on_error([]{
-    ///         std::cout << "error occured " << std::endl;
-    ///     })
-    /// @endcode
-    const expected& on_error(const std::function<void()>& callable) const noexcept;
-
-    /// @brief  if the expected does contain an error the given callable is called
-    /// @param[in] callable callable which will be called if the expected contains an error
-    /// @return const reference to the expected itself
-    /// @code
-    ///     someExpected.on_error([]{
-    ///         std::cout << "error occured " << std::endl;
-    ///     })
-    /// @endcode
-    expected& on_error(const std::function<void()>& callable) noexcept;
-
-    /// @brief  if the expected does contain a success value the given callable is called and
-    ///         a reference to the expected is given as an argument to the callable
-    /// @param[in] callable callable which will be called if the expected contains a success value
-    /// @return const reference to the expected itself
-    /// @code
-    ///     someExpected.on_success([](cxx::expected<int, float> & result){
-    ///         std::cout << "we are successful" << std::endl;
-    ///     })
-    /// @endcode
-    const expected& on_success(const std::function<void(expected&)>& callable) const noexcept;
-
-    /// @brief  if the expected does contain a success value the given callable is called and
-    ///         a reference to the expected is given as an argument to the callable
-    /// @param[in] callable callable which will be called if the expected contains a success value
-    /// @return const reference to the expected itself
-    /// @code
-    ///     someExpected.on_success([](cxx::expected<int, float> & result){
-    ///         std::cout << "we are successful" << std::endl;
-    ///     })
-    /// @endcode
-    expected& on_success(const std::function<void(expected&)>& callable) noexcept;
-
-    /// @brief  if the expected does contain a success value the given callable is called and
-    ///         a reference to the expected is given as an argument to the callable
+    template <typename Callable>
+    const expected& on_error(const Callable& callable) const noexcept;
+
+    /// @copydoc expected::on_error(const Callable&) const
+    template <typename Callable>
+    expected& on_error(const Callable& callable) noexcept;
+
+    /// @brief  if the expected does contain a success value the given callable
+    ///         is called; the callable can either take a reference to the
+    ///         expected as argument or no argument at all. The callable type
+    ///         is deduced so that no std::function with its potential heap
+    ///         allocation is created
     /// @param[in] callable callable which will be called if the expected contains a success value
     /// @return const reference to the expected itself
     /// @code
@@ -279,22 +256,54 @@ class expected<ErrorType>
     ///         std::cout << "we are successful!" << std::endl;
     ///     })
     /// @endcode
-    const expected& on_success(const std::function<void()>& callable) const noexcept;
-
-    /// @brief  if the expected does contain a success value the given callable is called and
-    ///         a reference to the expected is given as an argument to the callable
-    /// @param[in] callable callable which will be called if the expected contains a success value
-    /// @return const reference to the expected itself
+    template <typename Callable>
+    const expected& on_success(const Callable& callable) const noexcept;
+
+    /// @copydoc expected::on_success(const Callable&) const
+    template <typename Callable>
+    expected& on_success(const Callable& callable) noexcept;
+
+    /// @brief  monadic continuation; if the expected signals success the given
+    ///         callable is called without arguments and the expected which it
+    ///         returns is passed through, otherwise the contained error is
+    ///         moved into the returned expected without calling the callable.
+    ///         Since the callable type is deduced a chain of and_then calls
+    ///         compiles down to the same branches as hand-written if blocks
+    /// @param[in] callable callable which returns an expected with the same error type
+    /// @return the expected returned by the callable or an expected which
+    ///         contains the forwarded error
     /// @code
-    ///     someExpected.on_success([]{
-    ///         std::cout << "we are successful!" << std::endl;
-    ///     })
+    ///     openFile().and_then([&] { return writeHeader(); }).and_then([&] { return writePayload(); })
     /// @endcode
-    expected& on_success(const std::function<void()>& callable) noexcept;
+    template <typename Callable>
+    auto and_then(Callable&& callable) && noexcept -> decltype(callable());
+
+    /// @copydoc expected::and_then(Callable&&) -- lvalue overload, the error is copied instead of moved
+    template <typename Callable>
+    auto and_then(Callable&& callable) & noexcept -> decltype(callable());
+
+    /// @brief  monadic error continuation; if the expected contains an error
+    ///         the given callable is called with the error moved in as
+    ///         argument and the expected which it returns is passed through,
+    ///         otherwise an expected signalling success is returned without
+    ///         calling the callable
+    /// @param[in] callable callable which takes the error and returns an expected
+    /// @return the expected returned by the callable or an expected signalling success
+    template <typename Callable>
+    auto or_else(Callable&& callable) && noexcept -> decltype(callable(std::declval<ErrorType&&>()));
+
+    /// @copydoc expected::or_else(Callable&&) -- lvalue overload, the error is copied instead of moved
+    template <typename Callable>
+    auto or_else(Callable&& callable) & noexcept -> decltype(callable(std::declval<ErrorType&>()));
 
   private:
     expected(variant<ErrorType>&& store, const bool hasError) noexcept;
 
+    template <typename Callable>
+    void invokeCallable(const Callable& callable, std::true_type) noexcept;
+    template <typename Callable>
+    void invokeCallable(const Callable& callable, std::false_type) noexcept;
+
   private:
     variant<ErrorType> m_store;
     bool m_hasError;
@@ -487,8 +496,11 @@ class expected<ValueType, ErrorType>
     template <typename T>
     operator expected<T>() const noexcept;
 
-    /// @brief  if the expected does contain an error the given callable is called and
-    ///         a reference to the expected is given as an argument to the callable
+    /// @brief  if the expected does contain an error the given callable is
+    ///         called; the callable can either take a reference to the
+    ///         expected as argument or no argument at all. The callable type
+    ///         is deduced so that no std::function with its potential heap
+    ///         allocation is created
     /// @param[in] callable callable which will be called if the expected contains an error
     /// @return const reference to the expected itself
     /// @code
@@ -496,41 +508,18 @@ class expected<ValueType, ErrorType>
     ///         std::cout << "error occured : " << result.get_error() << std::endl;
     ///     })
     /// @endcode
-    const expected& on_error(const std::function<void(expected&)>& callable) const noexcept;
-
-    /// @brief  if the expected does contain an error the given callable is called and
-    ///         a reference to the expected is given as an argument to the callable
-    /// @param[in] callable callable which will be called if the expected contains an error
-    /// @return reference to the expected itself
-    /// @code
-    ///     someExpected.on_error([](cxx::expected<int, float> & result){
-    ///         std::cout << "error occured : " << result.get_error() << std::endl;
-    ///     })
-    /// @endcode
-    expected& on_error(const std::function<void(expected&)>& callable) noexcept;
-
-    /// @brief  if the expected does contain an error the given callable is called
-    /// @param[in] callable callable which will be called if the expected contains an error
-    /// @return const reference to the expected itself
-    /// @code
-    ///     someExpected.on_error([]{
-    ///         std::cout << "error occured " << std::endl;
-    ///     })
-    /// @endcode
-    const expected& on_error(const std::function<void()>& callable) const noexcept;
-
-    /// @brief  if the expected does contain an error the given callable is called
-    /// @param[in] callable callable which will be called if the expected contains an error
-    /// @return reference to the expected itself
-    /// @code
-    ///     someExpected.on_error([]{
-    ///         std::cout << "error occured " << std::endl;
-    ///     })
-    /// @endcode
-    expected& on_error(const std::function<void()>& callable) noexcept;
-
-    /// @brief  if the expected does contain a success value the given callable is called and
-    ///         a reference to the expected is given as an argument to the callable
+    template <typename Callable>
+    const expected& on_error(const Callable& callable) const noexcept;
+
+    /// @copydoc expected::on_error(const Callable&) const
+    template <typename Callable>
+    expected& on_error(const Callable& callable) noexcept;
+
+    /// @brief  if the expected does contain a success value the given callable
+    ///         is called; the callable can either take a reference to the
+    ///         expected as argument or no argument at all. The callable type
+    ///         is deduced so that no std::function with its potential heap
+    ///         allocation is created
     /// @param[in] callable callable which will be called if the expected contains a success value
     /// @return const reference to the expected itself
     /// @code
@@ -538,44 +527,58 @@ class expected<ValueType, ErrorType>
     ///         std::cout << "we have a result : " << result.get_value() << std::endl;
     ///     })
     /// @endcode
-    const expected& on_success(const std::function<void(expected&)>& callable) const noexcept;
-
-    /// @brief  if the expected does contain a success value the given callable is called and
-    ///         a reference to the expected is given as an argument to the callable
-    /// @param[in] callable callable which will be called if the expected contains a success value
-    /// @return reference to the expected itself
-    /// @code
-    ///     someExpected.on_success([](cxx::expected<int, float> & result){
-    ///         std::cout << "we have a result : " << result.get_value() << std::endl;
-    ///     })
-    /// @endcode
-    expected& on_success(const std::function<void(expected&)>& callable) noexcept;
-
-    /// @brief  if the expected does contain a success value the given callable is called and
-    ///         a reference to the expected is given as an argument to the callable
-    /// @param[in] callable callable which will be called if the expected contains a success value
-    /// @return const reference to the expected itself
-    /// @code
-    ///     someExpected.on_success([]{
-    ///         std::cout << "we are successful!" << std::endl;
-    ///     })
-    /// @endcode
-    const expected& on_success(const std::function<void()>& callable) const noexcept;
-
-    /// @brief  if the expected does contain a success value the given callable is called and
-    ///         a reference to the expected is given as an argument to the callable
-    /// @param[in] callable callable which will be called if the expected contains a success value
-    /// @return reference to the expected itself
+    template <typename Callable>
+    const expected& on_success(const Callable& callable) const noexcept;
+
+    /// @copydoc expected::on_success(const Callable&) const
+    template <typename Callable>
+    expected& on_success(const Callable& callable) noexcept;
+
+    /// @brief  monadic continuation; if the expected contains a success value
+    ///         the given callable is called with the value moved in as
+    ///         argument and the expected which it returns is passed through,
+    ///         otherwise the contained error is moved into the returned
+    ///         expected without calling the callable. Since the callable type
+    ///         is deduced a chain of and_then calls compiles down to the same
+    ///         branches as hand-written if blocks
+    /// @param[in] callable callable which takes the value and returns an
+    ///                     expected with the same error type
+    /// @return the expected returned by the callable or an expected which
+    ///         contains the forwarded error
     /// @code
-    ///     someExpected.on_success([]{
-    ///         std::cout << "we are successful!" << std::endl;
-    ///     })
+    ///     acquireChunk().and_then([&](Chunk&& chunk) { return fillChunk(std::move(chunk)); })
     /// @endcode
-    expected& on_success(const std::function<void()>& callable) noexcept;
+    template <typename Callable>
+    auto and_then(Callable&& callable) && noexcept -> decltype(callable(std::declval<ValueType&&>()));
+
+    /// @copydoc expected::and_then(Callable&&) -- lvalue overload, value and error are copied instead of moved
+    template <typename Callable>
+    auto and_then(Callable&& callable) & noexcept -> decltype(callable(std::declval<ValueType&>()));
+
+    /// @brief  monadic error continuation; if the expected contains an error
+    ///         the given callable is called with the error moved in as
+    ///         argument and the expected which it returns is passed through,
+    ///         otherwise the success value is moved into the returned expected
+    ///         without calling the callable
+    /// @param[in] callable callable which takes the error and returns an
+    ///                     expected with the same value type
+    /// @return the expected returned by the callable or an expected which
+    ///         contains the forwarded success value
+    template <typename Callable>
+    auto or_else(Callable&& callable) && noexcept -> decltype(callable(std::declval<ErrorType&&>()));
+
+    /// @copydoc expected::or_else(Callable&&) -- lvalue overload, value and error are copied instead of moved
+    template <typename Callable>
+    auto or_else(Callable&& callable) & noexcept -> decltype(callable(std::declval<ErrorType&>()));
 
   private:
     expected(variant<ValueType, ErrorType>&& f_store, const bool hasError) noexcept;
 
+    template <typename Callable>
+    void invokeCallable(const Callable& callable, std::true_type) noexcept;
+    template <typename Callable>
+    void invokeCallable(const Callable& callable, std::false_type) noexcept;
+
   private:
     variant<ValueType, ErrorType> m_store;
     bool m_hasError;
@@ -0,0 +1,116 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/cxx/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace cxx
+{
+/// @brief  C++11 compatible flat map with fixed capacity. The entries are
+///         kept sorted by key in a cxx::vector, lookups are done with a
+///         binary search in O(log n). Like the cxx::vector it does not use
+///         exceptions and can be located fully in the shared memory.
+///         Insertion and erasure move the tail of the storage and are O(n),
+///         the intended use case are registries which are read much more
+///         often than they are modified.
+template <typename Key, typename Value, uint64_t Capacity>
+class flat_map
+{
+  public:
+    struct Entry
+    {
+        Key key;
+        Value value;
+    };
+
+    using iterator = typename vector<Entry, Capacity>::iterator;
+    using const_iterator = typename vector<Entry, Capacity>::const_iterator;
+
+    /// @brief inserts a key value pair if the key is not yet present
+    /// @param [in] key of the new entry
+    /// @param [in] value of the new entry
+    /// @return true if the entry was inserted, false if the map is full or
+    ///         the key is already present
+    bool insert(const Key& key, const Value& value);
+
+    /// @brief inserts a key value pair or assigns the value to an already
+    ///         present key
+    /// @param [in] key of the entry
+    /// @param [in] value to insert or assign
+    /// @return true if the entry was inserted or assigned, false if the map
+    ///         is full
+    bool insert_or_assign(const Key& key, const Value& value);
+
+    /// @brief removes the entry with the given key
+    /// @param [in] key of the entry to remove
+    /// @return true if an entry was removed, false if the key was not present
+    bool erase(const Key& key);
+
+    /// @brief searches the entry with the given key
+    /// @param [in] key to search for
+    /// @return pointer to the value or nullptr if the key is not present
+    Value* find(const Key& key);
+
+    /// @brief searches the entry with the given key
+    /// @param [in] key to search for
+    /// @return const pointer to the value or nullptr if the key is not present
+    const Value* find(const Key& key) const;
+
+    /// @brief checks if an entry with the given key is present
+    /// @param [in] key to search for
+    /// @return true if the key is present, otherwise false
+    bool contains(const Key& key) const;
+
+    /// @brief returns the number of stored entries
+    uint64_t size() const;
+
+    /// @brief returns the capacity which was given via the template argument
+    uint64_t capacity() const;
+
+    /// @brief returns true if the map contains no entries, otherwise false
+    bool empty() const;
+
+    /// @brief removes all entries
+    void clear();
+
+    /// @brief returns an iterator to the first entry, the iteration is
+    ///         sorted by key in ascending order
+    iterator begin();
+
+    /// @brief returns a const iterator to the first entry, the iteration is
+    ///         sorted by key in ascending order
+    const_iterator begin() const;
+
+    /// @brief returns an iterator to the entry which comes after the last one
+    iterator end();
+
+    /// @brief returns a const iterator to the entry which comes after the last one
+    const_iterator end() const;
+
+  private:
+    /// index of the first entry whose key is not less than the given key,
+    /// size() if there is no such entry
+    uint64_t lower_bound(const Key& key) const;
+
+    vector<Entry, Capacity> m_entries;
+};
+} // namespace cxx
+} // namespace iox
+
+#include "iceoryx_utils/internal/cxx/flat_map.inl"
@@ -0,0 +1,84 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/cxx/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace cxx
+{
+/// @brief  C++11 compatible flat set with fixed capacity. The keys are kept
+///         sorted in a cxx::vector, lookups are done with a binary search in
+///         O(log n). Like the cxx::vector it does not use exceptions and can
+///         be located fully in the shared memory.
+///         Insertion and erasure move the tail of the storage and are O(n),
+///         the intended use case are registries which are read much more
+///         often than they are modified.
+template <typename Key, uint64_t Capacity>
+class flat_set
+{
+  public:
+    using iterator = typename vector<Key, Capacity>::iterator;
+    using const_iterator = typename vector<Key, Capacity>::const_iterator;
+
+    /// @brief inserts a key if it is not yet present
+    /// @param [in] key to insert
+    /// @return true if the key was inserted, false if the set is full or the
+    ///         key is already present
+    bool insert(const Key& key);
+
+    /// @brief removes the given key
+    /// @param [in] key to remove
+    /// @return true if the key was removed, false if it was not present
+    bool erase(const Key& key);
+
+    /// @brief checks if the given key is present
+    /// @param [in] key to search for
+    /// @return true if the key is present, otherwise false
+    bool contains(const Key& key) const;
+
+    /// @brief returns the number of stored keys
+    uint64_t size() const;
+
+    /// @brief returns the capacity which was given via the template argument
+    uint64_t capacity() const;
+
+    /// @brief returns true if the set contains no keys, otherwise false
+    bool empty() const;
+
+    /// @brief removes all keys
+    void clear();
+
+    /// @brief returns a const iterator to the first key, the iteration is
+    ///         sorted in ascending order
+    const_iterator begin() const;
+
+    /// @brief returns a const iterator to the key which comes after the last one
+    const_iterator end() const;
+
+  private:
+    /// index of the first key which is not less than the given key,
+    /// size() if there is no such key
+    uint64_t lower_bound(const Key& key) const;
+
+    vector<Key, Capacity> m_keys;
+};
+} // namespace cxx
+} // namespace iox
+
+#include "iceoryx_utils/internal/cxx/flat_set.inl"
@@ -0,0 +1,116 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace iox
+{
+namespace cxx
+{
+template <typename Signature, uint64_t Capacity = 128>
+class inplace_function;
+
+/// @brief  Drop-in replacement for std::function with a fixed size storage
+///         for the callable, following the storage trick of PoorMansHeap.
+///         Assigning a callable never allocates on the heap, a callable which
+///         does not fit into the storage is rejected at compile time.
+///         Intended for hot-path callbacks like receive handlers where the
+///         possible heap allocation and the allocator indirection of
+///         std::function are not acceptable.
+/// @param Signature function signature of the callable, e.g. void(int)
+/// @param Capacity  size of the internal storage in bytes
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+class inplace_function<ReturnType(Args...), Capacity>
+{
+  public:
+    /// @brief creates an empty inplace_function; calling it terminates
+    inplace_function() noexcept = default;
+
+    /// @brief creates an empty inplace_function; calling it terminates
+    inplace_function(std::nullptr_t) noexcept;
+
+    /// @brief creates an inplace_function which stores a copy of the provided
+    ///         callable in the internal storage
+    /// @param [in] callable is the functor, lambda or function pointer to store
+    template <typename Functor,
+              typename = typename std::enable_if<
+                  !std::is_same<typename std::decay<Functor>::type, inplace_function>::value>::type>
+    inplace_function(Functor&& callable) noexcept;
+
+    inplace_function(const inplace_function& rhs) noexcept;
+    inplace_function(inplace_function&& rhs) noexcept;
+    inplace_function& operator=(const inplace_function& rhs) noexcept;
+    inplace_function& operator=(inplace_function&& rhs) noexcept;
+
+    /// @brief drops the stored callable, the inplace_function is empty afterwards
+    inplace_function& operator=(std::nullptr_t) noexcept;
+
+    ~inplace_function() noexcept;
+
+    /// @brief calls the stored callable; if the inplace_function is empty
+    ///         an error message is printed and terminate is called
+    ReturnType operator()(Args... args) const;
+
+    /// @brief returns true if a callable is stored, otherwise false
+    explicit operator bool() const noexcept;
+
+  private:
+    static constexpr uint64_t STORAGE_ALIGNMENT = alignof(void*) * 2u;
+
+    enum class Operation
+    {
+        COPY,
+        MOVE,
+        DESTROY
+    };
+
+    using invoke_t = ReturnType (*)(void* const f_storage, Args&&... f_args);
+    using manage_t = void (*)(const Operation f_operation, void* const f_destination, void* const f_source);
+
+    template <typename Functor>
+    static ReturnType invokeFunctor(void* const f_storage, Args&&... f_args);
+
+    template <typename Functor>
+    static void manageFunctor(const Operation f_operation, void* const f_destination, void* const f_source);
+
+    void reset() noexcept;
+
+    invoke_t m_invoke{nullptr};
+    manage_t m_manage{nullptr};
+    // mutable like the control block of std::function; operator() is const
+    // but may call a mutable lambda
+    alignas(STORAGE_ALIGNMENT) mutable uint8_t m_storage[Capacity];
+};
+
+template <typename Signature, uint64_t Capacity>
+bool operator==(const inplace_function<Signature, Capacity>& lhs, std::nullptr_t) noexcept;
+
+template <typename Signature, uint64_t Capacity>
+bool operator==(std::nullptr_t, const inplace_function<Signature, Capacity>& rhs) noexcept;
+
+template <typename Signature, uint64_t Capacity>
+bool operator!=(const inplace_function<Signature, Capacity>& lhs, std::nullptr_t) noexcept;
+
+template <typename Signature, uint64_t Capacity>
+bool operator!=(std::nullptr_t, const inplace_function<Signature, Capacity>& rhs) noexcept;
+
+} // namespace cxx
+} // namespace iox
+
+#include "iceoryx_utils/internal/cxx/inplace_function.inl"
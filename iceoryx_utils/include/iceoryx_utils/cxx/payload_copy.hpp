@@ -0,0 +1,40 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace iox
+{
+namespace cxx
+{
+/// @brief payload sizes from which copyPayload switches to non-temporal
+/// stores. Payloads of this size do not fit into the caches anyway, writing
+/// them through the cache hierarchy only evicts the working set of the
+/// copying thread
+constexpr uint64_t PAYLOAD_COPY_STREAMING_THRESHOLD{256u * 1024u};
+
+/// @brief copy of a chunk payload; behaves like memcpy but uses non-temporal
+/// (streaming) stores for payloads of PAYLOAD_COPY_STREAMING_THRESHOLD bytes
+/// or more so that large payloads like camera frames do not flush the caches
+/// of the copying process. On targets without streaming store support it
+/// falls back to memcpy for all sizes
+/// @param[in] f_destination destination buffer, must not overlap the source
+/// @param[in] f_source source buffer
+/// @param[in] f_size number of bytes to copy
+void copyPayload(void* const f_destination, const void* const f_source, const uint64_t f_size) noexcept;
+
+} // namespace cxx
+} // namespace iox
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include "iceoryx_utils/cxx/helplets.hpp"
+
 #include <cstddef>
 #include <cstdint>
 #include <utility>
@@ -152,6 +154,139 @@ class PoorMansHeap
     alignas(TypeAlignment) uint8_t m_heap[TypeSize];
 };
 
+namespace internal
+{
+/// @brief returns the zero based position of Type in the Types list, used by
+///         PoorMansHeapVariant to remember which candidate is instantiated
+template <typename Type, typename... Types>
+struct TypeListIndex;
+
+template <typename Type, typename... Types>
+struct TypeListIndex<Type, Type, Types...>
+{
+    static constexpr uint64_t value = 0u;
+};
+
+template <typename Type, typename Other, typename... Types>
+struct TypeListIndex<Type, Other, Types...>
+{
+    static constexpr uint64_t value = 1u + TypeListIndex<Type, Types...>::value;
+};
+
+/// @brief walks the candidate type list until the active index is reached and
+///         calls the visitor with a reference of the concrete type; the chain
+///         of index comparisons is resolved at compile time so no vtable is
+///         involved
+template <typename... Types>
+struct TypeListVisitor;
+
+template <>
+struct TypeListVisitor<>
+{
+    template <typename Visitor>
+    static void visit(const uint64_t, void*, const Visitor&) noexcept
+    {
+    }
+};
+
+template <typename Type, typename... Types>
+struct TypeListVisitor<Type, Types...>
+{
+    template <typename Visitor>
+    static void visit(const uint64_t index, void* heap, const Visitor& visitor) noexcept
+    {
+        if (index == 0u)
+        {
+            visitor(*static_cast<Type*>(heap));
+            return;
+        }
+        TypeListVisitor<Types...>::visit(index - 1u, heap, visitor);
+    }
+};
+} // namespace internal
+
+/// @brief Variadic variant of PoorMansHeap which deduces the required storage
+///         size and alignment from the candidate type list at compile time.
+///         Additionally to the Interface pointer access of PoorMansHeap the
+///         active instance can be visited with its concrete type, so calls in
+///         hot loops can be dispatched without an indirect branch through the
+///         vtable
+/// @param Interface base type of all candidates
+/// @param Types complete list of candidate types which can be instantiated
+///
+/// @code
+///     using FooBar = cxx::PoorMansHeapVariant<Base, Foo, Bar>;
+///
+///     FooBar fooBar{cxx::PoorMansHeapType<Foo>(), 42};
+///     fooBar->doStuff();              // virtual dispatch
+///     fooBar.visit([](auto& concrete) // devirtualized dispatch (C++14 caller)
+///     ...
+///     struct DoStuffVisitor           // or a visitor functor with an
+///     {                               // overload per candidate in C++11
+///         void operator()(Foo& foo) const { foo.doStuff(); }
+///         void operator()(Bar& bar) const { bar.doStuff(); }
+///     };
+///     fooBar.visit(DoStuffVisitor());
+/// @endcode
+template <typename Interface, typename... Types>
+class PoorMansHeapVariant
+{
+  public:
+    PoorMansHeapVariant() = default;
+    ~PoorMansHeapVariant() noexcept;
+
+    /// Constructor for immediate construction of an instance
+    /// @param [in] Type the type to instantiate, wrapped in PoorMansHeapType
+    /// @param [in] ctorArgs ctor arguments for the type to instantiate
+    template <typename Type, typename... CTorArgs>
+    PoorMansHeapVariant(PoorMansHeapType<Type>, CTorArgs&&... ctorArgs) noexcept;
+
+    PoorMansHeapVariant(PoorMansHeapVariant&& other) = delete;
+    PoorMansHeapVariant& operator=(PoorMansHeapVariant&& rhs) = delete;
+
+    PoorMansHeapVariant(const PoorMansHeapVariant&) = delete;
+    PoorMansHeapVariant& operator=(const PoorMansHeapVariant&) = delete;
+
+    /// Create a new instance of the Type, Type has to be a member of the
+    /// candidate type list
+    /// @param [in] Type the type to instantiate, wrapped in PoorMansHeapType
+    /// @param [in] ctorArgs ctor arguments for the type to instantiate
+    template <typename Type, typename... CTorArgs>
+    void newInstance(CTorArgs&&... ctorArgs) noexcept;
+
+    /// Calls the destructor if there is a valid instance, otherwise nothing happens
+    void deleteInstance() noexcept;
+
+    /// Checks is there is a valid instance
+    /// @return true if there is a valid instance
+    bool hasInstance() const noexcept;
+
+    /// Calls the visitor with a reference to the active instance in its
+    /// concrete type; if there is no valid instance nothing happens
+    /// @param [in] visitor callable with an operator() overload for every candidate type
+    template <typename Visitor>
+    void visit(const Visitor& visitor) noexcept;
+
+    /// @copydoc visit(const Visitor&)
+    template <typename Visitor>
+    void visit(const Visitor& visitor) const noexcept;
+
+    /// Returns a pointer to the underlying instance
+    /// @return pointer to the underlying instance or nullptr if there is no valid instance
+    Interface* operator->() const noexcept;
+
+    /// Returns a reference to the underlying instance. If there is no valid instance, the behaviour is undefined
+    /// @return reference to the underlying instance
+    Interface& operator*() const noexcept;
+
+  private:
+    static constexpr uint64_t NO_INSTANCE = sizeof...(Types);
+
+    Interface* m_instance{nullptr};
+    uint64_t m_typeIndex{NO_INSTANCE};
+    alignas(maxAlignment<Types...>()) uint8_t m_heap[maxSize<Types...>()];
+};
+
 } // namespace cxx
 } // namespace iox
 
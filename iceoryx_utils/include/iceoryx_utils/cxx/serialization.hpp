@@ -16,9 +16,12 @@
 
 #include "iceoryx_utils/cxx/convert.hpp"
 
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <sstream>
+#include <type_traits>
 
 namespace iox
 {
@@ -127,6 +130,92 @@ class Serialization
     static bool deserialize(const std::string& serializedString, T& t, Targs&... args) noexcept;
 };
 
+/// @brief Binary backend for the Serialization interface. Instead of
+///         delimited decimal strings the values are written as fixed-width
+///         binary fields into a caller-provided buffer, so a create/extract
+///         cycle is a handful of stores and loads without heap allocation or
+///         integer-to-ASCII conversion.
+///         Trivially copyable types are copied with their native width,
+///         std::string fields are written as a 32 bit length followed by the
+///         characters. The buffer content is only valid for the machine it
+///         was created on (no endianness conversion).
+/// @code
+///     uint8_t buffer[128];
+///     uint64_t writtenSize{0};
+///     if (cxx::BinarySerialization::create(buffer, sizeof(buffer), writtenSize, 123, 12.12f, 'c'))
+///     {
+///         int v1;
+///         float v2;
+///         char v3;
+///         if (cxx::BinarySerialization::extract(buffer, writtenSize, v1, v2, v3))
+///         {
+///             // all values restored
+///         }
+///     }
+/// @endcode
+class BinarySerialization
+{
+  public:
+    /// @brief Serializes the given arguments as fixed-width binary fields
+    ///         into the provided buffer
+    /// @param[in] buffer caller provided buffer for the serialized data
+    /// @param[in] bufferSize size of the provided buffer
+    /// @param[out] writtenSize number of bytes written to the buffer
+    /// @param[in] args list of values to serialize
+    /// @return true if all values fit into the buffer, otherwise false
+    template <typename... Targs>
+    static bool create(uint8_t* const buffer,
+                       const uint64_t bufferSize,
+                       uint64_t& writtenSize,
+                       const Targs&... args) noexcept;
+
+    /// @brief Extracts the values from a buffer written by create and stores
+    ///         them in the given arguments
+    /// @param[in] buffer buffer with the serialized data
+    /// @param[in] bufferSize number of valid bytes in the buffer
+    /// @param[in] args references where the values will be stored in
+    /// @return true if extraction of all values was successful, otherwise false
+    template <typename... Targs>
+    static bool extract(const uint8_t* const buffer, const uint64_t bufferSize, Targs&... args) noexcept;
+
+  private:
+    static bool serialize(uint8_t* const buffer, const uint64_t bufferSize, uint64_t& offset) noexcept;
+
+    template <typename T, typename... Targs>
+    static bool serialize(uint8_t* const buffer,
+                          const uint64_t bufferSize,
+                          uint64_t& offset,
+                          const T& t,
+                          const Targs&... args) noexcept;
+
+    static bool deserialize(const uint8_t* const buffer, const uint64_t bufferSize, uint64_t& offset) noexcept;
+
+    template <typename T, typename... Targs>
+    static bool deserialize(const uint8_t* const buffer,
+                            const uint64_t bufferSize,
+                            uint64_t& offset,
+                            T& t,
+                            Targs&... args) noexcept;
+
+    template <typename T>
+    static typename std::enable_if<std::is_trivially_copyable<T>::value, bool>::type
+    serializeField(uint8_t* const buffer, const uint64_t bufferSize, uint64_t& offset, const T& t) noexcept;
+
+    static bool serializeField(uint8_t* const buffer,
+                               const uint64_t bufferSize,
+                               uint64_t& offset,
+                               const std::string& t) noexcept;
+
+    template <typename T>
+    static typename std::enable_if<std::is_trivially_copyable<T>::value, bool>::type
+    deserializeField(const uint8_t* const buffer, const uint64_t bufferSize, uint64_t& offset, T& t) noexcept;
+
+    static bool deserializeField(const uint8_t* const buffer,
+                                 const uint64_t bufferSize,
+                                 uint64_t& offset,
+                                 std::string& t) noexcept;
+};
+
 } // namespace cxx
 } // namespace iox
 
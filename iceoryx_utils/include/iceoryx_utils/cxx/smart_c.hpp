@@ -55,6 +55,22 @@
                    f_ignoredValues,                                                                                    \
                    __VA_ARGS__)
 
+/// @brief Success path optimized counterpart of makeSmartC with identical
+/// parameters and error semantics. Use it for c function calls in hot paths
+/// (semaphore operations, message queue transfers, ...) where the call
+/// succeeds almost always; the error handling is completely deferred until
+/// the call actually failed, so a successful wrapped call costs no more than
+/// the raw call plus the return value check.
+#define makeLeanSmartC(f_function, f_returnMode, f_returnValues, f_ignoredValues, ...)                                 \
+    makeLeanSmartCImpl(__FILE__,                                                                                       \
+                       __LINE__,                                                                                       \
+                       __PRETTY_FUNCTION__,                                                                            \
+                       f_function,                                                                                     \
+                       f_returnMode,                                                                                   \
+                       f_returnValues,                                                                                 \
+                       f_ignoredValues,                                                                                \
+                       __VA_ARGS__)
+
 /// @todo c function with only one valid value and an infinite number of invalid values are not useable with smart_c
 
 namespace iox
@@ -166,6 +182,63 @@ class SmartC
         const char* func;
     } m_errorSource;
 };
+
+/// @brief Result of a makeLeanSmartC call. Provides the same accessors as
+///         SmartC but stores only the return value and the errno value; no
+///         error string buffer is carried around and the error string is
+///         created on demand in getErrorString. The c function call itself is
+///         performed in makeLeanSmartCImpl so that errno evaluation, the
+///         scan of the ignored values and the error log are only paid when
+///         the call failed.
+template <typename ReturnType>
+class LeanSmartC
+{
+  public:
+    /// @brief Returns the returnValue of the c function call. If an error
+    ///         has occurred the error code is returned.
+    /// @return returnValue of the c call
+    ReturnType getReturnValue() const noexcept;
+
+    /// @brief conversion operator to the return type of the c call
+    /// @return returnValue of the c call
+    operator ReturnType() const noexcept;
+
+    /// @brief If one of the given error codes was returned during the c
+    ///         function call and the c function failed it returns false,
+    ///         otherwise true
+    /// @return false if the c call failed, otherwise true
+    bool hasErrors() const noexcept;
+
+    /// @brief If no error occurred it returns a string like "no errors"
+    ///         (depending on the posix system) otherwise it returns the
+    ///         errnum error string
+    /// @return if the c call failed the result of strerror(errno)
+    const char* getErrorString() const noexcept;
+
+    /// @brief Returns the errnum. 0 if no error has occurred, otherwise != 0
+    /// @return returns the errno value which was set by the c call
+    int getErrNum() const noexcept;
+
+    template <typename Function_F, typename ReturnType_F, typename... FunctionArguments_F>
+    friend LeanSmartC<ReturnType_F> makeLeanSmartCImpl(const char* file,
+                                                       const int line,
+                                                       const char* func,
+                                                       const Function_F& f_function,
+                                                       const ReturnMode& f_mode,
+                                                       const std::initializer_list<ReturnType_F>& f_returnValues,
+                                                       const std::initializer_list<int>& f_ignoredValues,
+                                                       FunctionArguments_F... f_args) noexcept;
+
+  private:
+    /// @brief You should never create a LeanSmartC object directly and should
+    /// always use makeLeanSmartC, therefore the ctor is private
+    LeanSmartC(const ReturnType f_returnValue, const int f_errnum, const bool f_hasErrors) noexcept;
+
+  private:
+    ReturnType m_returnValue;
+    int m_errnum{0};
+    bool m_hasErrors{false};
+};
 } // namespace cxx
 } // namespace iox
 
@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #pragma once
+#include "iceoryx_utils/internal/cxx/string_ops.hpp"
+
 #include <cstring>
 #include <iostream>
 
@@ -34,8 +36,9 @@ class string
     static_assert(Capacity > 0, "The capacity of the fixed string must be greater than 0!");
 
   public:
-    /// @brief creates an empty string with size 0
-    string() noexcept;
+    /// @brief creates an empty string with size 0; a default constructed
+    /// string is a constant expression
+    constexpr string() noexcept = default;
 
     /// @brief copy constructor
     ///
@@ -62,7 +65,7 @@ class string
     string& operator=(string&& rhs) noexcept;
 
     /// @brief destructor
-    ~string() noexcept;
+    ~string() noexcept = default;
 
     /// @brief conversion constructor for char array with compile time check if the array size is lesser than or equal
     /// to the string capacity
@@ -258,6 +261,32 @@ class string
     /// @return true if self is greater than or equal to rhs, otherwise false
     bool operator>=(const string& rhs) const noexcept;
 
+    /// @brief finds the first occurrence of the given character starting at startPosition
+    ///
+    /// @param [in] character is the character to search for
+    /// @param [in] startPosition is the position where the search starts
+    ///
+    /// @return the position of the first occurrence, size() if the character was not found
+    uint64_t find_first_of(const char character, const uint64_t startPosition = 0u) const noexcept;
+
+    /// @brief calculates the FNV-1a hash of the stored characters, e.g. for hash based registry lookups
+    ///
+    /// @return the 64 bit hash of the string
+    uint64_t hash() const noexcept;
+
+    /// @brief calculates the FNV-1a hash of a null terminated string; for a string
+    /// literal this is evaluated at compile time and equals the hash() of a fixed
+    /// string constructed from the same literal, so runtime lookups can start from
+    /// a precomputed constant
+    ///
+    /// @param [in] str is the null terminated string to hash
+    ///
+    /// @return the 64 bit hash of the string
+    static constexpr uint64_t hashOf(const char* const str) noexcept
+    {
+        return internal::hash(str);
+    }
+
     /// @brief returns a pointer to the char array of self
     ///
     /// @return a pointer to the char array of self
@@ -266,12 +295,12 @@ class string
     /// @brief returns the number of characters stored in the string
     ///
     /// @return the number of characters stored in the string
-    uint64_t size() const noexcept;
+    constexpr uint64_t size() const noexcept;
 
     /// @brief returns the maximum number of characters that can be stored in the string
     ///
     /// @return the maximum number of characters that can be stored in the string
-    uint64_t capacity() const noexcept;
+    constexpr uint64_t capacity() const noexcept;
 
     /// @brief converts the string to a std::string
     ///
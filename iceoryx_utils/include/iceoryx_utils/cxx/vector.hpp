@@ -17,6 +17,8 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <type_traits>
 #include <utility>
 
 namespace iox
@@ -139,6 +141,13 @@ class vector
     /// @brief calls the destructor of all contained elements and removes them
     void clear();
 
+    /// @brief resizes the vector to contain count elements; new elements are
+    ///         constructed with the default constructor of T, surplus elements
+    ///         are destructed
+    /// @param [in] count is the new number of elements
+    /// @return true if successful, false if count exceeds the capacity
+    bool resize(const uint64_t count);
+
     /// @brief forwards all arguments to the constructor of the contained element
     ///         and performs a placement new
     template <typename... Targs>
@@ -161,6 +170,15 @@ class vector
     iterator erase(iterator position);
 
   private:
+    /// the true_type overloads are fast paths for trivially copyable types
+    /// which replace the element-wise loops with one memcpy/memmove
+    void copy_assign(const vector& rhs, std::true_type);
+    void copy_assign(const vector& rhs, std::false_type);
+    void move_assign(vector&& rhs, std::true_type);
+    void move_assign(vector&& rhs, std::false_type);
+    void erase_at(const uint64_t index, std::true_type);
+    void erase_at(const uint64_t index, std::false_type);
+
     using element_t = uint8_t[sizeof(T)];
     alignas(alignof(T)) element_t m_data[Capacity];
     uint64_t m_size = 0;
@@ -47,6 +47,7 @@ namespace iox
     error(POSH__SHM_APP_SEGMENT_MAPP_ERR) \
     error(POSH__SHM_APP_SEGMENT_COUNT_OVERFLOW) \
     error(POSH__INTERFACEPORT_CAPRO_MESSAGE_DISMISSED) \
+    error(POSH__RUNTIME_RECEIVER_BATCH_INCOMPLETE) \
     error(POSH__SERVICE_DISCOVERY_INSTANCE_CONTAINER_OVERFLOW) \
     error(POSH__SERVICE_DISCOVERY_FIND_SERVICE_CALLBACKS_CONTAINER_OVERFLOW) \
     error(MEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE) \
@@ -15,6 +15,7 @@
 #pragma once
 
 #include "iceoryx_utils/cxx/vector.hpp"
+#include "iceoryx_utils/internal/cxx/string_ops.hpp"
 
 #include <cstdint>
 #include <cstring>
@@ -59,6 +60,17 @@ class CString100
 
     uint capacity() const;
 
+    //! FNV-1a hash of the stored string, e.g. for hash based registry lookups
+    uint64_t hash() const;
+
+    //! FNV-1a hash of a null terminated string, evaluated at compile time for
+    //! string literals; equals hash() of a CString100 built from the same
+    //! literal, so runtime lookups can start from a precomputed constant
+    static constexpr uint64_t hashOf(const char* const cstring) noexcept
+    {
+        return cxx::internal::hash(cstring);
+    }
+
     const char* to_cstring() const;
 
     explicit operator const char*() const;
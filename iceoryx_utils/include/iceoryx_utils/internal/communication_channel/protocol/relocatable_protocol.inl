@@ -0,0 +1,80 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/communication_channel/protocol/relocatable_protocol.hpp"
+
+namespace iox
+{
+template <typename DataType, uint64_t Capacity>
+inline bool RelocatableProtocol<DataType, Capacity>::Send(const DataType& f_message)
+{
+    PayloadTransport l_transport{iox::relative_ptr<Payload_t>(f_message)};
+    if (m_fifo.push(l_transport))
+    {
+        m_semaphore.post();
+        return true;
+    }
+    return false;
+}
+
+template <typename DataType, uint64_t Capacity>
+inline DataType RelocatableProtocol<DataType, Capacity>::toPointer(const PayloadTransport& f_transport) const
+{
+    return iox::relative_ptr<Payload_t>(f_transport.m_payloadOffset, f_transport.m_segmentId).get();
+}
+
+template <typename DataType, uint64_t Capacity>
+inline cxx::optional<DataType> RelocatableProtocol<DataType, Capacity>::TryReceive()
+{
+    if (m_semaphore.tryWait())
+    {
+        auto l_transport = m_fifo.pop();
+        if (l_transport.has_value())
+        {
+            return toPointer(*l_transport);
+        }
+    }
+    return cxx::nullopt_t();
+}
+
+template <typename DataType, uint64_t Capacity>
+inline cxx::optional<DataType> RelocatableProtocol<DataType, Capacity>::BlockingReceive()
+{
+    if (m_semaphore.wait())
+    {
+        auto l_transport = m_fifo.pop();
+        if (l_transport.has_value())
+        {
+            return toPointer(*l_transport);
+        }
+    }
+    return cxx::nullopt_t();
+}
+
+template <typename DataType, uint64_t Capacity>
+inline cxx::optional<DataType> RelocatableProtocol<DataType, Capacity>::timedReceive(const units::Duration& f_timeout)
+{
+    auto l_timeoutAsTimespec = f_timeout.timespec(units::TimeSpecReference::Epoch);
+    if (m_semaphore.timedWait(&l_timeoutAsTimespec, true))
+    {
+        auto l_transport = m_fifo.pop();
+        if (l_transport.has_value())
+        {
+            return toPointer(*l_transport);
+        }
+    }
+    return cxx::nullopt_t();
+}
+
+} // namespace iox
@@ -0,0 +1,126 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/cxx/optional.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief Epoch based reclamation for lock-free structures. Removing an
+///         element from a lock-free structure does not mean that no reader
+///         holds a reference to it anymore; this component tells the remover
+///         when the grace period has elapsed and the memory of the element
+///         can safely be reused.
+///
+///         Every reader registers once as a participant and brackets each
+///         traversal with enterCriticalSection / leaveCriticalSection. A
+///         remover unlinks the element from the structure, calls retire and
+///         keeps the returned epoch with the element; once isSafeToReclaim
+///         returns true for that epoch no reader can still hold a reference
+///         and the element can be handed back to its pool.
+///
+///         The component contains only fixed size arrays of atomics and no
+///         pointers, it can therefore be placed in shared memory and be used
+///         across processes. A participant which dies inside a critical
+///         section blocks reclamation until its slot is force released with
+///         unregisterParticipant, which the process monitoring has to do for
+///         vanished processes.
+///
+/// @code
+///     concurrent::EpochReclamation<MAX_PROCESS_NUMBER> reclamation;
+///
+///     // reader side
+///     auto participant = reclamation.registerParticipant().value();
+///     reclamation.enterCriticalSection(participant);
+///     // ... traverse the lock-free structure
+///     reclamation.leaveCriticalSection(participant);
+///
+///     // remover side, after unlinking an element
+///     auto epoch = reclamation.retire();
+///     // ... later, e.g. on the next removal or a cleanup pass
+///     if (reclamation.isSafeToReclaim(epoch))
+///     {
+///         // hand the element back to its pool
+///     }
+/// @endcode
+///
+/// @param[in] MaxParticipants maximum number of concurrently registered readers
+template <uint32_t MaxParticipants>
+class EpochReclamation
+{
+    static_assert(2 <= ATOMIC_LLONG_LOCK_FREE, "EpochReclamation is not able to run lock free on this platform");
+
+  public:
+    /// @brief Registers the caller as a reader. Returns the participant
+    ///         index needed for the critical section calls or nullopt when
+    ///         all participant slots are taken.
+    /// @concurrent unrestricted thread safe
+    cxx::optional<uint32_t> registerParticipant();
+
+    /// @brief Releases a participant slot. Must not be called while the
+    ///         participant is inside a critical section, except by a monitor
+    ///         which cleans up after a died process.
+    /// @concurrent unrestricted thread safe
+    void unregisterParticipant(const uint32_t f_index);
+
+    /// @brief Marks the begin of a traversal of the protected structure.
+    ///         References obtained after this call stay valid until
+    ///         leaveCriticalSection.
+    /// @concurrent thread safe per participant index
+    void enterCriticalSection(const uint32_t f_index);
+
+    /// @brief Marks the end of a traversal, all references obtained inside
+    ///         the critical section are invalid afterwards.
+    /// @concurrent thread safe per participant index
+    void leaveCriticalSection(const uint32_t f_index);
+
+    /// @brief Announces the removal of an element and advances the global
+    ///         epoch.
+    /// @return the retirement epoch to be kept with the removed element
+    /// @concurrent unrestricted thread safe
+    uint64_t retire();
+
+    /// @brief Checks whether the grace period of a retirement epoch has
+    ///         elapsed, i.e. no registered reader entered its critical
+    ///         section before the corresponding retire call and is still
+    ///         inside it.
+    /// @param[in] f_retirementEpoch epoch returned by retire
+    /// @concurrent unrestricted thread safe
+    bool isSafeToReclaim(const uint64_t f_retirementEpoch) const;
+
+  private:
+    /// epoch value of a participant which is outside of any critical section
+    static constexpr uint64_t INACTIVE = 0u;
+
+    struct Participant
+    {
+        std::atomic<bool> m_registered{false};
+        std::atomic<uint64_t> m_epoch{INACTIVE};
+    };
+
+    /// the global epoch starts above INACTIVE so that the two can never be
+    /// confused
+    std::atomic<uint64_t> m_globalEpoch{1u};
+    Participant m_participants[MaxParticipants];
+};
+} // namespace concurrent
+} // namespace iox
+
+#include "iceoryx_utils/internal/concurrent/epoch_reclamation.inl"
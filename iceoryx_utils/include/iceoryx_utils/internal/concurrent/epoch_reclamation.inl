@@ -0,0 +1,92 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+namespace iox
+{
+namespace concurrent
+{
+template <uint32_t MaxParticipants>
+inline cxx::optional<uint32_t> EpochReclamation<MaxParticipants>::registerParticipant()
+{
+    for (uint32_t i = 0u; i < MaxParticipants; ++i)
+    {
+        bool expected = false;
+        if (m_participants[i].m_registered.compare_exchange_strong(
+                expected, true, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            return i;
+        }
+    }
+    return cxx::nullopt_t();
+}
+
+template <uint32_t MaxParticipants>
+inline void EpochReclamation<MaxParticipants>::unregisterParticipant(const uint32_t f_index)
+{
+    m_participants[f_index].m_epoch.store(INACTIVE, std::memory_order_release);
+    m_participants[f_index].m_registered.store(false, std::memory_order_release);
+}
+
+template <uint32_t MaxParticipants>
+inline void EpochReclamation<MaxParticipants>::enterCriticalSection(const uint32_t f_index)
+{
+    auto epoch = m_globalEpoch.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        // the seq_cst store/load pair closes the race with retire: either
+        // the announced epoch is visible to the reclaimer, or the advanced
+        // global epoch is visible here and the announcement is retried
+        m_participants[f_index].m_epoch.store(epoch, std::memory_order_seq_cst);
+
+        auto currentEpoch = m_globalEpoch.load(std::memory_order_seq_cst);
+        if (currentEpoch == epoch)
+        {
+            return;
+        }
+        epoch = currentEpoch;
+    }
+}
+
+template <uint32_t MaxParticipants>
+inline void EpochReclamation<MaxParticipants>::leaveCriticalSection(const uint32_t f_index)
+{
+    // the release pairs with the acquire in isSafeToReclaim, all reads of
+    // the protected structure happen before the participant gets inactive
+    m_participants[f_index].m_epoch.store(INACTIVE, std::memory_order_release);
+}
+
+template <uint32_t MaxParticipants>
+inline uint64_t EpochReclamation<MaxParticipants>::retire()
+{
+    // every participant entering afterwards announces an epoch greater than
+    // the returned retirement epoch and can no longer obtain a reference to
+    // the removed element
+    return m_globalEpoch.fetch_add(1u, std::memory_order_seq_cst);
+}
+
+template <uint32_t MaxParticipants>
+inline bool EpochReclamation<MaxParticipants>::isSafeToReclaim(const uint64_t f_retirementEpoch) const
+{
+    for (uint32_t i = 0u; i < MaxParticipants; ++i)
+    {
+        auto epoch = m_participants[i].m_epoch.load(std::memory_order_acquire);
+        if (epoch != INACTIVE && epoch <= f_retirementEpoch)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace concurrent
+} // namespace iox
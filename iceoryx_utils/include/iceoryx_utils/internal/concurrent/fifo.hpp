@@ -22,8 +22,16 @@ namespace iox
 {
 namespace concurrent
 {
+/// @brief padding policy for the fifo indices
+enum class FiFoPadding : uint32_t
+{
+    NONE,      ///< write and read index are adjacent
+    CACHE_LINE ///< write and read index each occupy their own cache line, so
+               ///< that producer and consumer do not false-share one line
+};
+
 /// @brief single pusher single pop'er thread safe fifo
-template <typename ValueType, uint32_t Capacity>
+template <typename ValueType, uint32_t Capacity, FiFoPadding Padding = FiFoPadding::NONE>
 class FiFo
 {
   public:
@@ -32,21 +40,54 @@ class FiFo
     ///         true, otherwise false
     bool push(const ValueType& f_value);
 
+    /// @brief pushes up to f_count values in one pass; the write index is
+    ///         published once for the whole run, so a burst costs one
+    ///         synchronization instead of one per value and the pop side sees
+    ///         the burst in one wakeup
+    /// @param[in] f_values array holding f_count values
+    /// @param[in] f_count number of values to push
+    /// @return number of values pushed, less than f_count when the fifo runs full
+    uint32_t pushBatch(const ValueType* f_values, const uint32_t f_count);
+
     /// @brief returns the oldest value from the fifo and removes it
     /// @return if the fifo was not empty the optional contains the value,
     ///         otherwise it contains a nullopt
     cxx::optional<ValueType> pop();
 
+    /// @brief pops up to f_count of the oldest values in one pass; the read
+    ///         index is published once for the whole run, so a burst costs one
+    ///         synchronization instead of one per value
+    /// @param[out] f_values array with space for f_count elements
+    /// @param[in] f_count maximum number of values to pop
+    /// @return number of valid entries written to f_values, 0 if the fifo is empty
+    uint32_t popBatch(ValueType* f_values, const uint32_t f_count);
+
     /// @brief returns true when the fifo is empty, otherwise false
     bool empty() const;
 
+    /// @brief returns the number of values currently held; a snapshot which can
+    ///         be outdated as soon as it is returned when the other side is active
+    uint64_t size() const;
+
   private:
     bool is_full() const;
 
+  private:
+    static constexpr uint64_t CACHE_LINE_SIZE = 64u;
+    static constexpr uint64_t INDEX_ALIGNMENT =
+        (Padding == FiFoPadding::CACHE_LINE) ? CACHE_LINE_SIZE : alignof(std::atomic<uint64_t>);
+
+    /// the alignment also pads the struct to a multiple of it, with the cache
+    /// line policy the two indices can therefore never share a line
+    struct alignas(INDEX_ALIGNMENT) Index
+    {
+        std::atomic<uint64_t> value{0};
+    };
+
   private:
     ValueType m_data[Capacity];
-    std::atomic<uint64_t> m_write_pos{0};
-    std::atomic<uint64_t> m_read_pos{0};
+    Index m_write_pos;
+    Index m_read_pos;
 };
 
 } // namespace concurrent
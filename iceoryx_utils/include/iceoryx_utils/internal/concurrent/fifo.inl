@@ -18,8 +18,8 @@ namespace iox
 {
 namespace concurrent
 {
-template <class ValueType, uint32_t Capacity>
-inline bool FiFo<ValueType, Capacity>::push(const ValueType& f_param_r)
+template <class ValueType, uint32_t Capacity, FiFoPadding Padding>
+inline bool FiFo<ValueType, Capacity, Padding>::push(const ValueType& f_param_r)
 {
     if (is_full())
     {
@@ -27,29 +27,67 @@ inline bool FiFo<ValueType, Capacity>::push(const ValueType& f_param_r)
     }
     else
     {
-        m_data[m_write_pos.load(std::memory_order_relaxed) % Capacity] = f_param_r;
+        m_data[m_write_pos.value.load(std::memory_order_relaxed) % Capacity] = f_param_r;
 
         // m_write_pos must be increased after writing the new value otherwise
-        // it is possible that the value is read by pop while it is written
-        m_write_pos.fetch_add(1, std::memory_order_acq_rel);
+        // it is possible that the value is read by pop while it is written;
+        // the owning thread can read its own index relaxed, the release pairs
+        // with the acquire of the write index in pop
+        m_write_pos.value.store(m_write_pos.value.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
         return true;
     }
 }
 
-template <class ValueType, uint32_t Capacity>
-inline bool FiFo<ValueType, Capacity>::is_full() const
+template <class ValueType, uint32_t Capacity, FiFoPadding Padding>
+inline uint32_t FiFo<ValueType, Capacity, Padding>::pushBatch(const ValueType* f_values, const uint32_t f_count)
 {
-    return m_write_pos.load(std::memory_order_relaxed) == m_read_pos.load(std::memory_order_relaxed) + Capacity;
+    uint64_t writePosition = m_write_pos.value.load(std::memory_order_relaxed);
+    // the acquire on the read index ensures that the pop'ed values were fully
+    // read out before their slots are overwritten, same as in is_full
+    uint64_t free = Capacity - (writePosition - m_read_pos.value.load(std::memory_order_acquire));
+    uint64_t pushedCount = (free < f_count) ? free : f_count;
+
+    for (uint64_t i = 0u; i < pushedCount; ++i)
+    {
+        m_data[(writePosition + i) % Capacity] = f_values[i];
+    }
+
+    if (pushedCount > 0u)
+    {
+        // the whole run is committed with a single store; the release pairs
+        // with the acquire of the write index in pop
+        m_write_pos.value.store(writePosition + pushedCount, std::memory_order_release);
+    }
+
+    return static_cast<uint32_t>(pushedCount);
+}
+
+template <class ValueType, uint32_t Capacity, FiFoPadding Padding>
+inline bool FiFo<ValueType, Capacity, Padding>::is_full() const
+{
+    // the acquire on the read index ensures that the pop'ed value was fully
+    // read out before the slot is overwritten by push
+    return m_write_pos.value.load(std::memory_order_relaxed)
+           == m_read_pos.value.load(std::memory_order_acquire) + Capacity;
 }
 
-template <class ValueType, uint32_t Capacity>
-inline bool FiFo<ValueType, Capacity>::empty() const
+template <class ValueType, uint32_t Capacity, FiFoPadding Padding>
+inline bool FiFo<ValueType, Capacity, Padding>::empty() const
 {
-    return m_read_pos.load(std::memory_order_relaxed) == m_write_pos.load(std::memory_order_relaxed);
+    // the acquire on the write index ensures that the pushed value is visible
+    // before it is read out in pop
+    return m_read_pos.value.load(std::memory_order_relaxed)
+           == m_write_pos.value.load(std::memory_order_acquire);
 }
 
-template <class ValueType, uint32_t Capacity>
-inline cxx::optional<ValueType> FiFo<ValueType, Capacity>::pop()
+template <typename ValueType, uint32_t Capacity, FiFoPadding Padding>
+inline uint64_t FiFo<ValueType, Capacity, Padding>::size() const
+{
+    return m_write_pos.value.load(std::memory_order_acquire) - m_read_pos.value.load(std::memory_order_relaxed);
+}
+
+template <class ValueType, uint32_t Capacity, FiFoPadding Padding>
+inline cxx::optional<ValueType> FiFo<ValueType, Capacity, Padding>::pop()
 {
     if (empty())
     {
@@ -57,13 +95,39 @@ inline cxx::optional<ValueType> FiFo<ValueType, Capacity>::pop()
     }
     else
     {
-        ValueType out = m_data[m_read_pos.load(std::memory_order_acquire) % Capacity];
+        ValueType out = m_data[m_read_pos.value.load(std::memory_order_relaxed) % Capacity];
 
         // m_read_pos must be increased after reading the pop'ed value otherwise
-        // it is possible that the pop'ed value is overwritten by push while it is read
-        m_read_pos.fetch_add(1, std::memory_order_relaxed);
+        // it is possible that the pop'ed value is overwritten by push while it
+        // is read; the release pairs with the acquire of the read index in
+        // is_full
+        m_read_pos.value.store(m_read_pos.value.load(std::memory_order_relaxed) + 1u, std::memory_order_release);
         return out;
     }
 }
+template <class ValueType, uint32_t Capacity, FiFoPadding Padding>
+inline uint32_t FiFo<ValueType, Capacity, Padding>::popBatch(ValueType* f_values, const uint32_t f_count)
+{
+    uint64_t readPosition = m_read_pos.value.load(std::memory_order_relaxed);
+    // the acquire on the write index ensures that the pushed values are visible
+    // before they are read out, same as in empty
+    uint64_t available = m_write_pos.value.load(std::memory_order_acquire) - readPosition;
+    uint64_t poppedCount = (available < f_count) ? available : f_count;
+
+    for (uint64_t i = 0u; i < poppedCount; ++i)
+    {
+        f_values[i] = m_data[(readPosition + i) % Capacity];
+    }
+
+    if (poppedCount > 0u)
+    {
+        // the whole run is committed with a single store; the release pairs
+        // with the acquire of the read index in is_full
+        m_read_pos.value.store(readPosition + poppedCount, std::memory_order_release);
+    }
+
+    return static_cast<uint32_t>(poppedCount);
+}
+
 } // namespace concurrent
 } // namespace iox
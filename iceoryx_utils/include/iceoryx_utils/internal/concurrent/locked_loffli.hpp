@@ -27,23 +27,45 @@ namespace concurrent
 {
 class LockedLoFFLi
 {
+  public:
+    /// default adaptive spin limit of the access mutex; the critical
+    /// sections here are a handful of loads and stores, so spinning a while
+    /// before parking on the futex is almost always cheaper
+    static constexpr uint32_t DEFAULT_ADAPTIVE_SPIN_LIMIT = 100u;
+
   private:
     uint32_t m_size{0};
     uint32_t m_head{0};
     uint32_t* m_freeIndices{nullptr};
 
     using mutex_t = posix::mutex;
-    mutable cxx::optional<mutex_t> m_accessMutex = posix::mutex::CreateMutex(false);
+    mutable cxx::optional<mutex_t> m_accessMutex = posix::mutex::CreateMutex(false, DEFAULT_ADAPTIVE_SPIN_LIMIT);
 
     uint32_t m_invalidIndex{0};
 
   public:
     LockedLoFFLi() = default;
+
+    /// Creates a LockedLoFFLi with a tuned adaptive spin limit; 0 parks
+    /// immediately on contention
+    /// @param [in] f_adaptiveSpinLimit number of lock attempts before parking
+    explicit LockedLoFFLi(const uint32_t f_adaptiveSpinLimit)
+        : m_accessMutex(posix::mutex::CreateMutex(false, f_adaptiveSpinLimit))
+    {
+    }
     /// Initializes the lock-free free-list
     /// @param [in] f_freeIndicesMemory pointer to a memory with the size calculated by requiredMemorySize()
     /// @param [in] f_size is the number of elements of the free-list; must be the same used at requiredMemorySize()
     void init(cxx::not_null<uint32_t*> f_freeIndicesMemory, const uint32_t f_size);
 
+    /// Initializes the free-list with reserved capacity beyond the initially free
+    /// elements; indices in [f_initialSize, f_capacity) start out as "in use" and can
+    /// be fed into the free-list later via push
+    /// @param [in] f_freeIndicesMemory pointer to a memory with the size calculated by requiredMemorySize(f_capacity)
+    /// @param [in] f_initialSize number of initially free elements
+    /// @param [in] f_capacity maximum number of elements of the free-list
+    void init(cxx::not_null<uint32_t*> f_freeIndicesMemory, const uint32_t f_initialSize, const uint32_t f_capacity);
+
     /// Pop a value from the free-list
     /// @param [out] index for an element to use
     /// @return true if index is valid, false otherwise
@@ -54,6 +76,18 @@ class LockedLoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const uint32_t index);
 
+    /// Pop up to f_count values from the free-list under a single lock acquisition
+    /// @param [out] f_indices array with space for f_count elements
+    /// @param [in] f_count maximum number of indices to pop
+    /// @return the number of valid entries written to f_indices, 0 if the free-list is empty
+    uint32_t popBatch(uint32_t* f_indices, const uint32_t f_count);
+
+    /// Push previously poped elements under a single lock acquisition
+    /// @param [in] f_indices array of f_count distinct, previously poped indices
+    /// @param [in] f_count number of indices to push
+    /// @return true if all indices were valid and not yet pushed, false otherwise
+    bool pushBatch(const uint32_t* f_indices, const uint32_t f_count);
+
     /// Calculates the required memory size for a free-list
     /// @param [in] f_size is the number of elements of the free-list
     /// @return the required memory size for a free-list with f_size elements
@@ -28,11 +28,22 @@ class LoFFLi
 {
   private:
     /// @todo std::atomic_is_lock_free check
+#ifdef IOX_LOFFLI_DWCAS
+    /// 128 bit head for platforms with a double-width CAS (e.g. cmpxchg16b); the wide
+    /// ABA counter does not wrap even in long soak runs with heavy chunk recycling and
+    /// the index field no longer limits the free-list to 32 bit sizes
+    struct alignas(16) Node
+    {
+        uint64_t indexToNextFreeIndex;
+        uint64_t abaCounter;
+    };
+#else
     struct alignas(8) Node
     {
         uint32_t indexToNextFreeIndex;
         uint32_t abaCounter;
     };
+#endif
 
     /// @todo introduce typesafe indices with the properties listed below
     ///       id is required that not two loefflis with the same properties
@@ -61,6 +72,8 @@ class LoFFLi
     uint32_t m_invalidIndex{0u};
     std::atomic<Node> m_head{{0u, 1u}};
     iox::relative_ptr<uint32_t> m_nextFreeIndex;
+    std::atomic<uint64_t> m_popRetries{0u};
+    std::atomic<uint64_t> m_pushRetries{0u};
 
   public:
     LoFFLi() = default;
@@ -72,6 +85,15 @@ class LoFFLi
     /// @param [in] f_size is the number of elements of the free-list; must be the same used at requiredMemorySize()
     void init(cxx::not_null<uint32_t*> f_freeIndicesMemory, const uint32_t f_size);
 
+    /// Initializes the lock-free free-list with reserved capacity beyond the initially
+    /// free elements. Indices in [f_initialSize, f_capacity) start out as "in use" and
+    /// can be fed into the free-list later via push, which allows growing a mempool at
+    /// runtime into pre-reserved memory
+    /// @param [in] f_freeIndicesMemory pointer to a memory with the size calculated by requiredMemorySize(f_capacity)
+    /// @param [in] f_initialSize number of initially free elements
+    /// @param [in] f_capacity maximum number of elements of the free-list
+    void init(cxx::not_null<uint32_t*> f_freeIndicesMemory, const uint32_t f_initialSize, const uint32_t f_capacity);
+
     /// Pop a value from the free-list
     /// @param [out] index for an element to use
     /// @return true if index is valid, false otherwise
@@ -82,6 +104,34 @@ class LoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const uint32_t index);
 
+    /// Pop up to f_count values from the free-list by detaching a run of it with a
+    /// single CAS, which makes burst allocation considerably cheaper than f_count
+    /// individual pop calls
+    /// @param [out] f_indices array with space for f_count elements
+    /// @param [in] f_count maximum number of indices to pop
+    /// @return the number of valid entries written to f_indices, 0 if the free-list is empty
+    uint32_t popBatch(uint32_t* f_indices, const uint32_t f_count);
+
+    /// Push previously poped elements by splicing them into the free-list with a
+    /// single CAS
+    /// @param [in] f_indices array of f_count distinct, previously poped indices
+    /// @param [in] f_count number of indices to push
+    /// @return true if all indices were valid and not yet pushed, false otherwise
+    bool pushBatch(const uint32_t* f_indices, const uint32_t f_count);
+
+    /// Number of CAS retries spent in pop and popBatch since init. The counter only
+    /// changes when several threads pop concurrently, so it is a cheap measure for the
+    /// contention on the free-list; it is maintained with relaxed atomics off the
+    /// success path and costs nothing in the uncontended case
+    /// @return accumulated number of failed CAS attempts
+    uint64_t getPopRetries() const;
+
+    /// Number of CAS retries spent in push and pushBatch since init, the counterpart
+    /// to getPopRetries() for the release side of the free-list. A growing value means
+    /// several threads free chunks concurrently or a freeing thread races with poppers
+    /// @return accumulated number of failed CAS attempts
+    uint64_t getPushRetries() const;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] f_size is the number of elements of the free-list
     /// @return the required memory size for a free-list with f_size elements
@@ -0,0 +1,69 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/cxx/optional.hpp"
+
+#include <atomic>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief bounded lock-free multi pusher multi pop'er queue. Each slot
+///         carries a sequence counter on which the producers and consumers
+///         synchronize, so neither side needs a lock. The queue contains no
+///         pointers and can therefore be placed in shared memory
+template <typename ValueType, uint32_t Capacity>
+class MpmcQueue
+{
+    /// with a single slot the sequence counter of a filled slot is equal to
+    /// the one of a freed slot of the next round, which breaks the full
+    /// detection; the slot sequence scheme needs at least two slots
+    static_assert(Capacity > 1u, "The MpmcQueue must have a capacity of at least two elements!");
+
+  public:
+    MpmcQueue();
+
+    /// @brief pushes a value into the queue, can be called concurrently
+    /// @return if the value was pushed successfully into the queue it returns
+    ///         true, otherwise false
+    bool push(const ValueType& f_value);
+
+    /// @brief returns the oldest value from the queue and removes it, can be
+    ///         called concurrently
+    /// @return if the queue was not empty the optional contains the value,
+    ///         otherwise it contains a nullopt
+    cxx::optional<ValueType> pop();
+
+    /// @brief returns true when the queue is empty, otherwise false
+    bool empty() const;
+
+  private:
+    struct Slot
+    {
+        std::atomic<uint64_t> m_sequence{0};
+        ValueType m_value;
+    };
+
+    Slot m_data[Capacity];
+    std::atomic<uint64_t> m_write_pos{0};
+    std::atomic<uint64_t> m_read_pos{0};
+};
+
+} // namespace concurrent
+} // namespace iox
+
+#include "iceoryx_utils/internal/concurrent/mpmc_queue.inl"
@@ -0,0 +1,111 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/internal/concurrent/mpmc_queue.hpp"
+
+namespace iox
+{
+namespace concurrent
+{
+template <typename ValueType, uint32_t Capacity>
+inline MpmcQueue<ValueType, Capacity>::MpmcQueue()
+{
+    // a slot is free for position p when its sequence is p and occupied when
+    // its sequence is p + 1; initially every slot is free for its first use
+    for (uint64_t i = 0; i < Capacity; ++i)
+    {
+        m_data[i].m_sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename ValueType, uint32_t Capacity>
+inline bool MpmcQueue<ValueType, Capacity>::push(const ValueType& f_value)
+{
+    uint64_t l_pos = m_write_pos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        Slot& l_slot = m_data[l_pos % Capacity];
+        const uint64_t l_sequence = l_slot.m_sequence.load(std::memory_order_acquire);
+        const int64_t l_diff = static_cast<int64_t>(l_sequence) - static_cast<int64_t>(l_pos);
+
+        if (l_diff == 0)
+        {
+            // the slot is free; try to claim the position, another producer
+            // can be faster in which case we retry with the updated position
+            if (m_write_pos.compare_exchange_weak(l_pos, l_pos + 1, std::memory_order_relaxed))
+            {
+                l_slot.m_value = f_value;
+
+                // the sequence must be set after writing the value, it
+                // signals the consumers that the slot can be read
+                l_slot.m_sequence.store(l_pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (l_diff < 0)
+        {
+            // the slot still holds a value which was not consumed yet
+            return false;
+        }
+        else
+        {
+            l_pos = m_write_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename ValueType, uint32_t Capacity>
+inline cxx::optional<ValueType> MpmcQueue<ValueType, Capacity>::pop()
+{
+    uint64_t l_pos = m_read_pos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        Slot& l_slot = m_data[l_pos % Capacity];
+        const uint64_t l_sequence = l_slot.m_sequence.load(std::memory_order_acquire);
+        const int64_t l_diff = static_cast<int64_t>(l_sequence) - static_cast<int64_t>(l_pos + 1);
+
+        if (l_diff == 0)
+        {
+            // the slot holds a value; try to claim the position, another
+            // consumer can be faster in which case we retry
+            if (m_read_pos.compare_exchange_weak(l_pos, l_pos + 1, std::memory_order_relaxed))
+            {
+                ValueType out = l_slot.m_value;
+
+                // mark the slot as free for the producer which will wrap
+                // around to this position
+                l_slot.m_sequence.store(l_pos + Capacity, std::memory_order_release);
+                return out;
+            }
+        }
+        else if (l_diff < 0)
+        {
+            // the slot was not written yet
+            return cxx::nullopt_t();
+        }
+        else
+        {
+            l_pos = m_read_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename ValueType, uint32_t Capacity>
+inline bool MpmcQueue<ValueType, Capacity>::empty() const
+{
+    return m_read_pos.load(std::memory_order_relaxed) == m_write_pos.load(std::memory_order_relaxed);
+}
+
+} // namespace concurrent
+} // namespace iox
@@ -0,0 +1,100 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief Reader writer lock built from NumberOfShards plain mutexe. A
+///         reader hashes its thread id onto one shard and only locks that
+///         one, so readers on different shards never touch the same cache
+///         line and scale across cores; a writer acquires all shards in
+///         order. This trades expensive writes for cheap reads and is meant
+///         for read mostly structures like registries; it can be used as a
+///         locking policy for concurrent::smart_lock whose read scope guard
+///         then uses lock_shared.
+template <uint32_t NumberOfShards>
+class sharded_mutex
+{
+    static_assert(NumberOfShards > 0u, "The sharded mutex must have at least one shard!");
+
+  public:
+    /// @brief Acquires all shards in index order, blocking out every reader.
+    void lock()
+    {
+        for (uint32_t i = 0u; i < NumberOfShards; ++i)
+        {
+            m_shards[i].lock();
+        }
+    }
+
+    /// @brief Releases all shards in reverse order.
+    void unlock()
+    {
+        for (uint32_t i = NumberOfShards; i > 0u; --i)
+        {
+            m_shards[i - 1u].unlock();
+        }
+    }
+
+    /// @brief Tries to acquire all shards; if one of them is held the
+    ///         already acquired ones are released again and false is
+    ///         returned, otherwise true.
+    bool try_lock()
+    {
+        for (uint32_t i = 0u; i < NumberOfShards; ++i)
+        {
+            if (!m_shards[i].try_lock())
+            {
+                for (uint32_t j = i; j > 0u; --j)
+                {
+                    m_shards[j - 1u].unlock();
+                }
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief Acquires only the shard the calling thread hashes onto;
+    ///         readers on different shards run concurrently.
+    void lock_shared()
+    {
+        m_shards[shardOfThisThread()].lock();
+    }
+
+    /// @brief Releases the shard the calling thread hashes onto; must be
+    ///         called from the thread which called lock_shared.
+    void unlock_shared()
+    {
+        m_shards[shardOfThisThread()].unlock();
+    }
+
+  private:
+    uint32_t shardOfThisThread() const
+    {
+        return static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id()) % NumberOfShards);
+    }
+
+    std::mutex m_shards[NumberOfShards];
+};
+} // namespace concurrent
+} // namespace iox
@@ -62,6 +62,19 @@ class smart_lock
         MutexType* lock;
     };
 
+    class ReadProxy
+    {
+      public:
+        ReadProxy(const T* base, MutexType* lock);
+        ~ReadProxy();
+
+        const T* operator->() const;
+
+      private:
+        const T* base;
+        MutexType* lock;
+    };
+
   public:
     smart_lock();
     smart_lock(const T& t);
@@ -105,6 +118,22 @@ class smart_lock
     ///     }
     Proxy GetScopeGuard();
 
+    /// @brief Like GetScopeGuard but only grants read access to the base
+    ///         object. If MutexType supports shared locking (lock_shared,
+    ///         e.g. posix::shared_mutex or concurrent::sharded_mutex) the
+    ///         lock is taken shared and multiple readers can access the
+    ///         base object concurrently; with an exclusive mutex it falls
+    ///         back to the normal lock.
+    /// @code
+    ///     iox::concurrent::smart_lock<std::vector<int>, iox::posix::shared_mutex> threadSafeVector;
+    ///
+    ///     {
+    ///         auto vectorGuard = threadSafeVector.GetReadScopeGuard();
+    ///         auto size = vectorGuard->size(); // lookups of other threads can run in parallel
+    ///     }
+    /// @endcode
+    ReadProxy GetReadScopeGuard();
+
   private:
     T base;
     MutexType lock;
@@ -18,6 +18,36 @@ namespace iox
 {
 namespace concurrent
 {
+namespace internal
+{
+/// dispatches to the shared locking methods when the mutex supports them,
+/// otherwise it falls back to the exclusive ones; the int overload wins by
+/// overload resolution whenever it is well formed
+template <typename MutexType>
+inline auto lock_shared_or_exclusive(MutexType* lock, int) -> decltype(lock->lock_shared(), void())
+{
+    lock->lock_shared();
+}
+
+template <typename MutexType>
+inline void lock_shared_or_exclusive(MutexType* lock, char)
+{
+    lock->lock();
+}
+
+template <typename MutexType>
+inline auto unlock_shared_or_exclusive(MutexType* lock, int) -> decltype(lock->unlock_shared(), void())
+{
+    lock->unlock_shared();
+}
+
+template <typename MutexType>
+inline void unlock_shared_or_exclusive(MutexType* lock, char)
+{
+    lock->unlock();
+}
+} // namespace internal
+
 template <typename T, typename MutexType, typename... Targs>
 smart_lock<T, MutexType> make_smart_lock(Targs&&... args)
 {
@@ -94,6 +124,26 @@ T* smart_lock<T, MutexType>::Proxy::operator->()
     return base;
 }
 
+template <typename T, typename MutexType>
+smart_lock<T, MutexType>::ReadProxy::ReadProxy(const T* base, MutexType* lock)
+    : base(base)
+    , lock(lock)
+{
+    internal::lock_shared_or_exclusive(lock, 0);
+}
+
+template <typename T, typename MutexType>
+smart_lock<T, MutexType>::ReadProxy::~ReadProxy()
+{
+    internal::unlock_shared_or_exclusive(lock, 0);
+}
+
+template <typename T, typename MutexType>
+const T* smart_lock<T, MutexType>::ReadProxy::operator->() const
+{
+    return base;
+}
+
 template <typename T, typename MutexType>
 typename smart_lock<T, MutexType>::Proxy smart_lock<T, MutexType>::operator->()
 {
@@ -106,6 +156,12 @@ typename smart_lock<T, MutexType>::Proxy smart_lock<T, MutexType>::GetScopeGuard
     return Proxy(&base, &lock);
 }
 
+template <typename T, typename MutexType>
+typename smart_lock<T, MutexType>::ReadProxy smart_lock<T, MutexType>::GetReadScopeGuard()
+{
+    return ReadProxy(&base, &lock);
+}
+
 
 } // namespace concurrent
 } // namespace iox
@@ -0,0 +1,123 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief Double buffered, seqlock guarded snapshot of a value. A single
+///         writer updates the snapshot in place and any number of readers
+///         sample it without costing the writer any per reader work, which
+///         makes it suitable for state that is published once and observed
+///         by an unknown number of consumers (e.g. monitoring data in a
+///         shared memory segment). The writer alternates between the two
+///         buffers, so a reader is only disturbed when the writer laps it
+///         with two complete updates during one copy; a reader running
+///         concurrently to a single update samples the stable buffer
+///         without retrying.
+/// @code
+///     concurrent::SnapshotBuffer<MyState> snapshot; // writer side
+///     snapshot.write(state);
+///
+///     MyState copy;                                 // reader side
+///     if (snapshot.read(copy))
+///     {
+///         // copy holds the latest consistent snapshot
+///     }
+/// @endcode
+template <typename T>
+class SnapshotBuffer
+{
+  public:
+    /// @brief updates the snapshot with a copy of the given value; must only
+    ///         be called from one thread at a time
+    /// @param[in] f_value value the snapshot is updated with
+    void write(const T& f_value)
+    {
+        update([&](T& f_buffer) { f_buffer = f_value; });
+    }
+
+    /// @brief updates the snapshot in place; the callable gets a reference to
+    ///         the inactive buffer and can fill it without an intermediate
+    ///         copy, which avoids large stack allocations for big payloads.
+    ///         The buffer contains the state of two updates ago, the callable
+    ///         has to overwrite it completely. Must only be called from one
+    ///         thread at a time
+    /// @param[in] f_writer callable with the signature void(T&)
+    template <typename WriterCallable>
+    void update(const WriterCallable& f_writer)
+    {
+        const uint64_t l_sequence = m_sequence.load(std::memory_order_relaxed);
+        // announce the write; an odd sequence tells the readers which buffer
+        // is unstable. The fence keeps the buffer writes behind the announcement
+        m_sequence.store(l_sequence + 1u, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        const uint64_t l_writeNumber = (l_sequence >> 1) + 1u;
+        f_writer(m_buffers[l_writeNumber & 1u]);
+
+        m_sequence.store(l_sequence + 2u, std::memory_order_release);
+    }
+
+    /// @brief samples the latest consistent snapshot; lock-free towards the
+    ///         writer, retries only when the writer completed two updates
+    ///         while the copy was in progress
+    /// @param[out] f_value filled with the snapshot content
+    /// @return true if a snapshot was read, false if nothing was written yet
+    bool read(T& f_value) const
+    {
+        uint64_t l_sequence = m_sequence.load(std::memory_order_acquire);
+        while (true)
+        {
+            const uint64_t l_completedWrites = l_sequence >> 1;
+            if (0u == l_completedWrites)
+            {
+                return false;
+            }
+
+            f_value = m_buffers[l_completedWrites & 1u];
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint64_t l_check = m_sequence.load(std::memory_order_relaxed);
+            // the copied buffer is written again by write number
+            // l_completedWrites + 2 which starts at the sequence below; any
+            // sequence before that leaves the copy untouched
+            if (l_check < 2u * (l_completedWrites + 1u) + 1u)
+            {
+                return true;
+            }
+            l_sequence = l_check;
+        }
+    }
+
+    /// @return true if the snapshot was written at least once
+    bool hasContent() const
+    {
+        return m_sequence.load(std::memory_order_relaxed) != 0u;
+    }
+
+  private:
+    // even = number of completed writes times two, odd = write in progress;
+    // write number n goes into buffer n modulo 2
+    std::atomic<uint64_t> m_sequence{0u};
+    T m_buffers[2];
+};
+
+} // namespace concurrent
+} // namespace iox
@@ -102,6 +102,29 @@ class SoFi
     /// @return false if sofi is empty, otherwise true
     bool pop(ValueType& valueOut) noexcept;
 
+    /// @brief pushes a run of elements; the new write position is published
+    ///         with a single store after the whole run was written, so the
+    ///         synchronization cost is paid once per batch instead of once
+    ///         per element
+    /// @param[in] f_values elements which should be stored
+    /// @param[in] f_count number of elements in f_values
+    /// @param[out] f_overflowValues storage for overwritten elements, must
+    ///             provide space for f_count elements
+    /// @concurrent restricted thread safe: single pop, single push no
+    ///             push calls from multiple contexts
+    /// @return number of overwritten elements stored in f_overflowValues
+    uint32_t pushBatch(const ValueType* f_values, const uint32_t f_count, ValueType* f_overflowValues) noexcept;
+
+    /// @brief pops a run of the oldest elements; the new read position is
+    ///         published with a single compare and swap for the whole run
+    /// @param[out] f_values storage of the pop'ed values, must provide space
+    ///             for f_count elements
+    /// @param[in] f_count maximum number of elements to pop
+    /// @concurrent restricted thread safe: single pop, single push no
+    ///             pop or popIf calls from multiple contexts
+    /// @return number of pop'ed elements, 0 if sofi is empty
+    uint32_t popBatch(ValueType* f_values, const uint32_t f_count) noexcept;
+
     /// @brief conditional pop call to provide an alternative for a peek
     ///         and pop approach. If the verificator returns true the
     ///         peeked element is returned.
@@ -145,6 +168,15 @@ class SoFi
     /// @concurrent unrestricted thread safe
     uint64_t size() const noexcept;
 
+    /// @brief number of read index conflicts since creation, i.e. failed compare
+    ///         and swap attempts on the read position. Conflicts only occur when
+    ///         the push thread overflows while the pop thread reads, so this is
+    ///         a cheap measure for how often producer and consumer collide; the
+    ///         counter is maintained with relaxed atomics off the success path
+    ///         and costs nothing in the conflict free case
+    /// @concurrent unrestricted thread safe
+    uint64_t getIndexConflicts() const noexcept;
+
   private:
     ValueType m_data[INTERNAL_SOFI_SIZE];
     uint64_t m_size = INTERNAL_SOFI_SIZE;
@@ -153,6 +185,7 @@ class SoFi
     /// reordered (read or written too late)
     std::atomic<uint64_t> m_readPosition{0u};
     std::atomic<uint64_t> m_writePosition{0u};
+    std::atomic<uint64_t> m_indexConflicts{0u};
 };
 
 } // namespace concurrent
@@ -43,6 +43,12 @@ uint64_t SoFi<ValueType, CapacityValue>::size() const noexcept
     return writePosition - readPosition;
 }
 
+template <class ValueType, uint32_t CapacityValue>
+uint64_t SoFi<ValueType, CapacityValue>::getIndexConflicts() const noexcept
+{
+    return m_indexConflicts.load(std::memory_order_relaxed);
+}
+
 template <class ValueType, uint32_t CapacityValue>
 bool SoFi<ValueType, CapacityValue>::resize(const uint32_t newSize) noexcept
 {
@@ -94,8 +100,10 @@ inline bool SoFi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const Ver
     uint64_t nextReadPosition;
 
     bool popWasSuccessful{true};
+    uint64_t attempts{0u};
     do
     {
+        ++attempts;
         if (currentReadPosition == m_writePosition.load(std::memory_order_acquire))
         {
             nextReadPosition = currentReadPosition;
@@ -133,6 +141,11 @@ inline bool SoFi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const Ver
     } while (!m_readPosition.compare_exchange_weak(
         currentReadPosition, nextReadPosition, std::memory_order_acq_rel, std::memory_order_acquire));
 
+    if (attempts > 1u)
+    {
+        m_indexConflicts.fetch_add(attempts - 1u, std::memory_order_relaxed);
+    }
+
     return popWasSuccessful;
 }
 
@@ -146,9 +159,12 @@ bool SoFi<ValueType, CapacityValue>::push(const ValueType& valueOut, ValueType&
 
     uint64_t currentReadPosition = m_readPosition.load(std::memory_order_acquire);
     uint64_t nextReadPosition;
+    uint64_t attempts{0u};
 
     do
     {
+        ++attempts;
+
         // buffer overflow detection
         if (nextWritePosition < currentReadPosition + m_size)
         {
@@ -168,6 +184,11 @@ bool SoFi<ValueType, CapacityValue>::push(const ValueType& valueOut, ValueType&
     } while (!m_readPosition.compare_exchange_weak(
         currentReadPosition, nextReadPosition, std::memory_order_acq_rel, std::memory_order_acquire));
 
+    if (attempts > 1u)
+    {
+        m_indexConflicts.fetch_add(attempts - 1u, std::memory_order_relaxed);
+    }
+
     // no atomic synchronization required because writer can always
     // read his own data
     if (hasOverflow)
@@ -181,6 +202,128 @@ bool SoFi<ValueType, CapacityValue>::push(const ValueType& valueOut, ValueType&
     return !hasOverflow;
 }
 
+template <class ValueType, uint32_t CapacityValue>
+uint32_t SoFi<ValueType, CapacityValue>::pushBatch(const ValueType* f_values,
+                                                  const uint32_t f_count,
+                                                  ValueType* f_overflowValues) noexcept
+{
+    uint32_t overflowCount{0u};
+
+    uint64_t currentWritePosition = m_writePosition.load(std::memory_order_relaxed);
+    uint64_t publishedWritePosition = currentWritePosition;
+    uint64_t currentReadPosition = m_readPosition.load(std::memory_order_acquire);
+    uint64_t conflicts{0u};
+
+    for (uint32_t i = 0u; i < f_count; i++)
+    {
+        uint64_t nextWritePosition = currentWritePosition + 1U;
+        uint64_t nextReadPosition;
+        bool hasOverflow = false;
+        uint64_t attempts{0u};
+
+        do
+        {
+            ++attempts;
+            // buffer overflow detection, @see push
+            if (nextWritePosition < currentReadPosition + m_size)
+            {
+                hasOverflow = false;
+                break;
+            }
+
+            // the read position must never run ahead of the published write
+            // position, otherwise the pop thread would read unpublished slots;
+            // flush the pending part of the run before bumping the read position
+            if (publishedWritePosition != currentWritePosition)
+            {
+                m_writePosition.store(currentWritePosition, std::memory_order_release);
+                publishedWritePosition = currentWritePosition;
+            }
+
+            nextReadPosition = currentReadPosition + 1U;
+            hasOverflow = true;
+        } while (!m_readPosition.compare_exchange_weak(
+            currentReadPosition, nextReadPosition, std::memory_order_acq_rel, std::memory_order_acquire));
+
+        if (attempts > 1u)
+        {
+            conflicts += attempts - 1u;
+        }
+
+        if (hasOverflow)
+        {
+            // no atomic synchronization required because writer can always
+            // read his own data
+            std::memcpy(&f_overflowValues[overflowCount],
+                        &m_data[static_cast<int32_t>(currentReadPosition) % m_size],
+                        sizeof(ValueType));
+            overflowCount++;
+            currentReadPosition = nextReadPosition;
+        }
+
+        m_data[static_cast<int32_t>(currentWritePosition) % m_size] = f_values[i];
+        currentWritePosition = nextWritePosition;
+    }
+
+    // the whole run is published with a single store
+    m_writePosition.store(currentWritePosition, std::memory_order_release);
+
+    // the conflicts of the whole run are accumulated locally and published once
+    if (conflicts > 0u)
+    {
+        m_indexConflicts.fetch_add(conflicts, std::memory_order_relaxed);
+    }
+
+    return overflowCount;
+}
+
+template <class ValueType, uint32_t CapacityValue>
+uint32_t SoFi<ValueType, CapacityValue>::popBatch(ValueType* f_values, const uint32_t f_count) noexcept
+{
+    uint64_t currentReadPosition = m_readPosition.load(std::memory_order_acquire);
+    uint64_t poppedCount;
+    uint64_t attempts{0u};
+
+    do
+    {
+        ++attempts;
+        uint64_t currentWritePosition = m_writePosition.load(std::memory_order_acquire);
+        uint64_t availableCount = currentWritePosition - currentReadPosition;
+        poppedCount = (availableCount < f_count) ? availableCount : f_count;
+
+        if (poppedCount == 0u)
+        {
+            if (attempts > 1u)
+            {
+                m_indexConflicts.fetch_add(attempts - 1u, std::memory_order_relaxed);
+            }
+            return 0u;
+        }
+
+        // we use memcpy here for the same reason as in popIf; if the push
+        // thread overflows while we copy the read position changes, the
+        // compare and swap below fails and the whole run is read again
+        for (uint64_t i = 0u; i < poppedCount; i++)
+        {
+            std::memcpy(&f_values[i],
+                        &m_data[static_cast<int32_t>(currentReadPosition + i) % m_size],
+                        sizeof(ValueType));
+        }
+
+        // the whole run is committed with a single compare and swap
+    } while (!m_readPosition.compare_exchange_weak(currentReadPosition,
+                                                   currentReadPosition + poppedCount,
+                                                   std::memory_order_acq_rel,
+                                                   std::memory_order_acquire));
+
+    if (attempts > 1u)
+    {
+        m_indexConflicts.fetch_add(attempts - 1u, std::memory_order_relaxed);
+    }
+
+    return static_cast<uint32_t>(poppedCount);
+}
+
 
 } // namespace concurrent
 } // namespace iox
@@ -0,0 +1,70 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief tells the processor that we are in a spin loop, lowering the power
+///         consumption and freeing pipeline resources for the hyper thread
+///         sibling which might hold the awaited lock
+inline void cpuPause()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __asm__ __volatile__("pause");
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+/// @brief Bounded exponential backoff for spin phases. Each call to pause
+///         spins twice as long as the previous one up to a cap, so colliding
+///         spinners spread out instead of hammering the cache line in sync.
+/// @code
+///     concurrent::SpinBackoff backoff;
+///     for (uint32_t i = 0u; i < spinLimit; ++i)
+///     {
+///         if (tryAcquire())
+///         {
+///             return true;
+///         }
+///         backoff.pause();
+///     }
+///     // park on the expensive blocking primitive
+/// @endcode
+class SpinBackoff
+{
+  public:
+    void pause()
+    {
+        for (uint32_t i = 0u; i < m_pauseRounds; ++i)
+        {
+            cpuPause();
+        }
+        if (m_pauseRounds < MAX_PAUSE_ROUNDS)
+        {
+            m_pauseRounds *= 2u;
+        }
+    }
+
+  private:
+    static constexpr uint32_t MAX_PAUSE_ROUNDS = 64u;
+    uint32_t m_pauseRounds{1u};
+};
+} // namespace concurrent
+} // namespace iox
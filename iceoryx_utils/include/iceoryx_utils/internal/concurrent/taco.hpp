@@ -213,6 +213,126 @@ class TACO
         return cxx::nullopt_t();
     }
 };
+
+/// @brief
+/// Cross-process generalization of the TACO. The contexts are plain runtime
+/// indices in the range [0, NumberOfContexts) instead of a compile time enum,
+/// so a context slot can be handed out when a process registers, e.g. one
+/// slot for a publisher and one for the monitoring in RouDi.
+/// The class holds no pointers, only indices and trivially copyable data,
+/// therefore it can be placed in a shared memory segment which is mapped to
+/// different addresses in the participating processes.
+/// The exchange rotates the ownership of NumberOfContexts + 1 transaction
+/// slots with a single atomic exchange and is therefore wait-free for all
+/// contexts.
+///
+/// @param T                DataType to be stored, must be trivially copyable
+/// @param NumberOfContexts number of contexts which access the TACO
+///
+/// @concurrent wait-free, each context must be used by one thread only
+template <typename T, uint32_t NumberOfContexts>
+class IndexedTACO
+{
+  private:
+    struct Transaction
+    {
+        uint32_t context{NumberOfContexts};
+        bool hasData{false};
+        T data;
+    };
+
+    TACOMode m_mode;
+    // this is the index of the transaction currently available for consumption
+    std::atomic<uint32_t> m_pendingTransaction;
+
+    // the corresponding transaction indices for the contexts;
+    // the value of m_indices[context] contains the index of the m_transactions array which is owned by the context
+    // so it's save to access m_transactions[m_indices[context]]
+    uint32_t m_indices[NumberOfContexts];
+    // this is a local buffer for the transaction, one for each context that might access the TACO
+    // and there needs to be one more element which is the one ready for consumption
+    Transaction m_transactions[NumberOfContexts + 1];
+
+  public:
+    /// Create an IndexedTACO instance with the specified mode
+    /// @param [in] mode the TACO operates
+    IndexedTACO(TACOMode mode)
+        : m_mode(mode)
+        , m_pendingTransaction(NumberOfContexts)
+    {
+        static_assert(NumberOfContexts > 0, "IndexedTACO needs at least one context!");
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "IndexedTACO is intended for shared memory and requires a trivially copyable DataType!");
+
+        // initially assign the indices to the corresponding contexts
+        uint32_t i = 0;
+        for (auto& index : m_indices)
+        {
+            index = i;
+            i++;
+        }
+    }
+
+    IndexedTACO(const IndexedTACO&) = delete;
+    IndexedTACO(IndexedTACO&&) = delete;
+    IndexedTACO& operator=(const IndexedTACO&) = delete;
+    IndexedTACO& operator=(IndexedTACO&&) = delete;
+
+    /// Takes the data from the TACO and supplies new data
+    /// @param [in] data to supply for consumption, it's copied into a local cache in the TACO
+    /// @param [in] context of the thread which performs the exchange
+    /// @return the data a previous operation supplied for consumption or nullopt_t if there was either no data or the
+    /// data was supplied from the same context and the mode disallows data from the same context
+    cxx::optional<T> exchange(const T& data, const uint32_t context)
+    {
+        cxx::Expects(context < NumberOfContexts);
+        auto& ownTransaction = m_transactions[m_indices[context]];
+        ownTransaction.data = data;
+        ownTransaction.hasData = true;
+        return exchange(context);
+    }
+
+    /// Takes the data which is ready for consumption. The data isn't available for other access anymore.
+    /// @param [in] context of the thread which takes the data
+    /// @return the data a previous operation supplied for consumption or nullopt_t if there was either no data or the
+    /// data was supplied from the same context and the mode disallows data from the same context
+    cxx::optional<T> take(const uint32_t context)
+    {
+        cxx::Expects(context < NumberOfContexts);
+        // there is no need to clear the transaction for the corresponding context, the exchange function
+        // always clears the hasData flag of the acquired transaction
+        return exchange(context);
+    }
+
+    /// Supplies data for consumption
+    /// @param [in] data to supply for consumption, it's copied into a local cache in the TACO
+    /// @param [in] context of the thread which performs the exchange
+    void store(const T& data, const uint32_t context)
+    {
+        cxx::Expects(context < NumberOfContexts);
+        exchange(data, context);
+    }
+
+  private:
+    cxx::optional<T> exchange(const uint32_t context)
+    {
+        auto transactionIndexOld = m_indices[context];
+        m_transactions[transactionIndexOld].context = context;
+
+        m_indices[context] = m_pendingTransaction.exchange(transactionIndexOld, std::memory_order_acq_rel);
+        auto& acquiredTransaction = m_transactions[m_indices[context]];
+
+        if (acquiredTransaction.hasData
+            && (m_mode == TACOMode::AccecptDataFromSameContext || acquiredTransaction.context != context))
+        {
+            acquiredTransaction.hasData = false;
+            return cxx::make_optional<T>(acquiredTransaction.data);
+        }
+
+        acquiredTransaction.hasData = false;
+        return cxx::nullopt_t();
+    }
+};
 } // namespace concurrent
 } // namespace iox
 
@@ -0,0 +1,108 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/internal/concurrent/mpmc_queue.hpp"
+#include "iceoryx_utils/posix_wrapper/semaphore.hpp"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+namespace iox
+{
+namespace concurrent
+{
+/// @brief Work stealing thread pool as a shared executor for callback and
+///         housekeeping work. Instead of spawning a dedicated thread per
+///         concern, components submit their tasks here and a fixed set of
+///         workers executes them: every worker owns a queue, a task is
+///         submitted to the queue given by its affinity hint (or round
+///         robin without one) and an idle worker first drains its own queue
+///         and then steals from the others. Workers without work block on a
+///         semaphore, a burst of tasks therefore wakes only as many workers
+///         as needed.
+/// @code
+///     concurrent::ThreadPool pool; // one worker per core
+///
+///     if (pool.isInitialized())
+///     {
+///         pool.submit([] { /* housekeeping */ });
+///         // tasks of one component stay on one queue and therefore mostly
+///         // on one core when submitted with the same affinity hint
+///         pool.submit([] { /* callback */ }, myAffinityHint);
+///     }
+/// @endcode
+class ThreadPool
+{
+  public:
+    using Task = std::function<void()>;
+
+    /// @brief Creates the pool and spawns the workers.
+    /// @param[in] f_numberOfWorkers number of worker threads, 0 means one
+    ///             per hardware thread (clamped to MAX_WORKERS)
+    ThreadPool(uint32_t f_numberOfWorkers = 0u);
+
+    /// @brief Waits until the currently executing tasks are finished and
+    ///         joins the workers; tasks still queued are discarded.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /// @brief Submits a task with round robin queue selection.
+    /// @return true if the task was queued, false when all queues are full
+    bool submit(const Task& f_task);
+
+    /// @brief Submits a task to the worker queue selected by the affinity
+    ///         hint; tasks with the same hint land on the same queue and are
+    ///         mostly executed by the same worker. When that queue is full
+    ///         the other queues are tried before giving up.
+    /// @param[in] f_task task to execute
+    /// @param[in] f_affinityHint arbitrary value, mapped onto a queue by modulo
+    /// @return true if the task was queued, false when all queues are full
+    bool submit(const Task& f_task, const uint32_t f_affinityHint);
+
+    /// @brief Returns false when the semaphore creation failed and the pool
+    ///         is unusable.
+    bool isInitialized() const;
+
+    /// @brief Returns the number of worker threads.
+    uint32_t numberOfWorkers() const;
+
+    /// maximum number of workers of a pool
+    static constexpr uint32_t MAX_WORKERS = 64u;
+
+  private:
+    void workerLoop(const uint32_t f_ownIndex);
+    bool enqueue(const Task& f_task, const uint32_t f_queueIndex);
+
+    /// capacity of a single worker queue
+    static constexpr uint32_t QUEUE_CAPACITY = 128u;
+
+    cxx::expected<posix::Semaphore, posix::SemaphoreError> m_semaphore = posix::Semaphore::create(0);
+    bool m_isInitialized = !m_semaphore.has_error();
+
+    MpmcQueue<Task, QUEUE_CAPACITY> m_queues[MAX_WORKERS];
+    std::atomic<uint32_t> m_roundRobinIndex{0u};
+    std::atomic<bool> m_keepRunning{true};
+
+    uint32_t m_numberOfWorkers{0u};
+    std::thread m_workers[MAX_WORKERS];
+};
+} // namespace concurrent
+} // namespace iox
@@ -14,12 +14,12 @@
 
 #pragma once
 
-#include "iceoryx_utils/internal/concurrent/smart_lock.hpp"
 #include "iceoryx_utils/cxx/optional.hpp"
+#include "iceoryx_utils/internal/concurrent/mpmc_queue.hpp"
 #include "iceoryx_utils/posix_wrapper/semaphore.hpp"
 
+#include <atomic>
 #include <cstdint>
-#include <queue>
 
 namespace iox
 {
@@ -99,9 +99,6 @@ class TriggerQueue
     };
 
   public:
-    /// @todo replace this with a multi push / multi pop lockfree fifo
-    using queue_t = concurrent::smart_lock<std::queue<T>>;
-
     /// @brief Creates a TriggerQueue. If the TriggerQueue could not be
     ///         initialized, which only happens when the semaphore could not
     ///         be created, then the optional contains nothing.
@@ -110,8 +107,19 @@ class TriggerQueue
     ///         the optional method has_value().
     static cxx::optional<TriggerQueue> CreateTriggerQueue();
 
-    /// @brief Pushs an element into the trigger queue and notifies one thread
-    ///         which is waiting in blocking_pop().
+    /// The lock-free queue itself is not movable since it contains atomics;
+    /// moving is only required by the factory method which hands over an
+    /// empty queue, therefore only the semaphore is transferred
+    TriggerQueue(TriggerQueue&& rhs) noexcept;
+    TriggerQueue& operator=(TriggerQueue&& rhs) noexcept;
+    TriggerQueue(const TriggerQueue&) = delete;
+    TriggerQueue& operator=(const TriggerQueue&) = delete;
+    ~TriggerQueue() = default;
+
+    /// @brief Pushs an element into the trigger queue. The producer side is
+    ///         lock-free; the semaphore is only posted on the empty to
+    ///         nonempty transition, further pushes into a nonempty queue
+    ///         cause no wakeup traffic at all.
     ///         If the queue is full it returns false and no element is inserted
     ///         and nothing is notified. If the push was successfull, it returns
     ///         true.
@@ -122,7 +130,9 @@ class TriggerQueue
     ///         last element instantly.
     ///         It returns false when the queue was empty. This can happen when
     ///         another thread called send_wakeup_trigger to notify an arbitrary
-    ///         thread.
+    ///         thread or, since wakeups are coalesced, when another thread
+    ///         already pop'ed the element; in a worker loop simply call
+    ///         blocking_pop again.
     ///         It returns true if an element could be pop'ed from the queue.
     bool blocking_pop(T& out);
 
@@ -158,11 +168,22 @@ class TriggerQueue
     cxx::expected<posix::Semaphore, posix::SemaphoreError> m_semaphore = posix::Semaphore::create(0);
     bool m_isInitialized = !m_semaphore.has_error();
 
-    /// @todo remove with lockfree fifo implementation
-    /// this methods are helper to make the transition to a lockfree fifo easier
-    bool stl_queue_pop(T& out);
-    bool stl_queue_push(const T& in);
-    queue_t m_queue;
+    /// pop without any semaphore interaction, shared by the fast path of
+    /// blocking_pop and try_pop
+    bool lockfree_pop(T& out);
+
+    /// the capacity is enforced with m_numberOfElements, the internal queue
+    /// only needs enough slots; it also requires at least two of them
+    static constexpr uint64_t INTERNAL_CAPACITY = (CAPACITY < 2u) ? 2u : CAPACITY;
+
+    MpmcQueue<T, INTERNAL_CAPACITY> m_queue;
+    /// upper bound of the queued elements; incremented before the push into
+    /// the queue and decremented after the pop, used for the capacity check
+    /// and to detect the empty to nonempty transition on the producer side
+    std::atomic<uint64_t> m_numberOfElements{0u};
+    /// number of threads blocked in blocking_pop; as long as waiters are
+    /// present every push posts so that no blocked thread misses its element
+    std::atomic<uint64_t> m_numberOfWaiters{0u};
 };
 } // namespace concurrent
 } // namespace iox
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "iceoryx_utils/internal/concurrent/spin_backoff.hpp"
 #include "iceoryx_utils/internal/concurrent/trigger_queue.hpp"
 
 namespace iox
@@ -35,47 +36,129 @@ cxx::optional<TriggerQueue<T, CAPACITY>> TriggerQueue<T, CAPACITY>::CreateTrigge
 }
 
 template <typename T, uint64_t CAPACITY>
-inline bool TriggerQueue<T, CAPACITY>::push(const T& in)
+inline TriggerQueue<T, CAPACITY>::TriggerQueue(TriggerQueue&& rhs) noexcept
+    : m_semaphore(std::move(rhs.m_semaphore))
+    , m_isInitialized(rhs.m_isInitialized)
+{
+}
+
+template <typename T, uint64_t CAPACITY>
+inline TriggerQueue<T, CAPACITY>& TriggerQueue<T, CAPACITY>::operator=(TriggerQueue&& rhs) noexcept
 {
-    if (stl_queue_push(in))
+    if (this != &rhs)
     {
-        m_semaphore->post();
-        return true;
+        m_semaphore = std::move(rhs.m_semaphore);
+        m_isInitialized = rhs.m_isInitialized;
     }
-    else
+    return *this;
+}
+
+template <typename T, uint64_t CAPACITY>
+inline bool TriggerQueue<T, CAPACITY>::push(const T& in)
+{
+    // the element counter enforces the capacity, the internal queue can
+    // therefore never overflow
+    auto previousCount = m_numberOfElements.fetch_add(1u, std::memory_order_acq_rel);
+    if (previousCount >= CAPACITY)
     {
+        m_numberOfElements.fetch_sub(1u, std::memory_order_relaxed);
         return false;
     }
+
+    // the counter bounds the occupancy, but the internal push can still fail
+    // transiently: a consumer that already won the internal read position but
+    // has not yet freed its slot keeps the slot claimed, while a second fully
+    // completed pop admitted us here; the claimant frees the slot within a
+    // few instructions, so retry with backoff until the element is placed
+    SpinBackoff backoff;
+    while (!m_queue.push(in))
+    {
+        backoff.pause();
+    }
+
+    // the fence pairs with the one in blocking_pop; either this push observes
+    // the registered waiter, or the waiter observes the pushed element on its
+    // recheck, a lost wakeup is not possible
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // post only on the empty to nonempty transition or when threads are
+    // blocked in blocking_pop; elements pushed into a nonempty queue with an
+    // active consumer cause no wakeup traffic at all
+    if (previousCount == 0u || m_numberOfWaiters.load(std::memory_order_relaxed) > 0u)
+    {
+        m_semaphore->post();
+    }
+    return true;
 }
 
 template <typename T, uint64_t CAPACITY>
 inline bool TriggerQueue<T, CAPACITY>::blocking_pop(T& out)
 {
+    // fast path, no semaphore interaction as long as elements are queued
+    if (lockfree_pop(out))
+    {
+        return true;
+    }
+
+    // register as waiter and recheck the queue, otherwise an element pushed
+    // between the check above and the wait below could go unnoticed;
+    // the fence pairs with the one in push
+    m_numberOfWaiters.fetch_add(1u, std::memory_order_acq_rel);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (lockfree_pop(out))
+    {
+        m_numberOfWaiters.fetch_sub(1u, std::memory_order_relaxed);
+        return true;
+    }
+
     m_semaphore->wait();
-    return stl_queue_pop(out);
+    m_numberOfWaiters.fetch_sub(1u, std::memory_order_acq_rel);
+
+    if (!lockfree_pop(out))
+    {
+        // woken up by send_wakeup_trigger or the element was already taken
+        // by another consumer
+        return false;
+    }
+
+    // we consumed a wakeup; if further elements are queued, pass the wakeup
+    // on so another blocked consumer does not miss its element
+    if (!empty())
+    {
+        m_semaphore->post();
+    }
+    return true;
 }
 
 template <typename T, uint64_t CAPACITY>
 inline bool TriggerQueue<T, CAPACITY>::try_pop(T& out)
 {
-    if (!m_semaphore->tryWait())
+    return lockfree_pop(out);
+}
+
+template <typename T, uint64_t CAPACITY>
+inline bool TriggerQueue<T, CAPACITY>::lockfree_pop(T& out)
+{
+    auto entry = m_queue.pop();
+    if (!entry.has_value())
     {
         return false;
     }
-
-    return stl_queue_pop(out);
+    out = *entry;
+    m_numberOfElements.fetch_sub(1u, std::memory_order_acq_rel);
+    return true;
 }
 
 template <typename T, uint64_t CAPACITY>
 inline bool TriggerQueue<T, CAPACITY>::empty()
 {
-    return m_queue->empty();
+    return size() == 0u;
 }
 
 template <typename T, uint64_t CAPACITY>
 inline uint64_t TriggerQueue<T, CAPACITY>::size()
 {
-    return m_queue->size();
+    return m_numberOfElements.load(std::memory_order_relaxed);
 }
 
 template <typename T, uint64_t CAPACITY>
@@ -90,33 +173,5 @@ inline void TriggerQueue<T, CAPACITY>::send_wakeup_trigger()
     m_semaphore->post();
 }
 
-/// @todo remove with lockfree fifo START
-template <typename T, uint64_t CAPACITY>
-inline bool TriggerQueue<T, CAPACITY>::stl_queue_pop(T& out)
-{
-    if (m_queue->empty())
-    {
-        return false;
-    }
-
-    auto guardedQueue = m_queue.GetScopeGuard();
-    out = guardedQueue->front();
-    guardedQueue->pop();
-    return true;
-}
-
-template <typename T, uint64_t CAPACITY>
-bool TriggerQueue<T, CAPACITY>::stl_queue_push(const T& in)
-{
-    auto guardedQueue = m_queue.GetScopeGuard();
-    if (guardedQueue->size() >= CAPACITY)
-    {
-        return false;
-    }
-    guardedQueue->push(in);
-    return true;
-}
-/// @todo remove with lockfree fifo END
-
 } // namespace concurrent
 } // namespace iox
@@ -12,6 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace iox
 {
 namespace algorithm
@@ -51,5 +55,201 @@ inline constexpr T min(const T& left, const T& right, const Targs&... args) noex
 {
     return min(min(left, right), args...);
 }
+
+template <typename T>
+inline T minOfRange(const T* const f_data, const uint64_t f_size) noexcept
+{
+    cxx::Expects(f_size > 0u);
+    T result = f_data[0];
+    for (uint64_t i = 1u; i < f_size; ++i)
+    {
+        if (f_data[i] < result)
+        {
+            result = f_data[i];
+        }
+    }
+    return result;
+}
+
+template <typename T>
+inline T maxOfRange(const T* const f_data, const uint64_t f_size) noexcept
+{
+    cxx::Expects(f_size > 0u);
+    T result = f_data[0];
+    for (uint64_t i = 1u; i < f_size; ++i)
+    {
+        if (result < f_data[i])
+        {
+            result = f_data[i];
+        }
+    }
+    return result;
+}
+
+template <typename T>
+inline T sumOfRange(const T* const f_data, const uint64_t f_size) noexcept
+{
+    T result = T();
+    for (uint64_t i = 0u; i < f_size; ++i)
+    {
+        result = result + f_data[i];
+    }
+    return result;
+}
+
+template <typename T>
+inline uint64_t findInRange(const T* const f_data, const uint64_t f_size, const T& f_value) noexcept
+{
+    for (uint64_t i = 0u; i < f_size; ++i)
+    {
+        if (f_data[i] == f_value)
+        {
+            return i;
+        }
+    }
+    return f_size;
+}
+
+template <typename T>
+inline uint64_t countInRange(const T* const f_data, const uint64_t f_size, const T& f_value) noexcept
+{
+    uint64_t result{0u};
+    for (uint64_t i = 0u; i < f_size; ++i)
+    {
+        if (f_data[i] == f_value)
+        {
+            ++result;
+        }
+    }
+    return result;
+}
+
+inline float minOfRange(const float* const f_data, const uint64_t f_size) noexcept
+{
+    cxx::Expects(f_size > 0u);
+    uint64_t i{0u};
+    float result = f_data[0];
+#if defined(__SSE2__)
+    if (f_size >= 4u)
+    {
+        __m128 laneMinimum = _mm_loadu_ps(f_data);
+        for (i = 4u; i + 4u <= f_size; i += 4u)
+        {
+            laneMinimum = _mm_min_ps(laneMinimum, _mm_loadu_ps(f_data + i));
+        }
+        float lanes[4];
+        _mm_storeu_ps(lanes, laneMinimum);
+        result = min(lanes[0], lanes[1], lanes[2], lanes[3]);
+    }
+#endif
+    for (; i < f_size; ++i)
+    {
+        if (f_data[i] < result)
+        {
+            result = f_data[i];
+        }
+    }
+    return result;
+}
+
+inline float maxOfRange(const float* const f_data, const uint64_t f_size) noexcept
+{
+    cxx::Expects(f_size > 0u);
+    uint64_t i{0u};
+    float result = f_data[0];
+#if defined(__SSE2__)
+    if (f_size >= 4u)
+    {
+        __m128 laneMaximum = _mm_loadu_ps(f_data);
+        for (i = 4u; i + 4u <= f_size; i += 4u)
+        {
+            laneMaximum = _mm_max_ps(laneMaximum, _mm_loadu_ps(f_data + i));
+        }
+        float lanes[4];
+        _mm_storeu_ps(lanes, laneMaximum);
+        result = max(lanes[0], lanes[1], lanes[2], lanes[3]);
+    }
+#endif
+    for (; i < f_size; ++i)
+    {
+        if (result < f_data[i])
+        {
+            result = f_data[i];
+        }
+    }
+    return result;
+}
+
+inline float sumOfRange(const float* const f_data, const uint64_t f_size) noexcept
+{
+    uint64_t i{0u};
+    float result{0.0f};
+#if defined(__SSE2__)
+    if (f_size >= 4u)
+    {
+        __m128 laneSum = _mm_setzero_ps();
+        for (; i + 4u <= f_size; i += 4u)
+        {
+            laneSum = _mm_add_ps(laneSum, _mm_loadu_ps(f_data + i));
+        }
+        float lanes[4];
+        _mm_storeu_ps(lanes, laneSum);
+        result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+#endif
+    for (; i < f_size; ++i)
+    {
+        result += f_data[i];
+    }
+    return result;
+}
+
+inline uint64_t findInRange(const uint8_t* const f_data, const uint64_t f_size, const uint8_t f_value) noexcept
+{
+    uint64_t i{0u};
+#if defined(__SSE2__)
+    const __m128i comparator = _mm_set1_epi8(static_cast<char>(f_value));
+    for (; i + 16u <= f_size; i += 16u)
+    {
+        const __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_data + i));
+        const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(lanes, comparator));
+        if (mask != 0)
+        {
+            return i + static_cast<uint64_t>(__builtin_ctz(static_cast<unsigned int>(mask)));
+        }
+    }
+#endif
+    for (; i < f_size; ++i)
+    {
+        if (f_data[i] == f_value)
+        {
+            return i;
+        }
+    }
+    return f_size;
+}
+
+inline uint64_t countInRange(const uint8_t* const f_data, const uint64_t f_size, const uint8_t f_value) noexcept
+{
+    uint64_t i{0u};
+    uint64_t result{0u};
+#if defined(__SSE2__)
+    const __m128i comparator = _mm_set1_epi8(static_cast<char>(f_value));
+    for (; i + 16u <= f_size; i += 16u)
+    {
+        const __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_data + i));
+        const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(lanes, comparator));
+        result += static_cast<uint64_t>(__builtin_popcount(static_cast<unsigned int>(mask)));
+    }
+#endif
+    for (; i < f_size; ++i)
+    {
+        if (f_data[i] == f_value)
+        {
+            ++result;
+        }
+    }
+    return result;
+}
 } // namespace algorithm
 } // namespace iox
@@ -17,7 +17,8 @@ namespace iox
 namespace cxx
 {
 template <typename Source>
-inline typename std::enable_if<!std::is_convertible<Source, std::string>::value, std::string>::type
+inline typename std::enable_if<!std::is_convertible<Source, std::string>::value && !convert::IsFastIntegral<Source>::value,
+                               std::string>::type
 convert::toString(const Source& t)
 {
     std::stringstream ss;
@@ -25,6 +26,84 @@ convert::toString(const Source& t)
     return ss.str();
 }
 
+template <typename Source>
+inline typename std::enable_if<convert::IsFastIntegral<Source>::value, std::string>::type
+convert::toString(const Source& t)
+{
+    // a pair of digits per division halves the number of divisions compared
+    // to the textbook digit loop
+    static const char DIGIT_PAIRS[201] = "00010203040506070809"
+                                         "10111213141516171819"
+                                         "20212223242526272829"
+                                         "30313233343536373839"
+                                         "40414243444546474849"
+                                         "50515253545556575859"
+                                         "60616263646566676869"
+                                         "70717273747576777879"
+                                         "80818283848586878889"
+                                         "90919293949596979899";
+
+    // a 64 bit integer has at most 20 digits plus a sign
+    char buffer[24];
+    char* const bufferEnd = buffer + sizeof(buffer);
+    char* cursor = bufferEnd;
+
+    const bool isNegative = std::is_signed<Source>::value && t < static_cast<Source>(0);
+    // the negation is done on the unsigned type, this also handles the
+    // minimum value of the signed type whose negation does not fit into it
+    uint64_t remaining =
+        isNegative ? (0u - static_cast<uint64_t>(t)) : static_cast<uint64_t>(t);
+
+    while (remaining >= 100u)
+    {
+        const auto pairIndex = (remaining % 100u) * 2u;
+        remaining /= 100u;
+        *(--cursor) = DIGIT_PAIRS[pairIndex + 1u];
+        *(--cursor) = DIGIT_PAIRS[pairIndex];
+    }
+
+    if (remaining >= 10u)
+    {
+        const auto pairIndex = remaining * 2u;
+        *(--cursor) = DIGIT_PAIRS[pairIndex + 1u];
+        *(--cursor) = DIGIT_PAIRS[pairIndex];
+    }
+    else
+    {
+        *(--cursor) = static_cast<char>('0' + remaining);
+    }
+
+    if (isNegative)
+    {
+        *(--cursor) = '-';
+    }
+
+    return std::string(cursor, static_cast<size_t>(bufferEnd - cursor));
+}
+
+inline std::string convert::toString(const float t)
+{
+    // same output as the stream default (printf %g with precision 6) but
+    // without constructing a stream and consulting its locale
+    char buffer[64];
+    const auto length = snprintf(buffer, sizeof(buffer), "%g", static_cast<double>(t));
+    return std::string(buffer, static_cast<size_t>(length));
+}
+
+inline std::string convert::toString(const double t)
+{
+    char buffer[64];
+    const auto length = snprintf(buffer, sizeof(buffer), "%g", t);
+    return std::string(buffer, static_cast<size_t>(length));
+}
+
+inline std::string convert::toString(const long double t)
+{
+    char buffer[64];
+    const auto length = snprintf(buffer, sizeof(buffer), "%Lg", t);
+    return std::string(buffer, static_cast<size_t>(length));
+}
+
 template <typename Source>
 inline typename std::enable_if<std::is_convertible<Source, std::string>::value, std::string>::type
 convert::toString(const Source& t)
@@ -126,6 +205,77 @@ inline bool convert::stringIsNumberWithErrorMessage(const char* v, const NumberT
     return true;
 }
 
+inline bool convert::fromChars(const char* v, uint64_t& value) noexcept
+{
+    if (v == nullptr || v[0] == '\0')
+    {
+        return false;
+    }
+
+    uint64_t result{0};
+    for (uint32_t i = 0; v[i] != '\0'; ++i)
+    {
+        if (v[i] < '0' || v[i] > '9')
+        {
+            return false;
+        }
+        const auto digit = static_cast<uint64_t>(v[i] - '0');
+        if (result > (UINT64_MAX - digit) / 10u)
+        {
+            return false;
+        }
+        result = result * 10u + digit;
+    }
+
+    value = result;
+    return true;
+}
+
+inline bool convert::fromChars(const char* v, int64_t& value) noexcept
+{
+    if (v == nullptr || v[0] == '\0')
+    {
+        return false;
+    }
+
+    bool isNegative{false};
+    if (v[0] == '+')
+    {
+        ++v;
+    }
+    else if (v[0] == '-')
+    {
+        isNegative = true;
+        ++v;
+    }
+
+    uint64_t magnitude{0};
+    if (!fromChars(v, magnitude))
+    {
+        return false;
+    }
+
+    if (isNegative)
+    {
+        if (magnitude > static_cast<uint64_t>(INT64_MAX) + 1u)
+        {
+            return false;
+        }
+        // negate on the unsigned type, this also handles INT64_MIN whose
+        // magnitude does not fit into the signed type
+        value = static_cast<int64_t>(0u - magnitude);
+    }
+    else
+    {
+        if (magnitude > static_cast<uint64_t>(INT64_MAX))
+        {
+            return false;
+        }
+        value = static_cast<int64_t>(magnitude);
+    }
+    return true;
+}
+
 template <>
 inline bool convert::fromString<float>(const char* v, float& dest)
 {
@@ -191,19 +341,14 @@ inline bool convert::fromString<unsigned int>(const char* v, unsigned int& dest)
         return false;
     }
 
-    auto call = makeSmartC(strtoul, ReturnMode::PRE_DEFINED_ERROR_CODE, {ULONG_MAX}, {}, v, nullptr, 10);
-    if (call.hasErrors())
-    {
-        return false;
-    }
-
-    if (call.getReturnValue() > UINT_MAX)
+    uint64_t value{0};
+    if (!fromChars(v, value) || value > UINT_MAX)
     {
-        std::cerr << call.getReturnValue() << " too large, unsigned integer overflow" << std::endl;
+        std::cerr << v << " too large, unsigned integer overflow" << std::endl;
         return false;
     }
 
-    dest = static_cast<unsigned int>(call.getReturnValue());
+    dest = static_cast<unsigned int>(value);
     return true;
 }
 
@@ -215,19 +360,14 @@ inline bool convert::fromString<unsigned short>(const char* v, unsigned short& d
         return false;
     }
 
-    auto call = makeSmartC(strtoul, ReturnMode::PRE_DEFINED_ERROR_CODE, {ULONG_MAX}, {}, v, nullptr, 10);
-    if (call.hasErrors())
-    {
-        return false;
-    }
-
-    if (call.getReturnValue() > USHRT_MAX)
+    uint64_t value{0};
+    if (!fromChars(v, value) || value > USHRT_MAX)
     {
-        std::cerr << call.getReturnValue() << " too large, unsigned short overflow" << std::endl;
+        std::cerr << v << " too large, unsigned short overflow" << std::endl;
         return false;
     }
 
-    dest = static_cast<unsigned short>(call.getReturnValue());
+    dest = static_cast<unsigned short>(value);
     return true;
 }
 
@@ -239,19 +379,14 @@ inline bool convert::fromString<short>(const char* v, short& dest)
         return false;
     }
 
-    auto call = makeSmartC(strtol, ReturnMode::PRE_DEFINED_ERROR_CODE, {LONG_MAX, LONG_MIN}, {}, v, nullptr, 10);
-    if (call.hasErrors())
-    {
-        return false;
-    }
-
-    if (call.getReturnValue() > SHRT_MAX || call.getReturnValue() < SHRT_MIN)
+    int64_t value{0};
+    if (!fromChars(v, value) || value > SHRT_MAX || value < SHRT_MIN)
     {
-        std::cerr << call.getReturnValue() << " too large, short integer overflow" << std::endl;
+        std::cerr << v << " too large, short integer overflow" << std::endl;
         return false;
     }
 
-    dest = static_cast<short>(call.getReturnValue());
+    dest = static_cast<short>(value);
     return true;
 }
 
@@ -263,13 +398,14 @@ inline bool convert::fromString<unsigned long>(const char* v, unsigned long& des
         return false;
     }
 
-    auto call = makeSmartC(strtoul, ReturnMode::PRE_DEFINED_ERROR_CODE, {ULONG_MAX}, {}, v, nullptr, 10);
-    if (call.hasErrors())
+    uint64_t value{0};
+    if (!fromChars(v, value))
     {
+        std::cerr << v << " too large, unsigned long overflow" << std::endl;
         return false;
     }
 
-    dest = call.getReturnValue();
+    dest = static_cast<unsigned long>(value);
     return true;
 }
 
@@ -281,13 +417,14 @@ inline bool convert::fromString<unsigned long long>(const char* v, unsigned long
         return false;
     }
 
-    auto call = makeSmartC(strtoull, ReturnMode::PRE_DEFINED_ERROR_CODE, {ULLONG_MAX}, {}, v, nullptr, 10);
-    if (call.hasErrors())
+    uint64_t value{0};
+    if (!fromChars(v, value))
     {
+        std::cerr << v << " too large, unsigned long long overflow" << std::endl;
         return false;
     }
 
-    dest = call.getReturnValue();
+    dest = static_cast<unsigned long long>(value);
     return true;
 }
 
@@ -299,19 +436,14 @@ inline bool convert::fromString<int>(const char* v, int& dest)
         return false;
     }
 
-    auto call = makeSmartC(strtol, ReturnMode::PRE_DEFINED_ERROR_CODE, {LONG_MAX, LONG_MIN}, {}, v, nullptr, 10);
-    if (call.hasErrors())
-    {
-        return false;
-    }
-
-    if (call.getReturnValue() < INT_MIN || call.getReturnValue() > INT_MAX)
+    int64_t value{0};
+    if (!fromChars(v, value) || value < INT_MIN || value > INT_MAX)
     {
-        std::cerr << call.getReturnValue() << " too large, integer overflow!" << std::endl;
+        std::cerr << v << " too large, integer overflow!" << std::endl;
         return false;
     }
 
-    dest = static_cast<int>(call.getReturnValue());
+    dest = static_cast<int>(value);
     return true;
 }
 
@@ -323,13 +455,14 @@ inline bool convert::fromString<long>(const char* v, long& dest)
         return false;
     }
 
-    auto call = makeSmartC(strtol, ReturnMode::PRE_DEFINED_ERROR_CODE, {LONG_MAX, LONG_MIN}, {}, v, nullptr, 10);
-    if (call.hasErrors())
+    int64_t value{0};
+    if (!fromChars(v, value))
     {
+        std::cerr << v << " too large, long overflow" << std::endl;
         return false;
     }
 
-    dest = call.getReturnValue();
+    dest = static_cast<long>(value);
     return true;
 }
 
@@ -341,13 +474,14 @@ inline bool convert::fromString<long long>(const char* v, long long& dest)
         return false;
     }
 
-    auto call = makeSmartC(strtoll, ReturnMode::PRE_DEFINED_ERROR_CODE, {LLONG_MAX, LLONG_MIN}, {}, v, nullptr, 10);
-    if (call.hasErrors())
+    int64_t value{0};
+    if (!fromChars(v, value))
     {
+        std::cerr << v << " too large, long long overflow" << std::endl;
         return false;
     }
 
-    dest = call.getReturnValue();
+    dest = static_cast<long long>(value);
     return true;
 }
 
@@ -359,13 +493,13 @@ inline bool convert::fromString<bool>(const char* v, bool& dest)
         return false;
     }
 
-    auto call = makeSmartC(strtoul, ReturnMode::PRE_DEFINED_ERROR_CODE, {ULONG_MAX}, {}, v, nullptr, 10);
-    if (call.hasErrors())
+    uint64_t value{0};
+    if (!fromChars(v, value))
     {
         return false;
     }
 
-    dest = static_cast<bool>(call.getReturnValue());
+    dest = static_cast<bool>(value);
     return true;
 }
 
@@ -206,79 +206,113 @@ inline const ValueType& expected<ValueType, ErrorType>::operator*() const noexce
 }
 
 template <typename ValueType, typename ErrorType>
-inline expected<ValueType, ErrorType>&
-expected<ValueType, ErrorType>::on_error(const std::function<void(expected&)>& callable) noexcept
+template <typename Callable>
+inline void expected<ValueType, ErrorType>::invokeCallable(const Callable& callable, std::true_type) noexcept
+{
+    callable(*this);
+}
+
+template <typename ValueType, typename ErrorType>
+template <typename Callable>
+inline void expected<ValueType, ErrorType>::invokeCallable(const Callable& callable, std::false_type) noexcept
+{
+    callable();
+}
+
+template <typename ValueType, typename ErrorType>
+template <typename Callable>
+inline expected<ValueType, ErrorType>& expected<ValueType, ErrorType>::on_error(const Callable& callable) noexcept
 {
     if (this->has_error())
     {
-        callable(*this);
+        invokeCallable(callable, typename internal::is_invocable<const Callable&, expected&>::type());
     }
 
     return *this;
 }
 
 template <typename ValueType, typename ErrorType>
-inline const expected<ValueType, ErrorType>&
-expected<ValueType, ErrorType>::on_error(const std::function<void(expected&)>& callable) const noexcept
+template <typename Callable>
+inline const expected<ValueType, ErrorType>& expected<ValueType, ErrorType>::on_error(const Callable& callable) const
+    noexcept
 {
     return const_cast<expected*>(this)->on_error(callable);
 }
 
 template <typename ValueType, typename ErrorType>
-inline expected<ValueType, ErrorType>&
-expected<ValueType, ErrorType>::on_error(const std::function<void()>& callable) noexcept
+template <typename Callable>
+inline expected<ValueType, ErrorType>& expected<ValueType, ErrorType>::on_success(const Callable& callable) noexcept
 {
-    if (this->has_error())
+    if (!this->has_error())
     {
-        callable();
+        invokeCallable(callable, typename internal::is_invocable<const Callable&, expected&>::type());
     }
 
     return *this;
 }
 
 template <typename ValueType, typename ErrorType>
-inline const expected<ValueType, ErrorType>&
-expected<ValueType, ErrorType>::on_error(const std::function<void()>& callable) const noexcept
+template <typename Callable>
+inline const expected<ValueType, ErrorType>& expected<ValueType, ErrorType>::on_success(const Callable& callable) const
+    noexcept
 {
-    return const_cast<expected*>(this)->on_error(callable);
+    return const_cast<expected*>(this)->on_success(callable);
 }
 
 template <typename ValueType, typename ErrorType>
-inline expected<ValueType, ErrorType>&
-expected<ValueType, ErrorType>::on_success(const std::function<void(expected&)>& callable) noexcept
+template <typename Callable>
+    inline auto expected<ValueType, ErrorType>::and_then(Callable&& callable)
+    && noexcept -> decltype(callable(std::declval<ValueType&&>()))
 {
-    if (!this->has_error())
+    using ResultType = decltype(callable(std::declval<ValueType&&>()));
+    if (this->has_error())
     {
-        callable(*this);
+        return ResultType(error<ErrorType>(std::move(this->get_error())));
     }
 
-    return *this;
+    return callable(std::move(this->get_value()));
 }
 
 template <typename ValueType, typename ErrorType>
-inline const expected<ValueType, ErrorType>&
-expected<ValueType, ErrorType>::on_success(const std::function<void(expected&)>& callable) const noexcept
+template <typename Callable>
+    inline auto expected<ValueType, ErrorType>::and_then(Callable&& callable)
+    & noexcept -> decltype(callable(std::declval<ValueType&>()))
 {
-    return const_cast<expected*>(this)->on_success(callable);
+    using ResultType = decltype(callable(std::declval<ValueType&>()));
+    if (this->has_error())
+    {
+        return ResultType(error<ErrorType>(this->get_error()));
+    }
+
+    return callable(this->get_value());
 }
 
 template <typename ValueType, typename ErrorType>
-inline expected<ValueType, ErrorType>&
-expected<ValueType, ErrorType>::on_success(const std::function<void()>& callable) noexcept
+template <typename Callable>
+    inline auto expected<ValueType, ErrorType>::or_else(Callable&& callable)
+    && noexcept -> decltype(callable(std::declval<ErrorType&&>()))
 {
+    using ResultType = decltype(callable(std::declval<ErrorType&&>()));
     if (!this->has_error())
     {
-        callable();
+        return ResultType(success<ValueType>(std::move(this->get_value())));
     }
 
-    return *this;
+    return callable(std::move(this->get_error()));
 }
 
 template <typename ValueType, typename ErrorType>
-inline const expected<ValueType, ErrorType>&
-expected<ValueType, ErrorType>::on_success(const std::function<void()>& callable) const noexcept
+template <typename Callable>
+    inline auto expected<ValueType, ErrorType>::or_else(Callable&& callable)
+    & noexcept -> decltype(callable(std::declval<ErrorType&>()))
 {
-    return const_cast<expected*>(this)->on_success(callable);
+    using ResultType = decltype(callable(std::declval<ErrorType&>()));
+    if (!this->has_error())
+    {
+        return ResultType(success<ValueType>(this->get_value()));
+    }
+
+    return callable(this->get_error());
 }
 
 template <typename ValueType, typename ErrorType>
@@ -375,73 +409,109 @@ template <typename ErrorType>
 }
 
 template <typename ErrorType>
-inline expected<ErrorType>& expected<ErrorType>::on_error(const std::function<void(expected&)>& callable) noexcept
+template <typename Callable>
+inline void expected<ErrorType>::invokeCallable(const Callable& callable, std::true_type) noexcept
+{
+    callable(*this);
+}
+
+template <typename ErrorType>
+template <typename Callable>
+inline void expected<ErrorType>::invokeCallable(const Callable& callable, std::false_type) noexcept
+{
+    callable();
+}
+
+template <typename ErrorType>
+template <typename Callable>
+inline expected<ErrorType>& expected<ErrorType>::on_error(const Callable& callable) noexcept
 {
     if (this->has_error())
     {
-        callable(*this);
+        invokeCallable(callable, typename internal::is_invocable<const Callable&, expected&>::type());
     }
 
     return *this;
 }
 
 template <typename ErrorType>
-inline const expected<ErrorType>& expected<ErrorType>::on_error(const std::function<void(expected&)>& callable) const
-    noexcept
+template <typename Callable>
+inline const expected<ErrorType>& expected<ErrorType>::on_error(const Callable& callable) const noexcept
 {
     return const_cast<expected*>(this)->on_error(callable);
 }
 
 template <typename ErrorType>
-inline expected<ErrorType>& expected<ErrorType>::on_error(const std::function<void()>& callable) noexcept
+template <typename Callable>
+inline expected<ErrorType>& expected<ErrorType>::on_success(const Callable& callable) noexcept
 {
-    if (this->has_error())
+    if (!this->has_error())
     {
-        callable();
+        invokeCallable(callable, typename internal::is_invocable<const Callable&, expected&>::type());
     }
 
     return *this;
 }
 
 template <typename ErrorType>
-inline const expected<ErrorType>& expected<ErrorType>::on_error(const std::function<void()>& callable) const noexcept
+template <typename Callable>
+inline const expected<ErrorType>& expected<ErrorType>::on_success(const Callable& callable) const noexcept
 {
-    return const_cast<expected*>(this)->on_error(callable);
+    return const_cast<expected*>(this)->on_success(callable);
 }
 
 template <typename ErrorType>
-inline expected<ErrorType>& expected<ErrorType>::on_success(const std::function<void(expected&)>& callable) noexcept
+template <typename Callable>
+    inline auto expected<ErrorType>::and_then(Callable&& callable) && noexcept -> decltype(callable())
 {
-    if (!this->has_error())
+    using ResultType = decltype(callable());
+    if (this->has_error())
     {
-        callable(*this);
+        return ResultType(error<ErrorType>(std::move(this->get_error())));
     }
 
-    return *this;
+    return callable();
 }
 
 template <typename ErrorType>
-inline const expected<ErrorType>& expected<ErrorType>::on_success(const std::function<void(expected&)>& callable) const
-    noexcept
+template <typename Callable>
+    inline auto expected<ErrorType>::and_then(Callable&& callable) & noexcept -> decltype(callable())
 {
-    return const_cast<expected*>(this)->on_success(callable);
+    using ResultType = decltype(callable());
+    if (this->has_error())
+    {
+        return ResultType(error<ErrorType>(this->get_error()));
+    }
+
+    return callable();
 }
 
 template <typename ErrorType>
-inline expected<ErrorType>& expected<ErrorType>::on_success(const std::function<void()>& callable) noexcept
+template <typename Callable>
+    inline auto expected<ErrorType>::or_else(Callable&& callable)
+    && noexcept -> decltype(callable(std::declval<ErrorType&&>()))
 {
+    using ResultType = decltype(callable(std::declval<ErrorType&&>()));
     if (!this->has_error())
     {
-        callable();
+        return ResultType(success<>());
     }
 
-    return *this;
+    return callable(std::move(this->get_error()));
 }
 
 template <typename ErrorType>
-inline const expected<ErrorType>& expected<ErrorType>::on_success(const std::function<void()>& callable) const noexcept
+template <typename Callable>
+    inline auto expected<ErrorType>::or_else(Callable&& callable)
+    & noexcept -> decltype(callable(std::declval<ErrorType&>()))
 {
-    return const_cast<expected*>(this)->on_success(callable);
+    using ResultType = decltype(callable(std::declval<ErrorType&>()));
+    if (!this->has_error())
+    {
+        return ResultType(success<>());
+    }
+
+    return callable(this->get_error());
 }
 } // namespace cxx
 } // namespace iox
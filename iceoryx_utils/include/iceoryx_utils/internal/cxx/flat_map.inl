@@ -0,0 +1,159 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/cxx/flat_map.hpp"
+
+namespace iox
+{
+namespace cxx
+{
+template <typename Key, typename Value, uint64_t Capacity>
+inline uint64_t flat_map<Key, Value, Capacity>::lower_bound(const Key& key) const
+{
+    uint64_t low = 0;
+    uint64_t high = m_entries.size();
+    while (low < high)
+    {
+        uint64_t mid = low + (high - low) / 2;
+        if (m_entries[mid].key < key)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline bool flat_map<Key, Value, Capacity>::insert(const Key& key, const Value& value)
+{
+    auto index = lower_bound(key);
+    if (index < m_entries.size() && !(key < m_entries[index].key))
+    {
+        return false;
+    }
+
+    if (!m_entries.emplace_back(Entry{key, value}))
+    {
+        return false;
+    }
+
+    // move the new entry to its sorted position
+    for (auto i = m_entries.size() - 1; i > index; --i)
+    {
+        std::swap(m_entries[i], m_entries[i - 1]);
+    }
+    return true;
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline bool flat_map<Key, Value, Capacity>::insert_or_assign(const Key& key, const Value& value)
+{
+    auto index = lower_bound(key);
+    if (index < m_entries.size() && !(key < m_entries[index].key))
+    {
+        m_entries[index].value = value;
+        return true;
+    }
+    return insert(key, value);
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline bool flat_map<Key, Value, Capacity>::erase(const Key& key)
+{
+    auto index = lower_bound(key);
+    if (index < m_entries.size() && !(key < m_entries[index].key))
+    {
+        m_entries.erase(m_entries.begin() + index);
+        return true;
+    }
+    return false;
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline Value* flat_map<Key, Value, Capacity>::find(const Key& key)
+{
+    return const_cast<Value*>(const_cast<const flat_map*>(this)->find(key));
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline const Value* flat_map<Key, Value, Capacity>::find(const Key& key) const
+{
+    auto index = lower_bound(key);
+    if (index < m_entries.size() && !(key < m_entries[index].key))
+    {
+        return &m_entries[index].value;
+    }
+    return nullptr;
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline bool flat_map<Key, Value, Capacity>::contains(const Key& key) const
+{
+    return find(key) != nullptr;
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline uint64_t flat_map<Key, Value, Capacity>::size() const
+{
+    return m_entries.size();
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline uint64_t flat_map<Key, Value, Capacity>::capacity() const
+{
+    return Capacity;
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline bool flat_map<Key, Value, Capacity>::empty() const
+{
+    return m_entries.empty();
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline void flat_map<Key, Value, Capacity>::clear()
+{
+    m_entries.clear();
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline typename flat_map<Key, Value, Capacity>::iterator flat_map<Key, Value, Capacity>::begin()
+{
+    return m_entries.begin();
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline typename flat_map<Key, Value, Capacity>::const_iterator flat_map<Key, Value, Capacity>::begin() const
+{
+    return m_entries.begin();
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline typename flat_map<Key, Value, Capacity>::iterator flat_map<Key, Value, Capacity>::end()
+{
+    return m_entries.end();
+}
+
+template <typename Key, typename Value, uint64_t Capacity>
+inline typename flat_map<Key, Value, Capacity>::const_iterator flat_map<Key, Value, Capacity>::end() const
+{
+    return m_entries.end();
+}
+
+} // namespace cxx
+} // namespace iox
@@ -0,0 +1,119 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/cxx/flat_set.hpp"
+
+namespace iox
+{
+namespace cxx
+{
+template <typename Key, uint64_t Capacity>
+inline uint64_t flat_set<Key, Capacity>::lower_bound(const Key& key) const
+{
+    uint64_t low = 0;
+    uint64_t high = m_keys.size();
+    while (low < high)
+    {
+        uint64_t mid = low + (high - low) / 2;
+        if (m_keys[mid] < key)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+template <typename Key, uint64_t Capacity>
+inline bool flat_set<Key, Capacity>::insert(const Key& key)
+{
+    auto index = lower_bound(key);
+    if (index < m_keys.size() && !(key < m_keys[index]))
+    {
+        return false;
+    }
+
+    if (!m_keys.emplace_back(key))
+    {
+        return false;
+    }
+
+    // move the new key to its sorted position
+    for (auto i = m_keys.size() - 1; i > index; --i)
+    {
+        std::swap(m_keys[i], m_keys[i - 1]);
+    }
+    return true;
+}
+
+template <typename Key, uint64_t Capacity>
+inline bool flat_set<Key, Capacity>::erase(const Key& key)
+{
+    auto index = lower_bound(key);
+    if (index < m_keys.size() && !(key < m_keys[index]))
+    {
+        m_keys.erase(m_keys.begin() + index);
+        return true;
+    }
+    return false;
+}
+
+template <typename Key, uint64_t Capacity>
+inline bool flat_set<Key, Capacity>::contains(const Key& key) const
+{
+    auto index = lower_bound(key);
+    return index < m_keys.size() && !(key < m_keys[index]);
+}
+
+template <typename Key, uint64_t Capacity>
+inline uint64_t flat_set<Key, Capacity>::size() const
+{
+    return m_keys.size();
+}
+
+template <typename Key, uint64_t Capacity>
+inline uint64_t flat_set<Key, Capacity>::capacity() const
+{
+    return Capacity;
+}
+
+template <typename Key, uint64_t Capacity>
+inline bool flat_set<Key, Capacity>::empty() const
+{
+    return m_keys.empty();
+}
+
+template <typename Key, uint64_t Capacity>
+inline void flat_set<Key, Capacity>::clear()
+{
+    m_keys.clear();
+}
+
+template <typename Key, uint64_t Capacity>
+inline typename flat_set<Key, Capacity>::const_iterator flat_set<Key, Capacity>::begin() const
+{
+    return m_keys.begin();
+}
+
+template <typename Key, uint64_t Capacity>
+inline typename flat_set<Key, Capacity>::const_iterator flat_set<Key, Capacity>::end() const
+{
+    return m_keys.end();
+}
+
+} // namespace cxx
+} // namespace iox
@@ -0,0 +1,199 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/cxx/inplace_function.hpp"
+
+#include <iostream>
+
+namespace iox
+{
+namespace cxx
+{
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+template <typename Functor>
+inline ReturnType
+inplace_function<ReturnType(Args...), Capacity>::invokeFunctor(void* const f_storage, Args&&... f_args)
+{
+    return (*reinterpret_cast<Functor*>(f_storage))(std::forward<Args>(f_args)...);
+}
+
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+template <typename Functor>
+inline void inplace_function<ReturnType(Args...), Capacity>::manageFunctor(const Operation f_operation,
+                                                                           void* const f_destination,
+                                                                           void* const f_source)
+{
+    switch (f_operation)
+    {
+    case Operation::COPY:
+        new (f_destination) Functor(*reinterpret_cast<const Functor*>(f_source));
+        break;
+    case Operation::MOVE:
+        new (f_destination) Functor(std::move(*reinterpret_cast<Functor*>(f_source)));
+        reinterpret_cast<Functor*>(f_source)->~Functor();
+        break;
+    case Operation::DESTROY:
+        reinterpret_cast<Functor*>(f_destination)->~Functor();
+        break;
+    }
+}
+
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+inline inplace_function<ReturnType(Args...), Capacity>::inplace_function(std::nullptr_t) noexcept
+{
+}
+
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+template <typename Functor, typename>
+inline inplace_function<ReturnType(Args...), Capacity>::inplace_function(Functor&& callable) noexcept
+{
+    using StoredType = typename std::decay<Functor>::type;
+    static_assert(sizeof(StoredType) <= Capacity,
+                  "The callable does not fit into the inplace_function storage, increase the Capacity!");
+    static_assert(alignof(StoredType) <= STORAGE_ALIGNMENT,
+                  "The callable has a stricter alignment than the inplace_function storage!");
+
+    new (m_storage) StoredType(std::forward<Functor>(callable));
+    m_invoke = &invokeFunctor<StoredType>;
+    m_manage = &manageFunctor<StoredType>;
+}
+
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+inline inplace_function<ReturnType(Args...), Capacity>::inplace_function(const inplace_function& rhs) noexcept
+{
+    if (rhs.m_manage != nullptr)
+    {
+        rhs.m_manage(Operation::COPY, m_storage, rhs.m_storage);
+        m_invoke = rhs.m_invoke;
+        m_manage = rhs.m_manage;
+    }
+}
+
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+inline inplace_function<ReturnType(Args...), Capacity>::inplace_function(inplace_function&& rhs) noexcept
+{
+    if (rhs.m_manage != nullptr)
+    {
+        rhs.m_manage(Operation::MOVE, m_storage, rhs.m_storage);
+        m_invoke = rhs.m_invoke;
+        m_manage = rhs.m_manage;
+        rhs.m_invoke = nullptr;
+        rhs.m_manage = nullptr;
+    }
+}
+
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+inline inplace_function<ReturnType(Args...), Capacity>& inplace_function<ReturnType(Args...), Capacity>::
+operator=(const inplace_function& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        reset();
+        if (rhs.m_manage != nullptr)
+        {
+            rhs.m_manage(Operation::COPY, m_storage, rhs.m_storage);
+            m_invoke = rhs.m_invoke;
+            m_manage = rhs.m_manage;
+        }
+    }
+    return *this;
+}
+
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+inline inplace_function<ReturnType(Args...), Capacity>& inplace_function<ReturnType(Args...), Capacity>::
+operator=(inplace_function&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        reset();
+        if (rhs.m_manage != nullptr)
+        {
+            rhs.m_manage(Operation::MOVE, m_storage, rhs.m_storage);
+            m_invoke = rhs.m_invoke;
+            m_manage = rhs.m_manage;
+            rhs.m_invoke = nullptr;
+            rhs.m_manage = nullptr;
+        }
+    }
+    return *this;
+}
+
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+inline inplace_function<ReturnType(Args...), Capacity>& inplace_function<ReturnType(Args...), Capacity>::
+operator=(std::nullptr_t) noexcept
+{
+    reset();
+    return *this;
+}
+
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+inline inplace_function<ReturnType(Args...), Capacity>::~inplace_function() noexcept
+{
+    reset();
+}
+
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+inline void inplace_function<ReturnType(Args...), Capacity>::reset() noexcept
+{
+    if (m_manage != nullptr)
+    {
+        m_manage(Operation::DESTROY, m_storage, nullptr);
+        m_invoke = nullptr;
+        m_manage = nullptr;
+    }
+}
+
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+inline ReturnType inplace_function<ReturnType(Args...), Capacity>::operator()(Args... args) const
+{
+    if (m_invoke == nullptr)
+    {
+        std::cerr << "Attempting to call an empty inplace_function!" << std::endl;
+        std::terminate();
+    }
+    return m_invoke(m_storage, std::forward<Args>(args)...);
+}
+
+template <typename ReturnType, typename... Args, uint64_t Capacity>
+inline inplace_function<ReturnType(Args...), Capacity>::operator bool() const noexcept
+{
+    return m_invoke != nullptr;
+}
+
+template <typename Signature, uint64_t Capacity>
+inline bool operator==(const inplace_function<Signature, Capacity>& lhs, std::nullptr_t) noexcept
+{
+    return !static_cast<bool>(lhs);
+}
+
+template <typename Signature, uint64_t Capacity>
+inline bool operator==(std::nullptr_t, const inplace_function<Signature, Capacity>& rhs) noexcept
+{
+    return !static_cast<bool>(rhs);
+}
+
+template <typename Signature, uint64_t Capacity>
+inline bool operator!=(const inplace_function<Signature, Capacity>& lhs, std::nullptr_t) noexcept
+{
+    return static_cast<bool>(lhs);
+}
+
+template <typename Signature, uint64_t Capacity>
+inline bool operator!=(std::nullptr_t, const inplace_function<Signature, Capacity>& rhs) noexcept
+{
+    return static_cast<bool>(rhs);
+}
+
+} // namespace cxx
+} // namespace iox
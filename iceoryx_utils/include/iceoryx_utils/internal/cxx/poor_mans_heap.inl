@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 #include <utility>
 
 namespace iox
@@ -75,5 +76,73 @@ Interface& PoorMansHeap<Interface, TypeSize, TypeAlignment>::operator*() const n
     return *m_instance;
 }
 
+template <typename Interface, typename... Types>
+PoorMansHeapVariant<Interface, Types...>::~PoorMansHeapVariant() noexcept
+{
+    deleteInstance();
+}
+
+template <typename Interface, typename... Types>
+template <typename Type, typename... CTorArgs>
+PoorMansHeapVariant<Interface, Types...>::PoorMansHeapVariant(PoorMansHeapType<Type>, CTorArgs&&... ctorArgs) noexcept
+{
+    newInstance<Type>(std::forward<CTorArgs>(ctorArgs)...);
+}
+
+template <typename Interface, typename... Types>
+template <typename Type, typename... CTorArgs>
+void PoorMansHeapVariant<Interface, Types...>::newInstance(CTorArgs&&... ctorArgs) noexcept
+{
+    static_assert(std::is_base_of<Interface, Type>::value, "Type is not derived from Interface!");
+
+    deleteInstance();
+
+    m_instance = new (m_heap) Type(std::forward<CTorArgs>(ctorArgs)...);
+    m_typeIndex = internal::TypeListIndex<Type, Types...>::value;
+}
+
+template <typename Interface, typename... Types>
+void PoorMansHeapVariant<Interface, Types...>::deleteInstance() noexcept
+{
+    if (m_instance != nullptr)
+    {
+        m_instance->~Interface();
+        m_instance = nullptr;
+        m_typeIndex = NO_INSTANCE;
+    }
+}
+
+template <typename Interface, typename... Types>
+bool PoorMansHeapVariant<Interface, Types...>::hasInstance() const noexcept
+{
+    return m_instance != nullptr;
+}
+
+template <typename Interface, typename... Types>
+template <typename Visitor>
+void PoorMansHeapVariant<Interface, Types...>::visit(const Visitor& visitor) noexcept
+{
+    internal::TypeListVisitor<Types...>::visit(m_typeIndex, m_heap, visitor);
+}
+
+template <typename Interface, typename... Types>
+template <typename Visitor>
+void PoorMansHeapVariant<Interface, Types...>::visit(const Visitor& visitor) const noexcept
+{
+    const_cast<PoorMansHeapVariant*>(this)->visit(visitor);
+}
+
+template <typename Interface, typename... Types>
+Interface* PoorMansHeapVariant<Interface, Types...>::operator->() const noexcept
+{
+    return m_instance;
+}
+
+template <typename Interface, typename... Types>
+Interface& PoorMansHeapVariant<Interface, Types...>::operator*() const noexcept
+{
+    return *m_instance;
+}
+
 } // namespace cxx
 } // namespace iox
@@ -148,5 +148,127 @@ inline bool Serialization::getNth(const unsigned int index, T& t) const noexcept
 
     return true;
 }
+
+template <typename... Targs>
+inline bool BinarySerialization::create(uint8_t* const buffer,
+                                        const uint64_t bufferSize,
+                                        uint64_t& writtenSize,
+                                        const Targs&... args) noexcept
+{
+    uint64_t offset{0};
+    if (!serialize(buffer, bufferSize, offset, args...))
+    {
+        writtenSize = 0;
+        return false;
+    }
+    writtenSize = offset;
+    return true;
+}
+
+template <typename... Targs>
+inline bool
+BinarySerialization::extract(const uint8_t* const buffer, const uint64_t bufferSize, Targs&... args) noexcept
+{
+    uint64_t offset{0};
+    return deserialize(buffer, bufferSize, offset, args...);
+}
+
+inline bool BinarySerialization::serialize(uint8_t* const, const uint64_t, uint64_t&) noexcept
+{
+    return true;
+}
+
+template <typename T, typename... Targs>
+inline bool BinarySerialization::serialize(
+    uint8_t* const buffer, const uint64_t bufferSize, uint64_t& offset, const T& t, const Targs&... args) noexcept
+{
+    if (!serializeField(buffer, bufferSize, offset, t))
+    {
+        return false;
+    }
+    return serialize(buffer, bufferSize, offset, args...);
+}
+
+inline bool BinarySerialization::deserialize(const uint8_t* const, const uint64_t, uint64_t&) noexcept
+{
+    return true;
+}
+
+template <typename T, typename... Targs>
+inline bool BinarySerialization::deserialize(
+    const uint8_t* const buffer, const uint64_t bufferSize, uint64_t& offset, T& t, Targs&... args) noexcept
+{
+    if (!deserializeField(buffer, bufferSize, offset, t))
+    {
+        return false;
+    }
+    return deserialize(buffer, bufferSize, offset, args...);
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_trivially_copyable<T>::value, bool>::type BinarySerialization::serializeField(
+    uint8_t* const buffer, const uint64_t bufferSize, uint64_t& offset, const T& t) noexcept
+{
+    if (offset + sizeof(T) > bufferSize)
+    {
+        return false;
+    }
+    std::memcpy(buffer + offset, &t, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+inline bool BinarySerialization::serializeField(uint8_t* const buffer,
+                                                const uint64_t bufferSize,
+                                                uint64_t& offset,
+                                                const std::string& t) noexcept
+{
+    auto length = static_cast<uint32_t>(t.size());
+    if (offset + sizeof(uint32_t) + length > bufferSize)
+    {
+        return false;
+    }
+    std::memcpy(buffer + offset, &length, sizeof(uint32_t));
+    offset += sizeof(uint32_t);
+    std::memcpy(buffer + offset, t.data(), length);
+    offset += length;
+    return true;
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_trivially_copyable<T>::value, bool>::type BinarySerialization::deserializeField(
+    const uint8_t* const buffer, const uint64_t bufferSize, uint64_t& offset, T& t) noexcept
+{
+    if (offset + sizeof(T) > bufferSize)
+    {
+        return false;
+    }
+    std::memcpy(&t, buffer + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+inline bool BinarySerialization::deserializeField(const uint8_t* const buffer,
+                                                  const uint64_t bufferSize,
+                                                  uint64_t& offset,
+                                                  std::string& t) noexcept
+{
+    uint32_t length{0};
+    if (offset + sizeof(uint32_t) > bufferSize)
+    {
+        return false;
+    }
+    std::memcpy(&length, buffer + offset, sizeof(uint32_t));
+    offset += sizeof(uint32_t);
+
+    if (offset + length > bufferSize)
+    {
+        return false;
+    }
+    t.assign(reinterpret_cast<const char*>(buffer + offset), length);
+    offset += length;
+    return true;
+}
+
 } // namespace cxx
 } // namespace iox
@@ -77,6 +77,64 @@ makeSmartCImpl(const char* file,
     return retval;
 }
 
+template <typename Function, typename ReturnType, typename... FunctionArguments>
+inline LeanSmartC<ReturnType> makeLeanSmartCImpl(const char* file,
+                                                 const int line,
+                                                 const char* func,
+                                                 const Function& f_function,
+                                                 const ReturnMode& f_mode,
+                                                 const std::initializer_list<ReturnType>& f_returnValues,
+                                                 const std::initializer_list<int>& f_ignoredValues,
+                                                 FunctionArguments... f_args) noexcept
+{
+    for (int remainingRetrys = 5;; --remainingRetrys)
+    {
+        errno = 0;
+        const ReturnType returnValue = f_function(f_args...);
+
+        bool matchesPredefinedValue = false;
+        for (const auto value : f_returnValues)
+        {
+            if (value == returnValue)
+            {
+                matchesPredefinedValue = true;
+                break;
+            }
+        }
+
+        const bool callFailed =
+            (f_mode == ReturnMode::PRE_DEFINED_ERROR_CODE) ? matchesPredefinedValue : !matchesPredefinedValue;
+        if (!callFailed)
+        {
+            return LeanSmartC<ReturnType>(returnValue, 0, false);
+        }
+
+        // only the failure path pays for the errno evaluation and the error
+        // handling
+        const int errnum = errno;
+        for (const auto ignored : f_ignoredValues)
+        {
+            if (errnum == ignored)
+            {
+                return LeanSmartC<ReturnType>(returnValue, errnum, false);
+            }
+        }
+
+        if (errnum == EINTR && remainingRetrys > 0)
+        {
+            continue;
+        }
+
+        if (errnum != EINTR)
+        {
+            std::cerr << file << ":" << line << " { " << func << " }  :::  [ " << errnum << " ]  " << strerror(errnum)
+                      << std::endl;
+        }
+
+        return LeanSmartC<ReturnType>(returnValue, errnum, true);
+    }
+}
+
 template <typename Function, typename ReturnType, typename... FunctionArguments>
 int SmartC<Function, ReturnType, FunctionArguments...>::resetErrnoAndInitErrnum() noexcept
 {
@@ -192,5 +250,45 @@ inline int SmartC<Function, ReturnType, FunctionArguments...>::getErrNum() const
 {
     return m_errnum;
 }
+
+template <typename ReturnType>
+inline LeanSmartC<ReturnType>::LeanSmartC(const ReturnType f_returnValue,
+                                          const int f_errnum,
+                                          const bool f_hasErrors) noexcept
+    : m_returnValue(f_returnValue)
+    , m_errnum(f_errnum)
+    , m_hasErrors(f_hasErrors)
+{
+}
+
+template <typename ReturnType>
+inline ReturnType LeanSmartC<ReturnType>::getReturnValue() const noexcept
+{
+    return m_returnValue;
+}
+
+template <typename ReturnType>
+inline LeanSmartC<ReturnType>::operator ReturnType() const noexcept
+{
+    return getReturnValue();
+}
+
+template <typename ReturnType>
+inline bool LeanSmartC<ReturnType>::hasErrors() const noexcept
+{
+    return m_hasErrors;
+}
+
+template <typename ReturnType>
+inline const char* LeanSmartC<ReturnType>::getErrorString() const noexcept
+{
+    return strerror(m_errnum);
+}
+
+template <typename ReturnType>
+inline int LeanSmartC<ReturnType>::getErrNum() const noexcept
+{
+    return m_errnum;
+}
 } // namespace cxx
 } // namespace iox
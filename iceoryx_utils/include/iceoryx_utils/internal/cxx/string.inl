@@ -16,11 +16,6 @@ namespace iox
 {
 namespace cxx
 {
-template <uint64_t Capacity>
-inline string<Capacity>::string() noexcept
-{
-}
-
 template <uint64_t Capacity>
 inline string<Capacity>::string(const string& other) noexcept
 {
@@ -63,11 +58,6 @@ inline string<Capacity>& string<Capacity>::operator=(string&& rhs) noexcept
     return *this;
 }
 
-template <uint64_t Capacity>
-inline string<Capacity>::~string() noexcept
-{
-}
-
 template <uint64_t Capacity>
 template <int N>
 inline string<Capacity>::string(const char (&other)[N]) noexcept
@@ -183,13 +173,20 @@ inline int string<Capacity>::compare(const string other) const noexcept
 template <uint64_t Capacity>
 inline bool string<Capacity>::operator==(const string& rhs) const noexcept
 {
-    return (compare(rhs) == 0);
+    // the stored size makes strings of different length unequal without
+    // looking at a single character; equally sized strings are compared word
+    // wise instead of with a character loop
+    if (m_rawstringSize != rhs.m_rawstringSize)
+    {
+        return false;
+    }
+    return internal::isEqual(m_rawstring, rhs.m_rawstring, m_rawstringSize);
 }
 
 template <uint64_t Capacity>
 inline bool string<Capacity>::operator!=(const string& rhs) const noexcept
 {
-    return (compare(rhs) != 0);
+    return !(*this == rhs);
 }
 
 template <uint64_t Capacity>
@@ -216,6 +213,23 @@ inline bool string<Capacity>::operator>=(const string& rhs) const noexcept
     return !(compare(rhs) < 0);
 }
 
+template <uint64_t Capacity>
+inline uint64_t string<Capacity>::find_first_of(const char character, const uint64_t startPosition) const noexcept
+{
+    if (startPosition >= m_rawstringSize)
+    {
+        return m_rawstringSize;
+    }
+    return startPosition
+           + internal::findFirstOf(m_rawstring + startPosition, m_rawstringSize - startPosition, character);
+}
+
+template <uint64_t Capacity>
+inline uint64_t string<Capacity>::hash() const noexcept
+{
+    return internal::hash(m_rawstring, m_rawstringSize);
+}
+
 template <uint64_t Capacity>
 inline const char* string<Capacity>::c_str() const noexcept
 {
@@ -223,13 +237,13 @@ inline const char* string<Capacity>::c_str() const noexcept
 }
 
 template <uint64_t Capacity>
-inline uint64_t string<Capacity>::size() const noexcept
+inline constexpr uint64_t string<Capacity>::size() const noexcept
 {
     return m_rawstringSize;
 }
 
 template <uint64_t Capacity>
-inline uint64_t string<Capacity>::capacity() const noexcept
+inline constexpr uint64_t string<Capacity>::capacity() const noexcept
 {
     return Capacity;
 }
@@ -0,0 +1,181 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace iox
+{
+namespace cxx
+{
+namespace internal
+{
+/// @brief compares two character sequences of known equal length;
+///         the comparison runs over 16 byte SSE2 lanes respectively 8 byte
+///         words instead of single characters, the sequences may contain
+///         null characters
+/// @param [in] f_lhs pointer to the first character sequence
+/// @param [in] f_rhs pointer to the second character sequence
+/// @param [in] f_size number of characters to compare
+/// @return true if the sequences are equal, otherwise false
+inline bool isEqual(const char* const f_lhs, const char* const f_rhs, const uint64_t f_size) noexcept
+{
+    uint64_t i = 0u;
+
+#if defined(__SSE2__)
+    for (; i + 16u <= f_size; i += 16u)
+    {
+        auto lhsChunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_lhs + i));
+        auto rhsChunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_rhs + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(lhsChunk, rhsChunk)) != 0xFFFF)
+        {
+            return false;
+        }
+    }
+#endif
+
+    for (; i + 8u <= f_size; i += 8u)
+    {
+        // memcpy instead of dereferencing avoids unaligned accesses and is
+        // folded into a single load by the compiler
+        uint64_t lhsWord;
+        uint64_t rhsWord;
+        std::memcpy(&lhsWord, f_lhs + i, sizeof(uint64_t));
+        std::memcpy(&rhsWord, f_rhs + i, sizeof(uint64_t));
+        if (lhsWord != rhsWord)
+        {
+            return false;
+        }
+    }
+
+    for (; i < f_size; ++i)
+    {
+        if (f_lhs[i] != f_rhs[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief finds the first occurrence of a character in a character sequence
+///         of known length; searches over 16 byte SSE2 lanes instead of
+///         single characters
+/// @param [in] f_data pointer to the character sequence
+/// @param [in] f_size number of characters to search
+/// @param [in] f_character the character to search for
+/// @return the position of the first occurrence or f_size if the character
+///         was not found
+inline uint64_t findFirstOf(const char* const f_data, const uint64_t f_size, const char f_character) noexcept
+{
+    uint64_t i = 0u;
+
+#if defined(__SSE2__)
+    auto needle = _mm_set1_epi8(f_character);
+    for (; i + 16u <= f_size; i += 16u)
+    {
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_data + i));
+        auto mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle));
+        if (mask != 0)
+        {
+            return i + static_cast<uint64_t>(__builtin_ctz(static_cast<unsigned int>(mask)));
+        }
+    }
+#endif
+
+    for (; i < f_size; ++i)
+    {
+        if (f_data[i] == f_character)
+        {
+            return i;
+        }
+    }
+
+    return f_size;
+}
+
+/// @brief compares two null terminated strings; can be evaluated at compile
+///         time for string literals
+/// @param [in] f_lhs the first null terminated string
+/// @param [in] f_rhs the second null terminated string
+/// @return <0 if the first character that does not match has a lower value in
+///         f_lhs than in f_rhs, 0 if both strings are equal, >0 otherwise
+constexpr int32_t compare(const char* const f_lhs, const char* const f_rhs) noexcept
+{
+    // c++11 constexpr allows only a single return statement, therefore the
+    // recursive formulation
+    return (*f_lhs != *f_rhs)
+               ? (static_cast<int32_t>(static_cast<unsigned char>(*f_lhs))
+                  - static_cast<int32_t>(static_cast<unsigned char>(*f_rhs)))
+               : ((*f_lhs == '\0') ? 0 : compare(f_lhs + 1, f_rhs + 1));
+}
+
+/// @brief checks two null terminated strings for equality; can be evaluated
+///         at compile time for string literals
+/// @param [in] f_lhs the first null terminated string
+/// @param [in] f_rhs the second null terminated string
+/// @return true if the strings are equal, otherwise false
+constexpr bool isEqual(const char* const f_lhs, const char* const f_rhs) noexcept
+{
+    return compare(f_lhs, f_rhs) == 0;
+}
+
+constexpr uint64_t FNV1A_OFFSET_BASIS = 0xCBF29CE484222325u;
+constexpr uint64_t FNV1A_PRIME = 0x100000001B3u;
+
+constexpr uint64_t hashRecursion(const char* const f_string, const uint64_t f_hash) noexcept
+{
+    // c++11 constexpr allows only a single return statement, therefore the
+    // recursive formulation
+    return (*f_string == '\0')
+               ? f_hash
+               : hashRecursion(f_string + 1,
+                               (f_hash ^ static_cast<uint64_t>(static_cast<unsigned char>(*f_string))) * FNV1A_PRIME);
+}
+
+/// @brief FNV-1a hash over a null terminated string; can be evaluated at
+///         compile time for string literals, e.g. for switch-like dispatch
+///         on service strings
+/// @param [in] f_string null terminated string to hash
+/// @return the 64 bit hash of the string
+constexpr uint64_t hash(const char* const f_string) noexcept
+{
+    return hashRecursion(f_string, FNV1A_OFFSET_BASIS);
+}
+
+/// @brief FNV-1a hash over a character sequence of known length, the
+///         sequence may contain null characters
+/// @param [in] f_data pointer to the character sequence
+/// @param [in] f_size number of characters to hash
+/// @return the 64 bit hash of the sequence
+inline uint64_t hash(const char* const f_data, const uint64_t f_size) noexcept
+{
+    uint64_t result = FNV1A_OFFSET_BASIS;
+    for (uint64_t i = 0u; i < f_size; ++i)
+    {
+        result = (result ^ static_cast<uint64_t>(static_cast<unsigned char>(f_data[i]))) * FNV1A_PRIME;
+    }
+    return result;
+}
+
+} // namespace internal
+} // namespace cxx
+} // namespace iox
@@ -62,60 +62,91 @@ inline vector<T, Capacity>& vector<T, Capacity>::operator=(const vector& rhs)
 {
     if (this != &rhs)
     {
-        uint64_t i = 0;
-        // copy using copy assignment
-        for (; i < std::min(rhs.size(), size()); ++i)
-        {
-            at(i) = rhs.at(i);
-        }
-
-        // copy using copy ctor
-        for (; i < rhs.size(); ++i)
-        {
-            emplace_back(rhs.at(i));
-        }
-
-        // delete remaining elements
-        for (; i < size(); ++i)
-        {
-            at(i).~T();
-        }
-
-        m_size = rhs.m_size;
+        copy_assign(rhs, std::is_trivially_copyable<T>());
     }
     return *this;
 }
 
+template <typename T, uint64_t Capacity>
+inline void vector<T, Capacity>::copy_assign(const vector& rhs, std::true_type)
+{
+    // a trivially copyable type has a trivial destructor, therefore the
+    // surplus elements don't need to be destructed and the whole payload can
+    // be copied with one memcpy
+    std::memcpy(m_data, rhs.m_data, static_cast<size_t>(rhs.m_size) * sizeof(T));
+    m_size = rhs.m_size;
+}
+
+template <typename T, uint64_t Capacity>
+inline void vector<T, Capacity>::copy_assign(const vector& rhs, std::false_type)
+{
+    uint64_t i = 0;
+    // copy using copy assignment
+    for (; i < std::min(rhs.size(), size()); ++i)
+    {
+        at(i) = rhs.at(i);
+    }
+
+    // copy using copy ctor
+    for (; i < rhs.size(); ++i)
+    {
+        emplace_back(rhs.at(i));
+    }
+
+    // delete remaining elements
+    for (; i < size(); ++i)
+    {
+        at(i).~T();
+    }
+
+    m_size = rhs.m_size;
+}
+
 template <typename T, uint64_t Capacity>
 inline vector<T, Capacity>& vector<T, Capacity>::operator=(vector&& rhs)
 {
     if (this != &rhs)
     {
-        uint64_t i = 0;
-        // move using move assignment
-        for (; i < std::min(rhs.size(), size()); ++i)
-        {
-            at(i) = std::move(rhs.at(i));
-        }
-
-        // move using move ctor
-        for (; i < rhs.size(); ++i)
-        {
-            emplace_back(std::move(rhs.at(i)));
-        }
-
-        // delete remaining elements
-        for (; i < size(); ++i)
-        {
-            at(i).~T();
-        }
-
-        m_size = rhs.m_size;
-        rhs.clear();
+        move_assign(std::move(rhs), std::is_trivially_copyable<T>());
     }
     return *this;
 }
 
+template <typename T, uint64_t Capacity>
+inline void vector<T, Capacity>::move_assign(vector&& rhs, std::true_type)
+{
+    // moving a trivially copyable type is a copy of its bytes
+    std::memcpy(m_data, rhs.m_data, static_cast<size_t>(rhs.m_size) * sizeof(T));
+    m_size = rhs.m_size;
+    rhs.m_size = 0;
+}
+
+template <typename T, uint64_t Capacity>
+inline void vector<T, Capacity>::move_assign(vector&& rhs, std::false_type)
+{
+    uint64_t i = 0;
+    // move using move assignment
+    for (; i < std::min(rhs.size(), size()); ++i)
+    {
+        at(i) = std::move(rhs.at(i));
+    }
+
+    // move using move ctor
+    for (; i < rhs.size(); ++i)
+    {
+        emplace_back(std::move(rhs.at(i)));
+    }
+
+    // delete remaining elements
+    for (; i < size(); ++i)
+    {
+        at(i).~T();
+    }
+
+    m_size = rhs.m_size;
+    rhs.clear();
+}
+
 template <typename T, uint64_t Capacity>
 inline bool vector<T, Capacity>::empty() const
 {
@@ -144,6 +175,26 @@ inline void vector<T, Capacity>::clear()
     m_size = 0;
 }
 
+template <typename T, uint64_t Capacity>
+inline bool vector<T, Capacity>::resize(const uint64_t count)
+{
+    if (count > Capacity)
+    {
+        return false;
+    }
+
+    while (m_size > count)
+    {
+        pop_back();
+    }
+    while (m_size < count)
+    {
+        emplace_back(T());
+    }
+
+    return true;
+}
+
 template <typename T, uint64_t Capacity>
 template <typename... Targs>
 inline bool vector<T, Capacity>::emplace_back(Targs&&... args)
@@ -293,16 +344,30 @@ inline typename vector<T, Capacity>::iterator vector<T, Capacity>::erase(iterato
     if (begin() <= position && position < end())
     {
         uint64_t index = static_cast<uint64_t>(position - begin()) % (sizeof(element_t) * Capacity);
-        size_t n = index;
-        for (; n + 1 < size(); ++n)
-        {
-            at(n) = std::move(at(n + 1));
-        }
-        at(n).~T();
+        erase_at(index, std::is_trivially_copyable<T>());
         m_size--;
     }
     return nullptr;
 }
 
+template <typename T, uint64_t Capacity>
+inline void vector<T, Capacity>::erase_at(const uint64_t index, std::true_type)
+{
+    // close the gap with one memmove, no destructor call needed for a
+    // trivially copyable type
+    std::memmove(&data()[index], &data()[index + 1], static_cast<size_t>(m_size - index - 1) * sizeof(T));
+}
+
+template <typename T, uint64_t Capacity>
+inline void vector<T, Capacity>::erase_at(const uint64_t index, std::false_type)
+{
+    size_t n = index;
+    for (; n + 1 < size(); ++n)
+    {
+        at(n) = std::move(at(n + 1));
+    }
+    at(n).~T();
+}
+
 } // namespace cxx
 } // namespace iox
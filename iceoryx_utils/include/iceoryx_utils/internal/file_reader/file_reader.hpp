@@ -16,12 +16,40 @@
 
 #include "iceoryx_utils/error_handling/error_handling.hpp"
 
+#include <cstdint>
 #include <fstream>
+#include <string>
 
 namespace iox
 {
 namespace cxx
 {
+/// @brief Read only, string_view like span on a character range. Does not own the characters; the range stays
+/// valid as long as its origin (e.g. a mapped file) is alive.
+struct FileView
+{
+    FileView() = default;
+    FileView(const char* f_data, const uint64_t f_size)
+        : data(f_data)
+        , size(f_size)
+    {
+    }
+
+    const char* data{nullptr};
+    uint64_t size{0u};
+
+    bool empty() const
+    {
+        return size == 0u;
+    }
+
+    /// Creates a std::string copy, e.g. for interfacing with string based APIs.
+    std::string to_string() const
+    {
+        return std::string(data, size);
+    }
+};
+
 /// @brief Wrapper class for file reading operations. Tries to open a file in the constructor. Error handling strategy
 /// can be decided by means of the ErrorMode argument.
 ///
@@ -34,6 +62,13 @@ namespace cxx
 ///
 ///     // Terminates program execution, if file cannot be opened (or found):
 ///     cxx::FileReader reader("filename", "path/to/file", cxx::FileReader::ErrorMode::Terminate);
+///
+///     // Zero-copy mode: one mapping, in-place line scanning without per-line allocations
+///     cxx::FileReader reader("config.toml", "/etc");
+///     if(reader.MapFile()) {
+///         cxx::FileView line;
+///         while(reader.ReadLineView(line)) { /* parse line.data, line.size in place */ }
+///     }
 /// @endcode
 class FileReader
 {
@@ -65,10 +100,29 @@ class FileReader
     /// Read one line from the file and store the result in f_string.
     bool ReadLine(std::string& f_string);
 
+    /// Maps the whole file read only into memory. The mapping stays valid until the FileReader is destroyed. An
+    /// empty file is mapped successfully to an empty view.
+    /// @return false if the file could not be opened or mapped, otherwise true
+    bool MapFile();
+
+    /// Read only view on the whole mapped file content. MapFile has to be called successfully beforehand.
+    FileView Content() const;
+
+    /// Reads the next line of the mapped file as a view into the mapping, without the line ending and without any
+    /// allocation or copy. MapFile has to be called successfully beforehand.
+    /// @param[out] f_line view on the line, valid until the FileReader is destroyed
+    /// @return false when the end of the file is reached, otherwise true
+    bool ReadLineView(FileView& f_line);
+
   private:
     std::fstream m_fileStream;
     std::string m_file;
     ErrorMode m_errorMode;
+
+    const char* m_mappedContent{nullptr};
+    uint64_t m_mappedSize{0u};
+    uint64_t m_mappedReadOffset{0u};
+    int m_mmapFileDescriptor{-1};
 };
 
 } // namespace cxx
@@ -0,0 +1,263 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/internal/concurrent/loffli.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace iox
+{
+namespace cxx
+{
+/// @brief Lock-free variant of ObjectPool. The free cells are managed by a
+/// concurrent::LoFFLi free index list, so create and free are a single CAS in
+/// the uncontended case instead of the linear free-slot search of ObjectPool,
+/// and several threads can create and free concurrently without an external
+/// mutex. Intended for pools of small objects that are passed between threads,
+/// like the queued CaproMessages and timer nodes in RouDi
+///
+/// In contrast to ObjectPool there is no index API and no iteration; the
+/// handle to a pooled object is its pointer. Each cell is owned by exactly one
+/// thread between create and free, concurrent access to the same object has to
+/// be synchronized by the user as usual
+template <typename T, uint32_t CAPACITY = 1u>
+class ConcurrentObjectPool
+{
+  public:
+    /// creating or freeing more objects per call keeps the batch on the stack
+    static constexpr uint32_t MAX_BATCH_SIZE{256u};
+
+    ConcurrentObjectPool()
+    {
+        m_freeIndices.init(m_freeIndicesMemory, CAPACITY);
+    }
+
+    ConcurrentObjectPool(const ConcurrentObjectPool&) = delete;
+    ConcurrentObjectPool(ConcurrentObjectPool&&) = delete;
+    ConcurrentObjectPool& operator=(const ConcurrentObjectPool&) = delete;
+    ConcurrentObjectPool& operator=(ConcurrentObjectPool&&) = delete;
+
+    /// destroys the objects still in the pool; must not run concurrently with
+    /// create or free
+    ~ConcurrentObjectPool()
+    {
+        for (uint32_t i = 0u; i < CAPACITY; ++i)
+        {
+            if (m_isUsed[i] && m_wasConstructed[i])
+            {
+                reinterpret_cast<T*>(m_values[i])->~T();
+            }
+        }
+    }
+
+    /// @brief acquires raw memory for an object T without constructing it
+    /// @return pointer to uninitialized memory, nullptr if the pool is exhausted
+    T* allocate()
+    {
+        uint32_t l_index;
+        if (!m_freeIndices.pop(l_index))
+        {
+            return nullptr;
+        }
+        m_wasConstructed[l_index] = false;
+        m_isUsed[l_index] = true;
+        m_size.fetch_add(1u, std::memory_order_relaxed);
+        return reinterpret_cast<T*>(m_values[l_index]);
+    }
+
+    /// @brief default constructs an object in the pool
+    /// @return pointer to the new object, nullptr if the pool is exhausted
+    T* create()
+    {
+        uint32_t l_index;
+        if (!m_freeIndices.pop(l_index))
+        {
+            return nullptr;
+        }
+        T* l_object = new (&m_values[l_index]) T;
+        m_wasConstructed[l_index] = true;
+        m_isUsed[l_index] = true;
+        m_size.fetch_add(1u, std::memory_order_relaxed);
+        return l_object;
+    }
+
+    /// @brief constructs an object in the pool with constructor arguments
+    /// @return pointer to the new object, nullptr if the pool is exhausted
+    template <typename... Args>
+    T* create(Args&&... args)
+    {
+        uint32_t l_index;
+        if (!m_freeIndices.pop(l_index))
+        {
+            return nullptr;
+        }
+        T* l_object = new (&m_values[l_index]) T(std::forward<Args>(args)...);
+        m_wasConstructed[l_index] = true;
+        m_isUsed[l_index] = true;
+        m_size.fetch_add(1u, std::memory_order_relaxed);
+        return l_object;
+    }
+
+    /// @brief returns an object to the pool, the destructor is called if and
+    /// only if the object was constructed by the pool
+    /// @param [in] f_object object previously acquired from this pool
+    /// @return true on success, false if f_object does not belong to the pool
+    ///         or its cell is already free
+    bool free(T* f_object)
+    {
+        uint32_t l_index;
+        if (!pointerToIndex(f_object, l_index) || !m_isUsed[l_index])
+        {
+            return false;
+        }
+        if (m_wasConstructed[l_index])
+        {
+            f_object->~T();
+        }
+        m_isUsed[l_index] = false;
+        m_size.fetch_sub(1u, std::memory_order_relaxed);
+        return m_freeIndices.push(l_index);
+    }
+
+    /// @brief default constructs up to f_count objects with a single detach of
+    /// the free-list, considerably cheaper than f_count create calls when
+    /// several threads allocate in bursts
+    /// @param [out] f_objects array with space for f_count object pointers
+    /// @param [in] f_count maximum number of objects to create
+    /// @return the number of objects created, less than f_count if the pool
+    ///         runs out of free cells
+    uint32_t createBatch(T** f_objects, const uint32_t f_count)
+    {
+        uint32_t l_created = 0u;
+        while (l_created < f_count)
+        {
+            uint32_t l_indices[MAX_BATCH_SIZE];
+            const uint32_t l_request = std::min(f_count - l_created, MAX_BATCH_SIZE);
+            const uint32_t l_popped = m_freeIndices.popBatch(l_indices, l_request);
+            for (uint32_t i = 0u; i < l_popped; ++i)
+            {
+                const uint32_t l_index = l_indices[i];
+                f_objects[l_created + i] = new (&m_values[l_index]) T;
+                m_wasConstructed[l_index] = true;
+                m_isUsed[l_index] = true;
+            }
+            m_size.fetch_add(l_popped, std::memory_order_relaxed);
+            l_created += l_popped;
+            if (l_popped < l_request)
+            {
+                break;
+            }
+        }
+        return l_created;
+    }
+
+    /// @brief returns f_count objects to the pool with a single splice into the
+    /// free-list, the counterpart to createBatch for the release side
+    /// @param [in] f_objects array of f_count objects previously acquired from
+    ///             this pool
+    /// @param [in] f_count number of objects to free
+    /// @return true on success, false if any object does not belong to the pool
+    bool freeBatch(T* const* f_objects, const uint32_t f_count)
+    {
+        bool l_success = true;
+        uint32_t l_freed = 0u;
+        while (l_freed < f_count)
+        {
+            uint32_t l_indices[MAX_BATCH_SIZE];
+            const uint32_t l_slice = std::min(f_count - l_freed, MAX_BATCH_SIZE);
+            uint32_t l_valid = 0u;
+            for (uint32_t i = 0u; i < l_slice; ++i)
+            {
+                uint32_t l_index;
+                if (!pointerToIndex(f_objects[l_freed + i], l_index) || !m_isUsed[l_index])
+                {
+                    l_success = false;
+                    continue;
+                }
+                if (m_wasConstructed[l_index])
+                {
+                    f_objects[l_freed + i]->~T();
+                }
+                m_isUsed[l_index] = false;
+                l_indices[l_valid++] = l_index;
+            }
+            m_size.fetch_sub(l_valid, std::memory_order_relaxed);
+            if (l_valid > 0u && !m_freeIndices.pushBatch(l_indices, l_valid))
+            {
+                l_success = false;
+            }
+            l_freed += l_slice;
+        }
+        return l_success;
+    }
+
+    /// @return the current number of objects in the pool; only a snapshot when
+    ///         other threads create or free concurrently
+    uint32_t size() const
+    {
+        return m_size.load(std::memory_order_relaxed);
+    }
+
+    uint32_t capacity() const
+    {
+        return CAPACITY;
+    }
+
+  private:
+    bool pointerToIndex(const T* const f_object, uint32_t& f_index) const
+    {
+        const char* l_pointer = reinterpret_cast<const char*>(f_object);
+        const char* l_first = reinterpret_cast<const char*>(&m_values[0]);
+        if (l_pointer < l_first || l_pointer > reinterpret_cast<const char*>(&m_values[CAPACITY - 1u]))
+        {
+            return false;
+        }
+        const auto l_delta = l_pointer - l_first;
+        if (l_delta % sizeof(T) != 0)
+        {
+            return false;
+        }
+        f_index = static_cast<uint32_t>(l_delta / sizeof(T));
+        return true;
+    }
+
+  private:
+    static constexpr size_t CHUNKSIZE = sizeof(T);
+    using Chunk = char[CHUNKSIZE];
+
+    alignas(alignof(T)) Chunk m_values[CAPACITY];
+    /// both flags are only touched by the thread owning the cell between pop
+    /// and push of its index, the free-list provides the synchronization
+    bool m_isUsed[CAPACITY] = {};
+    bool m_wasConstructed[CAPACITY] = {};
+
+    uint32_t m_freeIndicesMemory[CAPACITY + 1u];
+    concurrent::LoFFLi m_freeIndices;
+    std::atomic<uint32_t> m_size{0u};
+};
+
+template <typename T, uint32_t CAPACITY>
+constexpr uint32_t ConcurrentObjectPool<T, CAPACITY>::MAX_BATCH_SIZE;
+
+template <typename T, uint32_t CAPACITY>
+constexpr size_t ConcurrentObjectPool<T, CAPACITY>::CHUNKSIZE;
+
+} // namespace cxx
+} // namespace iox
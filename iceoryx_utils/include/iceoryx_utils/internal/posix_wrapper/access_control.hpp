@@ -78,6 +78,11 @@ class AccessController
     bool addPermissionEntry(const Category f_category, const Permission f_permission, const string_t& f_name);
 
     /// @brief Write permission entries stored by the AccessController to a file identified by a file descriptor.
+    ///
+    /// Entries which only consist of the standard user/group/others categories are applied with fchmod and skip
+    /// the ACL machinery entirely. For all other entries the compiled ACL is cached per permission tuple and
+    /// reused, so applying the same rights to many files (e.g. the shared memory segments at RouDi startup) pays
+    /// the ACL compilation only once.
     /// @param[f_fileDescriptor] identifier for a file (can be regular file, shared memory file, message queue file...
     /// everything is a file).
     /// @return true if succesful. If false, you can assume that the file has not been touched at all.
@@ -93,12 +98,31 @@ class AccessController
         unsigned int m_id;
     };
 
-    cxx::vector<PermissionEntry, MaxNumOfPermissions> m_permissions;
+    using permissionVector_t = cxx::vector<PermissionEntry, MaxNumOfPermissions>;
+
+    /// @brief maximum number of compiled ACLs which are cached and shared by all AccessController instances
+    static constexpr int32_t AclCacheCapacity = 16;
+
+    permissionVector_t m_permissions;
 
     smartAclPointer_t createACL(const int f_numEntries) const;
     bool createACLEntry(const acl_t f_ACL, const PermissionEntry& f_entry) const;
     bool addAclPermission(acl_permset_t f_permset, acl_perm_t f_perm) const;
 
+    /// @brief compiles and validates an ACL from the stored permission entries
+    /// @return the compiled ACL, a nullptr smart pointer if an entry could not be created or the ACL is invalid
+    smartAclPointer_t compileACL() const;
+
+    /// @brief true if the entries consist of exactly one user, one group and one others category, which can be
+    ///         expressed as standard mode bits without any ACL
+    bool isStandardPermissionSet() const;
+
+    /// @brief applies the standard user/group/others entries with fchmod
+    bool applyStandardFilePermissions(const int f_fileDescriptor) const;
+
+    /// @brief true if f_other contains exactly the same permission entries in the same order
+    bool hasSamePermissions(const permissionVector_t& f_other) const;
+
     bool m_useACLMask{false};
 };
 } // namespace posix
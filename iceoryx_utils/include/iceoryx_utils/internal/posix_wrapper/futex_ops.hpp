@@ -0,0 +1,62 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <ctime>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace iox
+{
+namespace posix
+{
+namespace internal
+{
+#if defined(__linux__) && defined(__NR_futex)
+// the non private operations so that the futex word works across processes
+constexpr int32_t FUTEX_OP_WAIT{0};
+constexpr int32_t FUTEX_OP_WAKE{1};
+
+/// @brief parks the caller on the futex word as long as it contains f_expected
+/// @note returns immediately with EAGAIN when the word changed before parking
+///         and with EINTR on signals; both cases are handled by re-checking in
+///         the caller
+inline void futexWait(std::atomic<uint32_t>* f_word, const uint32_t f_expected) noexcept
+{
+    syscall(static_cast<long>(__NR_futex), f_word, FUTEX_OP_WAIT, f_expected, nullptr, nullptr, 0);
+}
+
+/// @brief parks the caller on the futex word with a relative timeout
+/// @note a premature return with EAGAIN, EINTR or ETIMEDOUT is handled by
+///         re-checking in the caller
+inline void futexTimedWait(std::atomic<uint32_t>* f_word, const uint32_t f_expected, const timespec& f_timeout) noexcept
+{
+    syscall(static_cast<long>(__NR_futex), f_word, FUTEX_OP_WAIT, f_expected, &f_timeout, nullptr, 0);
+}
+
+/// @brief wakes one thread parked on the futex word
+inline void futexWakeOne(std::atomic<uint32_t>* f_word) noexcept
+{
+    syscall(static_cast<long>(__NR_futex), f_word, FUTEX_OP_WAKE, 1u, nullptr, nullptr, 0);
+}
+#endif
+} // namespace internal
+} // namespace posix
+} // namespace iox
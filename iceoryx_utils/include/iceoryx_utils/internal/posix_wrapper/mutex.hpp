@@ -58,7 +58,11 @@ class mutex
     ///         a cxx::nullopt_t object is returned. You always need to verify
     ///         the success of the factory by calling the has_value() optional
     ///         method.
-    static cxx::optional<mutex> CreateMutex(const bool f_isRecursive);
+    ///         With an adaptive spin limit greater zero, lock first tries to
+    ///         acquire the mutex that many times with exponential backoff
+    ///         before parking on the expensive futex call; worthwhile for
+    ///         critical sections which are much shorter than a system call.
+    static cxx::optional<mutex> CreateMutex(const bool f_isRecursive, const uint32_t f_adaptiveSpinLimit = 0u);
     ~mutex();
 
     /// @brief all copy and move assignment methods need to be deleted otherwise
@@ -94,7 +98,7 @@ class mutex
   protected:
     /// @brief The constructor needs to be private since the construction of the
     ///         mutex can fail.
-    mutex(const bool f_isRecursive);
+    mutex(const bool f_isRecursive, const uint32_t f_adaptiveSpinLimit);
     /// @brief Only the CreateMutex function is allowed to move a mutex. And since
     ///         it is the factory and no lock/unlock can happen before the factory
     ///         returned, this place is the only exception where a mutex is allowed
@@ -103,6 +107,7 @@ class mutex
 
     pthread_mutex_t m_handle;
     bool m_isInitialized = true;
+    uint32_t m_adaptiveSpinLimit{0u};
 };
 } // namespace posix
 } // namespace iox
@@ -47,6 +47,21 @@ class SharedMemoryObject
     void* allocate(const uint64_t f_size, const uint64_t f_alignment = Allocator::MEMORY_ALIGNMENT);
     void finalizeAllocation();
 
+    /// Asks the kernel to back the underlying mapping with transparent huge pages,
+    /// reducing TLB pressure for large segments
+    /// @return true if the advice was accepted, false if the platform does not support it
+    bool adviseHugePages();
+
+    /// Touches every page of the underlying mapping once so that the page faults are
+    /// paid at startup and not on the first real access to the memory
+    void prefault();
+
+    /// Binds the physical page allocation of the underlying mapping to a NUMA node;
+    /// only affects pages faulted in afterwards, combine with prefault()
+    /// @param [in] f_numaNode the node the pages shall be allocated on
+    /// @return true if the policy was applied, false if the platform does not support it
+    bool bindToNumaNode(const uint32_t f_numaNode);
+
     Allocator* getAllocator();
     void* getBaseAddress() const;
 
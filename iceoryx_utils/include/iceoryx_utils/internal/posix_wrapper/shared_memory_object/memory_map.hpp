@@ -45,6 +45,21 @@ class MemoryMap
     ~MemoryMap();
     void* getBaseAddress() const;
 
+    /// Asks the kernel to back this mapping with transparent huge pages (MADV_HUGEPAGE).
+    /// @return true if the advice was accepted, false if the platform does not support it
+    bool adviseHugePages();
+
+    /// Touches every page of the mapping once so that the page faults are paid here
+    /// and not on the first real access to the memory
+    void prefault();
+
+    /// Binds the physical page allocation of this mapping to a NUMA node (mbind with
+    /// MPOL_BIND); only pages which are faulted in afterwards are affected, so this
+    /// should be combined with prefault()
+    /// @param [in] f_numaNode the node the pages shall be allocated on
+    /// @return true if the policy was applied, false if the platform does not support it
+    bool bindToNumaNode(const uint32_t f_numaNode);
+
     friend class posix::SharedMemoryObject;
     friend class cxx::optional<MemoryMap>;
 
@@ -0,0 +1,85 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <pthread.h>
+
+namespace iox
+{
+namespace posix
+{
+/// @brief Wrapper for a pthread based reader writer lock which does not use
+///         exceptions! Multiple readers can hold the lock at the same time
+///         via lock_shared while lock acquires it exclusively. In contrast
+///         to posix::mutex it is default constructible via the static
+///         initializer, so it can be used directly as a locking policy for
+///         concurrent::smart_lock.
+/// @code
+///     #include "iceoryx_utils/internal/posix_wrapper/shared_mutex.hpp"
+///
+///     posix::shared_mutex registryLock;
+///
+///     // reader side, can run concurrently
+///     registryLock.lock_shared();
+///     // ... lookup stuff
+///     registryLock.unlock_shared();
+///
+///     // writer side, exclusive
+///     registryLock.lock();
+///     // ... modify stuff
+///     registryLock.unlock();
+/// @endcode
+class shared_mutex
+{
+  public:
+    shared_mutex() = default;
+    ~shared_mutex();
+
+    /// @brief all copy and move methods need to be deleted otherwise
+    ///         undefined behavior or race conditions will occure if you copy
+    ///         or move a lock which is or will be held
+    shared_mutex(const shared_mutex&) = delete;
+    shared_mutex(shared_mutex&&) = delete;
+    shared_mutex& operator=(const shared_mutex&) = delete;
+    shared_mutex& operator=(shared_mutex&&) = delete;
+
+    /// @brief Acquires the lock exclusively and returns true if the
+    ///         underlying c function did not returned any error. Blocks until
+    ///         all readers and writers released the lock.
+    bool lock();
+    /// @brief Releases the exclusively held lock and returns true if the
+    ///         underlying c function did not returned any error.
+    bool unlock();
+    /// @brief  Tries to acquire the lock exclusively, returns false if the
+    ///         lock is already held or the c function fails, otherwise true.
+    bool try_lock();
+
+    /// @brief Acquires the lock for reading and returns true if the
+    ///         underlying c function did not returned any error. Multiple
+    ///         readers can hold the lock at the same time.
+    bool lock_shared();
+    /// @brief Releases the lock held for reading and returns true if the
+    ///         underlying c function did not returned any error.
+    bool unlock_shared();
+    /// @brief  Tries to acquire the lock for reading, returns false if the
+    ///         lock is held exclusively or the c function fails, otherwise
+    ///         true.
+    bool try_lock_shared();
+
+  private:
+    pthread_rwlock_t m_handle = PTHREAD_RWLOCK_INITIALIZER;
+};
+} // namespace posix
+} // namespace iox
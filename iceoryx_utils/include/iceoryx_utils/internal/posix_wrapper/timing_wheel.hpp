@@ -0,0 +1,224 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/cxx/optional.hpp"
+#include "iceoryx_utils/internal/units/duration.hpp"
+#include "iceoryx_utils/posix_wrapper/futex_semaphore.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace posix
+{
+/// @brief Process-wide hierarchical timing wheel which multiplexes all
+///         periodic and single shot tasks onto one wait primitive (a timerfd
+///         on Linux, a condition variable otherwise) instead of one kernel
+///         timer per posix::Timer instance. Tasks are hashed into slots by
+///         their expiration tick; a tick is one millisecond and four levels
+///         with 256 slots each cover a range of roughly 50 days. Insertion,
+///         removal and advancing the wheel by one tick are O(1), expired
+///         tasks of a higher level cascade into the finer grained levels.
+/// @concurrent thread safe; expiry detection runs on the dispatcher thread
+///             which only advances the wheel and enqueues due tasks into a
+///             run queue, the callbacks are executed sequentially on a
+///             separate executor thread. A slow callback therefore delays
+///             other callbacks but never the expiry detection and overrun
+///             accounting of the remaining timers
+class TimingWheel
+{
+  public:
+    static constexpr uint32_t MAX_NUMBER_OF_TASKS{256u};
+    static constexpr uint64_t TICK_DURATION_NS{1000000u};
+    static constexpr uint32_t NUMBER_OF_LEVELS{4u};
+    static constexpr uint32_t SLOTS_PER_LEVEL{256u};
+    static constexpr uint32_t INVALID_INDEX{0xFFFFFFFFu};
+
+    /// @brief handle to a registered task; the generation detects stale
+    ///         handles whose pool slot was already recycled
+    struct TaskHandle
+    {
+        uint32_t index{INVALID_INDEX};
+        uint32_t generation{0u};
+    };
+
+    /// @brief returns the process-wide timing wheel, the dispatcher thread is
+    ///         started on first use
+    static TimingWheel& instance() noexcept;
+
+    TimingWheel(const TimingWheel&) = delete;
+    TimingWheel(TimingWheel&&) = delete;
+    TimingWheel& operator=(const TimingWheel&) = delete;
+    TimingWheel& operator=(TimingWheel&&) = delete;
+
+    /// @brief registers a task; the task is not armed yet
+    /// @param[in] callback callback which is executed on expiration
+    /// @return handle to the task, nullopt_t if the task pool is exhausted
+    ///         or the callback is invalid
+    cxx::optional<TaskHandle> registerTask(const std::function<void()>& callback) noexcept;
+
+    /// @brief unregisters a task; blocks until a concurrently running
+    ///         callback of this task has returned, afterwards the callback is
+    ///         guaranteed to never be called again
+    /// @note must not be called from within the callback itself
+    /// @param[in] handle handle acquired with registerTask
+    void unregisterTask(const TaskHandle& handle) noexcept;
+
+    /// @brief arms a task; a previously armed expiration is discarded
+    /// @param[in] handle handle acquired with registerTask
+    /// @param[in] timeToWait duration until the callback is executed
+    /// @param[in] periodic true for cyclic execution with timeToWait period
+    /// @return false if the handle is invalid, otherwise true
+    bool startTask(const TaskHandle& handle, const units::Duration timeToWait, const bool periodic) noexcept;
+
+    /// @brief disarms a task; a callback which is executed right now may
+    ///         still finish, afterwards the callback is not called again
+    ///         until the next startTask
+    /// @param[in] handle handle acquired with registerTask
+    /// @return false if the handle is invalid, otherwise true
+    bool stopTask(const TaskHandle& handle) noexcept;
+
+    /// @brief returns the remaining time until the task expires the next
+    ///         time, zero if the task is not armed
+    /// @param[in] handle handle acquired with registerTask
+    /// @return remaining duration, nullopt_t if the handle is invalid
+    cxx::optional<units::Duration> timeUntilExpiration(const TaskHandle& handle) noexcept;
+
+    /// @brief returns the number of expirations which could not be executed
+    ///         in time since the task was armed (e.g. when a callback runs
+    ///         longer than the period)
+    /// @param[in] handle handle acquired with registerTask
+    /// @return number of overruns, nullopt_t if the handle is invalid
+    cxx::optional<uint64_t> getOverruns(const TaskHandle& handle) noexcept;
+
+    /// @brief runtime accounting of the callback of one task, measured by the
+    ///         executor thread around every invocation; identifies the slow
+    ///         consumer when callbacks pile up in the run queue
+    struct RuntimeStatistics
+    {
+        uint64_t executionCount{0u};
+        uint64_t totalRuntimeNs{0u};
+        uint64_t maxRuntimeNs{0u};
+    };
+
+    /// @brief returns the runtime accounting of a task since registerTask
+    /// @param[in] handle handle acquired with registerTask
+    /// @return the statistics, nullopt_t if the handle is invalid
+    cxx::optional<RuntimeStatistics> getRuntimeStatistics(const TaskHandle& handle) noexcept;
+
+  private:
+    struct Task
+    {
+        std::function<void()> callback;
+        uint64_t deadlineTick{0u};
+        uint64_t periodTicks{0u};
+        uint64_t overruns{0u};
+        RuntimeStatistics statistics;
+        uint32_t generation{0u};
+        uint32_t next{INVALID_INDEX};
+        uint32_t level{0u};
+        uint32_t slot{0u};
+        bool inUse{false};
+        bool armed{false};
+        bool linked{false};
+        bool periodic{false};
+        bool queued{false};
+        bool executing{false};
+    };
+
+    /// @brief one expiry handed from the dispatcher to the executor; the
+    ///         generation detects a task which was unregistered and recycled
+    ///         while its expiry was still waiting in the run queue
+    struct RunQueueEntry
+    {
+        uint32_t index{INVALID_INDEX};
+        uint32_t generation{0u};
+    };
+
+    TimingWheel() noexcept;
+    ~TimingWheel() noexcept;
+
+    /// @brief validates the handle, expects m_mutex to be locked
+    Task* taskFromHandle(const TaskHandle& handle) noexcept;
+
+    /// @brief current time as tick count relative to the wheel start
+    uint64_t nowTick() const noexcept;
+
+    /// @brief inserts the task into the slot matching its deadline, expects
+    ///         m_mutex to be locked
+    void link(const uint32_t taskIndex) noexcept;
+
+    /// @brief removes the task from its slot, expects m_mutex to be locked
+    void unlink(const uint32_t taskIndex) noexcept;
+
+    /// @brief moves all tasks of a higher level slot into the finer grained
+    ///         levels, expects m_mutex to be locked
+    void cascade(const uint32_t level, const uint32_t slot) noexcept;
+
+    /// @brief advances the wheel to targetTick and collects the expired
+    ///         tasks, expects m_mutex to be locked
+    void advanceTo(const uint64_t targetTick, uint32_t (&dueTasks)[MAX_NUMBER_OF_TASKS], uint32_t& dueCount) noexcept;
+
+    /// @brief smallest deadline of all armed tasks, expects m_mutex to be locked
+    uint64_t nextDeadline() const noexcept;
+
+    /// @brief rearms the wait primitive for the given tick
+    void armWakeup(const uint64_t tick) noexcept;
+
+    /// @brief hands a due task over to the executor; an expiry whose previous
+    ///         one is still queued or executing is coalesced and counted as
+    ///         overrun, expects m_mutex to be locked
+    void enqueueDueTask(const uint32_t taskIndex) noexcept;
+
+    void dispatcherLoop() noexcept;
+    void executorLoop() noexcept;
+
+  private:
+    Task m_tasks[MAX_NUMBER_OF_TASKS];
+    uint32_t m_wheel[NUMBER_OF_LEVELS][SLOTS_PER_LEVEL];
+    uint64_t m_currentTick{0u};
+    uint64_t m_startTimeNs{0u};
+
+    /// ring buffer between expiry detection and callback execution; one slot
+    /// per task suffices since pending expirations of a task are coalesced.
+    /// The executor is woken via a FutexSemaphore and not a condition
+    /// variable, a parked condition variable waiter copied into a forked
+    /// child would block the static destruction there
+    RunQueueEntry m_runQueue[MAX_NUMBER_OF_TASKS];
+    uint32_t m_runQueueHead{0u};
+    uint32_t m_runQueueCount{0u};
+    FutexSemaphore m_runQueuePending;
+
+    std::mutex m_mutex;
+    std::condition_variable m_executionFinished;
+    std::atomic<bool> m_keepRunning{true};
+#if defined(__linux__)
+    int m_timerFd{-1};
+#else
+    std::condition_variable m_wakeup;
+    uint64_t m_wakeupTick{0u};
+#endif
+    std::thread m_dispatcher;
+    std::thread m_executor;
+};
+
+} // namespace posix
+} // namespace iox
@@ -0,0 +1,122 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/cxx/helplets.hpp"
+#include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
+
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace iox
+{
+/// @brief flat map over externally provided storage, addressed via
+///        relative_ptr so it can live in shared memory. The keys are kept in a
+///        sorted array separate from the values, a lookup is a binary search
+///        over the dense key array and touches no value cache lines; values
+///        are constructed in place. Insert and erase shift the tail of both
+///        arrays and are therefore O(n), which fits the typical shm use of
+///        many lookups on a rarely changing membership. Keys need operator<
+///        and operator==, values a move constructor. Not thread-safe
+template <typename Key, typename T>
+class RelocatableFlatMap
+{
+    /// the key array is shifted with plain assignments and never destructed,
+    /// which is only correct for trivially copyable keys; typical shm keys
+    /// like integer ids and hashes fulfill this
+    static_assert(std::is_trivially_copyable<Key>::value, "RelocatableFlatMap requires a trivially copyable key");
+
+  public:
+    RelocatableFlatMap() = default;
+
+    /// @brief destructs the contained values; the storage itself is owned by
+    ///         the provider of init
+    ~RelocatableFlatMap();
+
+    RelocatableFlatMap(const RelocatableFlatMap&) = delete;
+    RelocatableFlatMap(RelocatableFlatMap&&) = delete;
+    RelocatableFlatMap& operator=(const RelocatableFlatMap&) = delete;
+    RelocatableFlatMap& operator=(RelocatableFlatMap&&) = delete;
+
+    /// @brief initializes the map with external storage
+    /// @param [in] f_storage memory of requiredMemorySize(f_capacity) bytes,
+    ///             aligned to the stricter of alignof(Key) and alignof(T)
+    /// @param [in] f_capacity maximum number of key value pairs
+    void init(cxx::not_null<void*> f_storage, const uint64_t f_capacity);
+
+    /// @brief calculates the storage size for a map of f_capacity pairs; the
+    ///         value array is placed behind the key array at an offset padded
+    ///         to alignof(T)
+    static constexpr uint64_t requiredMemorySize(const uint64_t f_capacity)
+    {
+        return keyStorageSize(f_capacity) + f_capacity * sizeof(T);
+    }
+
+    /// @brief constructs the value for the given key in place
+    /// @return pointer to the constructed value, nullptr if the map is full
+    ///         or the key is already contained
+    template <typename... Targs>
+    T* emplace(const Key& f_key, Targs&&... args);
+
+    /// @brief looks the key up with a binary search over the key array
+    /// @return pointer to the value, nullptr if the key is not contained
+    T* find(const Key& f_key);
+    const T* find(const Key& f_key) const;
+
+    /// @brief removes the pair with the given key
+    /// @return true if a pair was removed, false if the key is not contained
+    bool erase(const Key& f_key);
+
+    /// @brief destructs all values and empties the map
+    void clear();
+
+    /// @brief key of the pair at the given position, ordered ascending;
+    ///         together with valueAt this allows an index based iteration
+    const Key& keyAt(const uint64_t f_index) const;
+
+    /// @brief value of the pair at the given position
+    T& valueAt(const uint64_t f_index);
+    const T& valueAt(const uint64_t f_index) const;
+
+    uint64_t capacity() const;
+    uint64_t size() const;
+    bool empty() const;
+
+  private:
+    static constexpr uint64_t keyStorageSize(const uint64_t f_capacity)
+    {
+        // cxx::align is not constexpr, so the padding to alignof(T) is done here
+        return ((f_capacity * sizeof(Key) + alignof(T) - 1u) / alignof(T)) * alignof(T);
+    }
+
+    /// position of the first key which is not less than f_key
+    uint64_t lowerBound(const Key& f_key) const;
+
+    Key* keys();
+    const Key* keys() const;
+    T* values();
+    const T* values() const;
+
+    relative_ptr<Key> m_keys;
+    relative_ptr<T> m_values;
+    uint64_t m_capacity{0u};
+    uint64_t m_size{0u};
+};
+
+} // namespace iox
+
+#include "iceoryx_utils/internal/relocatable_container/relocatable_flat_map.inl"
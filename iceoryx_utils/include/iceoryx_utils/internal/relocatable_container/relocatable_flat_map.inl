@@ -0,0 +1,208 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/internal/relocatable_container/relocatable_flat_map.hpp"
+
+namespace iox
+{
+template <typename Key, typename T>
+inline RelocatableFlatMap<Key, T>::~RelocatableFlatMap()
+{
+    clear();
+}
+
+template <typename Key, typename T>
+inline void RelocatableFlatMap<Key, T>::init(cxx::not_null<void*> f_storage, const uint64_t f_capacity)
+{
+    uint8_t* l_base = static_cast<uint8_t*>(static_cast<void*>(f_storage));
+    m_keys = reinterpret_cast<Key*>(l_base);
+    m_values = reinterpret_cast<T*>(l_base + keyStorageSize(f_capacity));
+    m_capacity = f_capacity;
+    m_size = 0u;
+}
+
+template <typename Key, typename T>
+template <typename... Targs>
+inline T* RelocatableFlatMap<Key, T>::emplace(const Key& f_key, Targs&&... args)
+{
+    if (m_size >= m_capacity)
+    {
+        return nullptr;
+    }
+
+    const uint64_t l_position = lowerBound(f_key);
+    Key* l_keys = keys();
+    T* l_values = values();
+    if (l_position < m_size && l_keys[l_position] == f_key)
+    {
+        return nullptr;
+    }
+
+    // shift the tail of both arrays one slot to the right, the last value
+    // slot is raw storage and gets a move construction, the rest move
+    // assignments
+    for (uint64_t i = m_size; i > l_position; --i)
+    {
+        if (i == m_size)
+        {
+            new (l_values + i) T(std::move(l_values[i - 1u]));
+        }
+        else
+        {
+            l_values[i] = std::move(l_values[i - 1u]);
+        }
+        l_keys[i] = l_keys[i - 1u];
+    }
+
+    l_keys[l_position] = f_key;
+    if (l_position < m_size)
+    {
+        l_values[l_position].~T();
+    }
+    new (l_values + l_position) T(std::forward<Targs>(args)...);
+    ++m_size;
+    return l_values + l_position;
+}
+
+template <typename Key, typename T>
+inline T* RelocatableFlatMap<Key, T>::find(const Key& f_key)
+{
+    const uint64_t l_position = lowerBound(f_key);
+    if (l_position < m_size && keys()[l_position] == f_key)
+    {
+        return values() + l_position;
+    }
+    return nullptr;
+}
+
+template <typename Key, typename T>
+inline const T* RelocatableFlatMap<Key, T>::find(const Key& f_key) const
+{
+    return const_cast<RelocatableFlatMap*>(this)->find(f_key);
+}
+
+template <typename Key, typename T>
+inline bool RelocatableFlatMap<Key, T>::erase(const Key& f_key)
+{
+    const uint64_t l_position = lowerBound(f_key);
+    Key* l_keys = keys();
+    T* l_values = values();
+    if (l_position >= m_size || !(l_keys[l_position] == f_key))
+    {
+        return false;
+    }
+
+    for (uint64_t i = l_position; i + 1u < m_size; ++i)
+    {
+        l_keys[i] = l_keys[i + 1u];
+        l_values[i] = std::move(l_values[i + 1u]);
+    }
+    --m_size;
+    l_values[m_size].~T();
+    return true;
+}
+
+template <typename Key, typename T>
+inline void RelocatableFlatMap<Key, T>::clear()
+{
+    T* l_values = values();
+    for (uint64_t i = 0u; i < m_size; ++i)
+    {
+        l_values[i].~T();
+    }
+    m_size = 0u;
+}
+
+template <typename Key, typename T>
+inline const Key& RelocatableFlatMap<Key, T>::keyAt(const uint64_t f_index) const
+{
+    return keys()[f_index];
+}
+
+template <typename Key, typename T>
+inline T& RelocatableFlatMap<Key, T>::valueAt(const uint64_t f_index)
+{
+    return values()[f_index];
+}
+
+template <typename Key, typename T>
+inline const T& RelocatableFlatMap<Key, T>::valueAt(const uint64_t f_index) const
+{
+    return values()[f_index];
+}
+
+template <typename Key, typename T>
+inline uint64_t RelocatableFlatMap<Key, T>::capacity() const
+{
+    return m_capacity;
+}
+
+template <typename Key, typename T>
+inline uint64_t RelocatableFlatMap<Key, T>::size() const
+{
+    return m_size;
+}
+
+template <typename Key, typename T>
+inline bool RelocatableFlatMap<Key, T>::empty() const
+{
+    return m_size == 0u;
+}
+
+template <typename Key, typename T>
+inline uint64_t RelocatableFlatMap<Key, T>::lowerBound(const Key& f_key) const
+{
+    const Key* l_keys = keys();
+    uint64_t l_low = 0u;
+    uint64_t l_high = m_size;
+    while (l_low < l_high)
+    {
+        const uint64_t l_mid = l_low + (l_high - l_low) / 2u;
+        if (l_keys[l_mid] < f_key)
+        {
+            l_low = l_mid + 1u;
+        }
+        else
+        {
+            l_high = l_mid;
+        }
+    }
+    return l_low;
+}
+
+template <typename Key, typename T>
+inline Key* RelocatableFlatMap<Key, T>::keys()
+{
+    return m_keys.get();
+}
+
+template <typename Key, typename T>
+inline const Key* RelocatableFlatMap<Key, T>::keys() const
+{
+    return m_keys.get();
+}
+
+template <typename Key, typename T>
+inline T* RelocatableFlatMap<Key, T>::values()
+{
+    return m_values.get();
+}
+
+template <typename Key, typename T>
+inline const T* RelocatableFlatMap<Key, T>::values() const
+{
+    return m_values.get();
+}
+
+} // namespace iox
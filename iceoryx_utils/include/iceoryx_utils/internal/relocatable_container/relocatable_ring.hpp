@@ -0,0 +1,95 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/cxx/helplets.hpp"
+#include "iceoryx_utils/cxx/optional.hpp"
+#include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
+
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace iox
+{
+/// @brief bounded ring buffer over externally provided storage, addressed via
+///        relative_ptr so it can live in shared memory; elements are
+///        constructed in place on push and destructed on pop. In contrast to
+///        concurrent::FiFo / concurrent::SoFi it is not thread-safe and has no
+///        capacity limit baked into the type, the depth is chosen at init
+template <typename T>
+class RelocatableRing
+{
+  public:
+    RelocatableRing() = default;
+
+    /// @brief destructs the remaining elements; the storage itself is owned
+    ///         by the provider of init
+    ~RelocatableRing();
+
+    RelocatableRing(const RelocatableRing&) = delete;
+    RelocatableRing(RelocatableRing&&) = delete;
+    RelocatableRing& operator=(const RelocatableRing&) = delete;
+    RelocatableRing& operator=(RelocatableRing&&) = delete;
+
+    /// @brief initializes the ring with external storage
+    /// @param [in] f_storage memory of requiredMemorySize(f_capacity) bytes,
+    ///             aligned to alignof(T)
+    /// @param [in] f_capacity maximum number of elements
+    void init(cxx::not_null<void*> f_storage, const uint64_t f_capacity);
+
+    /// @brief calculates the storage size for a ring of f_capacity elements
+    static constexpr uint64_t requiredMemorySize(const uint64_t f_capacity)
+    {
+        return f_capacity * sizeof(T);
+    }
+
+    /// @brief constructs an element in place at the back of the ring
+    /// @return true if successful, false if the ring is full
+    template <typename... Targs>
+    bool emplace(Targs&&... args);
+
+    /// @brief pushes a value into the ring
+    /// @return true if successful, false if the ring is full
+    bool push(const T& f_value);
+
+    /// @brief returns the oldest value and removes it
+    /// @return the value, nullopt if the ring is empty
+    cxx::optional<T> pop();
+
+    /// @brief returns a pointer to the oldest value without removing it
+    /// @return pointer to the oldest value, nullptr if the ring is empty
+    T* front();
+
+    /// @brief destructs the remaining elements and empties the ring
+    void clear();
+
+    uint64_t capacity() const;
+    uint64_t size() const;
+    bool empty() const;
+    bool full() const;
+
+  private:
+    T* data();
+
+    relative_ptr<T> m_data;
+    uint64_t m_capacity{0u};
+    uint64_t m_readPos{0u};
+    uint64_t m_writePos{0u};
+};
+
+} // namespace iox
+
+#include "iceoryx_utils/internal/relocatable_container/relocatable_ring.inl"
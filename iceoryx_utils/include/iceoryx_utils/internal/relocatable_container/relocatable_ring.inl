@@ -0,0 +1,116 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/internal/relocatable_container/relocatable_ring.hpp"
+
+namespace iox
+{
+template <typename T>
+inline RelocatableRing<T>::~RelocatableRing()
+{
+    clear();
+}
+
+template <typename T>
+inline void RelocatableRing<T>::init(cxx::not_null<void*> f_storage, const uint64_t f_capacity)
+{
+    m_data = static_cast<T*>(static_cast<void*>(f_storage));
+    m_capacity = f_capacity;
+    m_readPos = 0u;
+    m_writePos = 0u;
+}
+
+template <typename T>
+template <typename... Targs>
+inline bool RelocatableRing<T>::emplace(Targs&&... args)
+{
+    if (full())
+    {
+        return false;
+    }
+    new (data() + (m_writePos % m_capacity)) T(std::forward<Targs>(args)...);
+    ++m_writePos;
+    return true;
+}
+
+template <typename T>
+inline bool RelocatableRing<T>::push(const T& f_value)
+{
+    return emplace(f_value);
+}
+
+template <typename T>
+inline cxx::optional<T> RelocatableRing<T>::pop()
+{
+    if (empty())
+    {
+        return cxx::nullopt_t();
+    }
+    T* slot = data() + (m_readPos % m_capacity);
+    cxx::optional<T> out{std::move(*slot)};
+    slot->~T();
+    ++m_readPos;
+    return out;
+}
+
+template <typename T>
+inline T* RelocatableRing<T>::front()
+{
+    if (empty())
+    {
+        return nullptr;
+    }
+    return data() + (m_readPos % m_capacity);
+}
+
+template <typename T>
+inline void RelocatableRing<T>::clear()
+{
+    while (!empty())
+    {
+        pop();
+    }
+}
+
+template <typename T>
+inline uint64_t RelocatableRing<T>::capacity() const
+{
+    return m_capacity;
+}
+
+template <typename T>
+inline uint64_t RelocatableRing<T>::size() const
+{
+    return m_writePos - m_readPos;
+}
+
+template <typename T>
+inline bool RelocatableRing<T>::empty() const
+{
+    return m_writePos == m_readPos;
+}
+
+template <typename T>
+inline bool RelocatableRing<T>::full() const
+{
+    return size() == m_capacity;
+}
+
+template <typename T>
+inline T* RelocatableRing<T>::data()
+{
+    return m_data.get();
+}
+
+} // namespace iox
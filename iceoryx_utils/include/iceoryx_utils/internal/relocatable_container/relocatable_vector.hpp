@@ -0,0 +1,106 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/cxx/helplets.hpp"
+#include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
+
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace iox
+{
+/// @brief vector over externally provided storage, addressed via relative_ptr
+///        so the container and its elements can live in a shared memory
+///        segment which is mapped at different addresses in every process.
+///        The capacity is fixed at init, elements are constructed in place.
+///        Follows the init pattern of concurrent::LoFFLi: default construct,
+///        then hand in memory of requiredMemorySize() bytes. Not thread-safe
+template <typename T>
+class RelocatableVector
+{
+  public:
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    RelocatableVector() = default;
+
+    /// @brief destructs the contained elements; the storage itself is owned
+    ///         by the provider of init
+    ~RelocatableVector();
+
+    RelocatableVector(const RelocatableVector&) = delete;
+    RelocatableVector(RelocatableVector&&) = delete;
+    RelocatableVector& operator=(const RelocatableVector&) = delete;
+    RelocatableVector& operator=(RelocatableVector&&) = delete;
+
+    /// @brief initializes the vector with external storage
+    /// @param [in] f_storage memory of requiredMemorySize(f_capacity) bytes,
+    ///             aligned to alignof(T)
+    /// @param [in] f_capacity maximum number of elements
+    void init(cxx::not_null<void*> f_storage, const uint64_t f_capacity);
+
+    /// @brief calculates the storage size for a vector of f_capacity elements
+    static constexpr uint64_t requiredMemorySize(const uint64_t f_capacity)
+    {
+        return f_capacity * sizeof(T);
+    }
+
+    /// @brief forwards all arguments to the constructor of the contained
+    ///         element and performs a placement new
+    /// @return true if successful, false if the vector is already full
+    template <typename... Targs>
+    bool emplace_back(Targs&&... args);
+
+    /// @brief appends the given element at the end of the vector
+    /// @return true if successful, false if the vector is already full
+    bool push_back(const T& f_value);
+
+    /// @brief removes the last element; does nothing on an empty vector
+    void pop_back();
+
+    /// @brief calls the destructor of all contained elements and removes them
+    void clear();
+
+    /// @brief removes the element at the given position; the following
+    ///         elements are moved one place to the left so the elements stay
+    ///         contiguous
+    iterator erase(iterator f_position);
+
+    T& operator[](const uint64_t f_index);
+    const T& operator[](const uint64_t f_index) const;
+
+    T* data();
+    const T* data() const;
+
+    iterator begin();
+    const_iterator begin() const;
+    iterator end();
+    const_iterator end() const;
+
+    uint64_t capacity() const;
+    uint64_t size() const;
+    bool empty() const;
+
+  private:
+    relative_ptr<T> m_data;
+    uint64_t m_capacity{0u};
+    uint64_t m_size{0u};
+};
+
+} // namespace iox
+
+#include "iceoryx_utils/internal/relocatable_container/relocatable_vector.inl"
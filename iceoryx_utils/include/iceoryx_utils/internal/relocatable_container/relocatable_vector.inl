@@ -0,0 +1,153 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/internal/relocatable_container/relocatable_vector.hpp"
+
+namespace iox
+{
+template <typename T>
+inline RelocatableVector<T>::~RelocatableVector()
+{
+    clear();
+}
+
+template <typename T>
+inline void RelocatableVector<T>::init(cxx::not_null<void*> f_storage, const uint64_t f_capacity)
+{
+    m_data = static_cast<T*>(static_cast<void*>(f_storage));
+    m_capacity = f_capacity;
+    m_size = 0u;
+}
+
+template <typename T>
+template <typename... Targs>
+inline bool RelocatableVector<T>::emplace_back(Targs&&... args)
+{
+    if (m_size >= m_capacity)
+    {
+        return false;
+    }
+    new (data() + m_size) T(std::forward<Targs>(args)...);
+    ++m_size;
+    return true;
+}
+
+template <typename T>
+inline bool RelocatableVector<T>::push_back(const T& f_value)
+{
+    return emplace_back(f_value);
+}
+
+template <typename T>
+inline void RelocatableVector<T>::pop_back()
+{
+    if (m_size > 0u)
+    {
+        --m_size;
+        data()[m_size].~T();
+    }
+}
+
+template <typename T>
+inline void RelocatableVector<T>::clear()
+{
+    while (m_size > 0u)
+    {
+        pop_back();
+    }
+}
+
+template <typename T>
+inline typename RelocatableVector<T>::iterator RelocatableVector<T>::erase(iterator f_position)
+{
+    T* l_data = data();
+    if (f_position >= l_data && f_position < l_data + m_size)
+    {
+        for (T* element = f_position; element + 1 < l_data + m_size; ++element)
+        {
+            *element = std::move(*(element + 1));
+        }
+        --m_size;
+        l_data[m_size].~T();
+    }
+    return f_position;
+}
+
+template <typename T>
+inline T& RelocatableVector<T>::operator[](const uint64_t f_index)
+{
+    return data()[f_index];
+}
+
+template <typename T>
+inline const T& RelocatableVector<T>::operator[](const uint64_t f_index) const
+{
+    return data()[f_index];
+}
+
+template <typename T>
+inline T* RelocatableVector<T>::data()
+{
+    return m_data.get();
+}
+
+template <typename T>
+inline const T* RelocatableVector<T>::data() const
+{
+    return m_data.get();
+}
+
+template <typename T>
+inline typename RelocatableVector<T>::iterator RelocatableVector<T>::begin()
+{
+    return data();
+}
+
+template <typename T>
+inline typename RelocatableVector<T>::const_iterator RelocatableVector<T>::begin() const
+{
+    return data();
+}
+
+template <typename T>
+inline typename RelocatableVector<T>::iterator RelocatableVector<T>::end()
+{
+    return data() + m_size;
+}
+
+template <typename T>
+inline typename RelocatableVector<T>::const_iterator RelocatableVector<T>::end() const
+{
+    return data() + m_size;
+}
+
+template <typename T>
+inline uint64_t RelocatableVector<T>::capacity() const
+{
+    return m_capacity;
+}
+
+template <typename T>
+inline uint64_t RelocatableVector<T>::size() const
+{
+    return m_size;
+}
+
+template <typename T>
+inline bool RelocatableVector<T>::empty() const
+{
+    return m_size == 0u;
+}
+
+} // namespace iox
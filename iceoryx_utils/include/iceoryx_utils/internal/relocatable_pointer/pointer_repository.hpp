@@ -45,6 +45,9 @@ class PointerRepository
   public:
     static constexpr id_t INVALID_ID = std::numeric_limits<id_t>::max();
 
+    /// number of recently found ids kept in a thread-local cache by searchId()
+    static constexpr size_t SEARCH_CACHE_SIZE = 4;
+
     PointerRepository()
         : m_info(CAPACITY)
     {
@@ -95,6 +98,9 @@ class PointerRepository
             if (m_info[id].basePtr != nullptr)
             {
                 m_info[id].basePtr = nullptr;
+                // reset the end as well, otherwise searchId could still match the
+                // unregistered interval
+                m_info[id].endPtr = nullptr;
 
                 // do not search for next lower registered index but we could do it here
                 return true;
@@ -128,11 +134,30 @@ class PointerRepository
 
     id_t searchId(ptr_t ptr)
     {
+        // the segments a thread works with are few and stable, so a small thread-local
+        // cache of recently found ids avoids scanning all registered segments on the
+        // critical path of every sample; the entries are validated against the
+        // repository, stale entries after unregisterPtr() therefore cannot yield a
+        // wrong id
+        static thread_local id_t tl_recentIds[SEARCH_CACHE_SIZE] = {0};
+        static thread_local size_t tl_insertPosition = 0;
+
+        for (auto id : tl_recentIds)
+        {
+            if (id >= MIN_ID && id <= m_maxRegistered && m_info[id].basePtr != nullptr && ptr >= m_info[id].basePtr
+                && ptr <= m_info[id].endPtr)
+            {
+                return id;
+            }
+        }
+
         for (id_t id = 1; id <= m_maxRegistered; ++id)
         {
             // return first id where the ptr is in the corresponding interval
             if (ptr >= m_info[id].basePtr && ptr <= m_info[id].endPtr)
             {
+                tl_recentIds[tl_insertPosition] = id;
+                tl_insertPosition = (tl_insertPosition + 1) % SEARCH_CACHE_SIZE;
                 return id;
             }
         }
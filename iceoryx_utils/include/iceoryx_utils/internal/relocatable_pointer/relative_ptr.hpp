@@ -344,4 +344,56 @@ class relative_ptr<void> : public RelativePointer
     }
 };
 
+///@brief validated-once companion of relative_ptr. The segment id and the
+/// offset are checked against the null sentinels a single time at construction
+/// and resolved to a raw pointer through the repository; every further access
+/// is an unchecked plain pointer dereference. In contrast to relative_ptr it
+/// must therefore stay within the process and the mapping it was resolved in,
+/// which holds e.g. for a received sample between fetch and release.
+template <typename T>
+class validated_ptr
+{
+  public:
+    validated_ptr(const RelativePointer::offset_t offset, const RelativePointer::id_t id)
+    {
+        if (id != RelativePointer::NULL_POINTER_ID && offset != RelativePointer::NULL_POINTER_OFFSET)
+        {
+            // same semantics as RelativePointer::getPtr, for id 0 the base is
+            // nullptr and the offset is interpreted as a regular pointer
+            auto basePtr = RelativePointer::getBasePtr(id);
+            m_ptr = reinterpret_cast<T*>(offset + reinterpret_cast<RelativePointer::offset_t>(basePtr));
+        }
+    }
+
+    validated_ptr(const relative_ptr<T>& other)
+        : validated_ptr(other.getOffset(), other.getId())
+    {
+    }
+
+    T& operator*() const
+    {
+        return *m_ptr;
+    }
+
+    T* operator->() const
+    {
+        return m_ptr;
+    }
+
+    ///@brief the raw pointer resolved at construction, nullptr if the id or
+    /// the offset did not pass validation
+    T* get() const
+    {
+        return m_ptr;
+    }
+
+    operator bool() const
+    {
+        return m_ptr != nullptr;
+    }
+
+  private:
+    T* m_ptr{nullptr};
+};
+
 } // namespace iox
@@ -191,8 +191,12 @@ class Duration
     ///     timeval::tv_usec = microseconds
     constexpr operator struct timeval() const;
 
-    /// @brief converts time in a timespec c struct
-    struct timespec timespec(const TimeSpecReference& reference = TimeSpecReference::None) const;
+    /// @brief converts duration in a timespec c struct; pure arithmetic which
+    ///     is usable in constant expressions
+    constexpr struct timespec timespec() const;
+
+    /// @brief converts time in a timespec c struct relative to a reference time
+    struct timespec timespec(const TimeSpecReference& reference) const;
 
     //@ brief Make operators accessible, that have to be defined outside the class
     // template <typename T>
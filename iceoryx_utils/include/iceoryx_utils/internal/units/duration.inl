@@ -113,22 +113,30 @@ inline constexpr T Duration::seconds() const
     return static_cast<T>(durationInSeconds);
 }
 
+// the divisions by unit constants are written as multiplications with the
+// compile time folded reciprocal so that runtime conversions cost a single
+// multiply instead of a long double division
 template <typename T>
 inline constexpr T Duration::minutes() const
 {
-    return static_cast<T>(durationInSeconds / 60.0);
+    return static_cast<T>(durationInSeconds * (1.0L / 60.0L));
 }
 
 template <typename T>
 inline constexpr T Duration::hours() const
 {
-    return static_cast<T>(durationInSeconds / 3600.0);
+    return static_cast<T>(durationInSeconds * (1.0L / 3600.0L));
 }
 
 template <typename T>
 inline constexpr T Duration::days() const
 {
-    return static_cast<T>(durationInSeconds / (24.0 * 3600.0));
+    return static_cast<T>(durationInSeconds * (1.0L / (24.0L * 3600.0L)));
+}
+
+inline constexpr struct timespec Duration::timespec() const
+{
+    return {this->seconds<long>(), this->nanoSeconds<long>() - this->seconds<long>() * 1000000000};
 }
 
 inline constexpr Duration::operator timeval() const
@@ -32,6 +32,17 @@ enum class LogLevel : uint8_t
     kVerbose
 };
 
+/// @brief compile time ceiling for the log level; log statements above this
+/// level are disabled before the logger is even asked, the check folds into
+/// a constant and the streamed arguments are never formatted. A release
+/// build can strip debug and verbose logging completely with e.g.
+/// -DIOX_COMPILE_TIME_LOG_LEVEL=4 (the numeric value of LogLevel::kInfo)
+#if defined(IOX_COMPILE_TIME_LOG_LEVEL)
+static constexpr LogLevel CompileTimeLogLevel{static_cast<LogLevel>(IOX_COMPILE_TIME_LOG_LEVEL)};
+#else
+static constexpr LogLevel CompileTimeLogLevel{LogLevel::kVerbose};
+#endif
+
 enum class LogMode : uint8_t
 {
     kRemote = 0x01,
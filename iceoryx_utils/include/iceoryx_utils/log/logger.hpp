@@ -45,6 +45,25 @@ class Logger
     void SetLogLevel(const LogLevel logLevel) noexcept;
     void SetLogMode(const LogMode logMode) noexcept;
 
+    /// @brief true if an entry of the given level would be logged; inline so
+    /// that the compile time level check folds away and a disabled log
+    /// statement costs a single predictable branch
+    bool IsEnabled(const LogLevel logLevel) const noexcept
+    {
+        return (logLevel <= CompileTimeLogLevel) && (logLevel <= m_logLevel.load(std::memory_order_relaxed));
+    }
+
+    /// @brief switches all loggers between the synchronous and the asynchronous
+    /// backend; with the asynchronous backend a log statement only copies the
+    /// entry into a per thread lock free ring and a flusher thread does the
+    /// formatting and writing. A full ring drops the entry and the flusher
+    /// reports the number of dropped entries with a warning
+    static void SetAsyncLogMode(const bool enable) noexcept;
+
+    /// @brief blocks until the asynchronous backend has written all entries
+    /// which were enqueued before this call; a no-op with the synchronous backend
+    static void FlushAsyncLog() noexcept;
+
     LogStream LogFatal() noexcept;
     LogStream LogError() noexcept;
     LogStream LogWarn() noexcept;
@@ -59,10 +78,11 @@ class Logger
     virtual void Log(const LogEntry& entry) const;
 
   private:
-    void Print(const LogEntry entry) const;
+    static void Print(const LogEntry entry);
 
     std::atomic<LogLevel> m_logLevel{LogLevel::kVerbose};
     std::atomic<LogMode> m_logMode{LogMode::kConsole};
+    static std::atomic<bool> s_asyncLogMode;
 };
 
 } // namespace log
@@ -124,6 +124,10 @@ class LogStream
     template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
     LogStream& operator<<(const T val) noexcept
     {
+        if (!m_enabled)
+        {
+            return *this;
+        }
         m_logEntry.message.append(std::to_string(val));
         m_flushed = false;
         return *this;
@@ -132,6 +136,10 @@ class LogStream
     template <typename T, typename std::enable_if<std::is_base_of<LogHex, T>::value, int>::type = 0>
     LogStream& operator<<(const T val) noexcept
     {
+        if (!m_enabled)
+        {
+            return *this;
+        }
         std::stringstream ss;
         // the '+val' is there to not interpret the uint8_t as char and print the character instead of the hex value
         ss << "0x" << std::hex << +val.value;
@@ -143,6 +151,10 @@ class LogStream
     template <typename T, typename std::enable_if<std::is_base_of<LogBin, T>::value, int>::type = 0>
     LogStream& operator<<(const T val) noexcept
     {
+        if (!m_enabled)
+        {
+            return *this;
+        }
         m_logEntry.message.append("0b");
         m_logEntry.message.append(std::bitset<std::numeric_limits<decltype(val.value)>::digits>(val.value).to_string());
         m_flushed = false;
@@ -153,6 +165,9 @@ class LogStream
 
   private:
     Logger& m_logger;
+    /// decided once at construction; a filtered out stream skips the argument
+    /// formatting and never reaches the logger
+    bool m_enabled{true};
     bool m_flushed{false};
     LogEntry m_logEntry;
 };
@@ -0,0 +1,79 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+
+namespace iox
+{
+namespace posix
+{
+/// @brief Counting semaphore built on a futex word with the method surface of
+///         posix::Semaphore that is used in the delivery paths. post() and
+///         wait() resolve in userspace with a single atomic operation as long
+///         as no waiter has to be parked or woken; only the parking itself and
+///         a post() with a parked waiter pay a syscall. The futex operations
+///         are the non private ones, so an instance placed in a shared memory
+///         segment works across processes; the object contains no pointers or
+///         handles and is trivially placeable there.
+///         On platforms without a futex syscall wait() falls back to polling.
+/// @concurrent thread safe and process safe
+class FutexSemaphore
+{
+  public:
+    /// @brief Creates a semaphore with the given initial value
+    /// @param[in] f_initialValue initial value of the semaphore counter
+    explicit FutexSemaphore(const uint32_t f_initialValue = 0u) noexcept;
+
+    FutexSemaphore(const FutexSemaphore&) = delete;
+    FutexSemaphore(FutexSemaphore&&) = delete;
+    FutexSemaphore& operator=(const FutexSemaphore&) = delete;
+    FutexSemaphore& operator=(FutexSemaphore&&) = delete;
+
+    /// @brief Returns the current value of the semaphore counter
+    /// @param[out] f_value current value of the semaphore counter
+    /// @return true, false is never returned and reserved for future error cases
+    bool getValue(int& f_value) const noexcept;
+
+    /// @brief Increments the semaphore counter; wakes one waiter if there is
+    ///         any. Uncontended this is a single atomic add without a syscall
+    /// @return true, false is never returned and reserved for future error cases
+    bool post() noexcept;
+
+    /// @brief Blocks until the semaphore counter is non zero and decrements it
+    /// @return true, false is never returned and reserved for future error cases
+    bool wait() noexcept;
+
+    /// @brief Decrements the semaphore counter if it is non zero
+    /// @return true if the counter was decremented, false if it was zero
+    bool tryWait() noexcept;
+
+    /// @brief Blocks until the semaphore counter is non zero and decrements it
+    ///         or until the timeout expired. Like in sem_timedwait the timeout
+    ///         is an absolute point in time of CLOCK_REALTIME
+    /// @param[in] f_absTimeout absolute timeout in seconds and nanoseconds
+    ///             since the Epoch
+    /// @return true if the counter was decremented, false on timeout
+    bool timedWait(const struct timespec* f_absTimeout) noexcept;
+
+  private:
+    std::atomic<uint32_t> m_counter{0u};
+    std::atomic<uint32_t> m_waiters{0u};
+};
+
+} // namespace posix
+} // namespace iox
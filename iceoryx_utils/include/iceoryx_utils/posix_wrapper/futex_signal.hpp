@@ -0,0 +1,64 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace posix
+{
+/// @brief Counting signal built on a futex word which can be placed in shared
+///         memory and used across processes. As long as nobody waits, post() is a
+///         single atomic increment in userspace; only a post() with a parked waiter
+///         and the parking itself pay a syscall, in contrast to a posix semaphore
+///         where every post/wait is a syscall pair on some platforms.
+///         On platforms without a futex syscall wait() falls back to polling.
+class FutexSignal
+{
+  public:
+    FutexSignal() noexcept = default;
+
+    FutexSignal(const FutexSignal&) = delete;
+    FutexSignal(FutexSignal&&) = delete;
+    FutexSignal& operator=(const FutexSignal&) = delete;
+    FutexSignal& operator=(FutexSignal&&) = delete;
+
+    /// @brief Increments the signal counter; wakes one waiter if there is any.
+    ///         Uncontended this is a single atomic add without a syscall
+    void post() noexcept;
+
+    /// @brief Blocks until the signal counter is non zero and decrements it
+    /// @return true, false is never returned and reserved for future error cases
+    bool wait() noexcept;
+
+    /// @brief Decrements the signal counter if it is non zero
+    /// @return true if the counter was decremented, false if it was zero
+    bool tryWait() noexcept;
+
+    /// @brief Blocks until the signal counter is non zero and decrements it or
+    ///         until the timeout expired
+    /// @param[in] f_timeoutMs timeout in milliseconds
+    /// @return true if the counter was decremented, false on timeout
+    bool timedWait(const uint32_t f_timeoutMs) noexcept;
+
+  private:
+    std::atomic<uint32_t> m_counter{0u};
+    std::atomic<uint32_t> m_waiters{0u};
+};
+
+} // namespace posix
+} // namespace iox
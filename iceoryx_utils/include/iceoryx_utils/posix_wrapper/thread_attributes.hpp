@@ -0,0 +1,60 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <pthread.h>
+#include <string>
+
+namespace iox
+{
+namespace posix
+{
+/// @brief scheduling configuration for an internal thread; the defaults keep
+/// everything the thread inherited from its creator, so a default constructed
+/// ThreadAttributes is a no-op when applied
+struct ThreadAttributes
+{
+    ThreadAttributes() noexcept = default;
+    ThreadAttributes(const uint64_t f_affinityMask, const int32_t f_schedFifoPriority, const std::string& f_name)
+        : m_affinityMask(f_affinityMask)
+        , m_schedFifoPriority(f_schedFifoPriority)
+        , m_name(f_name)
+    {
+    }
+
+    /// @brief bitmask of the CPUs the thread may run on, bit n stands for CPU n;
+    /// 0 keeps the inherited affinity
+    uint64_t m_affinityMask{0u};
+
+    /// @brief priority for the SCHED_FIFO real-time policy; 0 keeps the
+    /// inherited scheduling policy and priority
+    int32_t m_schedFifoPriority{0};
+
+    /// @brief thread name as shown by ps and htop, truncated to 15 characters;
+    /// an empty string keeps the current name
+    std::string m_name;
+};
+
+/// @brief applies the given attributes to a running thread; partial failures
+/// (e.g. missing privileges for SCHED_FIFO) are logged and the remaining
+/// attributes are still applied
+/// @param[in] f_handle native handle of the thread
+/// @param[in] f_attributes the attributes to apply
+/// @return true if all requested attributes could be applied, false otherwise
+bool applyThreadAttributes(const pthread_t f_handle, const ThreadAttributes& f_attributes) noexcept;
+
+} // namespace posix
+} // namespace iox
@@ -17,6 +17,7 @@
 #include "iceoryx_utils/cxx/optional.hpp"
 #include "iceoryx_utils/cxx/vector.hpp"
 #include "iceoryx_utils/design_pattern/creation.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/timing_wheel.hpp"
 #include "iceoryx_utils/internal/units/duration.hpp"
 
 #include <atomic>
@@ -74,46 +75,12 @@ class Timer
     };
 
   private:
-    static constexpr size_t SIZE_OF_COMBINDED_INDEX_AND_DESCRIPTOR = sizeof(uint32_t);
-    static constexpr size_t SIZE_OF_SIGVAL_INT = sizeof(int);
-    static_assert(SIZE_OF_SIGVAL_INT >= SIZE_OF_COMBINDED_INDEX_AND_DESCRIPTOR, "size of sigval_int is to low");
-
-    static constexpr uint32_t MAX_NUMBER_OF_CALLBACK_HANDLES = 100;
-    static_assert(MAX_NUMBER_OF_CALLBACK_HANDLES <= std::numeric_limits<uint8_t>::max(),
-                  "number of callback handles exceeds max index value");
-    class OsTimer;
-    struct OsTimerCallbackHandle
-    {
-        static constexpr uint32_t MAX_DESCRIPTOR_VALUE{(2 ^ 24) - 1};
-        static sigval indexAndDescriptorToSigval(uint8_t index, uint32_t descriptor);
-        static uint8_t sigvalToIndex(sigval intVal);
-        static uint32_t sigvalToDescriptor(sigval intVal);
-
-        void incrementDescriptor();
-
-        std::mutex m_accessMutex;
-
-        /// @brief the descriptor is unique for a timer_t in OsTimer, if this handle is recycled, the descriptor needs
-        /// to be incremented first
-        std::atomic<uint32_t> m_descriptor{0};
-
-        std::atomic<bool> m_inUse{false};
-        std::atomic<bool> m_isTimerActive{false};
-
-        OsTimer* m_timer{nullptr};
-    };
-
+    /// @brief facade to one task of the process-wide TimingWheel; all
+    ///         instances share one dispatcher thread and one wait primitive
+    ///         instead of owning a kernel timer each
     class OsTimer
     {
-#ifdef __QNX__
-        static constexpr timer_t INVALID_TIMER_ID = 0;
-#else
-        static constexpr timer_t INVALID_TIMER_ID = nullptr;
-#endif
       public:
-        /// @brief Wrapper that can be registered with the operating system
-        static void callbackHelper(sigval data);
-
         OsTimer(units::Duration timeToWait, std::function<void()> callback) noexcept;
 
         OsTimer(const OsTimer&) = delete;
@@ -150,18 +117,17 @@ class Timer
         /// @note Shall only be called when callback is given
         cxx::expected<uint64_t, TimerError> getOverruns() noexcept;
 
+        /// @brief Returns the runtime accounting of the callback (number of
+        /// executions, accumulated and maximum runtime)
+        /// @note Shall only be called when callback is given
+        cxx::expected<TimingWheel::RuntimeStatistics, TimerError> getRuntimeStatistics() noexcept;
+
         /// @brief Returns true if the construction of the object was successful
         bool hasError() const noexcept;
 
         /// @brief Returns the error that occured on constructing the object
         cxx::error<TimerError> getError() const noexcept;
 
-      private:
-        /// @brief Call the user-defined callback
-        /// @note This call is wrapped in a plain C function
-        void executeCallback() noexcept;
-
-
       private:
         /// @brief Duration after the timer calls the user-defined callback function
         units::Duration m_timeToWait;
@@ -169,10 +135,8 @@ class Timer
         /// @brief Stores the user-defined callback
         std::function<void()> m_callback;
 
-        /// @brief Identifier for the timer in the operating system
-        timer_t m_timerId{INVALID_TIMER_ID};
-
-        uint8_t m_callbackHandleIndex{0};
+        /// @brief Handle to the task in the process-wide TimingWheel
+        TimingWheel::TaskHandle m_taskHandle;
 
         /// @todo will be obsolete with creation pattern
         /// @brief Bool that signals whether the object is fully initalized
@@ -181,8 +145,6 @@ class Timer
         /// @todo creation pattern
         /// @brief If an error happened during creation the value is stored in here
         TimerError m_errorValue{TimerError::NO_ERROR};
-
-        static OsTimerCallbackHandle s_callbackHandlePool[MAX_NUMBER_OF_CALLBACK_HANDLES];
     };
 
   public:
@@ -261,6 +223,13 @@ class Timer
     /// @note Shall only be called when callback is given
     cxx::expected<uint64_t, TimerError> getOverruns() noexcept;
 
+    /// @brief Returns the runtime accounting of the callback (number of
+    /// executions, accumulated and maximum runtime); the callbacks of all
+    /// timers share one executor thread, a callback which dominates the
+    /// accumulated runtime is the one delaying the others
+    /// @note Shall only be called when callback is given
+    cxx::expected<TimingWheel::RuntimeStatistics, TimerError> getRuntimeStatistics() noexcept;
+
     /// @brief Returns true if the construction of the object was successful
     bool hasError() const noexcept;
 
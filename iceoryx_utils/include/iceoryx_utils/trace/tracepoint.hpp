@@ -0,0 +1,51 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+/// @brief Static tracepoints (USDT) for the sample hot path.
+///
+/// The tracepoints are compiled out by default and the macros expand to
+/// nothing; the arguments are not even evaluated. When built with
+/// -DIOX_ENABLE_TRACEPOINTS (cmake: -DTRACEPOINTS=on, requires the
+/// systemtap sdt development header <sys/sdt.h>) each macro emits a USDT
+/// probe under the provider "iceoryx". A probe is a single nop instruction
+/// until a tracer like perf, bpftrace or LTTng (with the UST-SDT bridge)
+/// attaches to it, so the cost in production is near zero when no one is
+/// tracing.
+///
+/// The probes on the delivery path carry the chunk pointer as argument; the
+/// tracer records the timestamp at the probe site, so the per-sample timeline
+/// sender_deliver_chunk -> receiver_fifo_push -> receiver_wakeup ->
+/// receiver_get_chunk can be reconstructed by correlating the chunk pointer.
+///
+/// @code
+///     perf probe -x libiceoryx_posh.so sdt_iceoryx:sender_deliver_chunk
+///     perf record -e sdt_iceoryx:* -aR sleep 10
+/// @endcode
+#if defined(IOX_ENABLE_TRACEPOINTS)
+
+#include <sys/sdt.h>
+
+#define IOX_TRACEPOINT(name) DTRACE_PROBE(iceoryx, name)
+#define IOX_TRACEPOINT1(name, arg1) DTRACE_PROBE1(iceoryx, name, arg1)
+#define IOX_TRACEPOINT2(name, arg1, arg2) DTRACE_PROBE2(iceoryx, name, arg1, arg2)
+
+#else
+
+#define IOX_TRACEPOINT(name)
+#define IOX_TRACEPOINT1(name, arg1)
+#define IOX_TRACEPOINT2(name, arg1, arg2)
+
+#endif
@@ -42,6 +42,17 @@ void ActiveObject::mainLoop()
         {
             task();
         }
+
+        // drain the whole pending mailbox content before blocking again;
+        // tasks pushed into the nonempty queue cause no wakeup, so a burst
+        // of tasks costs at most a single wake of this thread
+        while (m_keepRunning && m_tasks->try_pop(task))
+        {
+            if (task)
+            {
+                task();
+            }
+        }
     }
 }
 
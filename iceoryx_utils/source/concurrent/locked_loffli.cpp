@@ -21,21 +21,32 @@ namespace iox
 namespace concurrent
 {
 void LockedLoFFLi::init(cxx::not_null<uint32_t*> f_freeIndicesMemory, const uint32_t f_size)
+{
+    init(f_freeIndicesMemory, f_size, f_size);
+}
+
+void LockedLoFFLi::init(cxx::not_null<uint32_t*> f_freeIndicesMemory,
+                        const uint32_t f_initialSize,
+                        const uint32_t f_capacity)
 {
     cxx::Expects(m_accessMutex.has_value());
-    cxx::Expects(f_size > 0);
-    cxx::Expects(f_size <= UINT32_MAX - 2U);
+    cxx::Expects(f_initialSize > 0);
+    cxx::Expects(f_initialSize <= f_capacity);
+    cxx::Expects(f_capacity <= UINT32_MAX - 2U);
 
 
     m_freeIndices = f_freeIndicesMemory;
-    m_size = f_size;
+    m_size = f_capacity;
     m_invalidIndex = m_size + 1;
     if (m_freeIndices != nullptr)
     {
+        // the reserved indices in [f_initialSize, f_capacity) are marked as "in use"
+        // so they can be handed over later via push
         for (uint32_t i = 0; i < m_size + 1; i++)
         {
-            m_freeIndices[i] = i + 1;
+            m_freeIndices[i] = (i < f_initialSize) ? i + 1 : m_invalidIndex;
         }
+        m_freeIndices[f_initialSize - 1] = m_size;
     }
 }
 
@@ -56,6 +67,43 @@ bool LockedLoFFLi::pop(uint32_t& index)
     return true;
 }
 
+uint32_t LockedLoFFLi::popBatch(uint32_t* f_indices, const uint32_t f_count)
+{
+    std::lock_guard<posix::mutex> lock(*m_accessMutex);
+
+    uint32_t popped{0u};
+    while (popped < f_count && m_head < m_size)
+    {
+        uint32_t index = m_head;
+        m_head = m_freeIndices[m_head];
+        m_freeIndices[index] = m_invalidIndex;
+        f_indices[popped++] = index;
+    }
+
+    return popped;
+}
+
+bool LockedLoFFLi::pushBatch(const uint32_t* f_indices, const uint32_t f_count)
+{
+    std::lock_guard<posix::mutex> lock(*m_accessMutex);
+
+    for (uint32_t i = 0u; i < f_count; ++i)
+    {
+        if (f_indices[i] >= m_size || m_freeIndices[f_indices[i]] != m_invalidIndex)
+        {
+            return false;
+        }
+    }
+
+    for (uint32_t i = 0u; i < f_count; ++i)
+    {
+        m_freeIndices[f_indices[i]] = m_head;
+        m_head = f_indices[i];
+    }
+
+    return true;
+}
+
 bool LockedLoFFLi::push(const uint32_t index)
 {
     std::lock_guard<posix::mutex> lock(*m_accessMutex);
@@ -22,19 +22,31 @@ namespace concurrent
 {
 void LoFFLi::init(cxx::not_null<uint32_t*> f_freeIndicesMemory, const uint32_t f_size)
 {
-    cxx::Expects(f_size > 0);
-    cxx::Expects(f_size <= UINT32_MAX - 2U);
+    init(f_freeIndicesMemory, f_size, f_size);
+}
+
+void LoFFLi::init(cxx::not_null<uint32_t*> f_freeIndicesMemory,
+                  const uint32_t f_initialSize,
+                  const uint32_t f_capacity)
+{
+    cxx::Expects(f_initialSize > 0);
+    cxx::Expects(f_initialSize <= f_capacity);
+    cxx::Expects(f_capacity <= UINT32_MAX - 2U);
 
     m_nextFreeIndex = f_freeIndicesMemory;
-    m_size = f_size;
+    m_size = f_capacity;
     m_invalidIndex = m_size + 1;
 
     if (m_nextFreeIndex != nullptr)
     {
+        // the reserved indices in [f_initialSize, f_capacity) are marked as "in use"
+        // so they can be handed over later via push
         for (uint32_t i = 0; i < m_size + 1; i++)
         {
-            m_nextFreeIndex[i] = i + 1;
+            m_nextFreeIndex[i] = (i < f_initialSize) ? i + 1 : m_invalidIndex;
         }
+        // terminate the chain of the initially free indices
+        m_nextFreeIndex[f_initialSize - 1] = m_size;
     }
 }
 
@@ -42,6 +54,7 @@ bool LoFFLi::pop(uint32_t& index)
 {
     Node oldHead = m_head.load(std::memory_order_acquire);
     Node newHead = oldHead;
+    uint64_t attempts{0u};
 
     do
     {
@@ -53,10 +66,16 @@ bool LoFFLi::pop(uint32_t& index)
 
         newHead.indexToNextFreeIndex = m_nextFreeIndex[oldHead.indexToNextFreeIndex];
         newHead.abaCounter += 1;
+        ++attempts;
     } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
 
+    if (attempts > 1u)
+    {
+        m_popRetries.fetch_add(attempts - 1u, std::memory_order_relaxed);
+    }
+
     /// comes from outside, is not shared and therefore no synchronization is needed
-    index = oldHead.indexToNextFreeIndex;
+    index = static_cast<uint32_t>(oldHead.indexToNextFreeIndex);
     /// @todo what if interrupted here an another thread guesses the index and
     ///         calls push
     /// @brief murphy case: m_nextFreeIndex does not require any synchronization since it
@@ -72,6 +91,101 @@ bool LoFFLi::pop(uint32_t& index)
     return true;
 }
 
+uint32_t LoFFLi::popBatch(uint32_t* f_indices, const uint32_t f_count)
+{
+    if (f_count == 0u)
+    {
+        return 0u;
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t popped{0u};
+    uint64_t attempts{0u};
+
+    do
+    {
+        ++attempts;
+        // walk a run of the free-list starting at the head; if another thread modifies
+        // the list concurrently the head changes as well and the CAS below fails, so a
+        // racy walk is re-done with a fresh head
+        popped = 0u;
+        uint32_t current = static_cast<uint32_t>(oldHead.indexToNextFreeIndex);
+        while (popped < f_count && current < m_size)
+        {
+            f_indices[popped++] = current;
+            current = m_nextFreeIndex[current];
+        }
+
+        if (popped == 0u)
+        {
+            return 0u;
+        }
+
+        newHead.indexToNextFreeIndex = current;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    if (attempts > 1u)
+    {
+        m_popRetries.fetch_add(attempts - 1u, std::memory_order_relaxed);
+    }
+
+    for (uint32_t i = 0u; i < popped; ++i)
+    {
+        m_nextFreeIndex[f_indices[i]] = m_invalidIndex;
+    }
+
+    /// same synchronization as in pop, see the murphy case description there
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return popped;
+}
+
+bool LoFFLi::pushBatch(const uint32_t* f_indices, const uint32_t f_count)
+{
+    if (f_count == 0u)
+    {
+        return true;
+    }
+
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (uint32_t i = 0u; i < f_count; ++i)
+    {
+        if (f_indices[i] >= m_size || m_nextFreeIndex[f_indices[i]] != m_invalidIndex)
+        {
+            return false;
+        }
+    }
+
+    // link the run outside of the CAS loop, only the tail has to be relinked on a retry
+    for (uint32_t i = 0u; i + 1u < f_count; ++i)
+    {
+        m_nextFreeIndex[f_indices[i]] = f_indices[i + 1u];
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint64_t attempts{0u};
+
+    do
+    {
+        m_nextFreeIndex[f_indices[f_count - 1u]] = static_cast<uint32_t>(oldHead.indexToNextFreeIndex);
+        newHead.indexToNextFreeIndex = f_indices[0];
+        newHead.abaCounter = oldHead.abaCounter + 1;
+        ++attempts;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    if (attempts > 1u)
+    {
+        m_pushRetries.fetch_add(attempts - 1u, std::memory_order_relaxed);
+    }
+
+    return true;
+}
+
 bool LoFFLi::push(const uint32_t index)
 {
     /// we synchronize with m_nextFreeIndex in pop to perform the validity check
@@ -86,16 +200,33 @@ bool LoFFLi::push(const uint32_t index)
 
     Node oldHead = m_head.load(std::memory_order_acquire);
     Node newHead = oldHead;
+    uint64_t attempts{0u};
 
     do
     {
-        m_nextFreeIndex[index] = oldHead.indexToNextFreeIndex;
+        m_nextFreeIndex[index] = static_cast<uint32_t>(oldHead.indexToNextFreeIndex);
         newHead.indexToNextFreeIndex = index;
         newHead.abaCounter += 1;
+        ++attempts;
     } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
 
+    if (attempts > 1u)
+    {
+        m_pushRetries.fetch_add(attempts - 1u, std::memory_order_relaxed);
+    }
+
     return true;
 }
 
+uint64_t LoFFLi::getPopRetries() const
+{
+    return m_popRetries.load(std::memory_order_relaxed);
+}
+
+uint64_t LoFFLi::getPushRetries() const
+{
+    return m_pushRetries.load(std::memory_order_relaxed);
+}
+
 } // namespace concurrent
 } // namespace iox
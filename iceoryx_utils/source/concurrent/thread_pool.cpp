@@ -0,0 +1,134 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/internal/concurrent/thread_pool.hpp"
+
+namespace iox
+{
+namespace concurrent
+{
+constexpr uint32_t ThreadPool::MAX_WORKERS;
+constexpr uint32_t ThreadPool::QUEUE_CAPACITY;
+
+ThreadPool::ThreadPool(uint32_t f_numberOfWorkers)
+{
+    if (f_numberOfWorkers == 0u)
+    {
+        f_numberOfWorkers = std::thread::hardware_concurrency();
+    }
+    if (f_numberOfWorkers == 0u)
+    {
+        f_numberOfWorkers = 1u;
+    }
+    if (f_numberOfWorkers > MAX_WORKERS)
+    {
+        f_numberOfWorkers = MAX_WORKERS;
+    }
+    m_numberOfWorkers = f_numberOfWorkers;
+
+    if (!m_isInitialized)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0u; i < m_numberOfWorkers; ++i)
+    {
+        m_workers[i] = std::thread(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    m_keepRunning.store(false, std::memory_order_relaxed);
+    if (m_isInitialized)
+    {
+        // one wakeup per worker so that none stays blocked
+        for (uint32_t i = 0u; i < m_numberOfWorkers; ++i)
+        {
+            m_semaphore->post();
+        }
+    }
+    for (uint32_t i = 0u; i < m_numberOfWorkers; ++i)
+    {
+        if (m_workers[i].joinable())
+        {
+            m_workers[i].join();
+        }
+    }
+}
+
+bool ThreadPool::submit(const Task& f_task)
+{
+    return enqueue(f_task, m_roundRobinIndex.fetch_add(1u, std::memory_order_relaxed) % m_numberOfWorkers);
+}
+
+bool ThreadPool::submit(const Task& f_task, const uint32_t f_affinityHint)
+{
+    return enqueue(f_task, f_affinityHint % m_numberOfWorkers);
+}
+
+bool ThreadPool::enqueue(const Task& f_task, const uint32_t f_queueIndex)
+{
+    // start at the selected queue and fall over to the others when it is
+    // full; losing the affinity is better than losing the task
+    for (uint32_t k = 0u; k < m_numberOfWorkers; ++k)
+    {
+        if (m_queues[(f_queueIndex + k) % m_numberOfWorkers].push(f_task))
+        {
+            m_semaphore->post();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(const uint32_t f_ownIndex)
+{
+    while (m_keepRunning.load(std::memory_order_relaxed))
+    {
+        m_semaphore->wait();
+        if (!m_keepRunning.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // the semaphore count matches the number of queued tasks, one task
+        // is therefore available; look into the own queue first and steal
+        // from the others only when it is empty
+        for (uint32_t k = 0u; k < m_numberOfWorkers; ++k)
+        {
+            auto task = m_queues[(f_ownIndex + k) % m_numberOfWorkers].pop();
+            if (task.has_value())
+            {
+                if (*task)
+                {
+                    (*task)();
+                }
+                break;
+            }
+        }
+    }
+}
+
+bool ThreadPool::isInitialized() const
+{
+    return m_isInitialized;
+}
+
+uint32_t ThreadPool::numberOfWorkers() const
+{
+    return m_numberOfWorkers;
+}
+} // namespace concurrent
+} // namespace iox
@@ -0,0 +1,128 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/cxx/crc32c.hpp"
+
+#include <cstring>
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+namespace iox
+{
+namespace cxx
+{
+namespace
+{
+uint32_t crc32cTable(const uint8_t* f_data, uint64_t f_size, uint32_t f_crc) noexcept
+{
+    static uint32_t s_table[256];
+    static bool s_tableInitialized = [] {
+        // reversed representation of the Castagnoli polynomial 0x1EDC6F41
+        constexpr uint32_t Polynomial{0x82F63B78u};
+        for (uint32_t i = 0u; i < 256u; ++i)
+        {
+            uint32_t l_crc = i;
+            for (uint32_t bit = 0u; bit < 8u; ++bit)
+            {
+                l_crc = (l_crc >> 1) ^ ((l_crc & 1u) ? Polynomial : 0u);
+            }
+            s_table[i] = l_crc;
+        }
+        return true;
+    }();
+    static_cast<void>(s_tableInitialized);
+
+    while (f_size-- > 0u)
+    {
+        f_crc = (f_crc >> 8) ^ s_table[(f_crc ^ *f_data++) & 0xFFu];
+    }
+    return f_crc;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2"))) uint32_t crc32cHardware(const uint8_t* f_data,
+                                                          uint64_t f_size,
+                                                          uint32_t f_crc) noexcept
+{
+    uint64_t l_crc = f_crc;
+    while (f_size >= 8u)
+    {
+        uint64_t l_value;
+        memcpy(&l_value, f_data, sizeof(l_value));
+        l_crc = __builtin_ia32_crc32di(l_crc, l_value);
+        f_data += 8u;
+        f_size -= 8u;
+    }
+    uint32_t l_crc32 = static_cast<uint32_t>(l_crc);
+    while (f_size-- > 0u)
+    {
+        l_crc32 = __builtin_ia32_crc32qi(l_crc32, *f_data++);
+    }
+    return l_crc32;
+}
+
+bool hasHardwareCrc() noexcept
+{
+    return __builtin_cpu_supports("sse4.2");
+}
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+uint32_t crc32cHardware(const uint8_t* f_data, uint64_t f_size, uint32_t f_crc) noexcept
+{
+    while (f_size >= 8u)
+    {
+        uint64_t l_value;
+        memcpy(&l_value, f_data, sizeof(l_value));
+        f_crc = __crc32cd(f_crc, l_value);
+        f_data += 8u;
+        f_size -= 8u;
+    }
+    while (f_size-- > 0u)
+    {
+        f_crc = __crc32cb(f_crc, *f_data++);
+    }
+    return f_crc;
+}
+
+bool hasHardwareCrc() noexcept
+{
+    // the compiler was already told the target has the CRC extension
+    return true;
+}
+#else
+uint32_t crc32cHardware(const uint8_t* f_data, uint64_t f_size, uint32_t f_crc) noexcept
+{
+    return crc32cTable(f_data, f_size, f_crc);
+}
+
+bool hasHardwareCrc() noexcept
+{
+    return false;
+}
+#endif
+} // namespace
+
+uint32_t crc32c(const void* const f_data, const uint64_t f_size, const uint32_t f_seed) noexcept
+{
+    static const bool s_useHardware = hasHardwareCrc();
+
+    auto l_data = static_cast<const uint8_t*>(f_data);
+    uint32_t l_crc = f_seed ^ 0xFFFFFFFFu;
+    l_crc = s_useHardware ? crc32cHardware(l_data, f_size, l_crc) : crc32cTable(l_data, f_size, l_crc);
+    return l_crc ^ 0xFFFFFFFFu;
+}
+
+} // namespace cxx
+} // namespace iox
@@ -0,0 +1,133 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/cxx/payload_copy.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
+namespace iox
+{
+namespace cxx
+{
+namespace
+{
+#if defined(__x86_64__)
+void streamingCopy(uint8_t* f_destination, const uint8_t* f_source, uint64_t f_size) noexcept
+{
+    // the streaming stores require a 16 byte aligned destination, copy the
+    // unaligned head the regular way
+    const uint64_t l_misalignment = reinterpret_cast<uintptr_t>(f_destination) & 15u;
+    if (l_misalignment != 0u)
+    {
+        const uint64_t l_headSize = 16u - l_misalignment;
+        memcpy(f_destination, f_source, l_headSize);
+        f_destination += l_headSize;
+        f_source += l_headSize;
+        f_size -= l_headSize;
+    }
+
+    while (f_size >= 64u)
+    {
+        const __m128i l_block0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_source));
+        const __m128i l_block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_source + 16u));
+        const __m128i l_block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_source + 32u));
+        const __m128i l_block3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f_source + 48u));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(f_destination), l_block0);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(f_destination + 16u), l_block1);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(f_destination + 32u), l_block2);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(f_destination + 48u), l_block3);
+        f_destination += 64u;
+        f_source += 64u;
+        f_size -= 64u;
+    }
+
+    if (f_size > 0u)
+    {
+        memcpy(f_destination, f_source, f_size);
+    }
+
+    // the streaming stores are weakly ordered, make them visible before the
+    // chunk is handed over to other processes
+    _mm_sfence();
+}
+#elif defined(__aarch64__)
+void streamingCopy(uint8_t* f_destination, const uint8_t* f_source, uint64_t f_size) noexcept
+{
+    // stnp gives the cache a non-temporal hint for the stored line; it has no
+    // alignment requirement beyond the element size, copy the head until the
+    // destination is 16 byte aligned so full lines are written
+    const uint64_t l_misalignment = reinterpret_cast<uintptr_t>(f_destination) & 15u;
+    if (l_misalignment != 0u)
+    {
+        const uint64_t l_headSize = 16u - l_misalignment;
+        memcpy(f_destination, f_source, l_headSize);
+        f_destination += l_headSize;
+        f_source += l_headSize;
+        f_size -= l_headSize;
+    }
+
+    while (f_size >= 64u)
+    {
+        uint64_t l_value[8];
+        memcpy(l_value, f_source, sizeof(l_value));
+        asm volatile("stnp %0, %1, [%8]\n\t"
+                     "stnp %2, %3, [%8, #16]\n\t"
+                     "stnp %4, %5, [%8, #32]\n\t"
+                     "stnp %6, %7, [%8, #48]"
+                     :
+                     : "r"(l_value[0]),
+                       "r"(l_value[1]),
+                       "r"(l_value[2]),
+                       "r"(l_value[3]),
+                       "r"(l_value[4]),
+                       "r"(l_value[5]),
+                       "r"(l_value[6]),
+                       "r"(l_value[7]),
+                       "r"(f_destination)
+                     : "memory");
+        f_destination += 64u;
+        f_source += 64u;
+        f_size -= 64u;
+    }
+
+    if (f_size > 0u)
+    {
+        memcpy(f_destination, f_source, f_size);
+    }
+}
+#else
+void streamingCopy(uint8_t* f_destination, const uint8_t* f_source, uint64_t f_size) noexcept
+{
+    memcpy(f_destination, f_source, f_size);
+}
+#endif
+} // namespace
+
+void copyPayload(void* const f_destination, const void* const f_source, const uint64_t f_size) noexcept
+{
+    if (f_size < PAYLOAD_COPY_STREAMING_THRESHOLD)
+    {
+        memcpy(f_destination, f_source, f_size);
+        return;
+    }
+
+    streamingCopy(static_cast<uint8_t*>(f_destination), static_cast<const uint8_t*>(f_source), f_size);
+}
+
+} // namespace cxx
+} // namespace iox
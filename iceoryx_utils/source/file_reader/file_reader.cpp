@@ -14,6 +14,11 @@
 
 #include "iceoryx_utils/internal/file_reader/file_reader.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace iox
 {
 namespace cxx
@@ -56,6 +61,14 @@ FileReader::FileReader(const std::string& f_fileName, const std::string& f_fileP
 
 FileReader::~FileReader()
 {
+    if (m_mappedContent != nullptr)
+    {
+        munmap(const_cast<char*>(m_mappedContent), m_mappedSize);
+    }
+    if (m_mmapFileDescriptor != -1)
+    {
+        close(m_mmapFileDescriptor);
+    }
 }
 
 bool FileReader::IsOpen() const
@@ -68,5 +81,74 @@ bool FileReader::ReadLine(std::string& f_string)
     return static_cast<bool>(std::getline(m_fileStream, f_string));
 }
 
+bool FileReader::MapFile()
+{
+    if (m_mmapFileDescriptor != -1)
+    {
+        // already mapped
+        return true;
+    }
+
+    int fileDescriptor = open(m_file.c_str(), O_RDONLY);
+    if (-1 == fileDescriptor)
+    {
+        return false;
+    }
+
+    struct stat fileStatus;
+    if (-1 == fstat(fileDescriptor, &fileStatus))
+    {
+        close(fileDescriptor);
+        return false;
+    }
+
+    m_mmapFileDescriptor = fileDescriptor;
+    m_mappedSize = static_cast<uint64_t>(fileStatus.st_size);
+    m_mappedReadOffset = 0u;
+
+    // mapping a zero length file fails with EINVAL, an empty file is exposed as an empty view
+    if (m_mappedSize == 0u)
+    {
+        return true;
+    }
+
+    void* mapping = mmap(nullptr, m_mappedSize, PROT_READ, MAP_PRIVATE, m_mmapFileDescriptor, 0);
+    if (MAP_FAILED == mapping)
+    {
+        close(m_mmapFileDescriptor);
+        m_mmapFileDescriptor = -1;
+        m_mappedSize = 0u;
+        return false;
+    }
+
+    m_mappedContent = static_cast<const char*>(mapping);
+    return true;
+}
+
+FileView FileReader::Content() const
+{
+    return FileView{m_mappedContent, m_mappedSize};
+}
+
+bool FileReader::ReadLineView(FileView& f_line)
+{
+    if (m_mappedReadOffset >= m_mappedSize)
+    {
+        return false;
+    }
+
+    const char* lineBegin = m_mappedContent + m_mappedReadOffset;
+    uint64_t lineSize{0u};
+    while (m_mappedReadOffset + lineSize < m_mappedSize && lineBegin[lineSize] != '\n')
+    {
+        ++lineSize;
+    }
+
+    f_line = FileView{lineBegin, lineSize};
+    // skip the line ending, except at the end of a file without trailing newline
+    m_mappedReadOffset += lineSize + ((m_mappedReadOffset + lineSize < m_mappedSize) ? 1u : 0u);
+    return true;
+}
+
 } // namespace cxx
 } // namespace iox
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "iceoryx_utils/fixed_string/string100.hpp"
+#include "iceoryx_utils/internal/cxx/string_ops.hpp"
 
 namespace iox
 {
@@ -37,10 +38,7 @@ CString100::CString100(const char* const cstring)
                       0) /// @todo use cTor with implicit default value once in cxx::vector
 {
     uint64_t stringLength = std::min(static_cast<uint64_t>(strlen(cstring) + 1), MaxStringSize);
-    for (uint64_t k = 0; k < stringLength; ++k)
-    {
-        m_string_vector[k] = *(cstring + k);
-    }
+    std::memcpy(m_string_vector.data(), cstring, stringLength - 1);
     m_string_vector[stringLength - 1] = '\0';
 }
 
@@ -49,13 +47,12 @@ CString100::CString100(const char* const cstring)
 ///         full length is copied into the CString100. For a null
 ///         terminated string conversion use the char* only constructor
 CString100::CString100(const char* const cstring, const uint64_t length)
-    : m_string_vector(length + 1, 0) /// @todo use cTor with implicit default value once in cxx::vector
+    : m_string_vector(std::min(length, MaxStringSize - 1u) + 1,
+                      0) /// @todo use cTor with implicit default value once in cxx::vector
 {
-    for (uint64_t k = 0; k < length; ++k)
-    {
-        m_string_vector[k] = *(cstring + k);
-    }
-    m_string_vector[length] = '\0';
+    const uint64_t copyLength = std::min(length, MaxStringSize - 1u);
+    std::memcpy(m_string_vector.data(), cstring, copyLength);
+    m_string_vector[copyLength] = '\0';
 }
 
 CString100::CString100(const std::string& str)
@@ -100,6 +97,12 @@ int32_t CString100::compare(const CString100& str2) const
     return strncmp(m_string_vector.data(), str2.m_string_vector.data(), MaxStringSize);
 }
 
+uint64_t CString100::hash() const
+{
+    const char* cstring = to_cstring();
+    return cxx::internal::hash(cstring, strlen(cstring));
+}
+
 uint CString100::capacity() const
 {
     return MaxStringSize;
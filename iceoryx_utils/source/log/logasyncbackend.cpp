@@ -0,0 +1,189 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "logasyncbackend.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace iox
+{
+namespace log
+{
+constexpr uint32_t AsyncLogEntry::MESSAGE_SIZE;
+constexpr uint32_t AsyncLogBackend::MAX_THREADS;
+constexpr uint32_t AsyncLogBackend::RING_CAPACITY;
+
+AsyncLogBackend& AsyncLogBackend::get() noexcept
+{
+    static AsyncLogBackend instance;
+    return instance;
+}
+
+AsyncLogBackend::~AsyncLogBackend()
+{
+    if (m_run.exchange(false, std::memory_order_relaxed))
+    {
+        m_flusher.join();
+        // write what the logging threads left behind
+        drainOnce();
+    }
+}
+
+void AsyncLogBackend::start(const std::function<void(const LogEntry&)>& f_sink) noexcept
+{
+    if (m_run.exchange(true, std::memory_order_relaxed))
+    {
+        return;
+    }
+    m_sink = f_sink;
+    m_flusher = std::thread(&AsyncLogBackend::flusherMain, this);
+#ifdef __unix__
+    pthread_setname_np(m_flusher.native_handle(), "AsyncLog");
+#endif
+}
+
+AsyncLogBackend::ThreadRing* AsyncLogBackend::claimRing() noexcept
+{
+    auto l_slot = m_claimedRings.fetch_add(1u, std::memory_order_relaxed);
+    if (l_slot >= MAX_THREADS)
+    {
+        // never claimed, keep the counter saturated
+        m_claimedRings.store(MAX_THREADS, std::memory_order_relaxed);
+        return nullptr;
+    }
+    return &m_rings[l_slot];
+}
+
+bool AsyncLogBackend::enqueue(const LogEntry& f_entry) noexcept
+{
+    thread_local ThreadRing* tl_ring = claimRing();
+
+    if (tl_ring == nullptr || !m_run.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    // the consumer only shrinks the ring, seeing a stale size here at worst
+    // drops an entry which would have fit; dropping keeps the caller wait free
+    if (tl_ring->m_fifo.size() >= RING_CAPACITY)
+    {
+        tl_ring->m_dropped.fetch_add(1u, std::memory_order_relaxed);
+        return true;
+    }
+
+    AsyncLogEntry l_asyncEntry;
+    l_asyncEntry.m_level = f_entry.level;
+    l_asyncEntry.m_timeMs = f_entry.time.count();
+    strncpy(l_asyncEntry.m_message, f_entry.message.c_str(), AsyncLogEntry::MESSAGE_SIZE - 1u);
+    l_asyncEntry.m_message[AsyncLogEntry::MESSAGE_SIZE - 1u] = '\0';
+
+    AsyncLogEntry l_overflow;
+    tl_ring->m_fifo.push(l_asyncEntry, l_overflow);
+    return true;
+}
+
+void AsyncLogBackend::flush() noexcept
+{
+    if (!m_run.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    bool l_ringsEmpty{false};
+    while (!l_ringsEmpty && m_run.load(std::memory_order_relaxed))
+    {
+        l_ringsEmpty = true;
+        auto l_claimedRings = std::min(m_claimedRings.load(std::memory_order_relaxed), MAX_THREADS);
+        for (uint32_t i = 0u; i < l_claimedRings; ++i)
+        {
+            if (!m_rings[i].m_fifo.empty())
+            {
+                l_ringsEmpty = false;
+            }
+        }
+        if (!l_ringsEmpty)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    // an empty ring does not mean the flusher is done, it could still write a
+    // popped batch; two full drain cycles guarantee the writes are finished
+    auto l_cycles = m_drainCycles.load(std::memory_order_acquire);
+    while (m_drainCycles.load(std::memory_order_acquire) < l_cycles + 2u && m_run.load(std::memory_order_relaxed))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void AsyncLogBackend::flusherMain() noexcept
+{
+    while (m_run.load(std::memory_order_relaxed))
+    {
+        bool l_entryWritten = drainOnce();
+        m_drainCycles.fetch_add(1u, std::memory_order_release);
+        if (!l_entryWritten)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+bool AsyncLogBackend::drainOnce() noexcept
+{
+    constexpr uint32_t BATCH_SIZE{32u};
+    AsyncLogEntry l_batch[BATCH_SIZE];
+    bool l_entryWritten{false};
+
+    auto l_claimedRings = std::min(m_claimedRings.load(std::memory_order_relaxed), MAX_THREADS);
+    for (uint32_t i = 0u; i < l_claimedRings; ++i)
+    {
+        auto& l_ring = m_rings[i];
+
+        uint32_t l_count{0u};
+        while ((l_count = l_ring.m_fifo.popBatch(l_batch, BATCH_SIZE)) > 0u)
+        {
+            for (uint32_t n = 0u; n < l_count; ++n)
+            {
+                LogEntry l_entry;
+                l_entry.level = l_batch[n].m_level;
+                l_entry.time = std::chrono::milliseconds(l_batch[n].m_timeMs);
+                l_entry.message = l_batch[n].m_message;
+                m_sink(l_entry);
+            }
+            l_entryWritten = true;
+        }
+
+        auto l_dropped = l_ring.m_dropped.load(std::memory_order_relaxed);
+        if (l_dropped != l_ring.m_droppedReported)
+        {
+            LogEntry l_entry;
+            l_entry.level = LogLevel::kWarn;
+            l_entry.time = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch());
+            l_entry.message = "asynchronous logging backend dropped "
+                              + std::to_string(l_dropped - l_ring.m_droppedReported) + " log messages";
+            m_sink(l_entry);
+            l_ring.m_droppedReported = l_dropped;
+            l_entryWritten = true;
+        }
+    }
+
+    return l_entryWritten;
+}
+
+} // namespace log
+} // namespace iox
@@ -0,0 +1,99 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "iceoryx_utils/internal/concurrent/sofi.hpp"
+#include "iceoryx_utils/log/logcommon.hpp"
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+namespace iox
+{
+namespace log
+{
+/// @brief trivially copyable snapshot of a LogEntry so that it fits into the
+/// lock free ring; messages longer than MESSAGE_SIZE are truncated
+struct AsyncLogEntry
+{
+    static constexpr uint32_t MESSAGE_SIZE{128u};
+
+    LogLevel m_level{LogLevel::kVerbose};
+    int64_t m_timeMs{0};
+    char m_message[MESSAGE_SIZE];
+};
+
+/// @brief asynchronous logging backend; every logging thread owns a bounded
+/// lock free ring, a dedicated flusher thread formats and writes the entries.
+/// Enqueueing an entry is a copy into the ring without any lock or syscall,
+/// a full ring drops the entry and counts the drop instead of blocking the
+/// caller; the flusher reports the dropped count with a warning entry.
+/// Entries of one thread keep their order, the order between threads is only
+/// approximate
+class AsyncLogBackend
+{
+  public:
+    /// threads which can log asynchronously; a slot is claimed on the first
+    /// log statement of a thread and is never given back, further threads
+    /// fall back to synchronous logging
+    static constexpr uint32_t MAX_THREADS{32u};
+    /// entries a thread can have in flight before new entries are dropped
+    static constexpr uint32_t RING_CAPACITY{128u};
+
+    static AsyncLogBackend& get() noexcept;
+
+    AsyncLogBackend(const AsyncLogBackend&) = delete;
+    AsyncLogBackend& operator=(const AsyncLogBackend&) = delete;
+
+    /// @brief starts the flusher thread; the first call wins, later calls are ignored
+    /// @param[in] f_sink callable which writes one entry, called only from the flusher thread
+    void start(const std::function<void(const LogEntry&)>& f_sink) noexcept;
+
+    /// @brief enqueues an entry into the ring of the calling thread
+    /// @param[in] f_entry the entry to log
+    /// @return true if the entry was enqueued or dropped by the overflow
+    /// policy, false if the caller has to log synchronously (backend not
+    /// started or no ring slot left)
+    bool enqueue(const LogEntry& f_entry) noexcept;
+
+    /// @brief blocks until the flusher has written all currently enqueued entries
+    void flush() noexcept;
+
+  private:
+    AsyncLogBackend() = default;
+    ~AsyncLogBackend();
+
+    struct ThreadRing
+    {
+        concurrent::SoFi<AsyncLogEntry, RING_CAPACITY> m_fifo;
+        std::atomic<uint64_t> m_dropped{0u};
+        uint64_t m_droppedReported{0u}; // accessed by the flusher thread only
+    };
+
+    ThreadRing* claimRing() noexcept;
+    void flusherMain() noexcept;
+    bool drainOnce() noexcept;
+
+    ThreadRing m_rings[MAX_THREADS];
+    std::atomic<uint32_t> m_claimedRings{0u};
+    std::atomic<uint64_t> m_drainCycles{0u};
+    std::function<void(const LogEntry&)> m_sink;
+    std::thread m_flusher;
+    std::atomic<bool> m_run{false};
+};
+
+} // namespace log
+} // namespace iox
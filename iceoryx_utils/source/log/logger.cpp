@@ -16,6 +16,7 @@
 
 #include "iceoryx_utils/log/logging.hpp"
 #include "iceoryx_utils/log/logstream.hpp"
+#include "logasyncbackend.hpp"
 
 #include <chrono>
 #include <ctime>
@@ -27,6 +28,8 @@ namespace iox
 {
 namespace log
 {
+std::atomic<bool> Logger::s_asyncLogMode{false};
+
 Logger::Logger(std::string ctxId[[gnu::unused]], std::string ctxDescription[[gnu::unused]], LogLevel appLogLevel)
     : m_logLevel(appLogLevel)
 {
@@ -65,6 +68,26 @@ void Logger::SetLogMode(const LogMode logMode) noexcept
     }
 }
 
+void Logger::SetAsyncLogMode(const bool enable) noexcept
+{
+    if (enable)
+    {
+        AsyncLogBackend::get().start(&Logger::Print);
+        s_asyncLogMode.store(true, std::memory_order_relaxed);
+    }
+    else
+    {
+        s_asyncLogMode.store(false, std::memory_order_relaxed);
+        // entries enqueued before switching back still show up in order
+        AsyncLogBackend::get().flush();
+    }
+}
+
+void Logger::FlushAsyncLog() noexcept
+{
+    AsyncLogBackend::get().flush();
+}
+
 LogStream Logger::LogFatal() noexcept
 {
     return LogStream(*this, LogLevel::kFatal);
@@ -95,7 +118,7 @@ LogStream Logger::LogVerbose() noexcept
     return LogStream(*this, LogLevel::kVerbose);
 }
 
-void Logger::Print(const LogEntry entry) const
+void Logger::Print(const LogEntry entry)
 {
     // as long as there is only this synchronous logger, buffer the output before using clog to prevent interleaving
     // output because of threaded access
@@ -156,6 +179,12 @@ void Logger::Log(const LogEntry& entry) const
     /// event if they are below the current log level and print them if case of kFatal?
     if (entry.level <= m_logLevel.load(std::memory_order_relaxed))
     {
+        // the asynchronous backend refuses the entry when it has no ring slot
+        // left for the calling thread, then we write synchronously as before
+        if (s_asyncLogMode.load(std::memory_order_relaxed) && AsyncLogBackend::get().enqueue(entry))
+        {
+            return;
+        }
         Print(entry);
     }
 }
@@ -27,11 +27,15 @@ namespace log
 {
 LogStream::LogStream(Logger& logger, LogLevel logLevel)
     : m_logger(logger)
+    , m_enabled(logger.IsEnabled(logLevel))
 {
     m_logEntry.level = logLevel;
-    /// @todo do we want to do this only when loglevel is higher than global loglevel?
-    auto timePoint = std::chrono::high_resolution_clock::now();
-    m_logEntry.time = std::chrono::duration_cast<std::chrono::milliseconds>(timePoint.time_since_epoch());
+    if (m_enabled)
+    {
+        // only a stream which will actually be logged pays for the timestamp
+        auto timePoint = std::chrono::high_resolution_clock::now();
+        m_logEntry.time = std::chrono::duration_cast<std::chrono::milliseconds>(timePoint.time_since_epoch());
+    }
 }
 
 LogStream::~LogStream()
@@ -41,8 +45,7 @@ LogStream::~LogStream()
 
 void LogStream::Flush()
 {
-    /// @todo do we want to send the log to the logger even if the loglevel is lower than the global log level?
-    if (!m_flushed)
+    if (m_enabled && !m_flushed)
     {
         m_flushed = true;
         m_logger.Log(m_logEntry);
@@ -53,6 +56,10 @@ void LogStream::Flush()
 
 LogStream& LogStream::operator<<(const char* cstr) noexcept
 {
+    if (!m_enabled)
+    {
+        return *this;
+    }
     m_logEntry.message.append(cstr);
     m_flushed = false;
     return *this;
@@ -60,6 +67,10 @@ LogStream& LogStream::operator<<(const char* cstr) noexcept
 
 LogStream& LogStream::operator<<(const std::string& str) noexcept
 {
+    if (!m_enabled)
+    {
+        return *this;
+    }
     m_logEntry.message.append(str);
     m_flushed = false;
     return *this;
@@ -90,6 +101,10 @@ LogStream& operator<<(LogStream& out, LogLevel value) noexcept
 
 LogStream& LogStream::operator<<(const LogRawBuffer& value) noexcept
 {
+    if (!m_enabled)
+    {
+        return *this;
+    }
     std::stringstream ss;
     ss << "0x[";
     ss << std::hex << std::setfill('0');
@@ -17,11 +17,15 @@
 #include "iceoryx_utils/internal/posix_wrapper/posix_access_rights.hpp"
 
 #include <iostream>
+#include <mutex>
+#include <sys/stat.h>
 
 namespace iox
 {
 namespace posix
 {
+constexpr int32_t AccessController::AclCacheCapacity;
+
 bool AccessController::writePermissionsToFile(const int f_fileDescriptor) const
 {
     if (m_permissions.empty())
@@ -30,6 +34,70 @@ bool AccessController::writePermissionsToFile(const int f_fileDescriptor) const
         return false;
     }
 
+    // a complete set of standard categories is expressible as mode bits,
+    // the ACL machinery can be skipped entirely
+    if (isStandardPermissionSet())
+    {
+        return applyStandardFilePermissions(f_fileDescriptor);
+    }
+
+    // compiled ACLs are cached per permission tuple since the same few
+    // tuples are applied to many files (e.g. one per shared memory segment)
+    struct AclCacheEntry
+    {
+        permissionVector_t permissions;
+        smartAclPointer_t acl;
+    };
+    static std::mutex cacheMutex;
+    static cxx::vector<AclCacheEntry, AclCacheCapacity> aclCache;
+
+    acl_t aclToApply{nullptr};
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        for (const auto& cacheEntry : aclCache)
+        {
+            if (hasSamePermissions(cacheEntry.permissions))
+            {
+                aclToApply = reinterpret_cast<acl_t>(cacheEntry.acl.get());
+                break;
+            }
+        }
+    }
+
+    smartAclPointer_t workingACL(nullptr, [](struct __acl_ext*) {});
+    if (aclToApply == nullptr)
+    {
+        workingACL = compileACL();
+        if (!workingACL)
+        {
+            return false;
+        }
+        aclToApply = reinterpret_cast<acl_t>(workingACL.get());
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        if (aclCache.size() < aclCache.capacity())
+        {
+            // the cache keeps the ACL alive for the lifetime of the process,
+            // aclToApply stays valid; when the cache is full the local ACL
+            // is applied and freed afterwards
+            aclCache.emplace_back(AclCacheEntry{m_permissions, std::move(workingACL)});
+        }
+    }
+
+    // set acl in the file given by descriptor
+    auto aclSetFdCall =
+        cxx::makeSmartC(acl_set_fd, cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {0}, {}, f_fileDescriptor, aclToApply);
+    if (aclSetFdCall.hasErrors())
+    {
+        std::cerr << "Error: Could not set file ACL." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+AccessController::smartAclPointer_t AccessController::compileACL() const
+{
     smartAclPointer_t workingACL = createACL((m_permissions.size() + m_useACLMask) ? 1 : 0);
 
     // add acl entries
@@ -37,7 +105,7 @@ bool AccessController::writePermissionsToFile(const int f_fileDescriptor) const
     {
         if (!createACLEntry(workingACL.get(), entry))
         {
-            return false;
+            return smartAclPointer_t(nullptr, [](struct __acl_ext*) {});
         }
     }
 
@@ -54,18 +122,91 @@ bool AccessController::writePermissionsToFile(const int f_fileDescriptor) const
     if (aclCheckCall.hasErrors())
     {
         std::cerr << "Error: Invalid ACL, cannot write to file." << std::endl;
+        return smartAclPointer_t(nullptr, [](struct __acl_ext*) {});
+    }
+
+    return workingACL;
+}
+
+bool AccessController::isStandardPermissionSet() const
+{
+    if (m_useACLMask || m_permissions.size() != 3u)
+    {
         return false;
     }
 
-    // set acl in the file given by descriptor
-    auto aclSetFdCall = cxx::makeSmartC(
-        acl_set_fd, cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {0}, {}, f_fileDescriptor, workingACL.get());
-    if (aclSetFdCall.hasErrors())
+    bool hasUser{false};
+    bool hasGroup{false};
+    bool hasOthers{false};
+    for (const auto& entry : m_permissions)
     {
-        std::cerr << "Error: Could not set file ACL." << std::endl;
+        hasUser |= (entry.m_category == ACL_USER_OBJ);
+        hasGroup |= (entry.m_category == ACL_GROUP_OBJ);
+        hasOthers |= (entry.m_category == ACL_OTHER);
+    }
+    return hasUser && hasGroup && hasOthers;
+}
+
+bool AccessController::applyStandardFilePermissions(const int f_fileDescriptor) const
+{
+    mode_t fileMode{0};
+    for (const auto& entry : m_permissions)
+    {
+        mode_t readBit{0};
+        mode_t writeBit{0};
+        switch (entry.m_category)
+        {
+        case ACL_USER_OBJ:
+            readBit = S_IRUSR;
+            writeBit = S_IWUSR;
+            break;
+        case ACL_GROUP_OBJ:
+            readBit = S_IRGRP;
+            writeBit = S_IWGRP;
+            break;
+        case ACL_OTHER:
+            readBit = S_IROTH;
+            writeBit = S_IWOTH;
+            break;
+        default:
+            std::cerr << "Error: Invalid category for standard file permissions." << std::endl;
+            return false;
+        }
+
+        if (entry.m_permission == Permission::READ || entry.m_permission == Permission::READWRITE)
+        {
+            fileMode |= readBit;
+        }
+        if (entry.m_permission == Permission::WRITE || entry.m_permission == Permission::READWRITE)
+        {
+            fileMode |= writeBit;
+        }
+    }
+
+    auto fchmodCall =
+        cxx::makeSmartC(fchmod, cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {0}, {}, f_fileDescriptor, fileMode);
+    if (fchmodCall.hasErrors())
+    {
+        std::cerr << "Error: Could not set standard file permissions." << std::endl;
         return false;
     }
+    return true;
+}
 
+bool AccessController::hasSamePermissions(const permissionVector_t& f_other) const
+{
+    if (f_other.size() != m_permissions.size())
+    {
+        return false;
+    }
+    for (uint64_t i = 0u; i < m_permissions.size(); ++i)
+    {
+        if (f_other[i].m_category != m_permissions[i].m_category
+            || f_other[i].m_permission != m_permissions[i].m_permission || f_other[i].m_id != m_permissions[i].m_id)
+        {
+            return false;
+        }
+    }
     return true;
 }
 
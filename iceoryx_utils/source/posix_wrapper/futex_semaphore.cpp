@@ -0,0 +1,112 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/posix_wrapper/futex_semaphore.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/futex_ops.hpp"
+
+#if !defined(__linux__)
+#include <chrono>
+#include <thread>
+#endif
+
+namespace iox
+{
+namespace posix
+{
+FutexSemaphore::FutexSemaphore(const uint32_t f_initialValue) noexcept
+    : m_counter(f_initialValue)
+{
+}
+
+bool FutexSemaphore::getValue(int& f_value) const noexcept
+{
+    f_value = static_cast<int>(m_counter.load(std::memory_order_relaxed));
+    return true;
+}
+
+bool FutexSemaphore::post() noexcept
+{
+    m_counter.fetch_add(1u, std::memory_order_release);
+#if defined(__linux__) && defined(__NR_futex)
+    if (m_waiters.load(std::memory_order_acquire) != 0u)
+    {
+        internal::futexWakeOne(&m_counter);
+    }
+#endif
+    return true;
+}
+
+bool FutexSemaphore::tryWait() noexcept
+{
+    uint32_t count = m_counter.load(std::memory_order_relaxed);
+    while (count != 0u)
+    {
+        if (m_counter.compare_exchange_weak(count, count - 1u, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FutexSemaphore::wait() noexcept
+{
+    while (!tryWait())
+    {
+#if defined(__linux__) && defined(__NR_futex)
+        m_waiters.fetch_add(1u, std::memory_order_relaxed);
+        internal::futexWait(&m_counter, 0u);
+        m_waiters.fetch_sub(1u, std::memory_order_relaxed);
+#else
+        // no futex available, fall back to polling
+        std::this_thread::sleep_for(std::chrono::microseconds(100u));
+#endif
+    }
+    return true;
+}
+
+bool FutexSemaphore::timedWait(const struct timespec* f_absTimeout) noexcept
+{
+    while (!tryWait())
+    {
+        // like in sem_timedwait the timeout is absolute in CLOCK_REALTIME,
+        // the remaining time is recomputed on every wakeup
+        struct timespec now;
+        clock_gettime(CLOCK_REALTIME, &now);
+        timespec remaining;
+        remaining.tv_sec = f_absTimeout->tv_sec - now.tv_sec;
+        remaining.tv_nsec = f_absTimeout->tv_nsec - now.tv_nsec;
+        if (remaining.tv_nsec < 0)
+        {
+            remaining.tv_sec -= 1;
+            remaining.tv_nsec += 1000000000;
+        }
+        if (remaining.tv_sec < 0)
+        {
+            return false;
+        }
+#if defined(__linux__) && defined(__NR_futex)
+        m_waiters.fetch_add(1u, std::memory_order_relaxed);
+        internal::futexTimedWait(&m_counter, 0u, remaining);
+        m_waiters.fetch_sub(1u, std::memory_order_relaxed);
+#else
+        // no futex available, fall back to polling
+        std::this_thread::sleep_for(std::chrono::microseconds(100u));
+#endif
+    }
+    return true;
+}
+
+} // namespace posix
+} // namespace iox
@@ -0,0 +1,95 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/posix_wrapper/futex_signal.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/futex_ops.hpp"
+
+#include <chrono>
+
+#if !defined(__linux__)
+#include <thread>
+#endif
+
+namespace iox
+{
+namespace posix
+{
+void FutexSignal::post() noexcept
+{
+    m_counter.fetch_add(1u, std::memory_order_release);
+#if defined(__linux__) && defined(__NR_futex)
+    if (m_waiters.load(std::memory_order_acquire) != 0u)
+    {
+        internal::futexWakeOne(&m_counter);
+    }
+#endif
+}
+
+bool FutexSignal::tryWait() noexcept
+{
+    uint32_t count = m_counter.load(std::memory_order_relaxed);
+    while (count != 0u)
+    {
+        if (m_counter.compare_exchange_weak(count, count - 1u, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FutexSignal::timedWait(const uint32_t f_timeoutMs) noexcept
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(f_timeoutMs);
+    while (!tryWait())
+    {
+        const auto remaining = deadline - std::chrono::steady_clock::now();
+        if (remaining <= std::chrono::nanoseconds::zero())
+        {
+            return false;
+        }
+#if defined(__linux__) && defined(__NR_futex)
+        timespec timeout;
+        timeout.tv_sec = std::chrono::duration_cast<std::chrono::seconds>(remaining).count();
+        timeout.tv_nsec =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count() % 1000000000;
+        m_waiters.fetch_add(1u, std::memory_order_relaxed);
+        internal::futexTimedWait(&m_counter, 0u, timeout);
+        m_waiters.fetch_sub(1u, std::memory_order_relaxed);
+#else
+        // no futex available, fall back to polling
+        std::this_thread::sleep_for(std::chrono::microseconds(100u));
+#endif
+    }
+    return true;
+}
+
+bool FutexSignal::wait() noexcept
+{
+    while (!tryWait())
+    {
+#if defined(__linux__) && defined(__NR_futex)
+        m_waiters.fetch_add(1u, std::memory_order_relaxed);
+        internal::futexWait(&m_counter, 0u);
+        m_waiters.fetch_sub(1u, std::memory_order_relaxed);
+#else
+        // no futex available, fall back to polling
+        std::this_thread::sleep_for(std::chrono::microseconds(100u));
+#endif
+    }
+    return true;
+}
+
+} // namespace posix
+} // namespace iox
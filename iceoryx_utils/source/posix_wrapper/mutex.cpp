@@ -14,6 +14,7 @@
 
 #include "iceoryx_utils/internal/posix_wrapper/mutex.hpp"
 #include "iceoryx_utils/cxx/smart_c.hpp"
+#include "iceoryx_utils/internal/concurrent/spin_backoff.hpp"
 #include <cassert>
 #include <utility>
 
@@ -21,10 +22,10 @@ namespace iox
 {
 namespace posix
 {
-cxx::optional<mutex> mutex::CreateMutex(const bool f_isRecursive)
+cxx::optional<mutex> mutex::CreateMutex(const bool f_isRecursive, const uint32_t f_adaptiveSpinLimit)
 {
     cxx::optional<mutex> returnValue;
-    returnValue.emplace(f_isRecursive);
+    returnValue.emplace(f_isRecursive, f_adaptiveSpinLimit);
     if (!returnValue->m_isInitialized)
     {
         return cxx::nullopt_t();
@@ -32,7 +33,8 @@ cxx::optional<mutex> mutex::CreateMutex(const bool f_isRecursive)
     return returnValue;
 }
 
-mutex::mutex(bool f_isRecursive)
+mutex::mutex(bool f_isRecursive, const uint32_t f_adaptiveSpinLimit)
+    : m_adaptiveSpinLimit(f_adaptiveSpinLimit)
 {
     pthread_mutexattr_t attr;
     m_isInitialized &=
@@ -68,6 +70,7 @@ mutex::mutex(mutex&& rhs) noexcept
 {
     m_handle = rhs.m_handle;
     m_isInitialized = rhs.m_isInitialized;
+    m_adaptiveSpinLimit = rhs.m_adaptiveSpinLimit;
     rhs.m_isInitialized = false;
 }
 
@@ -95,6 +98,21 @@ pthread_mutex_t mutex::get_native_handle() const noexcept
 
 bool mutex::lock()
 {
+    // adaptive spin phase: for critical sections much shorter than a system
+    // call the lock is usually free again before the backoff is exhausted
+    // and the futex round trip of the blocking call below is saved; the raw
+    // trylock is used on purpose, a busy lock is expected here and must not
+    // be reported as an error
+    concurrent::SpinBackoff backoff;
+    for (uint32_t i = 0u; i < m_adaptiveSpinLimit; ++i)
+    {
+        if (pthread_mutex_trylock(&m_handle) == 0)
+        {
+            return true;
+        }
+        backoff.pause();
+    }
+
     return !cxx::makeSmartC(pthread_mutex_lock, cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {0}, {}, &m_handle)
                 .hasErrors();
 }
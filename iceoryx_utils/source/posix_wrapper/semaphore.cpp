@@ -74,14 +74,14 @@ Semaphore::~Semaphore() noexcept
 bool Semaphore::getValue(int& value) const noexcept
 {
     return m_isInitialized
-           && !cxx::makeSmartC(sem_getvalue, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_handlePtr, &value)
+           && !cxx::makeLeanSmartC(sem_getvalue, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_handlePtr, &value)
                    .hasErrors();
 }
 
 bool Semaphore::post() noexcept
 {
     return m_isInitialized
-           && !cxx::makeSmartC(sem_post, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_handlePtr).hasErrors();
+           && !cxx::makeLeanSmartC(sem_post, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_handlePtr).hasErrors();
 }
 
 bool Semaphore::timedWait(const struct timespec* abs_timeout, const bool doContinueOnInterrupt) const noexcept
@@ -97,7 +97,7 @@ bool Semaphore::timedWait(const struct timespec* abs_timeout, const bool doConti
         // interruption error
         while (true)
         {
-            auto cCall = cxx::makeSmartC(
+            auto cCall = cxx::makeLeanSmartC(
                 sem_timedwait, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {ETIMEDOUT}, m_handlePtr, abs_timeout);
             if (cCall.hasErrors())
             {
@@ -115,7 +115,7 @@ bool Semaphore::timedWait(const struct timespec* abs_timeout, const bool doConti
     }
     else
     {
-        auto cCall = cxx::makeSmartC(
+        auto cCall = cxx::makeLeanSmartC(
             sem_timedwait, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {ETIMEDOUT}, m_handlePtr, abs_timeout);
         if (cCall.hasErrors() || cCall.getErrNum() == ETIMEDOUT)
         {
@@ -135,7 +135,7 @@ bool Semaphore::tryWait() const noexcept
         return false;
     }
 
-    auto cCall = cxx::makeSmartC(sem_trywait, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {EAGAIN}, m_handlePtr);
+    auto cCall = cxx::makeLeanSmartC(sem_trywait, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {EAGAIN}, m_handlePtr);
 
     if (cCall.hasErrors() || cCall.getErrNum() == EAGAIN)
     {
@@ -150,7 +150,7 @@ bool Semaphore::tryWait() const noexcept
 bool Semaphore::wait() const noexcept
 {
     return m_isInitialized
-           && !cxx::makeSmartC(sem_wait, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_handlePtr).hasErrors();
+           && !cxx::makeLeanSmartC(sem_wait, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_handlePtr).hasErrors();
 }
 
 sem_t* Semaphore::getHandle() noexcept
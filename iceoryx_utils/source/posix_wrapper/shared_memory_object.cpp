@@ -101,6 +101,21 @@ void SharedMemoryObject::finalizeAllocation()
     m_allocator.finalizeAllocation();
 }
 
+bool SharedMemoryObject::adviseHugePages()
+{
+    return m_memoryMap.adviseHugePages();
+}
+
+bool SharedMemoryObject::bindToNumaNode(const uint32_t f_numaNode)
+{
+    return m_memoryMap.bindToNumaNode(f_numaNode);
+}
+
+void SharedMemoryObject::prefault()
+{
+    m_memoryMap.prefault();
+}
+
 bool SharedMemoryObject::isInitialized() const
 {
     return m_isInitialized;
@@ -14,6 +14,16 @@
 
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/memory_map.hpp"
 #include "iceoryx_utils/cxx/smart_c.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/system_configuration.hpp"
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <thread>
+#include <vector>
 
 namespace iox
 {
@@ -108,6 +118,107 @@ MemoryMap::~MemoryMap()
     }
 }
 
+bool MemoryMap::adviseHugePages()
+{
+#if defined(MADV_HUGEPAGE)
+    auto madviseCall = cxx::makeSmartC(
+        madvise, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_baseAddress, m_length, MADV_HUGEPAGE);
+
+    if (madviseCall.hasErrors())
+    {
+        std::cerr << "Unable to request huge pages for memory mapping : " << madviseCall.getErrorString() << std::endl;
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool MemoryMap::bindToNumaNode(const uint32_t f_numaNode)
+{
+#if defined(__linux__) && defined(__NR_mbind)
+    // MPOL_BIND from linux/mempolicy.h, avoids a dependency on libnuma
+    constexpr int MPOL_BIND{2};
+    constexpr uint64_t MAX_NODES{sizeof(uint64_t) * 8u};
+
+    if (f_numaNode >= MAX_NODES)
+    {
+        return false;
+    }
+
+    uint64_t nodeMask = 1ull << f_numaNode;
+    auto mbindCall = cxx::makeSmartC(syscall,
+                                     cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
+                                     {-1l},
+                                     {},
+                                     static_cast<long>(__NR_mbind),
+                                     m_baseAddress,
+                                     m_length,
+                                     MPOL_BIND,
+                                     &nodeMask,
+                                     MAX_NODES,
+                                     0u);
+
+    if (mbindCall.hasErrors())
+    {
+        std::cerr << "Unable to bind memory mapping to NUMA node " << f_numaNode << " : "
+                  << mbindCall.getErrorString() << std::endl;
+        return false;
+    }
+    return true;
+#else
+    static_cast<void>(f_numaNode);
+    return false;
+#endif
+}
+
+void MemoryMap::prefault()
+{
+    const uint64_t currentPageSize = pageSize().value_or(MaxPageSize);
+
+    auto touchRange = [&](const uint64_t f_begin, const uint64_t f_end) {
+        auto memory = static_cast<volatile uint8_t*>(m_baseAddress);
+        for (uint64_t offset = f_begin; offset < f_end; offset += currentPageSize)
+        {
+            (void)memory[offset];
+        }
+    };
+
+    // faulting the pages in is dominated by the kernel zeroing them and is
+    // independent per page, so large mappings are split among the available
+    // cores; small mappings stay on the calling thread where the thread
+    // creation would cost more than it saves
+    constexpr uint64_t MIN_BYTES_PER_THREAD{64u * 1024u * 1024u};
+    const uint64_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    const uint64_t threadCount = std::min(hardwareThreads, m_length / MIN_BYTES_PER_THREAD);
+
+    if (threadCount < 2u)
+    {
+        touchRange(0u, m_length);
+        return;
+    }
+
+    const uint64_t pageCount = (m_length + currentPageSize - 1u) / currentPageSize;
+    const uint64_t pagesPerThread = (pageCount + threadCount - 1u) / threadCount;
+
+    std::vector<std::thread> workers;
+    for (uint64_t i = 0u; i < threadCount; i++)
+    {
+        const uint64_t begin = i * pagesPerThread * currentPageSize;
+        const uint64_t end = std::min(begin + pagesPerThread * currentPageSize, m_length);
+        if (begin < end)
+        {
+            workers.emplace_back(touchRange, begin, end);
+        }
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
 bool MemoryMap::isInitialized() const
 {
     return m_isInitialized;
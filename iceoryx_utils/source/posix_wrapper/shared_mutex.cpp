@@ -0,0 +1,72 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/internal/posix_wrapper/shared_mutex.hpp"
+#include "iceoryx_utils/cxx/smart_c.hpp"
+
+namespace iox
+{
+namespace posix
+{
+shared_mutex::~shared_mutex()
+{
+    auto destroyCall =
+        cxx::makeSmartC(pthread_rwlock_destroy, cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {0}, {}, &m_handle);
+
+    if (destroyCall.hasErrors())
+    {
+        std::cerr << "could not destroy shared mutex ::: pthread_rwlock_destroy returned "
+                  << destroyCall.getReturnValue() << " "
+                  << "( " << strerror(destroyCall.getReturnValue()) << ") " << std::endl;
+        std::terminate();
+    }
+}
+
+bool shared_mutex::lock()
+{
+    return !cxx::makeSmartC(pthread_rwlock_wrlock, cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {0}, {}, &m_handle)
+                .hasErrors();
+}
+
+bool shared_mutex::unlock()
+{
+    return !cxx::makeSmartC(pthread_rwlock_unlock, cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {0}, {}, &m_handle)
+                .hasErrors();
+}
+
+bool shared_mutex::try_lock()
+{
+    return !cxx::makeSmartC(pthread_rwlock_trywrlock, cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {0}, {}, &m_handle)
+                .hasErrors();
+}
+
+bool shared_mutex::lock_shared()
+{
+    return !cxx::makeSmartC(pthread_rwlock_rdlock, cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {0}, {}, &m_handle)
+                .hasErrors();
+}
+
+bool shared_mutex::unlock_shared()
+{
+    return !cxx::makeSmartC(pthread_rwlock_unlock, cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {0}, {}, &m_handle)
+                .hasErrors();
+}
+
+bool shared_mutex::try_lock_shared()
+{
+    return !cxx::makeSmartC(pthread_rwlock_tryrdlock, cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {0}, {}, &m_handle)
+                .hasErrors();
+}
+} // namespace posix
+} // namespace iox
@@ -0,0 +1,78 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/posix_wrapper/thread_attributes.hpp"
+
+#include "ac3log/simplelogger.hpp"
+
+#include <cstring>
+#include <sched.h>
+
+namespace iox
+{
+namespace posix
+{
+bool applyThreadAttributes(const pthread_t f_handle, const ThreadAttributes& f_attributes) noexcept
+{
+    bool l_success{true};
+
+    if (!f_attributes.m_name.empty())
+    {
+        // thread names are restricted to 16 characters including the terminator
+        char l_name[16];
+        strncpy(l_name, f_attributes.m_name.c_str(), sizeof(l_name) - 1u);
+        l_name[sizeof(l_name) - 1u] = '\0';
+        if (pthread_setname_np(f_handle, l_name) != 0)
+        {
+            WARN_PRINTF("could not set thread name '%s'\n", l_name);
+            l_success = false;
+        }
+    }
+
+    if (f_attributes.m_affinityMask != 0u)
+    {
+        cpu_set_t l_cpuSet;
+        CPU_ZERO(&l_cpuSet);
+        for (uint32_t cpu = 0u; cpu < 64u; ++cpu)
+        {
+            if ((f_attributes.m_affinityMask & (1ull << cpu)) != 0u)
+            {
+                CPU_SET(cpu, &l_cpuSet);
+            }
+        }
+        if (pthread_setaffinity_np(f_handle, sizeof(l_cpuSet), &l_cpuSet) != 0)
+        {
+            WARN_PRINTF("could not set thread affinity mask 0x%llx\n",
+                        static_cast<unsigned long long>(f_attributes.m_affinityMask));
+            l_success = false;
+        }
+    }
+
+    if (f_attributes.m_schedFifoPriority != 0)
+    {
+        struct sched_param l_schedParam;
+        l_schedParam.sched_priority = f_attributes.m_schedFifoPriority;
+        if (pthread_setschedparam(f_handle, SCHED_FIFO, &l_schedParam) != 0)
+        {
+            // typically missing CAP_SYS_NICE; the thread keeps the inherited policy
+            WARN_PRINTF("could not set SCHED_FIFO priority %d\n", f_attributes.m_schedFifoPriority);
+            l_success = false;
+        }
+    }
+
+    return l_success;
+}
+
+} // namespace posix
+} // namespace iox
@@ -21,84 +21,6 @@ namespace iox
 {
 namespace posix
 {
-Timer::OsTimerCallbackHandle Timer::OsTimer::s_callbackHandlePool[MAX_NUMBER_OF_CALLBACK_HANDLES];
-
-sigval Timer::OsTimerCallbackHandle::indexAndDescriptorToSigval(uint8_t index, uint32_t descriptor)
-{
-    // the max value of descriptor is 2^24 - 1;
-    assert(descriptor < MAX_DESCRIPTOR_VALUE);
-    uint32_t temp = (descriptor << 8) | static_cast<uint32_t>(index);
-    sigval sigvalData;
-    sigvalData.sival_int = static_cast<int>(temp);
-    return sigvalData;
-}
-
-uint8_t Timer::OsTimerCallbackHandle::sigvalToIndex(sigval intVal)
-{
-    return static_cast<uint8_t>(0xFF & intVal.sival_int);
-}
-
-uint32_t Timer::OsTimerCallbackHandle::sigvalToDescriptor(sigval intVal)
-{
-    uint32_t temp = static_cast<uint32_t>(intVal.sival_int);
-    return (temp >> 8) & 0xFFFFFF;
-}
-
-void Timer::OsTimerCallbackHandle::incrementDescriptor()
-{
-    auto callbackHandleDescriptor = m_descriptor.load(std::memory_order_relaxed);
-    callbackHandleDescriptor++;
-    if (callbackHandleDescriptor >= Timer::OsTimerCallbackHandle::MAX_DESCRIPTOR_VALUE)
-    {
-        callbackHandleDescriptor = 0;
-    }
-
-    m_descriptor.store(callbackHandleDescriptor, std::memory_order_relaxed);
-}
-
-void Timer::OsTimer::callbackHelper(sigval data)
-{
-    auto index = Timer::OsTimerCallbackHandle::sigvalToIndex(data);
-    auto descriptor = Timer::OsTimerCallbackHandle::sigvalToDescriptor(data);
-
-    /// @todo cxx::expect
-    if (index >= Timer::OsTimerCallbackHandle::MAX_DESCRIPTOR_VALUE)
-    {
-        ///@todo decide if to print a warning
-        return;
-    }
-
-    auto& callbackHandle = OsTimer::s_callbackHandlePool[index];
-
-    // small optimazition to not lock the mutex if the callback handle is not valid anymore
-    if (descriptor != callbackHandle.m_descriptor.load(std::memory_order::memory_order_relaxed))
-    {
-        return;
-    }
-
-    std::lock_guard<std::mutex> lock(callbackHandle.m_accessMutex);
-    if (!callbackHandle.m_inUse.load(std::memory_order::memory_order_relaxed))
-    {
-        return;
-    }
-
-    if (descriptor != callbackHandle.m_descriptor.load(std::memory_order::memory_order_relaxed))
-    {
-        return;
-    }
-
-    if (!callbackHandle.m_isTimerActive.load(std::memory_order::memory_order_relaxed))
-    {
-        return;
-    }
-
-    /// @todo cxx::expect
-    if (callbackHandle.m_timer != nullptr)
-    {
-        callbackHandle.m_timer->executeCallback();
-    }
-}
-
 Timer::OsTimer::OsTimer(units::Duration timeToWait, std::function<void()> callback) noexcept
     : m_timeToWait(timeToWait)
     , m_callback(callback)
@@ -111,165 +33,47 @@ Timer::OsTimer::OsTimer(units::Duration timeToWait, std::function<void()> callba
         return;
     }
 
-    // find OsTimerCallbackHandle not in use
-    bool callbackHandleFound = false;
-    uint32_t callbackHandleDescriptor = 0;
-    for (auto& callbackHandle : OsTimer::s_callbackHandlePool)
-    {
-        if (!callbackHandle.m_inUse.load(std::memory_order_relaxed))
-        {
-            std::lock_guard<std::mutex> lock(callbackHandle.m_accessMutex);
-            // check in use again, just in case there we lost the race before we got the lock
-            if (callbackHandle.m_inUse.load(std::memory_order_relaxed))
-            {
-                m_callbackHandleIndex++;
-                continue;
-            }
-
-            callbackHandle.incrementDescriptor();
-            callbackHandle.m_isTimerActive.store(true, std::memory_order_relaxed);
-            callbackHandle.m_inUse.store(true, std::memory_order_relaxed);
-            callbackHandle.m_timer = this;
-
-            callbackHandleFound = true;
-            callbackHandleDescriptor = callbackHandle.m_descriptor.load(std::memory_order_relaxed);
-            break;
-        }
-        m_callbackHandleIndex++;
-    }
-
-    if (!callbackHandleFound)
+    // all timers are multiplexed onto the process-wide timing wheel, no
+    // kernel timer is created per instance anymore
+    auto taskHandle = TimingWheel::instance().registerTask(m_callback);
+    if (!taskHandle.has_value())
     {
         errorHandler(Error::kPOSIX_TIMER__TIMERPOOL_OVERFLOW);
-    }
-
-    // Create the struct in order to configure the timer in the OS
-    struct sigevent asyncCallNotification;
-    // We want the timer to call a function
-    asyncCallNotification.sigev_notify = SIGEV_THREAD;
-    // Set the function pointer to our sigevent
-    asyncCallNotification.sigev_notify_function = &callbackHelper;
-    // Save the pointer to self in order to execute the callback
-    asyncCallNotification.sigev_value.sival_ptr = nullptr; // initialize all bits of the sigval union for mem check
-    asyncCallNotification.sigev_value.sival_int =
-        Timer::OsTimerCallbackHandle::indexAndDescriptorToSigval(m_callbackHandleIndex, callbackHandleDescriptor)
-            .sival_int;
-    // Do not set any thread attributes
-    asyncCallNotification.sigev_notify_attributes = nullptr;
-
-    auto result = cxx::makeSmartC(timer_create,
-                                  cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
-                                  {-1},
-                                  {},
-                                  CLOCK_REALTIME,
-                                  &asyncCallNotification,
-                                  &m_timerId);
-
-    if (result.hasErrors())
-    {
         m_isInitialized = false;
-        m_errorValue = createErrorFromErrno(result.getErrNum()).value;
-        m_timerId = INVALID_TIMER_ID;
-    }
-    else
-    {
-        m_isInitialized = true;
+        m_errorValue = TimerError::INTERNAL_LOGIC_ERROR;
+        return;
     }
+
+    m_taskHandle = *taskHandle;
+    m_isInitialized = true;
 }
 
 
 Timer::OsTimer::~OsTimer() noexcept
 {
-    if (m_timerId != INVALID_TIMER_ID)
+    if (m_isInitialized)
     {
-        stop();
-
-        auto result = cxx::makeSmartC(timer_delete, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_timerId);
-
-        if (result.hasErrors())
-        {
-            createErrorFromErrno(result.getErrNum());
-            std::cerr << "Unable to cleanup posix::Timer \"" << m_timerId << "\" in the destructor" << std::endl;
-        }
-
-        m_timerId = INVALID_TIMER_ID;
-
-        auto& callbackHandle = OsTimer::s_callbackHandlePool[m_callbackHandleIndex];
-        std::lock_guard<std::mutex> lock(callbackHandle.m_accessMutex);
-        callbackHandle.m_inUse.store(false, std::memory_order_relaxed);
-    }
-}
-
-void Timer::OsTimer::executeCallback() noexcept
-{
-    if (m_isInitialized && m_callback)
-    {
-        m_callback();
-    }
-    else
-    {
-        // Thread couldn't reach callback or object is not correctly initalized, maybe the originial object was a
-        // temporary?
-        errorHandler(Error::kPOSIX_TIMER__FIRED_TIMER_BUT_STATE_IS_INVALID);
+        // blocks until a concurrently running callback has returned, after
+        // this call the callback is never called again
+        TimingWheel::instance().unregisterTask(m_taskHandle);
     }
 }
 
 cxx::expected<TimerError> Timer::OsTimer::start(const RunMode runMode) noexcept
 {
-    // Convert units::Duration to itimerspec
-    struct itimerspec interval;
-    interval.it_value = m_timeToWait.timespec(units::TimeSpecReference::None);
-
-    if (runMode == RunMode::PERIODIC)
+    if (!TimingWheel::instance().startTask(m_taskHandle, m_timeToWait, runMode == RunMode::PERIODIC))
     {
-        interval.it_interval = m_timeToWait.timespec(units::TimeSpecReference::None);
-    }
-    else
-    {
-        interval.it_interval.tv_sec = 0;
-        interval.it_interval.tv_nsec = 0;
-    }
-
-    // Set the timer
-    auto result = cxx::makeSmartC(
-        timer_settime, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_timerId, 0, &interval, nullptr);
-
-    if (result.hasErrors())
-    {
-        return createErrorFromErrno(result.getErrNum());
+        return cxx::error<TimerError>(TimerError::TIMER_NOT_INITIALIZED);
     }
 
-    OsTimer::s_callbackHandlePool[m_callbackHandleIndex].m_isTimerActive.store(true, std::memory_order_relaxed);
-
     return cxx::success<void>();
 }
 
 cxx::expected<TimerError> Timer::OsTimer::stop() noexcept
 {
-    // Signal callbackHelper() that no callbacks shall be executed anymore
-    auto wasActive =
-        OsTimer::s_callbackHandlePool[m_callbackHandleIndex].m_isTimerActive.exchange(false, std::memory_order_relaxed);
-
-    if (!wasActive)
+    if (!TimingWheel::instance().stopTask(m_taskHandle))
     {
-        // Timer was not started yet
-        return cxx::success<void>();
-    }
-
-    struct itimerspec interval;
-    units::Duration zero = 0_s;
-    interval.it_value = zero.timespec(units::TimeSpecReference::None);
-    interval.it_interval.tv_sec = 0;
-    interval.it_interval.tv_nsec = 0;
-
-
-    // Disarm the timer
-    auto result = cxx::makeSmartC(
-        timer_settime, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_timerId, 0, &interval, nullptr);
-
-    if (result.hasErrors())
-    {
-        return createErrorFromErrno(result.getErrNum());
+        return cxx::error<TimerError>(TimerError::TIMER_NOT_INITIALIZED);
     }
 
     return cxx::success<void>();
@@ -277,26 +81,15 @@ cxx::expected<TimerError> Timer::OsTimer::stop() noexcept
 
 cxx::expected<TimerError> Timer::OsTimer::restart(const units::Duration timeToWait, const RunMode runMode) noexcept
 {
-    // See if there is currently an active timer in the operating system and update m_isActive accordingly
-    auto gettimeResult = timeUntilExpiration();
-
-    if (gettimeResult.has_error())
-    {
-        return gettimeResult;
-    }
-
     // Set new timeToWait value
     m_timeToWait = timeToWait;
 
     // Disarm running timer
-    if (OsTimer::s_callbackHandlePool[m_callbackHandleIndex].m_isTimerActive.load(std::memory_order_relaxed))
-    {
-        auto stopResult = stop();
+    auto stopResult = stop();
 
-        if (stopResult.has_error())
-        {
-            return stopResult;
-        }
+    if (stopResult.has_error())
+    {
+        return stopResult;
     }
 
     // Activate the timer with the new timeToWait value
@@ -311,33 +104,35 @@ cxx::expected<TimerError> Timer::OsTimer::restart(const units::Duration timeToWa
 
 cxx::expected<units::Duration, TimerError> Timer::OsTimer::timeUntilExpiration() noexcept
 {
-    struct itimerspec currentInterval;
-
-    auto result =
-        cxx::makeSmartC(timer_gettime, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_timerId, &currentInterval);
-
-    if (result.hasErrors())
+    auto remainingTime = TimingWheel::instance().timeUntilExpiration(m_taskHandle);
+    if (!remainingTime.has_value())
     {
-        return createErrorFromErrno(result.getErrNum());
+        return cxx::error<TimerError>(TimerError::TIMER_NOT_INITIALIZED);
     }
 
-    if (currentInterval.it_value.tv_sec == 0 && currentInterval.it_value.tv_sec == 0)
-    {
-        // Timer is disarmed
-        OsTimer::s_callbackHandlePool[m_callbackHandleIndex].m_isTimerActive.store(false, std::memory_order_relaxed);
-    }
-    return cxx::success<units::Duration>(currentInterval.it_value);
+    return cxx::success<units::Duration>(*remainingTime);
 }
 
 cxx::expected<uint64_t, TimerError> Timer::OsTimer::getOverruns() noexcept
 {
-    auto result = cxx::makeSmartC(timer_getoverrun, cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {-1}, {}, m_timerId);
+    auto overruns = TimingWheel::instance().getOverruns(m_taskHandle);
+    if (!overruns.has_value())
+    {
+        return cxx::error<TimerError>(TimerError::TIMER_NOT_INITIALIZED);
+    }
 
-    if (result.hasErrors())
+    return cxx::success<uint64_t>(*overruns);
+}
+
+cxx::expected<TimingWheel::RuntimeStatistics, TimerError> Timer::OsTimer::getRuntimeStatistics() noexcept
+{
+    auto statistics = TimingWheel::instance().getRuntimeStatistics(m_taskHandle);
+    if (!statistics.has_value())
     {
-        return createErrorFromErrno(result.getErrNum());
+        return cxx::error<TimerError>(TimerError::TIMER_NOT_INITIALIZED);
     }
-    return cxx::success<uint64_t>(result.getReturnValue());
+
+    return cxx::success<TimingWheel::RuntimeStatistics>(*statistics);
 }
 
 bool Timer::OsTimer::hasError() const noexcept
@@ -432,6 +227,16 @@ cxx::expected<uint64_t, TimerError> Timer::getOverruns() noexcept
     return m_osTimer->getOverruns();
 }
 
+cxx::expected<TimingWheel::RuntimeStatistics, TimerError> Timer::getRuntimeStatistics() noexcept
+{
+    if (!m_osTimer.has_value())
+    {
+        return cxx::error<TimerError>(TimerError::TIMER_NOT_INITIALIZED);
+    }
+
+    return m_osTimer->getRuntimeStatistics();
+}
+
 void Timer::resetCreationTime() noexcept
 {
     // Get the current time
@@ -0,0 +1,542 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/internal/posix_wrapper/timing_wheel.hpp"
+#include "iceoryx_utils/cxx/helplets.hpp"
+
+#include <chrono>
+#include <limits>
+#include <time.h>
+#if defined(__linux__)
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+namespace iox
+{
+namespace posix
+{
+constexpr uint32_t TimingWheel::MAX_NUMBER_OF_TASKS;
+constexpr uint64_t TimingWheel::TICK_DURATION_NS;
+constexpr uint32_t TimingWheel::NUMBER_OF_LEVELS;
+constexpr uint32_t TimingWheel::SLOTS_PER_LEVEL;
+constexpr uint32_t TimingWheel::INVALID_INDEX;
+
+namespace
+{
+constexpr uint64_t NO_DEADLINE = std::numeric_limits<uint64_t>::max();
+constexpr uint32_t BITS_PER_LEVEL = 8u;
+
+uint64_t monotonicTimeNs() noexcept
+{
+    struct timespec value;
+    clock_gettime(CLOCK_MONOTONIC, &value);
+    return static_cast<uint64_t>(value.tv_sec) * 1000000000u + static_cast<uint64_t>(value.tv_nsec);
+}
+} // namespace
+
+TimingWheel& TimingWheel::instance() noexcept
+{
+    static TimingWheel wheel;
+    return wheel;
+}
+
+TimingWheel::TimingWheel() noexcept
+{
+    for (auto& level : m_wheel)
+    {
+        for (auto& slot : level)
+        {
+            slot = INVALID_INDEX;
+        }
+    }
+
+    m_startTimeNs = monotonicTimeNs();
+
+#if defined(__linux__)
+    m_timerFd = timerfd_create(CLOCK_MONOTONIC, 0);
+    cxx::Expects(m_timerFd != -1);
+#endif
+
+    m_dispatcher = std::thread(&TimingWheel::dispatcherLoop, this);
+    m_executor = std::thread(&TimingWheel::executorLoop, this);
+}
+
+TimingWheel::~TimingWheel() noexcept
+{
+    m_keepRunning.store(false, std::memory_order_relaxed);
+#if defined(__linux__)
+    // wake the dispatcher with an immediate expiration so that it can observe
+    // m_keepRunning
+    struct itimerspec wakeupNow {};
+    wakeupNow.it_value.tv_nsec = 1;
+    timerfd_settime(m_timerFd, 0, &wakeupNow, nullptr);
+#else
+    m_wakeup.notify_one();
+#endif
+    m_runQueuePending.post();
+    m_dispatcher.join();
+    m_executor.join();
+#if defined(__linux__)
+    close(m_timerFd);
+#endif
+}
+
+cxx::optional<TimingWheel::TaskHandle> TimingWheel::registerTask(const std::function<void()>& callback) noexcept
+{
+    if (!callback)
+    {
+        return cxx::nullopt_t();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (uint32_t i = 0u; i < MAX_NUMBER_OF_TASKS; ++i)
+    {
+        if (!m_tasks[i].inUse)
+        {
+            auto& task = m_tasks[i];
+            ++task.generation;
+            task.callback = callback;
+            task.inUse = true;
+            task.armed = false;
+            task.queued = false;
+            task.overruns = 0u;
+            task.statistics = RuntimeStatistics();
+
+            TaskHandle handle;
+            handle.index = i;
+            handle.generation = task.generation;
+            return cxx::make_optional<TaskHandle>(handle);
+        }
+    }
+    return cxx::nullopt_t();
+}
+
+void TimingWheel::unregisterTask(const TaskHandle& handle) noexcept
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto* task = taskFromHandle(handle);
+    if (task == nullptr)
+    {
+        return;
+    }
+
+    if (task->linked)
+    {
+        unlink(handle.index);
+    }
+    task->armed = false;
+
+    // guarantee that the callback is never called after unregisterTask; an
+    // expiry still waiting in the run queue is skipped by the executor since
+    // clearing inUse invalidates its queue entry
+    while (task->executing)
+    {
+        m_executionFinished.wait(lock);
+    }
+
+    task->callback = std::function<void()>();
+    task->queued = false;
+    task->inUse = false;
+}
+
+bool TimingWheel::startTask(const TaskHandle& handle, const units::Duration timeToWait, const bool periodic) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto* task = taskFromHandle(handle);
+    if (task == nullptr)
+    {
+        return false;
+    }
+
+    if (task->linked)
+    {
+        unlink(handle.index);
+    }
+
+    uint64_t periodTicks = timeToWait.nanoSeconds<uint64_t>() / TICK_DURATION_NS;
+    if (periodTicks == 0u)
+    {
+        periodTicks = 1u;
+    }
+
+    task->periodTicks = periodTicks;
+    task->periodic = periodic;
+    task->deadlineTick = nowTick() + periodTicks;
+    task->overruns = 0u;
+    task->armed = true;
+    link(handle.index);
+
+    armWakeup(nextDeadline());
+    return true;
+}
+
+bool TimingWheel::stopTask(const TaskHandle& handle) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto* task = taskFromHandle(handle);
+    if (task == nullptr)
+    {
+        return false;
+    }
+
+    if (task->linked)
+    {
+        unlink(handle.index);
+    }
+    task->armed = false;
+    return true;
+}
+
+cxx::optional<units::Duration> TimingWheel::timeUntilExpiration(const TaskHandle& handle) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto* task = taskFromHandle(handle);
+    if (task == nullptr)
+    {
+        return cxx::nullopt_t();
+    }
+
+    const uint64_t now = nowTick();
+    if (!task->armed || task->deadlineTick <= now)
+    {
+        return cxx::make_optional<units::Duration>(units::Duration::nanoseconds(0ull));
+    }
+    return cxx::make_optional<units::Duration>(
+        units::Duration::nanoseconds(
+        static_cast<unsigned long long>((task->deadlineTick - now) * TICK_DURATION_NS)));
+}
+
+cxx::optional<uint64_t> TimingWheel::getOverruns(const TaskHandle& handle) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto* task = taskFromHandle(handle);
+    if (task == nullptr)
+    {
+        return cxx::nullopt_t();
+    }
+    return cxx::make_optional<uint64_t>(task->overruns);
+}
+
+cxx::optional<TimingWheel::RuntimeStatistics> TimingWheel::getRuntimeStatistics(const TaskHandle& handle) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto* task = taskFromHandle(handle);
+    if (task == nullptr)
+    {
+        return cxx::nullopt_t();
+    }
+    return cxx::make_optional<RuntimeStatistics>(task->statistics);
+}
+
+TimingWheel::Task* TimingWheel::taskFromHandle(const TaskHandle& handle) noexcept
+{
+    if (handle.index >= MAX_NUMBER_OF_TASKS)
+    {
+        return nullptr;
+    }
+    auto& task = m_tasks[handle.index];
+    if (!task.inUse || task.generation != handle.generation)
+    {
+        return nullptr;
+    }
+    return &task;
+}
+
+uint64_t TimingWheel::nowTick() const noexcept
+{
+    return (monotonicTimeNs() - m_startTimeNs) / TICK_DURATION_NS;
+}
+
+void TimingWheel::link(const uint32_t taskIndex) noexcept
+{
+    auto& task = m_tasks[taskIndex];
+    if (task.deadlineTick <= m_currentTick)
+    {
+        task.deadlineTick = m_currentTick + 1u;
+    }
+
+    const uint64_t delta = task.deadlineTick - m_currentTick;
+    uint32_t level = 0u;
+    while (level < NUMBER_OF_LEVELS - 1u && delta >= (1ull << (BITS_PER_LEVEL * (level + 1u))))
+    {
+        ++level;
+    }
+
+    const uint32_t slot = static_cast<uint32_t>(task.deadlineTick >> (BITS_PER_LEVEL * level)) & (SLOTS_PER_LEVEL - 1u);
+    task.level = level;
+    task.slot = slot;
+    task.next = m_wheel[level][slot];
+    m_wheel[level][slot] = taskIndex;
+    task.linked = true;
+}
+
+void TimingWheel::unlink(const uint32_t taskIndex) noexcept
+{
+    auto& task = m_tasks[taskIndex];
+    uint32_t* current = &m_wheel[task.level][task.slot];
+    while (*current != INVALID_INDEX)
+    {
+        if (*current == taskIndex)
+        {
+            *current = task.next;
+            break;
+        }
+        current = &m_tasks[*current].next;
+    }
+    task.next = INVALID_INDEX;
+    task.linked = false;
+}
+
+void TimingWheel::cascade(const uint32_t level, const uint32_t slot) noexcept
+{
+    uint32_t taskIndex = m_wheel[level][slot];
+    m_wheel[level][slot] = INVALID_INDEX;
+
+    while (taskIndex != INVALID_INDEX)
+    {
+        auto& task = m_tasks[taskIndex];
+        const uint32_t next = task.next;
+        task.next = INVALID_INDEX;
+        task.linked = false;
+        if (task.inUse && task.armed)
+        {
+            link(taskIndex);
+        }
+        taskIndex = next;
+    }
+}
+
+void TimingWheel::advanceTo(const uint64_t targetTick,
+                            uint32_t (&dueTasks)[MAX_NUMBER_OF_TASKS],
+                            uint32_t& dueCount) noexcept
+{
+    while (m_currentTick < targetTick)
+    {
+        ++m_currentTick;
+
+        const uint32_t slot = static_cast<uint32_t>(m_currentTick) & (SLOTS_PER_LEVEL - 1u);
+        if (slot == 0u)
+        {
+            // a lower level wrapped around, move the tasks of the next higher
+            // level slot down into the finer grained levels
+            for (uint32_t level = 1u; level < NUMBER_OF_LEVELS; ++level)
+            {
+                const uint32_t levelSlot =
+                    static_cast<uint32_t>(m_currentTick >> (BITS_PER_LEVEL * level)) & (SLOTS_PER_LEVEL - 1u);
+                cascade(level, levelSlot);
+                if (levelSlot != 0u)
+                {
+                    break;
+                }
+            }
+        }
+
+        uint32_t taskIndex = m_wheel[0u][slot];
+        m_wheel[0u][slot] = INVALID_INDEX;
+        while (taskIndex != INVALID_INDEX)
+        {
+            auto& task = m_tasks[taskIndex];
+            const uint32_t next = task.next;
+            task.next = INVALID_INDEX;
+            task.linked = false;
+
+            if (task.inUse && task.armed && task.deadlineTick == m_currentTick)
+            {
+                if (task.periodic)
+                {
+                    // expirations which the dispatcher could not deliver in
+                    // time are counted as overruns, the next deadline stays
+                    // on the period grid
+                    const uint64_t missed = (targetTick - task.deadlineTick) / task.periodTicks;
+                    task.overruns += missed;
+                    task.deadlineTick += (missed + 1u) * task.periodTicks;
+                    link(taskIndex);
+                }
+                else
+                {
+                    task.armed = false;
+                }
+
+                if (dueCount < MAX_NUMBER_OF_TASKS)
+                {
+                    dueTasks[dueCount] = taskIndex;
+                    ++dueCount;
+                }
+            }
+            else if (task.inUse && task.armed)
+            {
+                link(taskIndex);
+            }
+            taskIndex = next;
+        }
+    }
+}
+
+uint64_t TimingWheel::nextDeadline() const noexcept
+{
+    uint64_t deadline = NO_DEADLINE;
+    for (const auto& task : m_tasks)
+    {
+        if (task.inUse && task.armed && task.linked && task.deadlineTick < deadline)
+        {
+            deadline = task.deadlineTick;
+        }
+    }
+    return deadline;
+}
+
+void TimingWheel::armWakeup(const uint64_t tick) noexcept
+{
+#if defined(__linux__)
+    struct itimerspec wakeupTime {};
+    if (tick != NO_DEADLINE)
+    {
+        const uint64_t absoluteNs = m_startTimeNs + tick * TICK_DURATION_NS;
+        wakeupTime.it_value.tv_sec = static_cast<time_t>(absoluteNs / 1000000000u);
+        wakeupTime.it_value.tv_nsec = static_cast<long>(absoluteNs % 1000000000u);
+    }
+    // an all zero it_value disarms the timerfd, the dispatcher then sleeps
+    // until the next startTask rearms it
+    timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME, &wakeupTime, nullptr);
+#else
+    m_wakeupTick = tick;
+    m_wakeup.notify_one();
+#endif
+}
+
+void TimingWheel::dispatcherLoop() noexcept
+{
+    while (m_keepRunning.load(std::memory_order_relaxed))
+    {
+#if defined(__linux__)
+        uint64_t expirations{0u};
+        const auto readResult = read(m_timerFd, &expirations, sizeof(expirations));
+        if (readResult == -1)
+        {
+            continue;
+        }
+#else
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            const uint64_t wakeupTick = m_wakeupTick;
+            const uint64_t now = nowTick();
+            if (wakeupTick == NO_DEADLINE)
+            {
+                m_wakeup.wait_for(lock, std::chrono::milliseconds(100u));
+            }
+            else if (wakeupTick > now)
+            {
+                m_wakeup.wait_for(lock, std::chrono::nanoseconds((wakeupTick - now) * TICK_DURATION_NS));
+            }
+        }
+#endif
+        if (!m_keepRunning.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        uint32_t dueTasks[MAX_NUMBER_OF_TASKS];
+        uint32_t dueCount{0u};
+        uint32_t enqueuedCount{0u};
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            advanceTo(nowTick(), dueTasks, dueCount);
+
+            // due tasks are only handed over to the executor; the dispatcher
+            // itself never runs a callback, a slow consumer therefore cannot
+            // delay the expiry detection of the other timers
+            const uint32_t countBefore = m_runQueueCount;
+            for (uint32_t i = 0u; i < dueCount; ++i)
+            {
+                enqueueDueTask(dueTasks[i]);
+            }
+            enqueuedCount = m_runQueueCount - countBefore;
+            armWakeup(nextDeadline());
+        }
+        for (uint32_t i = 0u; i < enqueuedCount; ++i)
+        {
+            m_runQueuePending.post();
+        }
+    }
+}
+
+void TimingWheel::enqueueDueTask(const uint32_t taskIndex) noexcept
+{
+    auto& task = m_tasks[taskIndex];
+    if (task.queued || task.executing)
+    {
+        // the previous expiry of this task is not processed yet, the new one
+        // is coalesced into it and accounted as overrun of this task alone
+        ++task.overruns;
+        return;
+    }
+
+    auto& entry = m_runQueue[(m_runQueueHead + m_runQueueCount) % MAX_NUMBER_OF_TASKS];
+    entry.index = taskIndex;
+    entry.generation = task.generation;
+    ++m_runQueueCount;
+    task.queued = true;
+}
+
+void TimingWheel::executorLoop() noexcept
+{
+    while (m_keepRunning.load(std::memory_order_relaxed))
+    {
+        m_runQueuePending.wait();
+        if (!m_keepRunning.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_runQueueCount == 0u)
+        {
+            continue;
+        }
+
+        const RunQueueEntry entry = m_runQueue[m_runQueueHead];
+        m_runQueueHead = (m_runQueueHead + 1u) % MAX_NUMBER_OF_TASKS;
+        --m_runQueueCount;
+
+        auto& task = m_tasks[entry.index];
+        if (!task.inUse || task.generation != entry.generation)
+        {
+            // the task was unregistered while its expiry waited in the queue
+            continue;
+        }
+        task.queued = false;
+        task.executing = true;
+
+        // the callback runs without the wheel lock so that it can start, stop
+        // or restart tasks itself
+        lock.unlock();
+        const uint64_t executionBegin = monotonicTimeNs();
+        task.callback();
+        const uint64_t runtime = monotonicTimeNs() - executionBegin;
+        lock.lock();
+
+        task.executing = false;
+        ++task.statistics.executionCount;
+        task.statistics.totalRuntimeNs += runtime;
+        if (runtime > task.statistics.maxRuntimeNs)
+        {
+            task.statistics.maxRuntimeNs = runtime;
+        }
+        m_executionFinished.notify_all();
+    }
+}
+
+} // namespace posix
+} // namespace iox
@@ -23,7 +23,7 @@ struct timespec Duration::timespec(const TimeSpecReference& reference) const
     switch (reference)
     {
     case TimeSpecReference::None:
-        return {this->seconds<long>(), this->nanoSeconds<long>() - this->seconds<long>() * 1000000000};
+        return this->timespec();
     default:
     {
         struct timespec referenceTime;
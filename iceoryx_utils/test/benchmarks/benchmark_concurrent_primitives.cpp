@@ -0,0 +1,398 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/// @brief Microbenchmarks for the concurrent primitives (SoFi, FiFo, LoFFLi,
+/// TriggerQueue). For each primitive the single-thread ops/s, the contended
+/// throughput across thread counts and the latency distribution of a single
+/// operation are measured. The benchmark is a standalone executable without
+/// any test framework so the numbers can be compared across platforms:
+///
+///     utils_benchmarks [operationsPerMeasurement]
+///
+/// Note: these are throughput numbers of the bare primitives, run them on an
+/// idle machine and pin the frequency governor before comparing results.
+
+#include "iceoryx_utils/internal/concurrent/fifo.hpp"
+#include "iceoryx_utils/internal/concurrent/loffli.hpp"
+#include "iceoryx_utils/internal/concurrent/sofi.hpp"
+#include "iceoryx_utils/internal/concurrent/trigger_queue.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t DEFAULT_NUMBER_OF_OPERATIONS{1000000u};
+constexpr uint64_t NUMBER_OF_LATENCY_SAMPLES{100000u};
+constexpr uint32_t QUEUE_CAPACITY{64u};
+
+uint64_t g_numberOfOperations{DEFAULT_NUMBER_OF_OPERATIONS};
+
+struct LatencyResult
+{
+    uint64_t p50{0u};
+    uint64_t p99{0u};
+    uint64_t p999{0u};
+    uint64_t max{0u};
+};
+
+struct ContendedResult
+{
+    uint32_t threads{0u};
+    double opsPerSecond{0.};
+};
+
+struct BenchmarkResult
+{
+    std::string primitive;
+    double singleThreadOpsPerSecond{0.};
+    LatencyResult latency;
+    std::vector<ContendedResult> contended;
+};
+
+/// @brief runs f_operation f_count times and returns the achieved ops/s
+template <typename Operation>
+double measureOpsPerSecond(const uint64_t f_count, const Operation& f_operation)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0u; i < f_count; ++i)
+    {
+        f_operation();
+    }
+    auto finish = std::chrono::steady_clock::now();
+    auto elapsedSeconds = std::chrono::duration<double>(finish - start).count();
+    return static_cast<double>(f_count) / elapsedSeconds;
+}
+
+/// @brief times every single call of f_operation and returns the latency
+///         distribution; the per call clock reads make this measurement more
+///         intrusive than measureOpsPerSecond, therefore fewer samples are taken
+template <typename Operation>
+LatencyResult measureLatency(const Operation& f_operation)
+{
+    std::vector<uint64_t> samples;
+    samples.reserve(NUMBER_OF_LATENCY_SAMPLES);
+    for (uint64_t i = 0u; i < NUMBER_OF_LATENCY_SAMPLES; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        f_operation();
+        auto finish = std::chrono::steady_clock::now();
+        samples.push_back(
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count()));
+    }
+    std::sort(samples.begin(), samples.end());
+
+    LatencyResult result;
+    result.p50 = samples[samples.size() / 2u];
+    result.p99 = samples[(samples.size() * 99u) / 100u];
+    result.p999 = samples[(samples.size() * 999u) / 1000u];
+    result.max = samples.back();
+    return result;
+}
+
+/// @brief runs f_threadFunction(threadIndex) on f_numberOfThreads threads and
+///         returns the accumulated ops/s; every thread function has to perform
+///         g_numberOfOperations operations
+template <typename ThreadFunction>
+ContendedResult measureContended(const uint32_t f_numberOfThreads, const ThreadFunction& f_threadFunction)
+{
+    std::vector<std::thread> threads;
+    std::atomic<uint32_t> readyCount{0u};
+    std::atomic<bool> go{false};
+
+    for (uint32_t t = 0u; t < f_numberOfThreads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            readyCount++;
+            while (!go.load(std::memory_order_acquire))
+            {
+                // spin until all threads are started so that the contention is real
+            }
+            f_threadFunction(t);
+        });
+    }
+    while (readyCount.load() != f_numberOfThreads)
+    {
+        std::this_thread::yield();
+    }
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    auto finish = std::chrono::steady_clock::now();
+    auto elapsedSeconds = std::chrono::duration<double>(finish - start).count();
+
+    ContendedResult result;
+    result.threads = f_numberOfThreads;
+    result.opsPerSecond = static_cast<double>(g_numberOfOperations * f_numberOfThreads) / elapsedSeconds;
+    return result;
+}
+
+BenchmarkResult benchmarkSoFi()
+{
+    BenchmarkResult result;
+    result.primitive = "SoFi";
+
+    iox::concurrent::SoFi<uint64_t, QUEUE_CAPACITY> sofi;
+    uint64_t overflow{0u};
+    uint64_t value{0u};
+    result.singleThreadOpsPerSecond = measureOpsPerSecond(g_numberOfOperations, [&] {
+        sofi.push(42u, overflow);
+        sofi.pop(value);
+    });
+    result.latency = measureLatency([&] {
+        sofi.push(42u, overflow);
+        sofi.pop(value);
+    });
+
+    // SoFi is restricted thread safe: single pusher, single pop'er
+    result.contended.push_back(measureContended(2u, [&](const uint32_t f_threadIndex) {
+        if (f_threadIndex == 0u)
+        {
+            uint64_t overflowValue{0u};
+            for (uint64_t i = 0u; i < g_numberOfOperations; ++i)
+            {
+                sofi.push(i, overflowValue);
+            }
+        }
+        else
+        {
+            uint64_t popValue{0u};
+            for (uint64_t i = 0u; i < g_numberOfOperations; ++i)
+            {
+                sofi.pop(popValue);
+            }
+        }
+    }));
+    return result;
+}
+
+BenchmarkResult benchmarkFiFo()
+{
+    BenchmarkResult result;
+    result.primitive = "FiFo";
+
+    iox::concurrent::FiFo<uint64_t, QUEUE_CAPACITY> fifo;
+    result.singleThreadOpsPerSecond = measureOpsPerSecond(g_numberOfOperations, [&] {
+        fifo.push(42u);
+        fifo.pop();
+    });
+    result.latency = measureLatency([&] {
+        fifo.push(42u);
+        fifo.pop();
+    });
+
+    // FiFo is a single pusher single pop'er fifo
+    result.contended.push_back(measureContended(2u, [&](const uint32_t f_threadIndex) {
+        if (f_threadIndex == 0u)
+        {
+            for (uint64_t i = 0u; i < g_numberOfOperations; ++i)
+            {
+                fifo.push(i);
+            }
+        }
+        else
+        {
+            for (uint64_t i = 0u; i < g_numberOfOperations; ++i)
+            {
+                fifo.pop();
+            }
+        }
+    }));
+    return result;
+}
+
+BenchmarkResult benchmarkLoFFLi()
+{
+    BenchmarkResult result;
+    result.primitive = "LoFFLi";
+
+    constexpr uint32_t NumberOfIndices{1000u};
+    static uint32_t memory[iox::concurrent::LoFFLi::requiredMemorySize(NumberOfIndices) / sizeof(uint32_t) + 1u];
+    iox::concurrent::LoFFLi loffli;
+    loffli.init(memory, NumberOfIndices);
+
+    uint32_t index{0u};
+    result.singleThreadOpsPerSecond = measureOpsPerSecond(g_numberOfOperations, [&] {
+        loffli.pop(index);
+        loffli.push(index);
+    });
+    result.latency = measureLatency([&] {
+        loffli.pop(index);
+        loffli.push(index);
+    });
+
+    // LoFFLi is fully thread safe, scale the contention over the thread count
+    for (const uint32_t numberOfThreads : {2u, 4u, 8u})
+    {
+        result.contended.push_back(measureContended(numberOfThreads, [&](const uint32_t) {
+            uint32_t threadIndex{0u};
+            for (uint64_t i = 0u; i < g_numberOfOperations; ++i)
+            {
+                if (loffli.pop(threadIndex))
+                {
+                    loffli.push(threadIndex);
+                }
+            }
+        }));
+    }
+    return result;
+}
+
+BenchmarkResult benchmarkTriggerQueue()
+{
+    BenchmarkResult result;
+    result.primitive = "TriggerQueue";
+
+    auto queue = iox::concurrent::TriggerQueue<uint64_t, QUEUE_CAPACITY>::CreateTriggerQueue();
+    if (!queue.has_value())
+    {
+        std::cerr << "unable to create the trigger queue, skipping" << std::endl;
+        return result;
+    }
+
+    uint64_t value{0u};
+    result.singleThreadOpsPerSecond = measureOpsPerSecond(g_numberOfOperations, [&] {
+        queue->push(42u);
+        queue->try_pop(value);
+    });
+    result.latency = measureLatency([&] {
+        queue->push(42u);
+        queue->try_pop(value);
+    });
+
+    // one pusher which saturates the queue and one blocking pop'er
+    std::atomic<bool> pusherDone{false};
+    result.contended.push_back(measureContended(2u, [&](const uint32_t f_threadIndex) {
+        if (f_threadIndex == 0u)
+        {
+            for (uint64_t i = 0u; i < g_numberOfOperations; ++i)
+            {
+                while (!queue->push(i))
+                {
+                    // queue full, the pop'er will catch up
+                }
+            }
+            pusherDone.store(true);
+            // wake the pop'er up in case it blocks on an empty queue
+            queue->send_wakeup_trigger();
+        }
+        else
+        {
+            uint64_t popValue{0u};
+            uint64_t numberOfPops{0u};
+            while (numberOfPops < g_numberOfOperations)
+            {
+                if (queue->blocking_pop(popValue))
+                {
+                    ++numberOfPops;
+                }
+                else if (pusherDone.load())
+                {
+                    // drain what is left; a false return while the pusher is
+                    // still active is just a surplus wakeup
+                    while (queue->try_pop(popValue))
+                    {
+                        ++numberOfPops;
+                    }
+                    break;
+                }
+            }
+        }
+    }));
+    return result;
+}
+
+void printResult(const BenchmarkResult& f_result)
+{
+    std::cout << "| " << std::setw(12) << f_result.primitive << " | " << std::setw(12) << std::fixed
+              << std::setprecision(0) << f_result.singleThreadOpsPerSecond << " | " << std::setw(8)
+              << f_result.latency.p50 << " | " << std::setw(8) << f_result.latency.p99 << " | " << std::setw(10)
+              << f_result.latency.p999 << " | " << std::setw(8) << f_result.latency.max << " |";
+    for (const auto& contended : f_result.contended)
+    {
+        std::cout << " " << contended.threads << " threads: " << std::setprecision(0) << contended.opsPerSecond
+                  << " ops/s;";
+    }
+    std::cout << std::endl;
+}
+
+void printJson(const std::vector<BenchmarkResult>& f_results)
+{
+    std::cout << "{\"benchmark\":\"utils_concurrent\",\"operations\":" << g_numberOfOperations << ",\"results\":[";
+    for (size_t i = 0u; i < f_results.size(); ++i)
+    {
+        const auto& result = f_results[i];
+        std::cout << (i == 0u ? "" : ",") << "{\"primitive\":\"" << result.primitive
+                  << "\",\"single_thread_ops_per_s\":" << std::fixed << std::setprecision(0)
+                  << result.singleThreadOpsPerSecond << ",\"latency_ns\":{\"p50\":" << result.latency.p50
+                  << ",\"p99\":" << result.latency.p99 << ",\"p999\":" << result.latency.p999
+                  << ",\"max\":" << result.latency.max << "},\"contended\":[";
+        for (size_t c = 0u; c < result.contended.size(); ++c)
+        {
+            std::cout << (c == 0u ? "" : ",") << "{\"threads\":" << result.contended[c].threads
+                      << ",\"ops_per_s\":" << std::setprecision(0) << result.contended[c].opsPerSecond << "}";
+        }
+        std::cout << "]}";
+    }
+    std::cout << "]}" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1)
+    {
+        auto operations = std::atoll(argv[1]);
+        if (operations <= 0)
+        {
+            std::cerr << "usage: " << argv[0] << " [operationsPerMeasurement]" << std::endl;
+            return EXIT_FAILURE;
+        }
+        g_numberOfOperations = static_cast<uint64_t>(operations);
+    }
+
+    std::cout << "#### Concurrent Primitives Benchmark ####" << std::endl;
+    std::cout << g_numberOfOperations << " operations per measurement, " << NUMBER_OF_LATENCY_SAMPLES
+              << " latency samples (one operation = one push/pop pair)" << std::endl;
+    std::cout << std::endl;
+    std::cout << "|    Primitive | 1-thread o/s | p50 [ns] | p99 [ns] | p99.9 [ns] | max [ns] | contended" << std::endl;
+
+    std::vector<BenchmarkResult> results;
+    results.push_back(benchmarkSoFi());
+    printResult(results.back());
+    results.push_back(benchmarkFiFo());
+    printResult(results.back());
+    results.push_back(benchmarkLoFFLi());
+    printResult(results.back());
+    results.push_back(benchmarkTriggerQueue());
+    printResult(results.back());
+
+    std::cout << std::endl;
+    std::cout << "#### JSON ####" << std::endl;
+    printJson(results);
+
+    return EXIT_SUCCESS;
+}
@@ -255,3 +255,17 @@ TEST_F(AccessController_test, addStrangeNames)
     // non-existing group name specified
     EXPECT_FALSE(entryAdded);
 }
+
+TEST_F(AccessController_test, writeStandardPermissionsSetsModeBits)
+{
+    m_accessController.addPermissionEntry(AccessController::Category::USER, AccessController::Permission::READWRITE);
+    m_accessController.addPermissionEntry(AccessController::Category::GROUP, AccessController::Permission::READ);
+    m_accessController.addPermissionEntry(AccessController::Category::OTHERS, AccessController::Permission::NONE);
+
+    // a complete standard set takes the fchmod fast path without any ACL
+    EXPECT_TRUE(m_accessController.writePermissionsToFile(m_fileDescriptor));
+
+    struct stat fileStatus;
+    ASSERT_EQ(0, fstat(m_fileDescriptor, &fileStatus));
+    EXPECT_EQ(static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP), fileStatus.st_mode & static_cast<mode_t>(0777));
+}
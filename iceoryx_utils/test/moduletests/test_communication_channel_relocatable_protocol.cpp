@@ -0,0 +1,121 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/communication_channel/bidirectional_communication_channel.hpp"
+#include "iceoryx_utils/communication_channel/protocol/relocatable_protocol.hpp"
+
+#include <gmock/gmock.h>
+
+using namespace testing;
+using namespace iox;
+using namespace iox::units;
+
+// a payload too large to travel by value through a fifo
+struct LargePayload
+{
+    uint64_t m_sequenceNumber{0u};
+    char m_blob[4096];
+};
+
+template <typename DataType>
+using RelocatableTestProtocol = RelocatableProtocol<DataType, 10>;
+
+class CommunicationChannelRelocatableProtocol_Test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        // the payloads have to reside in a memory segment known to the
+        // RelativePointer repository, in deployment this is the managed shared
+        // memory of the segments
+        m_segmentId = RelativePointer::registerPtr(m_payloads, sizeof(m_payloads));
+    }
+
+    void TearDown() override
+    {
+        RelativePointer::unregisterPtr(m_segmentId);
+    }
+
+    LargePayload m_payloads[8];
+    RelativePointer::id_t m_segmentId{RelativePointer::NULL_POINTER_ID};
+    RelocatableTestProtocol<LargePayload*> sut;
+};
+
+TEST_F(CommunicationChannelRelocatableProtocol_Test, SendAndTryReceive)
+{
+    m_payloads[0].m_sequenceNumber = 313u;
+    ASSERT_THAT(sut.Send(&m_payloads[0]), Eq(true));
+
+    auto result = sut.TryReceive();
+    ASSERT_THAT(result.has_value(), Eq(true));
+    EXPECT_THAT((*result)->m_sequenceNumber, Eq(313u));
+}
+
+TEST_F(CommunicationChannelRelocatableProtocol_Test, ReceivedPayloadIsNotACopy)
+{
+    ASSERT_THAT(sut.Send(&m_payloads[3]), Eq(true));
+
+    auto result = sut.TryReceive();
+    ASSERT_THAT(result.has_value(), Eq(true));
+    EXPECT_THAT(*result, Eq(&m_payloads[3]));
+}
+
+TEST_F(CommunicationChannelRelocatableProtocol_Test, TryReceiveWithoutSend)
+{
+    auto result = sut.TryReceive();
+    EXPECT_THAT(result.has_value(), Eq(false));
+}
+
+TEST_F(CommunicationChannelRelocatableProtocol_Test, TimedReceiveWithoutSendRunsIntoTimeout)
+{
+    auto result = sut.timedReceive(1_ms);
+    EXPECT_THAT(result.has_value(), Eq(false));
+}
+
+TEST_F(CommunicationChannelRelocatableProtocol_Test, SendTillFifoIsFull)
+{
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_THAT(sut.Send(&m_payloads[0]), Eq(true));
+    }
+    EXPECT_THAT(sut.Send(&m_payloads[0]), Eq(false));
+}
+
+TEST_F(CommunicationChannelRelocatableProtocol_Test, MessagesKeepTheirOrder)
+{
+    ASSERT_THAT(sut.Send(&m_payloads[1]), Eq(true));
+    ASSERT_THAT(sut.Send(&m_payloads[2]), Eq(true));
+
+    auto first = sut.TryReceive();
+    auto second = sut.TryReceive();
+    ASSERT_THAT(first.has_value(), Eq(true));
+    ASSERT_THAT(second.has_value(), Eq(true));
+    EXPECT_THAT(*first, Eq(&m_payloads[1]));
+    EXPECT_THAT(*second, Eq(&m_payloads[2]));
+}
+
+TEST_F(CommunicationChannelRelocatableProtocol_Test, WorksThroughBidirectionalChannel)
+{
+    BidirectionalCommunicationChannel<LargePayload*, RelocatableTestProtocol> channel;
+    auto transceiverA2B = channel.getFirstTransceiver();
+    auto transceiverB2A = channel.getSecondTransceiver();
+
+    m_payloads[5].m_sequenceNumber = 42u;
+    ASSERT_THAT(transceiverA2B->Send(&m_payloads[5]), Eq(true));
+
+    auto result = transceiverB2A->timedReceive(1_ms);
+    ASSERT_THAT(result.has_value(), Eq(true));
+    EXPECT_THAT(*result, Eq(&m_payloads[5]));
+    EXPECT_THAT((*result)->m_sequenceNumber, Eq(42u));
+}
@@ -0,0 +1,116 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test.hpp"
+#include "iceoryx_utils/internal/concurrent/epoch_reclamation.hpp"
+
+using namespace testing;
+using namespace iox::concurrent;
+
+constexpr uint32_t MAX_PARTICIPANTS = 4u;
+
+class EpochReclamation_test : public Test
+{
+  public:
+    void SetUp()
+    {
+    }
+
+    void TearDown()
+    {
+    }
+
+    EpochReclamation<MAX_PARTICIPANTS> sut;
+};
+
+TEST_F(EpochReclamation_test, RegisterUpToMaxParticipants)
+{
+    for (uint32_t i = 0u; i < MAX_PARTICIPANTS; ++i)
+    {
+        auto participant = sut.registerParticipant();
+        ASSERT_THAT(participant.has_value(), Eq(true));
+        EXPECT_THAT(participant.value(), Eq(i));
+    }
+    EXPECT_THAT(sut.registerParticipant().has_value(), Eq(false));
+}
+
+TEST_F(EpochReclamation_test, UnregisterFreesTheSlot)
+{
+    auto participant = sut.registerParticipant();
+    ASSERT_THAT(participant.has_value(), Eq(true));
+
+    sut.unregisterParticipant(participant.value());
+    auto again = sut.registerParticipant();
+    ASSERT_THAT(again.has_value(), Eq(true));
+    EXPECT_THAT(again.value(), Eq(participant.value()));
+}
+
+TEST_F(EpochReclamation_test, SafeToReclaimWithoutReaders)
+{
+    auto epoch = sut.retire();
+    EXPECT_THAT(sut.isSafeToReclaim(epoch), Eq(true));
+}
+
+TEST_F(EpochReclamation_test, ReaderInsideCriticalSectionBlocksReclamation)
+{
+    auto participant = sut.registerParticipant().value();
+
+    sut.enterCriticalSection(participant);
+    auto epoch = sut.retire();
+    EXPECT_THAT(sut.isSafeToReclaim(epoch), Eq(false));
+
+    sut.leaveCriticalSection(participant);
+    EXPECT_THAT(sut.isSafeToReclaim(epoch), Eq(true));
+}
+
+TEST_F(EpochReclamation_test, ReaderEnteringAfterRetirementDoesNotBlockReclamation)
+{
+    auto participant = sut.registerParticipant().value();
+
+    auto epoch = sut.retire();
+    sut.enterCriticalSection(participant);
+    EXPECT_THAT(sut.isSafeToReclaim(epoch), Eq(true));
+    sut.leaveCriticalSection(participant);
+}
+
+TEST_F(EpochReclamation_test, ForceUnregisterUnblocksReclamation)
+{
+    auto participant = sut.registerParticipant().value();
+
+    sut.enterCriticalSection(participant);
+    auto epoch = sut.retire();
+    EXPECT_THAT(sut.isSafeToReclaim(epoch), Eq(false));
+
+    // monitor cleanup path for a died process
+    sut.unregisterParticipant(participant);
+    EXPECT_THAT(sut.isSafeToReclaim(epoch), Eq(true));
+}
+
+TEST_F(EpochReclamation_test, MultipleRetirementsHaveIndependentGracePeriods)
+{
+    auto participant = sut.registerParticipant().value();
+
+    sut.enterCriticalSection(participant);
+    auto firstEpoch = sut.retire();
+    sut.leaveCriticalSection(participant);
+
+    sut.enterCriticalSection(participant);
+    auto secondEpoch = sut.retire();
+
+    EXPECT_THAT(sut.isSafeToReclaim(firstEpoch), Eq(true));
+    EXPECT_THAT(sut.isSafeToReclaim(secondEpoch), Eq(false));
+
+    sut.leaveCriticalSection(participant);
+    EXPECT_THAT(sut.isSafeToReclaim(secondEpoch), Eq(true));
+}
@@ -106,3 +106,100 @@ TEST_F(FiFo_Test, OverflowFromFullToEmptyRepetition)
         EXPECT_THAT(sut.empty(), Eq(true));
     }
 }
+
+TEST_F(FiFo_Test, SizeTracksPushAndPop)
+{
+    EXPECT_THAT(sut.size(), Eq(0u));
+    EXPECT_THAT(sut.push(1), Eq(true));
+    EXPECT_THAT(sut.push(2), Eq(true));
+    EXPECT_THAT(sut.size(), Eq(2u));
+    EXPECT_THAT(sut.pop().has_value(), Eq(true));
+    EXPECT_THAT(sut.size(), Eq(1u));
+}
+
+TEST_F(FiFo_Test, PopBatchDrainsInOrder)
+{
+    for (size_t k = 0; k < FIFO_CAPACITY; ++k)
+    {
+        EXPECT_THAT(sut.push(k), Eq(true));
+    }
+
+    int values[FIFO_CAPACITY];
+    EXPECT_THAT(sut.popBatch(values, FIFO_CAPACITY), Eq(FIFO_CAPACITY));
+    for (size_t k = 0; k < FIFO_CAPACITY; ++k)
+    {
+        EXPECT_THAT(values[k], Eq(static_cast<int>(k)));
+    }
+    EXPECT_THAT(sut.empty(), Eq(true));
+}
+
+TEST_F(FiFo_Test, PopBatchIsBoundedByContent)
+{
+    int values[FIFO_CAPACITY];
+    EXPECT_THAT(sut.popBatch(values, FIFO_CAPACITY), Eq(0u));
+
+    EXPECT_THAT(sut.push(13), Eq(true));
+    EXPECT_THAT(sut.push(37), Eq(true));
+    EXPECT_THAT(sut.popBatch(values, FIFO_CAPACITY), Eq(2u));
+    EXPECT_THAT(values[0], Eq(13));
+    EXPECT_THAT(values[1], Eq(37));
+
+    // a partial batch leaves the remaining values untouched
+    EXPECT_THAT(sut.push(42), Eq(true));
+    EXPECT_THAT(sut.push(73), Eq(true));
+    EXPECT_THAT(sut.popBatch(values, 1), Eq(1u));
+    EXPECT_THAT(values[0], Eq(42));
+    auto result = sut.pop();
+    ASSERT_THAT(result.has_value(), Eq(true));
+    EXPECT_THAT(result.value(), Eq(73));
+}
+
+TEST_F(FiFo_Test, PushBatchFillsInOrder)
+{
+    int values[FIFO_CAPACITY];
+    for (size_t k = 0; k < FIFO_CAPACITY; ++k)
+    {
+        values[k] = static_cast<int>(k);
+    }
+
+    EXPECT_THAT(sut.pushBatch(values, FIFO_CAPACITY), Eq(FIFO_CAPACITY));
+    for (size_t k = 0; k < FIFO_CAPACITY; ++k)
+    {
+        auto result = sut.pop();
+        ASSERT_THAT(result.has_value(), Eq(true));
+        EXPECT_THAT(result.value(), Eq(static_cast<int>(k)));
+    }
+}
+
+TEST_F(FiFo_Test, PushBatchIsBoundedByFreeSpace)
+{
+    int values[FIFO_CAPACITY] = {0};
+    EXPECT_THAT(sut.push(99), Eq(true));
+
+    // only FIFO_CAPACITY - 1 slots are left, the rest of the batch is rejected
+    EXPECT_THAT(sut.pushBatch(values, FIFO_CAPACITY), Eq(FIFO_CAPACITY - 1));
+    EXPECT_THAT(sut.pushBatch(values, 1), Eq(0u));
+
+    auto result = sut.pop();
+    ASSERT_THAT(result.has_value(), Eq(true));
+    EXPECT_THAT(result.value(), Eq(99));
+}
+
+TEST_F(FiFo_Test, CacheLinePaddedVariantBehavesLikeFifo)
+{
+    FiFo<int, FIFO_CAPACITY, FiFoPadding::CACHE_LINE> paddedSut;
+
+    for (size_t k = 0; k < FIFO_CAPACITY; ++k)
+    {
+        EXPECT_THAT(paddedSut.push(k), Eq(true));
+    }
+    EXPECT_THAT(paddedSut.push(123), Eq(false));
+
+    for (size_t k = 0; k < FIFO_CAPACITY; ++k)
+    {
+        auto result = paddedSut.pop();
+        ASSERT_THAT(result.has_value(), Eq(true));
+        EXPECT_THAT(result.value(), Eq(static_cast<int>(k)));
+    }
+    EXPECT_THAT(paddedSut.empty(), Eq(true));
+}
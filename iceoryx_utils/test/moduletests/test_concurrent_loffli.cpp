@@ -162,6 +162,103 @@ TYPED_TEST(LoFFLi_test, PushRandomOrder)
     EXPECT_THAT(useListPoped, Eq(useListToPush));
 }
 
+TYPED_TEST(LoFFLi_test, InitWithCapacityReservesIndices)
+{
+    constexpr uint32_t Capacity{Size + 2};
+    uint32_t memoryLoFFLi[decltype(this->m_loffli)::requiredMemorySize(Capacity)];
+    decltype(this->m_loffli) loFFLi;
+    loFFLi.init(memoryLoFFLi, Size, Capacity);
+
+    uint32_t index;
+    for (uint32_t i = 0; i < Size; i++)
+    {
+        EXPECT_THAT(loFFLi.pop(index), Eq(true));
+    }
+    EXPECT_THAT(loFFLi.pop(index), Eq(false));
+
+    // the reserved indices can be handed over via push and popped afterwards
+    EXPECT_THAT(loFFLi.push(Size), Eq(true));
+    EXPECT_THAT(loFFLi.push(Size + 1), Eq(true));
+    EXPECT_THAT(loFFLi.pop(index), Eq(true));
+    EXPECT_THAT(loFFLi.pop(index), Eq(true));
+    EXPECT_THAT(loFFLi.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PopBatchAll)
+{
+    uint32_t indices[Size + 1];
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size + 1), Eq(Size));
+
+    std::vector<uint32_t> popped(indices, indices + Size);
+    std::sort(popped.begin(), popped.end());
+    for (uint32_t i = 0; i < Size; i++)
+    {
+        EXPECT_THAT(popped[i], Eq(i));
+    }
+
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PopBatchPartial)
+{
+    uint32_t indices[2];
+    EXPECT_THAT(this->m_loffli.popBatch(indices, 2), Eq(2u));
+
+    uint32_t index;
+    for (uint32_t i = 0; i < Size - 2; i++)
+    {
+        EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    }
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PopBatchEmpty)
+{
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size), Eq(Size));
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size), Eq(0u));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchPreviouslyPopped)
+{
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.popBatch(indices, Size), Eq(Size));
+    EXPECT_THAT(this->m_loffli.pushBatch(indices, Size), Eq(true));
+
+    std::vector<uint32_t> popped;
+    uint32_t index;
+    while (this->m_loffli.pop(index))
+    {
+        popped.push_back(index);
+    }
+
+    std::sort(popped.begin(), popped.end());
+    for (uint32_t i = 0; i < Size; i++)
+    {
+        EXPECT_THAT(popped[i], Eq(i));
+    }
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchWrongIndices)
+{
+    uint32_t indices[2];
+    EXPECT_THAT(this->m_loffli.popBatch(indices, 2), Eq(2u));
+
+    uint32_t wrongIndices[2] = {indices[0], Size + 42};
+    EXPECT_THAT(this->m_loffli.pushBatch(wrongIndices, 2), Eq(false));
+
+    // the valid part of the rejected batch must still be pushable
+    EXPECT_THAT(this->m_loffli.push(indices[0]), Eq(true));
+    EXPECT_THAT(this->m_loffli.push(indices[1]), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchWhenFull)
+{
+    uint32_t indices[1] = {0};
+    EXPECT_THAT(this->m_loffli.pushBatch(indices, 1), Eq(false));
+}
+
 TYPED_TEST(LoFFLi_test, PushWrongIndex)
 {
     uint32_t index;
@@ -191,3 +288,23 @@ TYPED_TEST(LoFFLi_test, PushToUninitializedLoFFLi)
     decltype(this->m_loffli) loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+// the retry counters only exist in the lock-free variant, hence no typed test
+TEST(LoFFLiRetries_test, RetryCountersStayZeroWithoutContention)
+{
+    uint32_t memoryLoFFLi[iox::concurrent::LoFFLi::requiredMemorySize(Size)];
+    iox::concurrent::LoFFLi loFFLi;
+    loFFLi.init(memoryLoFFLi, Size);
+
+    uint32_t index;
+    EXPECT_THAT(loFFLi.pop(index), Eq(true));
+    EXPECT_THAT(loFFLi.push(index), Eq(true));
+
+    uint32_t indices[Size];
+    EXPECT_THAT(loFFLi.popBatch(indices, Size), Eq(Size));
+    EXPECT_THAT(loFFLi.pushBatch(indices, Size), Eq(true));
+
+    // single-threaded use never retries a CAS, the counters must not move
+    EXPECT_THAT(loFFLi.getPopRetries(), Eq(0u));
+    EXPECT_THAT(loFFLi.getPushRetries(), Eq(0u));
+}
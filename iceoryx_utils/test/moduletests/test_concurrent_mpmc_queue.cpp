@@ -0,0 +1,190 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/internal/concurrent/mpmc_queue.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+using namespace iox::concurrent;
+
+constexpr size_t MPMC_QUEUE_CAPACITY = 10;
+
+class MpmcQueue_Test : public Test
+{
+  public:
+    void SetUp()
+    {
+    }
+
+    void TearDown()
+    {
+    }
+
+    MpmcQueue<uint64_t, MPMC_QUEUE_CAPACITY> sut;
+};
+
+TEST_F(MpmcQueue_Test, SinglePopSinglePush)
+{
+    EXPECT_THAT(sut.push(25), Eq(true));
+    auto result = sut.pop();
+    EXPECT_THAT(result.has_value(), Eq(true));
+    EXPECT_THAT(result.value(), Eq(25u));
+}
+
+TEST_F(MpmcQueue_Test, PopFailsWhenEmpty)
+{
+    auto result = sut.pop();
+    EXPECT_THAT(result.has_value(), Eq(false));
+}
+
+TEST_F(MpmcQueue_Test, PushFailsWhenFull)
+{
+    for (size_t k = 0; k < MPMC_QUEUE_CAPACITY; ++k)
+    {
+        EXPECT_THAT(sut.push(k), Eq(true));
+    }
+    EXPECT_THAT(sut.push(123), Eq(false));
+}
+
+TEST_F(MpmcQueue_Test, IsEmptyWhenPopReturnsNullopt)
+{
+    for (size_t k = 0; k < MPMC_QUEUE_CAPACITY; ++k)
+    {
+        EXPECT_THAT(sut.push(k), Eq(true));
+    }
+    for (size_t k = 0; k < MPMC_QUEUE_CAPACITY; ++k)
+    {
+        EXPECT_THAT(sut.pop().has_value(), Eq(true));
+    }
+
+    EXPECT_THAT(sut.pop().has_value(), Eq(false));
+    EXPECT_THAT(sut.empty(), Eq(true));
+}
+
+TEST_F(MpmcQueue_Test, SingleThreadedOrderIsFifo)
+{
+    for (size_t k = 0; k < 100 * MPMC_QUEUE_CAPACITY; ++k)
+    {
+        EXPECT_THAT(sut.push(k), Eq(true));
+        auto result = sut.pop();
+        ASSERT_THAT(result.has_value(), Eq(true));
+        EXPECT_THAT(result.value(), Eq(k));
+    }
+}
+
+TEST_F(MpmcQueue_Test, MultiProducerMultiConsumerTransfersAllValues)
+{
+    constexpr uint64_t PRODUCERS = 4;
+    constexpr uint64_t CONSUMERS = 4;
+    constexpr uint64_t VALUES_PER_PRODUCER = 10000;
+
+    std::atomic<uint64_t> numberOfConsumedValues{0};
+    std::vector<std::set<uint64_t>> consumedValues(CONSUMERS);
+
+    std::vector<std::thread> consumers;
+    for (uint64_t consumerId = 0; consumerId < CONSUMERS; ++consumerId)
+    {
+        consumers.emplace_back([&, consumerId] {
+            while (numberOfConsumedValues.load() < PRODUCERS * VALUES_PER_PRODUCER)
+            {
+                auto result = sut.pop();
+                if (result.has_value())
+                {
+                    consumedValues[consumerId].insert(result.value());
+                    numberOfConsumedValues.fetch_add(1);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for (uint64_t producerId = 0; producerId < PRODUCERS; ++producerId)
+    {
+        producers.emplace_back([&, producerId] {
+            for (uint64_t k = 0; k < VALUES_PER_PRODUCER; ++k)
+            {
+                while (!sut.push(producerId * VALUES_PER_PRODUCER + k))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    for (auto& consumer : consumers)
+    {
+        consumer.join();
+    }
+
+    // every value has to arrive exactly once
+    std::set<uint64_t> allConsumedValues;
+    for (auto& values : consumedValues)
+    {
+        allConsumedValues.insert(values.begin(), values.end());
+    }
+    EXPECT_THAT(allConsumedValues.size(), Eq(PRODUCERS * VALUES_PER_PRODUCER));
+    EXPECT_THAT(sut.empty(), Eq(true));
+}
+
+TEST_F(MpmcQueue_Test, SingleProducerOrderIsKeptWithConcurrentConsumer)
+{
+    constexpr uint64_t VALUES = 10000;
+
+    std::thread consumer([&] {
+        uint64_t lastValue = 0;
+        uint64_t consumed = 0;
+        while (consumed < VALUES)
+        {
+            auto result = sut.pop();
+            if (result.has_value())
+            {
+                if (consumed > 0)
+                {
+                    EXPECT_THAT(result.value(), Gt(lastValue));
+                }
+                lastValue = result.value();
+                ++consumed;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (uint64_t k = 1; k <= VALUES; ++k)
+    {
+        while (!sut.push(k))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+}
@@ -0,0 +1,238 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test.hpp"
+
+#include "iceoryx_utils/internal/objectpool/concurrent_objectpool.hpp"
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+
+namespace
+{
+class Counted
+{
+  public:
+    Counted()
+    {
+        ++constructionCounter;
+    }
+
+    Counted(int f_value)
+        : m_value(f_value)
+    {
+        ++constructionCounter;
+    }
+
+    ~Counted()
+    {
+        ++destructionCounter;
+    }
+
+    int m_value{0};
+
+    static std::atomic<int> constructionCounter;
+    static std::atomic<int> destructionCounter;
+};
+
+std::atomic<int> Counted::constructionCounter{0};
+std::atomic<int> Counted::destructionCounter{0};
+} // namespace
+
+constexpr uint32_t CAPACITY = 16u;
+using CountedPool = iox::cxx::ConcurrentObjectPool<Counted, CAPACITY>;
+
+class ConcurrentObjectPool_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        Counted::constructionCounter = 0;
+        Counted::destructionCounter = 0;
+        m_pool = new CountedPool;
+    }
+
+    void TearDown() override
+    {
+        delete m_pool;
+    }
+
+    CountedPool* m_pool{nullptr};
+};
+
+TEST_F(ConcurrentObjectPool_test, createAndFree)
+{
+    auto object = m_pool->create(73);
+    ASSERT_THAT(object, Ne(nullptr));
+    EXPECT_THAT(object->m_value, Eq(73));
+    EXPECT_THAT(m_pool->size(), Eq(1u));
+
+    EXPECT_THAT(m_pool->free(object), Eq(true));
+    EXPECT_THAT(m_pool->size(), Eq(0u));
+    EXPECT_THAT(Counted::destructionCounter.load(), Eq(1));
+}
+
+TEST_F(ConcurrentObjectPool_test, exhaustedPoolReturnsNullptr)
+{
+    std::vector<Counted*> objects;
+    for (uint32_t i = 0u; i < CAPACITY; ++i)
+    {
+        auto object = m_pool->create();
+        ASSERT_THAT(object, Ne(nullptr));
+        objects.push_back(object);
+    }
+    EXPECT_THAT(m_pool->create(), Eq(nullptr));
+
+    EXPECT_THAT(m_pool->free(objects.back()), Eq(true));
+    EXPECT_THAT(m_pool->create(), Ne(nullptr));
+}
+
+TEST_F(ConcurrentObjectPool_test, allocateDoesNotConstruct)
+{
+    auto memory = m_pool->allocate();
+    ASSERT_THAT(memory, Ne(nullptr));
+    EXPECT_THAT(Counted::constructionCounter.load(), Eq(0));
+
+    EXPECT_THAT(m_pool->free(memory), Eq(true));
+    EXPECT_THAT(Counted::destructionCounter.load(), Eq(0));
+}
+
+TEST_F(ConcurrentObjectPool_test, freeForeignPointerFails)
+{
+    Counted foreign;
+    EXPECT_THAT(m_pool->free(&foreign), Eq(false));
+    EXPECT_THAT(m_pool->size(), Eq(0u));
+}
+
+TEST_F(ConcurrentObjectPool_test, doubleFreeFails)
+{
+    auto object = m_pool->create();
+    EXPECT_THAT(m_pool->free(object), Eq(true));
+    EXPECT_THAT(m_pool->free(object), Eq(false));
+    EXPECT_THAT(Counted::destructionCounter.load(), Eq(1));
+}
+
+TEST_F(ConcurrentObjectPool_test, batchCreateAndFree)
+{
+    Counted* objects[CAPACITY];
+    EXPECT_THAT(m_pool->createBatch(objects, CAPACITY), Eq(CAPACITY));
+    EXPECT_THAT(m_pool->size(), Eq(CAPACITY));
+    EXPECT_THAT(Counted::constructionCounter.load(), Eq(static_cast<int>(CAPACITY)));
+
+    // all returned objects are distinct cells
+    std::set<Counted*> distinct(objects, objects + CAPACITY);
+    EXPECT_THAT(distinct.size(), Eq(static_cast<size_t>(CAPACITY)));
+
+    EXPECT_THAT(m_pool->freeBatch(objects, CAPACITY), Eq(true));
+    EXPECT_THAT(m_pool->size(), Eq(0u));
+    EXPECT_THAT(Counted::destructionCounter.load(), Eq(static_cast<int>(CAPACITY)));
+}
+
+TEST_F(ConcurrentObjectPool_test, batchCreateOnExhaustedPoolIsPartial)
+{
+    Counted* objects[CAPACITY];
+    EXPECT_THAT(m_pool->createBatch(objects, CAPACITY / 2u), Eq(CAPACITY / 2u));
+    EXPECT_THAT(m_pool->createBatch(objects + CAPACITY / 2u, CAPACITY), Eq(CAPACITY / 2u));
+    EXPECT_THAT(m_pool->size(), Eq(CAPACITY));
+}
+
+TEST_F(ConcurrentObjectPool_test, destructorDestroysRemainingObjects)
+{
+    m_pool->create();
+    m_pool->create();
+    m_pool->allocate();
+    delete m_pool;
+    m_pool = nullptr;
+    EXPECT_THAT(Counted::destructionCounter.load(), Eq(2));
+}
+
+TEST_F(ConcurrentObjectPool_test, concurrentCreateAndFree)
+{
+    constexpr uint32_t NUMBER_OF_THREADS = 4u;
+    constexpr uint32_t ITERATIONS = 10000u;
+    iox::cxx::ConcurrentObjectPool<Counted, NUMBER_OF_THREADS * 2u> pool;
+
+    std::atomic<bool> run{false};
+    std::atomic<uint32_t> failedCreates{0u};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0u; t < NUMBER_OF_THREADS; ++t)
+    {
+        threads.emplace_back([&] {
+            while (!run.load())
+            {
+                std::this_thread::yield();
+            }
+            for (uint32_t i = 0u; i < ITERATIONS; ++i)
+            {
+                auto object = pool.create(static_cast<int>(i));
+                if (object == nullptr)
+                {
+                    ++failedCreates;
+                    continue;
+                }
+                EXPECT_THAT(object->m_value, Eq(static_cast<int>(i)));
+                EXPECT_THAT(pool.free(object), Eq(true));
+            }
+        });
+    }
+    run = true;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // every thread holds at most one object, the pool has two cells per thread
+    EXPECT_THAT(failedCreates.load(), Eq(0u));
+    EXPECT_THAT(pool.size(), Eq(0u));
+    EXPECT_THAT(Counted::constructionCounter.load(), Eq(Counted::destructionCounter.load()));
+}
+
+TEST_F(ConcurrentObjectPool_test, concurrentBatchCreateAndFree)
+{
+    constexpr uint32_t NUMBER_OF_THREADS = 4u;
+    constexpr uint32_t BATCH_SIZE = 8u;
+    constexpr uint32_t ITERATIONS = 2000u;
+    iox::cxx::ConcurrentObjectPool<Counted, NUMBER_OF_THREADS * BATCH_SIZE> pool;
+
+    std::atomic<bool> run{false};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0u; t < NUMBER_OF_THREADS; ++t)
+    {
+        threads.emplace_back([&] {
+            while (!run.load())
+            {
+                std::this_thread::yield();
+            }
+            Counted* objects[BATCH_SIZE];
+            for (uint32_t i = 0u; i < ITERATIONS; ++i)
+            {
+                auto created = pool.createBatch(objects, BATCH_SIZE);
+                EXPECT_THAT(created, Eq(BATCH_SIZE));
+                EXPECT_THAT(pool.freeBatch(objects, created), Eq(true));
+            }
+        });
+    }
+    run = true;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(pool.size(), Eq(0u));
+    EXPECT_THAT(Counted::constructionCounter.load(), Eq(Counted::destructionCounter.load()));
+}
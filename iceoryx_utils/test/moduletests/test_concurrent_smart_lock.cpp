@@ -0,0 +1,120 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test.hpp"
+#include "iceoryx_utils/internal/concurrent/sharded_mutex.hpp"
+#include "iceoryx_utils/internal/concurrent/smart_lock.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_mutex.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+using namespace iox;
+
+class SmartLock_test : public Test
+{
+  public:
+    void SetUp()
+    {
+    }
+
+    void TearDown()
+    {
+    }
+};
+
+TEST_F(SmartLock_test, ReadScopeGuardWithExclusiveMutex)
+{
+    concurrent::smart_lock<std::vector<int>> sut;
+    sut->push_back(31);
+
+    auto guard = sut.GetReadScopeGuard();
+    EXPECT_THAT(guard->size(), Eq(1u));
+    EXPECT_THAT(guard->front(), Eq(31));
+}
+
+TEST_F(SmartLock_test, ReadScopeGuardWithSharedMutex)
+{
+    concurrent::smart_lock<std::vector<int>, posix::shared_mutex> sut;
+    sut->push_back(42);
+
+    auto guard = sut.GetReadScopeGuard();
+    EXPECT_THAT(guard->size(), Eq(1u));
+    EXPECT_THAT(guard->front(), Eq(42));
+}
+
+TEST_F(SmartLock_test, SharedMutexAllowsConcurrentReaders)
+{
+    posix::shared_mutex sut;
+
+    EXPECT_THAT(sut.lock_shared(), Eq(true));
+    // a second reader must not be blocked out
+    EXPECT_THAT(sut.try_lock_shared(), Eq(true));
+    // but a writer must be
+    EXPECT_THAT(sut.try_lock(), Eq(false));
+    EXPECT_THAT(sut.unlock_shared(), Eq(true));
+    EXPECT_THAT(sut.unlock_shared(), Eq(true));
+
+    EXPECT_THAT(sut.try_lock(), Eq(true));
+    EXPECT_THAT(sut.unlock(), Eq(true));
+}
+
+TEST_F(SmartLock_test, ShardedMutexExclusiveLockBlocksAllShards)
+{
+    concurrent::sharded_mutex<4> sut;
+
+    sut.lock();
+    std::atomic_bool readerDone{false};
+    // a reader on any shard has to wait for the writer
+    std::thread reader([&] {
+        sut.lock_shared();
+        sut.unlock_shared();
+        readerDone.store(true);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_THAT(readerDone.load(), Eq(false));
+
+    sut.unlock();
+    reader.join();
+    EXPECT_THAT(readerDone.load(), Eq(true));
+}
+
+TEST_F(SmartLock_test, ShardedMutexTryLock)
+{
+    concurrent::sharded_mutex<4> sut;
+
+    EXPECT_THAT(sut.try_lock(), Eq(true));
+    sut.unlock();
+
+    sut.lock_shared();
+    // one shard is held by this thread, the writer cannot acquire all of them
+    EXPECT_THAT(sut.try_lock(), Eq(false));
+    sut.unlock_shared();
+
+    EXPECT_THAT(sut.try_lock(), Eq(true));
+    sut.unlock();
+}
+
+TEST_F(SmartLock_test, ReadScopeGuardWithShardedMutex)
+{
+    concurrent::smart_lock<std::vector<int>, concurrent::sharded_mutex<4>> sut;
+    sut->push_back(73);
+
+    auto guard = sut.GetReadScopeGuard();
+    EXPECT_THAT(guard->size(), Eq(1u));
+    EXPECT_THAT(guard->front(), Eq(73));
+}
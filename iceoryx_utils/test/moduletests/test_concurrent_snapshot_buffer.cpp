@@ -0,0 +1,119 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/internal/concurrent/snapshot_buffer.hpp"
+#include "test.hpp"
+
+#include <thread>
+
+using namespace ::testing;
+
+namespace
+{
+struct CounterPair
+{
+    uint64_t m_first{0u};
+    uint64_t m_second{0u};
+};
+} // namespace
+
+class SnapshotBuffer_test : public Test
+{
+  public:
+    iox::concurrent::SnapshotBuffer<CounterPair> m_sut;
+};
+
+TEST_F(SnapshotBuffer_test, ReadBeforeFirstWriteReturnsFalse)
+{
+    CounterPair value;
+    EXPECT_FALSE(m_sut.read(value));
+    EXPECT_FALSE(m_sut.hasContent());
+}
+
+TEST_F(SnapshotBuffer_test, ReadReturnsTheWrittenValue)
+{
+    CounterPair value;
+    value.m_first = 37u;
+    value.m_second = 73u;
+    m_sut.write(value);
+
+    CounterPair result;
+    ASSERT_TRUE(m_sut.read(result));
+    EXPECT_THAT(result.m_first, Eq(37u));
+    EXPECT_THAT(result.m_second, Eq(73u));
+    EXPECT_TRUE(m_sut.hasContent());
+}
+
+TEST_F(SnapshotBuffer_test, ReadReturnsTheLatestValueAfterMultipleWrites)
+{
+    CounterPair value;
+    for (uint64_t i = 1u; i <= 5u; ++i)
+    {
+        value.m_first = i;
+        value.m_second = i;
+        m_sut.write(value);
+    }
+
+    CounterPair result;
+    ASSERT_TRUE(m_sut.read(result));
+    EXPECT_THAT(result.m_first, Eq(5u));
+    EXPECT_THAT(result.m_second, Eq(5u));
+}
+
+TEST_F(SnapshotBuffer_test, UpdateFillsTheSnapshotInPlace)
+{
+    m_sut.update([](CounterPair& buffer) {
+        buffer.m_first = 13u;
+        buffer.m_second = 31u;
+    });
+
+    CounterPair result;
+    ASSERT_TRUE(m_sut.read(result));
+    EXPECT_THAT(result.m_first, Eq(13u));
+    EXPECT_THAT(result.m_second, Eq(31u));
+}
+
+TEST_F(SnapshotBuffer_test, ConcurrentReadersAlwaysSeeAConsistentSnapshot)
+{
+    // the two members are written with the same value, a torn read would
+    // surface as a mismatch
+    std::atomic<bool> run{true};
+    std::thread writer([&] {
+        CounterPair value;
+        uint64_t counter{0u};
+        while (run.load(std::memory_order_relaxed))
+        {
+            ++counter;
+            value.m_first = counter;
+            value.m_second = counter;
+            m_sut.write(value);
+        }
+    });
+
+    uint64_t lastSeen{0u};
+    for (uint32_t i = 0u; i < 10000u; ++i)
+    {
+        CounterPair result;
+        if (m_sut.read(result))
+        {
+            EXPECT_THAT(result.m_first, Eq(result.m_second));
+            // the snapshot never goes backwards for a single reader
+            EXPECT_THAT(result.m_first, Ge(lastSeen));
+            lastSeen = result.m_first;
+        }
+    }
+
+    run = false;
+    writer.join();
+}
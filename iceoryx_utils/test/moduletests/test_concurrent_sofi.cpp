@@ -488,5 +488,100 @@ TEST_F(CUnitTestContainerSoFi, PopIfInvalidNotEmptyAfter)
     EXPECT_EQ(m_sofi.empty(), false);
 }
 
+TEST_F(CUnitTestContainerSoFi, PushBatchPopBatchRoundTrip)
+{
+    int input[TEST_SOFI_CAPACITY];
+    int overflow[TEST_SOFI_CAPACITY];
+    for (int i = 0; i < TEST_SOFI_CAPACITY; i++)
+    {
+        input[i] = i + 100;
+    }
+
+    EXPECT_EQ(0u, m_sofi.pushBatch(input, TEST_SOFI_CAPACITY, overflow));
+    EXPECT_EQ(static_cast<uint64_t>(TEST_SOFI_CAPACITY), m_sofi.size());
+
+    int output[TEST_SOFI_CAPACITY];
+    EXPECT_EQ(static_cast<uint32_t>(TEST_SOFI_CAPACITY), m_sofi.popBatch(output, TEST_SOFI_CAPACITY));
+    for (int i = 0; i < TEST_SOFI_CAPACITY; i++)
+    {
+        EXPECT_EQ(i + 100, output[i]);
+    }
+    EXPECT_TRUE(m_sofi.empty());
+}
+
+TEST_F(CUnitTestContainerSoFi, PopBatchOnEmptyReturnsZero)
+{
+    int output[TEST_SOFI_CAPACITY];
+    EXPECT_EQ(0u, m_sofi.popBatch(output, TEST_SOFI_CAPACITY));
+}
+
+TEST_F(CUnitTestContainerSoFi, PopBatchIsBoundedByContent)
+{
+    pushSome(0, 3);
+
+    int output[TEST_SOFI_CAPACITY];
+    EXPECT_EQ(3u, m_sofi.popBatch(output, TEST_SOFI_CAPACITY));
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(i, output[i]);
+    }
+}
+
+TEST_F(CUnitTestContainerSoFi, PushBatchReturnsOverwrittenValues)
+{
+    // fill the SoFi completely, internally one more item fits than the capacity
+    pushSome(0, TEST_SOFI_FULL);
+
+    int input[3] = {100, 101, 102};
+    int overflow[3] = {-1, -1, -1};
+    EXPECT_EQ(3u, m_sofi.pushBatch(input, 3, overflow));
+    // the oldest serial numbers are handed back in FIFO order
+    EXPECT_EQ(0, overflow[0]);
+    EXPECT_EQ(1, overflow[1]);
+    EXPECT_EQ(2, overflow[2]);
+
+    // the surviving old serial numbers are still consecutive, followed by the batch
+    popSome(3, TEST_SOFI_FULL - 3);
+    popAll(100);
+}
+
+TEST_F(CUnitTestContainerSoFi, PushBatchLargerThanCapacity)
+{
+    constexpr uint32_t BATCH_SIZE = 2 * TEST_SOFI_FULL;
+    int input[BATCH_SIZE];
+    int overflow[BATCH_SIZE];
+    for (uint32_t i = 0; i < BATCH_SIZE; i++)
+    {
+        input[i] = static_cast<int>(i);
+    }
+
+    // only the newest TEST_SOFI_FULL items can stay, the rest overflows in order
+    EXPECT_EQ(BATCH_SIZE - TEST_SOFI_FULL, m_sofi.pushBatch(input, BATCH_SIZE, overflow));
+    for (uint32_t i = 0; i < BATCH_SIZE - TEST_SOFI_FULL; i++)
+    {
+        EXPECT_EQ(static_cast<int>(i), overflow[i]);
+    }
+
+    popAll(static_cast<int>(BATCH_SIZE - TEST_SOFI_FULL));
+}
+
+TEST_F(CUnitTestContainerSoFi, IndexConflictsStayZeroWithoutContention)
+{
+    EXPECT_EQ(0u, m_sofi.getIndexConflicts());
+
+    int valueOut{0};
+    for (int i = 0; i < 2 * TEST_SOFI_CAPACITY; i++)
+    {
+        m_sofi.push(i, valueOut);
+    }
+    while (m_sofi.pop(valueOut))
+    {
+    }
+
+    // without a concurrent pop even the overflow CAS succeeds on the first
+    // attempt, so the conflict counter must not move
+    EXPECT_EQ(0u, m_sofi.getIndexConflicts());
+}
+
 /// @todo popif empty test
 } // namespace gtest_daddy_container_sofi_unittest
@@ -16,6 +16,7 @@
 #include "iceoryx_utils/internal/concurrent/taco.hpp"
 
 #include <iostream>
+#include <thread>
 
 using namespace ::testing;
 
@@ -258,3 +259,120 @@ TEST_F(TACO_test, DoubleExchange)
     ASSERT_THAT(retVal_2.has_value(), Eq(true));
     EXPECT_THAT(*retVal_2, Eq(ExpectedData_2));
 }
+
+class IndexedTACO_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    static constexpr uint32_t NumberOfContexts{3};
+    static constexpr uint32_t PublisherContext{0};
+    static constexpr uint32_t MonitoringContext{1};
+    static constexpr uint32_t ThirdContext{2};
+
+    using MyIndexedTACO = iox::concurrent::IndexedTACO<TestData, NumberOfContexts>;
+};
+
+constexpr uint32_t IndexedTACO_test::NumberOfContexts;
+constexpr uint32_t IndexedTACO_test::PublisherContext;
+constexpr uint32_t IndexedTACO_test::MonitoringContext;
+constexpr uint32_t IndexedTACO_test::ThirdContext;
+
+TEST_F(IndexedTACO_test, Initialized)
+{
+    // TACO must be empty when initialized
+    MyIndexedTACO taco(iox::concurrent::TACOMode::AccecptDataFromSameContext);
+    auto retVal = taco.take(PublisherContext);
+    EXPECT_THAT(retVal.has_value(), Eq(false));
+}
+
+TEST_F(IndexedTACO_test, StoreAndTake_FromDifferentContext)
+{
+    MyIndexedTACO taco(iox::concurrent::TACOMode::DenyDataFromSameContext);
+    constexpr TestData ExpectedData{1, 42, 73};
+
+    taco.store(ExpectedData, PublisherContext);
+    auto retVal = taco.take(MonitoringContext);
+
+    ASSERT_THAT(retVal.has_value(), Eq(true));
+    EXPECT_THAT(*retVal, Eq(ExpectedData));
+}
+
+TEST_F(IndexedTACO_test, StoreAndTake_FromSameContext_SameContextDenied)
+{
+    MyIndexedTACO taco(iox::concurrent::TACOMode::DenyDataFromSameContext);
+    constexpr TestData ExpectedData{1, 42, 73};
+
+    taco.store(ExpectedData, PublisherContext);
+    auto retVal = taco.take(PublisherContext);
+
+    EXPECT_THAT(retVal.has_value(), Eq(false));
+}
+
+TEST_F(IndexedTACO_test, DoubleTake)
+{
+    MyIndexedTACO taco(iox::concurrent::TACOMode::DenyDataFromSameContext);
+    constexpr TestData ExpectedData{1, 42, 73};
+
+    taco.store(ExpectedData, PublisherContext);
+    taco.take(MonitoringContext);
+    auto retVal = taco.take(ThirdContext);
+
+    EXPECT_THAT(retVal.has_value(), Eq(false));
+}
+
+TEST_F(IndexedTACO_test, Exchange)
+{
+    MyIndexedTACO taco(iox::concurrent::TACOMode::DenyDataFromSameContext);
+    constexpr TestData ExpectedData_1{1, 42, 73};
+    constexpr TestData ExpectedData_2{13, 111, 666};
+    constexpr TestData DummyData{37, 4242, 123456};
+
+    taco.store(ExpectedData_1, PublisherContext);
+    auto retVal_1 = taco.exchange(ExpectedData_2, MonitoringContext);
+    auto retVal_2 = taco.exchange(DummyData, ThirdContext);
+
+    ASSERT_THAT(retVal_1.has_value(), Eq(true));
+    EXPECT_THAT(*retVal_1, Eq(ExpectedData_1));
+
+    ASSERT_THAT(retVal_2.has_value(), Eq(true));
+    EXPECT_THAT(*retVal_2, Eq(ExpectedData_2));
+}
+
+TEST_F(IndexedTACO_test, ConcurrentExchange)
+{
+    // publisher/monitoring like pattern; the producer permanently updates the
+    // state, the consumer must only ever see consistent states
+    MyIndexedTACO taco(iox::concurrent::TACOMode::DenyDataFromSameContext);
+    constexpr uint32_t TotalCount{100000};
+
+    auto producer = std::thread([&] {
+        for (uint32_t i = 1; i <= TotalCount; i++)
+        {
+            taco.store(TestData{i, TotalCount - i, static_cast<uint64_t>(i) + TotalCount}, PublisherContext);
+        }
+    });
+    auto consumer = std::thread([&] {
+        uint32_t lastIndex{0};
+        while (lastIndex < TotalCount)
+        {
+            auto retVal = taco.take(MonitoringContext);
+            if (retVal.has_value())
+            {
+                EXPECT_THAT(retVal->counter, Eq(TotalCount - retVal->index));
+                EXPECT_THAT(retVal->timestamp, Eq(static_cast<uint64_t>(retVal->index) + TotalCount));
+                EXPECT_THAT(retVal->index, Ge(lastIndex));
+                lastIndex = retVal->index;
+            }
+        }
+    });
+
+    producer.join();
+    consumer.join();
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test.hpp"
+#include "iceoryx_utils/internal/concurrent/thread_pool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace testing;
+using namespace iox::concurrent;
+
+class ThreadPool_test : public Test
+{
+  public:
+    void SetUp()
+    {
+    }
+
+    void TearDown()
+    {
+    }
+
+    void waitUntil(const std::function<bool()>& condition)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!condition() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+};
+
+TEST_F(ThreadPool_test, NumberOfWorkersIsClamped)
+{
+    ThreadPool pool(2u);
+    EXPECT_THAT(pool.isInitialized(), Eq(true));
+    EXPECT_THAT(pool.numberOfWorkers(), Eq(2u));
+
+    ThreadPool bigPool(ThreadPool::MAX_WORKERS + 10u);
+    EXPECT_THAT(bigPool.numberOfWorkers(), Eq(ThreadPool::MAX_WORKERS));
+}
+
+TEST_F(ThreadPool_test, SingleTaskIsExecuted)
+{
+    ThreadPool pool(2u);
+    std::atomic<int> value{0};
+
+    EXPECT_THAT(pool.submit([&] { value.store(42); }), Eq(true));
+    waitUntil([&] { return value.load() == 42; });
+    EXPECT_THAT(value.load(), Eq(42));
+}
+
+TEST_F(ThreadPool_test, AllTasksOfABurstAreExecuted)
+{
+    constexpr uint32_t NUMBER_OF_TASKS = 100u;
+    ThreadPool pool(4u);
+    std::atomic<uint32_t> counter{0u};
+
+    for (uint32_t i = 0u; i < NUMBER_OF_TASKS; ++i)
+    {
+        EXPECT_THAT(pool.submit([&] { counter.fetch_add(1u); }), Eq(true));
+    }
+
+    waitUntil([&] { return counter.load() == NUMBER_OF_TASKS; });
+    EXPECT_THAT(counter.load(), Eq(NUMBER_OF_TASKS));
+}
+
+TEST_F(ThreadPool_test, AffinityHintTasksAreExecuted)
+{
+    constexpr uint32_t NUMBER_OF_TASKS = 50u;
+    ThreadPool pool(4u);
+    std::atomic<uint32_t> counter{0u};
+
+    for (uint32_t i = 0u; i < NUMBER_OF_TASKS; ++i)
+    {
+        EXPECT_THAT(pool.submit([&] { counter.fetch_add(1u); }, 7u), Eq(true));
+    }
+
+    waitUntil([&] { return counter.load() == NUMBER_OF_TASKS; });
+    EXPECT_THAT(counter.load(), Eq(NUMBER_OF_TASKS));
+}
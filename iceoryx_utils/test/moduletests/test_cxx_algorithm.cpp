@@ -64,3 +64,64 @@ TEST_F(algorithm_test, MinOfManyElements)
 {
     EXPECT_THAT(min(0.0123f, -91.12f, 123.92f, -1021.2f, 0.0f), Eq(-1021.2f));
 }
+
+TEST_F(algorithm_test, MinMaxOfIntegerRange)
+{
+    int data[7] = {5, -3, 17, 0, 17, -3, 4};
+    EXPECT_THAT(minOfRange(data, 7u), Eq(-3));
+    EXPECT_THAT(maxOfRange(data, 7u), Eq(17));
+    EXPECT_THAT(minOfRange(data, 1u), Eq(5));
+    EXPECT_THAT(maxOfRange(data, 1u), Eq(5));
+}
+
+TEST_F(algorithm_test, MinMaxOfFloatRangeLongerThanOneSimdLane)
+{
+    float data[11] = {5.5f, -3.25f, 17.0f, 0.0f, 99.5f, -103.75f, 4.0f, 8.0f, 1.0f, 2.0f, 3.0f};
+    EXPECT_THAT(minOfRange(data, 11u), Eq(-103.75f));
+    EXPECT_THAT(maxOfRange(data, 11u), Eq(99.5f));
+}
+
+TEST_F(algorithm_test, MinMaxOfFloatRangeWithExtremumInTheTail)
+{
+    float data[6] = {5.5f, -3.25f, 17.0f, 0.0f, -103.75f, 99.5f};
+    EXPECT_THAT(minOfRange(data, 6u), Eq(-103.75f));
+    EXPECT_THAT(maxOfRange(data, 6u), Eq(99.5f));
+}
+
+TEST_F(algorithm_test, SumOfRange)
+{
+    uint64_t data[5] = {1u, 2u, 3u, 4u, 5u};
+    EXPECT_THAT(sumOfRange(data, 5u), Eq(15u));
+    EXPECT_THAT(sumOfRange(data, 0u), Eq(0u));
+
+    // powers of two sum exactly in every association order
+    float floatData[9] = {1.0f, 2.0f, 4.0f, 8.0f, 16.0f, 32.0f, 64.0f, 128.0f, 256.0f};
+    EXPECT_THAT(sumOfRange(floatData, 9u), Eq(511.0f));
+}
+
+TEST_F(algorithm_test, FindInRange)
+{
+    uint8_t data[20] = {0};
+    data[17] = 42u;
+    EXPECT_THAT(findInRange(data, 20u, static_cast<uint8_t>(42u)), Eq(17u));
+    EXPECT_THAT(findInRange(data, 20u, static_cast<uint8_t>(13u)), Eq(20u));
+    EXPECT_THAT(findInRange(data, 17u, static_cast<uint8_t>(42u)), Eq(17u));
+
+    int intData[4] = {3, 1, 4, 1};
+    EXPECT_THAT(findInRange(intData, 4u, 1), Eq(1u));
+    EXPECT_THAT(findInRange(intData, 4u, 7), Eq(4u));
+}
+
+TEST_F(algorithm_test, CountInRange)
+{
+    uint8_t data[40] = {0};
+    data[0] = 42u;
+    data[18] = 42u;
+    data[39] = 42u;
+    EXPECT_THAT(countInRange(data, 40u, static_cast<uint8_t>(42u)), Eq(3u));
+    EXPECT_THAT(countInRange(data, 40u, static_cast<uint8_t>(0u)), Eq(37u));
+    EXPECT_THAT(countInRange(data, 0u, static_cast<uint8_t>(0u)), Eq(0u));
+
+    int intData[5] = {3, 1, 4, 1, 5};
+    EXPECT_THAT(countInRange(intData, 5u, 1), Eq(2u));
+}
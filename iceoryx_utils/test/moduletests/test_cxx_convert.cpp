@@ -17,6 +17,7 @@
 
 
 #include <cstdint>
+#include <limits>
 
 using namespace ::testing;
 
@@ -379,3 +380,56 @@ TEST_F(convert_test, fromString_MinMaxUNSIGNED_Int)
     source = "-1";
     EXPECT_THAT(iox::cxx::convert::fromString(source.c_str(), destination), Eq(false));
 }
+
+TEST_F(convert_test, toString_MinMaxIntegers)
+{
+    EXPECT_THAT(iox::cxx::convert::toString(std::numeric_limits<std::int64_t>::min()),
+                Eq("-9223372036854775808"));
+    EXPECT_THAT(iox::cxx::convert::toString(std::numeric_limits<std::int64_t>::max()),
+                Eq("9223372036854775807"));
+    EXPECT_THAT(iox::cxx::convert::toString(std::numeric_limits<std::uint64_t>::max()),
+                Eq("18446744073709551615"));
+    EXPECT_THAT(iox::cxx::convert::toString(0), Eq("0"));
+    EXPECT_THAT(iox::cxx::convert::toString(-42), Eq("-42"));
+}
+
+TEST_F(convert_test, fromChars_UNSIGNED_Success)
+{
+    std::uint64_t destination{0u};
+    EXPECT_THAT(iox::cxx::convert::fromChars("123923292", destination), Eq(true));
+    EXPECT_THAT(destination, Eq(123923292u));
+    EXPECT_THAT(iox::cxx::convert::fromChars("18446744073709551615", destination), Eq(true));
+    EXPECT_THAT(destination, Eq(std::numeric_limits<std::uint64_t>::max()));
+}
+
+TEST_F(convert_test, fromChars_UNSIGNED_Fail)
+{
+    std::uint64_t destination{0u};
+    EXPECT_THAT(iox::cxx::convert::fromChars("", destination), Eq(false));
+    EXPECT_THAT(iox::cxx::convert::fromChars("-1", destination), Eq(false));
+    EXPECT_THAT(iox::cxx::convert::fromChars("123a", destination), Eq(false));
+    EXPECT_THAT(iox::cxx::convert::fromChars("18446744073709551616", destination), Eq(false));
+}
+
+TEST_F(convert_test, fromChars_SIGNED_Success)
+{
+    std::int64_t destination{0};
+    EXPECT_THAT(iox::cxx::convert::fromChars("-123923292", destination), Eq(true));
+    EXPECT_THAT(destination, Eq(-123923292));
+    EXPECT_THAT(iox::cxx::convert::fromChars("+42", destination), Eq(true));
+    EXPECT_THAT(destination, Eq(42));
+    EXPECT_THAT(iox::cxx::convert::fromChars("-9223372036854775808", destination), Eq(true));
+    EXPECT_THAT(destination, Eq(std::numeric_limits<std::int64_t>::min()));
+    EXPECT_THAT(iox::cxx::convert::fromChars("9223372036854775807", destination), Eq(true));
+    EXPECT_THAT(destination, Eq(std::numeric_limits<std::int64_t>::max()));
+}
+
+TEST_F(convert_test, fromChars_SIGNED_Fail)
+{
+    std::int64_t destination{0};
+    EXPECT_THAT(iox::cxx::convert::fromChars("", destination), Eq(false));
+    EXPECT_THAT(iox::cxx::convert::fromChars("-", destination), Eq(false));
+    EXPECT_THAT(iox::cxx::convert::fromChars("12-12", destination), Eq(false));
+    EXPECT_THAT(iox::cxx::convert::fromChars("-9223372036854775809", destination), Eq(false));
+    EXPECT_THAT(iox::cxx::convert::fromChars("9223372036854775808", destination), Eq(false));
+}
@@ -0,0 +1,75 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/cxx/crc32c.hpp"
+#include "test.hpp"
+
+#include <cstring>
+#include <vector>
+
+using namespace ::testing;
+using iox::cxx::crc32c;
+
+TEST(crc32c_test, EmptyInputYieldsZero)
+{
+    EXPECT_THAT(crc32c(nullptr, 0u), Eq(0u));
+}
+
+TEST(crc32c_test, KnownCheckValue)
+{
+    // the standard CRC32C check value, see RFC 3720 appendix B.4
+    const char* l_input = "123456789";
+    EXPECT_THAT(crc32c(l_input, strlen(l_input)), Eq(0xE3069283u));
+}
+
+TEST(crc32c_test, DifferentInputsYieldDifferentChecksums)
+{
+    uint64_t l_a{73u};
+    uint64_t l_b{74u};
+    EXPECT_THAT(crc32c(&l_a, sizeof(l_a)), Ne(crc32c(&l_b, sizeof(l_b))));
+}
+
+TEST(crc32c_test, ChunkedCalculationMatchesOneShot)
+{
+    // seeding with the previous result allows checksumming a buffer in pieces
+    std::vector<uint8_t> l_buffer;
+    for (uint32_t i = 0u; i < 1000u; ++i)
+    {
+        l_buffer.push_back(static_cast<uint8_t>(i * 7u));
+    }
+
+    auto l_oneShot = crc32c(l_buffer.data(), l_buffer.size());
+
+    auto l_chunked = crc32c(l_buffer.data(), 333u);
+    l_chunked = crc32c(l_buffer.data() + 333u, l_buffer.size() - 333u, l_chunked);
+
+    EXPECT_THAT(l_chunked, Eq(l_oneShot));
+}
+
+TEST(crc32c_test, UnalignedBufferYieldsSameChecksum)
+{
+    // the hardware path loads 8 bytes at a time, the tail and unaligned starts
+    // must not change the result
+    alignas(8) uint8_t l_storage[64u];
+    for (uint32_t i = 0u; i < sizeof(l_storage); ++i)
+    {
+        l_storage[i] = static_cast<uint8_t>(i);
+    }
+
+    auto l_aligned = crc32c(&l_storage[0], 32u);
+
+    alignas(8) uint8_t l_shifted[64u];
+    memcpy(&l_shifted[3], &l_storage[0], 32u);
+    EXPECT_THAT(crc32c(&l_shifted[3], 32u), Eq(l_aligned));
+}
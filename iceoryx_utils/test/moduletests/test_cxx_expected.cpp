@@ -329,3 +329,115 @@ TEST_F(expected_test, ConvertNonVoidErrorResultToVoidResult)
     EXPECT_THAT(sut2.has_error(), Eq(true));
     EXPECT_THAT(sut2.get_error(), Eq(1.23f));
 }
+
+TEST_F(expected_test, AndThenChainsOnSuccess)
+{
+    auto sut = expected<int, float>::create_value(20).and_then(
+        [](int&& value) { return expected<int, float>::create_value(value + 22); });
+
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    EXPECT_THAT(sut.get_value(), Eq(42));
+}
+
+TEST_F(expected_test, AndThenForwardsErrorWithoutCallingTheCallable)
+{
+    bool wasCalled{false};
+    auto sut = expected<int, float>::create_error(66.6f).and_then([&](int&&) {
+        wasCalled = true;
+        return expected<int, float>::create_value(0);
+    });
+
+    EXPECT_THAT(wasCalled, Eq(false));
+    ASSERT_THAT(sut.has_error(), Eq(true));
+    EXPECT_THAT(sut.get_error(), Eq(66.6f));
+}
+
+TEST_F(expected_test, AndThenCanChangeTheValueType)
+{
+    auto sut = expected<int, float>::create_value(73).and_then(
+        [](int&& value) { return expected<std::string, float>::create_value(std::to_string(value)); });
+
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    EXPECT_THAT(sut.get_value(), Eq("73"));
+}
+
+TEST_F(expected_test, OrElseRecoversFromError)
+{
+    auto sut = expected<int, float>::create_error(12.12f).or_else(
+        [](float&&) { return expected<int, float>::create_value(1337); });
+
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    EXPECT_THAT(sut.get_value(), Eq(1337));
+}
+
+TEST_F(expected_test, OrElseForwardsValueWithoutCallingTheCallable)
+{
+    bool wasCalled{false};
+    auto sut = expected<int, float>::create_value(555).or_else([&](float&&) {
+        wasCalled = true;
+        return expected<int, float>::create_value(0);
+    });
+
+    EXPECT_THAT(wasCalled, Eq(false));
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    EXPECT_THAT(sut.get_value(), Eq(555));
+}
+
+TEST_F(expected_test, AndThenOnLValueCopiesTheValue)
+{
+    auto origin = expected<int, float>::create_value(31);
+    auto sut = origin.and_then([](int& value) { return expected<int, float>::create_value(value + 1); });
+
+    ASSERT_THAT(sut.has_error(), Eq(false));
+    EXPECT_THAT(sut.get_value(), Eq(32));
+    EXPECT_THAT(origin.get_value(), Eq(31));
+}
+
+TEST_F(expected_test, VoidAndThenChainsOnSuccess)
+{
+    int calls{0};
+    auto sut = expected<float>::create_value()
+                   .and_then([&] {
+                       ++calls;
+                       return expected<float>::create_value();
+                   })
+                   .and_then([&] {
+                       ++calls;
+                       return expected<float>::create_value();
+                   });
+
+    EXPECT_THAT(calls, Eq(2));
+    EXPECT_THAT(sut.has_error(), Eq(false));
+}
+
+TEST_F(expected_test, VoidAndThenStopsTheChainOnError)
+{
+    bool wasCalled{false};
+    auto sut = expected<float>::create_error(99.9f).and_then([&] {
+        wasCalled = true;
+        return expected<float>::create_value();
+    });
+
+    EXPECT_THAT(wasCalled, Eq(false));
+    ASSERT_THAT(sut.has_error(), Eq(true));
+    EXPECT_THAT(sut.get_error(), Eq(99.9f));
+}
+
+TEST_F(expected_test, VoidOrElseRecoversFromError)
+{
+    auto sut =
+        expected<float>::create_error(1.0f).or_else([](float&&) { return expected<float>::create_value(); });
+
+    EXPECT_THAT(sut.has_error(), Eq(false));
+}
+
+TEST_F(expected_test, OnSuccessWithMoveOnlyLikeLambdaCapture)
+{
+    // the callable type is deduced, there is no conversion into a
+    // std::function anymore
+    auto sut = expected<int, float>::create_value(4711);
+    int capturedValue{0};
+    sut.on_success([&](expected<int, float>& result) { capturedValue = result.get_value(); });
+
+    EXPECT_THAT(capturedValue, Eq(4711));
+}
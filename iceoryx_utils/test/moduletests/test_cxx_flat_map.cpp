@@ -0,0 +1,122 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/cxx/flat_map.hpp"
+#include "test.hpp"
+
+using namespace ::testing;
+using namespace iox::cxx;
+
+class flat_map_test : public Test
+{
+  public:
+    flat_map<uint32_t, uint32_t, 10> sut;
+};
+
+TEST_F(flat_map_test, NewlyCreatedMapIsEmpty)
+{
+    EXPECT_THAT(sut.empty(), Eq(true));
+    EXPECT_THAT(sut.size(), Eq(0u));
+    EXPECT_THAT(sut.capacity(), Eq(10u));
+}
+
+TEST_F(flat_map_test, InsertAndFind)
+{
+    EXPECT_THAT(sut.insert(37u, 1u), Eq(true));
+
+    auto* value = sut.find(37u);
+    ASSERT_THAT(value, Ne(nullptr));
+    EXPECT_THAT(*value, Eq(1u));
+}
+
+TEST_F(flat_map_test, FindOfUnknownKeyReturnsNullptr)
+{
+    sut.insert(37u, 1u);
+    EXPECT_THAT(sut.find(73u), Eq(nullptr));
+}
+
+TEST_F(flat_map_test, DoubleInsertOfSameKeyFails)
+{
+    EXPECT_THAT(sut.insert(37u, 1u), Eq(true));
+    EXPECT_THAT(sut.insert(37u, 2u), Eq(false));
+    EXPECT_THAT(*sut.find(37u), Eq(1u));
+}
+
+TEST_F(flat_map_test, InsertFailsWhenFull)
+{
+    for (uint32_t i = 0; i < sut.capacity(); ++i)
+    {
+        EXPECT_THAT(sut.insert(i, i), Eq(true));
+    }
+    EXPECT_THAT(sut.insert(100u, 100u), Eq(false));
+}
+
+TEST_F(flat_map_test, InsertOrAssignOverwritesExistingValue)
+{
+    sut.insert(37u, 1u);
+    EXPECT_THAT(sut.insert_or_assign(37u, 2u), Eq(true));
+    EXPECT_THAT(*sut.find(37u), Eq(2u));
+}
+
+TEST_F(flat_map_test, InsertOrAssignInsertsNewKey)
+{
+    EXPECT_THAT(sut.insert_or_assign(37u, 2u), Eq(true));
+    EXPECT_THAT(sut.contains(37u), Eq(true));
+}
+
+TEST_F(flat_map_test, EraseRemovesEntry)
+{
+    sut.insert(37u, 1u);
+    sut.insert(73u, 2u);
+
+    EXPECT_THAT(sut.erase(37u), Eq(true));
+
+    EXPECT_THAT(sut.contains(37u), Eq(false));
+    EXPECT_THAT(sut.contains(73u), Eq(true));
+    EXPECT_THAT(sut.size(), Eq(1u));
+}
+
+TEST_F(flat_map_test, EraseOfUnknownKeyFails)
+{
+    sut.insert(37u, 1u);
+    EXPECT_THAT(sut.erase(73u), Eq(false));
+    EXPECT_THAT(sut.size(), Eq(1u));
+}
+
+TEST_F(flat_map_test, IterationIsSortedByKey)
+{
+    sut.insert(5u, 50u);
+    sut.insert(1u, 10u);
+    sut.insert(3u, 30u);
+
+    uint32_t expectedKeys[] = {1u, 3u, 5u};
+    uint64_t i = 0;
+    for (auto iter = sut.begin(); iter != sut.end(); ++iter, ++i)
+    {
+        EXPECT_THAT(iter->key, Eq(expectedKeys[i]));
+        EXPECT_THAT(iter->value, Eq(expectedKeys[i] * 10u));
+    }
+    EXPECT_THAT(i, Eq(3u));
+}
+
+TEST_F(flat_map_test, ClearRemovesAllEntries)
+{
+    sut.insert(37u, 1u);
+    sut.insert(73u, 2u);
+
+    sut.clear();
+
+    EXPECT_THAT(sut.empty(), Eq(true));
+    EXPECT_THAT(sut.contains(37u), Eq(false));
+}
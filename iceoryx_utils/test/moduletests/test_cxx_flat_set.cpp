@@ -0,0 +1,94 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/cxx/flat_set.hpp"
+#include "test.hpp"
+
+using namespace ::testing;
+using namespace iox::cxx;
+
+class flat_set_test : public Test
+{
+  public:
+    flat_set<uint32_t, 10> sut;
+};
+
+TEST_F(flat_set_test, NewlyCreatedSetIsEmpty)
+{
+    EXPECT_THAT(sut.empty(), Eq(true));
+    EXPECT_THAT(sut.size(), Eq(0u));
+    EXPECT_THAT(sut.capacity(), Eq(10u));
+}
+
+TEST_F(flat_set_test, InsertAndContains)
+{
+    EXPECT_THAT(sut.insert(37u), Eq(true));
+    EXPECT_THAT(sut.contains(37u), Eq(true));
+    EXPECT_THAT(sut.contains(73u), Eq(false));
+}
+
+TEST_F(flat_set_test, DoubleInsertOfSameKeyFails)
+{
+    EXPECT_THAT(sut.insert(37u), Eq(true));
+    EXPECT_THAT(sut.insert(37u), Eq(false));
+    EXPECT_THAT(sut.size(), Eq(1u));
+}
+
+TEST_F(flat_set_test, InsertFailsWhenFull)
+{
+    for (uint32_t i = 0; i < sut.capacity(); ++i)
+    {
+        EXPECT_THAT(sut.insert(i), Eq(true));
+    }
+    EXPECT_THAT(sut.insert(100u), Eq(false));
+}
+
+TEST_F(flat_set_test, EraseRemovesKey)
+{
+    sut.insert(37u);
+    sut.insert(73u);
+
+    EXPECT_THAT(sut.erase(37u), Eq(true));
+
+    EXPECT_THAT(sut.contains(37u), Eq(false));
+    EXPECT_THAT(sut.contains(73u), Eq(true));
+}
+
+TEST_F(flat_set_test, EraseOfUnknownKeyFails)
+{
+    EXPECT_THAT(sut.erase(73u), Eq(false));
+}
+
+TEST_F(flat_set_test, IterationIsSorted)
+{
+    sut.insert(5u);
+    sut.insert(1u);
+    sut.insert(3u);
+
+    uint32_t expectedKeys[] = {1u, 3u, 5u};
+    uint64_t i = 0;
+    for (const auto& key : sut)
+    {
+        EXPECT_THAT(key, Eq(expectedKeys[i]));
+        ++i;
+    }
+    EXPECT_THAT(i, Eq(3u));
+}
+
+TEST_F(flat_set_test, ClearRemovesAllKeys)
+{
+    sut.insert(37u);
+    sut.clear();
+    EXPECT_THAT(sut.empty(), Eq(true));
+}
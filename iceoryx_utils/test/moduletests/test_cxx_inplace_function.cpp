@@ -0,0 +1,121 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/cxx/inplace_function.hpp"
+#include "test.hpp"
+
+using namespace ::testing;
+using namespace iox::cxx;
+
+namespace
+{
+int freeFunction(int value)
+{
+    return value + 1;
+}
+} // namespace
+
+class inplace_function_test : public Test
+{
+  public:
+    inplace_function<int(int)> sut;
+};
+
+TEST_F(inplace_function_test, DefaultConstructedIsEmpty)
+{
+    EXPECT_THAT(static_cast<bool>(sut), Eq(false));
+    EXPECT_THAT(sut == nullptr, Eq(true));
+}
+
+TEST_F(inplace_function_test, ConstructedWithNullptrIsEmpty)
+{
+    inplace_function<void(void)> fuu(nullptr);
+    EXPECT_THAT(fuu == nullptr, Eq(true));
+}
+
+TEST_F(inplace_function_test, CallsStoredLambda)
+{
+    sut = [](int value) { return value * 2; };
+    EXPECT_THAT(sut != nullptr, Eq(true));
+    EXPECT_THAT(sut(21), Eq(42));
+}
+
+TEST_F(inplace_function_test, CallsStoredFreeFunction)
+{
+    sut = &freeFunction;
+    EXPECT_THAT(sut(41), Eq(42));
+}
+
+TEST_F(inplace_function_test, CallsLambdaWithCapture)
+{
+    int capturedValue{40};
+    sut = [&](int value) { return capturedValue + value; };
+    EXPECT_THAT(sut(2), Eq(42));
+}
+
+TEST_F(inplace_function_test, CopyKeepsTheCallable)
+{
+    sut = [](int value) { return value * 2; };
+    inplace_function<int(int)> copy(sut);
+    EXPECT_THAT(copy(21), Eq(42));
+    EXPECT_THAT(sut(21), Eq(42));
+}
+
+TEST_F(inplace_function_test, MoveTransfersTheCallable)
+{
+    sut = [](int value) { return value * 2; };
+    inplace_function<int(int)> destination(std::move(sut));
+    EXPECT_THAT(destination(21), Eq(42));
+    EXPECT_THAT(sut == nullptr, Eq(true));
+}
+
+TEST_F(inplace_function_test, AssigningNullptrDropsTheCallable)
+{
+    sut = [](int value) { return value; };
+    sut = nullptr;
+    EXPECT_THAT(static_cast<bool>(sut), Eq(false));
+}
+
+TEST_F(inplace_function_test, ReassignmentDestructsPreviousCallable)
+{
+    static int dTorCount{0};
+    struct Callable
+    {
+        Callable() = default;
+        Callable(const Callable&) = default;
+        ~Callable()
+        {
+            ++dTorCount;
+        }
+        int operator()(int value)
+        {
+            return value;
+        }
+    };
+
+    dTorCount = 0;
+    {
+        inplace_function<int(int)> fuu{Callable()};
+        int countAfterConstruction = dTorCount; // temporaries of the ctor call
+        fuu = [](int value) { return value + 1; };
+        EXPECT_THAT(dTorCount, Eq(countAfterConstruction + 1));
+        EXPECT_THAT(fuu(41), Eq(42));
+    }
+}
+
+TEST_F(inplace_function_test, ConstInplaceFunctionIsCallable)
+{
+    const inplace_function<int(int)> fuu = [](int value) { return value * 2; };
+    EXPECT_THAT(fuu(21), Eq(42));
+}
@@ -0,0 +1,81 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/cxx/payload_copy.hpp"
+#include "test.hpp"
+
+#include <cstring>
+#include <vector>
+
+using namespace ::testing;
+using iox::cxx::copyPayload;
+using iox::cxx::PAYLOAD_COPY_STREAMING_THRESHOLD;
+
+namespace
+{
+std::vector<uint8_t> patternBuffer(const uint64_t f_size)
+{
+    std::vector<uint8_t> l_buffer(f_size);
+    for (uint64_t i = 0u; i < f_size; ++i)
+    {
+        l_buffer[i] = static_cast<uint8_t>(i * 31u + 7u);
+    }
+    return l_buffer;
+}
+} // namespace
+
+TEST(payload_copy_test, SmallPayloadIsCopiedByteExact)
+{
+    auto l_source = patternBuffer(333u);
+    std::vector<uint8_t> l_destination(l_source.size(), 0u);
+
+    copyPayload(l_destination.data(), l_source.data(), l_source.size());
+
+    EXPECT_THAT(memcmp(l_destination.data(), l_source.data(), l_source.size()), Eq(0));
+}
+
+TEST(payload_copy_test, ZeroSizeLeavesDestinationUntouched)
+{
+    uint8_t l_destination{0xAAu};
+    uint8_t l_source{0x55u};
+
+    copyPayload(&l_destination, &l_source, 0u);
+
+    EXPECT_THAT(l_destination, Eq(0xAAu));
+}
+
+TEST(payload_copy_test, PayloadAboveStreamingThresholdIsCopiedByteExact)
+{
+    // an odd size above the threshold exercises the streaming blocks and the
+    // head and tail handling around them
+    auto l_source = patternBuffer(PAYLOAD_COPY_STREAMING_THRESHOLD + 77u);
+    std::vector<uint8_t> l_destination(l_source.size(), 0u);
+
+    copyPayload(l_destination.data(), l_source.data(), l_source.size());
+
+    EXPECT_THAT(memcmp(l_destination.data(), l_source.data(), l_source.size()), Eq(0));
+}
+
+TEST(payload_copy_test, UnalignedDestinationIsCopiedByteExact)
+{
+    auto l_source = patternBuffer(PAYLOAD_COPY_STREAMING_THRESHOLD + 64u);
+    std::vector<uint8_t> l_destination(l_source.size() + 16u, 0u);
+
+    for (uint64_t offset = 1u; offset < 16u; ++offset)
+    {
+        memset(l_destination.data(), 0, l_destination.size());
+        copyPayload(l_destination.data() + offset, l_source.data(), l_source.size());
+        EXPECT_THAT(memcmp(l_destination.data() + offset, l_source.data(), l_source.size()), Eq(0));
+    }
+}
@@ -203,3 +203,84 @@ TEST_F(PoorMansHeap_test, instanceAccess)
     EXPECT_THAT(m_sut->identity(), Eq(Identity::Bar));
     EXPECT_THAT((*m_sut).identity(), Eq(Identity::Bar));
 }
+
+namespace
+{
+struct LuckyNumberVisitor
+{
+    LuckyNumberVisitor(LuckyNumber& result)
+        : m_result(result)
+    {
+    }
+
+    void operator()(Bar& bar) const
+    {
+        m_result = bar.luckyNumber();
+    }
+
+    void operator()(Foo& foo) const
+    {
+        m_result = foo.luckyNumber();
+    }
+
+    LuckyNumber& m_result;
+};
+} // namespace
+
+class PoorMansHeapVariant_test : public Test
+{
+  public:
+    using SUT = iox::cxx::PoorMansHeapVariant<Interface, Bar, Foo>;
+
+    SUT m_sut;
+};
+
+TEST_F(PoorMansHeapVariant_test, StorageIsDeducedFromTheCandidateList)
+{
+    EXPECT_THAT(alignof(SUT), Eq(iox::cxx::maxAlignment<Bar, Foo>()));
+    EXPECT_THAT(sizeof(SUT), Ge(iox::cxx::maxSize<Bar, Foo>()));
+}
+
+TEST_F(PoorMansHeapVariant_test, CTor_default)
+{
+    EXPECT_THAT(m_sut.hasInstance(), Eq(false));
+}
+
+TEST_F(PoorMansHeapVariant_test, InterfaceAccessStillWorks)
+{
+    m_sut.newInstance<Bar>(LuckyNumber::Bar);
+    ASSERT_THAT(m_sut.hasInstance(), Eq(true));
+    EXPECT_THAT(m_sut->identity(), Eq(Identity::Bar));
+    EXPECT_THAT(m_sut->luckyNumber(), Eq(LuckyNumber::Bar));
+}
+
+TEST_F(PoorMansHeapVariant_test, VisitDispatchesToTheConcreteType)
+{
+    LuckyNumber result{LuckyNumber::None};
+
+    m_sut.newInstance<Bar>(LuckyNumber::Bar);
+    m_sut.visit(LuckyNumberVisitor(result));
+    EXPECT_THAT(result, Eq(LuckyNumber::Bar));
+
+    m_sut.newInstance<Foo>();
+    m_sut.visit(LuckyNumberVisitor(result));
+    EXPECT_THAT(result, Eq(LuckyNumber::Foo));
+}
+
+TEST_F(PoorMansHeapVariant_test, VisitWithoutInstanceDoesNothing)
+{
+    LuckyNumber result{LuckyNumber::None};
+    m_sut.visit(LuckyNumberVisitor(result));
+    EXPECT_THAT(result, Eq(LuckyNumber::None));
+}
+
+TEST_F(PoorMansHeapVariant_test, DeleteInstanceCallsTheDestructor)
+{
+    m_sut.newInstance<Foo>();
+    g_destructionIdentities.clear();
+    m_sut.deleteInstance();
+
+    ASSERT_THAT(g_destructionIdentities.size(), Eq(1u));
+    EXPECT_THAT(g_destructionIdentities[0], Eq(Identity::Foo));
+    EXPECT_THAT(m_sut.hasInstance(), Eq(false));
+}
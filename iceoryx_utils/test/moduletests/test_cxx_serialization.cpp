@@ -146,3 +146,52 @@ TEST_F(Serialization_test, SerializeSerializableClass)
     auto serial = iox::cxx::Serialization::create(obj, "asd");
     EXPECT_THAT(serial.toString(), Eq("7:5:asdgg3:asd"));
 }
+
+TEST_F(Serialization_test, BinaryCreateAndExtractPods)
+{
+    uint8_t buffer[128];
+    uint64_t writtenSize{0};
+    EXPECT_TRUE(iox::cxx::BinarySerialization::create(buffer, sizeof(buffer), writtenSize, 123, 12.12f, 'c'));
+    EXPECT_THAT(writtenSize, Eq(sizeof(int) + sizeof(float) + sizeof(char)));
+
+    int v1{0};
+    float v2{0.0f};
+    char v3{0};
+    EXPECT_TRUE(iox::cxx::BinarySerialization::extract(buffer, writtenSize, v1, v2, v3));
+    EXPECT_THAT(v1, Eq(123));
+    EXPECT_THAT(v2, Eq(12.12f));
+    EXPECT_THAT(v3, Eq('c'));
+}
+
+TEST_F(Serialization_test, BinaryCreateAndExtractStrings)
+{
+    uint8_t buffer[128];
+    uint64_t writtenSize{0};
+    std::string fuu("fuu");
+    EXPECT_TRUE(iox::cxx::BinarySerialization::create(buffer, sizeof(buffer), writtenSize, fuu, 42));
+
+    std::string v1;
+    int v2{0};
+    EXPECT_TRUE(iox::cxx::BinarySerialization::extract(buffer, writtenSize, v1, v2));
+    EXPECT_THAT(v1, Eq("fuu"));
+    EXPECT_THAT(v2, Eq(42));
+}
+
+TEST_F(Serialization_test, BinaryCreateFailsWhenBufferTooSmall)
+{
+    uint8_t buffer[4];
+    uint64_t writtenSize{73};
+    EXPECT_FALSE(iox::cxx::BinarySerialization::create(buffer, sizeof(buffer), writtenSize, 123, 456));
+    EXPECT_THAT(writtenSize, Eq(0u));
+}
+
+TEST_F(Serialization_test, BinaryExtractFailsOnTruncatedBuffer)
+{
+    uint8_t buffer[128];
+    uint64_t writtenSize{0};
+    EXPECT_TRUE(iox::cxx::BinarySerialization::create(buffer, sizeof(buffer), writtenSize, std::string("fuu"), 42));
+
+    std::string v1;
+    int v2{0};
+    EXPECT_FALSE(iox::cxx::BinarySerialization::extract(buffer, writtenSize - 1, v1, v2));
+}
@@ -648,4 +648,99 @@ TEST(String100, UnsafeCharToStringConvConstrIncludingNullCharWithCountResultsInS
     EXPECT_THAT(testSubject.capacity(), Eq(100));
     EXPECT_THAT(testSubject.size(), Eq(4));
     EXPECT_THAT(testSubject.c_str(), StrEq("abc"));
-}
\ No newline at end of file
+}
+TEST(String100, CompareEqualStringsLongerThanOneSimdLane)
+{
+    string<100> testSubject1("All those moments will be lost in time");
+    string<100> testSubject2("All those moments will be lost in time");
+    EXPECT_THAT(testSubject1 == testSubject2, Eq(true));
+    EXPECT_THAT(testSubject1 != testSubject2, Eq(false));
+}
+
+TEST(String100, CompareStringsDifferingInTheLastCharacter)
+{
+    string<100> testSubject1("All those moments will be lost in time");
+    string<100> testSubject2("All those moments will be lost in timE");
+    EXPECT_THAT(testSubject1 == testSubject2, Eq(false));
+    EXPECT_THAT(testSubject1 != testSubject2, Eq(true));
+}
+
+TEST(String100, CompareStringsOfDifferentSize)
+{
+    string<100> testSubject1("Kirk");
+    string<100> testSubject2("Kirk ");
+    EXPECT_THAT(testSubject1 == testSubject2, Eq(false));
+}
+
+TEST(String100, CompareStringsWithEmbeddedNullCharacters)
+{
+    string<100> testSubject1(UnsafeCheckPreconditions, "abc\0def", 7);
+    string<100> testSubject2(UnsafeCheckPreconditions, "abc\0dXf", 7);
+    EXPECT_THAT(testSubject1 == testSubject2, Eq(false));
+}
+
+TEST(String100, FindFirstOfReturnsPositionOfFirstOccurrence)
+{
+    string<100> testSubject("All those moments will be lost in time");
+    EXPECT_THAT(testSubject.find_first_of('t'), Eq(4));
+    EXPECT_THAT(testSubject.find_first_of('t', 5), Eq(15));
+    EXPECT_THAT(testSubject.find_first_of('A'), Eq(0));
+}
+
+TEST(String100, FindFirstOfReturnsSizeIfNotFound)
+{
+    string<100> testSubject("Picard");
+    EXPECT_THAT(testSubject.find_first_of('x'), Eq(testSubject.size()));
+    EXPECT_THAT(testSubject.find_first_of('P', 1), Eq(testSubject.size()));
+}
+
+TEST(String100, HashOfEqualStringsIsEqual)
+{
+    string<100> testSubject1("Data");
+    string<100> testSubject2("Data");
+    EXPECT_THAT(testSubject1.hash(), Eq(testSubject2.hash()));
+}
+
+TEST(String100, HashOfDifferentStringsDiffers)
+{
+    string<100> testSubject1("Data");
+    string<100> testSubject2("Lore");
+    EXPECT_THAT(testSubject1.hash(), Ne(testSubject2.hash()));
+}
+
+TEST(String100, HashMatchesCompileTimeLiteralHash)
+{
+    // the literal hash is evaluated by the compiler and can be used in
+    // constant expressions
+    static_assert(iox::cxx::internal::hash("Data") != iox::cxx::internal::hash("Lore"),
+                  "compile time hashes of different literals must differ");
+
+    string<100> testSubject("Data");
+    EXPECT_THAT(testSubject.hash(), Eq(iox::cxx::internal::hash("Data")));
+}
+
+TEST(String100, HashOfLiteralMatchesHashOfConstructedString)
+{
+    constexpr uint64_t literalHash = string<100>::hashOf("Data");
+
+    string<100> testSubject("Data");
+    EXPECT_THAT(testSubject.hash(), Eq(literalHash));
+}
+
+TEST(String100, CompileTimeComparisonOfLiterals)
+{
+    static_assert(iox::cxx::internal::isEqual("Data", "Data"), "equal literals must compare equal at compile time");
+    static_assert(!iox::cxx::internal::isEqual("Data", "Lore"),
+                  "different literals must compare unequal at compile time");
+    static_assert(iox::cxx::internal::compare("Data", "Lore") < 0,
+                  "literals must compare lexicographically at compile time");
+    static_assert(iox::cxx::internal::compare("Data", "Dat") > 0,
+                  "a literal must compare greater than its prefix at compile time");
+}
+
+TEST(String100, CapacityIsACompileTimeConstant)
+{
+    constexpr string<100> emptyString;
+    static_assert(emptyString.capacity() == 100u, "the capacity must be usable in constant expressions");
+    static_assert(emptyString.size() == 0u, "a default constructed string must be empty");
+}
@@ -899,3 +899,87 @@ TEST_F(vector_test, ConstructorWithSizeParameterGreaterThanCapacity)
     EXPECT_THAT(vector_test::copyCTor, Eq(5));
     ASSERT_THAT(sut.size(), Eq(5));
 }
+
+TEST_F(vector_test, ResizeGrowsWithDefaultConstructedElements)
+{
+    sut.emplace_back(42);
+
+    EXPECT_THAT(sut.resize(4), Eq(true));
+
+    ASSERT_THAT(sut.size(), Eq(4));
+    EXPECT_THAT(sut.at(0), Eq(42));
+    EXPECT_THAT(sut.at(1), Eq(0));
+    EXPECT_THAT(sut.at(2), Eq(0));
+    EXPECT_THAT(sut.at(3), Eq(0));
+}
+
+TEST_F(vector_test, ResizeShrinksAndDestructsSurplusElements)
+{
+    vector<CTorTest, 10> sut;
+    for (int i = 0; i < 5; ++i)
+    {
+        sut.emplace_back(i);
+    }
+    dTor = 0;
+
+    EXPECT_THAT(sut.resize(2), Eq(true));
+
+    EXPECT_THAT(sut.size(), Eq(2));
+    EXPECT_THAT(dTor, Eq(3));
+}
+
+TEST_F(vector_test, ResizeFailsWhenExceedingCapacity)
+{
+    EXPECT_THAT(sut.resize(sut.capacity() + 1), Eq(false));
+    EXPECT_THAT(sut.size(), Eq(0));
+}
+
+// the trivially copyable fast paths must behave exactly like the element-wise
+// implementation used for types with non-trivial constructors
+TEST_F(vector_test, TriviallyCopyableCopyAssignment)
+{
+    vector<int, 10> source;
+    for (int i = 0; i < 7; ++i)
+    {
+        source.emplace_back(i);
+    }
+    sut.emplace_back(73);
+
+    sut = source;
+
+    ASSERT_THAT(sut.size(), Eq(7));
+    for (int i = 0; i < 7; ++i)
+    {
+        EXPECT_THAT(sut.at(i), Eq(i));
+    }
+}
+
+TEST_F(vector_test, TriviallyCopyableMoveAssignmentEmptiesOrigin)
+{
+    vector<int, 10> source;
+    source.emplace_back(37);
+    source.emplace_back(73);
+
+    sut = std::move(source);
+
+    ASSERT_THAT(sut.size(), Eq(2));
+    EXPECT_THAT(sut.at(0), Eq(37));
+    EXPECT_THAT(sut.at(1), Eq(73));
+    EXPECT_THAT(source.empty(), Eq(true));
+}
+
+TEST_F(vector_test, TriviallyCopyableEraseClosesTheGap)
+{
+    for (int i = 0; i < 5; ++i)
+    {
+        sut.emplace_back(i);
+    }
+
+    sut.erase(sut.begin() + 1);
+
+    ASSERT_THAT(sut.size(), Eq(4));
+    EXPECT_THAT(sut.at(0), Eq(0));
+    EXPECT_THAT(sut.at(1), Eq(2));
+    EXPECT_THAT(sut.at(2), Eq(3));
+    EXPECT_THAT(sut.at(3), Eq(4));
+}
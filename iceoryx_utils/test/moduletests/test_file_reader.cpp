@@ -132,3 +132,57 @@ TEST_F(FileReader_test, errorTerminateMode)
         },
         ".*");
 }
+
+TEST_F(FileReader_test, mapFile)
+{
+    iox::cxx::FileReader reader(TestFileName);
+    ASSERT_TRUE(reader.MapFile());
+
+    iox::cxx::FileView content = reader.Content();
+    EXPECT_FALSE(content.empty());
+    EXPECT_EQ(content.to_string(), std::string(TestFileContent));
+}
+
+TEST_F(FileReader_test, mapNonExistingFile)
+{
+    iox::cxx::FileReader reader("a_file_that_wasn't_there.txt", "", iox::cxx::FileReader::ErrorMode::Ignore);
+    EXPECT_FALSE(reader.MapFile());
+}
+
+TEST_F(FileReader_test, readLineViews)
+{
+    iox::cxx::FileReader reader(TestFileName);
+    ASSERT_TRUE(reader.MapFile());
+
+    iox::cxx::FileView line;
+
+    ASSERT_TRUE(reader.ReadLineView(line));
+    EXPECT_EQ(line.to_string(), "This is a test file.");
+
+    ASSERT_TRUE(reader.ReadLineView(line));
+    EXPECT_EQ(line.to_string(), "It consists of more than one line.");
+
+    ASSERT_TRUE(reader.ReadLineView(line));
+    EXPECT_TRUE(line.empty());
+
+    ASSERT_TRUE(reader.ReadLineView(line));
+    EXPECT_EQ(line.to_string(), "It does even contain empty lines, wow.");
+
+    EXPECT_FALSE(reader.ReadLineView(line));
+}
+
+TEST_F(FileReader_test, mapEmptyFile)
+{
+    const char* emptyFileName = "/tmp/FileReader_empty_test.tmp";
+    std::fstream fs(emptyFileName, std::fstream::out | std::fstream::trunc);
+    fs.close();
+
+    iox::cxx::FileReader reader(emptyFileName);
+    ASSERT_TRUE(reader.MapFile());
+    EXPECT_TRUE(reader.Content().empty());
+
+    iox::cxx::FileView line;
+    EXPECT_FALSE(reader.ReadLineView(line));
+
+    std::remove(emptyFileName);
+}
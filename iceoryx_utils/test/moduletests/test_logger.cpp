@@ -122,6 +122,61 @@ TEST_F(IoxLogger_test, Output)
 }
 
 
+class IoxLoggerAsync_test : public Test, public IoxLogger_testBase
+{
+  public:
+    void SetUp() override
+    {
+        outBuffer.clear();
+        iox::log::Logger::SetAsyncLogMode(true);
+    }
+
+    void TearDown() override
+    {
+        // flushes before switching back so no entry leaks into the next test
+        iox::log::Logger::SetAsyncLogMode(false);
+    }
+};
+
+TEST_F(IoxLoggerAsync_test, AsyncOutputIsWrittenByTheFlusher)
+{
+    iox::log::LogEntry entry;
+    entry.level = iox::log::LogLevel::kError;
+    entry.message = "42";
+
+    m_sut.SetLogLevel(iox::log::LogLevel::kInfo);
+    m_sut.Log(entry);
+    iox::log::Logger::FlushAsyncLog();
+
+    const std::string expected = formatDateTime(entry.time) + " [ Error ]: 42\n";
+    std::string output = std::regex_replace(outBuffer.str(), colorCode, std::string(""));
+
+    EXPECT_THAT(output, Eq(expected));
+}
+
+TEST_F(IoxLoggerAsync_test, AsyncOutputKeepsTheOrderOfOneThread)
+{
+    m_sut.SetLogLevel(iox::log::LogLevel::kInfo);
+    for (uint32_t i = 0u; i < 3u; ++i)
+    {
+        iox::log::LogEntry entry;
+        entry.level = iox::log::LogLevel::kInfo;
+        entry.message = "sample" + std::to_string(i);
+        m_sut.Log(entry);
+    }
+    iox::log::Logger::FlushAsyncLog();
+
+    std::string output = outBuffer.str();
+    auto first = output.find("sample0");
+    auto second = output.find("sample1");
+    auto third = output.find("sample2");
+    ASSERT_THAT(first, Ne(std::string::npos));
+    ASSERT_THAT(second, Ne(std::string::npos));
+    ASSERT_THAT(third, Ne(std::string::npos));
+    EXPECT_THAT(first, Lt(second));
+    EXPECT_THAT(second, Lt(third));
+}
+
 class IoxLoggerLogLevel_test : public TestWithParam<iox::log::LogLevel>, public IoxLogger_testBase
 {
   public:
@@ -46,6 +46,15 @@ TEST_F(IoxLogStream_test, CTor_WithLogLevel)
     EXPECT_THAT(loggerMock.m_logs[0].level, Eq(iox::log::LogLevel::kOff));
 }
 
+TEST_F(IoxLogStream_test, FilteredOutLogStreamNeverReachesTheLogger)
+{
+    loggerMock.SetLogLevel(iox::log::LogLevel::kWarn);
+
+    iox::log::LogStream(loggerMock, iox::log::LogLevel::kDebug) << "this is never formatted " << 42;
+
+    EXPECT_THAT(loggerMock.m_logs.size(), Eq(0u));
+}
+
 TEST_F(IoxLogStream_test, UnnamedTemporaryLogStreamObject)
 {
     const std::string claim = "The answer is ";
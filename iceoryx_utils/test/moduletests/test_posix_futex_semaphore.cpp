@@ -0,0 +1,110 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/posix_wrapper/futex_semaphore.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+
+using namespace ::testing;
+
+class FutexSemaphore_test : public Test
+{
+  public:
+    void SetUp()
+    {
+    }
+    virtual void TearDown()
+    {
+    }
+
+    iox::posix::FutexSemaphore m_sut;
+};
+
+TEST_F(FutexSemaphore_test, InitialValueIsVisibleInGetValue)
+{
+    iox::posix::FutexSemaphore sut(3u);
+    int value{0};
+    EXPECT_THAT(sut.getValue(value), Eq(true));
+    EXPECT_THAT(value, Eq(3));
+}
+
+TEST_F(FutexSemaphore_test, TryWaitOnEmptySemaphore)
+{
+    EXPECT_THAT(m_sut.tryWait(), Eq(false));
+}
+
+TEST_F(FutexSemaphore_test, PostIsCounting)
+{
+    m_sut.post();
+    m_sut.post();
+    EXPECT_THAT(m_sut.tryWait(), Eq(true));
+    EXPECT_THAT(m_sut.tryWait(), Eq(true));
+    EXPECT_THAT(m_sut.tryWait(), Eq(false));
+}
+
+TEST_F(FutexSemaphore_test, WaitDoesNotBlockWithPendingPost)
+{
+    m_sut.post();
+    EXPECT_THAT(m_sut.wait(), Eq(true));
+    int value{-1};
+    m_sut.getValue(value);
+    EXPECT_THAT(value, Eq(0));
+}
+
+TEST_F(FutexSemaphore_test, TimedWaitReturnsFalseOnExpiredTimeout)
+{
+    struct timespec past;
+    clock_gettime(CLOCK_REALTIME, &past);
+    past.tv_sec -= 1;
+    EXPECT_THAT(m_sut.timedWait(&past), Eq(false));
+}
+
+TEST_F(FutexSemaphore_test, TimedWaitConsumesPendingPostRegardlessOfTimeout)
+{
+    m_sut.post();
+    struct timespec past;
+    clock_gettime(CLOCK_REALTIME, &past);
+    past.tv_sec -= 1;
+    EXPECT_THAT(m_sut.timedWait(&past), Eq(true));
+}
+
+TEST_F(FutexSemaphore_test, DISABLED_PostWakesABlockedWaiter_PERFORMANCETEST42)
+{
+    std::atomic<bool> hasWokenUp{false};
+    std::thread waiter([&] {
+        m_sut.wait();
+        hasWokenUp = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_THAT(hasWokenUp.load(), Eq(false));
+    m_sut.post();
+    waiter.join();
+    EXPECT_THAT(hasWokenUp.load(), Eq(true));
+}
+
+TEST_F(FutexSemaphore_test, DISABLED_TimedWaitTimesOutWithoutPost_PERFORMANCETEST42)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_nsec += 50000000;
+    if (deadline.tv_nsec >= 1000000000)
+    {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= 1000000000;
+    }
+    EXPECT_THAT(m_sut.timedWait(&deadline), Eq(false));
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/posix_wrapper/futex_signal.hpp"
+#include "test.hpp"
+
+#include <thread>
+
+using namespace ::testing;
+
+class FutexSignal_test : public Test
+{
+  public:
+    void SetUp()
+    {
+    }
+    virtual void TearDown()
+    {
+    }
+
+    iox::posix::FutexSignal m_sut;
+};
+
+TEST_F(FutexSignal_test, TryWaitOnEmptySignal)
+{
+    EXPECT_THAT(m_sut.tryWait(), Eq(false));
+}
+
+TEST_F(FutexSignal_test, TryWaitConsumesOnePost)
+{
+    m_sut.post();
+    EXPECT_THAT(m_sut.tryWait(), Eq(true));
+    EXPECT_THAT(m_sut.tryWait(), Eq(false));
+}
+
+TEST_F(FutexSignal_test, PostIsCounting)
+{
+    m_sut.post();
+    m_sut.post();
+    m_sut.post();
+    EXPECT_THAT(m_sut.tryWait(), Eq(true));
+    EXPECT_THAT(m_sut.tryWait(), Eq(true));
+    EXPECT_THAT(m_sut.tryWait(), Eq(true));
+    EXPECT_THAT(m_sut.tryWait(), Eq(false));
+}
+
+TEST_F(FutexSignal_test, WaitDoesNotBlockWithPendingPost)
+{
+    m_sut.post();
+    EXPECT_THAT(m_sut.wait(), Eq(true));
+    EXPECT_THAT(m_sut.tryWait(), Eq(false));
+}
+
+TEST_F(FutexSignal_test, TimedWaitDoesNotBlockWithPendingPost)
+{
+    m_sut.post();
+    EXPECT_THAT(m_sut.timedWait(1000u), Eq(true));
+    EXPECT_THAT(m_sut.tryWait(), Eq(false));
+}
+
+TEST_F(FutexSignal_test, TimedWaitReturnsFalseOnTimeout)
+{
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_THAT(m_sut.timedWait(50u), Eq(false));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_THAT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(), Ge(50));
+}
+
+TEST_F(FutexSignal_test, PostWakesBlockedTimedWaiter)
+{
+    std::atomic_bool woken{false};
+    std::thread waiter([&] {
+        EXPECT_THAT(m_sut.timedWait(10000u), Eq(true));
+        woken = true;
+    });
+
+    // give the waiter a chance to park before posting
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_THAT(woken.load(), Eq(false));
+
+    m_sut.post();
+    waiter.join();
+    EXPECT_THAT(woken.load(), Eq(true));
+}
+
+TEST_F(FutexSignal_test, PostWakesBlockedWaiter)
+{
+    std::atomic_bool woken{false};
+    std::thread waiter([&] {
+        m_sut.wait();
+        woken = true;
+    });
+
+    // give the waiter a chance to park before posting
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_THAT(woken.load(), Eq(false));
+
+    m_sut.post();
+    waiter.join();
+    EXPECT_THAT(woken.load(), Eq(true));
+}
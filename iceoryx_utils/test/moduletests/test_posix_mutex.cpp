@@ -16,6 +16,8 @@
 #include "iceoryx_utils/posix_wrapper/timer.hpp"
 #include "test.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <thread>
 
 using namespace ::testing;
@@ -28,7 +30,7 @@ class Mutex_test : public Test
     {
       public:
         MutexMock(const bool isRecursive)
-            : iox::posix::mutex(isRecursive)
+            : iox::posix::mutex(isRecursive, 0u)
         {
         }
 
@@ -117,3 +119,33 @@ TEST_F(Mutex_test, DestructorFailsOnLockedMutex)
 
     internal::CaptureStderr();
 }
+
+TEST_F(Mutex_test, AdaptiveSpinLockAndUnlock)
+{
+    auto spinningSut = iox::posix::mutex::CreateMutex(false, 100u);
+    ASSERT_THAT(spinningSut.has_value(), Eq(true));
+
+    EXPECT_THAT(spinningSut->lock(), Eq(true));
+    EXPECT_THAT(spinningSut->unlock(), Eq(true));
+}
+
+TEST_F(Mutex_test, AdaptiveSpinAcquiresContendedMutex)
+{
+    auto spinningSut = iox::posix::mutex::CreateMutex(false, 100u);
+    ASSERT_THAT(spinningSut.has_value(), Eq(true));
+
+    spinningSut->lock();
+    std::atomic_bool acquired{false};
+    std::thread waiter([&] {
+        // the spin phase is exhausted here and the lock falls back to parking
+        spinningSut->lock();
+        acquired.store(true);
+        spinningSut->unlock();
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_THAT(acquired.load(), Eq(false));
+    spinningSut->unlock();
+    waiter.join();
+    EXPECT_THAT(acquired.load(), Eq(true));
+}
@@ -0,0 +1,87 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/posix_wrapper/thread_attributes.hpp"
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+
+using namespace ::testing;
+using namespace iox::posix;
+
+class ThreadAttributes_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        m_run = true;
+        m_thread = std::thread([&] {
+            while (m_run.load())
+            {
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    void TearDown() override
+    {
+        m_run = false;
+        m_thread.join();
+    }
+
+    std::atomic<bool> m_run{true};
+    std::thread m_thread;
+};
+
+TEST_F(ThreadAttributes_test, DefaultAttributesAreANoOp)
+{
+    ThreadAttributes attributes;
+    EXPECT_THAT(applyThreadAttributes(m_thread.native_handle(), attributes), Eq(true));
+}
+
+TEST_F(ThreadAttributes_test, NameIsApplied)
+{
+    ThreadAttributes attributes;
+    attributes.m_name = "iox-test-thread";
+    ASSERT_THAT(applyThreadAttributes(m_thread.native_handle(), attributes), Eq(true));
+
+    char name[16];
+    ASSERT_THAT(pthread_getname_np(m_thread.native_handle(), name, sizeof(name)), Eq(0));
+    EXPECT_THAT(std::string(name), Eq("iox-test-thread"));
+}
+
+TEST_F(ThreadAttributes_test, OverlongNameIsTruncated)
+{
+    ThreadAttributes attributes;
+    attributes.m_name = "a-name-which-is-far-too-long";
+    ASSERT_THAT(applyThreadAttributes(m_thread.native_handle(), attributes), Eq(true));
+
+    char name[16];
+    ASSERT_THAT(pthread_getname_np(m_thread.native_handle(), name, sizeof(name)), Eq(0));
+    EXPECT_THAT(std::string(name), Eq("a-name-which-is"));
+}
+
+TEST_F(ThreadAttributes_test, AffinityMaskIsApplied)
+{
+    ThreadAttributes attributes;
+    attributes.m_affinityMask = 0x1u; // CPU 0 only
+    ASSERT_THAT(applyThreadAttributes(m_thread.native_handle(), attributes), Eq(true));
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    ASSERT_THAT(pthread_getaffinity_np(m_thread.native_handle(), sizeof(cpuSet), &cpuSet), Eq(0));
+    EXPECT_THAT(CPU_ISSET(0, &cpuSet), Ne(0));
+    EXPECT_THAT(CPU_COUNT(&cpuSet), Eq(1));
+}
@@ -411,6 +411,32 @@ TYPED_TEST(relativeptrtests, pointerOperator)
     EXPECT_EQ(*rp1, *baseAddr);
 }
 
+TEST_F(RelativePointer_test, searchIdWithCachedIds)
+{
+    void* basePtr1 = reinterpret_cast<void*>(BaseAddress1);
+    MemMap memMap(basePtr1, this->m_fileDescriptor);
+    void* basePtr2 = reinterpret_cast<void*>(BaseAddress2);
+    MemMap memMap1(basePtr2, this->m_fileDescriptor);
+
+    EXPECT_EQ(iox::RelativePointer::registerPtr(1, memMap.getMappedAddress(), ShmSize), true);
+    EXPECT_EQ(iox::RelativePointer::registerPtr(2, memMap1.getMappedAddress(), ShmSize), true);
+
+    void* adr1 = reinterpret_cast<void*>(reinterpret_cast<size_t>(memMap.getMappedAddress()) + ShmSize / 2);
+    void* adr2 = reinterpret_cast<void*>(reinterpret_cast<size_t>(memMap1.getMappedAddress()) + ShmSize / 2);
+
+    // repeated lookups are served from the thread-local cache and must stay correct
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(iox::RelativePointer::searchId(adr1), 1);
+        EXPECT_EQ(iox::RelativePointer::searchId(adr2), 2);
+    }
+
+    // a cached id must not be returned anymore once its segment is unregistered
+    EXPECT_EQ(iox::RelativePointer::unregisterPtr(1), true);
+    EXPECT_NE(iox::RelativePointer::searchId(adr1), 1);
+    EXPECT_EQ(iox::RelativePointer::searchId(adr2), 2);
+}
+
 // central use case of the relative pointer:
 // it is tested that changing the (static) lookup table of a relative pointer causes existing
 // relative pointers point to changed locations relative to the new lookup table
@@ -535,4 +561,36 @@ TEST_F(RelativePointer_test, MemoryReMapping_SharedMemory)
     }
     EXPECT_EQ(iox::RelativePointer::unregisterPtr(1), true);
 }
+
+TEST_F(RelativePointer_test, validatedPtrResolvesOnceAndStaysRaw)
+{
+    MemMap memMap(reinterpret_cast<void*>(BaseAddress1), this->m_fileDescriptor);
+
+    EXPECT_EQ(iox::RelativePointer::registerPtr(1, memMap.getMappedAddress()), true);
+
+    int offset = ShmSize / 2;
+    auto addr = reinterpret_cast<int*>(memMap.getMappedAddress() + offset);
+    *addr = 42;
+
+    iox::relative_ptr<int> rp(addr, 1);
+    iox::validated_ptr<int> vp(rp);
+
+    EXPECT_TRUE(static_cast<bool>(vp));
+    EXPECT_EQ(vp.get(), addr);
+    EXPECT_EQ(*vp, 42);
+
+    // the pointer was resolved at construction, a later repository change
+    // does not affect it anymore
+    EXPECT_EQ(iox::RelativePointer::unregisterPtr(1), true);
+    EXPECT_EQ(vp.get(), addr);
+    EXPECT_EQ(*vp, 42);
+}
+
+TEST_F(RelativePointer_test, validatedPtrRejectsNullSentinels)
+{
+    iox::validated_ptr<int> vp(iox::RelativePointer::NULL_POINTER_OFFSET, iox::RelativePointer::NULL_POINTER_ID);
+
+    EXPECT_FALSE(static_cast<bool>(vp));
+    EXPECT_EQ(vp.get(), nullptr);
+}
 } // namespace
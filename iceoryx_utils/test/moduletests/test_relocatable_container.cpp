@@ -0,0 +1,255 @@
+// Copyright (c) 2019 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_utils/internal/relocatable_container/relocatable_flat_map.hpp"
+#include "iceoryx_utils/internal/relocatable_container/relocatable_ring.hpp"
+#include "iceoryx_utils/internal/relocatable_container/relocatable_vector.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace testing;
+using namespace iox;
+
+namespace
+{
+/// counts constructions and destructions so the in-place lifetime management
+/// of the containers can be verified
+class LifetimeProbe
+{
+  public:
+    LifetimeProbe(int value = 0)
+        : m_value(value)
+    {
+        ++s_constructions;
+    }
+    LifetimeProbe(const LifetimeProbe& rhs)
+        : m_value(rhs.m_value)
+    {
+        ++s_constructions;
+    }
+    LifetimeProbe(LifetimeProbe&& rhs)
+        : m_value(rhs.m_value)
+    {
+        ++s_constructions;
+    }
+    LifetimeProbe& operator=(const LifetimeProbe&) = default;
+    LifetimeProbe& operator=(LifetimeProbe&&) = default;
+    ~LifetimeProbe()
+    {
+        ++s_destructions;
+    }
+
+    int m_value{0};
+    static int s_constructions;
+    static int s_destructions;
+};
+
+int LifetimeProbe::s_constructions{0};
+int LifetimeProbe::s_destructions{0};
+} // namespace
+
+class RelocatableContainer_test : public Test
+{
+  public:
+    void SetUp()
+    {
+        LifetimeProbe::s_constructions = 0;
+        LifetimeProbe::s_destructions = 0;
+    }
+
+    void TearDown()
+    {
+    }
+
+    static constexpr uint64_t CAPACITY{4u};
+    alignas(8) uint8_t m_storage[1024];
+};
+
+constexpr uint64_t RelocatableContainer_test::CAPACITY;
+
+TEST_F(RelocatableContainer_test, VectorPushPopAndIndexing)
+{
+    RelocatableVector<int> sut;
+    sut.init(m_storage, CAPACITY);
+
+    EXPECT_TRUE(sut.empty());
+    EXPECT_THAT(sut.capacity(), Eq(CAPACITY));
+
+    for (uint64_t k = 0u; k < CAPACITY; ++k)
+    {
+        EXPECT_TRUE(sut.emplace_back(static_cast<int>(k)));
+    }
+    EXPECT_FALSE(sut.push_back(42));
+    EXPECT_THAT(sut.size(), Eq(CAPACITY));
+
+    for (uint64_t k = 0u; k < CAPACITY; ++k)
+    {
+        EXPECT_THAT(sut[k], Eq(static_cast<int>(k)));
+    }
+
+    sut.pop_back();
+    EXPECT_THAT(sut.size(), Eq(CAPACITY - 1u));
+}
+
+TEST_F(RelocatableContainer_test, VectorEraseKeepsElementsContiguous)
+{
+    RelocatableVector<int> sut;
+    sut.init(m_storage, CAPACITY);
+
+    for (int k = 0; k < 4; ++k)
+    {
+        sut.push_back(k);
+    }
+    sut.erase(sut.begin() + 1);
+
+    ASSERT_THAT(sut.size(), Eq(3u));
+    EXPECT_THAT(sut[0], Eq(0));
+    EXPECT_THAT(sut[1], Eq(2));
+    EXPECT_THAT(sut[2], Eq(3));
+}
+
+TEST_F(RelocatableContainer_test, VectorConstructsAndDestructsInPlace)
+{
+    {
+        RelocatableVector<LifetimeProbe> sut;
+        sut.init(m_storage, CAPACITY);
+        sut.emplace_back(13);
+        sut.emplace_back(37);
+        EXPECT_THAT(LifetimeProbe::s_constructions, Eq(2));
+        sut.clear();
+        EXPECT_THAT(LifetimeProbe::s_destructions, Eq(2));
+        sut.emplace_back(42);
+    }
+    // the destructor of the vector destructs the remaining element
+    EXPECT_THAT(LifetimeProbe::s_constructions, Eq(3));
+    EXPECT_THAT(LifetimeProbe::s_destructions, Eq(3));
+}
+
+TEST_F(RelocatableContainer_test, RingWrapsAroundInOrder)
+{
+    RelocatableRing<int> sut;
+    sut.init(m_storage, CAPACITY);
+
+    for (int k = 0; k < 100; ++k)
+    {
+        EXPECT_TRUE(sut.push(k));
+        auto result = sut.pop();
+        ASSERT_TRUE(result.has_value());
+        EXPECT_THAT(result.value(), Eq(k));
+    }
+    EXPECT_TRUE(sut.empty());
+}
+
+TEST_F(RelocatableContainer_test, RingRejectsPushWhenFull)
+{
+    RelocatableRing<int> sut;
+    sut.init(m_storage, CAPACITY);
+
+    for (uint64_t k = 0u; k < CAPACITY; ++k)
+    {
+        EXPECT_TRUE(sut.push(static_cast<int>(k)));
+    }
+    EXPECT_TRUE(sut.full());
+    EXPECT_FALSE(sut.push(42));
+
+    ASSERT_THAT(sut.front(), Ne(nullptr));
+    EXPECT_THAT(*sut.front(), Eq(0));
+}
+
+TEST_F(RelocatableContainer_test, RingDestructsPoppedAndRemainingElements)
+{
+    {
+        RelocatableRing<LifetimeProbe> sut;
+        sut.init(m_storage, CAPACITY);
+        sut.emplace(1);
+        sut.emplace(2);
+        sut.emplace(3);
+        sut.pop();
+    }
+    EXPECT_THAT(LifetimeProbe::s_constructions, Eq(LifetimeProbe::s_destructions));
+}
+
+TEST_F(RelocatableContainer_test, FlatMapFindsInsertedValues)
+{
+    RelocatableFlatMap<uint64_t, int> sut;
+    sut.init(m_storage, CAPACITY);
+
+    // inserted unsorted, looked up via binary search over the sorted keys
+    EXPECT_THAT(sut.emplace(30u, 300), Ne(nullptr));
+    EXPECT_THAT(sut.emplace(10u, 100), Ne(nullptr));
+    EXPECT_THAT(sut.emplace(20u, 200), Ne(nullptr));
+
+    ASSERT_THAT(sut.find(10u), Ne(nullptr));
+    EXPECT_THAT(*sut.find(10u), Eq(100));
+    ASSERT_THAT(sut.find(20u), Ne(nullptr));
+    EXPECT_THAT(*sut.find(20u), Eq(200));
+    ASSERT_THAT(sut.find(30u), Ne(nullptr));
+    EXPECT_THAT(*sut.find(30u), Eq(300));
+    EXPECT_THAT(sut.find(40u), Eq(nullptr));
+
+    // index based iteration sees the keys in ascending order
+    ASSERT_THAT(sut.size(), Eq(3u));
+    EXPECT_THAT(sut.keyAt(0u), Eq(10u));
+    EXPECT_THAT(sut.keyAt(1u), Eq(20u));
+    EXPECT_THAT(sut.keyAt(2u), Eq(30u));
+    EXPECT_THAT(sut.valueAt(1u), Eq(200));
+}
+
+TEST_F(RelocatableContainer_test, FlatMapRejectsDuplicateKeysAndOverflow)
+{
+    RelocatableFlatMap<uint64_t, int> sut;
+    sut.init(m_storage, 2u);
+
+    EXPECT_THAT(sut.emplace(1u, 11), Ne(nullptr));
+    EXPECT_THAT(sut.emplace(1u, 12), Eq(nullptr));
+    EXPECT_THAT(sut.emplace(2u, 22), Ne(nullptr));
+    EXPECT_THAT(sut.emplace(3u, 33), Eq(nullptr));
+
+    ASSERT_THAT(sut.find(1u), Ne(nullptr));
+    EXPECT_THAT(*sut.find(1u), Eq(11));
+}
+
+TEST_F(RelocatableContainer_test, FlatMapEraseShiftsTheTail)
+{
+    RelocatableFlatMap<uint64_t, int> sut;
+    sut.init(m_storage, CAPACITY);
+
+    sut.emplace(1u, 11);
+    sut.emplace(2u, 22);
+    sut.emplace(3u, 33);
+
+    EXPECT_TRUE(sut.erase(2u));
+    EXPECT_FALSE(sut.erase(2u));
+
+    ASSERT_THAT(sut.size(), Eq(2u));
+    EXPECT_THAT(sut.find(2u), Eq(nullptr));
+    EXPECT_THAT(sut.keyAt(0u), Eq(1u));
+    EXPECT_THAT(sut.keyAt(1u), Eq(3u));
+    ASSERT_THAT(sut.find(3u), Ne(nullptr));
+    EXPECT_THAT(*sut.find(3u), Eq(33));
+}
+
+TEST_F(RelocatableContainer_test, FlatMapConstructsAndDestructsValuesInPlace)
+{
+    {
+        RelocatableFlatMap<uint64_t, LifetimeProbe> sut;
+        sut.init(m_storage, CAPACITY);
+        sut.emplace(2u, 22);
+        sut.emplace(1u, 11);
+        sut.erase(2u);
+    }
+    EXPECT_THAT(LifetimeProbe::s_constructions, Eq(LifetimeProbe::s_destructions));
+    EXPECT_THAT(LifetimeProbe::s_destructions, Gt(0));
+}
@@ -48,6 +48,31 @@ TEST_F(SharedMemoryObject_Test, CTorOpenNonExistingSharedMemoryObject)
     EXPECT_THAT(sut.has_value(), Eq(false));
 }
 
+TEST_F(SharedMemoryObject_Test, PrefaultSmallSharedMemoryObject)
+{
+    auto sut = iox::posix::SharedMemoryObject::create(
+        "/shmPrefaultSmall", 100, iox::posix::AccessMode::readWrite, iox::posix::OwnerShip::mine, nullptr);
+    ASSERT_THAT(sut.has_value(), Eq(true));
+    sut->prefault();
+}
+
+TEST_F(SharedMemoryObject_Test, PrefaultLargeSharedMemoryObjectUsesWorkerThreads)
+{
+    // large enough to take the multi threaded path when several cores are available
+    auto sut = iox::posix::SharedMemoryObject::create("/shmPrefaultLarge",
+                                                      256 * 1024 * 1024,
+                                                      iox::posix::AccessMode::readWrite,
+                                                      iox::posix::OwnerShip::mine,
+                                                      nullptr);
+    ASSERT_THAT(sut.has_value(), Eq(true));
+    sut->prefault();
+
+    // the memory must be accessible and zeroed afterwards
+    auto memory = static_cast<uint8_t*>(sut->getBaseAddress());
+    EXPECT_THAT(memory[0], Eq(0u));
+    EXPECT_THAT(memory[256 * 1024 * 1024 - 1], Eq(0u));
+}
+
 TEST_F(SharedMemoryObject_Test, AllocateMemoryInSharedMemory)
 {
     auto sut = iox::posix::SharedMemoryObject::create(
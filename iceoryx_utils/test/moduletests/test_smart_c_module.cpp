@@ -163,3 +163,58 @@ TEST_F(smart_c_test, SimpleFunctionWithSuccessfulEINTRRepitition)
         std::cout << output << std::endl;
     }
 }
+
+TEST_F(smart_c_test, LeanFunctionWithErrorCode)
+{
+    auto call = iox::cxx::makeLeanSmartC(SomeFunction, iox::cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {0}, {}, 1, 2, 3);
+    EXPECT_THAT(call.hasErrors(), Eq(false));
+    EXPECT_THAT(call.getReturnValue(), Eq(6));
+    EXPECT_THAT(call.getErrNum(), Eq(0));
+}
+
+TEST_F(smart_c_test, LeanFunctionWithErrorCodeOneError)
+{
+    internal::CaptureStderr();
+    auto call = iox::cxx::makeLeanSmartC(SomeFunction, iox::cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {0}, {}, 1, 0, 3);
+    std::string output = internal::GetCapturedStderr();
+    EXPECT_THAT(output.empty(), Eq(false));
+
+    EXPECT_THAT(call.hasErrors(), Eq(true));
+    EXPECT_THAT(call.getReturnValue(), Eq(0));
+    EXPECT_THAT(call.getErrNum(), Eq(10));
+    std::string errortext = call.getErrorString();
+    EXPECT_THAT(errortext.size(), Ne(0u));
+}
+
+TEST_F(smart_c_test, LeanFunctionWithErrorCodeErrorIgnored)
+{
+    internal::CaptureStderr();
+    auto call =
+        iox::cxx::makeLeanSmartC(SomeFunction, iox::cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {1, -1}, {11}, 1, 1, 1);
+    std::string output = internal::GetCapturedStderr();
+    EXPECT_THAT(output.empty(), Eq(true));
+
+    ASSERT_THAT(call.hasErrors(), Eq(false));
+    EXPECT_THAT(call.getReturnValue(), Eq(1));
+    EXPECT_THAT(call.getErrNum(), Eq(11));
+}
+
+TEST_F(smart_c_test, LeanFunctionWithSuccessCodeOnError)
+{
+    internal::CaptureStderr();
+    auto call = iox::cxx::makeLeanSmartC(SomeFunction, iox::cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {6}, {}, 4, 2, 3);
+    std::string output = internal::GetCapturedStderr();
+    EXPECT_THAT(output.empty(), Eq(false));
+
+    EXPECT_THAT(call.hasErrors(), Eq(true));
+    EXPECT_THAT(call.getReturnValue(), Eq(24));
+    EXPECT_THAT(call.getErrNum(), Eq(34));
+}
+
+TEST_F(smart_c_test, LeanFunctionEINTRRepetition)
+{
+    remainingErrnoCounter = 3;
+    auto call = iox::cxx::makeLeanSmartC(SetErrno, iox::cxx::ReturnMode::PRE_DEFINED_SUCCESS_CODE, {0}, {}, EINTR);
+    EXPECT_THAT(call.hasErrors(), Eq(false));
+    EXPECT_THAT(call.getReturnValue(), Eq(0));
+}
@@ -25,11 +25,11 @@ class CString100_test : public Test
   public:
     void SetUp()
     {
-        internal::CaptureStderr();
+        ::testing::internal::CaptureStderr();
     }
     virtual void TearDown()
     {
-        std::string output = internal::GetCapturedStderr();
+        std::string output = ::testing::internal::GetCapturedStderr();
         if (Test::HasFailure())
         {
             std::cout << output << std::endl;
@@ -53,3 +53,17 @@ TEST_F(CString100_test, ReplaceWithBetterFixedString)
     EXPECT_THAT(strcmp(static_cast<const char*>(a2), "hello world"), Eq(0));
     EXPECT_THAT(a2 == a3, Eq(true));
 }
+
+TEST_F(CString100_test, HashOfEqualStringsIsEqual)
+{
+    CString100 testSubject1("/service/instance/event");
+    CString100 testSubject2("/service/instance/event");
+    EXPECT_THAT(testSubject1.hash(), Eq(testSubject2.hash()));
+}
+
+TEST_F(CString100_test, HashOfDifferentStringsDiffers)
+{
+    CString100 testSubject1("/service/instance/event1");
+    CString100 testSubject2("/service/instance/event2");
+    EXPECT_THAT(testSubject1.hash(), Ne(testSubject2.hash()));
+}
@@ -221,3 +221,18 @@ TEST(Duration_test, constructFromTimeval)
     Duration result(value);
     EXPECT_EQ(result.microSeconds<uint64_t>(), 42 + 1000000 * 1337);
 }
+
+TEST(Duration_test, constexprArithmetic)
+{
+    constexpr Duration interval = 2_s + 500000000_ns;
+    static_assert(interval.nanoSeconds<uint64_t>() == 2500000000ull, "interval math must be a compile time constant");
+    static_assert((2 * interval).milliSeconds<uint64_t>() == 5000ull, "interval math must be a compile time constant");
+
+    constexpr struct timespec ts = (2.5_s).timespec();
+    static_assert(ts.tv_sec == 2, "timespec conversion must be a compile time constant");
+    static_assert(ts.tv_nsec == 500000000, "timespec conversion must be a compile time constant");
+
+    constexpr struct timeval tv = timeval(2.5_s);
+    static_assert(tv.tv_sec == 2, "timeval conversion must be a compile time constant");
+    static_assert(tv.tv_usec == 500000, "timeval conversion must be a compile time constant");
+}
@@ -135,15 +135,18 @@ class IntrospectionApp
     /// @brief Waits till port is subscribed
     bool waitForSubscription(SubscriberType& port);
 
-    /// @brief Prepares the sender port data before printing
+    /// @brief applies a port introspection sample (complete state or delta) to the
+    /// accumulated port state; on a gap in the sequence numbers the state is
+    /// considered stale until the next complete state sample arrives
+    void updatePortState(const PortIntrospectionFieldTopic* portSample);
+
+    /// @brief Prepares the sender port data of the accumulated port state before printing
     std::vector<ComposedSenderPortData>
-    composeSenderPortData(const PortIntrospectionFieldTopic* portData,
-                          const PortThroughputIntrospectionFieldTopic* throughputData);
+    composeSenderPortData(const PortThroughputIntrospectionFieldTopic* throughputData);
 
-    /// @brief Prepares the receiver port data before printing
+    /// @brief Prepares the receiver port data of the accumulated port state before printing
     std::vector<ComposedReceiverPortData>
-    composeReceiverPortData(const PortIntrospectionFieldTopic* portData,
-                            const ReceiverPortChangingIntrospectionFieldTopic* receiverPortChangingData);
+    composeReceiverPortData(const ReceiverPortChangingIntrospectionFieldTopic* receiverPortChangingData);
 
     /// @brief Print the prepared sender and receiver port data
     void printPortIntrospectionData(const std::vector<ComposedSenderPortData>& senderPortData,
@@ -158,6 +161,13 @@ class IntrospectionApp
         return ((input >= min) ? ((input <= max) ? input : max) : min);
     }
 
+    /// @brief accumulated port state, keyed by the unique port IDs; built from
+    /// complete state samples and updated with the delta samples in between
+    std::map<uint64_t, SenderPortData> m_senderPorts;
+    std::map<uint64_t, ReceiverPortData> m_receiverPorts;
+    uint64_t m_portStateSequenceNumber{0};
+    bool m_portStateInSync{false};
+
     /// @brief Update rate of the terminal
     iox::units::Duration updatePeriodMs = DEFAULT_UPDATE_PERIOD;
 
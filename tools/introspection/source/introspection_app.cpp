@@ -513,42 +513,68 @@ bool IntrospectionApp::waitForSubscription(SubscriberType& port)
     return subscribed;
 }
 
+void IntrospectionApp::updatePortState(const PortIntrospectionFieldTopic* portSample)
+{
+    if (portSample->m_completeState)
+    {
+        m_senderPorts.clear();
+        m_receiverPorts.clear();
+    }
+    else if (!m_portStateInSync || (portSample->m_sequenceNumber != m_portStateSequenceNumber + 1))
+    {
+        // a delta sample was missed, the accumulated state is stale until the
+        // next complete state sample arrives
+        m_portStateSequenceNumber = portSample->m_sequenceNumber;
+        m_portStateInSync = false;
+        return;
+    }
+    m_portStateSequenceNumber = portSample->m_sequenceNumber;
+    m_portStateInSync = true;
+
+    for (const auto& sender : portSample->m_senderList)
+    {
+        m_senderPorts[sender.m_senderPortID] = sender;
+    }
+    for (const auto& receiver : portSample->m_receiverList)
+    {
+        m_receiverPorts[receiver.m_receiverPortID] = receiver;
+    }
+    for (const auto& portID : portSample->m_removedSenderPortIDs)
+    {
+        m_senderPorts.erase(portID);
+    }
+    for (const auto& portID : portSample->m_removedReceiverPortIDs)
+    {
+        m_receiverPorts.erase(portID);
+    }
+}
+
 std::vector<ComposedSenderPortData>
-IntrospectionApp::composeSenderPortData(const PortIntrospectionFieldTopic* portData,
-                                        const PortThroughputIntrospectionFieldTopic* throughputData)
+IntrospectionApp::composeSenderPortData(const PortThroughputIntrospectionFieldTopic* throughputData)
 {
     std::vector<ComposedSenderPortData> senderPortData;
-    senderPortData.reserve(portData->m_senderList.size());
+    senderPortData.reserve(m_senderPorts.size());
 
-    const PortThroughputData dummyThroughputData;
+    static const PortThroughputData dummyThroughputData;
 
-    auto& m_senderList = portData->m_senderList;
     auto& m_throughputList = throughputData->m_throughputList;
-    const bool fastLookup = (m_senderList.size() == m_throughputList.size());
-    for (uint64_t i = 0; i < m_senderList.size(); ++i)
+    for (const auto& pair : m_senderPorts)
     {
-        bool found = (fastLookup && m_senderList[i].m_senderPortID == m_throughputList[i].m_senderPortID);
-        if (found)
+        const auto& port = pair.second;
+        bool found = false;
+        for (const auto& throughput : m_throughputList)
         {
-            senderPortData.push_back({m_senderList[i], m_throughputList[i]});
-            continue;
-        }
-        else
-        {
-            for (const auto& throughput : m_throughputList)
-            {
-                if (m_senderList[i].m_senderPortID == throughput.m_senderPortID)
-                {
-                    senderPortData.push_back({m_senderList[i], throughput});
-                    found = true;
-                    break;
-                }
-            }
-            if (!found)
+            if (port.m_senderPortID == throughput.m_senderPortID)
             {
-                senderPortData.push_back({m_senderList[i], dummyThroughputData});
+                senderPortData.push_back({port, throughput});
+                found = true;
+                break;
             }
         }
+        if (!found)
+        {
+            senderPortData.push_back({port, dummyThroughputData});
+        }
     }
 
     auto senderSortCriterion = [](const ComposedSenderPortData& sender1, const ComposedSenderPortData& sender2) {
@@ -562,22 +588,38 @@ IntrospectionApp::composeSenderPortData(const PortIntrospectionFieldTopic* portD
 }
 
 std::vector<ComposedReceiverPortData>
-IntrospectionApp::composeReceiverPortData(const PortIntrospectionFieldTopic* portData,
-                                          const ReceiverPortChangingIntrospectionFieldTopic* receiverPortChangingData)
+IntrospectionApp::composeReceiverPortData(const ReceiverPortChangingIntrospectionFieldTopic* receiverPortChangingData)
 {
     std::vector<ComposedReceiverPortData> receiverPortData;
-    receiverPortData.reserve(portData->m_receiverList.size());
+    receiverPortData.reserve(m_receiverPorts.size());
+
+    static const ReceiverPortChangingData dummyChangingData;
 
-    int i = 0;
-    if (portData->m_receiverList.size() == receiverPortChangingData->receiverPortChangingDataList.size())
-    { // should be the same, else it will be soon
-        for (const auto& port : portData->m_receiverList)
+    for (const auto& pair : m_receiverPorts)
+    {
+        const auto& port = pair.second;
+
+        const SenderPortData* correspondingSender = nullptr;
+        if (port.m_connectedSenderPortID != 0u)
         {
-            receiverPortData.push_back(
-                {port,
-                 (port.m_senderIndex != -1) ? &portData->m_senderList[port.m_senderIndex] : nullptr,
-                 receiverPortChangingData->receiverPortChangingDataList[i++]});
+            auto senderIter = m_senderPorts.find(port.m_connectedSenderPortID);
+            if (senderIter != m_senderPorts.end())
+            {
+                correspondingSender = &senderIter->second;
+            }
         }
+
+        const ReceiverPortChangingData* changingData = &dummyChangingData;
+        for (const auto& changing : receiverPortChangingData->receiverPortChangingDataList)
+        {
+            if (changing.receiverPortID != 0u && changing.receiverPortID == port.m_receiverPortID)
+            {
+                changingData = &changing;
+                break;
+            }
+        }
+
+        receiverPortData.push_back({port, correspondingSender, *changingData});
     }
 
     auto receiverSortCriterion = [](const ComposedReceiverPortData& receiver1,
@@ -637,7 +679,9 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriodM
 
     if (introspectionSelection.port == true)
     {
-        portSubscriber.subscribe(1);
+        // the port topic consists of complete state and delta samples; queue some of
+        // them so no delta is lost between two terminal updates
+        portSubscriber.subscribe(16);
         portThroughputSubscriber.subscribe(1);
         receiverPortChangingDataSubscriber.subscribe(1);
 
@@ -664,7 +708,6 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriodM
     const ProcessIntrospectionFieldTopic* typedProcessSample{nullptr};
 
     const void* rawPortSample{nullptr};
-    const PortIntrospectionFieldTopic* typedPortSample{nullptr};
 
     const void* rawPortThroughputSample{nullptr};
     const PortThroughputIntrospectionFieldTopic* typedPortThroughputSample{nullptr};
@@ -757,14 +800,14 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriodM
         // print port information
         if (introspectionSelection.port == true)
         {
-            bool newPortSampleArrived{false};
             bool newPortThroughputSampleeArrived{false};
             bool newReceiverPortChangingDataSamplesArrived{false};
 
-            if (portSubscriber.getChunk(&rawPortSample))
+            // drain all queued port samples, the deltas have to be applied in order
+            while (portSubscriber.getChunk(&rawPortSample))
             {
-                typedPortSample = static_cast<const PortIntrospectionFieldTopic*>(rawPortSample);
-                newPortSampleArrived = true;
+                updatePortState(static_cast<const PortIntrospectionFieldTopic*>(rawPortSample));
+                portSubscriber.releaseChunk(rawPortSample);
             }
             if (portThroughputSubscriber.getChunk(&rawPortThroughputSample))
             {
@@ -779,14 +822,13 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriodM
                 newReceiverPortChangingDataSamplesArrived = true;
             }
 
-            if (typedPortSample != nullptr && typedPortThroughputSample != nullptr
+            if (m_portStateInSync && typedPortThroughputSample != nullptr
                 && typedReceiverPortChangingDataSamples != nullptr)
             {
                 prettyPrint("### Connections ###\n\n", PrettyOptions::highlight);
 
-                auto composedSenderPortData = composeSenderPortData(typedPortSample, typedPortThroughputSample);
-                auto composedReceiverPortData =
-                    composeReceiverPortData(typedPortSample, typedReceiverPortChangingDataSamples);
+                auto composedSenderPortData = composeSenderPortData(typedPortThroughputSample);
+                auto composedReceiverPortData = composeReceiverPortData(typedReceiverPortChangingDataSamples);
 
                 printPortIntrospectionData(composedSenderPortData, composedReceiverPortData);
             }
@@ -795,10 +837,6 @@ void IntrospectionApp::runIntrospection(const iox::units::Duration updatePeriodM
                 prettyPrint("Waiting for port introspection data ...\n");
             }
 
-            if (newPortSampleArrived)
-            {
-                portSubscriber.releaseChunk(rawPortSample);
-            }
             if (newPortThroughputSampleeArrived)
             {
                 portThroughputSubscriber.releaseChunk(rawPortThroughputSample);